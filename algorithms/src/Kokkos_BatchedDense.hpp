@@ -0,0 +1,278 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_BatchedDense.hpp
+/// \brief Batched small-dense kernels (gemm, trsm, LU) with a
+///        team/vector batch mapping.
+///
+/// Applying millions of independent tiny factorizations (block-Jacobi,
+/// batched preconditioner setup) over hand-written TeamVectorRange
+/// loops leaves most of the machine idle: the loop bounds are runtime
+/// values the compiler cannot unroll and every batch pays the generic
+/// indexing.  The kernels here take the matrix dimensions as
+/// compile-time template parameters (bounded at 32) so the inner loops
+/// fully unroll, and come in two mappings: Team* kernels are
+/// collectives where one team cooperates on one matrix via
+/// TeamThreadRange/ThreadVectorRange, and Serial* kernels run entirely
+/// inside one thread or vector lane for matrices too small to share.
+/// batched_team_policy builds the TeamPolicy that maps one batch per
+/// league rank with a vector length matched to the matrix width.
+///
+/// Matrices are rank-2 views (typically subviews of a rank-3 batch
+/// view); the LU kernels factor in place without pivoting, which is
+/// the standard contract for the diagonally dominant blocks these
+/// solvers produce.
+
+#ifndef KOKKOS_BATCHEDDENSE_HPP_
+#define KOKKOS_BATCHEDDENSE_HPP_
+
+#include <Kokkos_Core.hpp>
+
+namespace Kokkos {
+namespace Experimental {
+
+//----------------------------------------------------------------------------
+
+/// \brief TeamPolicy mapping one batch per team with a vector length
+///        suited to an N-wide matrix.
+///
+/// League rank == batch index; the vector length is the largest
+/// power of two not exceeding N, clamped to the space's limit.
+template <int N, class ExecSpace>
+inline Kokkos::TeamPolicy<ExecSpace> batched_team_policy(const int nbatch) {
+  static_assert(N >= 1 && N <= 32,
+                "batched_team_policy: N must be in [1,32]");
+  int vl = 1;
+  while ((vl << 1) <= N) vl <<= 1;
+  const int vl_max =
+      Kokkos::TeamPolicy<ExecSpace>::vector_length_max();
+  if (vl > vl_max) vl = vl_max;
+  return Kokkos::TeamPolicy<ExecSpace>(nbatch, Kokkos::AUTO, vl);
+}
+
+//----------------------------------------------------------------------------
+
+/// \brief Single-thread gemm: C = beta*C + alpha*A*B with A MxK,
+///        B KxN, C MxN, all extents compile-time.
+template <int M, int N, int K, class AView, class BView, class CView,
+          class Scalar>
+KOKKOS_INLINE_FUNCTION void serial_gemm(const Scalar alpha, const AView& A,
+                                        const BView& B, const Scalar beta,
+                                        const CView& C) {
+  static_assert(M >= 1 && M <= 32 && N >= 1 && N <= 32 && K >= 1 && K <= 32,
+                "serial_gemm: extents must be in [1,32]");
+  typedef typename CView::non_const_value_type value_type;
+  for (int i = 0; i < M; ++i) {
+    for (int j = 0; j < N; ++j) {
+      value_type sum = value_type();
+      for (int k = 0; k < K; ++k) sum += A(i, k) * B(k, j);
+      C(i, j) = beta * C(i, j) + alpha * sum;
+    }
+  }
+}
+
+/// \brief Team-collective gemm: rows over TeamThreadRange, columns
+///        over ThreadVectorRange.  Barriers internally; every thread
+///        of the team must call it.
+template <int M, int N, int K, class TeamMember, class AView, class BView,
+          class CView, class Scalar>
+KOKKOS_INLINE_FUNCTION void team_gemm(const TeamMember& team,
+                                      const Scalar alpha, const AView& A,
+                                      const BView& B, const Scalar beta,
+                                      const CView& C) {
+  static_assert(M >= 1 && M <= 32 && N >= 1 && N <= 32 && K >= 1 && K <= 32,
+                "team_gemm: extents must be in [1,32]");
+  typedef typename CView::non_const_value_type value_type;
+  Kokkos::parallel_for(Kokkos::TeamThreadRange(team, M), [&](const int i) {
+    Kokkos::parallel_for(Kokkos::ThreadVectorRange(team, N),
+                         [&](const int j) {
+                           value_type sum = value_type();
+                           for (int k = 0; k < K; ++k)
+                             sum += A(i, k) * B(k, j);
+                           C(i, j) = beta * C(i, j) + alpha * sum;
+                         });
+  });
+  team.team_barrier();
+}
+
+//----------------------------------------------------------------------------
+
+/// \brief Single-thread in-place LU factorization without pivoting of
+///        an NxN matrix: A becomes L (unit diagonal, below) and U (on
+///        and above).
+template <int N, class AView>
+KOKKOS_INLINE_FUNCTION void serial_lu(const AView& A) {
+  static_assert(N >= 1 && N <= 32, "serial_lu: N must be in [1,32]");
+  typedef typename AView::non_const_value_type value_type;
+  for (int k = 0; k < N - 1; ++k) {
+    const value_type inv_pivot = value_type(1) / A(k, k);
+    for (int i = k + 1; i < N; ++i) {
+      const value_type l = A(i, k) * inv_pivot;
+      A(i, k)            = l;
+      for (int j = k + 1; j < N; ++j) A(i, j) -= l * A(k, j);
+    }
+  }
+}
+
+/// \brief Team-collective in-place LU without pivoting.  The k-loop is
+///        sequential with a barrier per stage; rows below the pivot
+///        update over TeamThreadRange with the trailing row over
+///        ThreadVectorRange.
+template <int N, class TeamMember, class AView>
+KOKKOS_INLINE_FUNCTION void team_lu(const TeamMember& team, const AView& A) {
+  static_assert(N >= 1 && N <= 32, "team_lu: N must be in [1,32]");
+  typedef typename AView::non_const_value_type value_type;
+  for (int k = 0; k < N - 1; ++k) {
+    const value_type inv_pivot = value_type(1) / A(k, k);
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(team, N - 1 - k), [&](const int ii) {
+          const int i        = k + 1 + ii;
+          const value_type l = A(i, k) * inv_pivot;
+          A(i, k)            = l;
+          Kokkos::parallel_for(
+              Kokkos::ThreadVectorRange(team, N - 1 - k),
+              [&](const int jj) { A(i, k + 1 + jj) -= l * A(k, k + 1 + jj); });
+        });
+    team.team_barrier();
+  }
+}
+
+//----------------------------------------------------------------------------
+
+/// \brief Single-thread triangular solve L*X = B with L the NxN
+///        unit-lower triangle of A (as produced by the LU kernels) and
+///        B NxNRHS, overwritten with X.
+template <int N, int NRHS, class AView, class BView>
+KOKKOS_INLINE_FUNCTION void serial_trsm_lower(const AView& A,
+                                              const BView& B) {
+  static_assert(N >= 1 && N <= 32 && NRHS >= 1 && NRHS <= 32,
+                "serial_trsm_lower: extents must be in [1,32]");
+  for (int i = 1; i < N; ++i) {
+    for (int j = 0; j < NRHS; ++j) {
+      for (int k = 0; k < i; ++k) B(i, j) -= A(i, k) * B(k, j);
+    }
+  }
+}
+
+/// \brief Single-thread triangular solve U*X = B with U the NxN upper
+///        triangle of A (non-unit diagonal) and B NxNRHS, overwritten
+///        with X.
+template <int N, int NRHS, class AView, class BView>
+KOKKOS_INLINE_FUNCTION void serial_trsm_upper(const AView& A,
+                                              const BView& B) {
+  static_assert(N >= 1 && N <= 32 && NRHS >= 1 && NRHS <= 32,
+                "serial_trsm_upper: extents must be in [1,32]");
+  typedef typename BView::non_const_value_type value_type;
+  for (int i = N - 1; i >= 0; --i) {
+    const value_type inv_diag = value_type(1) / A(i, i);
+    for (int j = 0; j < NRHS; ++j) {
+      for (int k = i + 1; k < N; ++k) B(i, j) -= A(i, k) * B(k, j);
+      B(i, j) *= inv_diag;
+    }
+  }
+}
+
+/// \brief Team-collective unit-lower triangular solve; right-hand
+///        sides are distributed over the team's vector lanes.
+template <int N, int NRHS, class TeamMember, class AView, class BView>
+KOKKOS_INLINE_FUNCTION void team_trsm_lower(const TeamMember& team,
+                                            const AView& A, const BView& B) {
+  static_assert(N >= 1 && N <= 32 && NRHS >= 1 && NRHS <= 32,
+                "team_trsm_lower: extents must be in [1,32]");
+  Kokkos::parallel_for(Kokkos::TeamThreadRange(team, 1), [&](const int) {
+    Kokkos::parallel_for(Kokkos::ThreadVectorRange(team, NRHS),
+                         [&](const int j) {
+                           for (int i = 1; i < N; ++i) {
+                             for (int k = 0; k < i; ++k)
+                               B(i, j) -= A(i, k) * B(k, j);
+                           }
+                         });
+  });
+  team.team_barrier();
+}
+
+/// \brief Team-collective upper triangular solve; right-hand sides are
+///        distributed over the team's vector lanes.
+template <int N, int NRHS, class TeamMember, class AView, class BView>
+KOKKOS_INLINE_FUNCTION void team_trsm_upper(const TeamMember& team,
+                                            const AView& A, const BView& B) {
+  static_assert(N >= 1 && N <= 32 && NRHS >= 1 && NRHS <= 32,
+                "team_trsm_upper: extents must be in [1,32]");
+  typedef typename BView::non_const_value_type value_type;
+  Kokkos::parallel_for(Kokkos::TeamThreadRange(team, 1), [&](const int) {
+    Kokkos::parallel_for(Kokkos::ThreadVectorRange(team, NRHS),
+                         [&](const int j) {
+                           for (int i = N - 1; i >= 0; --i) {
+                             for (int k = i + 1; k < N; ++k)
+                               B(i, j) -= A(i, k) * B(k, j);
+                             B(i, j) *= value_type(1) / A(i, i);
+                           }
+                         });
+  });
+  team.team_barrier();
+}
+
+//----------------------------------------------------------------------------
+
+/// \brief Single-thread solve of A*X = B given A factored in place by
+///        the LU kernels: forward then backward substitution.
+template <int N, int NRHS, class AView, class BView>
+KOKKOS_INLINE_FUNCTION void serial_lu_solve(const AView& A, const BView& B) {
+  serial_trsm_lower<N, NRHS>(A, B);
+  serial_trsm_upper<N, NRHS>(A, B);
+}
+
+/// \brief Team-collective solve of A*X = B given A factored in place
+///        by the LU kernels.
+template <int N, int NRHS, class TeamMember, class AView, class BView>
+KOKKOS_INLINE_FUNCTION void team_lu_solve(const TeamMember& team,
+                                          const AView& A, const BView& B) {
+  team_trsm_lower<N, NRHS>(team, A, B);
+  team_trsm_upper<N, NRHS>(team, A, B);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_BATCHEDDENSE_HPP_ */
@@ -0,0 +1,223 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_Histogram.hpp
+/// \brief Histogram primitive with automatic privatization.
+///
+/// Histograms written as atomic_fetch_add into a global View collapse
+/// under contention when the key distribution is skewed: every worker
+/// fights over the same hot bins.  histogram() privatizes instead -
+/// each worker fills its own zero-initialized page with plain stores,
+/// then the pages are merged bin-parallel, so contention never occurs
+/// regardless of the key distribution.  When privatization does not
+/// pay (more bins than elements, or pages that would exceed the
+/// memory budget) it falls back to the atomic path automatically.
+/// Counts are accumulated into the result View, so step-wise tallies
+/// compose across calls.
+
+#ifndef KOKKOS_HISTOGRAM_HPP_
+#define KOKKOS_HISTOGRAM_HPP_
+
+#include <Kokkos_Core.hpp>
+
+#include <string>
+
+namespace Kokkos {
+
+namespace Impl {
+
+template <class KeyFunctor, class PageView>
+struct HistogramPageFill {
+  KeyFunctor m_key;
+  PageView m_pages;
+  int64_t m_begin;
+  int64_t m_extent;
+  int64_t m_chunk;
+  int64_t m_bins;
+
+  HistogramPageFill(const KeyFunctor& arg_key, const PageView& arg_pages,
+                    const int64_t arg_begin, const int64_t arg_extent,
+                    const int64_t arg_chunk, const int64_t arg_bins)
+      : m_key(arg_key),
+        m_pages(arg_pages),
+        m_begin(arg_begin),
+        m_extent(arg_extent),
+        m_chunk(arg_chunk),
+        m_bins(arg_bins) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t w) const {
+    const int64_t lo = w * m_chunk;
+    const int64_t hi = lo + m_chunk < m_extent ? lo + m_chunk : m_extent;
+    for (int64_t i = lo; i < hi; ++i) {
+      const int64_t b = static_cast<int64_t>(m_key(m_begin + i));
+      if (0 <= b && b < m_bins) ++m_pages(w, b);
+    }
+  }
+};
+
+template <class PageView, class CountView>
+struct HistogramPageMerge {
+  PageView m_pages;
+  CountView m_result;
+  int64_t m_workers;
+
+  HistogramPageMerge(const PageView& arg_pages, const CountView& arg_result,
+                     const int64_t arg_workers)
+      : m_pages(arg_pages), m_result(arg_result), m_workers(arg_workers) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t b) const {
+    typename CountView::non_const_value_type sum = 0;
+    for (int64_t w = 0; w < m_workers; ++w) sum += m_pages(w, b);
+    m_result(b) += sum;
+  }
+};
+
+template <class KeyFunctor, class CountView>
+struct HistogramAtomicFill {
+  KeyFunctor m_key;
+  CountView m_result;
+  int64_t m_bins;
+
+  HistogramAtomicFill(const KeyFunctor& arg_key, const CountView& arg_result,
+                      const int64_t arg_bins)
+      : m_key(arg_key), m_result(arg_result), m_bins(arg_bins) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t i) const {
+    const int64_t b = static_cast<int64_t>(m_key(i));
+    if (0 <= b && b < m_bins)
+      Kokkos::atomic_increment(&m_result(b));
+  }
+};
+
+}  // namespace Impl
+
+namespace Experimental {
+
+/// \brief Accumulate a histogram of key(i) over the policy range into
+///        result(0..num_bins-1).  Keys outside [0, num_bins) are
+///        skipped; counts add onto whatever result already holds.
+template <class... Properties, class KeyFunctor, class CountView>
+void histogram(const std::string& label,
+               const Kokkos::RangePolicy<Properties...>& policy,
+               const KeyFunctor& key, const int64_t num_bins,
+               const CountView& result) {
+  typedef Kokkos::RangePolicy<Properties...> policy_type;
+  typedef typename policy_type::execution_space execution_space;
+  typedef typename CountView::non_const_value_type count_type;
+  typedef Kokkos::View<count_type**, typename execution_space::memory_space>
+      page_view;
+
+  static_assert(unsigned(CountView::rank) == 1,
+                "Kokkos::Experimental::histogram: result must be rank-1");
+
+  const int64_t begin  = policy.begin();
+  const int64_t extent = int64_t(policy.end()) - begin;
+  if (extent <= 0 || num_bins <= 0) return;
+
+  const int64_t concurrency = execution_space::concurrency();
+  int64_t workers           = concurrency < extent ? concurrency : extent;
+
+  // Pages beyond this budget thrash more than hot-bin atomics do
+  const int64_t page_budget = int64_t(1) << 26;  // 64 MB
+
+  if (num_bins >= extent ||
+      num_bins * workers * int64_t(sizeof(count_type)) > page_budget) {
+    Kokkos::Impl::HistogramAtomicFill<KeyFunctor, CountView> fill(
+        key, result, num_bins);
+    Kokkos::parallel_for(
+        label,
+        Kokkos::RangePolicy<execution_space, Kokkos::IndexType<int64_t>>(
+            begin, begin + extent),
+        fill);
+    return;
+  }
+
+  const int64_t chunk = (extent + workers - 1) / workers;
+
+  page_view pages(
+      Kokkos::ViewAllocateWithoutInitializing("Kokkos::histogram::pages"),
+      workers, num_bins);
+  Kokkos::deep_copy(pages, count_type(0));
+
+  Kokkos::Impl::HistogramPageFill<KeyFunctor, page_view> fill(
+      key, pages, begin, extent, chunk, num_bins);
+  Kokkos::parallel_for(
+      label,
+      Kokkos::RangePolicy<execution_space, Kokkos::IndexType<int64_t>>(
+          0, workers),
+      fill);
+
+  Kokkos::Impl::HistogramPageMerge<page_view, CountView> merge(pages, result,
+                                                               workers);
+  Kokkos::parallel_for(
+      label,
+      Kokkos::RangePolicy<execution_space, Kokkos::IndexType<int64_t>>(
+          0, num_bins),
+      merge);
+}
+
+template <class... Properties, class KeyFunctor, class CountView>
+void histogram(const Kokkos::RangePolicy<Properties...>& policy,
+               const KeyFunctor& key, const int64_t num_bins,
+               const CountView& result) {
+  histogram("Kokkos::histogram", policy, key, num_bins, result);
+}
+
+/// \brief Work-count form over the default execution space.
+template <class KeyFunctor, class CountView>
+void histogram(const int64_t work_count, const KeyFunctor& key,
+               const int64_t num_bins, const CountView& result) {
+  histogram("Kokkos::histogram",
+            Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace,
+                                Kokkos::IndexType<int64_t>>(0, work_count),
+            key, num_bins, result);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_HISTOGRAM_HPP_ */
@@ -678,6 +678,67 @@ class Random_XorShift64 {
   }
 };
 
+namespace Impl {
+
+// SplitMix64: every pool state is seeded independently from a hash of
+// (seed, state index), so seeding parallelizes over the states with no
+// sequential host generator in the chain.
+KOKKOS_INLINE_FUNCTION
+uint64_t random_pool_seed_hash(uint64_t x) {
+  x += 0x9E3779B97F4A7C15u;
+  x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9u;
+  x = (x ^ (x >> 27)) * 0x94D049BB133111EBu;
+  return x ^ (x >> 31);
+}
+
+template <class StateView, class LockView>
+struct RandomPoolSeed64 {
+  StateView state_;
+  LockView locks_;
+  uint64_t seed_;
+
+  RandomPoolSeed64(const StateView& state, const LockView& locks,
+                   const uint64_t seed)
+      : state_(state), locks_(locks), seed_(seed) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i) const {
+    uint64_t s =
+        random_pool_seed_hash(seed_ ^ random_pool_seed_hash(uint64_t(i) + 1));
+    // XorShift64 must never hold the all-zero state
+    if (s == 0) s = uint64_t(1318319);
+    state_(i) = s;
+    locks_(i) = 0;
+  }
+};
+
+template <class StateView, class LockView, class IntView>
+struct RandomPoolSeed1024 {
+  StateView state_;
+  LockView locks_;
+  IntView p_;
+  uint64_t seed_;
+
+  RandomPoolSeed1024(const StateView& state, const LockView& locks,
+                     const IntView& p, const uint64_t seed)
+      : state_(state), locks_(locks), p_(p), seed_(seed) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i) const {
+    for (int j = 0; j < 16; j++) {
+      uint64_t s = random_pool_seed_hash(
+          seed_ ^ random_pool_seed_hash(uint64_t(i) * 16 + j + 1));
+      // XorShift1024 must never hold the all-zero state
+      if (j == 0 && s == 0) s = uint64_t(1318319);
+      state_(i, j) = s;
+    }
+    p_(i)     = 0;
+    locks_(i) = 0;
+  }
+};
+
+}  // namespace Impl
+
 template <class DeviceType = Kokkos::DefaultExecutionSpace>
 class Random_XorShift64_Pool {
  private:
@@ -715,33 +776,40 @@ class Random_XorShift64_Pool {
   }
 
   void init(uint64_t seed, int num_states) {
-    if (seed == 0) seed = uint64_t(1318319);
-
     num_states_ = num_states;
 
-    locks_ = lock_type("Kokkos::Random_XorShift64::locks", num_states_);
-    state_ = state_data_type("Kokkos::Random_XorShift64::state", num_states_);
-
-    typename state_data_type::HostMirror h_state = create_mirror_view(state_);
-    typename lock_type::HostMirror h_lock        = create_mirror_view(locks_);
-
-    // Execute on the HostMirror's default execution space.
-    Random_XorShift64<typename state_data_type::HostMirror::execution_space>
-        gen(seed, 0);
-    for (int i = 0; i < 17; i++) gen.rand();
-    for (int i = 0; i < num_states_; i++) {
-      int n1     = gen.rand();
-      int n2     = gen.rand();
-      int n3     = gen.rand();
-      int n4     = gen.rand();
-      h_state(i) = (((static_cast<uint64_t>(n1)) & 0xffff) << 00) |
-                   (((static_cast<uint64_t>(n2)) & 0xffff) << 16) |
-                   (((static_cast<uint64_t>(n3)) & 0xffff) << 32) |
-                   (((static_cast<uint64_t>(n4)) & 0xffff) << 48);
-      h_lock(i) = 0;
+    locks_ = lock_type(
+        Kokkos::ViewAllocateWithoutInitializing("Kokkos::Random_XorShift64::locks"),
+        num_states_);
+    state_ = state_data_type(
+        Kokkos::ViewAllocateWithoutInitializing("Kokkos::Random_XorShift64::state"),
+        num_states_);
+
+    typename state_data_type::execution_space exec;
+    reseed(exec, seed);
+    exec.fence();
+  }
+
+  /// \brief Rehash every pool state from the given seed; runs
+  ///        asynchronously on the given execution space instance.
+  void reseed(const typename state_data_type::execution_space& exec,
+              uint64_t seed) {
+    if (num_states_ == 0) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Error: Kokkos::Random_XorShift64_Pool::reseed of an uninitialized "
+          "pool");
     }
-    deep_copy(state_, h_state);
-    deep_copy(locks_, h_lock);
+    if (seed == 0) seed = uint64_t(1318319);
+    Kokkos::parallel_for(
+        "Kokkos::Random_XorShift64::seed",
+        Kokkos::RangePolicy<typename state_data_type::execution_space>(
+            exec, 0, num_states_),
+        Impl::RandomPoolSeed64<state_data_type, lock_type>(state_, locks_,
+                                                           seed));
+  }
+
+  void reseed(uint64_t seed) {
+    reseed(typename state_data_type::execution_space(), seed);
   }
 
   KOKKOS_INLINE_FUNCTION
@@ -768,6 +836,274 @@ class Random_XorShift64_Pool {
   }
 };
 
+template <class DeviceType>
+class Random_Philox4x32_Pool;
+
+/// \brief Counter-based generator: the random stream is a pure function of a
+///        (seed, counter, stream index) triple, so no per-thread state arrays
+///        or lock views are needed.
+///
+/// Implements the Philox4x32-10 bijection.  Because construction is cheap and
+/// stateless, a generator can be created per loop iteration or per vector
+/// lane, e.g. Random_Philox4x32<Device>(seed, i) inside a ThreadVectorRange,
+/// which is not possible with the pool-managed XorShift generators.
+template <class DeviceType>
+class Random_Philox4x32 {
+ private:
+  uint32_t ctr_[4];
+  uint32_t key_[2];
+  uint32_t buf_[4];
+  int buf_pos_;
+  const int state_idx_;
+  friend class Random_Philox4x32_Pool<DeviceType>;
+
+  KOKKOS_INLINE_FUNCTION
+  static void round(uint32_t ctr[4], uint32_t key[2]) {
+    const uint64_t prod0 = uint64_t(0xD2511F53u) * ctr[0];
+    const uint64_t prod1 = uint64_t(0xCD9E8D57u) * ctr[2];
+    const uint32_t hi0   = uint32_t(prod0 >> 32);
+    const uint32_t lo0   = uint32_t(prod0);
+    const uint32_t hi1   = uint32_t(prod1 >> 32);
+    const uint32_t lo1   = uint32_t(prod1);
+    ctr[0]               = hi1 ^ ctr[1] ^ key[0];
+    ctr[1]               = lo1;
+    ctr[2]               = hi0 ^ ctr[3] ^ key[1];
+    ctr[3]               = lo0;
+    key[0] += 0x9E3779B9u;
+    key[1] += 0xBB67AE85u;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void fill_buffer() {
+    uint32_t c[4] = {ctr_[0], ctr_[1], ctr_[2], ctr_[3]};
+    uint32_t k[2] = {key_[0], key_[1]};
+    for (int r = 0; r < 10; r++) round(c, k);
+    buf_[0]  = c[0];
+    buf_[1]  = c[1];
+    buf_[2]  = c[2];
+    buf_[3]  = c[3];
+    buf_pos_ = 0;
+    // Advance the block counter for the next refill.
+    if (++ctr_[0] == 0) ++ctr_[1];
+  }
+
+ public:
+  typedef DeviceType device_type;
+
+  enum { MAX_URAND = 0xffffffffU };
+  enum { MAX_URAND64 = 0xffffffffffffffffULL - 1 };
+  enum { MAX_RAND = static_cast<int>(0xffffffff / 2) };
+  enum { MAX_RAND64 = static_cast<int64_t>(0xffffffffffffffffLL / 2 - 1) };
+
+  KOKKOS_INLINE_FUNCTION
+  Random_Philox4x32(uint64_t seed, uint64_t counter, int state_idx = 0)
+      : buf_pos_(4), state_idx_(state_idx) {
+    // 128-bit counter layout: [block, counter_lo, counter_hi, stream].
+    ctr_[0] = 0;
+    ctr_[1] = uint32_t(counter);
+    ctr_[2] = uint32_t(counter >> 32);
+    ctr_[3] = uint32_t(state_idx);
+    key_[0] = uint32_t(seed);
+    key_[1] = uint32_t(seed >> 32);
+  }
+
+  /// \brief One-shot pure function: the i-th 64-bit word of the stream
+  ///        defined by (seed, counter).
+  KOKKOS_INLINE_FUNCTION
+  static uint64_t draw(const uint64_t& counter, const uint64_t& seed) {
+    uint32_t c[4] = {0, uint32_t(counter), uint32_t(counter >> 32), 0};
+    uint32_t k[2] = {uint32_t(seed), uint32_t(seed >> 32)};
+    for (int r = 0; r < 10; r++) round(c, k);
+    return (uint64_t(c[0]) << 32) | c[1];
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint32_t urand() {
+    if (buf_pos_ == 4) fill_buffer();
+    return buf_[buf_pos_++];
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint64_t urand64() {
+    const uint64_t hi = urand();
+    uint64_t tmp      = (hi << 32) | urand();
+    if (tmp > uint64_t(MAX_URAND64)) tmp = uint64_t(MAX_URAND64);
+    return tmp;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint32_t urand(const uint32_t& range) {
+    const uint32_t max_val = (MAX_URAND / range) * range;
+    uint32_t tmp           = urand();
+    while (tmp >= max_val) tmp = urand();
+    return tmp % range;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint32_t urand(const uint32_t& start, const uint32_t& end) {
+    return urand(end - start) + start;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint64_t urand64(const uint64_t& range) {
+    const uint64_t max_val = (MAX_URAND64 / range) * range;
+    uint64_t tmp           = urand64();
+    while (tmp >= max_val) tmp = urand64();
+    return tmp % range;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint64_t urand64(const uint64_t& start, const uint64_t& end) {
+    return urand64(end - start) + start;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  int rand() { return static_cast<int>(urand() / 2); }
+
+  KOKKOS_INLINE_FUNCTION
+  int rand(const int& range) {
+    const int max_val = (MAX_RAND / range) * range;
+    int tmp           = rand();
+    while (tmp >= max_val) tmp = rand();
+    return tmp % range;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  int rand(const int& start, const int& end) {
+    return rand(end - start) + start;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  int64_t rand64() { return static_cast<int64_t>(urand64() / 2); }
+
+  KOKKOS_INLINE_FUNCTION
+  int64_t rand64(const int64_t& range) {
+    const int64_t max_val = (MAX_RAND64 / range) * range;
+    int64_t tmp           = rand64();
+    while (tmp >= max_val) tmp = rand64();
+    return tmp % range;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  int64_t rand64(const int64_t& start, const int64_t& end) {
+    return rand64(end - start) + start;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  float frand() { return 1.0f * urand64() / MAX_URAND64; }
+
+  KOKKOS_INLINE_FUNCTION
+  float frand(const float& range) { return range * urand64() / MAX_URAND64; }
+
+  KOKKOS_INLINE_FUNCTION
+  float frand(const float& start, const float& end) {
+    return frand(end - start) + start;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  double drand() { return 1.0 * urand64() / MAX_URAND64; }
+
+  KOKKOS_INLINE_FUNCTION
+  double drand(const double& range) { return range * urand64() / MAX_URAND64; }
+
+  KOKKOS_INLINE_FUNCTION
+  double drand(const double& start, const double& end) {
+    return drand(end - start) + start;
+  }
+
+  // Marsaglia polar method for drawing a standard normal distributed random
+  // number
+  KOKKOS_INLINE_FUNCTION
+  double normal() {
+    double S = 2.0;
+    double U;
+    while (S >= 1.0) {
+      U              = 2.0 * drand() - 1.0;
+      const double V = 2.0 * drand() - 1.0;
+      S              = U * U + V * V;
+    }
+    return U * std::sqrt(-2.0 * log(S) / S);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  double normal(const double& mean, const double& std_dev = 1.0) {
+    return mean + normal() * std_dev;
+  }
+};
+
+/// \brief Pool-compatible front end for Random_Philox4x32 holding no lock or
+///        state views.
+///
+/// get_state()/free_state() match the XorShift pools so existing code can
+/// switch generator types, but free_state() is a no-op and get_state() never
+/// contends: each call derives the generator from (seed, epoch, state index).
+/// Generators obtained in different parallel dispatches repeat their streams
+/// unless next_epoch() is called on the host between dispatches.
+template <class DeviceType = Kokkos::DefaultExecutionSpace>
+class Random_Philox4x32_Pool {
+ private:
+  uint64_t seed_;
+  uint64_t epoch_;
+  int num_states_;
+
+ public:
+  typedef Random_Philox4x32<DeviceType> generator_type;
+  typedef DeviceType device_type;
+
+  KOKKOS_INLINE_FUNCTION
+  Random_Philox4x32_Pool() : seed_(0), epoch_(0), num_states_(0) {}
+
+  Random_Philox4x32_Pool(uint64_t seed) {
+#ifdef KOKKOS_ENABLE_DEPRECATED_CODE
+    init(seed, DeviceType::max_hardware_threads());
+#else
+    init(seed, DeviceType::impl_max_hardware_threads());
+#endif
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  Random_Philox4x32_Pool(const Random_Philox4x32_Pool& src)
+      : seed_(src.seed_), epoch_(src.epoch_), num_states_(src.num_states_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  Random_Philox4x32_Pool operator=(const Random_Philox4x32_Pool& src) {
+    seed_       = src.seed_;
+    epoch_      = src.epoch_;
+    num_states_ = src.num_states_;
+    return *this;
+  }
+
+  void init(uint64_t seed, int num_states) {
+    if (seed == 0) seed = uint64_t(1318319);
+    seed_       = seed;
+    epoch_      = 0;
+    num_states_ = num_states;
+  }
+
+  // Advance to a fresh set of streams; call between parallel dispatches.
+  void next_epoch() { ++epoch_; }
+
+  KOKKOS_INLINE_FUNCTION
+  Random_Philox4x32<DeviceType> get_state() const {
+#ifdef KOKKOS_ENABLE_DEPRECATED_CODE
+    const int i = DeviceType::hardware_thread_id();
+#else
+    const int i = DeviceType::impl_hardware_thread_id();
+#endif
+    return Random_Philox4x32<DeviceType>(seed_, epoch_, i);
+  }
+
+  // NOTE: unlike the XorShift pools state_idx may be any stream number,
+  // e.g. the loop index, and need not be less than num_states
+  KOKKOS_INLINE_FUNCTION
+  Random_Philox4x32<DeviceType> get_state(const int state_idx) const {
+    return Random_Philox4x32<DeviceType>(seed_, epoch_, state_idx);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void free_state(const Random_Philox4x32<DeviceType>&) const {}
+};
+
 template <class DeviceType>
 class Random_XorShift1024_Pool;
 
@@ -963,36 +1299,44 @@ class Random_XorShift1024_Pool {
   }
 
   inline void init(uint64_t seed, int num_states) {
-    if (seed == 0) seed = uint64_t(1318319);
     num_states_ = num_states;
-    locks_ = int_view_type("Kokkos::Random_XorShift1024::locks", num_states_);
-    state_ = state_data_type("Kokkos::Random_XorShift1024::state", num_states_);
-    p_     = int_view_type("Kokkos::Random_XorShift1024::p", num_states_);
-
-    typename state_data_type::HostMirror h_state = create_mirror_view(state_);
-    typename int_view_type::HostMirror h_lock    = create_mirror_view(locks_);
-    typename int_view_type::HostMirror h_p       = create_mirror_view(p_);
-
-    // Execute on the HostMirror's default execution space.
-    Random_XorShift64<typename state_data_type::HostMirror::execution_space>
-        gen(seed, 0);
-    for (int i = 0; i < 17; i++) gen.rand();
-    for (int i = 0; i < num_states_; i++) {
-      for (int j = 0; j < 16; j++) {
-        int n1        = gen.rand();
-        int n2        = gen.rand();
-        int n3        = gen.rand();
-        int n4        = gen.rand();
-        h_state(i, j) = (((static_cast<uint64_t>(n1)) & 0xffff) << 00) |
-                        (((static_cast<uint64_t>(n2)) & 0xffff) << 16) |
-                        (((static_cast<uint64_t>(n3)) & 0xffff) << 32) |
-                        (((static_cast<uint64_t>(n4)) & 0xffff) << 48);
-      }
-      h_p(i)    = 0;
-      h_lock(i) = 0;
+    locks_      = int_view_type(
+        Kokkos::ViewAllocateWithoutInitializing(
+            "Kokkos::Random_XorShift1024::locks"),
+        num_states_);
+    state_ = state_data_type(
+        Kokkos::ViewAllocateWithoutInitializing(
+            "Kokkos::Random_XorShift1024::state"),
+        num_states_);
+    p_ = int_view_type(
+        Kokkos::ViewAllocateWithoutInitializing("Kokkos::Random_XorShift1024::p"),
+        num_states_);
+
+    typename state_data_type::execution_space exec;
+    reseed(exec, seed);
+    exec.fence();
+  }
+
+  /// \brief Rehash every pool state from the given seed; runs
+  ///        asynchronously on the given execution space instance.
+  inline void reseed(const typename state_data_type::execution_space& exec,
+                     uint64_t seed) {
+    if (num_states_ == 0) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Error: Kokkos::Random_XorShift1024_Pool::reseed of an "
+          "uninitialized pool");
     }
-    deep_copy(state_, h_state);
-    deep_copy(locks_, h_lock);
+    if (seed == 0) seed = uint64_t(1318319);
+    Kokkos::parallel_for(
+        "Kokkos::Random_XorShift1024::seed",
+        Kokkos::RangePolicy<typename state_data_type::execution_space>(
+            exec, 0, num_states_),
+        Impl::RandomPoolSeed1024<state_data_type, int_view_type,
+                                 int_view_type>(state_, locks_, p_, seed));
+  }
+
+  inline void reseed(uint64_t seed) {
+    reseed(typename state_data_type::execution_space(), seed);
   }
 
   KOKKOS_INLINE_FUNCTION
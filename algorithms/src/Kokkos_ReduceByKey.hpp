@@ -0,0 +1,356 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_ReduceByKey.hpp
+/// \brief Fused reduce-by-key over a sorted key sequence.
+///
+/// The sort-then-segmented-reduce pattern (particle-to-cell deposition,
+/// sparse assembly) is usually written as a hand-rolled kernel sequence
+/// with per-element intermediates.  reduce_by_key() replaces it with
+/// one pipeline: a single probe pass both counts the key runs and
+/// detects whether the input is already sorted - presorted input (the
+/// common case after a BinSort) skips the sort entirely, anything else
+/// is bin-sorted into scratch copies first.  The segmented reduction
+/// then walks the data once in contiguous per-worker chunks: runs
+/// owned by one chunk are reduced with plain stores, only runs that
+/// straddle a chunk boundary contribute atomically, so skewed run
+/// lengths neither serialize nor contend.  The only intermediate is
+/// the run-offset table, one entry per unique key.
+
+#ifndef KOKKOS_REDUCEBYKEY_HPP_
+#define KOKKOS_REDUCEBYKEY_HPP_
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Sort.hpp>
+
+#include <string>
+
+namespace Kokkos {
+
+namespace Impl {
+
+struct ReduceByKeyProbe {
+  int64_t runs;
+  int32_t unsorted;
+};
+
+// One pass over adjacent key pairs: counts run boundaries and flags
+// any descending pair, so sortedness detection costs no extra sweep.
+template <class KeysView>
+struct ReduceByKeyProbeFunctor {
+  typedef ReduceByKeyProbe value_type;
+
+  KeysView m_keys;
+
+  ReduceByKeyProbeFunctor(const KeysView& arg_keys) : m_keys(arg_keys) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t i, value_type& val) const {
+    if (!(m_keys(i) == m_keys(i - 1))) ++val.runs;
+    if (m_keys(i) < m_keys(i - 1)) val.unsorted = 1;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void init(value_type& val) const {
+    val.runs     = 0;
+    val.unsorted = 0;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void join(value_type& dest, const value_type& src) const {
+    dest.runs += src.runs;
+    dest.unsorted |= src.unsorted;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void join(volatile value_type& dest, const volatile value_type& src) const {
+    dest.runs += src.runs;
+    dest.unsorted |= src.unsorted;
+  }
+};
+
+// Scan over run heads: writes each unique key, the offset where its
+// run starts, and zero-initializes the slots the chunked reduction
+// will accumulate into atomically.
+template <class KeysView, class UniqueView, class OffsetView, class OutView>
+struct ReduceByKeyOffsets {
+  typedef int64_t value_type;
+
+  KeysView m_keys;
+  UniqueView m_unique;
+  OffsetView m_offsets;
+  OutView m_result;
+  int64_t m_extent;
+
+  ReduceByKeyOffsets(const KeysView& arg_keys, const UniqueView& arg_unique,
+                     const OffsetView& arg_offsets, const OutView& arg_result,
+                     const int64_t arg_extent)
+      : m_keys(arg_keys),
+        m_unique(arg_unique),
+        m_offsets(arg_offsets),
+        m_result(arg_result),
+        m_extent(arg_extent) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t i, value_type& update,
+                  const bool final_pass) const {
+    const int64_t head =
+        (0 == i) || !(m_keys(i) == m_keys(i - 1)) ? 1 : 0;
+    if (final_pass && head) {
+      m_unique(update)  = m_keys(i);
+      m_offsets(update) = i;
+      m_result(update)  = 0;
+    }
+    update += head;
+    if (final_pass && i + 1 == m_extent) m_offsets(update) = m_extent;
+  }
+};
+
+// Each worker reduces a contiguous chunk of elements, locating its
+// first run by binary search in the offset table.  Runs fully inside
+// the chunk are stored plainly; runs crossing a chunk boundary add
+// atomically onto the zero the offsets pass left behind.
+template <class ValuesView, class OffsetView, class OutView>
+struct ReduceByKeyChunkReduce {
+  typedef typename OutView::non_const_value_type sum_type;
+
+  ValuesView m_values;
+  OffsetView m_offsets;
+  OutView m_result;
+  int64_t m_extent;
+  int64_t m_chunk;
+  int64_t m_runs;
+
+  ReduceByKeyChunkReduce(const ValuesView& arg_values,
+                         const OffsetView& arg_offsets,
+                         const OutView& arg_result, const int64_t arg_extent,
+                         const int64_t arg_chunk, const int64_t arg_runs)
+      : m_values(arg_values),
+        m_offsets(arg_offsets),
+        m_result(arg_result),
+        m_extent(arg_extent),
+        m_chunk(arg_chunk),
+        m_runs(arg_runs) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t w) const {
+    const int64_t lo = w * m_chunk;
+    const int64_t hi =
+        lo + m_chunk < m_extent ? lo + m_chunk : m_extent;
+    if (lo >= hi) return;
+
+    // Largest run s with m_offsets(s) <= lo
+    int64_t s = 0;
+    {
+      int64_t b = m_runs;
+      while (s + 1 < b) {
+        const int64_t m = (s + b) / 2;
+        if (m_offsets(m) <= lo) {
+          s = m;
+        } else {
+          b = m;
+        }
+      }
+    }
+
+    int64_t i = lo;
+    while (i < hi) {
+      const int64_t run_end =
+          m_offsets(s + 1) < hi ? m_offsets(s + 1) : hi;
+      sum_type sum = 0;
+      for (; i < run_end; ++i) sum += m_values(i);
+      if (m_offsets(s) < lo || m_offsets(s + 1) > hi) {
+        Kokkos::atomic_add(&m_result(s), sum);
+      } else {
+        m_result(s) = sum;
+      }
+      ++s;
+    }
+  }
+};
+
+}  // namespace Impl
+
+namespace Experimental {
+
+/// \brief Sum values sharing a key: unique_keys_out receives each
+///        distinct key once and reduced_out the sum of its values;
+///        both are overwritten up to the returned count.  Presorted
+///        keys (ascending) are reduced in place; unsorted input is
+///        bin-sorted into scratch copies first.  The output Views
+///        must be large enough for the number of unique keys or a
+///        runtime exception is thrown.
+template <class KeysView, class ValuesView, class UniqueView, class OutView>
+int64_t reduce_by_key(const std::string& label, const KeysView& keys,
+                      const ValuesView& values,
+                      const UniqueView& unique_keys_out,
+                      const OutView& reduced_out) {
+  typedef typename KeysView::non_const_value_type key_type;
+  typedef typename ValuesView::non_const_value_type value_type;
+  typedef typename KeysView::execution_space execution_space;
+  typedef typename KeysView::memory_space memory_space;
+  typedef Kokkos::RangePolicy<execution_space, Kokkos::IndexType<int64_t>>
+      policy_type;
+  typedef Kokkos::View<key_type*, memory_space> scratch_keys_view;
+  typedef Kokkos::View<value_type*, memory_space> scratch_values_view;
+  typedef Kokkos::View<int64_t*, memory_space> offset_view;
+
+  static_assert(unsigned(KeysView::rank) == 1 &&
+                    unsigned(ValuesView::rank) == 1 &&
+                    unsigned(UniqueView::rank) == 1 &&
+                    unsigned(OutView::rank) == 1,
+                "Kokkos::Experimental::reduce_by_key: Views must be rank-1");
+  static_assert(std::is_arithmetic<key_type>::value,
+                "Kokkos::Experimental::reduce_by_key: keys must be an "
+                "arithmetic type to support the bin-sort fallback");
+
+  const int64_t n = keys.extent(0);
+
+  if (size_t(n) != values.extent(0)) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Error: Kokkos::reduce_by_key keys and values extents differ");
+  }
+  if (0 == n) return 0;
+
+  Kokkos::Impl::ReduceByKeyProbe probe;
+  Kokkos::parallel_reduce(label + "::Probe", policy_type(1, n),
+                          Kokkos::Impl::ReduceByKeyProbeFunctor<KeysView>(keys),
+                          probe);
+
+  scratch_keys_view sorted_keys;
+  scratch_values_view sorted_values;
+
+  if (probe.unsorted) {
+    sorted_keys = scratch_keys_view(
+        Kokkos::ViewAllocateWithoutInitializing("Kokkos::reduce_by_key::keys"),
+        n);
+    sorted_values = scratch_values_view(
+        Kokkos::ViewAllocateWithoutInitializing(
+            "Kokkos::reduce_by_key::values"),
+        n);
+    Kokkos::deep_copy(sorted_keys, keys);
+    Kokkos::deep_copy(sorted_values, values);
+
+    typedef Kokkos::BinOp1D<scratch_keys_view> comp_type;
+
+    Kokkos::MinMaxScalar<key_type> extent_result;
+    Kokkos::MinMax<key_type> extent_reducer(extent_result);
+    Kokkos::parallel_reduce(label + "::FindExtent", policy_type(0, n),
+                            Kokkos::Impl::min_max_functor<scratch_keys_view>(
+                                sorted_keys),
+                            extent_reducer);
+
+    if (!(extent_result.min_val == extent_result.max_val)) {
+      BinSort<scratch_keys_view, comp_type> bin_sort(
+          sorted_keys,
+          comp_type(n / 2, extent_result.min_val, extent_result.max_val),
+          true);
+      bin_sort.create_permute_vector();
+      bin_sort.sort(sorted_values);
+      bin_sort.sort(sorted_keys);
+    }
+
+    // Run count of the unsorted input is meaningless; recount.
+    probe.runs     = 0;
+    probe.unsorted = 0;
+    Kokkos::parallel_reduce(
+        label + "::Probe", policy_type(1, n),
+        Kokkos::Impl::ReduceByKeyProbeFunctor<scratch_keys_view>(sorted_keys), probe);
+  }
+
+  const int64_t num_unique = probe.runs + 1;
+
+  if (unique_keys_out.extent(0) < size_t(num_unique) ||
+      reduced_out.extent(0) < size_t(num_unique)) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Error: Kokkos::reduce_by_key output Views too small for the number "
+        "of unique keys");
+  }
+
+  offset_view offsets(
+      Kokkos::ViewAllocateWithoutInitializing("Kokkos::reduce_by_key::offsets"),
+      num_unique + 1);
+
+  const int64_t concurrency = execution_space::concurrency();
+  const int64_t workers     = concurrency < n ? concurrency : n;
+  const int64_t chunk       = (n + workers - 1) / workers;
+
+  if (probe.unsorted || sorted_keys.data() != nullptr) {
+    Kokkos::parallel_scan(
+        label + "::Offsets", policy_type(0, n),
+        Kokkos::Impl::ReduceByKeyOffsets<scratch_keys_view, UniqueView, offset_view,
+                                 OutView>(sorted_keys, unique_keys_out,
+                                          offsets, reduced_out, n));
+    Kokkos::parallel_for(
+        label, policy_type(0, workers),
+        Kokkos::Impl::ReduceByKeyChunkReduce<scratch_values_view, offset_view,
+                                     OutView>(sorted_values, offsets,
+                                              reduced_out, n, chunk,
+                                              num_unique));
+  } else {
+    Kokkos::parallel_scan(
+        label + "::Offsets", policy_type(0, n),
+        Kokkos::Impl::ReduceByKeyOffsets<KeysView, UniqueView, offset_view, OutView>(
+            keys, unique_keys_out, offsets, reduced_out, n));
+    Kokkos::parallel_for(
+        label, policy_type(0, workers),
+        Kokkos::Impl::ReduceByKeyChunkReduce<ValuesView, offset_view, OutView>(
+            values, offsets, reduced_out, n, chunk, num_unique));
+  }
+
+  return num_unique;
+}
+
+template <class KeysView, class ValuesView, class UniqueView, class OutView>
+int64_t reduce_by_key(const KeysView& keys, const ValuesView& values,
+                      const UniqueView& unique_keys_out,
+                      const OutView& reduced_out) {
+  return reduce_by_key("Kokkos::reduce_by_key", keys, values, unique_keys_out,
+                       reduced_out);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_REDUCEBYKEY_HPP_ */
@@ -0,0 +1,160 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+#ifndef KOKKOS_SHUFFLE_HPP_
+#define KOKKOS_SHUFFLE_HPP_
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+#include <Kokkos_Sort.hpp>
+
+namespace Kokkos {
+
+namespace Impl {
+
+template <class KeyViewType, class RandomPool>
+struct random_shuffle_key_functor {
+  KeyViewType keys;
+  RandomPool rand_pool;
+
+  random_shuffle_key_functor(KeyViewType keys_, RandomPool rand_pool_)
+      : keys(keys_), rand_pool(rand_pool_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t& i) const {
+    typename RandomPool::generator_type gen = rand_pool.get_state();
+    keys(i)                                 = gen.urand64();
+    rand_pool.free_state(gen);
+  }
+};
+
+template <class IndexViewType, class PermuteViewType>
+struct sample_gather_functor {
+  IndexViewType indices;
+  typename PermuteViewType::const_type permutation;
+
+  sample_gather_functor(IndexViewType indices_, PermuteViewType permutation_)
+      : indices(indices_), permutation(permutation_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t& i) const { indices(i) = permutation(i); }
+};
+
+}  // namespace Impl
+
+//----------------------------------------------------------------------------
+
+// \brief Randomly permute a view along its first dimension, entirely in the
+//        view's memory space.
+//
+// Draws one 64-bit key per entry from the pool and applies the permutation
+// that sorts the keys, so the shuffle is unbiased up to key collisions and
+// runs as two parallel passes with no host round trip.
+template <class ViewType, class RandomPool>
+void shuffle(ViewType const& view, RandomPool const& pool) {
+  typedef Kokkos::View<uint64_t*, typename ViewType::device_type> key_view_type;
+
+  const int64_t len = view.extent(0);
+  if (len < 2) return;
+
+  key_view_type keys(
+      ViewAllocateWithoutInitializing("Kokkos::ShuffleImpl::keys"), len);
+  Kokkos::parallel_for(
+      "Kokkos::Shuffle::RandomKeys",
+      Kokkos::RangePolicy<typename ViewType::execution_space>(0, len),
+      Impl::random_shuffle_key_functor<key_view_type, RandomPool>(keys, pool));
+
+  Experimental::RadixSort<key_view_type> radix(keys);
+  radix.create_permute_vector();
+  radix.sort(view);
+}
+
+// \brief Draw k distinct indices from [0,n) uniformly at random.
+//
+// Returns a device-resident view of k indices in the pool's memory space.
+// The sample is the prefix of a random permutation of [0,n): random keys are
+// sorted and the first k entries of the permute vector are gathered, so no
+// host round trip is needed.
+template <class RandomPool>
+Kokkos::View<int64_t*, typename RandomPool::device_type>
+sample_without_replacement(const int64_t n, const int64_t k,
+                           RandomPool const& pool) {
+  typedef typename RandomPool::device_type device_type;
+  typedef Kokkos::View<uint64_t*, device_type> key_view_type;
+  typedef Kokkos::View<int64_t*, device_type> index_view_type;
+
+  if (k > n) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::sample_without_replacement: sample size exceeds population");
+  }
+
+  index_view_type indices(
+      ViewAllocateWithoutInitializing("Kokkos::ShuffleImpl::indices"), k);
+  if (k == 0) return indices;
+
+  key_view_type keys(
+      ViewAllocateWithoutInitializing("Kokkos::ShuffleImpl::keys"), n);
+  Kokkos::parallel_for(
+      "Kokkos::Sample::RandomKeys",
+      Kokkos::RangePolicy<typename device_type::execution_space>(0, n),
+      Impl::random_shuffle_key_functor<key_view_type, RandomPool>(keys, pool));
+
+  Experimental::RadixSort<key_view_type> radix(keys);
+  radix.create_permute_vector();
+
+  Kokkos::parallel_for(
+      "Kokkos::Sample::Gather",
+      Kokkos::RangePolicy<typename device_type::execution_space>(0, k),
+      Impl::sample_gather_functor<
+          index_view_type,
+          typename Experimental::RadixSort<key_view_type>::offset_type>(
+          indices, radix.get_permute_vector()));
+
+  return indices;
+}
+
+}  // namespace Kokkos
+
+#endif
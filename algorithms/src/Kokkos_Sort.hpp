@@ -493,6 +493,533 @@ struct BinOp3D {
 
 namespace Impl {
 
+// Map a key type onto an unsigned integer of the same width whose unsigned
+// ordering matches the key's ordering, as required by LSD radix sorting.
+template <class T, class Enable = void>
+struct RadixSortConvert;
+
+template <class T>
+struct RadixSortConvert<
+    T, typename std::enable_if<std::is_integral<T>::value &&
+                               std::is_unsigned<T>::value>::type> {
+  typedef T unsigned_type;
+
+  KOKKOS_INLINE_FUNCTION
+  static unsigned_type convert(const T& x) { return x; }
+};
+
+template <class T>
+struct RadixSortConvert<
+    T, typename std::enable_if<std::is_integral<T>::value &&
+                               std::is_signed<T>::value>::type> {
+  typedef typename std::make_unsigned<T>::type unsigned_type;
+
+  KOKKOS_INLINE_FUNCTION
+  static unsigned_type convert(const T& x) {
+    // Flip the sign bit so negative values order below positive ones.
+    return static_cast<unsigned_type>(x) ^
+           (unsigned_type(1) << (sizeof(T) * 8 - 1));
+  }
+};
+
+template <>
+struct RadixSortConvert<float> {
+  typedef uint32_t unsigned_type;
+
+  KOKKOS_INLINE_FUNCTION
+  static unsigned_type convert(const float& x) {
+    union {
+      float f;
+      uint32_t u;
+    } tmp;
+    tmp.f = x;
+    // Negative floats compare in reverse bit order: flip all bits.
+    // Positive floats only need the sign bit set.
+    return (tmp.u & 0x80000000u) ? ~tmp.u : (tmp.u | 0x80000000u);
+  }
+};
+
+template <>
+struct RadixSortConvert<double> {
+  typedef uint64_t unsigned_type;
+
+  KOKKOS_INLINE_FUNCTION
+  static unsigned_type convert(const double& x) {
+    union {
+      double f;
+      uint64_t u;
+    } tmp;
+    tmp.f = x;
+    return (tmp.u & 0x8000000000000000ull) ? ~tmp.u
+                                           : (tmp.u | 0x8000000000000000ull);
+  }
+};
+
+}  // namespace Impl
+
+//----------------------------------------------------------------------------
+
+namespace Experimental {
+
+// \brief Stable LSD radix sort producing a permutation vector.
+//
+// Sorts integer and floating point keys one byte-wide digit at a time using
+// per-block histograms and a digit-major exclusive scan, so every pass is a
+// stable counting sort.  The interface mirrors BinSort: construct with the
+// keys, call create_permute_vector(), then apply sort() to the keys and any
+// number of value views.  For uniformly distributed large key sets this
+// avoids the bin-granularity serial cleanup BinSort needs for a full sort.
+template <class KeyViewType, class Space = typename KeyViewType::device_type,
+          class SizeType = typename KeyViewType::memory_space::size_type>
+class RadixSort {
+ public:
+  typedef typename Space::execution_space execution_space;
+  typedef SizeType size_type;
+  typedef size_type value_type;
+
+  typedef typename KeyViewType::const_type const_key_view_type;
+  typedef typename KeyViewType::non_const_value_type non_const_key_scalar;
+  typedef Kokkos::Impl::RadixSortConvert<non_const_key_scalar> key_convert;
+  typedef typename key_convert::unsigned_type unsigned_key_type;
+
+  typedef Kokkos::View<size_type*, Space> offset_type;
+  typedef Kokkos::View<unsigned_key_type*, Space> unsigned_key_view_type;
+
+  enum { Radix = 256, RadixBits = 8 };
+
+  struct radix_transform_tag {};
+  struct radix_count_tag {};
+  struct radix_offset_tag {};
+  struct radix_scatter_tag {};
+  struct radix_order_tag {};
+
+  template <class DstViewType, class PermuteViewType, class SrcViewType>
+  struct copy_permute_functor {
+    typedef typename std::conditional<
+        Kokkos::is_view<SrcViewType>::value,
+        Kokkos::View<typename SrcViewType::const_data_type,
+                     typename SrcViewType::array_layout,
+                     typename SrcViewType::device_type,
+                     Kokkos::MemoryTraits<Kokkos::RandomAccess> >,
+        typename SrcViewType::const_type>::type src_view_type;
+
+    typedef typename PermuteViewType::const_type perm_view_type;
+
+    typedef Kokkos::Impl::CopyOp<DstViewType, src_view_type> copy_op;
+
+    DstViewType dst_values;
+    perm_view_type sort_order;
+    src_view_type src_values;
+    int src_offset;
+
+    copy_permute_functor(DstViewType const& dst_values_,
+                         PermuteViewType const& sort_order_,
+                         SrcViewType const& src_values_, int const& src_offset_)
+        : dst_values(dst_values_),
+          sort_order(sort_order_),
+          src_values(src_values_),
+          src_offset(src_offset_) {}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const int& i) const {
+      copy_op::copy(dst_values, i, src_values, src_offset + sort_order(i));
+    }
+  };
+
+  template <class DstViewType, class SrcViewType>
+  struct copy_functor {
+    typedef typename SrcViewType::const_type src_view_type;
+
+    typedef Kokkos::Impl::CopyOp<DstViewType, src_view_type> copy_op;
+
+    DstViewType dst_values;
+    src_view_type src_values;
+    int dst_offset;
+
+    copy_functor(DstViewType const& dst_values_, int const& dst_offset_,
+                 SrcViewType const& src_values_)
+        : dst_values(dst_values_),
+          src_values(src_values_),
+          dst_offset(dst_offset_) {}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const int& i) const {
+      copy_op::copy(dst_values, i + dst_offset, src_values, i);
+    }
+  };
+
+ private:
+  const_key_view_type keys;
+  unsigned_key_view_type keys_radix;
+  offset_type order_a;
+  offset_type order_b;
+  offset_type order_in;
+  offset_type order_out;
+  offset_type block_count;
+  offset_type block_offset;
+  offset_type sort_order;
+
+  int range_begin;
+  int range_end;
+  size_type m_len;
+  size_type m_nblocks;
+  size_type m_block_len;
+  int m_shift;
+
+ public:
+  RadixSort() {}
+
+  //----------------------------------------
+  // Constructor: takes the keys and optionally the range to sort
+  RadixSort(const_key_view_type keys_, int range_begin_, int range_end_)
+      : keys(keys_),
+        range_begin(range_begin_),
+        range_end(range_end_),
+        m_len(range_end_ - range_begin_),
+        m_shift(0) {
+    // One histogram block per chunk of keys; clamp the block count so the
+    // digit-major scan stays small while every thread keeps work.
+    size_type nblocks =
+        size_type(execution_space::concurrency()) < size_type(4096)
+            ? size_type(execution_space::concurrency())
+            : size_type(4096);
+    const size_type max_useful = (m_len + 1023) / 1024;
+    if (nblocks > max_useful) nblocks = max_useful;
+    if (nblocks < 1) nblocks = 1;
+    m_nblocks   = nblocks;
+    m_block_len = (m_len + m_nblocks - 1) / m_nblocks;
+
+    keys_radix = unsigned_key_view_type(
+        ViewAllocateWithoutInitializing("Kokkos::SortImpl::RadixSort::keys"),
+        m_len);
+    order_a = offset_type(
+        ViewAllocateWithoutInitializing("Kokkos::SortImpl::RadixSort::order_a"),
+        m_len);
+    order_b = offset_type(
+        ViewAllocateWithoutInitializing("Kokkos::SortImpl::RadixSort::order_b"),
+        m_len);
+    block_count = offset_type("Kokkos::SortImpl::RadixSort::block_count",
+                              size_type(Radix) * m_nblocks);
+    block_offset =
+        offset_type(ViewAllocateWithoutInitializing(
+                        "Kokkos::SortImpl::RadixSort::block_offset"),
+                    size_type(Radix) * m_nblocks);
+    sort_order =
+        offset_type(ViewAllocateWithoutInitializing(
+                        "Kokkos::SortImpl::RadixSort::sort_order"),
+                    m_len);
+  }
+
+  RadixSort(const_key_view_type keys_)
+      : RadixSort(keys_, 0, keys_.extent(0)) {}
+
+  //----------------------------------------
+  // Create the permutation vector.  Can be called again if keys changed.
+  void create_permute_vector() {
+    if (m_len == 0) return;
+
+    Kokkos::parallel_for(
+        "Kokkos::Sort::RadixTransform",
+        Kokkos::RangePolicy<execution_space, radix_transform_tag>(0, m_len),
+        *this);
+
+    order_in          = order_a;
+    order_out         = order_b;
+    const int npasses = int(sizeof(unsigned_key_type) * 8) / RadixBits;
+    for (int pass = 0; pass < npasses; ++pass) {
+      m_shift = pass * RadixBits;
+      Kokkos::deep_copy(block_count, size_type(0));
+      Kokkos::parallel_for(
+          "Kokkos::Sort::RadixCount",
+          Kokkos::RangePolicy<execution_space, radix_count_tag>(0, m_nblocks),
+          *this);
+      Kokkos::parallel_scan(
+          "Kokkos::Sort::RadixOffset",
+          Kokkos::RangePolicy<execution_space, radix_offset_tag>(
+              0, size_type(Radix) * m_nblocks),
+          *this);
+      Kokkos::parallel_for(
+          "Kokkos::Sort::RadixScatter",
+          Kokkos::RangePolicy<execution_space, radix_scatter_tag>(0, m_nblocks),
+          *this);
+      offset_type tmp = order_in;
+      order_in        = order_out;
+      order_out       = tmp;
+    }
+
+    Kokkos::parallel_for(
+        "Kokkos::Sort::RadixOrder",
+        Kokkos::RangePolicy<execution_space, radix_order_tag>(0, m_len), *this);
+  }
+
+  // Sort a subset of a view with respect to the first dimension using the
+  // permutation array
+  template <class ValuesViewType>
+  void sort(ValuesViewType const& values, int values_range_begin,
+            int values_range_end) const {
+    typedef Kokkos::View<typename ValuesViewType::data_type,
+                         typename ValuesViewType::array_layout,
+                         typename ValuesViewType::device_type>
+        scratch_view_type;
+
+    const size_t len        = range_end - range_begin;
+    const size_t values_len = values_range_end - values_range_begin;
+    if (len != values_len) {
+      Kokkos::abort(
+          "RadixSort::sort: values range length != permutation vector length");
+    }
+
+#ifdef KOKKOS_ENABLE_DEPRECATED_CODE
+    scratch_view_type sorted_values(
+        ViewAllocateWithoutInitializing(
+            "Kokkos::SortImpl::RadixSort::sorted_values"),
+        len, values.extent(1), values.extent(2), values.extent(3),
+        values.extent(4), values.extent(5), values.extent(6), values.extent(7));
+#else
+    scratch_view_type sorted_values(
+        ViewAllocateWithoutInitializing(
+            "Kokkos::SortImpl::RadixSort::sorted_values"),
+        values.rank_dynamic > 0 ? len : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+        values.rank_dynamic > 1 ? values.extent(1)
+                                : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+        values.rank_dynamic > 2 ? values.extent(2)
+                                : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+        values.rank_dynamic > 3 ? values.extent(3)
+                                : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+        values.rank_dynamic > 4 ? values.extent(4)
+                                : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+        values.rank_dynamic > 5 ? values.extent(5)
+                                : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+        values.rank_dynamic > 6 ? values.extent(6)
+                                : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+        values.rank_dynamic > 7 ? values.extent(7)
+                                : KOKKOS_IMPL_CTOR_DEFAULT_ARG);
+#endif
+
+    {
+      copy_permute_functor<scratch_view_type, offset_type, ValuesViewType>
+          functor(sorted_values, sort_order, values,
+                  values_range_begin - range_begin);
+
+      parallel_for("Kokkos::Sort::RadixCopyPermute",
+                   Kokkos::RangePolicy<execution_space>(0, len), functor);
+    }
+
+    {
+      copy_functor<ValuesViewType, scratch_view_type> functor(
+          values, range_begin, sorted_values);
+
+      parallel_for("Kokkos::Sort::RadixCopy",
+                   Kokkos::RangePolicy<execution_space>(0, len), functor);
+    }
+
+    Kokkos::fence();
+  }
+
+  template <class ValuesViewType>
+  void sort(ValuesViewType const& values) const {
+    this->sort(values, 0, range_end - range_begin);
+  }
+
+  // Get the permutation vector
+  KOKKOS_INLINE_FUNCTION
+  offset_type get_permute_vector() const { return sort_order; }
+
+ public:
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const radix_transform_tag&, const size_type& i) const {
+    keys_radix(i) = key_convert::convert(keys(range_begin + i));
+    order_a(i)    = i;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const radix_count_tag&, const size_type& b) const {
+    const size_type begin = b * m_block_len;
+    size_type end         = begin + m_block_len;
+    if (end > m_len) end = m_len;
+    for (size_type i = begin; i < end; ++i) {
+      const size_type d = (keys_radix(order_in(i)) >> m_shift) & (Radix - 1);
+      block_count(d * m_nblocks + b)++;
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const radix_offset_tag&, const size_type& i,
+                  value_type& offset, const bool& final) const {
+    if (final) {
+      block_offset(i) = offset;
+    }
+    offset += block_count(i);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const radix_scatter_tag&, const size_type& b) const {
+    // Each (digit,block) slot of block_offset is owned exclusively by this
+    // block, so the in-place increment needs no atomics and keeps the pass
+    // stable.
+    const size_type begin = b * m_block_len;
+    size_type end         = begin + m_block_len;
+    if (end > m_len) end = m_len;
+    for (size_type i = begin; i < end; ++i) {
+      const size_type d = (keys_radix(order_in(i)) >> m_shift) & (Radix - 1);
+      order_out(block_offset(d * m_nblocks + b)++) = order_in(i);
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const radix_order_tag&, const size_type& i) const {
+    sort_order(i) = order_in(i) + range_begin;
+  }
+};
+
+//----------------------------------------------------------------------------
+
+// \brief Sort a view of keys in place with a stable LSD radix sort.
+template <class KeyViewType>
+void radix_sort(KeyViewType const& keys) {
+  RadixSort<KeyViewType> radix(keys);
+  radix.create_permute_vector();
+  radix.sort(keys);
+}
+
+// \brief Sort keys in place and apply the same permutation to values.
+template <class KeyViewType, class ValuesViewType>
+void radix_sort(KeyViewType const& keys, ValuesViewType const& values) {
+  RadixSort<KeyViewType> radix(keys);
+  radix.create_permute_vector();
+  radix.sort(values);
+  radix.sort(keys);
+}
+
+//----------------------------------------------------------------------------
+
+// \brief Team-per-segment sort functor used by segmented_sort().
+//
+// Each league member sorts one segment with a normalized bitonic network in
+// which every compare-exchange puts the smaller key at the lower index, so
+// segments whose length is not a power of two only need a bounds guard (the
+// missing tail behaves as +infinity).  Segments that fit are staged through
+// team scratch memory; larger segments are sorted in place.
+template <class KeyViewType, class OffsetViewType, class Space>
+struct SegmentedSortFunctor {
+  typedef typename Space::execution_space execution_space;
+  typedef typename Kokkos::TeamPolicy<execution_space>::member_type member_type;
+  typedef typename KeyViewType::non_const_value_type key_type;
+  typedef typename OffsetViewType::non_const_value_type offset_type;
+  typedef Kokkos::View<key_type*,
+                       typename execution_space::scratch_memory_space,
+                       Kokkos::MemoryUnmanaged>
+      scratch_key_view;
+
+  KeyViewType keys;
+  typename OffsetViewType::const_type segment_offsets;
+  int scratch_len;
+
+  SegmentedSortFunctor(KeyViewType const& keys_,
+                       OffsetViewType const& segment_offsets_,
+                       int const& scratch_len_)
+      : keys(keys_),
+        segment_offsets(segment_offsets_),
+        scratch_len(scratch_len_) {}
+
+  template <class ViewLike>
+  KOKKOS_INLINE_FUNCTION void bitonic(const member_type& team,
+                                      const ViewLike& v,
+                                      const offset_type base,
+                                      const offset_type n) const {
+    offset_type npot = 1;
+    while (npot < n) npot <<= 1;
+    for (offset_type k = 2; k <= npot; k <<= 1) {
+      // Reflected first step of the merge keeps every exchange ascending.
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team, npot / 2),
+                           [&](const offset_type& i) {
+                             const offset_type box = i / (k / 2);
+                             const offset_type t   = i % (k / 2);
+                             const offset_type l   = box * k + t;
+                             const offset_type r   = box * k + k - 1 - t;
+                             if (r < n && v(base + r) < v(base + l)) {
+                               const key_type tmp = v(base + l);
+                               v(base + l)        = v(base + r);
+                               v(base + r)        = tmp;
+                             }
+                           });
+      team.team_barrier();
+      for (offset_type j = k >> 2; j > 0; j >>= 1) {
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(team, npot / 2),
+                             [&](const offset_type& i) {
+                               const offset_type box = i / j;
+                               const offset_type t   = i % j;
+                               const offset_type l   = box * 2 * j + t;
+                               const offset_type r   = l + j;
+                               if (r < n && v(base + r) < v(base + l)) {
+                                 const key_type tmp = v(base + l);
+                                 v(base + l)        = v(base + r);
+                                 v(base + r)        = tmp;
+                               }
+                             });
+        team.team_barrier();
+      }
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const member_type& team) const {
+    const offset_type begin = segment_offsets(team.league_rank());
+    const offset_type n     = segment_offsets(team.league_rank() + 1) - begin;
+    if (n < 2) return;
+
+    if (n <= offset_type(scratch_len)) {
+      scratch_key_view tmp(team.team_scratch(0), scratch_len);
+      Kokkos::parallel_for(
+          Kokkos::TeamThreadRange(team, n),
+          [&](const offset_type& i) { tmp(i) = keys(begin + i); });
+      team.team_barrier();
+      bitonic(team, tmp, 0, n);
+      Kokkos::parallel_for(
+          Kokkos::TeamThreadRange(team, n),
+          [&](const offset_type& i) { keys(begin + i) = tmp(i); });
+    } else {
+      bitonic(team, keys, begin, n);
+    }
+  }
+};
+
+// \brief Sort many independent key ranges, one team per segment.
+//
+// segment_offsets holds the begin offset of each segment plus a final end
+// offset, i.e. segment s is [segment_offsets(s), segment_offsets(s+1)).
+// Segments fitting in scratch_bytes of team scratch are sorted in shared
+// memory; larger segments are sorted in place, so segment locality is kept
+// and no global sort or per-segment dispatch is needed.
+template <class KeyViewType, class OffsetViewType>
+void segmented_sort(KeyViewType const& keys,
+                    OffsetViewType const& segment_offsets,
+                    size_t const scratch_bytes = 8192) {
+  typedef typename KeyViewType::execution_space execution_space;
+  typedef typename KeyViewType::device_type device_type;
+  typedef typename KeyViewType::non_const_value_type key_type;
+
+  const int nsegments = int(segment_offsets.extent(0)) - 1;
+  if (nsegments < 1) return;
+
+  const int scratch_len = int(scratch_bytes / sizeof(key_type));
+
+  SegmentedSortFunctor<KeyViewType, OffsetViewType, device_type> functor(
+      keys, segment_offsets, scratch_len);
+
+  Kokkos::TeamPolicy<execution_space> policy(nsegments, Kokkos::AUTO);
+  policy = policy.set_scratch_size(
+      0, Kokkos::PerTeam(scratch_len * sizeof(key_type)));
+
+  Kokkos::parallel_for("Kokkos::Sort::SegmentedSort", policy, functor);
+}
+
+}  // namespace Experimental
+
+//----------------------------------------------------------------------------
+
+namespace Impl {
+
 template <class ViewType>
 bool try_std_sort(ViewType view) {
   bool possible    = true;
@@ -0,0 +1,437 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_STD_ALGORITHMS_HPP_
+#define KOKKOS_STD_ALGORITHMS_HPP_
+
+/// \file Kokkos_StdAlgorithms.hpp
+/// \brief Device-parallel counterparts of the keyed and ordered std
+/// algorithms over rank-1 Views: inclusive_scan, exclusive_scan,
+/// lower_bound, merge, unique, sort_by_key and reduce_by_key.
+///
+/// All functions are synchronous single-dispatch primitives running in
+/// the Views' execution space; they compose through memory, not through
+/// host round trips, so a pipeline of them never touches a mirror.
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Sort.hpp>
+
+namespace Kokkos {
+namespace Experimental {
+
+namespace Impl {
+
+template <class InViewType, class OutViewType>
+struct StdInclusiveScan {
+  typedef typename OutViewType::non_const_value_type value_type;
+
+  typename InViewType::const_type m_in;
+  OutViewType m_out;
+
+  StdInclusiveScan(const InViewType& in_, const OutViewType& out_)
+      : m_in(in_), m_out(out_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t& i, value_type& update,
+                  const bool final) const {
+    update += m_in(i);
+    if (final) m_out(i) = update;
+  }
+};
+
+template <class InViewType, class OutViewType>
+struct StdExclusiveScan {
+  typedef typename OutViewType::non_const_value_type value_type;
+
+  typename InViewType::const_type m_in;
+  OutViewType m_out;
+
+  StdExclusiveScan(const InViewType& in_, const OutViewType& out_)
+      : m_in(in_), m_out(out_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t& i, value_type& update,
+                  const bool final) const {
+    if (final) m_out(i) = update;
+    update += m_in(i);
+  }
+};
+
+// One binary search per query; the sorted table is marked RandomAccess
+// so backends with a texture path use it
+template <class SortedViewType, class QueryViewType, class IndexViewType>
+struct StdLowerBound {
+  typedef Kokkos::View<typename SortedViewType::const_data_type,
+                       typename SortedViewType::array_layout,
+                       typename SortedViewType::device_type,
+                       Kokkos::MemoryTraits<Kokkos::RandomAccess> >
+      sorted_view_type;
+
+  sorted_view_type m_sorted;
+  typename QueryViewType::const_type m_queries;
+  IndexViewType m_indices;
+
+  StdLowerBound(const SortedViewType& sorted_, const QueryViewType& queries_,
+                const IndexViewType& indices_)
+      : m_sorted(sorted_), m_queries(queries_), m_indices(indices_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t& q) const {
+    const typename QueryViewType::non_const_value_type key = m_queries(q);
+    int64_t lo = 0;
+    int64_t hi = m_sorted.extent(0);
+    while (lo < hi) {
+      const int64_t mid = (lo + hi) >> 1;
+      if (m_sorted(mid) < key)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+    m_indices(q) = lo;
+  }
+};
+
+// Merge-path: each output element independently finds its split point
+// (i, k - i) between the two inputs with a binary search over the
+// cross diagonal, so the merge is embarrassingly parallel and stable
+// with ties taken from the first input
+template <class AViewType, class BViewType, class OutViewType>
+struct StdMerge {
+  typename AViewType::const_type m_a;
+  typename BViewType::const_type m_b;
+  OutViewType m_out;
+
+  StdMerge(const AViewType& a_, const BViewType& b_, const OutViewType& out_)
+      : m_a(a_), m_b(b_), m_out(out_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t& k) const {
+    const int64_t na = m_a.extent(0);
+    const int64_t nb = m_b.extent(0);
+
+    int64_t lo = (k > nb) ? k - nb : 0;
+    int64_t hi = (k < na) ? k : na;
+    while (lo < hi) {
+      const int64_t i = (lo + hi) >> 1;
+      if (!(m_b(k - i - 1) < m_a(i)))
+        lo = i + 1;
+      else
+        hi = i;
+    }
+    const int64_t i = lo;
+    const int64_t j = k - lo;
+    m_out(k) = (i < na && (j >= nb || !(m_b(j) < m_a(i)))) ? m_a(i) : m_b(j);
+  }
+};
+
+template <class InViewType, class OutViewType>
+struct StdUnique {
+  typedef int64_t value_type;
+
+  typename InViewType::const_type m_in;
+  OutViewType m_out;
+
+  StdUnique(const InViewType& in_, const OutViewType& out_)
+      : m_in(in_), m_out(out_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t& i, value_type& update,
+                  const bool final) const {
+    const int head = (0 == i || !(m_in(i - 1) == m_in(i))) ? 1 : 0;
+    update += head;
+    if (final && head) m_out(update - 1) = m_in(i);
+  }
+};
+
+// Single fused pass over the sorted keys: the scan of the segment-head
+// flags numbers the segments, and the final pass writes the unique key
+// and the segment start offset in place
+template <class KeyViewType, class OutKeyViewType, class StartViewType>
+struct StdReduceByKeySegments {
+  typedef int64_t value_type;
+
+  typename KeyViewType::const_type m_keys;
+  OutKeyViewType m_out_keys;
+  StartViewType m_starts;
+
+  StdReduceByKeySegments(const KeyViewType& keys_,
+                         const OutKeyViewType& out_keys_,
+                         const StartViewType& starts_)
+      : m_keys(keys_), m_out_keys(out_keys_), m_starts(starts_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t& i, value_type& update,
+                  const bool final) const {
+    const int head = (0 == i || !(m_keys(i - 1) == m_keys(i))) ? 1 : 0;
+    update += head;
+    if (final && head) {
+      m_out_keys(update - 1) = m_keys(i);
+      m_starts(update - 1)   = i;
+    }
+  }
+};
+
+// Deterministic segment sums: one work item owns one segment, so no
+// atomics and no floating point reassociation across runs
+template <class ValueViewType, class OutValueViewType, class StartViewType>
+struct StdReduceByKeySums {
+  typename ValueViewType::const_type m_values;
+  OutValueViewType m_out_values;
+  typename StartViewType::const_type m_starts;
+
+  StdReduceByKeySums(const ValueViewType& values_,
+                     const OutValueViewType& out_values_,
+                     const StartViewType& starts_)
+      : m_values(values_), m_out_values(out_values_), m_starts(starts_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t& s) const {
+    const int64_t begin = m_starts(s);
+    const int64_t end   = m_starts(s + 1);
+    typename OutValueViewType::non_const_value_type sum = m_values(begin);
+    for (int64_t i = begin + 1; i < end; ++i) sum += m_values(i);
+    m_out_values(s) = sum;
+  }
+};
+
+}  // namespace Impl
+
+//----------------------------------------------------------------------------
+
+/// \brief Inclusive prefix sum of a rank-1 view; returns the total.
+///
+/// in and out may alias for an in-place scan.
+template <class InViewType, class OutViewType>
+typename OutViewType::non_const_value_type inclusive_scan(
+    const InViewType& in, const OutViewType& out) {
+  static_assert(unsigned(InViewType::Rank) == 1 &&
+                    unsigned(OutViewType::Rank) == 1,
+                "Kokkos::Experimental::inclusive_scan requires rank-1 Views");
+  typedef typename OutViewType::execution_space execution_space;
+
+  if (out.extent(0) < in.extent(0))
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::inclusive_scan: output is smaller than input");
+
+  typename OutViewType::non_const_value_type total =
+      typename OutViewType::non_const_value_type();
+  Kokkos::parallel_scan(
+      Kokkos::RangePolicy<execution_space>(0, in.extent(0)),
+      Impl::StdInclusiveScan<InViewType, OutViewType>(in, out), total,
+      "Kokkos::inclusive_scan");
+  return total;
+}
+
+/// \brief Exclusive prefix sum of a rank-1 view; returns the total.
+///
+/// in and out may alias for an in-place scan.
+template <class InViewType, class OutViewType>
+typename OutViewType::non_const_value_type exclusive_scan(
+    const InViewType& in, const OutViewType& out) {
+  static_assert(unsigned(InViewType::Rank) == 1 &&
+                    unsigned(OutViewType::Rank) == 1,
+                "Kokkos::Experimental::exclusive_scan requires rank-1 Views");
+  typedef typename OutViewType::execution_space execution_space;
+
+  if (out.extent(0) < in.extent(0))
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::exclusive_scan: output is smaller than input");
+
+  typename OutViewType::non_const_value_type total =
+      typename OutViewType::non_const_value_type();
+  Kokkos::parallel_scan(
+      Kokkos::RangePolicy<execution_space>(0, in.extent(0)),
+      Impl::StdExclusiveScan<InViewType, OutViewType>(in, out), total,
+      "Kokkos::exclusive_scan");
+  return total;
+}
+
+/// \brief Batched lower_bound: for every queries(q) store into indices(q)
+/// the first position in the ascending-sorted view at which the query
+/// could be inserted without breaking the order.
+template <class SortedViewType, class QueryViewType, class IndexViewType>
+void lower_bound(const SortedViewType& sorted, const QueryViewType& queries,
+                 const IndexViewType& indices) {
+  static_assert(unsigned(SortedViewType::Rank) == 1 &&
+                    unsigned(QueryViewType::Rank) == 1 &&
+                    unsigned(IndexViewType::Rank) == 1,
+                "Kokkos::Experimental::lower_bound requires rank-1 Views");
+  typedef typename SortedViewType::execution_space execution_space;
+
+  if (indices.extent(0) < queries.extent(0))
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::lower_bound: index output is smaller than "
+        "the queries");
+
+  Kokkos::parallel_for(
+      "Kokkos::lower_bound",
+      Kokkos::RangePolicy<execution_space>(0, queries.extent(0)),
+      Impl::StdLowerBound<SortedViewType, QueryViewType, IndexViewType>(
+          sorted, queries, indices));
+}
+
+/// \brief Stable merge of two ascending-sorted rank-1 views; ties are
+/// taken from a first.  out must hold a.extent(0) + b.extent(0)
+/// elements and may not alias the inputs.
+template <class AViewType, class BViewType, class OutViewType>
+void merge(const AViewType& a, const BViewType& b, const OutViewType& out) {
+  static_assert(unsigned(AViewType::Rank) == 1 &&
+                    unsigned(BViewType::Rank) == 1 &&
+                    unsigned(OutViewType::Rank) == 1,
+                "Kokkos::Experimental::merge requires rank-1 Views");
+  typedef typename OutViewType::execution_space execution_space;
+
+  const int64_t n = int64_t(a.extent(0)) + int64_t(b.extent(0));
+  if (int64_t(out.extent(0)) < n)
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::merge: output is smaller than the inputs "
+        "combined");
+
+  Kokkos::parallel_for("Kokkos::merge",
+                       Kokkos::RangePolicy<execution_space>(0, n),
+                       Impl::StdMerge<AViewType, BViewType, OutViewType>(
+                           a, b, out));
+}
+
+/// \brief Compact runs of equal adjacent elements to their first
+/// occurrence; returns the number of elements written to out.
+///
+/// The run count is not known in advance, so out must be able to hold
+/// in.extent(0) elements.  in and out may not alias.
+template <class InViewType, class OutViewType>
+int64_t unique(const InViewType& in, const OutViewType& out) {
+  static_assert(unsigned(InViewType::Rank) == 1 &&
+                    unsigned(OutViewType::Rank) == 1,
+                "Kokkos::Experimental::unique requires rank-1 Views");
+  typedef typename InViewType::execution_space execution_space;
+
+  if (out.extent(0) < in.extent(0))
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::unique: output must be able to hold every "
+        "input element");
+
+  int64_t count = 0;
+  Kokkos::parallel_scan(Kokkos::RangePolicy<execution_space>(0, in.extent(0)),
+                        Impl::StdUnique<InViewType, OutViewType>(in, out),
+                        count, "Kokkos::unique");
+  return count;
+}
+
+/// \brief Sort keys in place and apply the same permutation to values.
+///
+/// Thin name for the stable radix path so callers porting from
+/// thrust::sort_by_key do not have to know the permutation machinery.
+template <class KeyViewType, class ValuesViewType>
+void sort_by_key(KeyViewType const& keys, ValuesViewType const& values) {
+  static_assert(unsigned(KeyViewType::Rank) == 1 &&
+                    unsigned(ValuesViewType::Rank) == 1,
+                "Kokkos::Experimental::sort_by_key requires rank-1 Views");
+
+  if (keys.extent(0) != values.extent(0))
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::sort_by_key: keys and values differ in "
+        "length");
+
+  Kokkos::Experimental::radix_sort(keys, values);
+}
+
+/// \brief Segmented reduction over sorted keys: for every run of equal
+/// adjacent keys write the key to out_keys and the sum of the
+/// corresponding values to out_values; returns the number of segments.
+///
+/// Fused into two dispatches: one scan numbers the segments and records
+/// their start offsets, one parallel_for sums each segment with a
+/// single owner, so the result is deterministic (no atomics).  The
+/// segment count is not known in advance, so out_keys and out_values
+/// must be able to hold keys.extent(0) elements.
+template <class KeyViewType, class ValueViewType, class OutKeyViewType,
+          class OutValueViewType>
+int64_t reduce_by_key(const KeyViewType& keys, const ValueViewType& values,
+                      const OutKeyViewType& out_keys,
+                      const OutValueViewType& out_values) {
+  static_assert(unsigned(KeyViewType::Rank) == 1 &&
+                    unsigned(ValueViewType::Rank) == 1 &&
+                    unsigned(OutKeyViewType::Rank) == 1 &&
+                    unsigned(OutValueViewType::Rank) == 1,
+                "Kokkos::Experimental::reduce_by_key requires rank-1 Views");
+  typedef typename ValueViewType::execution_space execution_space;
+  typedef Kokkos::View<int64_t*, typename ValueViewType::device_type>
+      start_view_type;
+
+  const int64_t n = keys.extent(0);
+  if (int64_t(values.extent(0)) != n)
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::reduce_by_key: keys and values differ in "
+        "length");
+  if (int64_t(out_keys.extent(0)) < n || int64_t(out_values.extent(0)) < n)
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::reduce_by_key: outputs must be able to hold "
+        "one segment per input element");
+  if (0 == n) return 0;
+
+  start_view_type starts(
+      Kokkos::ViewAllocateWithoutInitializing("Kokkos::reduce_by_key::starts"),
+      n + 1);
+
+  int64_t count = 0;
+  Kokkos::parallel_scan(
+      Kokkos::RangePolicy<execution_space>(0, n),
+      Impl::StdReduceByKeySegments<KeyViewType, OutKeyViewType,
+                                   start_view_type>(keys, out_keys, starts),
+      count, "Kokkos::reduce_by_key::segments");
+
+  Kokkos::deep_copy(Kokkos::subview(starts, count), n);
+
+  Kokkos::parallel_for(
+      "Kokkos::reduce_by_key::sums",
+      Kokkos::RangePolicy<execution_space>(0, count),
+      Impl::StdReduceByKeySums<ValueViewType, OutValueViewType,
+                               start_view_type>(values, out_values, starts));
+  return count;
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
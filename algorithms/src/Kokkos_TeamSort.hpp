@@ -0,0 +1,264 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_TeamSort.hpp
+/// \brief Team-level cooperative sort, array broadcast, and radix rank.
+///
+/// These are collectives over a TeamPolicy team: every thread of the
+/// team must call them, like team_barrier.  They operate on data the
+/// whole team can see (team scratch or global memory) and synchronize
+/// internally, replacing the hand-rolled bitonic networks and explicit
+/// barrier dances applications keep in scratch today.
+
+#ifndef KOKKOS_TEAMSORT_HPP_
+#define KOKKOS_TEAMSORT_HPP_
+
+#include <Kokkos_Core.hpp>
+
+namespace Kokkos {
+
+namespace Impl {
+
+template <class T>
+struct TeamSortLess {
+  KOKKOS_INLINE_FUNCTION
+  bool operator()(const T& a, const T& b) const { return a < b; }
+};
+
+}  // namespace Impl
+
+namespace Experimental {
+
+//----------------------------------------------------------------------------
+
+// \brief Collective in-place sort of a rank-1 view by a comparator.
+//
+// Bitonic network over the whole team; handles any length, not just
+// powers of two, by mirroring the first stage of each merge so that
+// every comparison is ascending and comparisons against the virtual
+// padding can simply be skipped.  values must be team-visible (team
+// scratch or global memory); the comparator orders by strict
+// weak ordering like std::sort.  O(n log^2 n) work, best when values
+// fits in scratch.
+template <class TeamMember, class ViewType, class Comparator>
+KOKKOS_INLINE_FUNCTION void team_sort(const TeamMember& team,
+                                      const ViewType& values,
+                                      const Comparator& comp) {
+  typedef typename ViewType::non_const_value_type value_type;
+
+  const int n = values.extent(0);
+  if (n < 2) {
+    team.team_barrier();
+    return;
+  }
+
+  int npot = 1;
+  while (npot < n) npot <<= 1;
+
+  for (int k = 2; k <= npot; k <<= 1) {
+    // Mirrored first stage: compare element l of a block with element
+    // k-1-l, which keeps every exchange ascending
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, npot >> 1),
+                         [&](const int i) {
+                           const int half  = k >> 1;
+                           const int block = i / half;
+                           const int l     = i % half;
+                           const int a     = block * k + l;
+                           const int b     = block * k + (k - 1 - l);
+                           if (b < n && comp(values(b), values(a))) {
+                             const value_type tmp = values(a);
+                             values(a)            = values(b);
+                             values(b)            = tmp;
+                           }
+                         });
+    team.team_barrier();
+
+    for (int j = k >> 2; j > 0; j >>= 1) {
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team, npot >> 1),
+                           [&](const int i) {
+                             const int a = (i / j) * (j << 1) + (i % j);
+                             const int b = a + j;
+                             if (b < n && comp(values(b), values(a))) {
+                               const value_type tmp = values(a);
+                               values(a)            = values(b);
+                               values(b)            = tmp;
+                             }
+                           });
+      team.team_barrier();
+    }
+  }
+}
+
+// \brief Collective ascending in-place sort of a rank-1 view.
+template <class TeamMember, class ViewType>
+KOKKOS_INLINE_FUNCTION void team_sort(const TeamMember& team,
+                                      const ViewType& values) {
+  team_sort(team, values,
+            Kokkos::Impl::TeamSortLess<
+                typename ViewType::non_const_value_type>());
+}
+
+// \brief Collective in-place sort of values by their keys.
+//
+// Same network as team_sort; keys and values move together.
+template <class TeamMember, class KeyViewType, class ValueViewType,
+          class Comparator>
+KOKKOS_INLINE_FUNCTION void team_sort_by_key(const TeamMember& team,
+                                             const KeyViewType& keys,
+                                             const ValueViewType& values,
+                                             const Comparator& comp) {
+  typedef typename KeyViewType::non_const_value_type key_type;
+  typedef typename ValueViewType::non_const_value_type value_type;
+
+  const int n = keys.extent(0);
+  if (n < 2) {
+    team.team_barrier();
+    return;
+  }
+
+  int npot = 1;
+  while (npot < n) npot <<= 1;
+
+  for (int k = 2; k <= npot; k <<= 1) {
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, npot >> 1),
+                         [&](const int i) {
+                           const int half  = k >> 1;
+                           const int block = i / half;
+                           const int l     = i % half;
+                           const int a     = block * k + l;
+                           const int b     = block * k + (k - 1 - l);
+                           if (b < n && comp(keys(b), keys(a))) {
+                             const key_type kt = keys(a);
+                             keys(a)           = keys(b);
+                             keys(b)           = kt;
+                             const value_type vt = values(a);
+                             values(a)           = values(b);
+                             values(b)           = vt;
+                           }
+                         });
+    team.team_barrier();
+
+    for (int j = k >> 2; j > 0; j >>= 1) {
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team, npot >> 1),
+                           [&](const int i) {
+                             const int a = (i / j) * (j << 1) + (i % j);
+                             const int b = a + j;
+                             if (b < n && comp(keys(b), keys(a))) {
+                               const key_type kt = keys(a);
+                               keys(a)           = keys(b);
+                               keys(b)           = kt;
+                               const value_type vt = values(a);
+                               values(a)           = values(b);
+                               values(b)           = vt;
+                             }
+                           });
+      team.team_barrier();
+    }
+  }
+}
+
+// \brief Collective ascending sort of values by their keys.
+template <class TeamMember, class KeyViewType, class ValueViewType>
+KOKKOS_INLINE_FUNCTION void team_sort_by_key(const TeamMember& team,
+                                             const KeyViewType& keys,
+                                             const ValueViewType& values) {
+  team_sort_by_key(team, keys, values,
+                   Kokkos::Impl::TeamSortLess<
+                       typename KeyViewType::non_const_value_type>());
+}
+
+//----------------------------------------------------------------------------
+
+// \brief Collective broadcast of an array from one thread to the team.
+//
+// The root thread's n-element contribution is copied into the
+// team-visible buffer (team scratch or global memory); after the call
+// every thread of the team may read buffer[0..n).  The member-function
+// team_broadcast handles single values only, so array broadcasts end
+// up hand-rolled with explicit barriers; this is that pattern with the
+// synchronization done right.
+template <class TeamMember, class T>
+KOKKOS_INLINE_FUNCTION void team_broadcast_array(const TeamMember& team,
+                                                 T* const buffer,
+                                                 const T* const contribution,
+                                                 const int n,
+                                                 const int root = 0) {
+  if (team.team_rank() == root) {
+    for (int i = 0; i < n; ++i) buffer[i] = contribution[i];
+  }
+  team.team_barrier();
+}
+
+//----------------------------------------------------------------------------
+
+// \brief Collective stable rank of each thread's radix digit.
+//
+// Every thread contributes one digit in [0, ndigits); the return value
+// is the position the thread's entry takes in a stable sort of the
+// team by digit (all 0-digits first in thread order, then all
+// 1-digits, ...).  One team_scan per digit value, so keep the radix
+// narrow - 4 bits (ndigits = 16) per pass is the usual sweet spot.
+// The scatter "my entry goes to slot rank" is exactly one pass of an
+// LSD radix sort of the team's values.
+template <class TeamMember>
+KOKKOS_INLINE_FUNCTION int team_radix_rank(const TeamMember& team,
+                                           const unsigned digit,
+                                           const unsigned ndigits) {
+  int rank = 0;
+  int base = 0;
+  for (unsigned d = 0; d < ndigits; ++d) {
+    const int flag = (digit == d) ? 1 : 0;
+    const int pos  = team.team_scan(flag);
+    int total      = pos + flag;
+    team.team_broadcast(total, team.team_size() - 1);
+    if (flag) rank = base + pos;
+    base += total;
+  }
+  return rank;
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_TEAMSORT_HPP_ */
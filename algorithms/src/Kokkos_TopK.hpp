@@ -0,0 +1,319 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_TopK.hpp
+/// \brief Selection of the k largest entries without a full sort.
+///
+/// Selecting the top k of n entries (the highest-error elements in a
+/// mesh-adaptation step) via sort costs O(n log n) and touches every
+/// entry many times.  top_k() instead refines a value threshold with a
+/// few histogram passes over the data until only about k entries lie
+/// above it, gathers those candidates, and sorts just the candidates -
+/// a handful of streaming passes over n plus O(k log k) work, which for
+/// k much smaller than n is bandwidth-bound rather than sort-bound.
+
+#ifndef KOKKOS_TOP_K_HPP_
+#define KOKKOS_TOP_K_HPP_
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Histogram.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace Kokkos {
+
+namespace Impl {
+
+// Bin key over the refinement window [lo, hi]: entries outside the
+// window return -1 and are skipped by histogram().  Binning arithmetic
+// is in double so one implementation serves integral and floating
+// point entry types.
+template <class SrcView>
+struct TopKBinKey {
+  SrcView m_src;
+  double m_lo;
+  double m_hi;
+  double m_scale;  // bins / (hi - lo)
+  int64_t m_bins;
+
+  KOKKOS_INLINE_FUNCTION
+  int64_t operator()(const int64_t i) const {
+    const double x = static_cast<double>(m_src(i));
+    if (x < m_lo || x > m_hi) return -1;
+    const int64_t b = static_cast<int64_t>((x - m_lo) * m_scale);
+    return b < m_bins ? b : m_bins - 1;
+  }
+};
+
+template <class SrcView>
+struct TopKMinMax {
+  SrcView m_src;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(
+      const int64_t i,
+      Kokkos::MinMaxScalar<typename SrcView::non_const_value_type>& m) const {
+    if (m_src(i) < m.min_val) m.min_val = m_src(i);
+    if (m_src(i) > m.max_val) m.max_val = m_src(i);
+  }
+};
+
+template <class SrcView>
+struct TopKCountAbove {
+  SrcView m_src;
+  double m_threshold;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t i, int64_t& count) const {
+    if (static_cast<double>(m_src(i)) >= m_threshold) ++count;
+  }
+};
+
+template <class SrcView, class CandValView, class CandIdxView>
+struct TopKGather {
+  SrcView m_src;
+  CandValView m_values;
+  CandIdxView m_indices;
+  Kokkos::View<int64_t, typename SrcView::memory_space> m_ticket;
+  double m_threshold;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t i) const {
+    if (static_cast<double>(m_src(i)) >= m_threshold) {
+      const int64_t t = Kokkos::atomic_fetch_add(&m_ticket(), int64_t(1));
+      m_values(t)     = m_src(i);
+      m_indices(t)    = i;
+    }
+  }
+};
+
+}  // namespace Impl
+
+namespace Experimental {
+
+/// \brief Select the k largest entries of a rank-1 view.
+///
+/// On return values(0..k-1) holds the k largest entries in descending
+/// order and indices(0..k-1) their positions in src; ties are broken
+/// toward the lower index.  The entry type must be arithmetic.  The
+/// data is not modified and no O(n) temporary is allocated: scratch is
+/// the histogram bins plus the candidate set, which is close to k
+/// except under heavy ties at the selection threshold.
+template <class... SP, class... VP, class... IP>
+void top_k(const Kokkos::View<SP...>& src, const int64_t k,
+           const Kokkos::View<VP...>& values,
+           const Kokkos::View<IP...>& indices) {
+  typedef Kokkos::View<SP...> src_type;
+  typedef typename src_type::non_const_value_type value_type;
+  typedef typename src_type::execution_space execution_space;
+  typedef typename execution_space::memory_space scratch_space;
+  typedef Kokkos::RangePolicy<execution_space, Kokkos::IndexType<int64_t>>
+      policy_type;
+
+  static_assert(unsigned(src_type::rank) == 1,
+                "Kokkos::Experimental::top_k: src must be rank-1");
+  static_assert(std::is_arithmetic<value_type>::value,
+                "Kokkos::Experimental::top_k: entry type must be arithmetic");
+  static_assert(unsigned(Kokkos::View<VP...>::rank) == 1 &&
+                    unsigned(Kokkos::View<IP...>::rank) == 1,
+                "Kokkos::Experimental::top_k: results must be rank-1");
+
+  const int64_t n = int64_t(src.extent(0));
+
+  if (k < 0 || n < k) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::top_k requested more entries than the view holds");
+  }
+  if (int64_t(values.extent(0)) < k || int64_t(indices.extent(0)) < k) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::top_k result views are smaller than k");
+  }
+  if (0 == k) return;
+
+  // Value range of the data
+  Kokkos::MinMaxScalar<value_type> minmax;
+  {
+    Kokkos::Impl::TopKMinMax<src_type> f = {src};
+    Kokkos::parallel_reduce("Kokkos::top_k::minmax", policy_type(0, n), f,
+                            Kokkos::MinMax<value_type>(minmax));
+  }
+
+  // All entries equal: any k positions are the top k.
+  if (!(minmax.min_val < minmax.max_val)) {
+    typename Kokkos::View<VP...>::HostMirror out_values =
+        Kokkos::create_mirror_view(values);
+    typename Kokkos::View<IP...>::HostMirror out_indices =
+        Kokkos::create_mirror_view(indices);
+    for (int64_t i = 0; i < k; ++i) {
+      out_values(i)  = minmax.min_val;
+      out_indices(i) = i;
+    }
+    Kokkos::deep_copy(values, out_values);
+    Kokkos::deep_copy(indices, out_indices);
+    return;
+  }
+
+  double lo = static_cast<double>(minmax.min_val);
+  double hi = static_cast<double>(minmax.max_val);
+
+  // Threshold refinement: histogram the current window, walk the bins
+  // from the top until k entries are covered, and descend into the
+  // boundary bin.  Each pass shrinks the boundary-bin population by
+  // about the bin count, so a few passes suffice; stop as soon as the
+  // candidate surplus is small or the window cannot shrink further.
+  const int64_t bins = 1024;
+  typedef Kokkos::View<int64_t*, scratch_space> count_view;
+  count_view counts(
+      Kokkos::ViewAllocateWithoutInitializing("Kokkos::top_k::bins"), bins);
+  typename count_view::HostMirror host_counts =
+      Kokkos::create_mirror_view(counts);
+
+  int64_t remaining = k;  // entries still to cover inside [lo, hi]
+
+  for (int pass = 0; pass < 12 && lo < hi; ++pass) {
+    Kokkos::deep_copy(counts, int64_t(0));
+    Kokkos::Impl::TopKBinKey<src_type> key = {src, lo, hi,
+                                              double(bins) / (hi - lo), bins};
+    Kokkos::Experimental::histogram("Kokkos::top_k::histogram",
+                                    policy_type(0, n), key, bins, counts);
+    Kokkos::deep_copy(host_counts, counts);
+
+    int64_t acc = 0;
+    int64_t b   = bins - 1;
+    for (; 0 < b; --b) {
+      if (remaining <= acc + host_counts(b)) break;
+      acc += host_counts(b);
+    }
+    remaining -= acc;
+
+    const double width = (hi - lo) / double(bins);
+    const double b_lo  = lo + double(b) * width;
+    const double b_hi  = b + 1 < bins ? lo + double(b + 1) * width : hi;
+
+    if (!(b_lo < b_hi) || (b_lo <= lo && hi <= b_hi)) break;
+    lo = b_lo;
+    hi = b_hi;
+
+    // Surplus candidates the boundary bin would add beyond k
+    if (host_counts(b) - remaining <= (k < 64 ? int64_t(64) : k)) break;
+  }
+
+  // Gather every entry at or above the threshold.  The refinement
+  // invariant guarantees at least k such entries; ties at the
+  // threshold can push the count higher.
+  const double threshold = lo;
+  int64_t num_candidates = 0;
+  {
+    Kokkos::Impl::TopKCountAbove<src_type> counter = {src, threshold};
+    Kokkos::parallel_reduce("Kokkos::top_k::count", policy_type(0, n), counter,
+                            num_candidates);
+  }
+
+  typedef Kokkos::View<value_type*, scratch_space> cand_val_view;
+  typedef Kokkos::View<int64_t*, scratch_space> cand_idx_view;
+  cand_val_view cand_values(
+      Kokkos::ViewAllocateWithoutInitializing("Kokkos::top_k::cand_values"),
+      num_candidates);
+  cand_idx_view cand_indices(
+      Kokkos::ViewAllocateWithoutInitializing("Kokkos::top_k::cand_indices"),
+      num_candidates);
+  Kokkos::View<int64_t, scratch_space> ticket("Kokkos::top_k::ticket");
+
+  {
+    Kokkos::Impl::TopKGather<src_type, cand_val_view, cand_idx_view> gather = {
+        src, cand_values, cand_indices, ticket, threshold};
+    Kokkos::parallel_for("Kokkos::top_k::gather", policy_type(0, n), gather);
+    execution_space().fence();
+  }
+
+  // Rank the candidates on the host: the candidate set is on the order
+  // of k entries, so this is the O(k log k) tail of the selection.
+  typename cand_val_view::HostMirror host_values =
+      Kokkos::create_mirror_view(cand_values);
+  typename cand_idx_view::HostMirror host_indices =
+      Kokkos::create_mirror_view(cand_indices);
+  Kokkos::deep_copy(host_values, cand_values);
+  Kokkos::deep_copy(host_indices, cand_indices);
+
+  std::vector<std::pair<value_type, int64_t>> ranked(num_candidates);
+  for (int64_t i = 0; i < num_candidates; ++i) {
+    ranked[i] = std::make_pair(host_values(i), host_indices(i));
+  }
+  std::sort(ranked.begin(), ranked.end(),
+            [](const std::pair<value_type, int64_t>& a,
+               const std::pair<value_type, int64_t>& b) {
+              return a.first != b.first ? b.first < a.first
+                                        : a.second < b.second;
+            });
+
+  typename Kokkos::View<VP...>::HostMirror out_values =
+      Kokkos::create_mirror_view(values);
+  typename Kokkos::View<IP...>::HostMirror out_indices =
+      Kokkos::create_mirror_view(indices);
+  for (int64_t i = 0; i < k; ++i) {
+    out_values(i)  = ranked[i].first;
+    out_indices(i) = ranked[i].second;
+  }
+  Kokkos::deep_copy(values, out_values);
+  Kokkos::deep_copy(indices, out_indices);
+}
+
+/// \brief Value-only form: indices of the selected entries are
+///        computed internally and discarded.
+template <class... SP, class... VP>
+void top_k(const Kokkos::View<SP...>& src, const int64_t k,
+           const Kokkos::View<VP...>& values) {
+  typedef typename Kokkos::View<SP...>::execution_space execution_space;
+  Kokkos::View<int64_t*, typename execution_space::memory_space> indices(
+      Kokkos::ViewAllocateWithoutInitializing("Kokkos::top_k::indices"),
+      k < 0 ? 0 : k);
+  top_k(src, k, values, indices);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_TOP_K_HPP_ */
@@ -0,0 +1,207 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+#ifndef KOKKOS_TRANSFORM_REDUCE_HPP_
+#define KOKKOS_TRANSFORM_REDUCE_HPP_
+
+#include <Kokkos_Core.hpp>
+
+#include <cmath>
+
+namespace Kokkos {
+
+namespace Impl {
+
+// Contiguous fast paths: reading through restrict-qualified raw pointers
+// with a unit-stride induction variable lets the compiler emit packed FMA,
+// which the generic View-indexing path does not always achieve.
+template <class Scalar>
+struct DotRawFunctor {
+  typedef Scalar value_type;
+
+  const Scalar* KOKKOS_RESTRICT m_x;
+  const Scalar* KOKKOS_RESTRICT m_y;
+
+  DotRawFunctor(const Scalar* x_, const Scalar* y_) : m_x(x_), m_y(y_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t& i, value_type& sum) const {
+    sum += m_x[i] * m_y[i];
+  }
+};
+
+template <class XViewType, class YViewType>
+struct DotViewFunctor {
+  typedef typename XViewType::non_const_value_type value_type;
+
+  typename XViewType::const_type m_x;
+  typename YViewType::const_type m_y;
+
+  DotViewFunctor(const XViewType& x_, const YViewType& y_)
+      : m_x(x_), m_y(y_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t& i, value_type& sum) const {
+    sum += m_x(i) * m_y(i);
+  }
+};
+
+template <class Scalar>
+struct Nrm2RawFunctor {
+  typedef Scalar value_type;
+
+  const Scalar* KOKKOS_RESTRICT m_x;
+
+  Nrm2RawFunctor(const Scalar* x_) : m_x(x_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t& i, value_type& sum) const {
+    sum += m_x[i] * m_x[i];
+  }
+};
+
+template <class XViewType>
+struct Nrm2ViewFunctor {
+  typedef typename XViewType::non_const_value_type value_type;
+
+  typename XViewType::const_type m_x;
+
+  Nrm2ViewFunctor(const XViewType& x_) : m_x(x_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t& i, value_type& sum) const {
+    sum += m_x(i) * m_x(i);
+  }
+};
+
+template <class Transform, class Reducer>
+struct TransformReduceFunctor {
+  typedef typename Reducer::value_type value_type;
+
+  Transform m_transform;
+  Reducer m_reducer;
+
+  TransformReduceFunctor(const Transform& transform_, const Reducer& reducer_)
+      : m_transform(transform_), m_reducer(reducer_) {}
+
+  template <class Index>
+  KOKKOS_INLINE_FUNCTION void operator()(const Index& i,
+                                         value_type& update) const {
+    const value_type tmp = m_transform(i);
+    m_reducer.join(update, tmp);
+  }
+};
+
+}  // namespace Impl
+
+//----------------------------------------------------------------------------
+
+/// \brief Dot product of two rank-1 views, sum_i x(i) * y(i).
+template <class XViewType, class YViewType>
+typename XViewType::non_const_value_type dot(const XViewType& x,
+                                             const YViewType& y) {
+  static_assert(unsigned(XViewType::Rank) == 1 &&
+                    unsigned(YViewType::Rank) == 1,
+                "Kokkos::dot requires rank-1 Views");
+  typedef typename XViewType::execution_space execution_space;
+  typedef typename XViewType::non_const_value_type value_type;
+
+  const int64_t n  = x.extent(0);
+  value_type result = value_type();
+  if (x.span_is_contiguous() && y.span_is_contiguous()) {
+    Kokkos::parallel_reduce("Kokkos::dot",
+                            Kokkos::RangePolicy<execution_space>(0, n),
+                            Impl::DotRawFunctor<value_type>(x.data(), y.data()),
+                            result);
+  } else {
+    Kokkos::parallel_reduce("Kokkos::dot",
+                            Kokkos::RangePolicy<execution_space>(0, n),
+                            Impl::DotViewFunctor<XViewType, YViewType>(x, y),
+                            result);
+  }
+  return result;
+}
+
+/// \brief Euclidean norm of a rank-1 view of floating point values.
+template <class XViewType>
+typename XViewType::non_const_value_type nrm2(const XViewType& x) {
+  static_assert(unsigned(XViewType::Rank) == 1,
+                "Kokkos::nrm2 requires a rank-1 View");
+  typedef typename XViewType::execution_space execution_space;
+  typedef typename XViewType::non_const_value_type value_type;
+
+  const int64_t n  = x.extent(0);
+  value_type result = value_type();
+  if (x.span_is_contiguous()) {
+    Kokkos::parallel_reduce("Kokkos::nrm2",
+                            Kokkos::RangePolicy<execution_space>(0, n),
+                            Impl::Nrm2RawFunctor<value_type>(x.data()), result);
+  } else {
+    Kokkos::parallel_reduce("Kokkos::nrm2",
+                            Kokkos::RangePolicy<execution_space>(0, n),
+                            Impl::Nrm2ViewFunctor<XViewType>(x), result);
+  }
+  return std::sqrt(result);
+}
+
+/// \brief Reduce transform(i) over the policy's range with the given reducer.
+///
+/// transform maps a work index to a value of the reducer's value_type; the
+/// reducer supplies init and join, so no user reduction functor boilerplate
+/// is needed:
+///   transform_reduce(policy, transform, Kokkos::Max<double>(result));
+template <class PolicyType, class Transform, class Reducer>
+typename std::enable_if<Kokkos::is_reducer_type<Reducer>::value>::type
+transform_reduce(const PolicyType& policy, const Transform& transform,
+                 const Reducer& reducer) {
+  Kokkos::parallel_reduce(
+      "Kokkos::transform_reduce", policy,
+      Impl::TransformReduceFunctor<Transform, Reducer>(transform, reducer),
+      reducer);
+}
+
+}  // namespace Kokkos
+
+#endif
@@ -54,7 +54,11 @@
 #include <Kokkos_Core.hpp>
 
 #include <TestRandom.hpp>
+#include <TestPhilox.hpp>
 #include <TestSort.hpp>
+#include <TestRadixSort.hpp>
+#include <TestReduceByKey.hpp>
+#include <TestTopK.hpp>
 
 namespace Test {
 
@@ -72,16 +76,44 @@ void cuda_test_random_xorshift1024(int num_draws) {
 #define CUDA_RANDOM_XORSHIFT1024(num_draws) \
   TEST(cuda, Random_XorShift1024) { cuda_test_random_xorshift1024(num_draws); }
 
+#define CUDA_PHILOX4X32(num_streams)              \
+  TEST(cuda, Random_Philox4x32) {                 \
+    Impl::test_philox<Kokkos::Cuda>(num_streams); \
+  }
+
 #define CUDA_SORT_UNSIGNED(size) \
   TEST(cuda, SortUnsigned) { Impl::test_sort<Kokkos::Cuda, unsigned>(size); }
 
+#define CUDA_RADIXSORT_UNSIGNED(size)                    \
+  TEST(cuda, RadixSortUnsigned) {                        \
+    Impl::test_radix_sort<Kokkos::Cuda, unsigned>(size); \
+  }
+
+#define CUDA_REDUCEBYKEY(size)                    \
+  TEST(cuda, ReduceByKey) {                       \
+    Impl::test_reduce_by_key<Kokkos::Cuda>(size); \
+  }
+
+#define CUDA_TOPK(size)                   \
+  TEST(cuda, TopK) {                      \
+    Impl::test_top_k<Kokkos::Cuda>(size); \
+  }
+
 CUDA_RANDOM_XORSHIFT64(132141141)
 CUDA_RANDOM_XORSHIFT1024(52428813)
+CUDA_PHILOX4X32(4096)
 CUDA_SORT_UNSIGNED(171)
+CUDA_RADIXSORT_UNSIGNED(171)
+CUDA_REDUCEBYKEY(10007)
+CUDA_TOPK(100000)
 
 #undef CUDA_RANDOM_XORSHIFT64
 #undef CUDA_RANDOM_XORSHIFT1024
+#undef CUDA_PHILOX4X32
 #undef CUDA_SORT_UNSIGNED
+#undef CUDA_RADIXSORT_UNSIGNED
+#undef CUDA_REDUCEBYKEY
+#undef CUDA_TOPK
 }  // namespace Test
 #else
 void KOKKOS_ALGORITHMS_UNITTESTS_TESTCUDA_PREVENT_LINK_ERROR() {}
@@ -50,7 +50,11 @@
 
 //----------------------------------------------------------------------------
 #include <TestRandom.hpp>
+#include <TestPhilox.hpp>
 #include <TestSort.hpp>
+#include <TestRadixSort.hpp>
+#include <TestReduceByKey.hpp>
+#include <TestTopK.hpp>
 #include <iomanip>
 
 namespace Test {
@@ -69,18 +73,46 @@ namespace Test {
         num_draws);                                                    \
   }
 
+#define HPX_PHILOX4X32(num_streams)                            \
+  TEST(hpx, Random_Philox4x32) {                               \
+    Impl::test_philox<Kokkos::Experimental::HPX>(num_streams); \
+  }
+
 #define HPX_SORT_UNSIGNED(size)                                 \
   TEST(hpx, SortUnsigned) {                                     \
     Impl::test_sort<Kokkos::Experimental::HPX, unsigned>(size); \
   }
 
+#define HPX_RADIXSORT_UNSIGNED(size)                                  \
+  TEST(hpx, RadixSortUnsigned) {                                      \
+    Impl::test_radix_sort<Kokkos::Experimental::HPX, unsigned>(size); \
+  }
+
+#define HPX_REDUCEBYKEY(size)                                  \
+  TEST(hpx, ReduceByKey) {                                     \
+    Impl::test_reduce_by_key<Kokkos::Experimental::HPX>(size); \
+  }
+
+#define HPX_TOPK(size)                                 \
+  TEST(hpx, TopK) {                                    \
+    Impl::test_top_k<Kokkos::Experimental::HPX>(size); \
+  }
+
 HPX_RANDOM_XORSHIFT64(10240000)
 HPX_RANDOM_XORSHIFT1024(10130144)
+HPX_PHILOX4X32(4096)
 HPX_SORT_UNSIGNED(171)
+HPX_RADIXSORT_UNSIGNED(171)
+HPX_REDUCEBYKEY(10007)
+HPX_TOPK(100000)
 
 #undef HPX_RANDOM_XORSHIFT64
 #undef HPX_RANDOM_XORSHIFT1024
+#undef HPX_PHILOX4X32
 #undef HPX_SORT_UNSIGNED
+#undef HPX_RADIXSORT_UNSIGNED
+#undef HPX_REDUCEBYKEY
+#undef HPX_TOPK
 }  // namespace Test
 #else
 void KOKKOS_ALGORITHMS_UNITTESTS_TESTHPX_PREVENT_LINK_ERROR() {}
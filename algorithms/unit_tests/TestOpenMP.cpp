@@ -50,7 +50,11 @@
 
 //----------------------------------------------------------------------------
 #include <TestRandom.hpp>
+#include <TestPhilox.hpp>
 #include <TestSort.hpp>
+#include <TestRadixSort.hpp>
+#include <TestReduceByKey.hpp>
+#include <TestTopK.hpp>
 #include <iomanip>
 
 namespace Test {
@@ -67,18 +71,46 @@ namespace Test {
         num_draws);                                                       \
   }
 
+#define OPENMP_PHILOX4X32(num_streams)                 \
+  TEST(openmp, Random_Philox4x32) {                    \
+    Impl::test_philox<Kokkos::OpenMP>(num_streams);    \
+  }
+
 #define OPENMP_SORT_UNSIGNED(size)                   \
   TEST(openmp, SortUnsigned) {                       \
     Impl::test_sort<Kokkos::OpenMP, unsigned>(size); \
   }
 
+#define OPENMP_RADIXSORT_UNSIGNED(size)                    \
+  TEST(openmp, RadixSortUnsigned) {                        \
+    Impl::test_radix_sort<Kokkos::OpenMP, unsigned>(size); \
+  }
+
+#define OPENMP_REDUCEBYKEY(size)                    \
+  TEST(openmp, ReduceByKey) {                       \
+    Impl::test_reduce_by_key<Kokkos::OpenMP>(size); \
+  }
+
+#define OPENMP_TOPK(size)                   \
+  TEST(openmp, TopK) {                      \
+    Impl::test_top_k<Kokkos::OpenMP>(size); \
+  }
+
 OPENMP_RANDOM_XORSHIFT64(10240000)
 OPENMP_RANDOM_XORSHIFT1024(10130144)
+OPENMP_PHILOX4X32(4096)
 OPENMP_SORT_UNSIGNED(171)
+OPENMP_RADIXSORT_UNSIGNED(171)
+OPENMP_REDUCEBYKEY(10007)
+OPENMP_TOPK(100000)
 
 #undef OPENMP_RANDOM_XORSHIFT64
 #undef OPENMP_RANDOM_XORSHIFT1024
+#undef OPENMP_PHILOX4X32
 #undef OPENMP_SORT_UNSIGNED
+#undef OPENMP_RADIXSORT_UNSIGNED
+#undef OPENMP_REDUCEBYKEY
+#undef OPENMP_TOPK
 }  // namespace Test
 #else
 void KOKKOS_ALGORITHMS_UNITTESTS_TESTOPENMP_PREVENT_LINK_ERROR() {}
@@ -0,0 +1,261 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef KOKKOS_ALGORITHMS_UNITTESTS_TESTPHILOX_HPP
+#define KOKKOS_ALGORITHMS_UNITTESTS_TESTPHILOX_HPP
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+namespace Test {
+
+namespace Impl {
+
+// Every stream draws its words from a generator constructed inside the
+// loop body from (seed, counter, i) -- the usage the counter-based
+// generator exists for.
+template <class ExecutionSpace>
+struct philox_stream_fill {
+  typedef ExecutionSpace execution_space;
+  typedef Kokkos::Random_Philox4x32<ExecutionSpace> generator_type;
+
+  Kokkos::View<uint32_t**, ExecutionSpace> words;
+  uint64_t seed;
+  uint64_t counter;
+
+  philox_stream_fill(Kokkos::View<uint32_t**, ExecutionSpace> words_,
+                     uint64_t seed_, uint64_t counter_)
+      : words(words_), seed(seed_), counter(counter_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(int i) const {
+    generator_type gen(seed, counter, i);
+    for (unsigned k = 0; k < words.extent(1); ++k) words(i, k) = gen.urand();
+  }
+};
+
+struct PhiloxMoments {
+  double sum;
+  double sum_sq;
+
+  KOKKOS_INLINE_FUNCTION
+  PhiloxMoments() : sum(0.0), sum_sq(0.0) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator+=(const PhiloxMoments& rhs) {
+    sum += rhs.sum;
+    sum_sq += rhs.sum_sq;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator+=(const volatile PhiloxMoments& rhs) volatile {
+    sum += rhs.sum;
+    sum_sq += rhs.sum_sq;
+  }
+};
+
+template <class ExecutionSpace>
+struct philox_moments_functor {
+  typedef ExecutionSpace execution_space;
+  typedef PhiloxMoments value_type;
+  typedef Kokkos::Random_Philox4x32<ExecutionSpace> generator_type;
+
+  uint64_t seed;
+  int draws_per_stream;
+
+  philox_moments_functor(uint64_t seed_, int draws_per_stream_)
+      : seed(seed_), draws_per_stream(draws_per_stream_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(int i, value_type& moments) const {
+    generator_type gen(seed, 0, i);
+    for (int k = 0; k < draws_per_stream; ++k) {
+      const double x = gen.drand();
+      moments.sum += x;
+      moments.sum_sq += x * x;
+    }
+  }
+};
+
+/// The generator is the Philox4x32-10 bijection, so it must reproduce
+/// the published known-answer vectors: all-zero and all-ones inputs and
+/// the pi-digits (counter, key) pair.
+template <class ExecutionSpace>
+void test_philox_known_answers() {
+  typedef Kokkos::Random_Philox4x32<ExecutionSpace> generator_type;
+
+  // draw() is the one-shot host/device entry point for the same
+  // bijection; the all-zero vector is checkable without a dispatch.
+  ASSERT_EQ(uint64_t(0x6627e8d5e169c58dULL), generator_type::draw(0, 0));
+
+  // First block of the (seed 0, counter 0, stream 0) sequence equals
+  // the all-zero known-answer vector.
+  Kokkos::View<uint32_t**, ExecutionSpace> words("PhiloxWords", 1, 4);
+  Kokkos::parallel_for(Kokkos::RangePolicy<ExecutionSpace>(0, 1),
+                       philox_stream_fill<ExecutionSpace>(words, 0, 0));
+
+  auto h_words = Kokkos::create_mirror_view(words);
+  Kokkos::deep_copy(h_words, words);
+
+  ASSERT_EQ(uint32_t(0x6627e8d5), h_words(0, 0));
+  ASSERT_EQ(uint32_t(0xe169c58d), h_words(0, 1));
+  ASSERT_EQ(uint32_t(0xbc57ac4c), h_words(0, 2));
+  ASSERT_EQ(uint32_t(0x9b00dbd8), h_words(0, 3));
+}
+
+/// Two dispatches with the same (seed, counter) triple must produce
+/// bit-identical streams; distinct stream indices, counters or seeds
+/// must produce distinct streams.
+template <class ExecutionSpace>
+void test_philox_determinism(const int num_streams, const int num_words) {
+  typedef Kokkos::View<uint32_t**, ExecutionSpace> WordView;
+
+  WordView a("PhiloxA", num_streams, num_words);
+  WordView b("PhiloxB", num_streams, num_words);
+  WordView c("PhiloxC", num_streams, num_words);
+  WordView d("PhiloxD", num_streams, num_words);
+
+  Kokkos::parallel_for(Kokkos::RangePolicy<ExecutionSpace>(0, num_streams),
+                       philox_stream_fill<ExecutionSpace>(a, 1931, 7));
+  Kokkos::parallel_for(Kokkos::RangePolicy<ExecutionSpace>(0, num_streams),
+                       philox_stream_fill<ExecutionSpace>(b, 1931, 7));
+  Kokkos::parallel_for(Kokkos::RangePolicy<ExecutionSpace>(0, num_streams),
+                       philox_stream_fill<ExecutionSpace>(c, 1931, 8));
+  Kokkos::parallel_for(Kokkos::RangePolicy<ExecutionSpace>(0, num_streams),
+                       philox_stream_fill<ExecutionSpace>(d, 1932, 7));
+
+  auto h_a = Kokkos::create_mirror_view(a);
+  auto h_b = Kokkos::create_mirror_view(b);
+  auto h_c = Kokkos::create_mirror_view(c);
+  auto h_d = Kokkos::create_mirror_view(d);
+  Kokkos::deep_copy(h_a, a);
+  Kokkos::deep_copy(h_b, b);
+  Kokkos::deep_copy(h_c, c);
+  Kokkos::deep_copy(h_d, d);
+
+  int replay_fails   = 0;
+  int counter_equals = 0;
+  int seed_equals    = 0;
+  int stream_equals  = 0;
+  for (int i = 0; i < num_streams; ++i) {
+    int eq_counter = 1;
+    int eq_seed    = 1;
+    int eq_stream  = 1;
+    for (int k = 0; k < num_words; ++k) {
+      if (h_a(i, k) != h_b(i, k)) replay_fails++;
+      if (h_a(i, k) != h_c(i, k)) eq_counter = 0;
+      if (h_a(i, k) != h_d(i, k)) eq_seed = 0;
+      if (i + 1 < num_streams && h_a(i, k) != h_a(i + 1, k)) eq_stream = 0;
+    }
+    counter_equals += eq_counter;
+    seed_equals += eq_seed;
+    if (i + 1 < num_streams) stream_equals += eq_stream;
+  }
+
+  ASSERT_EQ(replay_fails, 0);
+  ASSERT_EQ(counter_equals, 0);
+  ASSERT_EQ(seed_equals, 0);
+  ASSERT_EQ(stream_equals, 0);
+}
+
+/// The pool hands out the same streams until next_epoch() advances it.
+template <class ExecutionSpace>
+void test_philox_pool_epoch(const int num_streams, const int num_words) {
+  typedef Kokkos::View<uint32_t**, ExecutionSpace> WordView;
+
+  Kokkos::Random_Philox4x32_Pool<ExecutionSpace> pool(1931);
+
+  WordView a("PhiloxA", num_streams, num_words);
+  WordView b("PhiloxB", num_streams, num_words);
+
+  // get_state(i) is (seed, epoch, i); epoch 0 matches direct
+  // construction with counter 0.
+  Kokkos::parallel_for(Kokkos::RangePolicy<ExecutionSpace>(0, num_streams),
+                       philox_stream_fill<ExecutionSpace>(a, 1931, 0));
+  pool.next_epoch();
+  Kokkos::parallel_for(Kokkos::RangePolicy<ExecutionSpace>(0, num_streams),
+                       philox_stream_fill<ExecutionSpace>(b, 1931, 1));
+
+  auto h_a = Kokkos::create_mirror_view(a);
+  auto h_b = Kokkos::create_mirror_view(b);
+  Kokkos::deep_copy(h_a, a);
+  Kokkos::deep_copy(h_b, b);
+
+  int epoch_equals = 0;
+  for (int i = 0; i < num_streams; ++i) {
+    int eq = 1;
+    for (int k = 0; k < num_words; ++k)
+      if (h_a(i, k) != h_b(i, k)) eq = 0;
+    epoch_equals += eq;
+  }
+  ASSERT_EQ(epoch_equals, 0);
+}
+
+/// Sample mean and variance of drand() across per-iteration streams
+/// must match the uniform distribution on [0,1).
+template <class ExecutionSpace>
+void test_philox_moments(const int num_streams, const int draws_per_stream) {
+  PhiloxMoments moments;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<ExecutionSpace>(0, num_streams),
+      philox_moments_functor<ExecutionSpace>(1931, draws_per_stream), moments);
+
+  const double n        = 1.0 * num_streams * draws_per_stream;
+  const double mean     = moments.sum / n;
+  const double variance = moments.sum_sq / n - mean * mean;
+
+  ASSERT_NEAR(mean, 0.5, 0.002);
+  ASSERT_NEAR(variance, 1.0 / 12.0, 0.002);
+}
+
+template <class ExecutionSpace>
+void test_philox(const int num_streams) {
+  test_philox_known_answers<ExecutionSpace>();
+  test_philox_determinism<ExecutionSpace>(num_streams, 32);
+  test_philox_pool_epoch<ExecutionSpace>(num_streams, 32);
+  test_philox_moments<ExecutionSpace>(num_streams, 1024);
+}
+
+}  // namespace Impl
+}  // namespace Test
+#endif /* KOKKOS_ALGORITHMS_UNITTESTS_TESTPHILOX_HPP */
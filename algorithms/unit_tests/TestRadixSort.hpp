@@ -0,0 +1,177 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef KOKKOS_ALGORITHMS_UNITTESTS_TESTRADIXSORT_HPP
+#define KOKKOS_ALGORITHMS_UNITTESTS_TESTRADIXSORT_HPP
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+#include <Kokkos_Sort.hpp>
+#include <TestSort.hpp>
+
+namespace Test {
+
+namespace Impl {
+
+// Reverse-cyclic keys: plenty of duplicates, nowhere sorted.  Each
+// payload entry records its original index so a host-side check can
+// verify both that the payload travelled with its key and that equal
+// keys kept their original relative order.
+template <class ExecutionSpace>
+struct radix_stability_fill {
+  typedef ExecutionSpace execution_space;
+
+  Kokkos::View<unsigned*, ExecutionSpace> keys;
+  Kokkos::View<unsigned*, ExecutionSpace> values;
+  unsigned n;
+  unsigned distinct;
+
+  radix_stability_fill(Kokkos::View<unsigned*, ExecutionSpace> keys_,
+                       Kokkos::View<unsigned*, ExecutionSpace> values_,
+                       unsigned n_, unsigned distinct_)
+      : keys(keys_), values(values_), n(n_), distinct(distinct_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(int i) const {
+    keys(i)   = (n - 1 - i) % distinct;
+    values(i) = i;
+  }
+};
+
+template <class ExecutionSpace, typename KeyType>
+void test_radix_sort_keys(unsigned int n) {
+  typedef Kokkos::View<KeyType*, ExecutionSpace> KeyViewType;
+  KeyViewType keys("RadixKeys", n);
+
+  Kokkos::Random_XorShift64_Pool<ExecutionSpace> g(1931);
+  Kokkos::fill_random(keys, g,
+                      Kokkos::Random_XorShift64_Pool<
+                          ExecutionSpace>::generator_type::MAX_URAND);
+
+  double sum_before       = 0.0;
+  double sum_after        = 0.0;
+  unsigned int sort_fails = 0;
+
+  Kokkos::parallel_reduce(n, sum<ExecutionSpace, KeyType>(keys), sum_before);
+
+  Kokkos::Experimental::radix_sort(keys);
+
+  Kokkos::parallel_reduce(n, sum<ExecutionSpace, KeyType>(keys), sum_after);
+  Kokkos::parallel_reduce(
+      n - 1, is_sorted_struct<ExecutionSpace, KeyType>(keys), sort_fails);
+
+  double ratio   = sum_before / sum_after;
+  double epsilon = 1e-10;
+  unsigned int equal_sum =
+      (ratio > (1.0 - epsilon)) && (ratio < (1.0 + epsilon)) ? 1 : 0;
+
+  ASSERT_EQ(sort_fails, 0);
+  ASSERT_EQ(equal_sum, 1);
+}
+
+template <class ExecutionSpace>
+void test_radix_sort_stability(unsigned int n) {
+  const unsigned distinct = 16;
+
+  Kokkos::View<unsigned*, ExecutionSpace> keys("RadixKeys", n);
+  Kokkos::View<unsigned*, ExecutionSpace> values("RadixValues", n);
+
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<ExecutionSpace>(0, n),
+      radix_stability_fill<ExecutionSpace>(keys, values, n, distinct));
+
+  Kokkos::Experimental::radix_sort(keys, values);
+
+  auto h_keys   = Kokkos::create_mirror_view(keys);
+  auto h_values = Kokkos::create_mirror_view(values);
+  Kokkos::deep_copy(h_keys, keys);
+  Kokkos::deep_copy(h_values, values);
+
+  unsigned int order_fails     = 0;
+  unsigned int stability_fails = 0;
+  unsigned int payload_fails   = 0;
+  for (unsigned i = 0; i < n; ++i) {
+    // The payload entry must still sit next to the key it was created
+    // with.
+    if (h_keys(i) != (n - 1 - h_values(i)) % distinct) payload_fails++;
+    if (i == 0) continue;
+    if (h_keys(i - 1) > h_keys(i)) order_fails++;
+    // Equal keys must keep their original (index) order.
+    if (h_keys(i - 1) == h_keys(i) && h_values(i - 1) >= h_values(i))
+      stability_fails++;
+  }
+
+  ASSERT_EQ(order_fails, 0);
+  ASSERT_EQ(stability_fails, 0);
+  ASSERT_EQ(payload_fails, 0);
+}
+
+template <class ExecutionSpace, typename KeyType>
+void test_radix_sort_degenerate() {
+  typedef Kokkos::View<KeyType*, ExecutionSpace> KeyViewType;
+
+  // Empty input: every phase must be a no-op rather than a crash.
+  KeyViewType empty("RadixKeys", 0);
+  Kokkos::Experimental::radix_sort(empty);
+  ASSERT_EQ(empty.extent(0), 0u);
+
+  // Single element: sorted output is the input.
+  KeyViewType one("RadixKeys", 1);
+  Kokkos::deep_copy(one, KeyType(42));
+  Kokkos::Experimental::radix_sort(one);
+
+  auto h_one = Kokkos::create_mirror_view(one);
+  Kokkos::deep_copy(h_one, one);
+  ASSERT_EQ(h_one(0), KeyType(42));
+}
+
+template <class ExecutionSpace, typename KeyType>
+void test_radix_sort(unsigned int N) {
+  test_radix_sort_keys<ExecutionSpace, KeyType>(N * N * N);
+  test_radix_sort_stability<ExecutionSpace>(10007);
+  test_radix_sort_degenerate<ExecutionSpace, KeyType>();
+}
+
+}  // namespace Impl
+}  // namespace Test
+#endif /* KOKKOS_ALGORITHMS_UNITTESTS_TESTRADIXSORT_HPP */
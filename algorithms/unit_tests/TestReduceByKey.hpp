@@ -0,0 +1,218 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef KOKKOS_ALGORITHMS_UNITTESTS_TESTREDUCEBYKEY_HPP
+#define KOKKOS_ALGORITHMS_UNITTESTS_TESTREDUCEBYKEY_HPP
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ReduceByKey.hpp>
+
+#include <map>
+#include <stdexcept>
+
+namespace Test {
+
+namespace Impl {
+
+// Presorted runs: key = i / run_len.  The last run is usually ragged.
+template <class ExecutionSpace>
+struct reduce_by_key_sorted_fill {
+  typedef ExecutionSpace execution_space;
+
+  Kokkos::View<int*, ExecutionSpace> keys;
+  Kokkos::View<int64_t*, ExecutionSpace> values;
+  int run_len;
+
+  reduce_by_key_sorted_fill(Kokkos::View<int*, ExecutionSpace> keys_,
+                            Kokkos::View<int64_t*, ExecutionSpace> values_,
+                            const int run_len_)
+      : keys(keys_), values(values_), run_len(run_len_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(int i) const {
+    keys(i)   = i / run_len;
+    values(i) = int64_t(i) * 3 + 1;
+  }
+};
+
+// Scattered keys with heavy skew: a Weyl-sequence hash spreads most
+// elements over 'distinct' keys, but every fourth element lands on key
+// zero, producing one giant run next to many short ones.
+template <class ExecutionSpace>
+struct reduce_by_key_scattered_fill {
+  typedef ExecutionSpace execution_space;
+
+  Kokkos::View<int*, ExecutionSpace> keys;
+  Kokkos::View<int64_t*, ExecutionSpace> values;
+  int distinct;
+
+  reduce_by_key_scattered_fill(Kokkos::View<int*, ExecutionSpace> keys_,
+                               Kokkos::View<int64_t*, ExecutionSpace> values_,
+                               const int distinct_)
+      : keys(keys_), values(values_), distinct(distinct_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(int i) const {
+    keys(i) =
+        (i % 4) ? int((uint32_t(i) * 2654435761u) % uint32_t(distinct)) : 0;
+    values(i) = int64_t(i % 97) - 48;
+  }
+};
+
+// Reduce on the host from mirror copies and compare: each distinct key
+// exactly once, ascending, with the exact integer sum of its values.
+template <class KeysView, class ValuesView>
+void check_reduce_by_key(const KeysView& keys, const ValuesView& values) {
+  typedef typename KeysView::memory_space memory_space;
+
+  auto h_keys   = Kokkos::create_mirror_view(keys);
+  auto h_values = Kokkos::create_mirror_view(values);
+  Kokkos::deep_copy(h_keys, keys);
+  Kokkos::deep_copy(h_values, values);
+
+  std::map<int, int64_t> reference;
+  for (size_t i = 0; i < h_keys.extent(0); ++i)
+    reference[h_keys(i)] += h_values(i);
+
+  Kokkos::View<int*, memory_space> unique("unique", reference.size());
+  Kokkos::View<int64_t*, memory_space> reduced("reduced", reference.size());
+
+  const int64_t num_unique =
+      Kokkos::Experimental::reduce_by_key(keys, values, unique, reduced);
+  ASSERT_EQ(int64_t(reference.size()), num_unique);
+
+  auto h_unique  = Kokkos::create_mirror_view(unique);
+  auto h_reduced = Kokkos::create_mirror_view(reduced);
+  Kokkos::deep_copy(h_unique, unique);
+  Kokkos::deep_copy(h_reduced, reduced);
+
+  int64_t k = 0;
+  for (typename std::map<int, int64_t>::const_iterator it = reference.begin();
+       it != reference.end(); ++it, ++k) {
+    ASSERT_EQ(it->first, h_unique(k));
+    ASSERT_EQ(it->second, h_reduced(k));
+  }
+}
+
+template <class ExecutionSpace>
+void test_reduce_by_key_sorted(const int n, const int run_len) {
+  Kokkos::View<int*, ExecutionSpace> keys("RbkKeys", n);
+  Kokkos::View<int64_t*, ExecutionSpace> values("RbkValues", n);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<ExecutionSpace>(0, n),
+      reduce_by_key_sorted_fill<ExecutionSpace>(keys, values, run_len));
+  check_reduce_by_key(keys, values);
+}
+
+template <class ExecutionSpace>
+void test_reduce_by_key_scattered(const int n, const int distinct) {
+  Kokkos::View<int*, ExecutionSpace> keys("RbkKeys", n);
+  Kokkos::View<int64_t*, ExecutionSpace> values("RbkValues", n);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<ExecutionSpace>(0, n),
+      reduce_by_key_scattered_fill<ExecutionSpace>(keys, values, distinct));
+  check_reduce_by_key(keys, values);
+}
+
+template <class ExecutionSpace>
+void test_reduce_by_key_degenerate() {
+  typedef Kokkos::View<int*, ExecutionSpace> KeyView;
+  typedef Kokkos::View<int64_t*, ExecutionSpace> ValueView;
+
+  // Empty input reduces to zero runs without touching the outputs.
+  {
+    KeyView keys("RbkKeys", 0);
+    ValueView values("RbkValues", 0);
+    KeyView unique("RbkUnique", 1);
+    ValueView reduced("RbkReduced", 1);
+    ASSERT_EQ(0, Kokkos::Experimental::reduce_by_key(keys, values, unique,
+                                                     reduced));
+  }
+
+  // A single repeated key exercises the min == max bin-sort skip.
+  {
+    const int n = 1000;
+    KeyView keys("RbkKeys", n);
+    ValueView values("RbkValues", n);
+    Kokkos::deep_copy(keys, 7);
+    Kokkos::deep_copy(values, int64_t(2));
+    check_reduce_by_key(keys, values);
+  }
+
+  // Mismatched extents and too-small outputs are refused.
+  {
+    KeyView keys("RbkKeys", 10);
+    ValueView values("RbkValues", 9);
+    KeyView unique("RbkUnique", 10);
+    ValueView reduced("RbkReduced", 10);
+    ASSERT_THROW(
+        Kokkos::Experimental::reduce_by_key(keys, values, unique, reduced),
+        std::runtime_error);
+  }
+  {
+    const int n = 100;
+    KeyView keys("RbkKeys", n);
+    ValueView values("RbkValues", n);
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<ExecutionSpace>(0, n),
+        reduce_by_key_sorted_fill<ExecutionSpace>(keys, values, 10));
+    KeyView unique("RbkUnique", 5);  // ten unique keys will not fit
+    ValueView reduced("RbkReduced", 5);
+    ASSERT_THROW(
+        Kokkos::Experimental::reduce_by_key(keys, values, unique, reduced),
+        std::runtime_error);
+  }
+}
+
+template <class ExecutionSpace>
+void test_reduce_by_key(const int n) {
+  test_reduce_by_key_sorted<ExecutionSpace>(n, 1);
+  test_reduce_by_key_sorted<ExecutionSpace>(n, 37);
+  test_reduce_by_key_sorted<ExecutionSpace>(n, n);
+  test_reduce_by_key_scattered<ExecutionSpace>(n, 101);
+  test_reduce_by_key_degenerate<ExecutionSpace>();
+}
+
+}  // namespace Impl
+}  // namespace Test
+#endif /* KOKKOS_ALGORITHMS_UNITTESTS_TESTREDUCEBYKEY_HPP */
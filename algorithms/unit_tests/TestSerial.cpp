@@ -50,7 +50,11 @@
 #include <Kokkos_Core.hpp>
 
 #include <TestRandom.hpp>
+#include <TestPhilox.hpp>
 #include <TestSort.hpp>
+#include <TestRadixSort.hpp>
+#include <TestReduceByKey.hpp>
+#include <TestTopK.hpp>
 #include <iomanip>
 
 //----------------------------------------------------------------------------
@@ -69,18 +73,46 @@ namespace Test {
         num_draws);                                                       \
   }
 
+#define SERIAL_PHILOX4X32(num_streams)              \
+  TEST(serial, Random_Philox4x32) {                 \
+    Impl::test_philox<Kokkos::Serial>(num_streams); \
+  }
+
 #define SERIAL_SORT_UNSIGNED(size)                   \
   TEST(serial, SortUnsigned) {                       \
     Impl::test_sort<Kokkos::Serial, unsigned>(size); \
   }
 
+#define SERIAL_RADIXSORT_UNSIGNED(size)                    \
+  TEST(serial, RadixSortUnsigned) {                        \
+    Impl::test_radix_sort<Kokkos::Serial, unsigned>(size); \
+  }
+
+#define SERIAL_REDUCEBYKEY(size)                    \
+  TEST(serial, ReduceByKey) {                       \
+    Impl::test_reduce_by_key<Kokkos::Serial>(size); \
+  }
+
+#define SERIAL_TOPK(size)                   \
+  TEST(serial, TopK) {                      \
+    Impl::test_top_k<Kokkos::Serial>(size); \
+  }
+
 SERIAL_RANDOM_XORSHIFT64(10240000)
 SERIAL_RANDOM_XORSHIFT1024(10130144)
+SERIAL_PHILOX4X32(4096)
 SERIAL_SORT_UNSIGNED(171)
+SERIAL_RADIXSORT_UNSIGNED(171)
+SERIAL_REDUCEBYKEY(10007)
+SERIAL_TOPK(100000)
 
 #undef SERIAL_RANDOM_XORSHIFT64
 #undef SERIAL_RANDOM_XORSHIFT1024
+#undef SERIAL_PHILOX4X32
 #undef SERIAL_SORT_UNSIGNED
+#undef SERIAL_RADIXSORT_UNSIGNED
+#undef SERIAL_REDUCEBYKEY
+#undef SERIAL_TOPK
 
 }  // namespace Test
 #else
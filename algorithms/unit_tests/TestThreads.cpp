@@ -50,7 +50,11 @@
 #include <Kokkos_Core.hpp>
 
 #include <TestRandom.hpp>
+#include <TestPhilox.hpp>
 #include <TestSort.hpp>
+#include <TestRadixSort.hpp>
+#include <TestReduceByKey.hpp>
+#include <TestTopK.hpp>
 #include <iomanip>
 
 //----------------------------------------------------------------------------
@@ -69,18 +73,46 @@ namespace Test {
         num_draws);                                                        \
   }
 
+#define THREADS_PHILOX4X32(num_streams)              \
+  TEST(threads, Random_Philox4x32) {                 \
+    Impl::test_philox<Kokkos::Threads>(num_streams); \
+  }
+
 #define THREADS_SORT_UNSIGNED(size)                 \
   TEST(threads, SortUnsigned) {                     \
     Impl::test_sort<Kokkos::Threads, double>(size); \
   }
 
+#define THREADS_RADIXSORT_UNSIGNED(size)                    \
+  TEST(threads, RadixSortUnsigned) {                        \
+    Impl::test_radix_sort<Kokkos::Threads, unsigned>(size); \
+  }
+
+#define THREADS_REDUCEBYKEY(size)                    \
+  TEST(threads, ReduceByKey) {                       \
+    Impl::test_reduce_by_key<Kokkos::Threads>(size); \
+  }
+
+#define THREADS_TOPK(size)                   \
+  TEST(threads, TopK) {                      \
+    Impl::test_top_k<Kokkos::Threads>(size); \
+  }
+
 THREADS_RANDOM_XORSHIFT64(10240000)
 THREADS_RANDOM_XORSHIFT1024(10130144)
+THREADS_PHILOX4X32(4096)
 THREADS_SORT_UNSIGNED(171)
+THREADS_RADIXSORT_UNSIGNED(171)
+THREADS_REDUCEBYKEY(10007)
+THREADS_TOPK(100000)
 
 #undef THREADS_RANDOM_XORSHIFT64
 #undef THREADS_RANDOM_XORSHIFT1024
+#undef THREADS_PHILOX4X32
 #undef THREADS_SORT_UNSIGNED
+#undef THREADS_RADIXSORT_UNSIGNED
+#undef THREADS_REDUCEBYKEY
+#undef THREADS_TOPK
 
 }  // namespace Test
 #else
@@ -0,0 +1,201 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef KOKKOS_ALGORITHMS_UNITTESTS_TESTTOPK_HPP
+#define KOKKOS_ALGORITHMS_UNITTESTS_TESTTOPK_HPP
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+#include <Kokkos_TopK.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace Test {
+
+namespace Impl {
+
+// Many ties: only 'distinct' values, so the selection threshold always
+// cuts through a heavily populated bin and the lower-index tie-break
+// is exercised throughout.
+template <class ExecutionSpace>
+struct top_k_ties_fill {
+  typedef ExecutionSpace execution_space;
+
+  Kokkos::View<int*, ExecutionSpace> src;
+  int distinct;
+
+  top_k_ties_fill(Kokkos::View<int*, ExecutionSpace> src_, const int distinct_)
+      : src(src_), distinct(distinct_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(int i) const {
+    src(i) = int((uint32_t(i) * 2654435761u) % uint32_t(distinct));
+  }
+};
+
+// Rank the data on the host exactly as top_k promises - descending by
+// value, ties toward the lower index - and compare the first k.
+template <class SrcView, class ValView, class IdxView>
+void check_top_k(const SrcView& src, const int64_t k, const ValView& values,
+                 const IdxView& indices) {
+  typedef typename SrcView::non_const_value_type value_type;
+
+  auto h_src = Kokkos::create_mirror_view(src);
+  Kokkos::deep_copy(h_src, src);
+
+  std::vector<std::pair<value_type, int64_t> > ranked(src.extent(0));
+  for (size_t i = 0; i < src.extent(0); ++i)
+    ranked[i] = std::make_pair(h_src(i), int64_t(i));
+  std::sort(ranked.begin(), ranked.end(),
+            [](const std::pair<value_type, int64_t>& a,
+               const std::pair<value_type, int64_t>& b) {
+              return a.first != b.first ? b.first < a.first
+                                        : a.second < b.second;
+            });
+
+  auto h_values  = Kokkos::create_mirror_view(values);
+  auto h_indices = Kokkos::create_mirror_view(indices);
+  Kokkos::deep_copy(h_values, values);
+  Kokkos::deep_copy(h_indices, indices);
+
+  for (int64_t i = 0; i < k; ++i) {
+    ASSERT_EQ(ranked[i].first, h_values(i));
+    ASSERT_EQ(ranked[i].second, h_indices(i));
+  }
+}
+
+template <class ExecutionSpace>
+void test_top_k_random(const int n, const int64_t k) {
+  Kokkos::View<double*, ExecutionSpace> src("TopKSrc", n);
+  Kokkos::Random_XorShift64_Pool<ExecutionSpace> g(1931);
+  Kokkos::fill_random(src, g, 1.0);
+
+  Kokkos::View<double*, ExecutionSpace> values("TopKValues", k);
+  Kokkos::View<int64_t*, ExecutionSpace> indices("TopKIndices", k);
+  Kokkos::Experimental::top_k(src, k, values, indices);
+  check_top_k(src, k, values, indices);
+}
+
+template <class ExecutionSpace>
+void test_top_k_ties(const int n, const int64_t k, const int distinct) {
+  Kokkos::View<int*, ExecutionSpace> src("TopKSrc", n);
+  Kokkos::parallel_for(Kokkos::RangePolicy<ExecutionSpace>(0, n),
+                       top_k_ties_fill<ExecutionSpace>(src, distinct));
+
+  Kokkos::View<int*, ExecutionSpace> values("TopKValues", k);
+  Kokkos::View<int64_t*, ExecutionSpace> indices("TopKIndices", k);
+  Kokkos::Experimental::top_k(src, k, values, indices);
+  check_top_k(src, k, values, indices);
+}
+
+template <class ExecutionSpace>
+void test_top_k_degenerate(const int n) {
+  typedef Kokkos::View<double*, ExecutionSpace> SrcView;
+
+  // All entries equal: any k positions are correct; the contract is
+  // the common value and distinct valid indices.
+  {
+    const int64_t k = 10;
+    SrcView src("TopKSrc", n);
+    Kokkos::deep_copy(src, 3.25);
+    SrcView values("TopKValues", k);
+    Kokkos::View<int64_t*, ExecutionSpace> indices("TopKIndices", k);
+    Kokkos::Experimental::top_k(src, k, values, indices);
+
+    auto h_values  = Kokkos::create_mirror_view(values);
+    auto h_indices = Kokkos::create_mirror_view(indices);
+    Kokkos::deep_copy(h_values, values);
+    Kokkos::deep_copy(h_indices, indices);
+    for (int64_t i = 0; i < k; ++i) {
+      ASSERT_EQ(3.25, h_values(i));
+      ASSERT_LE(int64_t(0), h_indices(i));
+      ASSERT_GT(int64_t(n), h_indices(i));
+      for (int64_t j = 0; j < i; ++j) ASSERT_NE(h_indices(j), h_indices(i));
+    }
+  }
+
+  // k == 0 is a no-op; k == n is a full descending sort.
+  {
+    SrcView src("TopKSrc", n);
+    Kokkos::Random_XorShift64_Pool<ExecutionSpace> g(1931);
+    Kokkos::fill_random(src, g, 1.0);
+
+    SrcView none("TopKValues", 0);
+    Kokkos::View<int64_t*, ExecutionSpace> none_idx("TopKIndices", 0);
+    Kokkos::Experimental::top_k(src, 0, none, none_idx);
+
+    SrcView all("TopKValues", n);
+    Kokkos::View<int64_t*, ExecutionSpace> all_idx("TopKIndices", n);
+    Kokkos::Experimental::top_k(src, n, all, all_idx);
+    check_top_k(src, n, all, all_idx);
+  }
+
+  // Requests the data cannot satisfy are refused.
+  {
+    SrcView src("TopKSrc", n);
+    SrcView values("TopKValues", n + 1);
+    Kokkos::View<int64_t*, ExecutionSpace> indices("TopKIndices", n + 1);
+    ASSERT_THROW(Kokkos::Experimental::top_k(src, n + 1, values, indices),
+                 std::runtime_error);
+
+    SrcView small("TopKValues", 3);
+    Kokkos::View<int64_t*, ExecutionSpace> small_idx("TopKIndices", 3);
+    ASSERT_THROW(Kokkos::Experimental::top_k(src, 4, small, small_idx),
+                 std::runtime_error);
+  }
+}
+
+template <class ExecutionSpace>
+void test_top_k(const int n) {
+  test_top_k_random<ExecutionSpace>(n, 1);
+  test_top_k_random<ExecutionSpace>(n, 100);
+  test_top_k_ties<ExecutionSpace>(n, 100, 16);
+  test_top_k_degenerate<ExecutionSpace>(1000);
+}
+
+}  // namespace Impl
+}  // namespace Test
+#endif /* KOKKOS_ALGORITHMS_UNITTESTS_TESTTOPK_HPP */
@@ -0,0 +1,196 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+// Atomic contention characterization: sweeps value types (int, uint64,
+// double go through native atomics; complex<double> takes the
+// Kokkos_Atomic_Generic.hpp CAS/lock path) against contention degrees
+// from one hot address up to fully spread, and fits the throughput
+// model
+//
+//     rate(H) = min( peak , H * per_address )
+//
+// per machine and type.  The crossover H* = peak / per_address is the
+// number of distinct hot addresses below which atomics serialize; a
+// ScatterView strategy choice can consult it directly: duplicate when
+// the expected distinct-address count is below H*, use atomics above.
+// Hot addresses are padded to separate cache lines so the sweep
+// measures address contention, not false sharing.
+//
+//   Usage: atomic_contention [-u updates] [-r repeats] [--model file]
+
+#include <Kokkos_Core.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+// One hot address per cache line
+enum { line_pad = 64 };
+
+template <class Scalar>
+struct ContentionUpdate {
+  typedef Kokkos::View<Scalar*> array_type;
+
+  array_type m_a;
+  int64_t m_hot;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t i) const {
+    const int64_t slot =
+        (int64_t(i) * 2654435761LL) % m_hot * (line_pad / sizeof(Scalar));
+    Kokkos::atomic_add(&m_a(slot), Scalar(1));
+  }
+};
+
+template <class Op>
+double bench(const int repeats, const Op& op) {
+  double best = 1e30;
+  for (int r = 0; r < repeats + 1; ++r) {
+    Kokkos::Timer timer;
+    op();
+    Kokkos::fence();
+    const double t = timer.seconds();
+    if (0 < r && t < best) best = t;
+  }
+  return best;
+}
+
+template <class Scalar>
+void characterize(const char* type_name, const int64_t updates,
+                  const int repeats, std::vector<std::string>& model) {
+  std::printf("%s:\n", type_name);
+  std::printf("  %-16s %s\n", "hot addresses", "GUpdates/s");
+
+  const int64_t hots[] = {1, 2, 4, 16, 64, 256, 1024, 16384, 262144};
+  const int nhot       = sizeof(hots) / sizeof(hots[0]);
+
+  double rate_one  = 0.0;
+  double rate_peak = 0.0;
+
+  for (int h = 0; h < nhot; ++h) {
+    const int64_t hot = hots[h];
+
+    typename ContentionUpdate<Scalar>::array_type a(
+        "contention::a", hot * (line_pad / sizeof(Scalar)));
+    const ContentionUpdate<Scalar> update{a, hot};
+
+    const double t = bench(repeats, [&]() {
+      Kokkos::parallel_for("contention::update",
+                           Kokkos::RangePolicy<Kokkos::IndexType<int64_t>>(
+                               0, updates),
+                           update);
+    });
+
+    const double rate = 1.0e-9 * double(updates) / t;
+    std::printf("  %-16lld %10.4f\n", (long long)hot, rate);
+
+    if (0 == h) rate_one = rate;
+    if (rate_peak < rate) rate_peak = rate;
+  }
+
+  const double crossover = rate_one > 0.0 ? rate_peak / rate_one : 0.0;
+
+  std::printf(
+      "  model: rate(H) = min( %.4f , H * %.4f ) GUpdates/s, "
+      "crossover H* = %.0f\n",
+      rate_peak, rate_one, crossover);
+
+  char buf[160];
+  std::snprintf(buf, sizeof(buf),
+                "atomic_model.%s.peak_gups=%.6f\n"
+                "atomic_model.%s.per_address_gups=%.6f\n"
+                "atomic_model.%s.scatterview_duplicate_below=%.0f",
+                type_name, rate_peak, type_name, rate_one, type_name,
+                crossover);
+  model.push_back(buf);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  int64_t updates        = int64_t(1) << 24;
+  int repeats            = 3;
+  const char* model_file = nullptr;
+
+  for (int i = 1; i < argc; ++i) {
+    if (0 == std::strcmp(argv[i], "-u") && i + 1 < argc)
+      updates = std::atoll(argv[++i]);
+    else if (0 == std::strcmp(argv[i], "-r") && i + 1 < argc)
+      repeats = std::atoi(argv[++i]);
+    else if (0 == std::strcmp(argv[i], "--model") && i + 1 < argc)
+      model_file = argv[++i];
+    else {
+      std::printf(
+          "Usage: atomic_contention [-u updates] [-r repeats] "
+          "[--model file]\n");
+      return 0 == std::strcmp(argv[i], "--help") ? 0 : 1;
+    }
+  }
+
+  Kokkos::initialize(argc, argv);
+  {
+    std::vector<std::string> model;
+
+    characterize<int>("int", updates, repeats, model);
+    characterize<uint64_t>("uint64", updates, repeats, model);
+    characterize<double>("double", updates, repeats, model);
+    // 16-byte value: exercises the generic CAS-loop/lock fallback that
+    // has dominated on hardware without wide atomics
+    characterize<Kokkos::complex<double>>("complex_double", updates / 4,
+                                          repeats, model);
+
+    if (model_file) {
+      std::ofstream out(model_file);
+      for (const std::string& entry : model) out << entry << "\n";
+      std::printf("Wrote contention model to %s\n", model_file);
+    }
+  }
+  Kokkos::finalize();
+  return 0;
+}
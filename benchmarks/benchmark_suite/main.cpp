@@ -0,0 +1,539 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+// Unified benchmark harness: runs the stream, gups, gather and
+// bytes_and_flops kernels plus container-level random access
+// (UnorderedMap insert/find mixes and ScatterView accumulation at
+// controlled key skew) in one binary, derives a machine roofline from
+// the measured peaks, and supports recording JSON baselines and
+// failing with a non-zero exit code when a metric regresses past a
+// threshold.  Intended to qualify Kokkos upgrades:
+//
+//   benchmark_suite --record baseline.json          # on the good build
+//   benchmark_suite --check baseline.json           # on the candidate
+//
+// All metrics are higher-is-better rates, so a regression is simply
+// current < baseline * (1 - tolerance).
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_UnorderedMap.hpp>
+#include <Kokkos_ScatterView.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#define HLINE "-------------------------------------------------------------\n"
+
+typedef Kokkos::View<double*> Array;
+typedef Kokkos::DefaultExecutionSpace::size_type Index;
+
+namespace {
+
+std::map<std::string, double> g_results;
+
+void record(const std::string& name, const double rate) {
+  std::printf("  %-32s %10.3f\n", name.c_str(), rate);
+  g_results[name] = rate;
+}
+
+// Best-of-repeats wall time of one launched operation
+template <class Op>
+double bench(const int repeats, const Op& op) {
+  double best = 1e30;
+  for (int r = 0; r < repeats + 1; ++r) {
+    Kokkos::Timer timer;
+    op();
+    Kokkos::fence();
+    const double t = timer.seconds();
+    // first iteration warms up allocations and instruction caches
+    if (0 < r && t < best) best = t;
+  }
+  return best;
+}
+
+//----------------------------------------------------------------------------
+// stream: classic copy/scale/add/triad, plus triad through a TeamPolicy
+// to cover both dispatch paths of the policy space
+
+void run_stream(const int64_t n, const int repeats) {
+  Array a("stream::a", n);
+  Array b("stream::b", n);
+  Array c("stream::c", n);
+
+  Kokkos::deep_copy(a, 1.0);
+  Kokkos::deep_copy(b, 2.0);
+  Kokkos::deep_copy(c, 0.0);
+
+  const double gb = 1.0e-9 * double(n) * sizeof(double);
+
+  double t = bench(repeats, [&]() {
+    Kokkos::parallel_for(
+        "stream::copy", Kokkos::RangePolicy<>(0, n),
+        KOKKOS_LAMBDA(const Index i) { c(i) = a(i); });
+  });
+  record("stream_copy_GBs", 2.0 * gb / t);
+
+  t = bench(repeats, [&]() {
+    Kokkos::parallel_for(
+        "stream::scale", Kokkos::RangePolicy<>(0, n),
+        KOKKOS_LAMBDA(const Index i) { b(i) = 1.5 * c(i); });
+  });
+  record("stream_scale_GBs", 2.0 * gb / t);
+
+  t = bench(repeats, [&]() {
+    Kokkos::parallel_for(
+        "stream::add", Kokkos::RangePolicy<>(0, n),
+        KOKKOS_LAMBDA(const Index i) { c(i) = a(i) + b(i); });
+  });
+  record("stream_add_GBs", 3.0 * gb / t);
+
+  t = bench(repeats, [&]() {
+    Kokkos::parallel_for(
+        "stream::triad", Kokkos::RangePolicy<>(0, n),
+        KOKKOS_LAMBDA(const Index i) { a(i) = b(i) + 1.5 * c(i); });
+  });
+  record("stream_triad_GBs", 3.0 * gb / t);
+
+  typedef Kokkos::TeamPolicy<>::member_type member_type;
+  const int league = 1024;
+  const int64_t per_team = (n + league - 1) / league;
+
+  t = bench(repeats, [&]() {
+    Kokkos::parallel_for(
+        "stream::triad_team", Kokkos::TeamPolicy<>(league, Kokkos::AUTO),
+        KOKKOS_LAMBDA(const member_type& team) {
+          const int64_t begin = team.league_rank() * per_team;
+          const int64_t end = begin + per_team < n ? begin + per_team : n;
+          Kokkos::parallel_for(Kokkos::TeamThreadRange(team, begin, end),
+                               [&](const int64_t i) {
+                                 a(i) = b(i) + 1.5 * c(i);
+                               });
+        });
+  });
+  record("stream_triad_team_GBs", 3.0 * gb / t);
+}
+
+//----------------------------------------------------------------------------
+// gups: random table updates
+
+void run_gups(const int64_t n, const int repeats) {
+  const int64_t updates = n / 4;
+
+  Kokkos::View<int64_t*> table("gups::table", n);
+  Kokkos::View<int64_t*> indices("gups::indices", updates);
+
+  Kokkos::parallel_for(
+      "gups::init", Kokkos::RangePolicy<>(0, updates),
+      KOKKOS_LAMBDA(const Index i) {
+        // cheap LCG scatter; collisions are fine for a rate measurement
+        indices(i) = (int64_t(i) * 2654435761LL + 12345LL) % n;
+      });
+  Kokkos::deep_copy(table, int64_t(1));
+
+  const double t = bench(repeats, [&]() {
+    Kokkos::parallel_for(
+        "gups::update", Kokkos::RangePolicy<>(0, updates),
+        KOKKOS_LAMBDA(const Index i) { table(indices(i)) ^= int64_t(i); });
+  });
+
+  record("gups_GUPS", 1.0e-9 * double(updates) / t);
+}
+
+//----------------------------------------------------------------------------
+// gather: each element accumulates 8 randomly indexed neighbors
+
+void run_gather(const int64_t n, const int repeats) {
+  enum { fan = 8 };
+
+  Array a("gather::a", n);
+  Array b("gather::b", n);
+  Kokkos::View<int64_t*> idx("gather::idx", n * fan);
+
+  Kokkos::deep_copy(a, 1.0);
+  Kokkos::parallel_for(
+      "gather::init", Kokkos::RangePolicy<>(0, n * fan),
+      KOKKOS_LAMBDA(const Index i) {
+        idx(i) = (int64_t(i) * 48271LL + 7LL) % n;
+      });
+
+  const double t = bench(repeats, [&]() {
+    Kokkos::parallel_for(
+        "gather::gather", Kokkos::RangePolicy<>(0, n),
+        KOKKOS_LAMBDA(const Index i) {
+          double sum = 0.0;
+          for (int k = 0; k < fan; ++k) sum += a(idx(i * fan + k));
+          b(i) = sum;
+        });
+  });
+
+  // per element: fan index loads + fan gathered loads + one store
+  const double gb =
+      1.0e-9 * double(n) *
+      (fan * sizeof(int64_t) + (fan + 1.0) * sizeof(double));
+  record("gather_GBs", gb / t);
+}
+
+//----------------------------------------------------------------------------
+// bytes_and_flops: one load + one store per element with F fused
+// multiply-adds in between; F=1 is bandwidth bound, F=64 compute bound
+
+template <int F>
+double run_bytes_and_flops_variant(const int64_t n, const int repeats,
+                                   Array& a, Array& b) {
+  return bench(repeats, [&]() {
+    Kokkos::parallel_for(
+        "bytes_and_flops", Kokkos::RangePolicy<>(0, n),
+        KOKKOS_LAMBDA(const Index i) {
+          // four independent chains so the FMA latency overlaps
+          double x0 = a(i);
+          double x1 = x0 + 1.0;
+          double x2 = x0 + 2.0;
+          double x3 = x0 + 3.0;
+          for (int k = 0; k < F; k += 4) {
+            x0 = x0 * 1.000001 + 0.000001;
+            x1 = x1 * 1.000001 + 0.000001;
+            x2 = x2 * 1.000001 + 0.000001;
+            x3 = x3 * 1.000001 + 0.000001;
+          }
+          b(i) = (x0 + x1) + (x2 + x3);
+        });
+  });
+}
+
+void run_bytes_and_flops(const int64_t n, const int repeats) {
+  Array a("bf::a", n);
+  Array b("bf::b", n);
+  Kokkos::deep_copy(a, 1.0);
+
+  const double gb = 1.0e-9 * double(n) * 2.0 * sizeof(double);
+
+  double t = run_bytes_and_flops_variant<1>(n, repeats, a, b);
+  record("bytes_and_flops_bw_GBs", gb / t);
+
+  t = run_bytes_and_flops_variant<64>(n, repeats, a, b);
+  record("bytes_and_flops_compute_GFLOPs", 1.0e-9 * double(n) * 2.0 * 64 / t);
+}
+
+//----------------------------------------------------------------------------
+// container gups: the same random-access pattern through UnorderedMap
+// and ScatterView, at uniform and at skewed key distributions (90% of
+// the operations hit 1% of the keys), since production random access
+// goes through the containers, not raw views
+
+KOKKOS_INLINE_FUNCTION
+int64_t gups_key(const int64_t i, const int64_t nkeys) {
+  // 90% of operations to the first 1% of the key space when skewed
+  const int64_t h = i * 2654435761LL + 12345LL;
+  return (h % 100 < 90) ? (h / 100) % (1 + nkeys / 100) : h % nkeys;
+}
+
+KOKKOS_INLINE_FUNCTION
+int64_t gups_key_uniform(const int64_t i, const int64_t nkeys) {
+  return (i * 2654435761LL + 12345LL) % nkeys;
+}
+
+void run_container_gups(const int64_t n, const int repeats) {
+  typedef Kokkos::UnorderedMap<int64_t, int64_t> map_type;
+
+  const int64_t ops   = n / 4;
+  const int64_t nkeys = n / 16;
+
+  // UnorderedMap insert mix: mostly-new keys (uniform) and
+  // mostly-existing keys (skewed).  The map is cleared outside the
+  // timed region before each pass.
+  {
+    map_type map(ops);
+
+    double best = 1e30;
+    for (int r = 0; r < repeats + 1; ++r) {
+      map.clear();
+      Kokkos::Timer timer;
+      Kokkos::parallel_for(
+          "umap::insert", Kokkos::RangePolicy<>(0, ops),
+          KOKKOS_LAMBDA(const Index i) {
+            map.insert(gups_key_uniform(i, n), int64_t(i));
+          });
+      Kokkos::fence();
+      const double t = timer.seconds();
+      if (0 < r && t < best) best = t;
+    }
+    record("umap_insert_uniform_MOPs", 1.0e-6 * double(ops) / best);
+
+    best = 1e30;
+    for (int r = 0; r < repeats + 1; ++r) {
+      map.clear();
+      Kokkos::Timer timer;
+      Kokkos::parallel_for(
+          "umap::insert_skewed", Kokkos::RangePolicy<>(0, ops),
+          KOKKOS_LAMBDA(const Index i) {
+            map.insert(gups_key(i, nkeys), int64_t(i));
+          });
+      Kokkos::fence();
+      const double t = timer.seconds();
+      if (0 < r && t < best) best = t;
+    }
+    record("umap_insert_skewed_MOPs", 1.0e-6 * double(ops) / best);
+  }
+
+  // UnorderedMap find mix over a populated map; the reduction keeps the
+  // lookups from being optimized away
+  {
+    map_type map(nkeys * 2);
+    Kokkos::parallel_for(
+        "umap::populate", Kokkos::RangePolicy<>(0, nkeys),
+        KOKKOS_LAMBDA(const Index i) { map.insert(int64_t(i), int64_t(i)); });
+    Kokkos::fence();
+
+    int64_t found  = 0;
+    const double t = bench(repeats, [&]() {
+      Kokkos::parallel_reduce(
+          "umap::find", Kokkos::RangePolicy<>(0, ops),
+          KOKKOS_LAMBDA(const Index i, int64_t& lsum) {
+            lsum += map.exists(gups_key(i, nkeys)) ? 1 : 0;
+          },
+          found);
+    });
+    if (found == 0) std::printf("  (warning: no keys found)\n");
+    record("umap_find_skewed_MOPs", 1.0e-6 * double(ops) / t);
+  }
+
+  // ScatterView accumulation: uniform exercises the memory system,
+  // skewed exercises the contention strategy (duplication on host,
+  // atomics on device)
+  {
+    Kokkos::View<double*> hist("container_gups::hist", nkeys);
+    auto scatter = Kokkos::Experimental::create_scatter_view(hist);
+
+    double t = bench(repeats, [&]() {
+      Kokkos::parallel_for(
+          "scatterview::uniform", Kokkos::RangePolicy<>(0, ops),
+          KOKKOS_LAMBDA(const Index i) {
+            auto access = scatter.access();
+            access(gups_key_uniform(i, nkeys)) += 1.0;
+          });
+      Kokkos::Experimental::contribute(hist, scatter);
+    });
+    record("scatterview_uniform_MUPs", 1.0e-6 * double(ops) / t);
+
+    t = bench(repeats, [&]() {
+      Kokkos::parallel_for(
+          "scatterview::skewed", Kokkos::RangePolicy<>(0, ops),
+          KOKKOS_LAMBDA(const Index i) {
+            auto access = scatter.access();
+            access(gups_key(i, nkeys)) += 1.0;
+          });
+      Kokkos::Experimental::contribute(hist, scatter);
+    });
+    record("scatterview_skewed_MUPs", 1.0e-6 * double(ops) / t);
+  }
+}
+
+//----------------------------------------------------------------------------
+// roofline: peak bandwidth from the best stream kernel, peak flops from
+// the compute-bound bytes_and_flops variant
+
+void print_roofline() {
+  double peak_bw = 0.0;
+  const char* bw_keys[] = {"stream_copy_GBs", "stream_scale_GBs",
+                           "stream_add_GBs", "stream_triad_GBs",
+                           "stream_triad_team_GBs"};
+  for (const char* key : bw_keys)
+    if (peak_bw < g_results[key]) peak_bw = g_results[key];
+
+  const double peak_flops = g_results["bytes_and_flops_compute_GFLOPs"];
+
+  std::printf(HLINE);
+  std::printf("Roofline: peak %.2f GB/s, peak %.2f GFLOP/s, balance %.3f "
+              "FLOP/byte\n",
+              peak_bw, peak_flops, peak_flops / peak_bw);
+  std::printf("  %-22s %-16s %s\n", "intensity (FLOP/byte)", "bound (GFLOP/s)",
+              "limited by");
+  for (double ai = 0.125; ai <= 64.0; ai *= 2.0) {
+    const double bw_bound = ai * peak_bw;
+    std::printf("  %-22.3f %-16.2f %s\n", ai,
+                bw_bound < peak_flops ? bw_bound : peak_flops,
+                bw_bound < peak_flops ? "bandwidth" : "compute");
+  }
+
+  g_results["roofline_peak_GBs"]    = peak_bw;
+  g_results["roofline_peak_GFLOPs"] = peak_flops;
+}
+
+//----------------------------------------------------------------------------
+// JSON baselines: a flat object of higher-is-better rates
+
+void write_json(const char* path) {
+  std::ofstream out(path);
+  if (!out) {
+    std::fprintf(stderr, "benchmark_suite: cannot write '%s'\n", path);
+    std::exit(1);
+  }
+  out << "{\n";
+  size_t i = 0;
+  for (std::map<std::string, double>::const_iterator it = g_results.begin();
+       it != g_results.end(); ++it, ++i) {
+    out << "  \"" << it->first << "\": " << it->second
+        << (i + 1 < g_results.size() ? ",\n" : "\n");
+  }
+  out << "}\n";
+  std::printf("Wrote %zu metrics to %s\n", g_results.size(), path);
+}
+
+std::map<std::string, double> read_json(const char* path) {
+  std::ifstream in(path);
+  if (!in) {
+    std::fprintf(stderr, "benchmark_suite: cannot read '%s'\n", path);
+    std::exit(1);
+  }
+  std::map<std::string, double> baseline;
+  std::string line;
+  // The file is the flat object written by --record: one "key": value
+  // pair per line.
+  while (std::getline(in, line)) {
+    const size_t k0 = line.find('"');
+    if (k0 == std::string::npos) continue;
+    const size_t k1 = line.find('"', k0 + 1);
+    const size_t colon = line.find(':', k1);
+    if (k1 == std::string::npos || colon == std::string::npos) continue;
+    baseline[line.substr(k0 + 1, k1 - k0 - 1)] =
+        std::atof(line.c_str() + colon + 1);
+  }
+  return baseline;
+}
+
+int check_baseline(const char* path, const double tolerance) {
+  const std::map<std::string, double> baseline = read_json(path);
+
+  std::printf(HLINE);
+  int failures = 0;
+  for (std::map<std::string, double>::const_iterator it = baseline.begin();
+       it != baseline.end(); ++it) {
+    std::map<std::string, double>::const_iterator cur =
+        g_results.find(it->first);
+    if (cur == g_results.end()) {
+      std::printf("  MISSING %-32s (in baseline, not measured)\n",
+                  it->first.c_str());
+      ++failures;
+      continue;
+    }
+    const double floor = it->second * (1.0 - tolerance);
+    const bool ok      = cur->second >= floor;
+    std::printf("  %-7s %-32s %10.3f vs baseline %10.3f\n",
+                ok ? "PASS" : "FAIL", it->first.c_str(), cur->second,
+                it->second);
+    if (!ok) ++failures;
+  }
+  std::printf(HLINE);
+  if (failures) {
+    std::printf("%d metric(s) regressed more than %.0f%%\n", failures,
+                100.0 * tolerance);
+  } else {
+    std::printf("All metrics within %.0f%% of baseline\n", 100.0 * tolerance);
+  }
+  return failures ? 1 : 0;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  int64_t n          = int64_t(1) << 24;
+  int repeats        = 10;
+  double tolerance   = 0.10;
+  const char* rec    = nullptr;
+  const char* chk    = nullptr;
+  const char* json   = nullptr;
+
+  for (int i = 1; i < argc; ++i) {
+    if (0 == std::strcmp(argv[i], "-n") && i + 1 < argc)
+      n = std::atoll(argv[++i]);
+    else if (0 == std::strcmp(argv[i], "-r") && i + 1 < argc)
+      repeats = std::atoi(argv[++i]);
+    else if (0 == std::strcmp(argv[i], "--tolerance") && i + 1 < argc)
+      tolerance = std::atof(argv[++i]);
+    else if (0 == std::strcmp(argv[i], "--record") && i + 1 < argc)
+      rec = argv[++i];
+    else if (0 == std::strcmp(argv[i], "--check") && i + 1 < argc)
+      chk = argv[++i];
+    else if (0 == std::strcmp(argv[i], "--json") && i + 1 < argc)
+      json = argv[++i];
+    else {
+      std::printf(
+          "Usage: benchmark_suite [-n elements] [-r repeats]\n"
+          "                       [--record file.json] [--check file.json]\n"
+          "                       [--tolerance fraction] [--json file.json]\n");
+      return 0 == std::strcmp(argv[i], "--help") ? 0 : 1;
+    }
+  }
+
+  Kokkos::initialize(argc, argv);
+
+  int rc = 0;
+  {
+    std::printf(HLINE);
+    std::printf("benchmark_suite: n = %lld, best of %d repeats\n",
+                (long long)n, repeats);
+    std::printf(HLINE);
+
+    run_stream(n, repeats);
+    run_gups(n, repeats);
+    run_gather(n / 8, repeats);
+    run_bytes_and_flops(n, repeats);
+    run_container_gups(n, repeats);
+    print_roofline();
+
+    if (json) write_json(json);
+    if (rec) write_json(rec);
+    if (chk) rc = check_baseline(chk, tolerance);
+  }
+
+  Kokkos::finalize();
+  return rc;
+}
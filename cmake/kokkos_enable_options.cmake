@@ -41,11 +41,17 @@ ENDIF()
 UNSET(_UPPERCASE_CMAKE_BUILD_TYPE)
 KOKKOS_ENABLE_OPTION(LARGE_MEM_TESTS      OFF "Whether to perform extra large memory tests")
 KOKKOS_ENABLE_OPTION(DEBUG_BOUNDS_CHECK   OFF "Whether to use bounds checking - will increase runtime")
+KOKKOS_ENABLE_OPTION(DEBUG_BOUNDS_TRAP    OFF "Whether to use span-granularity bounds checking - cheap enough for production, aborts on violation")
 KOKKOS_ENABLE_OPTION(COMPILER_WARNINGS    OFF "Whether to print all compiler warnings")
 KOKKOS_ENABLE_OPTION(PROFILING            ON  "Whether to create bindings for profiling tools")
 KOKKOS_ENABLE_OPTION(PROFILING_LOAD_PRINT OFF "Whether to print information about which profiling tools got loaded")
 KOKKOS_ENABLE_OPTION(AGGRESSIVE_VECTORIZATION OFF "Whether to aggressively vectorize loops")
 KOKKOS_ENABLE_OPTION(DEPRECATED_CODE          OFF "Whether to enable deprecated code")
+KOKKOS_ENABLE_OPTION(ETI                      OFF "Whether to build the explicit ViewCopy/ViewFill template instantiations into libkokkoscore")
+KOKKOS_OPTION(ETI_EXTRA_SCALAR_TYPES "" STRING "Semicolon-separated list of additional scalar types to cover with ViewCopy/ViewFill ETI, e.g. Kokkos::complex<float>. Requires Kokkos_ENABLE_ETI=ON. Names must be fully qualified and may not contain commas - introduce an alias for such types")
+IF (KOKKOS_ETI_EXTRA_SCALAR_TYPES AND NOT KOKKOS_ENABLE_ETI)
+  MESSAGE(WARNING "Kokkos_ETI_EXTRA_SCALAR_TYPES is set but Kokkos_ENABLE_ETI is OFF. The extra types will be ignored.")
+ENDIF()
 
 IF (KOKKOS_ENABLE_CUDA)
   SET(KOKKOS_COMPILER_CUDA_VERSION "${KOKKOS_COMPILER_VERSION_MAJOR}${KOKKOS_COMPILER_VERSION_MINOR}")
@@ -0,0 +1,330 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_AoSoA.hpp
+/// \brief Declaration and definition of Kokkos::Experimental::AoSoA.
+///
+/// This header file declares and defines
+/// Kokkos::Experimental::AoSoA and associated free functions.
+
+#ifndef KOKKOS_AOSOA_HPP
+#define KOKKOS_AOSOA_HPP
+
+#include <Kokkos_Core.hpp>
+
+#include <string>
+
+namespace Kokkos {
+namespace Experimental {
+
+/// \brief Compile-time list of the member field types of an AoSoA.
+template <class... Types>
+struct MemberTypes {
+  enum { size = sizeof...(Types) };
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+namespace Kokkos {
+namespace Impl {
+
+template <unsigned I, class... Types>
+struct AoSoAMemberType;
+
+template <unsigned I, class T, class... Types>
+struct AoSoAMemberType<I, T, Types...> : AoSoAMemberType<I - 1, Types...> {};
+
+template <class T, class... Types>
+struct AoSoAMemberType<0, T, Types...> {
+  typedef T type;
+};
+
+constexpr size_t aosoa_gcd(size_t a, size_t b) {
+  return 0 == b ? a : aosoa_gcd(b, a % b);
+}
+
+constexpr size_t aosoa_lcm(size_t a, size_t b) {
+  return a / aosoa_gcd(a, b) * b;
+}
+
+constexpr size_t aosoa_align_up(size_t x, size_t a) {
+  return ((x + a - 1) / a) * a;
+}
+
+// Least common multiple of the member sizes and alignments: a tile
+// stride that is a multiple of this value gives every member slice an
+// exact element-unit stride and keeps every tile's members aligned.
+template <class... Types>
+struct AoSoASizeLcm;
+
+template <class T>
+struct AoSoASizeLcm<T> {
+  enum : size_t { value = aosoa_lcm(sizeof(T), alignof(T)) };
+};
+
+template <class T, class U, class... Types>
+struct AoSoASizeLcm<T, U, Types...> {
+  enum : size_t {
+    value = aosoa_lcm(aosoa_lcm(sizeof(T), alignof(T)),
+                      size_t(AoSoASizeLcm<U, Types...>::value))
+  };
+};
+
+// Byte offset of member I's sub-array within one tile:
+//   offset(0) = 0
+//   offset(I) = align_up(offset(I-1) + VL * sizeof(type(I-1)),
+//                        alignof(type(I)))
+template <unsigned I, unsigned VL, class... Types>
+struct AoSoAMemberOffset {
+  typedef typename AoSoAMemberType<I - 1, Types...>::type prev_type;
+  typedef typename AoSoAMemberType<I, Types...>::type this_type;
+  enum : size_t {
+    value = aosoa_align_up(size_t(AoSoAMemberOffset<I - 1, VL, Types...>::value) +
+                               VL * sizeof(prev_type),
+                           alignof(this_type))
+  };
+};
+
+template <unsigned VL, class... Types>
+struct AoSoAMemberOffset<0, VL, Types...> {
+  enum : size_t { value = 0 };
+};
+
+// Default inner tile length: the warp/wavefront width where there is
+// one, a typical host SIMD width otherwise.
+template <class ExecSpace>
+struct AoSoADefaultVectorLength {
+  enum { value = 8 };
+};
+
+#if defined(KOKKOS_ENABLE_CUDA)
+template <>
+struct AoSoADefaultVectorLength<Kokkos::Cuda> {
+  enum { value = 32 };
+};
+#endif
+
+#if defined(KOKKOS_ENABLE_ROCM)
+template <>
+struct AoSoADefaultVectorLength<Kokkos::Experimental::ROCm> {
+  enum { value = 64 };
+};
+#endif
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  Array-of-structures-of-arrays particle/field storage.
+ *
+ *  An AoSoA stores a tuple of member fields for N elements in a single
+ *  allocation, tiled so that VectorLength consecutive elements of one
+ *  field are contiguous within a tile.  That gives coalesced access on
+ *  GPUs and SIMD-friendly unit-stride runs on hosts from the same data
+ *  structure, and replaces the hand-maintained bundle of separate
+ *  per-field Views whose scattered allocations defeat prefetchers.
+ *
+ *  Element i lives in tile i / vector_length at lane i % vector_length.
+ *  slice<I>() returns an unmanaged rank-2 LayoutStride View of member I
+ *  indexed as (tile, lane); kernels address element i through the
+ *  tile(i) / lane(i) helpers.  Slices do not extend the lifetime of the
+ *  container - keep the AoSoA alive while they are in use.
+ *
+ *  Member types must be trivially copyable scalars or aggregates; the
+ *  tile stride is padded so every member slice has an exact
+ *  element-unit stride between tiles.
+ */
+template <class MemberTypesT, class DeviceType = Kokkos::DefaultExecutionSpace,
+          unsigned VectorLength = Kokkos::Impl::AoSoADefaultVectorLength<
+              typename DeviceType::execution_space>::value>
+class AoSoA;
+
+template <class... Types, class DeviceType, unsigned VectorLength>
+class AoSoA<MemberTypes<Types...>, DeviceType, VectorLength> {
+ public:
+  typedef MemberTypes<Types...> member_types;
+  typedef DeviceType device_type;
+  typedef typename device_type::execution_space execution_space;
+  typedef typename device_type::memory_space memory_space;
+  typedef size_t size_type;
+
+  enum : unsigned { vector_length = VectorLength };
+  enum : unsigned { number_of_members = sizeof...(Types) };
+
+  static_assert(0 < VectorLength, "AoSoA requires a nonzero vector length");
+
+  /// \brief Type of member I.
+  template <unsigned I>
+  struct member {
+    typedef typename Kokkos::Impl::AoSoAMemberType<I, Types...>::type type;
+  };
+
+  /// \brief Unmanaged (tile, lane) View of member I.
+  template <unsigned I>
+  using slice_type =
+      Kokkos::View<typename member<I>::type**, Kokkos::LayoutStride,
+                   device_type, Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  enum : size_t {
+    tile_stride_bytes = Kokkos::Impl::aosoa_align_up(
+        size_t(Kokkos::Impl::AoSoAMemberOffset<number_of_members - 1,
+                                               vector_length,
+                                               Types...>::value) +
+            vector_length *
+                sizeof(typename member<number_of_members - 1>::type),
+        size_t(Kokkos::Impl::AoSoASizeLcm<Types...>::value))
+  };
+
+  AoSoA() : m_buffer(), m_size(0) {}
+
+  AoSoA(const std::string& arg_label, const size_type arg_size)
+      : m_buffer(Kokkos::view_alloc(arg_label, WithoutInitializing),
+                 num_tiles(arg_size) * size_type(tile_stride_bytes)),
+        m_size(arg_size) {}
+
+  /// \brief Number of elements.
+  KOKKOS_INLINE_FUNCTION
+  size_type size() const { return m_size; }
+
+  /// \brief Number of element slots allocated (a whole number of tiles).
+  KOKKOS_INLINE_FUNCTION
+  size_type capacity() const {
+    return (m_buffer.extent(0) / tile_stride_bytes) * vector_length;
+  }
+
+  /// \brief Number of allocated tiles.
+  KOKKOS_INLINE_FUNCTION
+  size_type num_soa() const { return m_buffer.extent(0) / tile_stride_bytes; }
+
+  std::string label() const { return m_buffer.label(); }
+
+  /// \brief Tile index of element i.
+  KOKKOS_INLINE_FUNCTION
+  static constexpr size_type tile(const size_type i) {
+    return i / vector_length;
+  }
+
+  /// \brief Lane of element i within its tile.
+  KOKKOS_INLINE_FUNCTION
+  static constexpr size_type lane(const size_type i) {
+    return i % vector_length;
+  }
+
+  /// \brief Unmanaged (tile, lane) View of member I.
+  template <unsigned I>
+  slice_type<I> slice() const {
+    typedef typename member<I>::type value_type;
+    enum : size_t {
+      offset =
+          Kokkos::Impl::AoSoAMemberOffset<I, vector_length, Types...>::value
+    };
+    const size_type ntiles = num_soa();
+    const Kokkos::LayoutStride layout(
+        ntiles, tile_stride_bytes / sizeof(value_type), vector_length, 1);
+    return slice_type<I>(
+        reinterpret_cast<value_type*>(m_buffer.data() + offset), layout);
+  }
+
+  /// \brief Change the number of elements, preserving existing contents
+  ///        up to the smaller of the old and new sizes.
+  void resize(const size_type arg_size) {
+    const size_type new_bytes = num_tiles(arg_size) * tile_stride_bytes;
+    if (new_bytes == m_buffer.extent(0)) {
+      m_size = arg_size;
+      return;
+    }
+    buffer_type buffer(
+        Kokkos::view_alloc(m_buffer.label(), WithoutInitializing), new_bytes);
+    const size_type copy_bytes =
+        new_bytes < m_buffer.extent(0) ? new_bytes : m_buffer.extent(0);
+    if (0 != copy_bytes) {
+      Kokkos::deep_copy(
+          Kokkos::subview(buffer, std::make_pair(size_type(0), copy_bytes)),
+          Kokkos::subview(m_buffer,
+                          std::make_pair(size_type(0), copy_bytes)));
+    }
+    m_buffer = buffer;
+    m_size   = arg_size;
+  }
+
+  /// \brief Raw tiled storage; one allocation of num_soa() tiles.
+  char* data() const { return m_buffer.data(); }
+
+ private:
+  typedef Kokkos::View<char*, device_type> buffer_type;
+
+  static constexpr size_type num_tiles(const size_type n) {
+    return (n + vector_length - 1) / vector_length;
+  }
+
+  buffer_type m_buffer;
+  size_type m_size;
+
+  template <class, class, unsigned>
+  friend class AoSoA;
+
+  template <class M, class DD, class SD, unsigned V>
+  friend void deep_copy(AoSoA<M, DD, V>& dst, const AoSoA<M, SD, V>& src);
+};
+
+/// \brief Copy the contents of one AoSoA into another with the same
+///        member types and vector length, possibly across memory spaces.
+///
+/// The tile layout is identical on both sides, so this is one bulk byte
+/// copy of the shared allocation.  The destination is resized to match.
+template <class MemberTypesT, class DstDevice, class SrcDevice,
+          unsigned VectorLength>
+inline void deep_copy(AoSoA<MemberTypesT, DstDevice, VectorLength>& dst,
+                      const AoSoA<MemberTypesT, SrcDevice, VectorLength>& src) {
+  dst.resize(src.size());
+  Kokkos::deep_copy(dst.m_buffer, src.m_buffer);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_AOSOA_HPP */
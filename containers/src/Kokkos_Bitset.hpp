@@ -291,6 +291,13 @@ class Bitset {
   template <typename Bitset>
   friend struct Impl::BitsetCount;
 
+  template <typename BBitset, typename OutView>
+  friend struct Impl::BitsetExtract;
+
+  template <typename DstBitset, typename SrcBitset,
+            Impl::BitsetBinaryOperation Op>
+  friend struct Impl::BitsetBinaryOp;
+
   template <typename DstDevice, typename SrcDevice>
   friend void deep_copy(Bitset<DstDevice>& dst, Bitset<SrcDevice> const& src);
 
@@ -364,6 +371,13 @@ class ConstBitset {
   template <typename Bitset>
   friend struct Impl::BitsetCount;
 
+  template <typename BBitset, typename OutView>
+  friend struct Impl::BitsetExtract;
+
+  template <typename DstBitset, typename SrcBitset,
+            Impl::BitsetBinaryOperation Op>
+  friend struct Impl::BitsetBinaryOp;
+
   template <typename DstDevice, typename SrcDevice>
   friend void deep_copy(Bitset<DstDevice>& dst,
                         ConstBitset<SrcDevice> const& src);
@@ -415,6 +429,74 @@ void deep_copy(ConstBitset<DstDevice>& dst, ConstBitset<SrcDevice> const& src) {
                 sizeof(unsigned) * src.m_blocks.extent(0));
 }
 
+namespace Experimental {
+
+/// Compact the indices of all set bits into \c out with a single
+/// device-parallel scan over the bitset's blocks.  Indices are written
+/// in increasing order.  Returns the total number of set bits; if \c
+/// out is smaller than that, only the first out.extent(0) indices are
+/// written.  Can only be called from the host.
+template <typename Device, typename OutViewType>
+unsigned extract_set_indices(Bitset<Device> const& bitset,
+                             OutViewType const& out) {
+  Kokkos::Impl::BitsetExtract<Bitset<Device>, OutViewType> f(bitset, out);
+  return f.apply();
+}
+
+template <typename Device, typename OutViewType>
+unsigned extract_set_indices(ConstBitset<Device> const& bitset,
+                             OutViewType const& out) {
+  Kokkos::Impl::BitsetExtract<ConstBitset<Device>, OutViewType> f(bitset, out);
+  return f.apply();
+}
+
+/// dst = a & b, block-wise in one fused kernel.
+/// All three bitsets must have the same size.
+/// Can only be called from the host.
+template <typename Device>
+void bitwise_and(Bitset<Device> const& dst, Bitset<Device> const& a,
+                 Bitset<Device> const& b) {
+  if (dst.size() != a.size() || dst.size() != b.size()) {
+    throw std::runtime_error(
+        "Error: Cannot combine bitsets of different sizes!");
+  }
+  Kokkos::Impl::BitsetBinaryOp<Bitset<Device>, Bitset<Device>, Kokkos::Impl::BITSET_AND> f(
+      dst, a, b);
+  f.apply();
+}
+
+/// dst = a | b, block-wise in one fused kernel.
+/// All three bitsets must have the same size.
+/// Can only be called from the host.
+template <typename Device>
+void bitwise_or(Bitset<Device> const& dst, Bitset<Device> const& a,
+                Bitset<Device> const& b) {
+  if (dst.size() != a.size() || dst.size() != b.size()) {
+    throw std::runtime_error(
+        "Error: Cannot combine bitsets of different sizes!");
+  }
+  Kokkos::Impl::BitsetBinaryOp<Bitset<Device>, Bitset<Device>, Kokkos::Impl::BITSET_OR> f(
+      dst, a, b);
+  f.apply();
+}
+
+/// dst = a ^ b, block-wise in one fused kernel.
+/// All three bitsets must have the same size.
+/// Can only be called from the host.
+template <typename Device>
+void bitwise_xor(Bitset<Device> const& dst, Bitset<Device> const& a,
+                 Bitset<Device> const& b) {
+  if (dst.size() != a.size() || dst.size() != b.size()) {
+    throw std::runtime_error(
+        "Error: Cannot combine bitsets of different sizes!");
+  }
+  Kokkos::Impl::BitsetBinaryOp<Bitset<Device>, Bitset<Device>, Kokkos::Impl::BITSET_XOR> f(
+      dst, a, b);
+  f.apply();
+}
+
+}  // namespace Experimental
+
 }  // namespace Kokkos
 
 #endif  // KOKKOS_BITSET_HPP
@@ -0,0 +1,306 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_Channel.hpp
+/// \brief A bounded lock-free MPMC channel for host-thread coordination.
+///
+/// Producer-consumer pipelines between host I/O threads and Kokkos
+/// compute typically hand items through a mutex-guarded queue; at high
+/// event rates the lock handoff dominates the cost of the items
+/// themselves.  Kokkos::Experimental::Channel is a fixed-capacity
+/// multi-producer multi-consumer ring whose slots carry their own
+/// sequence numbers (Vyukov's bounded queue), so producers and
+/// consumers claim slots with one compare-exchange each and never take
+/// a lock.  Slots are padded to cache-line boundaries so concurrent
+/// producers and consumers do not false-share.
+///
+/// try_push and try_pop never block.  The blocking push and pop spin
+/// briefly and then sleep on a futex (Linux; elsewhere they yield), so
+/// an idle consumer thread costs nothing between events.
+
+#ifndef KOKKOS_CHANNEL_HPP
+#define KOKKOS_CHANNEL_HPP
+
+#include <Kokkos_Core.hpp>
+#include <impl/Kokkos_Error.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace Kokkos {
+namespace Experimental {
+
+namespace Impl {
+
+//! Sleep until *addr differs from expected (Linux futex, else yield).
+inline void channel_wait(std::atomic<uint32_t>* addr,
+                         const uint32_t expected) {
+#if defined(__linux__) && defined(SYS_futex)
+  syscall(SYS_futex, reinterpret_cast<uint32_t*>(addr), FUTEX_WAIT_PRIVATE,
+          expected, nullptr, nullptr, 0);
+#else
+  (void)addr;
+  (void)expected;
+  std::this_thread::yield();
+#endif
+}
+
+//! Wake every thread sleeping in channel_wait on addr.
+inline void channel_wake(std::atomic<uint32_t>* addr) {
+#if defined(__linux__) && defined(SYS_futex)
+  syscall(SYS_futex, reinterpret_cast<uint32_t*>(addr), FUTEX_WAKE_PRIVATE,
+          INT32_MAX, nullptr, nullptr, 0);
+#else
+  (void)addr;
+#endif
+}
+
+//! Shared state of a Channel; one allocation per channel, never moved.
+template <class T>
+struct ChannelState {
+  enum : size_t { cache_line = 64 };
+
+  struct SlotData {
+    std::atomic<uint64_t> sequence;
+    T value;
+  };
+
+  // Pad each slot out to a cache-line multiple so neighbouring slots,
+  // claimed by different threads, never share a line.
+  struct Slot : public SlotData {
+    unsigned char padding[(sizeof(SlotData) % cache_line == 0)
+                              ? cache_line
+                              : cache_line - sizeof(SlotData) % cache_line];
+  };
+
+  std::unique_ptr<Slot[]> slots;
+  uint64_t mask;
+
+  // Producer and consumer cursors on separate cache lines, likewise
+  // the two event counters the blocking operations sleep on.
+  std::atomic<uint64_t> push_cursor;
+  unsigned char pad0[cache_line - sizeof(std::atomic<uint64_t>)];
+  std::atomic<uint64_t> pop_cursor;
+  unsigned char pad1[cache_line - sizeof(std::atomic<uint64_t>)];
+  std::atomic<uint32_t> item_events;
+  unsigned char pad2[cache_line - sizeof(std::atomic<uint32_t>)];
+  std::atomic<uint32_t> space_events;
+
+  explicit ChannelState(const size_t capacity) {
+    size_t rounded = 2;
+    while (rounded < capacity) rounded *= 2;
+    slots.reset(new Slot[rounded]);
+    mask = rounded - 1;
+    for (size_t i = 0; i < rounded; ++i) {
+      slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    push_cursor.store(0, std::memory_order_relaxed);
+    pop_cursor.store(0, std::memory_order_relaxed);
+    item_events.store(0, std::memory_order_relaxed);
+    space_events.store(0, std::memory_order_relaxed);
+  }
+};
+
+}  // namespace Impl
+
+/** \brief  Fixed-capacity lock-free multi-producer multi-consumer
+ *          channel of host values.
+ *
+ *  Copies of a Channel share the same ring, so pass it by value to the
+ *  producing and consuming threads like a View.  Capacity rounds up to
+ *  a power of two and is fixed for the channel's lifetime; a full
+ *  channel exerts backpressure through the blocking push.
+ *
+ *  \code
+ *    Kokkos::Experimental::Channel<WorkItem> events("events", 1024);
+ *    // I/O thread:             compute thread:
+ *    events.push(item);         WorkItem item;
+ *                               events.pop(item);  // sleeps when idle
+ *  \endcode
+ *
+ *  The element type needs copy assignment; it is copied into and out of
+ *  the ring.  All operations are host-only.
+ */
+template <class T>
+class Channel {
+ public:
+  typedef T value_type;
+
+ private:
+  typedef Impl::ChannelState<T> state_type;
+
+  std::shared_ptr<state_type> m_state;
+
+  enum : int { spin_limit = 128 };
+
+ public:
+  Channel() = default;
+
+  //! Construct a channel of at least the given capacity (rounded up).
+  Channel(const std::string& /* label */, const size_t capacity)
+      : m_state(std::make_shared<state_type>(capacity)) {}
+
+  //! The rounded-up fixed capacity.
+  size_t capacity() const { return m_state ? m_state->mask + 1 : 0; }
+
+  //! Snapshot of the item count; racy by nature, use only as a gauge.
+  size_t size() const {
+    if (!m_state) return 0;
+    const uint64_t head = m_state->push_cursor.load(std::memory_order_relaxed);
+    const uint64_t tail = m_state->pop_cursor.load(std::memory_order_relaxed);
+    return head < tail ? 0 : head - tail;
+  }
+
+  /** \brief  Attempt to enqueue; returns false when the channel is
+   *          full.  Never blocks.
+   */
+  bool try_push(const value_type& value) const {
+    state_type& s = *m_state;
+    uint64_t pos  = s.push_cursor.load(std::memory_order_relaxed);
+    for (;;) {
+      typename state_type::Slot& slot = s.slots[pos & s.mask];
+      const uint64_t seq = slot.sequence.load(std::memory_order_acquire);
+      if (seq == pos) {
+        if (s.push_cursor.compare_exchange_weak(pos, pos + 1,
+                                                std::memory_order_relaxed)) {
+          slot.value = value;
+          slot.sequence.store(pos + 1, std::memory_order_release);
+          s.item_events.fetch_add(1, std::memory_order_release);
+          Impl::channel_wake(&s.item_events);
+          return true;
+        }
+      } else if (seq < pos) {
+        return false;  // the slot still holds an unconsumed item
+      } else {
+        pos = s.push_cursor.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /** \brief  Attempt to dequeue into value; returns false when the
+   *          channel is empty.  Never blocks.
+   */
+  bool try_pop(value_type& value) const {
+    state_type& s = *m_state;
+    uint64_t pos  = s.pop_cursor.load(std::memory_order_relaxed);
+    for (;;) {
+      typename state_type::Slot& slot = s.slots[pos & s.mask];
+      const uint64_t seq = slot.sequence.load(std::memory_order_acquire);
+      if (seq == pos + 1) {
+        if (s.pop_cursor.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed)) {
+          value = slot.value;
+          slot.sequence.store(pos + s.mask + 1, std::memory_order_release);
+          s.space_events.fetch_add(1, std::memory_order_release);
+          Impl::channel_wake(&s.space_events);
+          return true;
+        }
+      } else if (seq < pos + 1) {
+        return false;  // no producer has filled this slot yet
+      } else {
+        pos = s.pop_cursor.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /** \brief  Enqueue, blocking while the channel is full.
+   *
+   *  Spins briefly, then sleeps until a consumer frees a slot.
+   */
+  void push(const value_type& value) const {
+    state_type& s = *m_state;
+    for (;;) {
+      for (int spin = 0; spin < spin_limit; ++spin) {
+        if (try_push(value)) return;
+      }
+      const uint32_t observed =
+          s.space_events.load(std::memory_order_acquire);
+      if (try_push(value)) return;
+      Impl::channel_wait(&s.space_events, observed);
+    }
+  }
+
+  /** \brief  Dequeue into value, blocking while the channel is empty.
+   *
+   *  Spins briefly, then sleeps until a producer delivers an item, so
+   *  an idle consumer does not burn a core.
+   */
+  void pop(value_type& value) const {
+    state_type& s = *m_state;
+    for (;;) {
+      for (int spin = 0; spin < spin_limit; ++spin) {
+        if (try_pop(value)) return;
+      }
+      const uint32_t observed = s.item_events.load(std::memory_order_acquire);
+      if (try_pop(value)) return;
+      Impl::channel_wait(&s.item_events, observed);
+    }
+  }
+
+  /** \brief  Fence the given execution space instance, then enqueue.
+   *
+   *  The completion-callback integration point: launch asynchronously
+   *  on an instance, then hand the instance and a completion token to a
+   *  coordination thread, which calls this to publish the token only
+   *  after the instance's work has finished.
+   */
+  template <class ExecSpace>
+  void push_on_fence(const ExecSpace& exec, const value_type& value) const {
+    exec.fence();
+    push(value);
+  }
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_CHANNEL_HPP
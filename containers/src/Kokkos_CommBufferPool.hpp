@@ -0,0 +1,327 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_CommBufferPool.hpp
+/// \brief Registration-aware slab pool for communication buffers.
+///
+/// Zero-copy transports - GPUDirect RDMA, pinned-memory verbs - need
+/// the pages behind a send/receive buffer registered with the NIC
+/// driver, and registration is expensive enough that it must happen
+/// once per allocation, not once per message.  Individually allocated
+/// Views defeat that: every halo resize produces a fresh pointer to
+/// register and an old one to tear down.  CommBufferPool carves
+/// buffers out of large slabs instead.  Each slab is allocated once in
+/// the pool's memory space and handed to a user-supplied registration
+/// hook; buffers reserve capacity inside a slab, so resizing within
+/// the reservation changes only the extent - the address, and
+/// therefore the registration, is stable for the life of the buffer.
+/// The pool never returns memory until it is destroyed, when the
+/// deregistration hook runs per slab.
+///
+/// The pool is transport-agnostic: the hooks are where an MPI or verbs
+/// layer plugs in (ibv_reg_mr, cudaHostRegister, ...); without hooks it
+/// is simply a slab allocator with stable addresses.
+
+#ifndef KOKKOS_COMMBUFFERPOOL_HPP
+#define KOKKOS_COMMBUFFERPOOL_HPP
+
+#include <Kokkos_Core.hpp>
+#include <impl/Kokkos_Error.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Kokkos {
+namespace Experimental {
+
+namespace Impl {
+
+/* Shared pool state: slabs live here, so every CommBuffer keeps the
+ * state - and thus its slab and registration - alive by shared_ptr.
+ */
+template <class Space>
+struct CommBufferPoolState {
+  typedef Kokkos::View<char*, Space> slab_type;
+
+  std::string label;
+  size_t slab_bytes;
+  std::function<void(void*, size_t)> register_fn;
+  std::function<void(void*, size_t)> deregister_fn;
+  std::vector<slab_type> slabs;
+  size_t current_offset;
+  size_t used;
+  std::mutex mutex;
+
+  CommBufferPoolState(const std::string& arg_label, const size_t arg_bytes)
+      : label(arg_label),
+        slab_bytes(arg_bytes),
+        current_offset(0),
+        used(0) {}
+
+  ~CommBufferPoolState() {
+    if (deregister_fn) {
+      for (size_t i = 0; i < slabs.size(); ++i) {
+        deregister_fn(slabs[i].data(), slabs[i].extent(0));
+      }
+    }
+  }
+};
+
+}  // namespace Impl
+
+/** \brief  Buffer carved from a CommBufferPool slab: an extent that
+ *          may shrink and regrow, over an address that never moves.
+ *
+ *  view() is an unmanaged View of the current extent.  resize() within
+ *  the capacity reserved at creation only rebuilds the view - data()
+ *  is unchanged, so a registration or an address exchanged with a peer
+ *  stays valid.  Growing beyond the reservation would move the buffer
+ *  and is refused; reserve the high-water mark up front.
+ */
+template <class DataType,
+          class Space = typename Kokkos::DefaultExecutionSpace::memory_space>
+class CommBuffer {
+ public:
+  typedef Space memory_space;
+  typedef Kokkos::View<DataType*, memory_space,
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged>>
+      view_type;
+
+ private:
+  template <class>
+  friend class CommBufferPool;
+
+  std::shared_ptr<void> m_state;  // keeps the backing slab registered
+  view_type m_view;
+  size_t m_capacity;
+
+  CommBuffer(const std::shared_ptr<void>& state, DataType* const ptr,
+             const size_t count, const size_t capacity)
+      : m_state(state), m_view(ptr, count), m_capacity(capacity) {}
+
+ public:
+  CommBuffer() : m_state(), m_view(), m_capacity(0) {}
+
+  //! View of the current extent; unmanaged, usable in kernels.
+  const view_type& view() const { return m_view; }
+
+  //! The stable address; what a registration or a peer holds.
+  DataType* data() const { return m_view.data(); }
+
+  //! Current extent in entries.
+  size_t extent() const { return m_view.extent(0); }
+
+  //! Reserved entries; resize up to this never moves the buffer.
+  size_t capacity() const { return m_capacity; }
+
+  /** \brief  Change the extent within the reserved capacity; the
+   *          address is unchanged.  Throws beyond the reservation,
+   *          which would move - and invalidate - a registered address.
+   */
+  void resize(const size_t count) {
+    if (m_capacity < count) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::CommBuffer::resize beyond reserved "
+          "capacity would move a registered address; reserve the "
+          "high-water size at creation");
+    }
+    m_view = view_type(m_view.data(), count);
+  }
+};
+
+/** \brief  Pool of registration-stable communication buffers backed by
+ *          large slabs in one memory space.
+ *
+ *  \code
+ *    Kokkos::Experimental::CommBufferPool<> pool("halo", 64 << 20);
+ *    pool.set_registration(
+ *        [](void* p, size_t n) { nic_register(p, n); },
+ *        [](void* p, size_t n) { nic_deregister(p, n); });
+ *    auto send = pool.make_buffer<double>(max_halo);
+ *    ...
+ *    send.resize(halo_count);         // address unchanged
+ *    MPI_Isend(send.data(), ...);     // zero-copy, pre-registered
+ *  \endcode
+ *
+ *  Copies share the pool, View-style.  Buffer creation and the hooks
+ *  run on the host; slabs are allocated through the memory space's
+ *  ordinary allocation path.
+ */
+template <class Space = typename Kokkos::DefaultExecutionSpace::memory_space>
+class CommBufferPool {
+ public:
+  typedef Space memory_space;
+
+  enum : size_t { alignment = 256 };
+
+ private:
+  typedef Impl::CommBufferPoolState<memory_space> state_type;
+
+  std::shared_ptr<state_type> m_state;
+
+ public:
+  CommBufferPool() : m_state() {}
+
+  //! Construct a pool growing in slabs of slab_bytes each.
+  CommBufferPool(const std::string& label, const size_t slab_bytes)
+      : m_state() {
+    if (0 == slab_bytes) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::CommBufferPool requires a nonzero slab "
+          "size");
+    }
+    m_state = std::make_shared<state_type>(label, slab_bytes);
+  }
+
+  /** \brief  Install registration hooks; applied to the slabs already
+   *          allocated and to every slab allocated later.  The
+   *          deregistration hook runs per slab when the pool (and
+   *          every buffer holding it alive) is destroyed.
+   */
+  void set_registration(const std::function<void(void*, size_t)>& reg,
+                        const std::function<void(void*, size_t)>& dereg) {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    m_state->register_fn   = reg;
+    m_state->deregister_fn = dereg;
+    if (reg) {
+      for (size_t i = 0; i < m_state->slabs.size(); ++i) {
+        reg(m_state->slabs[i].data(), m_state->slabs[i].extent(0));
+      }
+    }
+  }
+
+  /** \brief  Create a buffer of 'count' entries, reserving room for
+   *          'capacity' so later resizes up to it never move the data.
+   */
+  template <class DataType>
+  CommBuffer<DataType, memory_space> make_buffer(const size_t count,
+                                                 size_t capacity = 0) {
+    if (capacity < count) capacity = count;
+    DataType* const ptr =
+        static_cast<DataType*>(acquire(capacity * sizeof(DataType)));
+    return CommBuffer<DataType, memory_space>(
+        std::static_pointer_cast<void>(m_state), ptr, count, capacity);
+  }
+
+  //! Number of slabs allocated (and registered) so far.
+  size_t slab_count() const {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    return m_state->slabs.size();
+  }
+
+  //! Bytes held - and registered - by the pool's slabs.
+  size_t registered_bytes() const {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    size_t total = 0;
+    for (size_t i = 0; i < m_state->slabs.size(); ++i) {
+      total += m_state->slabs[i].extent(0);
+    }
+    return total;
+  }
+
+  //! Bytes handed out to buffers, including alignment padding.
+  size_t used_bytes() const {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    return m_state->used;
+  }
+
+ private:
+  /* Bump-allocate from the newest slab, starting a new one when the
+   * request does not fit; oversized requests get a dedicated slab.
+   * Slab memory is never recycled while the pool lives - that is what
+   * keeps every handed-out address stable.
+   */
+  void* acquire(size_t bytes) {
+    typedef typename state_type::slab_type slab_type;
+
+    if (0 == bytes) bytes = size_t(alignment);
+    bytes = (bytes + alignment - 1) & ~(size_t(alignment) - 1);
+
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+
+    // A request larger than a slab gets a dedicated one, kept out of
+    // the bump position so the partially filled slab stays current.
+    if (m_state->slab_bytes < bytes) {
+      const slab_type dedicated = new_slab(bytes);
+      m_state->slabs.insert(m_state->slabs.end() -
+                                (m_state->slabs.empty() ? 0 : 1),
+                            dedicated);
+      m_state->used += bytes;
+      return dedicated.data();
+    }
+
+    if (m_state->slabs.empty() ||
+        m_state->slabs.back().extent(0) - m_state->current_offset < bytes) {
+      m_state->slabs.push_back(new_slab(m_state->slab_bytes));
+      m_state->current_offset = 0;
+    }
+
+    void* const ptr = m_state->slabs.back().data() + m_state->current_offset;
+    m_state->current_offset += bytes;
+    m_state->used += bytes;
+    return ptr;
+  }
+
+  //! Allocate and register one slab; caller holds the state mutex.
+  typename state_type::slab_type new_slab(const size_t slab_size) {
+    typename state_type::slab_type slab(
+        Kokkos::view_alloc(m_state->label + " [slab " +
+                               std::to_string(m_state->slabs.size()) + "]",
+                           Kokkos::WithoutInitializing),
+        slab_size);
+    if (m_state->register_fn) {
+      m_state->register_fn(slab.data(), slab_size);
+    }
+    return slab;
+  }
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_COMMBUFFERPOOL_HPP */
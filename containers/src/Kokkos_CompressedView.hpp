@@ -0,0 +1,436 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_CompressedView.hpp
+/// \brief Compressed resident storage for rarely-read host Views.
+///
+/// History and checkpoint fields often must stay resident but are read
+/// only occasionally; keeping them as plain Views buys nothing for that
+/// access pattern and costs the full footprint.  A CompressedView holds
+/// the bytes of a host View as independently compressed 64 KiB blocks
+/// and materializes spans on request: compression and decompression run
+/// block-parallel, so a whole-View round trip streams at memory-bound
+/// rates while the resident footprint shrinks by the data's
+/// compressibility.  Access is by explicit materialization through
+/// deep_copy — there is no per-element operator.
+///
+/// The codec is an in-tree byte-oriented LZ77 in the LZ4 block token
+/// format: greedy hash-chain matching within each block, so blocks
+/// decompress independently and in parallel.  Blocks that do not shrink
+/// are stored raw, bounding worst-case overhead to the block table.
+
+#ifndef KOKKOS_COMPRESSEDVIEW_HPP
+#define KOKKOS_COMPRESSEDVIEW_HPP
+
+#include <Kokkos_Core.hpp>
+
+#include <cstring>
+#include <string>
+
+namespace Kokkos {
+namespace Impl {
+
+enum : unsigned { compressed_view_block_size = 1 << 16 };
+
+/* Compress one block of at most 64 KiB into LZ4 token format:
+ * token byte (literal length : 4, match length - 4 : 4) with 255-coded
+ * length extensions, literal run, two-byte little-endian match offset.
+ * Returns the compressed size, or 0 when the block does not shrink and
+ * must be stored raw. */
+inline size_t compressed_view_compress(const unsigned char* const src,
+                                       const size_t n,
+                                       unsigned char* const dst) {
+  enum : unsigned { hash_bits = 13 };
+
+  if (n < 16) return 0;
+
+  uint16_t table[1 << hash_bits];
+  std::memset(table, 0, sizeof(table));
+
+  const size_t match_limit = n - 12;
+  size_t ip = 0, op = 0, anchor = 0;
+
+  while (ip < match_limit) {
+    uint32_t word;
+    std::memcpy(&word, src + ip, 4);
+    const uint32_t hash = (word * 2654435761u) >> (32 - hash_bits);
+    const size_t ref    = table[hash];
+    table[hash]         = uint16_t(ip);
+
+    if (ref < ip && 0 == std::memcmp(src + ref, src + ip, 4)) {
+      size_t len = 4;
+      while (ip + len < n - 5 && src[ref + len] == src[ip + len]) ++len;
+
+      size_t literals = ip - anchor;
+      if (op + literals + (literals >> 8) + (len >> 8) + 16 >= n) return 0;
+
+      unsigned char* const token = dst + op++;
+      *token = (unsigned char)((literals < 15 ? literals : 15) << 4);
+      if (literals >= 15) {
+        size_t rest = literals - 15;
+        for (; rest >= 255; rest -= 255) dst[op++] = 255;
+        dst[op++] = (unsigned char)rest;
+      }
+      std::memcpy(dst + op, src + anchor, literals);
+      op += literals;
+
+      const size_t offset = ip - ref;
+      dst[op++]           = (unsigned char)(offset & 0xff);
+      dst[op++]           = (unsigned char)(offset >> 8);
+
+      const size_t mcode = len - 4;
+      *token |= (unsigned char)(mcode < 15 ? mcode : 15);
+      if (mcode >= 15) {
+        size_t rest = mcode - 15;
+        for (; rest >= 255; rest -= 255) dst[op++] = 255;
+        dst[op++] = (unsigned char)rest;
+      }
+
+      ip += len;
+      anchor = ip;
+    } else {
+      ++ip;
+    }
+  }
+
+  const size_t literals = n - anchor;
+  if (op + literals + (literals >> 8) + 2 >= n) return 0;
+  dst[op++] = (unsigned char)((literals < 15 ? literals : 15) << 4);
+  if (literals >= 15) {
+    size_t rest = literals - 15;
+    for (; rest >= 255; rest -= 255) dst[op++] = 255;
+    dst[op++] = (unsigned char)rest;
+  }
+  std::memcpy(dst + op, src + anchor, literals);
+  op += literals;
+
+  return op < n ? op : 0;
+}
+
+/* Decompress one LZ4-format block of known uncompressed size */
+inline void compressed_view_decompress(const unsigned char* const src,
+                                       const size_t csize,
+                                       unsigned char* const dst) {
+  size_t ip = 0, op = 0;
+  while (ip < csize) {
+    const unsigned token = src[ip++];
+    size_t literals      = token >> 4;
+    if (15 == literals) {
+      unsigned byte;
+      do {
+        byte = src[ip++];
+        literals += byte;
+      } while (255 == byte);
+    }
+    std::memcpy(dst + op, src + ip, literals);
+    ip += literals;
+    op += literals;
+
+    if (ip >= csize) break;  // trailing literal run
+
+    const size_t offset = size_t(src[ip]) | (size_t(src[ip + 1]) << 8);
+    ip += 2;
+    size_t len = (token & 15) + 4;
+    if (15 == (token & 15)) {
+      unsigned byte;
+      do {
+        byte = src[ip++];
+        len += byte;
+      } while (255 == byte);
+    }
+    // Matches may self-overlap (offset < length): copy byte-wise
+    const unsigned char* match = dst + op - offset;
+    for (size_t k = 0; k < len; ++k) dst[op + k] = match[k];
+    op += len;
+  }
+}
+
+template <class BufferView, class SizeView>
+struct CompressedViewCompressBlocks {
+  const unsigned char* m_src;
+  uint64_t m_bytes;
+  BufferView m_staging;
+  SizeView m_sizes;
+
+  CompressedViewCompressBlocks(const unsigned char* const arg_src,
+                               const uint64_t arg_bytes,
+                               const BufferView& arg_staging,
+                               const SizeView& arg_sizes)
+      : m_src(arg_src),
+        m_bytes(arg_bytes),
+        m_staging(arg_staging),
+        m_sizes(arg_sizes) {}
+
+  void operator()(const int block) const {
+    const uint64_t begin = uint64_t(block) * compressed_view_block_size;
+    const uint64_t n = m_bytes - begin < compressed_view_block_size
+                           ? m_bytes - begin
+                           : compressed_view_block_size;
+    const size_t csize = compressed_view_compress(
+        m_src + begin, n,
+        m_staging.data() + uint64_t(block) * compressed_view_block_size);
+    if (csize) {
+      m_sizes(block) = csize;
+    } else {  // incompressible: stage raw
+      std::memcpy(
+          m_staging.data() + uint64_t(block) * compressed_view_block_size,
+          m_src + begin, n);
+      m_sizes(block) = n;
+    }
+  }
+};
+
+template <class BufferView, class SizeView>
+struct CompressedViewCompactBlocks {
+  BufferView m_staging;
+  BufferView m_data;
+  SizeView m_sizes;
+  SizeView m_offsets;
+
+  CompressedViewCompactBlocks(const BufferView& arg_staging,
+                              const BufferView& arg_data,
+                              const SizeView& arg_sizes,
+                              const SizeView& arg_offsets)
+      : m_staging(arg_staging),
+        m_data(arg_data),
+        m_sizes(arg_sizes),
+        m_offsets(arg_offsets) {}
+
+  void operator()(const int block) const {
+    std::memcpy(m_data.data() + m_offsets(block),
+                m_staging.data() + uint64_t(block) * compressed_view_block_size,
+                m_sizes(block));
+  }
+};
+
+template <class BufferView, class SizeView>
+struct CompressedViewDecompressBlocks {
+  BufferView m_data;
+  SizeView m_offsets;
+  unsigned char* m_dst;
+  uint64_t m_bytes;
+
+  CompressedViewDecompressBlocks(const BufferView& arg_data,
+                                 const SizeView& arg_offsets,
+                                 unsigned char* const arg_dst,
+                                 const uint64_t arg_bytes)
+      : m_data(arg_data),
+        m_offsets(arg_offsets),
+        m_dst(arg_dst),
+        m_bytes(arg_bytes) {}
+
+  void operator()(const int block) const {
+    const uint64_t begin = uint64_t(block) * compressed_view_block_size;
+    const uint64_t n = m_bytes - begin < compressed_view_block_size
+                           ? m_bytes - begin
+                           : compressed_view_block_size;
+    const uint64_t csize = m_offsets(block + 1) - m_offsets(block);
+    if (csize == n) {  // raw block
+      std::memcpy(m_dst + begin, m_data.data() + m_offsets(block), n);
+    } else {
+      compressed_view_decompress(m_data.data() + m_offsets(block), csize,
+                                 m_dst + begin);
+    }
+  }
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  A host View held as compressed blocks, materialized on
+ *          demand.
+ *
+ *  Construction compresses the bytes of a contiguous HostSpace View
+ *  block-parallel and releases no resources of the source.  The data is
+ *  recovered either with materialize(), which allocates a fresh View of
+ *  the original shape, or with deep_copy into an existing View.  There
+ *  is no element access: the trade is footprint for an explicit,
+ *  streaming decompression pass.
+ */
+template <class DataType>
+class CompressedView {
+ public:
+  typedef Kokkos::View<DataType, Kokkos::HostSpace> view_type;
+  typedef typename view_type::non_const_value_type value_type;
+  typedef Kokkos::DefaultHostExecutionSpace execution_space;
+
+ private:
+  typedef Kokkos::View<unsigned char*, Kokkos::HostSpace> buffer_type;
+  typedef Kokkos::View<uint64_t*, Kokkos::HostSpace> size_view_type;
+  typedef Kokkos::RangePolicy<execution_space> policy_type;
+
+  buffer_type m_data;
+  size_view_type m_offsets;  // nblocks + 1, exclusive scan of block sizes
+  typename view_type::array_layout m_layout;
+  uint64_t m_bytes;
+  std::string m_label;
+
+ public:
+  CompressedView() : m_data(), m_offsets(), m_layout(), m_bytes(0), m_label() {}
+
+  CompressedView(const CompressedView&) = default;
+  CompressedView& operator=(const CompressedView&) = default;
+
+  /** \brief  Compress the bytes of 'src' block-parallel. */
+  explicit CompressedView(const view_type& src)
+      : m_layout(src.layout()),
+        m_bytes(uint64_t(src.span()) * sizeof(value_type)),
+        m_label(src.label()) {
+    if (!src.span_is_contiguous()) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::CompressedView: source must be contiguous");
+    }
+
+    const int nblocks =
+        int((m_bytes + Kokkos::Impl::compressed_view_block_size - 1) /
+            Kokkos::Impl::compressed_view_block_size);
+
+    buffer_type staging(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                           "Kokkos::CompressedView::staging"),
+        uint64_t(nblocks) * Kokkos::Impl::compressed_view_block_size);
+    size_view_type sizes("Kokkos::CompressedView::sizes", nblocks);
+    m_offsets = size_view_type("Kokkos::CompressedView::offsets", nblocks + 1);
+
+    Kokkos::parallel_for(
+        "Kokkos::CompressedView::compress", policy_type(0, nblocks),
+        Kokkos::Impl::CompressedViewCompressBlocks<buffer_type,
+                                                   size_view_type>(
+            reinterpret_cast<const unsigned char*>(src.data()), m_bytes,
+            staging, sizes));
+    Kokkos::fence();
+
+    uint64_t total = 0;
+    for (int b = 0; b < nblocks; ++b) {
+      m_offsets(b) = total;
+      total += sizes(b);
+    }
+    m_offsets(nblocks) = total;
+
+    m_data = buffer_type(Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                                            "Kokkos::CompressedView::data"),
+                         total);
+
+    Kokkos::parallel_for(
+        "Kokkos::CompressedView::compact", policy_type(0, nblocks),
+        Kokkos::Impl::CompressedViewCompactBlocks<buffer_type, size_view_type>(
+            staging, m_data, sizes, m_offsets));
+    Kokkos::fence();
+  }
+
+  /** \brief  Decompress block-parallel into an existing contiguous View
+   *          of the same byte span.
+   */
+  void decompress_into(const view_type& dst) const {
+    if (!dst.span_is_contiguous() ||
+        uint64_t(dst.span()) * sizeof(value_type) != m_bytes) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::CompressedView: destination does not match "
+          "the compressed extent of \"" +
+          m_label + "\"");
+    }
+    const int nblocks = int(m_offsets.extent(0)) - 1;
+    Kokkos::parallel_for(
+        "Kokkos::CompressedView::decompress", policy_type(0, nblocks),
+        Kokkos::Impl::CompressedViewDecompressBlocks<buffer_type,
+                                                     size_view_type>(
+            m_data, m_offsets, reinterpret_cast<unsigned char*>(dst.data()),
+            m_bytes));
+    Kokkos::fence();
+  }
+
+  /** \brief  Allocate a View of the original shape and decompress into
+   *          it.
+   */
+  view_type materialize() const {
+    view_type dst(Kokkos::view_alloc(Kokkos::WithoutInitializing, m_label),
+                  m_layout);
+    decompress_into(dst);
+    return dst;
+  }
+
+  const std::string& label() const { return m_label; }
+
+  /** \brief  Uncompressed size in bytes. */
+  uint64_t extent_bytes() const { return m_bytes; }
+
+  /** \brief  Resident compressed size in bytes. */
+  uint64_t compressed_bytes() const {
+    return m_offsets.extent(0) ? m_offsets(m_offsets.extent(0) - 1) : 0;
+  }
+
+  /** \brief  Uncompressed over compressed size; 1.0 for incompressible
+   *          data.
+   */
+  double compression_ratio() const {
+    const uint64_t c = compressed_bytes();
+    return c ? double(m_bytes) / double(c) : 1.0;
+  }
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+namespace Kokkos {
+
+/** \brief  Decompress a CompressedView into a matching host View. */
+template <class DT, class... DP, class T>
+void deep_copy(const View<DT, DP...>& dst,
+               const Experimental::CompressedView<T>& src) {
+  src.decompress_into(dst);
+}
+
+/** \brief  Compress a host View, replacing the held blocks. */
+template <class T, class ST, class... SP>
+void deep_copy(Experimental::CompressedView<T>& dst,
+               const View<ST, SP...>& src) {
+  dst = Experimental::CompressedView<T>(src);
+}
+
+}  // namespace Kokkos
+
+#endif  // KOKKOS_COMPRESSEDVIEW_HPP
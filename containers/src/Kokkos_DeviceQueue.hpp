@@ -0,0 +1,253 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_DeviceQueue.hpp
+/// \brief Declaration and definition of Kokkos::Experimental::DeviceQueue.
+///
+/// A growable work-list container for building lists on device: many
+/// threads push concurrently via an atomic ticket counter, the host
+/// grows or drains between kernels.  Replaces the common View plus
+/// atomic-counter idiom and its hand-rolled overflow handling.
+
+#ifndef KOKKOS_DEVICEQUEUE_HPP
+#define KOKKOS_DEVICEQUEUE_HPP
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_DynamicView.hpp>
+#include <impl/Kokkos_Error.hpp>
+
+namespace Kokkos {
+namespace Experimental {
+
+/// \class DeviceQueue
+/// \brief Growable multi-producer work list with bulk drain.
+///
+/// \tparam T       type of the entries; must be trivially copyable.
+/// \tparam Device  device type (execution space, memory space, or
+///                 Kokkos::Device), defaults to the default execution
+///                 space.
+///
+/// Entries are stored in DynamicView chunks, so reserve() commissions
+/// new chunks without copying entries already pushed - pointers into
+/// the queue and device-side copies of the handle stay valid across
+/// growth.  push() is lock-free: a ticket from atomic_fetch_add selects
+/// the slot.  Like UnorderedMap::insert, push() past the reserved
+/// capacity fails rather than aborting; the host observes the shortfall
+/// through failed_push(), reserves, and re-runs only the producers of
+/// the failed entries - entries already in the queue are never touched.
+///
+/// pop() gives LIFO (stack) semantics for phased algorithms; it must
+/// not run concurrently with push() in the same kernel.
+///
+/// The host-side methods (reserve, drain, clear, size, failed_push)
+/// must not be called while a kernel is using the queue.
+template <typename T, typename Device = Kokkos::DefaultExecutionSpace>
+class DeviceQueue {
+ public:
+  typedef typename Device::execution_space execution_space;
+  typedef typename Device::memory_space memory_space;
+  typedef Kokkos::Device<execution_space, memory_space> device_type;
+  typedef T value_type;
+  typedef uint64_t size_type;
+
+  // As with DynamicView, entries are assumed trivially copyable;
+  // they are moved between chunks and views with plain assignment.
+
+ private:
+  typedef Kokkos::Experimental::DynamicView<T*, device_type> storage_type;
+  typedef Kokkos::View<size_type, memory_space> count_type;
+
+  storage_type m_items;
+  count_type m_count;
+  size_type m_capacity;  // host-side shadow of the reserved extent
+
+  template <class DstView>
+  struct DrainFunctor {
+    DstView dst;
+    storage_type src;
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const size_type i) const { dst(i) = src(i); }
+  };
+
+ public:
+  DeviceQueue()                   = default;
+  DeviceQueue(DeviceQueue&&)      = default;
+  DeviceQueue(const DeviceQueue&) = default;
+  DeviceQueue& operator=(DeviceQueue&&) = default;
+  DeviceQueue& operator=(const DeviceQueue&) = default;
+
+  /**\brief  Allocation constructor
+   *
+   *  \param arg_label       label for the allocations
+   *  \param min_chunk_size  growth granularity in entries (rounded up
+   *                         to a power of two)
+   *  \param max_extent      upper bound on capacity, sizes the chunk
+   *                         directory
+   *
+   *  One chunk is reserved up front so the queue is usable
+   *  immediately.
+   */
+  explicit DeviceQueue(const std::string& arg_label,
+                       const unsigned min_chunk_size,
+                       const unsigned max_extent)
+      : m_items(arg_label, min_chunk_size, max_extent),
+        m_count(Kokkos::view_alloc(arg_label + "::count")),
+        m_capacity(0) {
+    reserve(m_items.chunk_size());
+  }
+
+  //----------------------------------------
+  // Device interface
+
+  /** \brief  Append an entry; lock-free and safe from many threads.
+   *
+   *  Returns false when the queue is out of reserved capacity; the
+   *  entry is not stored but the shortfall is tallied for the host to
+   *  read via failed_push().
+   */
+  KOKKOS_INLINE_FUNCTION
+  bool push(const value_type& value) const {
+    const size_type i = Kokkos::atomic_fetch_add(&m_count(), size_type(1));
+    if (i < m_items.allocation_extent()) {
+      m_items(i) = value;
+      return true;
+    }
+    return false;
+  }
+
+  /** \brief  Remove the most recently pushed entry (LIFO).
+   *
+   *  Returns false when the queue is empty.  Must not be called
+   *  concurrently with push(), and is only valid when no push has
+   *  failed since the last clear or drain.
+   */
+  KOKKOS_INLINE_FUNCTION
+  bool pop(value_type& value) const {
+    const size_type i = Kokkos::atomic_fetch_add(&m_count(), ~size_type(0));
+    if (0 < i && i <= m_items.allocation_extent()) {
+      value = m_items(i - 1);
+      return true;
+    }
+    // Empty (or another thread's failed pop in flight): undo the ticket.
+    Kokkos::atomic_fetch_add(&m_count(), size_type(1));
+    return false;
+  }
+
+  /** \brief  Reserved capacity in entries; callable in kernels. */
+  KOKKOS_INLINE_FUNCTION
+  size_type capacity() const { return m_items.allocation_extent(); }
+
+  //----------------------------------------
+  // Host interface
+
+  /** \brief  Number of entries currently stored. */
+  size_type size() const {
+    size_type n = 0;
+    Kokkos::deep_copy(n, m_count);
+    return n < m_capacity ? n : m_capacity;
+  }
+
+  /** \brief  Number of pushes that failed for lack of capacity since
+   *          the last clear or drain.
+   */
+  size_type failed_push() const {
+    size_type n = 0;
+    Kokkos::deep_copy(n, m_count);
+    return n > m_capacity ? n - m_capacity : 0;
+  }
+
+  /** \brief  Grow the reserved capacity to at least n entries.
+   *
+   *  New chunks are commissioned with a single slab allocation;
+   *  existing entries are not moved and device-side handles remain
+   *  valid.  Shrinking below the current size is not supported.
+   */
+  void reserve(const size_type n) {
+    // Failed pushes left the ticket counter beyond the stored count;
+    // rewind it so re-run producers append right after the entries
+    // already in the queue instead of beyond a hole.
+    const size_type stored = size();
+    if (failed_push()) Kokkos::deep_copy(m_count, stored);
+    if (n <= m_capacity) return;
+    m_items.resize_bulk(n);
+    const size_type cs = m_items.chunk_size();
+    m_capacity         = ((n + cs - 1) / cs) * cs;
+  }
+
+  /** \brief  Discard all entries and any failed-push tally. */
+  void clear() {
+    Kokkos::deep_copy(m_count, size_type(0));
+  }
+
+  /** \brief  Compact all entries into a dense View and empty the queue.
+   *
+   *  \return the number of entries written to dst, starting at
+   *          dst(0).  Throws if dst is too small.
+   */
+  template <class... P>
+  size_type drain(const Kokkos::View<T*, P...>& dst) {
+    const size_type n = size();
+    if (dst.extent(0) < n) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::DeviceQueue::drain destination is smaller than the queue");
+    }
+    if (0 < n) {
+      DrainFunctor<Kokkos::View<T*, P...>> closure = {dst, m_items};
+      Kokkos::parallel_for(
+          "Kokkos::DeviceQueue::drain",
+          Kokkos::RangePolicy<execution_space, Kokkos::IndexType<size_type>>(
+              0, n),
+          closure);
+      execution_space().fence();
+    }
+    clear();
+    return n;
+  }
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_DEVICEQUEUE_HPP */
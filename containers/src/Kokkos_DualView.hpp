@@ -192,6 +192,22 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
   t_modified_flag modified_host, modified_device;
 #endif
 
+#ifndef KOKKOS_ENABLE_DEPRECATED_CODE
+ protected:
+#endif
+  // Dirty interval of the first dimension for each side, consulted by
+  // sync() to copy only the modified rows:
+  //   modified_ranges[0,1] -> host dirty [begin,end)
+  //   modified_ranges[2,3] -> device dirty [begin,end)
+  // end == 0 means no range information was recorded (sync copies the
+  // whole view), end == ~size_t(0) means the whole view is dirty.
+  typedef View<size_t[4], LayoutLeft, Kokkos::HostSpace> t_modified_ranges;
+  t_modified_ranges modified_ranges;
+#ifndef KOKKOS_ENABLE_DEPRECATED_CODE
+
+ public:
+#endif
+
   //@}
   //! \name Constructors
   //@{
@@ -204,7 +220,9 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
 #ifndef KOKKOS_ENABLE_DEPRECATED_CODE
   DualView() = default;
 #else
-  DualView() : modified_flags(t_modified_flags("DualView::modified_flags")) {
+  DualView()
+      : modified_flags(t_modified_flags("DualView::modified_flags")),
+        modified_ranges(t_modified_ranges("DualView::modified_ranges")) {
     modified_host   = t_modified_flag(modified_flags, 0);
     modified_device = t_modified_flag(modified_flags, 1);
   }
@@ -231,7 +249,8 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
       : d_view(label, n0, n1, n2, n3, n4, n5, n6, n7),
         h_view(create_mirror_view(d_view))  // without UVM, host View mirrors
         ,
-        modified_flags(t_modified_flags("DualView::modified_flags")) {
+        modified_flags(t_modified_flags("DualView::modified_flags")),
+        modified_ranges(t_modified_ranges("DualView::modified_ranges")) {
 #ifdef KOKKOS_ENABLE_DEPRECATED_CODE
     modified_host   = t_modified_flag(modified_flags, 0);
     modified_device = t_modified_flag(modified_flags, 1);
@@ -249,10 +268,16 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
         modified_host(src.modified_host),
         modified_device(src.modified_device)
 #endif
-  {
+        ,
+        modified_ranges(src.modified_ranges) {
   }
 
   //! Subview constructor
+  //
+  // The "modified" flags are shared with the parent but the dirty
+  // intervals are not: the subview has its own index space, so its
+  // dirty interval starts out empty and its sync() conservatively
+  // copies the whole subview until a ranged modify() is recorded.
   template <class SD, class S1, class S2, class S3, class Arg0, class... Args>
   DualView(const DualView<SD, S1, S2, S3>& src, const Arg0& arg0, Args... args)
       : d_view(Kokkos::subview(src.d_view, arg0, args...)),
@@ -263,7 +288,8 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
         modified_host(src.modified_host),
         modified_device(src.modified_device)
 #endif
-  {
+        ,
+        modified_ranges(t_modified_ranges("DualView::modified_ranges")) {
   }
 
   /// \brief Create DualView from existing device and host View objects.
@@ -279,7 +305,8 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
   DualView(const t_dev& d_view_, const t_host& h_view_)
       : d_view(d_view_),
         h_view(h_view_),
-        modified_flags(t_modified_flags("DualView::modified_flags")) {
+        modified_flags(t_modified_flags("DualView::modified_flags")),
+        modified_ranges(t_modified_ranges("DualView::modified_ranges")) {
     if (int(d_view.rank) != int(h_view.rank) ||
         d_view.extent(0) != h_view.extent(0) ||
         d_view.extent(1) != h_view.extent(1) ||
@@ -452,6 +479,116 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
     return dev;
   }
 
+  /// \brief Merge [begin,end) of the first dimension into the dirty
+  ///   interval of the given side (0 == host, 1 == device).
+  inline void impl_mark_range(const int side, const size_t begin,
+                              const size_t end) {
+    if (modified_ranges.data() == NULL) return;
+    const int i = side * 2;
+    if (modified_ranges(i + 1) == 0) {
+      modified_ranges(i)     = begin;
+      modified_ranges(i + 1) = end;
+    } else {
+      if (begin < modified_ranges(i)) modified_ranges(i) = begin;
+      if (modified_ranges(i + 1) < end) modified_ranges(i + 1) = end;
+    }
+  }
+
+  inline void impl_clear_ranges() {
+    if (modified_ranges.data() != NULL)
+      modified_ranges(0) = modified_ranges(1) = modified_ranges(2) =
+          modified_ranges(3) = 0;
+  }
+
+  /// \brief Pack-transfer-unpack for strided views that cross memory
+  ///   spaces, e.g. the sides of a subview'd DualView.
+  ///
+  /// A direct deep_copy of such views either moves the whole underlying
+  /// span or degenerates to element-wise traffic across the link.
+  /// Instead the source side packs into a contiguous staging view with
+  /// a kernel in its own space, one contiguous transfer moves exactly
+  /// the selected bytes, and the destination side unpacks with a kernel
+  /// in its space.
+  template <class DstType, class SrcType>
+  void impl_copy_staged(const DstType& dst, const SrcType& src) {
+    typedef Kokkos::View<typename traits::non_const_data_type,
+                         Kokkos::LayoutRight, typename SrcType::device_type>
+        src_staging_type;
+    typedef Kokkos::View<typename traits::non_const_data_type,
+                         Kokkos::LayoutRight, typename DstType::device_type>
+        dst_staging_type;
+
+    typename src_staging_type::array_layout layout;
+    for (unsigned r = 0; r < unsigned(t_dev::rank); ++r) {
+      layout.dimension[r] = src.extent(r);
+    }
+
+    src_staging_type src_stage(
+        Kokkos::view_alloc("DualView::sync_staging", WithoutInitializing),
+        layout);
+    dst_staging_type dst_stage(
+        Kokkos::view_alloc("DualView::sync_staging", WithoutInitializing),
+        layout);
+
+    deep_copy(src_stage, src);
+    deep_copy(dst_stage, src_stage);
+    deep_copy(dst, dst_stage);
+  }
+
+  /// \brief Copy src into dst, restricted to the dirty interval of the
+  ///   source side (0 == host, 1 == device) when one was recorded.
+  ///
+  /// The restricted copy is only taken when the dirty rows occupy a
+  /// contiguous span of memory: rank-1 views or LayoutRight views whose
+  /// span is contiguous.  Otherwise the whole view is copied, which is
+  /// always correct.
+  template <class DstType, class SrcType>
+  void impl_copy_modified(const DstType& dst, const SrcType& src,
+                          const int src_side) {
+    const size_t len = src.extent(0);
+    size_t begin     = 0;
+    size_t end       = len;
+    if (modified_ranges.data() != NULL &&
+        0 < modified_ranges(2 * src_side + 1)) {
+      begin = modified_ranges(2 * src_side);
+      end   = modified_ranges(2 * src_side + 1) < len
+                ? modified_ranges(2 * src_side + 1)
+                : len;
+    }
+    const bool partial =
+        (begin < end) && (0 < begin || end < len) &&
+        (unsigned(t_dev::rank) == 1 ||
+         std::is_same<typename traits::array_layout,
+                      Kokkos::LayoutRight>::value) &&
+        dst.span_is_contiguous() && src.span_is_contiguous();
+    if (partial) {
+      const size_t stride = (unsigned(t_dev::rank) == 1) ? 1 : src.stride_0();
+      typedef Kokkos::View<typename DstType::value_type*, Kokkos::LayoutRight,
+                           typename DstType::device_type, MemoryUnmanaged>
+          dst_flat_type;
+      typedef Kokkos::View<typename SrcType::value_type*, Kokkos::LayoutRight,
+                           typename SrcType::device_type, MemoryUnmanaged>
+          src_flat_type;
+      deep_copy(
+          dst_flat_type(dst.data() + begin * stride, (end - begin) * stride),
+          src_flat_type(src.data() + begin * stride, (end - begin) * stride));
+    } else {
+      // Strided or sub-span sides crossing memory spaces go through
+      // contiguous staging so the link moves the selected bytes, not
+      // the underlying span.
+      enum {
+        cross_space = !std::is_same<typename DstType::memory_space,
+                                    typename SrcType::memory_space>::value
+      };
+      if (cross_space &&
+          !(dst.span_is_contiguous() && src.span_is_contiguous())) {
+        impl_copy_staged(dst, src);
+      } else {
+        deep_copy(dst, src);
+      }
+    }
+  }
+
   /// \brief Update data on device or host only if data in the other
   ///   space has been marked as modified.
   ///
@@ -481,14 +618,16 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
 
     if (dev == 1) {  // if Device is the same as DualView's device type
       if ((modified_flags(0) > 0) && (modified_flags(0) >= modified_flags(1))) {
-        deep_copy(d_view, h_view);
+        impl_copy_modified(d_view, h_view, 0);
         modified_flags(0) = modified_flags(1) = 0;
+        impl_clear_ranges();
       }
     }
     if (dev == 0) {  // hopefully Device is the same as DualView's host type
       if ((modified_flags(1) > 0) && (modified_flags(1) >= modified_flags(0))) {
-        deep_copy(h_view, d_view);
+        impl_copy_modified(h_view, d_view, 1);
         modified_flags(0) = modified_flags(1) = 0;
+        impl_clear_ranges();
       }
     }
     if (std::is_same<typename t_host::memory_space,
@@ -529,8 +668,9 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
           "Calling sync_host on a DualView with a const datatype.");
     if (modified_flags.data() == NULL) return;
     if (modified_flags(1) > modified_flags(0)) {
-      deep_copy(h_view, d_view);
+      impl_copy_modified(h_view, d_view, 1);
       modified_flags(1) = modified_flags(0) = 0;
+      impl_clear_ranges();
     }
   }
 
@@ -541,8 +681,9 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
           "Calling sync_device on a DualView with a const datatype.");
     if (modified_flags.data() == NULL) return;
     if (modified_flags(0) > modified_flags(1)) {
-      deep_copy(d_view, h_view);
+      impl_copy_modified(d_view, h_view, 0);
       modified_flags(1) = modified_flags(0) = 0;
+      impl_clear_ranges();
     }
   }
 
@@ -590,6 +731,7 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
           (modified_flags(1) > modified_flags(0) ? modified_flags(1)
                                                  : modified_flags(0)) +
           1;
+      impl_mark_range(1, 0, ~size_t(0));
     }
     if (dev == 0) {  // hopefully Device is the same as DualView's host type
       // Increment the host's modified count.
@@ -597,6 +739,7 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
           (modified_flags(1) > modified_flags(0) ? modified_flags(1)
                                                  : modified_flags(0)) +
           1;
+      impl_mark_range(0, 0, ~size_t(0));
     }
 
 #ifdef KOKKOS_ENABLE_DEBUG_DUALVIEW_MODIFY_CHECK
@@ -617,6 +760,7 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
           (modified_flags(1) > modified_flags(0) ? modified_flags(1)
                                                  : modified_flags(0)) +
           1;
+      impl_mark_range(0, 0, ~size_t(0));
 #ifdef KOKKOS_ENABLE_DEBUG_DUALVIEW_MODIFY_CHECK
       if (modified_flags(0) && modified_flags(1)) {
         std::string msg = "Kokkos::DualView::modify_host ERROR: ";
@@ -636,6 +780,7 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
           (modified_flags(1) > modified_flags(0) ? modified_flags(1)
                                                  : modified_flags(0)) +
           1;
+      impl_mark_range(1, 0, ~size_t(0));
 #ifdef KOKKOS_ENABLE_DEBUG_DUALVIEW_MODIFY_CHECK
       if (modified_flags(0) && modified_flags(1)) {
         std::string msg = "Kokkos::DualView::modify_device ERROR: ";
@@ -649,9 +794,70 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
     }
   }
 
+  /// \brief Mark only [begin,end) of the first dimension as modified on
+  ///   the given device \c Device.
+  ///
+  /// Like modify(), but records a dirty interval so that the next
+  /// sync() in the other direction copies only the modified rows
+  /// instead of the whole view.  Repeated calls before a sync()
+  /// coalesce into one covering interval.  An empty range is a no-op.
+  template <class Device>
+  void modify(const size_t begin, const size_t end) {
+    if (begin >= end) return;
+    if (modified_flags.data() == NULL) return;
+    const int dev = get_device_side<Device>();
+    if (dev == 1 || dev == 0) {
+      // modify() records a whole-view interval; restore the prior
+      // interval and merge [begin,end) into it instead.
+      const size_t prior_begin =
+          modified_ranges.data() != NULL ? modified_ranges(2 * dev) : 0;
+      const size_t prior_end =
+          modified_ranges.data() != NULL ? modified_ranges(2 * dev + 1) : 0;
+      modify<Device>();
+      if (modified_ranges.data() != NULL) {
+        modified_ranges(2 * dev)     = prior_begin;
+        modified_ranges(2 * dev + 1) = prior_end;
+        impl_mark_range(dev, begin, end);
+      }
+    } else {
+      modify<Device>();
+    }
+  }
+
+  //! Mark only [begin,end) of the first dimension as modified on the host.
+  inline void modify_host(const size_t begin, const size_t end) {
+    if (begin >= end) return;
+    const size_t prior_begin =
+        modified_ranges.data() != NULL ? modified_ranges(0) : 0;
+    const size_t prior_end =
+        modified_ranges.data() != NULL ? modified_ranges(1) : 0;
+    modify_host();
+    if (modified_flags.data() != NULL && modified_ranges.data() != NULL) {
+      modified_ranges(0) = prior_begin;
+      modified_ranges(1) = prior_end;
+      impl_mark_range(0, begin, end);
+    }
+  }
+
+  //! Mark only [begin,end) of the first dimension as modified on the device.
+  inline void modify_device(const size_t begin, const size_t end) {
+    if (begin >= end) return;
+    const size_t prior_begin =
+        modified_ranges.data() != NULL ? modified_ranges(2) : 0;
+    const size_t prior_end =
+        modified_ranges.data() != NULL ? modified_ranges(3) : 0;
+    modify_device();
+    if (modified_flags.data() != NULL && modified_ranges.data() != NULL) {
+      modified_ranges(2) = prior_begin;
+      modified_ranges(3) = prior_end;
+      impl_mark_range(1, begin, end);
+    }
+  }
+
   inline void clear_sync_state() {
     if (modified_flags.data() != NULL)
       modified_flags(1) = modified_flags(0) = 0;
+    impl_clear_ranges();
   }
 
   //@}
@@ -679,6 +885,10 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
       modified_flags = t_modified_flags("DualView::modified_flags");
     } else
       modified_flags(1) = modified_flags(0) = 0;
+    if (modified_ranges.data() == NULL) {
+      modified_ranges = t_modified_ranges("DualView::modified_ranges");
+    } else
+      impl_clear_ranges();
   }
 
   /// \brief Resize both views, copying old contents into new if necessary.
@@ -696,6 +906,11 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
     if (modified_flags.data() == NULL) {
       modified_flags = t_modified_flags("DualView::modified_flags");
     }
+    if (modified_ranges.data() == NULL) {
+      modified_ranges = t_modified_ranges("DualView::modified_ranges");
+    }
+    /* The old dirty intervals refer to the old extents */
+    impl_clear_ranges();
     if (modified_flags(1) >= modified_flags(0)) {
       /* Resize on Device */
       ::Kokkos::resize(d_view, n0, n1, n2, n3, n4, n5, n6, n7);
@@ -703,6 +918,7 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
 
       /* Mark Device copy as modified */
       modified_flags(1) = modified_flags(1) + 1;
+      impl_mark_range(1, 0, ~size_t(0));
 
     } else {
       /* Realloc on Device */
@@ -728,6 +944,7 @@ class DualView : public ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> {
 
       /* Mark Host copy as modified */
       modified_flags(0) = modified_flags(0) + 1;
+      impl_mark_range(0, 0, ~size_t(0));
     }
   }
 
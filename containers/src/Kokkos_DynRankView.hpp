@@ -456,10 +456,13 @@ class DynRankView : public ViewTraits<DataType, Properties...> {
       typename drvtraits::device_type, typename drvtraits::memory_traits>
       non_const_type;
 
-  /** \brief  Compatible HostMirror view */
+  /** \brief  Compatible HostMirror view; access-pattern memory traits
+   *          (RandomAccess, Restrict) propagate onto the mirror */
   typedef DynRankView<typename drvtraits::non_const_data_type,
                       typename drvtraits::array_layout,
-                      typename drvtraits::host_mirror_space>
+                      typename drvtraits::host_mirror_space,
+                      typename Kokkos::Impl::HostMirrorMemoryTraits<
+                          typename drvtraits::memory_traits>::type>
       HostMirror;
 
   //----------------------------------------
@@ -614,6 +617,10 @@ class DynRankView : public ViewTraits<DataType, Properties...> {
   impl_map() const {
     return m_map;
   }
+  KOKKOS_INLINE_FUNCTION
+  const Kokkos::Impl::SharedAllocationTracker& impl_track() const {
+    return m_track;
+  }
 
   //----------------------------------------
 
@@ -708,11 +715,18 @@ class DynRankView : public ViewTraits<DataType, Properties...> {
     const size_t dim_scalar = m_map.dimension_scalar();
     const size_t bytes      = this->span() / dim_scalar;
 
+    // Trait booleans are not flag bits: compose the flags explicitly so
+    // RandomAccess / Atomic survive onto the wrapping view
     typedef Kokkos::View<
         DataType*, typename traits::array_layout, typename traits::device_type,
-        Kokkos::MemoryTraits<traits::memory_traits::is_unmanaged |
-                             traits::memory_traits::is_random_access |
-                             traits::memory_traits::is_atomic> >
+        Kokkos::MemoryTraits<
+            (traits::memory_traits::is_unmanaged ? unsigned(Kokkos::Unmanaged)
+                                                 : 0u) |
+            (traits::memory_traits::is_random_access
+                 ? unsigned(Kokkos::RandomAccess)
+                 : 0u) |
+            (traits::memory_traits::is_atomic ? unsigned(Kokkos::Atomic)
+                                              : 0u)> >
         tmp_view_type;
     tmp_view_type rankone_view(this->data(), bytes, dim_scalar);
     return rankone_view(i0);
@@ -1457,6 +1471,65 @@ KOKKOS_INLINE_FUNCTION constexpr unsigned rank(
 }  // needed for transition to common constexpr method in view and dynrankview
    // to return rank
 
+//----------------------------------------------------------------------------
+// Static-rank cast
+
+namespace Impl {
+
+// Prepend N runtime dimensions to a scalar type:
+// RankDataType<double,2>::type is double**
+template <typename T, unsigned N>
+struct RankDataType {
+  typedef typename RankDataType<T*, N - 1>::type type;
+};
+
+template <typename T>
+struct RankDataType<T, 0u> {
+  typedef T type;
+};
+
+}  // namespace Impl
+
+/* \brief Zero-copy rank-asserting cast of a DynRankView to a static-rank View
+ *
+ * Aborts if the runtime rank is not N.  The returned View shares the
+ * allocation tracker of the DynRankView, so the allocation stays alive as
+ * long as either handle does, and element access compiles exactly as for
+ * a View created with rank N - without any runtime-rank handling.  Use it
+ * at call sites that receive a DynRankView but know the rank, before
+ * entering hot loops.
+ *
+ * For LayoutLeft and LayoutRight the View map is rebuilt from the extents,
+ * which requires the allocation to be unpadded; padded allocations abort.
+ * LayoutStride carries its strides and has no such restriction.
+ */
+template <unsigned N, typename D, class... P>
+KOKKOS_INLINE_FUNCTION View<typename Impl::RankDataType<D, N>::type, P...>
+to_static_rank(const DynRankView<D, P...>& drv) {
+  typedef View<typename Impl::RankDataType<D, N>::type, P...> dst_type;
+  typedef Kokkos::Impl::ViewMapping<typename dst_type::traits,
+                                    typename dst_type::traits::specialize>
+      dst_map_type;
+
+  if (drv.rank() != N) {
+    Kokkos::abort(
+        "Kokkos::to_static_rank ERROR: DynRankView runtime rank does not "
+        "match the requested static rank");
+  }
+  if (!std::is_same<typename dst_type::traits::array_layout,
+                    Kokkos::LayoutStride>::value &&
+      !drv.impl_map().span_is_contiguous()) {
+    Kokkos::abort(
+        "Kokkos::to_static_rank ERROR: cannot reconstruct the map of a "
+        "padded DynRankView allocation");
+  }
+
+  const dst_map_type map(
+      Kokkos::Impl::ViewCtorProp<typename dst_type::pointer_type>(drv.data()),
+      drv.layout());
+  return dst_type(drv.impl_track(), map);
+}
+
 //----------------------------------------------------------------------------
 // Subview mapping.
 // Deduce destination view type from source view traits and subview arguments
@@ -313,18 +313,32 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
     // *m_chunks[m_chunk_max] stores the current number of chunks being used
     uintptr_t* const pc = reinterpret_cast<uintptr_t*>(m_chunks + m_chunk_max);
 
+    // Slab bookkeeping slots follow the two counters; see the
+    // allocation constructor for the directory layout.
+    uintptr_t* const slab = reinterpret_cast<uintptr_t*>(m_chunks + m_chunk_max + 2);
+
     if (*pc < NC) {
       while (*pc < NC) {
         m_chunks[*pc] = reinterpret_cast<value_pointer_type>(
             typename traits::memory_space().allocate(sizeof(local_value_type)
                                                      << m_chunk_shift));
+        slab[*pc] = 0;
         ++*pc;
       }
     } else {
       while (NC + 1 <= *pc) {
         --*pc;
-        typename traits::memory_space().deallocate(
-            m_chunks[*pc], sizeof(local_value_type) << m_chunk_shift);
+        if (slab[*pc] == 0) {
+          typename traits::memory_space().deallocate(
+              m_chunks[*pc], sizeof(local_value_type) << m_chunk_shift);
+        } else if (slab[*pc] != ~uintptr_t(0)) {
+          // First chunk of a slab: release the whole slab allocation.
+          // The interior chunks above it have already been retired.
+          typename traits::memory_space().deallocate(
+              m_chunks[*pc],
+              (sizeof(local_value_type) << m_chunk_shift) * slab[*pc]);
+        }
+        slab[*pc]     = 0;
         m_chunks[*pc] = 0;
       }
     }
@@ -332,6 +346,69 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
     *(pc + 1) = n;
   }
 
+  //----------------------------------------
+  /** \brief  Grow the array with a single slab allocation covering all
+   *          newly needed chunks, published by one update of the chunk
+   *          counter.
+   *
+   *  resize_serial commissions chunks one at a time, which for a large
+   *  growth step costs one allocator round trip per chunk.  This path
+   *  makes one allocation for all new chunks, points the directory
+   *  entries into it, and then makes the chunks visible with a single
+   *  release store of the chunk counter.  Shrinking falls back to
+   *  resize_serial, which retires chunks (and slabs) one by one.
+   * */
+  template <typename IntType>
+  inline typename std::enable_if<
+      std::is_integral<IntType>::value &&
+      Kokkos::Impl::MemorySpaceAccess<
+          Kokkos::HostSpace,
+          typename Impl::ChunkArraySpace<
+              typename traits::memory_space>::memory_space>::accessible>::type
+  resize_bulk(IntType const& n) {
+    typedef typename traits::value_type local_value_type;
+    typedef local_value_type* value_pointer_type;
+
+    const uintptr_t NC =
+        (n + m_chunk_mask) >>
+        m_chunk_shift;  // New total number of chunks needed for resize
+
+    if (m_chunk_max < NC) {
+      Kokkos::abort("DynamicView::resize_bulk exceeded maximum size");
+    }
+
+    uintptr_t* const pc = reinterpret_cast<uintptr_t*>(m_chunks + m_chunk_max);
+
+    if (NC <= *pc) {
+      resize_serial(n);
+      return;
+    }
+
+    uintptr_t* const slab = reinterpret_cast<uintptr_t*>(m_chunks + m_chunk_max + 2);
+
+    const uintptr_t base = *pc;
+    const uintptr_t num  = NC - base;
+
+    value_pointer_type const p = reinterpret_cast<value_pointer_type>(
+        typename traits::memory_space().allocate(
+            (sizeof(local_value_type) << m_chunk_shift) * num));
+
+    for (uintptr_t i = 0; i < num; ++i) {
+      m_chunks[base + i] = p + (i << m_chunk_shift);
+      // The first chunk of a slab records the slab's length in chunks,
+      // interior chunks are marked so they are not freed individually.
+      slab[base + i] = (i == 0) ? num : ~uintptr_t(0);
+    }
+
+    Kokkos::memory_fence();
+
+    // Single publication of all new chunks
+    *reinterpret_cast<uintptr_t volatile*>(pc) = NC;
+
+    // *m_chunks[m_chunk_max+1] stores the 'extent' requested by resize
+    *(pc + 1) = n;
+  }
+
   //----------------------------------------------------------------------
 
   ~DynamicView()                  = default;
@@ -364,12 +441,24 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
     unsigned m_chunk_size;
 
     // Initialize or destroy array of chunk pointers.
-    // Two entries beyond the max chunks are allocation counters.
+    // Two entries beyond the max chunks are allocation counters,
+    // followed by one slab-length entry per chunk (see resize_bulk).
     inline void operator()(unsigned i) const {
       if (m_destroy && i < m_chunk_max && 0 != m_chunks[i]) {
-        typename traits::memory_space().deallocate(m_chunks[i], m_chunk_size);
+        uintptr_t* const slab =
+            reinterpret_cast<uintptr_t*>(m_chunks + m_chunk_max + 2);
+        if (slab[i] == 0) {
+          typename traits::memory_space().deallocate(m_chunks[i], m_chunk_size);
+        } else if (slab[i] != ~uintptr_t(0)) {
+          // First chunk of a slab owns the whole slab allocation;
+          // interior slab chunks are freed with their first chunk.
+          typename traits::memory_space().deallocate(
+              m_chunks[i], slab[i] * size_t(m_chunk_size));
+        }
       }
-      m_chunks[i] = 0;
+      // Do not clear the slab bookkeeping entries while chunks are being
+      // destroyed in parallel: the destroy pass above reads them.
+      if (!(m_destroy && m_chunk_max + 2 <= i)) m_chunks[i] = 0;
     }
 
     void execute(bool arg_destroy) {
@@ -381,8 +470,10 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
 
       Kokkos::Impl::ParallelFor<Destroy, Range> closure(
           *this,
-          Range(0, m_chunk_max + 2));  // Add 2 to 'destroy' extra slots storing
-                                       // num_chunks and extent; previously + 1
+          Range(0, 2 * m_chunk_max + 2));  // Add 2 for the extra slots storing
+                                           // num_chunks and extent, and
+                                           // m_chunk_max more for the slab
+                                           // bookkeeping entries
 
       closure.execute();
 
@@ -441,10 +532,11 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
     // Allocate chunk pointers and allocation counter
     record_type* const record =
         record_type::allocate(chunk_array_memory_space(), arg_label,
-                              (sizeof(pointer_type) * (m_chunk_max + 2)));
+                              (sizeof(pointer_type) * (2 * m_chunk_max + 2)));
     // Allocate + 2 extra slots so that *m_chunk[m_chunk_max] ==
-    // num_chunks_alloc and *m_chunk[m_chunk_max+1] == extent This must match in
-    // Destroy's execute(...) method
+    // num_chunks_alloc and *m_chunk[m_chunk_max+1] == extent, followed by
+    // m_chunk_max slab bookkeeping slots used by resize_bulk.  This must
+    // match in Destroy's execute(...) method
 
     m_chunks = reinterpret_cast<pointer_type*>(record->data());
 
@@ -73,6 +73,8 @@ class ErrorReporter {
 
   int getNumReportAttempts();
 
+  int getNumOverflows();
+
   void getReports(std::vector<int> &reporters_out,
                   std::vector<report_type> &reports_out);
   void getReports(
@@ -82,6 +84,17 @@ class ErrorReporter {
       typename Kokkos::View<report_type *,
                             typename DeviceType::execution_space>::HostMirror
           &reports_out);
+  // Asynchronous variant: the bulk copies are enqueued on the given
+  // execution space instance without fencing it; the caller must fence the
+  // instance before reading the output views.
+  void getReports(
+      const execution_space &space,
+      typename Kokkos::View<int *,
+                            typename DeviceType::execution_space>::HostMirror
+          &reporters_out,
+      typename Kokkos::View<report_type *,
+                            typename DeviceType::execution_space>::HostMirror
+          &reports_out);
 
   void clear();
 
@@ -89,6 +102,16 @@ class ErrorReporter {
 
   bool full() { return (getNumReportAttempts() >= getCapacity()); }
 
+  // Number of reports that were attempted after the buffer filled up,
+  // queryable from inside a kernel so work items can react to overflow
+  // without a round trip to the host.
+  KOKKOS_INLINE_FUNCTION
+  int overflow_count() const {
+    const int attempts = m_numReportsAttempted();
+    const int capacity = static_cast<int>(m_reports.d_view.extent(0));
+    return attempts > capacity ? attempts - capacity : 0;
+  }
+
   KOKKOS_INLINE_FUNCTION
   bool add_report(int reporter_id, report_type report) const {
     int idx = Kokkos::atomic_fetch_add(&m_numReportsAttempted(), 1);
@@ -110,6 +133,18 @@ class ErrorReporter {
   Kokkos::View<int, execution_space> m_numReportsAttempted;
   reports_dualview_t m_reports;
   Kokkos::DualView<int *, execution_space> m_reporters;
+
+  // Copy only the filled prefix of the report buffers to the host rather
+  // than syncing the full DualViews.
+  void syncReports(int num_reports) {
+    if (m_reports.h_view.data() != m_reports.d_view.data()) {
+      auto range = std::make_pair(0, num_reports);
+      Kokkos::deep_copy(Kokkos::subview(m_reports.h_view, range),
+                        Kokkos::subview(m_reports.d_view, range));
+      Kokkos::deep_copy(Kokkos::subview(m_reporters.h_view, range),
+                        Kokkos::subview(m_reporters.d_view, range));
+    }
+  }
 };
 
 template <typename ReportType, typename DeviceType>
@@ -129,6 +164,13 @@ inline int ErrorReporter<ReportType, DeviceType>::getNumReportAttempts() {
   return num_reports;
 }
 
+template <typename ReportType, typename DeviceType>
+inline int ErrorReporter<ReportType, DeviceType>::getNumOverflows() {
+  int num_attempts = getNumReportAttempts();
+  int capacity     = getCapacity();
+  return num_attempts > capacity ? num_attempts - capacity : 0;
+}
+
 template <typename ReportType, typename DeviceType>
 void ErrorReporter<ReportType, DeviceType>::getReports(
     std::vector<int> &reporters_out, std::vector<report_type> &reports_out) {
@@ -139,8 +181,7 @@ void ErrorReporter<ReportType, DeviceType>::getReports(
   reports_out.reserve(num_reports);
 
   if (num_reports > 0) {
-    m_reports.template sync<host_mirror_space>();
-    m_reporters.template sync<host_mirror_space>();
+    syncReports(num_reports);
 
     for (int i = 0; i < num_reports; ++i) {
       reporters_out.push_back(m_reporters.h_view(i));
@@ -165,8 +206,7 @@ void ErrorReporter<ReportType, DeviceType>::getReports(
           "ErrorReport::reports_out", num_reports);
 
   if (num_reports > 0) {
-    m_reports.template sync<host_mirror_space>();
-    m_reporters.template sync<host_mirror_space>();
+    syncReports(num_reports);
 
     for (int i = 0; i < num_reports; ++i) {
       reporters_out(i) = m_reporters.h_view(i);
@@ -175,6 +215,34 @@ void ErrorReporter<ReportType, DeviceType>::getReports(
   }
 }
 
+template <typename ReportType, typename DeviceType>
+void ErrorReporter<ReportType, DeviceType>::getReports(
+    const execution_space &space,
+    typename Kokkos::View<
+        int *, typename DeviceType::execution_space>::HostMirror &reporters_out,
+    typename Kokkos::View<report_type *,
+                          typename DeviceType::execution_space>::HostMirror
+        &reports_out) {
+  int num_reports = getNumReports();
+  reporters_out =
+      typename Kokkos::View<int *, typename DeviceType::execution_space>::
+          HostMirror(Kokkos::ViewAllocateWithoutInitializing(
+                         "ErrorReport::reporters_out"),
+                     num_reports);
+  reports_out = typename Kokkos::
+      View<report_type *, typename DeviceType::execution_space>::HostMirror(
+          Kokkos::ViewAllocateWithoutInitializing("ErrorReport::reports_out"),
+          num_reports);
+
+  if (num_reports > 0) {
+    auto range = std::make_pair(0, num_reports);
+    Kokkos::deep_copy(space, reporters_out,
+                      Kokkos::subview(m_reporters.d_view, range));
+    Kokkos::deep_copy(space, reports_out,
+                      Kokkos::subview(m_reports.d_view, range));
+  }
+}
+
 template <typename ReportType, typename DeviceType>
 void ErrorReporter<ReportType, DeviceType>::clear() {
   int num_reports = 0;
@@ -0,0 +1,251 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_FileBackedView.hpp
+/// \brief Out-of-core windowed access to Views backed by files.
+///
+/// Post-processing field files larger than node memory force hand-rolled
+/// chunked reads, and the read for window k+1 usually stalls the compute
+/// on window k.  A FileBackedView memory-maps the file once and hands
+/// out windows as unmanaged host Views over the mapping; prefetch()
+/// pages the next window in — either through kernel readahead or by a
+/// page-touch kernel enqueued on an execution space instance — while the
+/// caller computes on the current one, and release() drops consumed
+/// windows so residency stays bounded by the pipeline depth rather than
+/// the file size.
+
+#ifndef KOKKOS_FILEBACKEDVIEW_HPP
+#define KOKKOS_FILEBACKEDVIEW_HPP
+
+#include <Kokkos_Core.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <string>
+
+namespace Kokkos {
+namespace Impl {
+
+/* Touch one byte per page with a volatile read, forcing page-in of a
+ * madvised range from inside a kernel so the fault cost lands on the
+ * prefetching instance rather than on first use. */
+struct FileBackedViewTouchPages {
+  enum : uint64_t { page = 4096 };
+
+  const volatile unsigned char* m_ptr;
+  uint64_t m_bytes;
+
+  FileBackedViewTouchPages(const unsigned char* const arg_ptr,
+                           const uint64_t arg_bytes)
+      : m_ptr(arg_ptr), m_bytes(arg_bytes) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const uint64_t i) const { (void)m_ptr[i * page]; }
+
+  uint64_t pages() const { return (m_bytes + page - 1) / page; }
+};
+
+/* Shared state of a mapping; unmapped when the last copy goes away */
+struct FileBackedViewMapping {
+  void* ptr;
+  uint64_t bytes;
+  int fd;
+
+  FileBackedViewMapping(void* const arg_ptr, const uint64_t arg_bytes,
+                        const int arg_fd)
+      : ptr(arg_ptr), bytes(arg_bytes), fd(arg_fd) {}
+
+  ~FileBackedViewMapping() {
+    munmap(ptr, bytes);
+    close(fd);
+  }
+
+  FileBackedViewMapping(const FileBackedViewMapping&) = delete;
+  FileBackedViewMapping& operator=(const FileBackedViewMapping&) = delete;
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  A read-only array of ValueType memory-mapped from a file,
+ *          accessed through unmanaged host View windows.
+ *
+ *  The mapping is advised sequential at construction.  window() returns
+ *  an unmanaged View aliasing the mapped bytes — no copy is made, pages
+ *  fault in on access.  prefetch() starts readahead for a later window;
+ *  the execution-space-instance overload additionally touches the pages
+ *  from a kernel on that instance so the faults overlap compute
+ *  elsewhere.  release() returns a consumed window's pages to the
+ *  kernel.  Copies share the mapping; the file is unmapped when the
+ *  last copy is destroyed.
+ */
+template <class ValueType>
+class FileBackedView {
+ public:
+  typedef ValueType value_type;
+  typedef Kokkos::View<const ValueType*, Kokkos::HostSpace,
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged>>
+      window_type;
+
+ private:
+  std::shared_ptr<Kokkos::Impl::FileBackedViewMapping> m_map;
+  std::string m_path;
+
+  const unsigned char* byte_ptr(const uint64_t begin) const {
+    return reinterpret_cast<const unsigned char*>(m_map->ptr) +
+           begin * sizeof(ValueType);
+  }
+
+  void require_range(const uint64_t begin, const uint64_t length,
+                     const char* const what) const {
+    if ((begin + length) * sizeof(ValueType) > m_map->bytes) {
+      Kokkos::Impl::throw_runtime_exception(
+          std::string("Kokkos::Experimental::FileBackedView::") + what +
+          ": window [" + std::to_string(begin) + "," +
+          std::to_string(begin + length) + ") exceeds \"" + m_path + "\"");
+    }
+  }
+
+ public:
+  FileBackedView() : m_map(), m_path() {}
+
+  /** \brief  Map 'path' read-only and advise sequential access. */
+  explicit FileBackedView(const std::string& path) : m_path(path) {
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::FileBackedView: cannot open \"" + path +
+          "\": " + strerror(errno));
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+      close(fd);
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::FileBackedView: cannot stat \"" + path +
+          "\": " + strerror(errno));
+    }
+
+    void* const ptr =
+        st.st_size ? mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_SHARED,
+                          fd, 0)
+                   : nullptr;
+    if (st.st_size && MAP_FAILED == ptr) {
+      close(fd);
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::FileBackedView: cannot map \"" + path +
+          "\": " + strerror(errno));
+    }
+
+    if (st.st_size) madvise(ptr, size_t(st.st_size), MADV_SEQUENTIAL);
+
+    m_map.reset(new Kokkos::Impl::FileBackedViewMapping(
+        ptr, uint64_t(st.st_size), fd));
+  }
+
+  /** \brief  Number of whole elements in the file. */
+  uint64_t size() const {
+    return m_map ? m_map->bytes / sizeof(ValueType) : 0;
+  }
+
+  const std::string& path() const { return m_path; }
+
+  /** \brief  Unmanaged View over elements [begin, begin + length). */
+  window_type window(const uint64_t begin, const uint64_t length) const {
+    require_range(begin, length, "window");
+    return window_type(
+        reinterpret_cast<const ValueType*>(byte_ptr(begin)), length);
+  }
+
+  /** \brief  Start kernel readahead for a later window; returns
+   *          immediately.
+   */
+  void prefetch(const uint64_t begin, const uint64_t length) const {
+    require_range(begin, length, "prefetch");
+    madvise(const_cast<unsigned char*>(byte_ptr(begin)),
+            length * sizeof(ValueType), MADV_WILLNEED);
+  }
+
+  /** \brief  Prefetch and additionally fault the pages in from a kernel
+   *          enqueued on 'exec', overlapping the page-in with compute on
+   *          other instances.  Asynchronous; fence 'exec' before using
+   *          the window if the fault cost must not land there.
+   */
+  template <class ExecSpace>
+  void prefetch(const ExecSpace& exec, const uint64_t begin,
+                const uint64_t length) const {
+    static_assert(Kokkos::is_execution_space<ExecSpace>::value,
+                  "Kokkos::Experimental::FileBackedView::prefetch: first "
+                  "argument must be an execution space instance");
+    prefetch(begin, length);
+    const Kokkos::Impl::FileBackedViewTouchPages touch(
+        byte_ptr(begin), length * sizeof(ValueType));
+    Kokkos::parallel_for(
+        "Kokkos::FileBackedView::prefetch",
+        Kokkos::RangePolicy<ExecSpace, Kokkos::IndexType<uint64_t>>(
+            exec, 0, touch.pages()),
+        touch);
+  }
+
+  /** \brief  Return a consumed window's pages to the kernel. */
+  void release(const uint64_t begin, const uint64_t length) const {
+    require_range(begin, length, "release");
+    madvise(const_cast<unsigned char*>(byte_ptr(begin)),
+            length * sizeof(ValueType), MADV_DONTNEED);
+  }
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_FILEBACKEDVIEW_HPP
@@ -0,0 +1,165 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+/// \file Kokkos_GatherView.hpp
+/// \brief Declaration and definition of Kokkos::Experimental::GatherView.
+///
+/// This header file declares and defines Kokkos::Experimental::GatherView
+/// and associated free functions.
+
+#ifndef KOKKOS_GATHERVIEW_HPP
+#define KOKKOS_GATHERVIEW_HPP
+
+#include <Kokkos_Core.hpp>
+
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  Read-only View adapter fusing an index indirection.
+ *
+ *  Unstructured-mesh kernels read field data through connectivity maps,
+ *  field(elem_to_node(e,n)), and the double indirection defeats the
+ *  memory-trait machinery: spelling MemoryTraits<RandomAccess> on both
+ *  Views at every kernel signature is rarely done, so the gather loads
+ *  miss the read-only path they qualify for.  GatherView composes a
+ *  data View with a rank-1 permutation View and applies the traits
+ *  once, internally: both are held as const RandomAccess Views, which
+ *  routes the loads through the texture/LDG machinery on Cuda and
+ *  gives the host compiler the non-aliasing guarantee it needs to
+ *  emit gathers for the fused access.
+ *
+ *  operator()(i, ...) yields data(map(i), ...): the map indexes the
+ *  leftmost dimension and trailing dimensions pass through.  The
+ *  adapter is read-only by construction - a gathered store would race
+ *  whenever the map repeats an index - and copies are shallow, so it
+ *  captures into device lambdas like any View.
+ */
+template <class DataViewType, class IndexViewType>
+class GatherView {
+ public:
+  typedef DataViewType data_view_type;
+  typedef IndexViewType index_view_type;
+
+  typedef Kokkos::View<typename DataViewType::traits::const_data_type,
+                       typename DataViewType::array_layout,
+                       typename DataViewType::device_type,
+                       Kokkos::MemoryRandomAccess>
+      const_data_view_type;
+
+  typedef Kokkos::View<typename IndexViewType::traits::const_data_type,
+                       typename IndexViewType::array_layout,
+                       typename IndexViewType::device_type,
+                       Kokkos::MemoryRandomAccess>
+      const_index_view_type;
+
+  typedef typename DataViewType::non_const_value_type value_type;
+  typedef typename IndexViewType::non_const_value_type index_type;
+  typedef typename DataViewType::size_type size_type;
+
+  enum { Rank = unsigned(DataViewType::Rank) };
+
+  static_assert(unsigned(IndexViewType::Rank) == 1,
+                "Kokkos::Experimental::GatherView requires a rank-1 index "
+                "View");
+  static_assert(
+      std::is_integral<typename IndexViewType::non_const_value_type>::value,
+      "Kokkos::Experimental::GatherView requires an integral index type");
+
+ private:
+  const_data_view_type m_data;
+  const_index_view_type m_map;
+
+ public:
+  GatherView() = default;
+
+  /// \brief adapt arg_data so that the leftmost dimension is read
+  /// through the permutation arg_map
+  GatherView(const DataViewType& arg_data, const IndexViewType& arg_map)
+      : m_data(arg_data), m_map(arg_map) {}
+
+  /// \brief the underlying data View with const RandomAccess traits
+  KOKKOS_INLINE_FUNCTION
+  const const_data_view_type& data_view() const noexcept { return m_data; }
+
+  /// \brief the index View with const RandomAccess traits
+  KOKKOS_INLINE_FUNCTION
+  const const_index_view_type& index_view() const noexcept { return m_map; }
+
+  /// \brief extent of the gathered dimension is the map length;
+  /// trailing extents are those of the data View
+  KOKKOS_INLINE_FUNCTION
+  size_type extent(const unsigned r) const noexcept {
+    return 0 == r ? m_map.extent(0) : m_data.extent(r);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  size_type size() const noexcept {
+    return m_map.extent(0) *
+           (m_data.extent(0) ? m_data.size() / m_data.extent(0) : 0);
+  }
+
+  template <class... Indices>
+  KOKKOS_FORCEINLINE_FUNCTION
+      typename const_data_view_type::reference_type
+      operator()(const index_type i, Indices... rest) const {
+    return m_data(m_map(i), rest...);
+  }
+};
+
+/// \brief convenience function to deduce the View types
+template <class DataType, class... DataProperties, class IndexType,
+          class... IndexProperties>
+GatherView<Kokkos::View<DataType, DataProperties...>,
+           Kokkos::View<IndexType, IndexProperties...>>
+create_gather_view(Kokkos::View<DataType, DataProperties...> const& data,
+                   Kokkos::View<IndexType, IndexProperties...> const& map) {
+  return GatherView<Kokkos::View<DataType, DataProperties...>,
+                    Kokkos::View<IndexType, IndexProperties...>>(data, map);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_GATHERVIEW_HPP
@@ -0,0 +1,246 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+/// \file Kokkos_InitTrackedView.hpp
+/// \brief Declaration and definition of Kokkos::InitTrackedView.
+///
+/// This header file declares and defines Kokkos::InitTrackedView and
+/// associated free functions.
+
+#ifndef KOKKOS_INITTRACKEDVIEW_HPP
+#define KOKKOS_INITTRACKEDVIEW_HPP
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Bitset.hpp>
+
+namespace Kokkos {
+namespace Experimental {
+
+namespace Impl {
+
+/** \brief  Proxy reference that records first-touch writes and checks
+ *          reads against the shadow bitmap.
+ *
+ *  Only compiled into the access path when
+ *  KOKKOS_ENABLE_DEBUG_BOUNDS_CHECK is defined; release builds hand out
+ *  the plain View reference.
+ */
+template <class ValueType, class BitsetType>
+class FirstTouchRef {
+ private:
+  ValueType& m_ref;
+  BitsetType m_bits;
+  unsigned m_line;
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  void check_read() const {
+    if (!m_bits.test(m_line)) {
+      Kokkos::abort(
+          "Kokkos::InitTrackedView: read of an element whose cache line was "
+          "never written after a WithoutInitializing allocation");
+    }
+  }
+
+ public:
+  KOKKOS_FORCEINLINE_FUNCTION
+  FirstTouchRef(ValueType& arg_ref, const BitsetType& arg_bits,
+                unsigned arg_line)
+      : m_ref(arg_ref), m_bits(arg_bits), m_line(arg_line) {}
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  operator ValueType() const {
+    check_read();
+    return m_ref;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  FirstTouchRef& operator=(const ValueType& val) {
+    m_bits.set(m_line);
+    m_ref = val;
+    return *this;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  FirstTouchRef& operator+=(const ValueType& val) {
+    check_read();
+    m_ref += val;
+    return *this;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  FirstTouchRef& operator-=(const ValueType& val) {
+    check_read();
+    m_ref -= val;
+    return *this;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  FirstTouchRef& operator*=(const ValueType& val) {
+    check_read();
+    m_ref *= val;
+    return *this;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  FirstTouchRef& operator/=(const ValueType& val) {
+    check_read();
+    m_ref /= val;
+    return *this;
+  }
+};
+
+}  // namespace Impl
+
+/** \brief  Shadow-bitmap wrapper for Views allocated WithoutInitializing.
+ *
+ *  Skipping the ViewValueFunctor zero-fill saves a full bandwidth pass
+ *  per allocation, but a read-before-write then returns garbage without
+ *  any diagnostic.  An InitTrackedView pairs the View with a Bitset
+ *  holding one bit per destination cache line: writes through the
+ *  wrapper mark their line, reads check it and abort with a message if
+ *  the line was never written.  The checking accessor is only compiled
+ *  when KOKKOS_ENABLE_DEBUG_BOUNDS_CHECK is defined, mirroring the
+ *  bounds-check machinery - release builds hand out the plain reference
+ *  and the wrapper costs nothing on the access path.
+ *
+ *  Tracking is per cache line, not per element: a read of an untouched
+ *  element that shares a line with a written one goes undetected.  That
+ *  keeps the shadow bitmap at 1 bit per 64 bytes and catches the
+ *  never-written-page errors that motivate avoiding WithoutInitializing.
+ *  Copies are shallow and share the bitmap.
+ */
+template <class ViewType>
+class InitTrackedView {
+ public:
+  typedef ViewType view_type;
+  typedef typename view_type::execution_space execution_space;
+  typedef typename view_type::non_const_value_type value_type;
+  typedef typename view_type::size_type size_type;
+  typedef Kokkos::Bitset<typename view_type::device_type> bitset_type;
+
+  enum {
+    elements_per_line =
+        sizeof(value_type) < 64 ? 64 / sizeof(value_type) : 1
+  };
+
+#ifdef KOKKOS_ENABLE_DEBUG_BOUNDS_CHECK
+  enum { tracking_enabled = 1 };
+  typedef Impl::FirstTouchRef<typename view_type::value_type, bitset_type>
+      reference_type;
+#else
+  enum { tracking_enabled = 0 };
+  typedef typename view_type::reference_type reference_type;
+#endif
+
+ private:
+  view_type m_view;
+  bitset_type m_touched;
+
+ public:
+  InitTrackedView() = default;
+
+  /// \brief track arg_view, which is typically allocated with
+  /// view_alloc(WithoutInitializing)
+  InitTrackedView(const view_type& arg_view)
+      : m_view(arg_view),
+        m_touched(unsigned((arg_view.span() + elements_per_line - 1) /
+                           elements_per_line)) {}
+
+  /// \brief the underlying View
+  KOKKOS_INLINE_FUNCTION
+  const view_type& view() const noexcept { return m_view; }
+
+  /// \brief number of cache lines covered by the shadow bitmap
+  unsigned tracked_lines() const { return m_touched.size(); }
+
+  /// \brief number of cache lines written at least once
+  unsigned touched_lines() const { return m_touched.count(); }
+
+  /// \brief forget all recorded writes (e.g. when recycling the buffer)
+  void reset() { m_touched.clear(); }
+
+  /// \brief throw if any tracked cache line was never written
+  ///
+  /// A no-op unless KOKKOS_ENABLE_DEBUG_BOUNDS_CHECK is defined, since
+  /// release-mode accesses bypass the bitmap; the same user code runs
+  /// unchanged in both modes.
+  void check_complete(const std::string& label) const {
+    if (!tracking_enabled) return;
+    const unsigned untouched = tracked_lines() - touched_lines();
+    if (untouched != 0) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::InitTrackedView: " + label + ": " +
+          std::to_string(untouched) + " of " + std::to_string(tracked_lines()) +
+          " cache lines were never written");
+    }
+  }
+
+#ifdef KOKKOS_ENABLE_DEBUG_BOUNDS_CHECK
+  template <class... Indices>
+  KOKKOS_FORCEINLINE_FUNCTION reference_type operator()(Indices... idx) const {
+    typename view_type::value_type& ref = m_view(idx...);
+    const unsigned line =
+        unsigned(size_type(&ref - m_view.data()) / elements_per_line);
+    return reference_type(ref, m_touched, line);
+  }
+#else
+  template <class... Indices>
+  KOKKOS_FORCEINLINE_FUNCTION reference_type operator()(Indices... idx) const {
+    return m_view(idx...);
+  }
+#endif
+};
+
+/// \brief convenience function to deduce the View type
+template <class DataType, class... Properties>
+InitTrackedView<Kokkos::View<DataType, Properties...>>
+create_init_tracked_view(Kokkos::View<DataType, Properties...> const& view) {
+  return InitTrackedView<Kokkos::View<DataType, Properties...>>(view);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_INITTRACKEDVIEW_HPP
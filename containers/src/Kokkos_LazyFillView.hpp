@@ -0,0 +1,236 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+/// \file Kokkos_LazyFillView.hpp
+/// \brief Declaration and definition of Kokkos::LazyFillView.
+///
+/// This header file declares and defines Kokkos::LazyFillView and
+/// associated free functions.
+
+#ifndef KOKKOS_LAZYFILLVIEW_HPP
+#define KOKKOS_LAZYFILLVIEW_HPP
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Bitset.hpp>
+
+namespace Kokkos {
+namespace Experimental {
+
+namespace Impl {
+
+/** \brief  Proxy reference implementing fill-on-first-write semantics.
+ *
+ *  A read of an element that was never written since the last fill()
+ *  returns the pending fill value without touching memory; a write
+ *  marks the element and stores through.
+ */
+template <class ValueType, class BitsetType>
+class LazyFillRef {
+ private:
+  ValueType& m_ref;
+  BitsetType m_bits;
+  unsigned m_index;
+  ValueType m_fill;
+
+ public:
+  KOKKOS_FORCEINLINE_FUNCTION
+  LazyFillRef(ValueType& arg_ref, const BitsetType& arg_bits,
+              unsigned arg_index, const ValueType& arg_fill)
+      : m_ref(arg_ref), m_bits(arg_bits), m_index(arg_index), m_fill(arg_fill) {}
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  operator ValueType() const {
+    return m_bits.test(m_index) ? m_ref : m_fill;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  LazyFillRef& operator=(const ValueType& val) {
+    m_bits.set(m_index);
+    m_ref = val;
+    return *this;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  LazyFillRef& operator+=(const ValueType& val) {
+    return *this = ValueType(*this) + val;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  LazyFillRef& operator-=(const ValueType& val) {
+    return *this = ValueType(*this) - val;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  LazyFillRef& operator*=(const ValueType& val) {
+    return *this = ValueType(*this) * val;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  LazyFillRef& operator/=(const ValueType& val) {
+    return *this = ValueType(*this) / val;
+  }
+};
+
+/** \brief  Writes the pending fill value into untouched elements only. */
+template <class ValueType, class BitsetType>
+struct LazyFillMaterialize {
+  ValueType* m_data;
+  BitsetType m_bits;
+  ValueType m_fill;
+
+  LazyFillMaterialize(ValueType* arg_data, const BitsetType& arg_bits,
+                      const ValueType& arg_fill)
+      : m_data(arg_data), m_bits(arg_bits), m_fill(arg_fill) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const unsigned i) const {
+    if (!m_bits.test(i)) m_data[i] = m_fill;
+  }
+};
+
+}  // namespace Impl
+
+/** \brief  Deferred-fill wrapper eliminating whole-array clears.
+ *
+ *  Kokkos::deep_copy(view, scalar) spends a full bandwidth pass through
+ *  ViewFill that the next kernel typically overwrites almost entirely.
+ *  A LazyFillView instead records the pending fill value and a shadow
+ *  bitmap with one bit per element.  Accesses through the wrapper fuse
+ *  the fill into the producing kernel: reads of never-written elements
+ *  return the fill value without touching memory, writes mark their
+ *  element and store through.  materialize() then completes the fill by
+ *  writing only the untouched elements - for a kernel that overwrites
+ *  95% of the array, 5% of the fill bandwidth remains.
+ *
+ *  fill() re-arms the wrapper with a new value by clearing the bitmap,
+ *  a bookkeeping pass of one bit per element instead of a data pass.
+ *  After materialize() the underlying View is consistent and is best
+ *  accessed directly; the wrapper's write path pays one atomic bit-set
+ *  per store, which is only worth it for the producing kernel.
+ *  Requires a contiguous span, since the fill completion indexes the
+ *  flat allocation.  Copies are shallow and share the bitmap.
+ */
+template <class ViewType>
+class LazyFillView {
+ public:
+  typedef ViewType view_type;
+  typedef typename view_type::execution_space execution_space;
+  typedef typename view_type::non_const_value_type value_type;
+  typedef typename view_type::size_type size_type;
+  typedef Kokkos::Bitset<typename view_type::device_type> bitset_type;
+  typedef Impl::LazyFillRef<typename view_type::value_type, bitset_type>
+      reference_type;
+
+ private:
+  view_type m_view;
+  bitset_type m_touched;
+  value_type m_fill;
+
+ public:
+  LazyFillView() = default;
+
+  /// \brief defer a fill of arg_view with arg_fill; the View contents
+  /// are treated as garbage until written or materialized
+  LazyFillView(const view_type& arg_view, const value_type& arg_fill)
+      : m_view(arg_view),
+        m_touched(unsigned(arg_view.span())),
+        m_fill(arg_fill) {
+    if (!arg_view.span_is_contiguous()) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::LazyFillView requires a View with contiguous span");
+    }
+  }
+
+  /// \brief the underlying View
+  KOKKOS_INLINE_FUNCTION
+  const view_type& view() const noexcept { return m_view; }
+
+  /// \brief the pending fill value
+  KOKKOS_INLINE_FUNCTION
+  value_type fill_value() const noexcept { return m_fill; }
+
+  /// \brief number of elements written since the last fill()
+  unsigned touched_count() const { return m_touched.count(); }
+
+  /// \brief re-arm with a new pending fill value; clears the bitmap
+  /// instead of the data, so the cost is one bit per element
+  void fill(const value_type& arg_fill) {
+    m_fill = arg_fill;
+    m_touched.clear();
+  }
+
+  /// \brief complete the pending fill by writing only the elements
+  /// never touched since the last fill(); fences on completion
+  void materialize() {
+    Kokkos::parallel_for(
+        "Kokkos::LazyFillView::materialize",
+        Kokkos::RangePolicy<execution_space>(0, unsigned(m_view.span())),
+        Impl::LazyFillMaterialize<value_type, bitset_type>(m_view.data(),
+                                                           m_touched, m_fill));
+    execution_space().fence();
+    m_touched.set();
+  }
+
+  template <class... Indices>
+  KOKKOS_FORCEINLINE_FUNCTION reference_type operator()(Indices... idx) const {
+    typename view_type::value_type& ref = m_view(idx...);
+    return reference_type(ref, m_touched,
+                          unsigned(size_type(&ref - m_view.data())), m_fill);
+  }
+};
+
+/// \brief convenience function to deduce the View type
+template <class DataType, class... Properties>
+LazyFillView<Kokkos::View<DataType, Properties...>> create_lazy_fill_view(
+    Kokkos::View<DataType, Properties...> const& view,
+    typename Kokkos::View<DataType, Properties...>::non_const_value_type const&
+        fill_value) {
+  return LazyFillView<Kokkos::View<DataType, Properties...>>(view, fill_value);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_LAZYFILLVIEW_HPP
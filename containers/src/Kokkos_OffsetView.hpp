@@ -219,6 +219,22 @@ class OffsetView : public ViewTraits<DataType, Properties...> {
   track_type m_track;
   map_type m_map;
   begins_type m_begins;
+  size_t m_shift;
+
+  // Linear index offset contributed by m_begins, precomputed whenever the
+  // map or the begins change.  The default-map access operators index as
+  //   m_impl_handle[ offset(i0,...,iN) - m_shift ]
+  // which addresses the same element as shifting every argument by its
+  // begin, but keeps the per-access arithmetic identical to View so that
+  // induction variables in stencil loops strength-reduce as if the begins
+  // were zero.  All arithmetic is modular in size_t, so negative begins
+  // and indices wrap consistently.
+  KOKKOS_INLINE_FUNCTION
+  void calculate_shift() {
+    m_shift = 0;
+    for (size_t r = 0; r < Rank; ++r)
+      m_shift += static_cast<size_t>(m_begins[r]) * stride(r);
+  }
 
  public:
   //----------------------------------------
@@ -434,8 +450,7 @@ class OffsetView : public ViewTraits<DataType, Properties...> {
                               reference_type>::type
       operator()(const I0& i0) const {
     KOKKOS_IMPL_OFFSETVIEW_OPERATOR_VERIFY((m_track, m_map, m_begins, i0))
-    const size_t j0 = i0 - m_begins[0];
-    return m_map.m_impl_handle[j0];
+    return m_map.m_impl_handle[static_cast<size_t>(i0) - m_shift];
   }
 
   template <typename I0>
@@ -446,8 +461,9 @@ class OffsetView : public ViewTraits<DataType, Properties...> {
                               reference_type>::type
       operator()(const I0& i0) const {
     KOKKOS_IMPL_OFFSETVIEW_OPERATOR_VERIFY((m_track, m_map, m_begins, i0))
-    const size_t j0 = i0 - m_begins[0];
-    return m_map.m_impl_handle[m_map.m_impl_offset.m_stride.S0 * j0];
+    return m_map.m_impl_handle[m_map.m_impl_offset.m_stride.S0 *
+                                   static_cast<size_t>(i0) -
+                               m_shift];
   }
   //------------------------------
   // Rank 1 operator[]
@@ -471,8 +487,7 @@ class OffsetView : public ViewTraits<DataType, Properties...> {
                               reference_type>::type
       operator[](const I0& i0) const {
     KOKKOS_IMPL_OFFSETVIEW_OPERATOR_VERIFY((m_track, m_map, m_begins, i0))
-    const size_t j0 = i0 - m_begins[0];
-    return m_map.m_impl_handle[j0];
+    return m_map.m_impl_handle[static_cast<size_t>(i0) - m_shift];
   }
 
   template <typename I0>
@@ -483,8 +498,9 @@ class OffsetView : public ViewTraits<DataType, Properties...> {
                               reference_type>::type
       operator[](const I0& i0) const {
     KOKKOS_IMPL_OFFSETVIEW_OPERATOR_VERIFY((m_track, m_map, m_begins, i0))
-    const size_t j0 = i0 - m_begins[0];
-    return m_map.m_impl_handle[m_map.m_impl_offset.m_stride.S0 * j0];
+    return m_map.m_impl_handle[m_map.m_impl_offset.m_stride.S0 *
+                                   static_cast<size_t>(i0) -
+                               m_shift];
   }
 
   //------------------------------
@@ -510,9 +526,10 @@ class OffsetView : public ViewTraits<DataType, Properties...> {
                               reference_type>::type
       operator()(const I0& i0, const I1& i1) const {
     KOKKOS_IMPL_OFFSETVIEW_OPERATOR_VERIFY((m_track, m_map, m_begins, i0, i1))
-    const size_t j0 = i0 - m_begins[0];
-    const size_t j1 = i1 - m_begins[1];
-    return m_map.m_impl_handle[j0 + m_map.m_impl_offset.m_dim.N0 * j1];
+    return m_map.m_impl_handle[static_cast<size_t>(i0) +
+                               m_map.m_impl_offset.m_dim.N0 *
+                                   static_cast<size_t>(i1) -
+                               m_shift];
   }
 
   template <typename I0, typename I1>
@@ -523,9 +540,10 @@ class OffsetView : public ViewTraits<DataType, Properties...> {
                               reference_type>::type
       operator()(const I0& i0, const I1& i1) const {
     KOKKOS_IMPL_OFFSETVIEW_OPERATOR_VERIFY((m_track, m_map, m_begins, i0, i1))
-    const size_t j0 = i0 - m_begins[0];
-    const size_t j1 = i1 - m_begins[1];
-    return m_map.m_impl_handle[j0 + m_map.m_impl_offset.m_stride * j1];
+    return m_map.m_impl_handle[static_cast<size_t>(i0) +
+                               m_map.m_impl_offset.m_stride *
+                                   static_cast<size_t>(i1) -
+                               m_shift];
   }
 
   template <typename I0, typename I1>
@@ -536,9 +554,10 @@ class OffsetView : public ViewTraits<DataType, Properties...> {
                               reference_type>::type
       operator()(const I0& i0, const I1& i1) const {
     KOKKOS_IMPL_OFFSETVIEW_OPERATOR_VERIFY((m_track, m_map, m_begins, i0, i1))
-    const size_t j0 = i0 - m_begins[0];
-    const size_t j1 = i1 - m_begins[1];
-    return m_map.m_impl_handle[j1 + m_map.m_impl_offset.m_dim.N1 * j0];
+    return m_map.m_impl_handle[static_cast<size_t>(i1) +
+                               m_map.m_impl_offset.m_dim.N1 *
+                                   static_cast<size_t>(i0) -
+                               m_shift];
   }
 
   template <typename I0, typename I1>
@@ -549,9 +568,10 @@ class OffsetView : public ViewTraits<DataType, Properties...> {
                               reference_type>::type
       operator()(const I0& i0, const I1& i1) const {
     KOKKOS_IMPL_OFFSETVIEW_OPERATOR_VERIFY((m_track, m_map, m_begins, i0, i1))
-    const size_t j0 = i0 - m_begins[0];
-    const size_t j1 = i1 - m_begins[1];
-    return m_map.m_impl_handle[j1 + m_map.m_impl_offset.m_stride * j0];
+    return m_map.m_impl_handle[static_cast<size_t>(i1) +
+                               m_map.m_impl_offset.m_stride *
+                                   static_cast<size_t>(i0) -
+                               m_shift];
   }
 
   template <typename I0, typename I1>
@@ -562,10 +582,11 @@ class OffsetView : public ViewTraits<DataType, Properties...> {
                               reference_type>::type
       operator()(const I0& i0, const I1& i1) const {
     KOKKOS_IMPL_OFFSETVIEW_OPERATOR_VERIFY((m_track, m_map, m_begins, i0, i1))
-    const size_t j0 = i0 - m_begins[0];
-    const size_t j1 = i1 - m_begins[1];
-    return m_map.m_impl_handle[j0 * m_map.m_impl_offset.m_stride.S0 +
-                               j1 * m_map.m_impl_offset.m_stride.S1];
+    return m_map.m_impl_handle[static_cast<size_t>(i0) *
+                                   m_map.m_impl_offset.m_stride.S0 +
+                               static_cast<size_t>(i1) *
+                                   m_map.m_impl_offset.m_stride.S1 -
+                               m_shift];
   }
 
   //------------------------------
@@ -579,10 +600,10 @@ class OffsetView : public ViewTraits<DataType, Properties...> {
       operator()(const I0& i0, const I1& i1, const I2& i2) const {
     KOKKOS_IMPL_OFFSETVIEW_OPERATOR_VERIFY(
         (m_track, m_map, m_begins, i0, i1, i2))
-    const size_t j0 = i0 - m_begins[0];
-    const size_t j1 = i1 - m_begins[1];
-    const size_t j2 = i2 - m_begins[2];
-    return m_map.m_impl_handle[m_map.m_impl_offset(j0, j1, j2)];
+    return m_map.m_impl_handle[m_map.m_impl_offset(static_cast<size_t>(i0),
+                                                   static_cast<size_t>(i1),
+                                                   static_cast<size_t>(i2)) -
+                               m_shift];
   }
 
   template <typename I0, typename I1, typename I2>
@@ -610,11 +631,11 @@ class OffsetView : public ViewTraits<DataType, Properties...> {
   operator()(const I0& i0, const I1& i1, const I2& i2, const I3& i3) const {
     KOKKOS_IMPL_OFFSETVIEW_OPERATOR_VERIFY(
         (m_track, m_map, m_begins, i0, i1, i2, i3))
-    const size_t j0 = i0 - m_begins[0];
-    const size_t j1 = i1 - m_begins[1];
-    const size_t j2 = i2 - m_begins[2];
-    const size_t j3 = i3 - m_begins[3];
-    return m_map.m_impl_handle[m_map.m_impl_offset(j0, j1, j2, j3)];
+    return m_map.m_impl_handle[m_map.m_impl_offset(static_cast<size_t>(i0),
+                                                   static_cast<size_t>(i1),
+                                                   static_cast<size_t>(i2),
+                                                   static_cast<size_t>(i3)) -
+                               m_shift];
   }
 
   template <typename I0, typename I1, typename I2, typename I3>
@@ -644,12 +665,12 @@ class OffsetView : public ViewTraits<DataType, Properties...> {
              const I4& i4) const {
     KOKKOS_IMPL_OFFSETVIEW_OPERATOR_VERIFY(
         (m_track, m_map, m_begins, i0, i1, i2, i3, i4))
-    const size_t j0 = i0 - m_begins[0];
-    const size_t j1 = i1 - m_begins[1];
-    const size_t j2 = i2 - m_begins[2];
-    const size_t j3 = i3 - m_begins[3];
-    const size_t j4 = i4 - m_begins[4];
-    return m_map.m_impl_handle[m_map.m_impl_offset(j0, j1, j2, j3, j4)];
+    return m_map.m_impl_handle[m_map.m_impl_offset(static_cast<size_t>(i0),
+                                                   static_cast<size_t>(i1),
+                                                   static_cast<size_t>(i2),
+                                                   static_cast<size_t>(i3),
+                                                   static_cast<size_t>(i4)) -
+                               m_shift];
   }
 
   template <typename I0, typename I1, typename I2, typename I3, typename I4>
@@ -682,13 +703,13 @@ class OffsetView : public ViewTraits<DataType, Properties...> {
              const I4& i4, const I5& i5) const {
     KOKKOS_IMPL_OFFSETVIEW_OPERATOR_VERIFY(
         (m_track, m_map, m_begins, i0, i1, i2, i3, i4, i5))
-    const size_t j0 = i0 - m_begins[0];
-    const size_t j1 = i1 - m_begins[1];
-    const size_t j2 = i2 - m_begins[2];
-    const size_t j3 = i3 - m_begins[3];
-    const size_t j4 = i4 - m_begins[4];
-    const size_t j5 = i5 - m_begins[5];
-    return m_map.m_impl_handle[m_map.m_impl_offset(j0, j1, j2, j3, j4, j5)];
+    return m_map.m_impl_handle[m_map.m_impl_offset(static_cast<size_t>(i0),
+                                                   static_cast<size_t>(i1),
+                                                   static_cast<size_t>(i2),
+                                                   static_cast<size_t>(i3),
+                                                   static_cast<size_t>(i4),
+                                                   static_cast<size_t>(i5)) -
+                               m_shift];
   }
 
   template <typename I0, typename I1, typename I2, typename I3, typename I4,
@@ -723,14 +744,14 @@ class OffsetView : public ViewTraits<DataType, Properties...> {
              const I4& i4, const I5& i5, const I6& i6) const {
     KOKKOS_IMPL_OFFSETVIEW_OPERATOR_VERIFY(
         (m_track, m_map, m_begins, i0, i1, i2, i3, i4, i5, i6))
-    const size_t j0 = i0 - m_begins[0];
-    const size_t j1 = i1 - m_begins[1];
-    const size_t j2 = i2 - m_begins[2];
-    const size_t j3 = i3 - m_begins[3];
-    const size_t j4 = i4 - m_begins[4];
-    const size_t j5 = i5 - m_begins[5];
-    const size_t j6 = i6 - m_begins[6];
-    return m_map.m_impl_handle[m_map.m_impl_offset(j0, j1, j2, j3, j4, j5, j6)];
+    return m_map.m_impl_handle[m_map.m_impl_offset(static_cast<size_t>(i0),
+                                                   static_cast<size_t>(i1),
+                                                   static_cast<size_t>(i2),
+                                                   static_cast<size_t>(i3),
+                                                   static_cast<size_t>(i4),
+                                                   static_cast<size_t>(i5),
+                                                   static_cast<size_t>(i6)) -
+                               m_shift];
   }
 
   template <typename I0, typename I1, typename I2, typename I3, typename I4,
@@ -766,16 +787,15 @@ class OffsetView : public ViewTraits<DataType, Properties...> {
              const I4& i4, const I5& i5, const I6& i6, const I7& i7) const {
     KOKKOS_IMPL_OFFSETVIEW_OPERATOR_VERIFY(
         (m_track, m_map, m_begins, i0, i1, i2, i3, i4, i5, i6, i7))
-    const size_t j0 = i0 - m_begins[0];
-    const size_t j1 = i1 - m_begins[1];
-    const size_t j2 = i2 - m_begins[2];
-    const size_t j3 = i3 - m_begins[3];
-    const size_t j4 = i4 - m_begins[4];
-    const size_t j5 = i5 - m_begins[5];
-    const size_t j6 = i6 - m_begins[6];
-    const size_t j7 = i7 - m_begins[7];
-    return m_map
-        .m_impl_handle[m_map.m_impl_offset(j0, j1, j2, j3, j4, j5, j6, j7)];
+    return m_map.m_impl_handle[m_map.m_impl_offset(static_cast<size_t>(i0),
+                                                   static_cast<size_t>(i1),
+                                                   static_cast<size_t>(i2),
+                                                   static_cast<size_t>(i3),
+                                                   static_cast<size_t>(i4),
+                                                   static_cast<size_t>(i5),
+                                                   static_cast<size_t>(i6),
+                                                   static_cast<size_t>(i7)) -
+                               m_shift];
   }
 
   template <typename I0, typename I1, typename I2, typename I3, typename I4,
@@ -808,7 +828,7 @@ class OffsetView : public ViewTraits<DataType, Properties...> {
   ~OffsetView() {}
 
   KOKKOS_INLINE_FUNCTION
-  OffsetView() : m_track(), m_map() {
+  OffsetView() : m_track(), m_map(), m_shift(0) {
     for (size_t i = 0; i < Rank; ++i) m_begins[i] = KOKKOS_INVALID_OFFSET;
   }
 
@@ -816,19 +836,22 @@ class OffsetView : public ViewTraits<DataType, Properties...> {
   OffsetView(const OffsetView& rhs)
       : m_track(rhs.m_track, traits::is_managed),
         m_map(rhs.m_map),
-        m_begins(rhs.m_begins) {}
+        m_begins(rhs.m_begins),
+        m_shift(rhs.m_shift) {}
 
   KOKKOS_INLINE_FUNCTION
   OffsetView(OffsetView&& rhs)
       : m_track(std::move(rhs.m_track)),
         m_map(std::move(rhs.m_map)),
-        m_begins(std::move(rhs.m_begins)) {}
+        m_begins(std::move(rhs.m_begins)),
+        m_shift(rhs.m_shift) {}
 
   KOKKOS_INLINE_FUNCTION
   OffsetView& operator=(const OffsetView& rhs) {
     m_track  = rhs.m_track;
     m_map    = rhs.m_map;
     m_begins = rhs.m_begins;
+    m_shift  = rhs.m_shift;
     return *this;
   }
 
@@ -837,6 +860,7 @@ class OffsetView : public ViewTraits<DataType, Properties...> {
     m_track  = std::move(rhs.m_track);
     m_map    = std::move(rhs.m_map);
     m_begins = std::move(rhs.m_begins);
+    m_shift  = rhs.m_shift;
     return *this;
   }
 
@@ -866,6 +890,7 @@ class OffsetView : public ViewTraits<DataType, Properties...> {
     for (int i = 0; i < aview.Rank; ++i) {
       m_begins[i] = 0;
     }
+    calculate_shift();
   }
 
   template <class RT, class... RP>
@@ -890,6 +915,7 @@ class OffsetView : public ViewTraits<DataType, Properties...> {
     for (size_t i = 0; i < minIndices.size(); ++i) {
       m_begins[i] = minIndices.begin()[i];
     }
+    calculate_shift();
   }
   template <class RT, class... RP>
   KOKKOS_INLINE_FUNCTION OffsetView(const View<RT, RP...>& aview,
@@ -900,6 +926,7 @@ class OffsetView : public ViewTraits<DataType, Properties...> {
     static_assert(Mapping::is_assignable,
                   "Incompatible OffsetView copy construction");
     Mapping::assign(m_map, aview.impl_map(), m_track);
+    calculate_shift();
 
     //#ifdef KOKKOS_ACTIVE_EXECUTION_MEMORY_SPACE_HOST
     //        Kokkos::Experimental::Impl::runtime_check_rank_host(traits::rank_dynamic,
@@ -923,6 +950,7 @@ class OffsetView : public ViewTraits<DataType, Properties...> {
     static_assert(Mapping::is_assignable,
                   "Incompatible OffsetView copy construction");
     Mapping::assign(m_map, rhs.m_map, rhs.m_track);  // swb what about assign?
+    calculate_shift();
   }
 
  private:
@@ -1087,6 +1115,7 @@ class OffsetView : public ViewTraits<DataType, Properties...> {
     for (size_t i = 0; i != m_begins.size(); ++i) {
       m_begins[i] = at(begins_, i);
     };
+    calculate_shift();
   }
 
  public:
@@ -1195,6 +1224,7 @@ class OffsetView : public ViewTraits<DataType, Properties...> {
     for (size_t i = 0; i < minIndices.size(); ++i) {
       m_begins[i] = minIndices.begin()[i];
     }
+    calculate_shift();
     static_assert(
         std::is_same<pointer_type, typename Kokkos::Impl::ViewCtorProp<
                                        P...>::pointer_type>::value,
@@ -1292,6 +1322,7 @@ class OffsetView : public ViewTraits<DataType, Properties...> {
                                                           Rank, minIndices);
 
 #endif
+    calculate_shift();
   }
 };
 
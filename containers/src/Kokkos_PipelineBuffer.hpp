@@ -0,0 +1,260 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_PipelineBuffer.hpp
+/// \brief Declaration and definition of Kokkos::Experimental::PipelineBuffer.
+///
+/// This header file declares and defines
+/// Kokkos::Experimental::PipelineBuffer and its related nonmember
+/// functions.
+
+#ifndef KOKKOS_PIPELINEBUFFER_HPP
+#define KOKKOS_PIPELINEBUFFER_HPP
+
+#include <Kokkos_Core.hpp>
+#include <impl/Kokkos_Error.hpp>
+
+#include <string>
+#include <vector>
+
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  Rotating host/device buffer pairs for pipelined batch
+ *          processing.
+ *
+ *  Streaming a sequence of batches through device compute with a single
+ *  DualView serializes the three phases of every batch: fill the host
+ *  buffer, copy to device and compute, copy back and drain.  A
+ *  PipelineBuffer holds several host/device buffer pairs (stages) and
+ *  rotates batches through them so that, on a backend with asynchronous
+ *  execution space instances, the upload of batch b+1 and the download
+ *  of batch b-1 overlap the compute of batch b.  Three stages give the
+ *  classic upload/compute/download triple buffering; two stages overlap
+ *  the transfers of one batch with the compute of another.
+ *
+ *  The run() method packages the whole pattern: given per-batch fill,
+ *  compute, and drain hooks it issues the copies, rotates the stages,
+ *  and fences each buffer exactly when its previous use must have
+ *  completed.  The stage accessors and the upload / download / fence
+ *  primitives are also public for codes whose pipeline does not fit the
+ *  three-hook shape.
+ *
+ *  The template arguments are the same as those of Kokkos::View; each
+ *  stage is a View of that type on the device with a host mirror.
+ */
+template <class DataType, class Arg1Type = void, class Arg2Type = void,
+          class Arg3Type = void>
+class PipelineBuffer {
+ public:
+  //! \name Typedefs for device types and various Kokkos::View specializations.
+  //@{
+  typedef ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> traits;
+
+  //! The type of a Kokkos::View on the device.
+  typedef View<typename traits::data_type, Arg1Type, Arg2Type, Arg3Type> t_dev;
+
+  /// \typedef t_host
+  /// \brief The type of a Kokkos::View host mirror of \c t_dev.
+  typedef typename t_dev::HostMirror t_host;
+
+  //! The execution space whose instances order the copies and compute.
+  typedef typename t_dev::execution_space execution_space;
+  //@}
+
+ private:
+  std::vector<t_dev> m_dev;
+  std::vector<t_host> m_host;
+  std::vector<execution_space> m_exec;
+  size_t m_head;
+
+  size_t stage_of(const size_t batch) const { return batch % m_dev.size(); }
+
+  // When device and host memory are the same space the host mirror
+  // aliases the device View and the transfer is a no-op, as in
+  // DualView::sync.
+  bool needs_copy(const size_t s) const {
+    return m_dev[s].data() != m_host[s].data();
+  }
+
+ public:
+  /// \brief Constructor allocating the stages.
+  ///
+  /// The first argument is a string label; stage s is allocated with
+  /// the label suffixed by " [s]".  The second argument is the number
+  /// of stages, at least two; three gives full upload/compute/download
+  /// overlap.  The arguments that follow are the dimensions of one
+  /// buffer, as in the analogous View constructor.
+  PipelineBuffer(const std::string& label, const size_t arg_num_stages,
+                 const size_t n0 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                 const size_t n1 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                 const size_t n2 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                 const size_t n3 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                 const size_t n4 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                 const size_t n5 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                 const size_t n6 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                 const size_t n7 = KOKKOS_IMPL_CTOR_DEFAULT_ARG)
+      : m_head(0) {
+    if (arg_num_stages < 2) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::PipelineBuffer requires at least two "
+          "stages");
+    }
+    m_dev.reserve(arg_num_stages);
+    m_host.reserve(arg_num_stages);
+    m_exec.resize(arg_num_stages);
+    for (size_t s = 0; s < arg_num_stages; ++s) {
+      m_dev.push_back(t_dev(label + " [" + std::to_string(s) + "]", n0, n1,
+                            n2, n3, n4, n5, n6, n7));
+      m_host.push_back(create_mirror_view(m_dev.back()));
+    }
+  }
+
+  //! Number of rotating host/device buffer pairs.
+  size_t num_stages() const { return m_dev.size(); }
+
+  //! \name Stage access, offset forward from the current head.
+  //@{
+
+  //! The device View of stage (head + k) % num_stages().
+  t_dev device_view(const size_t k = 0) const {
+    return m_dev[stage_of(m_head + k)];
+  }
+
+  //! The host mirror View of stage (head + k) % num_stages().
+  t_host host_view(const size_t k = 0) const {
+    return m_host[stage_of(m_head + k)];
+  }
+
+  //! The execution space instance ordering stage (head + k)'s work.
+  execution_space instance(const size_t k = 0) const {
+    return m_exec[stage_of(m_head + k)];
+  }
+
+  //! Advance the head to the next stage.
+  void rotate() { m_head = stage_of(m_head + 1); }
+  //@}
+
+  //! \name Per-stage transfer and completion primitives.
+  //@{
+
+  /// \brief Enqueue the host-to-device copy of stage (head + k) on the
+  ///        stage's execution space instance.
+  void upload(const size_t k = 0) const {
+    const size_t s = stage_of(m_head + k);
+    if (needs_copy(s)) Kokkos::deep_copy(m_exec[s], m_dev[s], m_host[s]);
+  }
+
+  /// \brief Enqueue the device-to-host copy of stage (head + k) on the
+  ///        stage's execution space instance.
+  void download(const size_t k = 0) const {
+    const size_t s = stage_of(m_head + k);
+    if (needs_copy(s)) Kokkos::deep_copy(m_exec[s], m_host[s], m_dev[s]);
+  }
+
+  //! Wait for all work enqueued on stage (head + k)'s instance.
+  void fence(const size_t k = 0) const {
+    m_exec[stage_of(m_head + k)].fence();
+  }
+
+  //! Wait for all work enqueued on every stage.
+  void fence_all() const {
+    for (size_t s = 0; s < m_exec.size(); ++s) m_exec[s].fence();
+  }
+  //@}
+
+  /// \brief Pipeline num_batches batches through the stages.
+  ///
+  /// For each batch b the hooks are invoked as
+  ///   - fill_op(host_view, b) to produce the batch in the host buffer,
+  ///     after which the upload is enqueued;
+  ///   - compute_op(instance, device_view, b) once the upload has
+  ///     completed, expected to enqueue its kernels on the given
+  ///     instance, after which the download is enqueued;
+  ///   - drain_op(host_view, b) once the download has completed.
+  ///
+  /// Batches rotate through the stages so that with three or more
+  /// stages the fill/upload of batch b+1 and the drain of batch b-1
+  /// overlap the compute of batch b.  A stage is fenced before its
+  /// host buffer is refilled, so the hooks never observe a buffer with
+  /// a transfer still in flight.  All stages are fenced on return.
+  template <class FillOp, class ComputeOp, class DrainOp>
+  void run(const int64_t num_batches, const FillOp& fill_op,
+           const ComputeOp& compute_op, const DrainOp& drain_op) {
+    for (int64_t b = 0; b < num_batches + 2; ++b) {
+      // Retire batch b-2: its download was enqueued when its compute
+      // was issued, so a fence makes the host buffer safe to read and,
+      // one rotation later, to refill.
+      if (2 <= b && b - 2 < num_batches) {
+        const size_t s = stage_of(b - 2);
+        m_exec[s].fence();
+        drain_op(m_host[s], b - 2);
+      }
+
+      // Compute batch b-1: its upload was enqueued last iteration and
+      // instances execute in order, so the kernels the hook enqueues
+      // observe the uploaded data.
+      if (1 <= b && b - 1 < num_batches) {
+        const size_t s = stage_of(b - 1);
+        compute_op(m_exec[s], m_dev[s], b - 1);
+        if (needs_copy(s)) Kokkos::deep_copy(m_exec[s], m_host[s], m_dev[s]);
+      }
+
+      // Fill and upload batch b.  Its stage last carried batch
+      // b - num_stages(), retired by the drain above at the latest.
+      if (b < num_batches) {
+        const size_t s = stage_of(b);
+        fill_op(m_host[s], b);
+        if (needs_copy(s)) Kokkos::deep_copy(m_exec[s], m_dev[s], m_host[s]);
+      }
+    }
+    m_head = stage_of(num_batches > 0 ? size_t(num_batches) : size_t(0));
+    fence_all();
+  }
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_PIPELINEBUFFER_HPP
@@ -0,0 +1,276 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_ReplicatedView.hpp
+/// \brief Declaration and definition of Kokkos::Experimental::ReplicatedView.
+///
+/// This header file declares and defines
+/// Kokkos::Experimental::ReplicatedView and its related nonmember
+/// functions.
+
+#ifndef KOKKOS_REPLICATEDVIEW_HPP
+#define KOKKOS_REPLICATEDVIEW_HPP
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_hwloc.hpp>
+#include <impl/Kokkos_Error.hpp>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace Kokkos {
+namespace Experimental {
+
+namespace Impl {
+
+/* Map of hardware cpu id to NUMA node, built once from sysfs.  Returns
+ * an empty vector when the topology cannot be discovered, in which case
+ * a single domain is assumed.
+ */
+inline const std::vector<int>& replicated_view_cpu_to_node() {
+  static std::vector<int> map = [] {
+    std::vector<int> m;
+#if defined(__linux__)
+    for (int node = 0;; ++node) {
+      std::ifstream cpulist("/sys/devices/system/node/node" +
+                            std::to_string(node) + "/cpulist");
+      if (!cpulist.good()) break;
+      // The cpulist format is comma-separated ranges, e.g. "0-3,8-11".
+      std::string range;
+      while (std::getline(cpulist, range, ',')) {
+        const size_t dash = range.find('-');
+        const int first   = std::stoi(range);
+        const int last =
+            dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+        if (int(m.size()) <= last) m.resize(last + 1, 0);
+        for (int cpu = first; cpu <= last; ++cpu) m[cpu] = node;
+      }
+    }
+#endif
+    return m;
+  }();
+  return map;
+}
+
+//! Number of NUMA domains discovered from the topology, at least one.
+inline int replicated_view_num_domains() {
+  const std::vector<int>& map = replicated_view_cpu_to_node();
+  int count                   = 0;
+  for (size_t cpu = 0; cpu < map.size(); ++cpu) {
+    if (count <= map[cpu]) count = map[cpu] + 1;
+  }
+  return 0 < count ? count : 1;
+}
+
+//! NUMA domain of the calling thread, zero when unknown.
+inline int replicated_view_my_domain() {
+#if defined(__linux__)
+  const std::vector<int>& map = replicated_view_cpu_to_node();
+  const int cpu               = sched_getcpu();
+  if (0 <= cpu && cpu < int(map.size())) return map[cpu];
+#endif
+  return 0;
+}
+
+/* Best-effort migration of the whole pages of [ptr, ptr+bytes) to the
+ * given NUMA node, so a replica's pages live in the domain whose
+ * threads read it.  Uses the move_pages syscall directly to avoid a
+ * libnuma dependency; failures are ignored, first-touch placement then
+ * decides.
+ */
+inline void replicated_view_bind_pages(void* ptr, const size_t bytes,
+                                       const int node) {
+#if defined(__linux__) && defined(SYS_move_pages)
+  const size_t page = sysconf(_SC_PAGESIZE);
+
+  uintptr_t begin = reinterpret_cast<uintptr_t>(ptr);
+  uintptr_t end   = begin + bytes;
+  begin           = (begin + page - 1) & ~(page - 1);
+  end             = end & ~(page - 1);
+  if (end <= begin) return;
+
+  const size_t count = (end - begin) / page;
+  std::vector<void*> pages(count);
+  std::vector<int> nodes(count, node);
+  std::vector<int> status(count, 0);
+  for (size_t i = 0; i < count; ++i) {
+    pages[i] = reinterpret_cast<void*>(begin + i * page);
+  }
+  // MPOL_MF_MOVE == (1 << 1), from <linux/mempolicy.h>
+  syscall(SYS_move_pages, 0, count, pages.data(), nodes.data(), status.data(),
+          1 << 1);
+#else
+  (void)ptr;
+  (void)bytes;
+  (void)node;
+#endif
+}
+
+}  // namespace Impl
+
+/** \brief  One logical read-mostly View physically replicated per NUMA
+ *          domain.
+ *
+ *  A large read-only table accessed from every socket turns the
+ *  inter-socket links into the bottleneck: every remote read crosses
+ *  them.  A ReplicatedView keeps one physical copy of the data per
+ *  NUMA domain, with each replica's pages migrated into its domain,
+ *  and routes readers to the copy local to the thread they run on.
+ *
+ *  Writes go through the master replica (domain zero) via master();
+ *  sync() propagates the master to the other replicas and is the only
+ *  point at which readers of other domains observe the changes, which
+ *  matches the setup-then-read-only life cycle of coefficient tables.
+ *
+ *  local() queries the calling thread's domain, so call it once on
+ *  entry to a kernel body (per thread or team, not per element) and
+ *  read through the returned View of const data.
+ *
+ *  The template arguments are the same as those of Kokkos::View; the
+ *  replicas are host-space Views.
+ */
+template <class DataType, class Arg1Type = void, class Arg2Type = void,
+          class Arg3Type = void>
+class ReplicatedView {
+ public:
+  //! \name Typedefs for the replica Views.
+  //@{
+  typedef ViewTraits<DataType, Arg1Type, Arg2Type, Arg3Type> traits;
+
+  //! The type of one writable replica.
+  typedef View<typename traits::data_type, Arg1Type, Arg2Type, Arg3Type>
+      replica_type;
+
+  //! The type through which readers access their local replica.
+  typedef View<typename traits::const_data_type, Arg1Type, Arg2Type, Arg3Type>
+      const_replica_type;
+  //@}
+
+ private:
+  static_assert(
+      std::is_same<typename traits::memory_space,
+                   typename Kokkos::HostSpace::memory_space>::value ||
+          Kokkos::Impl::MemorySpaceAccess<Kokkos::HostSpace,
+                                          typename traits::memory_space>::
+              accessible,
+      "Kokkos::Experimental::ReplicatedView replicates host-accessible "
+      "memory across NUMA domains");
+
+  std::vector<replica_type> m_replicas;
+
+ public:
+  ReplicatedView() = default;
+
+  /// \brief Constructor allocating one replica per NUMA domain.
+  ///
+  /// The arguments are those of the analogous View constructor;
+  /// replica d is allocated with the label suffixed by " [numa d]" and
+  /// its pages are migrated into domain d.
+  ReplicatedView(const std::string& label,
+                 const size_t n0 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                 const size_t n1 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                 const size_t n2 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                 const size_t n3 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                 const size_t n4 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                 const size_t n5 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                 const size_t n6 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                 const size_t n7 = KOKKOS_IMPL_CTOR_DEFAULT_ARG) {
+    const int domains = Impl::replicated_view_num_domains();
+    m_replicas.reserve(domains);
+    for (int d = 0; d < domains; ++d) {
+      m_replicas.push_back(
+          replica_type(label + " [numa " + std::to_string(d) + "]", n0, n1,
+                       n2, n3, n4, n5, n6, n7));
+      Impl::replicated_view_bind_pages(
+          m_replicas.back().data(),
+          m_replicas.back().span() *
+              sizeof(typename replica_type::value_type),
+          d);
+    }
+  }
+
+  //! Number of NUMA domains, equal to the number of replicas.
+  int num_domains() const { return int(m_replicas.size()); }
+
+  //! The writable master replica; modify it, then call sync().
+  replica_type master() const { return m_replicas[0]; }
+
+  //! The replica of the given domain.
+  const_replica_type replica(const int domain) const {
+    return m_replicas[domain];
+  }
+
+  /// \brief The replica local to the calling thread's NUMA domain.
+  ///
+  /// Queries the thread's current cpu, so hoist the call out of inner
+  /// loops: once per thread or team on kernel entry.
+  const_replica_type local() const {
+    const int d = Impl::replicated_view_my_domain();
+    return m_replicas[d < num_domains() ? d : 0];
+  }
+
+  /// \brief Propagate the master replica to all other replicas.
+  ///
+  /// The explicit write-visibility point: readers routed to non-master
+  /// domains observe modifications of master() only after sync()
+  /// returns.  The caller is responsible for not running readers
+  /// concurrently with the propagation.
+  void sync() const {
+    for (size_t d = 1; d < m_replicas.size(); ++d) {
+      Kokkos::deep_copy(m_replicas[d], m_replicas[0]);
+    }
+  }
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_REPLICATEDVIEW_HPP
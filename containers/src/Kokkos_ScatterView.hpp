@@ -51,6 +51,8 @@
 #ifndef KOKKOS_SCATTER_VIEW_HPP
 #define KOKKOS_SCATTER_VIEW_HPP
 
+#include <cstdlib>
+
 #include <Kokkos_Core.hpp>
 #include <utility>
 
@@ -73,6 +75,26 @@ enum : int { ScatterNonDuplicated = 0, ScatterDuplicated = 1 };
 
 enum : int { ScatterNonAtomic = 0, ScatterAtomic = 1 };
 
+/** \brief  Runtime memory budget, in bytes, for replicated scatter buffers.
+ *
+ *  Zero (the default) means unlimited: duplicated ScatterViews allocate one
+ *  replica per unit of concurrency.  With a budget set, a duplicated
+ *  ScatterView whose compile-time contribution is ScatterAtomic clamps its
+ *  replica count so the replicas fit in the budget; several threads then
+ *  share a replica and their contributions stay correct through the atomic
+ *  contribution path.  This trades a runtime-chosen amount of duplication
+ *  against atomic contention instead of forcing the all-or-nothing
+ *  compile-time choice.  The environment variable
+ *  KOKKOS_SCATTER_DUPLICATION_BUDGET provides an initial value.
+ */
+inline size_t& scatter_duplication_budget() {
+  static size_t budget = []() {
+    const char* env = std::getenv("KOKKOS_SCATTER_DUPLICATION_BUDGET");
+    return env ? static_cast<size_t>(std::atoll(env)) : size_t(0);
+  }();
+  return budget;
+}
+
 }  // namespace Experimental
 }  // namespace Kokkos
 
@@ -80,6 +102,28 @@ namespace Kokkos {
 namespace Impl {
 namespace Experimental {
 
+inline constexpr size_t scatter_dims_product() { return 1; }
+template <typename D, typename... Ds>
+inline constexpr size_t scatter_dims_product(D d, Ds... ds) {
+  return size_t(d) * scatter_dims_product(ds...);
+}
+
+// Number of replicas a duplicated ScatterView allocates.  Clamping below
+// max_replicas is only legal when threads sharing a replica contribute
+// atomically, which the callers guarantee by passing can_clamp only for
+// ScatterAtomic contribution.
+inline int scatter_replication_factor(int max_replicas,
+                                      size_t bytes_per_replica,
+                                      bool can_clamp) {
+  if (!can_clamp || bytes_per_replica == 0) return max_replicas;
+  const size_t budget =
+      Kokkos::Experimental::scatter_duplication_budget();
+  if (budget == 0) return max_replicas;
+  int replicas = int(budget / bytes_per_replica);
+  if (replicas < 1) replicas = 1;
+  return replicas < max_replicas ? replicas : max_replicas;
+}
+
 template <typename ExecSpace>
 struct DefaultDuplication;
 
@@ -591,6 +635,77 @@ struct ReduceDuplicates
   }
 };
 
+/* ReduceDuplicatesFused -- one sweep reducing several duplicated
+ * ScatterViews at once.  Each target supplies the same pointer/stride
+ * arguments its own ReduceDuplicates launch would use; the fused
+ * kernel walks the common index range once and folds every target's
+ * replicas inside it, replacing N reduction launches by one. */
+
+template <typename ValueType>
+struct ReduceDuplicatesArgs {
+  ValueType const* src;
+  ValueType* dst;
+  size_t stride;
+  size_t start;
+  size_t n;
+};
+
+template <typename ExecSpace, typename ValueType, int Op, int NumTargets>
+struct ReduceDuplicatesFused;
+
+template <typename ExecSpace, typename ValueType, int Op, int NumTargets>
+struct ReduceDuplicatesFusedBase {
+  typedef ReduceDuplicatesFused<ExecSpace, ValueType, Op, NumTargets> Derived;
+  ReduceDuplicatesArgs<ValueType> args[NumTargets];
+  ReduceDuplicatesFusedBase(
+      ReduceDuplicatesArgs<ValueType> const (&args_in)[NumTargets],
+      std::string const& name) {
+    size_t max_stride = 0;
+    for (int t = 0; t < NumTargets; ++t) {
+      args[t] = args_in[t];
+      if (max_stride < args[t].stride) max_stride = args[t].stride;
+    }
+#if defined(KOKKOS_ENABLE_PROFILING)
+    uint64_t kpID = 0;
+    if (Kokkos::Profiling::profileLibraryLoaded()) {
+      Kokkos::Profiling::beginParallelFor(std::string("reduce_fused_") + name,
+                                          0, &kpID);
+    }
+#endif
+    typedef RangePolicy<ExecSpace, size_t> policy_type;
+    typedef Kokkos::Impl::ParallelFor<Derived, policy_type> closure_type;
+    const closure_type closure(*(static_cast<Derived*>(this)),
+                               policy_type(0, max_stride));
+    closure.execute();
+#if defined(KOKKOS_ENABLE_PROFILING)
+    if (Kokkos::Profiling::profileLibraryLoaded()) {
+      Kokkos::Profiling::endParallelFor(kpID);
+    }
+#endif
+  }
+};
+
+template <typename ExecSpace, typename ValueType, int Op, int NumTargets>
+struct ReduceDuplicatesFused
+    : public ReduceDuplicatesFusedBase<ExecSpace, ValueType, Op, NumTargets> {
+  typedef ReduceDuplicatesFusedBase<ExecSpace, ValueType, Op, NumTargets> Base;
+  ReduceDuplicatesFused(
+      ReduceDuplicatesArgs<ValueType> const (&args_in)[NumTargets],
+      std::string const& name)
+      : Base(args_in, name) {}
+  KOKKOS_FORCEINLINE_FUNCTION void operator()(size_t i) const {
+    for (int t = 0; t < NumTargets; ++t) {
+      if (i < Base::args[t].stride) {
+        for (size_t j = Base::args[t].start; j < Base::args[t].n; ++j) {
+          ScatterValue<ValueType, Op, Kokkos::Experimental::ScatterNonAtomic>
+              sv(Base::args[t].dst[i]);
+          sv.update(Base::args[t].src[i + Base::args[t].stride * j]);
+        }
+      }
+    }
+  }
+};
+
 template <typename ExecSpace, typename ValueType, int Op>
 struct ResetDuplicates;
 
@@ -709,6 +824,14 @@ class ScatterView<DataType, Layout, ExecSpace, Op, ScatterNonDuplicated,
         internal_view.data(), dest.data(), 0, 0, 1, internal_view.label());
   }
 
+  /** \brief  Arguments this view's reduction sweep would use; consumed
+   *          by the fused multi-target contribute. */
+  template <typename DT, typename... RP>
+  Kokkos::Impl::Experimental::ReduceDuplicatesArgs<original_value_type>
+  impl_reduce_args(View<DT, RP...> const& dest) const {
+    return {internal_view.data(), dest.data(), 0, 0, 1};
+  }
+
   void reset() {
     Kokkos::Impl::Experimental::ResetDuplicates<ExecSpace, original_value_type,
                                                 Op>(
@@ -810,9 +933,13 @@ class ScatterView<DataType, Kokkos::LayoutRight, ExecSpace, Op,
   template <typename RT, typename... RP>
   ScatterView(View<RT, RP...> const& original_view)
       : unique_token(),
+        m_replicas(Kokkos::Impl::Experimental::scatter_replication_factor(
+            unique_token.size(),
+            original_view.size() * sizeof(original_value_type),
+            contribution == ScatterAtomic)),
         internal_view(Kokkos::ViewAllocateWithoutInitializing(
                           std::string("duplicated_") + original_view.label()),
-                      unique_token.size(),
+                      m_replicas,
 #ifdef KOKKOS_ENABLE_DEPRECATED_CODE
                       original_view.extent(0), original_view.extent(1),
                       original_view.extent(2), original_view.extent(3),
@@ -848,8 +975,13 @@ class ScatterView<DataType, Kokkos::LayoutRight, ExecSpace, Op,
 
   template <typename... Dims>
   ScatterView(std::string const& name, Dims... dims)
-      : internal_view(Kokkos::ViewAllocateWithoutInitializing(name),
-                      unique_token.size(), dims...) {
+      : m_replicas(Kokkos::Impl::Experimental::scatter_replication_factor(
+            unique_token.size(),
+            Kokkos::Impl::Experimental::scatter_dims_product(dims...) *
+                sizeof(original_value_type),
+            contribution == ScatterAtomic)),
+        internal_view(Kokkos::ViewAllocateWithoutInitializing(name),
+                      m_replicas, dims...) {
     reset();
   }
 
@@ -891,6 +1023,16 @@ class ScatterView<DataType, Kokkos::LayoutRight, ExecSpace, Op,
         internal_view.extent(0), internal_view.label());
   }
 
+  /** \brief  Arguments this view's reduction sweep would use; consumed
+   *          by the fused multi-target contribute. */
+  template <typename DT, typename... RP>
+  Kokkos::Impl::Experimental::ReduceDuplicatesArgs<original_value_type>
+  impl_reduce_args(View<DT, RP...> const& dest) const {
+    const size_t start = dest.data() == internal_view.data() ? 1 : 0;
+    return {internal_view.data(), dest.data(), internal_view.stride(0), start,
+            internal_view.extent(0)};
+  }
+
   void reset() {
     Kokkos::Impl::Experimental::ResetDuplicates<ExecSpace, original_value_type,
                                                 Op>(
@@ -911,22 +1053,23 @@ class ScatterView<DataType, Kokkos::LayoutRight, ExecSpace, Op,
   void resize(const size_t n0 = 0, const size_t n1 = 0, const size_t n2 = 0,
               const size_t n3 = 0, const size_t n4 = 0, const size_t n5 = 0,
               const size_t n6 = 0) {
-    ::Kokkos::resize(internal_view, unique_token.size(), n0, n1, n2, n3, n4, n5,
-                     n6);
+    ::Kokkos::resize(internal_view, m_replicas, n0, n1, n2, n3, n4, n5, n6);
   }
 
   void realloc(const size_t n0 = 0, const size_t n1 = 0, const size_t n2 = 0,
                const size_t n3 = 0, const size_t n4 = 0, const size_t n5 = 0,
                const size_t n6 = 0) {
-    ::Kokkos::realloc(internal_view, unique_token.size(), n0, n1, n2, n3, n4,
-                      n5, n6);
+    ::Kokkos::realloc(internal_view, m_replicas, n0, n1, n2, n3, n4, n5, n6);
   }
 
  protected:
   template <typename... Args>
   KOKKOS_FORCEINLINE_FUNCTION original_reference_type at(int rank,
                                                          Args... args) const {
-    return internal_view(rank, args...);
+    // With atomic contribution the replica pool may be clamped below the
+    // concurrency, so several threads fold onto one replica.
+    return internal_view(
+        contribution == ScatterAtomic ? rank % m_replicas : rank, args...);
   }
 
  protected:
@@ -935,6 +1078,7 @@ class ScatterView<DataType, Kokkos::LayoutRight, ExecSpace, Op,
       unique_token_type;
 
   unique_token_type unique_token;
+  int m_replicas = 1;
   internal_view_type internal_view;
 };
 
@@ -976,7 +1120,11 @@ class ScatterView<DataType, Kokkos::LayoutLeft, ExecSpace, Op,
                        original_view.rank > 6 ? original_view.extent(6)
                                               : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
                        KOKKOS_IMPL_CTOR_DEFAULT_ARG};
-    arg_N[internal_view_type::rank - 1] = unique_token.size();
+    m_replicas = Kokkos::Impl::Experimental::scatter_replication_factor(
+        unique_token.size(),
+        original_view.size() * sizeof(original_value_type),
+        contribution == ScatterAtomic);
+    arg_N[internal_view_type::rank - 1] = m_replicas;
     internal_view                       = internal_view_type(
         Kokkos::ViewAllocateWithoutInitializing(std::string("duplicated_") +
                                                 original_view.label()),
@@ -1004,7 +1152,12 @@ class ScatterView<DataType, Kokkos::LayoutLeft, ExecSpace, Op,
                                               : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
                        KOKKOS_IMPL_CTOR_DEFAULT_ARG};
     Kokkos::Impl::Experimental::args_to_array(arg_N, 0, dims...);
-    arg_N[internal_view_type::rank - 1] = unique_token.size();
+    m_replicas = Kokkos::Impl::Experimental::scatter_replication_factor(
+        unique_token.size(),
+        Kokkos::Impl::Experimental::scatter_dims_product(dims...) *
+            sizeof(original_value_type),
+        contribution == ScatterAtomic);
+    arg_N[internal_view_type::rank - 1] = m_replicas;
     internal_view                       = internal_view_type(
         Kokkos::ViewAllocateWithoutInitializing(name), arg_N[0], arg_N[1],
         arg_N[2], arg_N[3], arg_N[4], arg_N[5], arg_N[6], arg_N[7]);
@@ -1055,6 +1208,17 @@ class ScatterView<DataType, Kokkos::LayoutLeft, ExecSpace, Op,
         internal_view.label());
   }
 
+  /** \brief  Arguments this view's reduction sweep would use; consumed
+   *          by the fused multi-target contribute. */
+  template <typename... RP>
+  Kokkos::Impl::Experimental::ReduceDuplicatesArgs<original_value_type>
+  impl_reduce_args(View<RP...> const& dest) const {
+    const size_t start = dest.data() == internal_view.data() ? 1 : 0;
+    return {internal_view.data(), dest.data(),
+            internal_view.stride(internal_view_type::rank - 1), start,
+            internal_view.extent(internal_view_type::rank - 1)};
+  }
+
   void reset() {
     Kokkos::Impl::Experimental::ResetDuplicates<ExecSpace, original_value_type,
                                                 Op>(
@@ -1077,7 +1241,7 @@ class ScatterView<DataType, Kokkos::LayoutLeft, ExecSpace, Op,
               const size_t n6 = 0) {
     size_t arg_N[8] = {n0, n1, n2, n3, n4, n5, n6, 0};
     const int i     = internal_view.rank - 1;
-    arg_N[i]        = unique_token.size();
+    arg_N[i]        = m_replicas;
 
     ::Kokkos::resize(internal_view, arg_N[0], arg_N[1], arg_N[2], arg_N[3],
                      arg_N[4], arg_N[5], arg_N[6], arg_N[7]);
@@ -1088,7 +1252,7 @@ class ScatterView<DataType, Kokkos::LayoutLeft, ExecSpace, Op,
                const size_t n6 = 0) {
     size_t arg_N[8] = {n0, n1, n2, n3, n4, n5, n6, 0};
     const int i     = internal_view.rank - 1;
-    arg_N[i]        = unique_token.size();
+    arg_N[i]        = m_replicas;
 
     ::Kokkos::realloc(internal_view, arg_N[0], arg_N[1], arg_N[2], arg_N[3],
                       arg_N[4], arg_N[5], arg_N[6], arg_N[7]);
@@ -1098,7 +1262,11 @@ class ScatterView<DataType, Kokkos::LayoutLeft, ExecSpace, Op,
   template <typename... Args>
   KOKKOS_FORCEINLINE_FUNCTION original_reference_type at(int thread_id,
                                                          Args... args) const {
-    return internal_view(args..., thread_id);
+    // With atomic contribution the replica pool may be clamped below the
+    // concurrency, so several threads fold onto one replica.
+    return internal_view(
+        args...,
+        contribution == ScatterAtomic ? thread_id % m_replicas : thread_id);
   }
 
  protected:
@@ -1107,6 +1275,7 @@ class ScatterView<DataType, Kokkos::LayoutLeft, ExecSpace, Op,
       unique_token_type;
 
   unique_token_type unique_token;
+  int m_replicas = 1;
   internal_view_type internal_view;
 };
 
@@ -1220,6 +1389,94 @@ void contribute(
   src.contribute_into(dest);
 }
 
+/* Batch contribute: reduce several ScatterViews sharing an execution
+ * space, operation, and value type in one fused sweep instead of one
+ * reduction launch per view.  Kernels accumulating into multiple
+ * fields (e.g. mass plus momentum components) pay one pass over the
+ * replica index range for all of them. */
+
+template <typename DT1, typename SDT1, typename LY1, int CT1, int DP1,
+          typename DT2, typename SDT2, typename LY2, int CT2, int DP2,
+          typename ES, int OP, typename... VP1, typename... VP2>
+void contribute(
+    View<DT1, VP1...>& dest1,
+    Kokkos::Experimental::ScatterView<SDT1, LY1, ES, OP, CT1, DP1> const& src1,
+    View<DT2, VP2...>& dest2,
+    Kokkos::Experimental::ScatterView<SDT2, LY2, ES, OP, CT2, DP2> const&
+        src2) {
+  typedef typename Kokkos::Experimental::ScatterView<
+      SDT1, LY1, ES, OP, CT1, DP1>::original_value_type value_type;
+  static_assert(
+      std::is_same<value_type,
+                   typename Kokkos::Experimental::ScatterView<
+                       SDT2, LY2, ES, OP, CT2, DP2>::original_value_type>::
+          value,
+      "Batch contribute requires ScatterViews with the same value type");
+  Kokkos::Impl::Experimental::ReduceDuplicatesArgs<value_type> args[2] = {
+      src1.impl_reduce_args(dest1), src2.impl_reduce_args(dest2)};
+  Kokkos::Impl::Experimental::ReduceDuplicatesFused<ES, value_type, OP, 2>(
+      args, "contribute");
+}
+
+template <typename DT1, typename SDT1, typename LY1, int CT1, int DP1,
+          typename DT2, typename SDT2, typename LY2, int CT2, int DP2,
+          typename DT3, typename SDT3, typename LY3, int CT3, int DP3,
+          typename ES, int OP, typename... VP1, typename... VP2,
+          typename... VP3>
+void contribute(
+    View<DT1, VP1...>& dest1,
+    Kokkos::Experimental::ScatterView<SDT1, LY1, ES, OP, CT1, DP1> const& src1,
+    View<DT2, VP2...>& dest2,
+    Kokkos::Experimental::ScatterView<SDT2, LY2, ES, OP, CT2, DP2> const& src2,
+    View<DT3, VP3...>& dest3,
+    Kokkos::Experimental::ScatterView<SDT3, LY3, ES, OP, CT3, DP3> const&
+        src3) {
+  typedef typename Kokkos::Experimental::ScatterView<
+      SDT1, LY1, ES, OP, CT1, DP1>::original_value_type value_type;
+  static_assert(
+      std::is_same<value_type,
+                   typename Kokkos::Experimental::ScatterView<
+                       SDT3, LY3, ES, OP, CT3, DP3>::original_value_type>::
+          value,
+      "Batch contribute requires ScatterViews with the same value type");
+  Kokkos::Impl::Experimental::ReduceDuplicatesArgs<value_type> args[3] = {
+      src1.impl_reduce_args(dest1), src2.impl_reduce_args(dest2),
+      src3.impl_reduce_args(dest3)};
+  Kokkos::Impl::Experimental::ReduceDuplicatesFused<ES, value_type, OP, 3>(
+      args, "contribute");
+}
+
+template <typename DT1, typename SDT1, typename LY1, int CT1, int DP1,
+          typename DT2, typename SDT2, typename LY2, int CT2, int DP2,
+          typename DT3, typename SDT3, typename LY3, int CT3, int DP3,
+          typename DT4, typename SDT4, typename LY4, int CT4, int DP4,
+          typename ES, int OP, typename... VP1, typename... VP2,
+          typename... VP3, typename... VP4>
+void contribute(
+    View<DT1, VP1...>& dest1,
+    Kokkos::Experimental::ScatterView<SDT1, LY1, ES, OP, CT1, DP1> const& src1,
+    View<DT2, VP2...>& dest2,
+    Kokkos::Experimental::ScatterView<SDT2, LY2, ES, OP, CT2, DP2> const& src2,
+    View<DT3, VP3...>& dest3,
+    Kokkos::Experimental::ScatterView<SDT3, LY3, ES, OP, CT3, DP3> const& src3,
+    View<DT4, VP4...>& dest4,
+    Kokkos::Experimental::ScatterView<SDT4, LY4, ES, OP, CT4, DP4> const&
+        src4) {
+  typedef typename Kokkos::Experimental::ScatterView<
+      SDT1, LY1, ES, OP, CT1, DP1>::original_value_type value_type;
+  static_assert(
+      std::is_same<value_type,
+                   typename Kokkos::Experimental::ScatterView<
+                       SDT4, LY4, ES, OP, CT4, DP4>::original_value_type>::
+          value,
+      "Batch contribute requires ScatterViews with the same value type");
+  Kokkos::Impl::Experimental::ReduceDuplicatesArgs<value_type> args[4] = {
+      src1.impl_reduce_args(dest1), src2.impl_reduce_args(dest2),
+      src3.impl_reduce_args(dest3), src4.impl_reduce_args(dest4)};
+  Kokkos::Impl::Experimental::ReduceDuplicatesFused<ES, value_type, OP, 4>(
+      args, "contribute");
+}
+
 }  // namespace Experimental
 }  // namespace Kokkos
 
@@ -0,0 +1,211 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_SlotPool.hpp
+/// \brief Concurrent slot acquisition over the internal bitset engine.
+///
+/// Applications recycling fixed-capacity slots - particle arrays, free
+/// entries in connectivity tables - tend to grow hand-rolled atomic
+/// free lists.  The runtime already owns the right machinery in
+/// Impl::concurrent_bitset: hint-scattered scanning so concurrent
+/// claimants do not contend on the same word, and a used-count
+/// maintained with the bits.  SlotPool is its public face: a
+/// device-callable pool of slot indices in [0, capacity) with single
+/// and bulk acquire/release and occupancy queries, plus a helper
+/// allocating the payload Views the slots index into.
+
+#ifndef KOKKOS_SLOTPOOL_HPP
+#define KOKKOS_SLOTPOOL_HPP
+
+#include <Kokkos_Core.hpp>
+#include <impl/Kokkos_ConcurrentBitset.hpp>
+#include <impl/Kokkos_ClockTic.hpp>
+#include <impl/Kokkos_Error.hpp>
+
+#include <cstdint>
+#include <string>
+
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  Concurrent fixed-capacity pool of slot indices.
+ *
+ *  acquire() claims a free slot in [0, capacity) and release() returns
+ *  it; both are callable from kernels of any execution space that can
+ *  access the pool's memory space.  The scan start is scattered by a
+ *  clock-derived hint so concurrent claimants touch different words of
+ *  the underlying bitset.  Copies share the pool, View-style.
+ *
+ *  \code
+ *    Kokkos::Experimental::SlotPool<> pool("particles", capacity);
+ *    auto position = pool.make_slot_view<double[3]>("position");
+ *    // in a kernel:
+ *    const int s = pool.acquire();
+ *    if (0 <= s) { position(s, 0) = x; ... }   // slot is exclusively ours
+ *    ...
+ *    pool.release(s);
+ *  \endcode
+ *
+ *  Capacity is bounded by the bitset engine's 33 million slots.
+ */
+template <class Space = typename Kokkos::DefaultExecutionSpace::memory_space>
+class SlotPool {
+ public:
+  typedef Space memory_space;
+
+ private:
+  Kokkos::View<uint32_t*, memory_space> m_buffer;
+  uint32_t m_capacity;
+
+ public:
+  SlotPool() : m_buffer(), m_capacity(0) {}
+
+  //! Construct a pool of 'capacity' free slots; all slots start free.
+  SlotPool(const std::string& label, const uint32_t capacity)
+      : m_buffer(), m_capacity(capacity) {
+    const uint32_t bound = Kokkos::Impl::concurrent_bitset::buffer_bound(
+        capacity);
+    if (capacity == 0 || bound == 0) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::SlotPool: capacity must be in [1, 2^25]");
+    }
+    // View allocation zero-initializes: used count 0, all bits free.
+    m_buffer = Kokkos::View<uint32_t*, memory_space>(label, bound);
+  }
+
+  //! Total number of slots.
+  KOKKOS_INLINE_FUNCTION
+  uint32_t capacity() const { return m_capacity; }
+
+  /** \brief  Number of slots currently claimed.
+   *
+   *  Exact when quiescent; during concurrent churn it is within the
+   *  number of in-flight operations of exact.
+   */
+  KOKKOS_INLINE_FUNCTION
+  uint32_t used_count() const {
+    return (uint32_t) * ((volatile uint32_t*)m_buffer.data()) &
+           Kokkos::Impl::concurrent_bitset::state_used_mask;
+  }
+
+  //! Fraction of the pool currently claimed, in [0, 1].
+  KOKKOS_INLINE_FUNCTION
+  double occupancy() const {
+    return m_capacity ? double(used_count()) / double(m_capacity) : 0.0;
+  }
+
+  /** \brief  Claim one free slot; returns its index, or -1 when the
+   *          pool is full.
+   */
+  KOKKOS_INLINE_FUNCTION
+  int acquire() const {
+    return acquire_near(uint32_t(Kokkos::Impl::clock_tic()) % m_capacity);
+  }
+
+  /** \brief  Claim one free slot, starting the scan at the hint -
+   *          e.g. a just-released slot for cache-warm recycling.
+   */
+  KOKKOS_INLINE_FUNCTION
+  int acquire_near(const uint32_t hint) const {
+    const Kokkos::pair<int, int> result =
+        Kokkos::Impl::concurrent_bitset::acquire_bounded(
+            m_buffer.data(), m_capacity,
+            hint < m_capacity ? hint : hint % m_capacity);
+    return result.first;
+  }
+
+  /** \brief  Claim 'count' slots in one scan pass into slots[0..count).
+   *
+   *  Each claim's scan resumes beside the previous one, so a bulk
+   *  claim sweeps the bitset once instead of rescanning from a fresh
+   *  hint per slot.  All-or-nothing: when fewer than 'count' slots are
+   *  free, any partial claims are released and -1 is returned;
+   *  otherwise returns 'count'.
+   */
+  KOKKOS_INLINE_FUNCTION
+  int acquire_bulk(const int count, int* const slots) const {
+    uint32_t hint = uint32_t(Kokkos::Impl::clock_tic()) % m_capacity;
+    for (int k = 0; k < count; ++k) {
+      const int slot = acquire_near(hint);
+      if (slot < 0) {
+        for (int r = 0; r < k; ++r) release(slots[r]);
+        return -1;
+      }
+      slots[k] = slot;
+      hint     = (uint32_t(slot) + 1u) % m_capacity;
+    }
+    return count;
+  }
+
+  /** \brief  Return a previously acquired slot to the pool.
+   *
+   *  Returns the used count after release, or -1 when the slot was
+   *  already free (the double-release diagnostic of the bitset).
+   */
+  KOKKOS_INLINE_FUNCTION
+  int release(const int slot) const {
+    return Kokkos::Impl::concurrent_bitset::release(m_buffer.data(),
+                                                    uint32_t(slot));
+  }
+
+  //! Return 'count' slots from slots[0..count).
+  KOKKOS_INLINE_FUNCTION
+  void release_bulk(const int count, const int* const slots) const {
+    for (int k = 0; k < count; ++k) release(slots[k]);
+  }
+
+  /** \brief  Allocate a payload View with one entry per slot, in the
+   *          pool's memory space: slot index == payload index.
+   */
+  template <class DataType>
+  Kokkos::View<DataType*, memory_space> make_slot_view(
+      const std::string& label) const {
+    return Kokkos::View<DataType*, memory_space>(label, m_capacity);
+  }
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_SLOTPOOL_HPP
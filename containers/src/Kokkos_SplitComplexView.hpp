@@ -0,0 +1,329 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+/// \file Kokkos_SplitComplexView.hpp
+/// \brief Declaration and definition of Kokkos::SplitComplexView.
+///
+/// This header file declares and defines Kokkos::SplitComplexView and
+/// associated free functions.
+
+#ifndef KOKKOS_SPLITCOMPLEXVIEW_HPP
+#define KOKKOS_SPLITCOMPLEXVIEW_HPP
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Complex.hpp>
+
+namespace Kokkos {
+namespace Experimental {
+
+namespace Impl {
+
+/** \brief  Proxy reference to a complex number stored as separate
+ *          real and imaginary planes.
+ *
+ *  Converts to complex<RealType> on read and scatters the two
+ *  components on write, so existing complex-valued code works
+ *  unchanged through a SplitComplexView accessor.
+ */
+template <class RealType>
+class SplitComplexRef {
+ private:
+  RealType& m_re;
+  RealType& m_im;
+
+ public:
+  KOKKOS_FORCEINLINE_FUNCTION
+  SplitComplexRef(RealType& arg_re, RealType& arg_im)
+      : m_re(arg_re), m_im(arg_im) {}
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  operator Kokkos::complex<RealType>() const noexcept {
+    return Kokkos::complex<RealType>(m_re, m_im);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  RealType& real() const noexcept { return m_re; }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  RealType& imag() const noexcept { return m_im; }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  SplitComplexRef& operator=(const Kokkos::complex<RealType>& val) noexcept {
+    m_re = val.real();
+    m_im = val.imag();
+    return *this;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  SplitComplexRef& operator=(const SplitComplexRef& src) noexcept {
+    m_re = src.m_re;
+    m_im = src.m_im;
+    return *this;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  SplitComplexRef& operator=(const RealType& val) noexcept {
+    m_re = val;
+    m_im = RealType(0);
+    return *this;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  SplitComplexRef& operator+=(const Kokkos::complex<RealType>& val) noexcept {
+    m_re += val.real();
+    m_im += val.imag();
+    return *this;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  SplitComplexRef& operator+=(const RealType& val) noexcept {
+    m_re += val;
+    return *this;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  SplitComplexRef& operator-=(const Kokkos::complex<RealType>& val) noexcept {
+    m_re -= val.real();
+    m_im -= val.imag();
+    return *this;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  SplitComplexRef& operator-=(const RealType& val) noexcept {
+    m_re -= val;
+    return *this;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  SplitComplexRef& operator*=(const Kokkos::complex<RealType>& val) noexcept {
+    const RealType re = m_re * val.real() - m_im * val.imag();
+    m_im              = m_re * val.imag() + m_im * val.real();
+    m_re              = re;
+    return *this;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  SplitComplexRef& operator*=(const RealType& val) noexcept {
+    m_re *= val;
+    m_im *= val;
+    return *this;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  SplitComplexRef& operator/=(const Kokkos::complex<RealType>& val) {
+    Kokkos::complex<RealType> z(m_re, m_im);
+    z /= val;
+    m_re = z.real();
+    m_im = z.imag();
+    return *this;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  SplitComplexRef& operator/=(const RealType& val) {
+    m_re /= val;
+    m_im /= val;
+    return *this;
+  }
+};
+
+}  // namespace Impl
+
+/** \brief  Complex-valued View stored as separate real and imaginary
+ *          planes.
+ *
+ *  View<complex<T>*> interleaves re/im pairs, which forces gather
+ *  patterns on SIMD hardware and strided accesses when a kernel only
+ *  streams one component.  A SplitComplexView keeps the two components
+ *  in two ordinary real-typed Views and hands out a lightweight proxy
+ *  that assembles a complex<T> on read and scatters the components on
+ *  write, so component-wise loops over real_view()/imag_view()
+ *  vectorize like any real-valued kernel while complex-valued code can
+ *  keep using the familiar accessor syntax.
+ *
+ *  DataType names the real component type of the planes, exactly as it
+ *  would for the underlying View, e.g. SplitComplexView<double**> holds
+ *  two View<double**>.  Copies are shallow and share both planes.
+ */
+template <class DataType, class... Properties>
+class SplitComplexView {
+ public:
+  typedef Kokkos::View<DataType, Properties...> component_view_type;
+  typedef typename component_view_type::non_const_value_type real_type;
+  typedef Kokkos::complex<real_type> value_type;
+  typedef typename component_view_type::execution_space execution_space;
+  typedef typename component_view_type::memory_space memory_space;
+  typedef typename component_view_type::size_type size_type;
+  typedef Impl::SplitComplexRef<typename component_view_type::value_type>
+      reference_type;
+
+  enum { Rank = component_view_type::Rank };
+
+  static_assert(std::is_floating_point<real_type>::value,
+                "SplitComplexView requires a floating point component type");
+
+ private:
+  component_view_type m_re;
+  component_view_type m_im;
+
+ public:
+  SplitComplexView() = default;
+
+  /// \brief allocate both planes, appending "::re" / "::im" to the label
+  template <class... Args>
+  SplitComplexView(const std::string& arg_label, Args... args)
+      : m_re(arg_label + "::re", args...), m_im(arg_label + "::im", args...) {}
+
+  /// \brief adopt existing planes; extents must match
+  SplitComplexView(const component_view_type& arg_re,
+                   const component_view_type& arg_im)
+      : m_re(arg_re), m_im(arg_im) {
+    for (unsigned r = 0; r < unsigned(Rank); ++r) {
+      if (m_re.extent(r) != m_im.extent(r)) {
+        Kokkos::Impl::throw_runtime_exception(
+            "Kokkos::SplitComplexView: real and imaginary plane extents do "
+            "not match");
+      }
+    }
+  }
+
+  /// \brief the real component plane
+  KOKKOS_INLINE_FUNCTION
+  const component_view_type& real_view() const noexcept { return m_re; }
+
+  /// \brief the imaginary component plane
+  KOKKOS_INLINE_FUNCTION
+  const component_view_type& imag_view() const noexcept { return m_im; }
+
+  KOKKOS_INLINE_FUNCTION
+  constexpr size_type extent(const unsigned r) const noexcept {
+    return m_re.extent(r);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  constexpr size_type size() const noexcept { return m_re.size(); }
+
+  /// \brief proxy reference to the complex entry at the given indices
+  template <class... Indices>
+  KOKKOS_FORCEINLINE_FUNCTION reference_type operator()(Indices... idx) const {
+    return reference_type(m_re(idx...), m_im(idx...));
+  }
+};
+
+namespace Impl {
+
+template <class InterleavedView, class SplitView>
+struct SplitComplexGather {
+  InterleavedView m_dst;
+  SplitView m_src;
+
+  SplitComplexGather(const InterleavedView& arg_dst, const SplitView& arg_src)
+      : m_dst(arg_dst), m_src(arg_src) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i) const {
+    m_dst(i) = typename SplitView::value_type(m_src.real_view()(i),
+                                              m_src.imag_view()(i));
+  }
+};
+
+template <class SplitView, class InterleavedView>
+struct SplitComplexScatter {
+  SplitView m_dst;
+  InterleavedView m_src;
+
+  SplitComplexScatter(const SplitView& arg_dst, const InterleavedView& arg_src)
+      : m_dst(arg_dst), m_src(arg_src) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i) const {
+    m_dst.real_view()(i) = m_src(i).real();
+    m_dst.imag_view()(i) = m_src(i).imag();
+  }
+};
+
+}  // namespace Impl
+
+/// \brief gather a split storage container into an interleaved View
+template <class DT, class... DP, class ST, class... SP>
+void deep_copy(
+    const Kokkos::View<DT, DP...>& dst, const SplitComplexView<ST, SP...>& src,
+    typename std::enable_if<unsigned(Kokkos::View<DT, DP...>::Rank) ==
+                            1>::type* = nullptr) {
+  typedef typename SplitComplexView<ST, SP...>::execution_space exec_space;
+  if (dst.extent(0) != src.extent(0)) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::deep_copy(View,SplitComplexView): extents do not match");
+  }
+  Kokkos::parallel_for(
+      "Kokkos::SplitComplexView::gather",
+      Kokkos::RangePolicy<exec_space>(0, src.extent(0)),
+      Impl::SplitComplexGather<Kokkos::View<DT, DP...>,
+                               SplitComplexView<ST, SP...>>(dst, src));
+  Kokkos::fence();
+}
+
+/// \brief scatter an interleaved View into a split storage container
+template <class DT, class... DP, class ST, class... SP>
+void deep_copy(
+    const SplitComplexView<DT, DP...>& dst, const Kokkos::View<ST, SP...>& src,
+    typename std::enable_if<unsigned(Kokkos::View<ST, SP...>::Rank) ==
+                            1>::type* = nullptr) {
+  typedef typename SplitComplexView<DT, DP...>::execution_space exec_space;
+  if (dst.extent(0) != src.extent(0)) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::deep_copy(SplitComplexView,View): extents do not match");
+  }
+  Kokkos::parallel_for(
+      "Kokkos::SplitComplexView::scatter",
+      Kokkos::RangePolicy<exec_space>(0, src.extent(0)),
+      Impl::SplitComplexScatter<SplitComplexView<DT, DP...>,
+                                Kokkos::View<ST, SP...>>(dst, src));
+  Kokkos::fence();
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_SPLITCOMPLEXVIEW_HPP
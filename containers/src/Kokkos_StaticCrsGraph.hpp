@@ -49,6 +49,7 @@
 #include <vector>
 
 #include <Kokkos_View.hpp>
+#include <Kokkos_Crs.hpp>
 #include <Kokkos_Parallel.hpp>
 #include <Kokkos_Parallel_Reduce.hpp>
 
@@ -433,6 +434,36 @@ typename StaticCrsGraphType::staticcrsgraph_type create_staticcrsgraph(
     const std::string& label,
     const std::vector<std::vector<InputSizeType> >& input);
 
+/** \brief  Build a graph entirely on device from a view of per-row
+ *          entry counts.
+ *
+ *  The row map is computed with a parallel_scan in the graph's
+ *  execution space and the entries are allocated uninitialized;
+ *  no host mirror of either is materialized.  The caller fills
+ *  graph.entries afterwards, e.g. with a parallel_for over rows.
+ */
+template <class StaticCrsGraphType, class CountsViewType>
+typename StaticCrsGraphType::staticcrsgraph_type create_staticcrsgraph(
+    const std::string& label, const CountsViewType& counts,
+    typename Impl::enable_if<Kokkos::is_view<CountsViewType>::value>::type* =
+        0);
+
+/** \brief  Build a graph entirely on device from a view of per-row
+ *          entry counts and a fill functor.
+ *
+ *  As above, followed by a parallel_for that invokes
+ *  fill( row , ptr ) for every row, where ptr points at the first
+ *  entry of the row (or is null for a trailing empty row), following
+ *  the convention of Kokkos::count_and_fill_crs.
+ */
+template <class StaticCrsGraphType, class CountsViewType,
+          class FillFunctorType>
+typename StaticCrsGraphType::staticcrsgraph_type create_staticcrsgraph(
+    const std::string& label, const CountsViewType& counts,
+    const FillFunctorType& fill,
+    typename Impl::enable_if<Kokkos::is_view<CountsViewType>::value>::type* =
+        0);
+
 //----------------------------------------------------------------------------
 
 template <class DataType, class Arg1Type, class Arg2Type,
@@ -531,4 +562,340 @@ DataType maximum_entry(const StaticCrsGraph<DataType, Arg1Type, Arg2Type,
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
 
+namespace Kokkos {
+namespace Impl {
+
+/* Request the cache line holding addr ahead of its use.  Traversal of
+ * irregular rows gives the hardware prefetcher no usable stride, so the
+ * traversal helpers issue the request explicitly on host compilers that
+ * support it; on device the request is a no-op and latency is covered
+ * by occupancy instead. */
+KOKKOS_FORCEINLINE_FUNCTION
+void static_crs_graph_prefetch_line(const void* addr) {
+#if !defined(__CUDA_ARCH__) && !defined(__HIP_DEVICE_COMPILE__) &&    \
+    (defined(KOKKOS_COMPILER_GNU) || defined(KOKKOS_COMPILER_CLANG) || \
+     defined(KOKKOS_COMPILER_INTEL))
+  __builtin_prefetch(addr, 0 /* read */, 3 /* keep in all cache levels */);
+#else
+  (void)addr;
+#endif
+}
+
+template <class GraphType, class Functor>
+struct StaticCrsGraphForEachRow {
+  typedef typename GraphType::execution_space execution_space;
+  typedef typename GraphType::data_type ordinal_type;
+  typedef typename GraphType::size_type size_type;
+
+  enum : int { cache_line_bytes = 64 };
+  // Cap per-row lookahead: past a few lines the prefetches of later
+  // iterations cover the rest of a long row anyway.
+  enum : int { max_prefetch_bytes = 256 };
+
+  GraphType m_graph;
+  Functor m_functor;
+  ordinal_type m_num_rows;
+  ordinal_type m_lookahead;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ordinal_type row) const {
+    const ordinal_type ahead = row + m_lookahead;
+    if (ahead < m_num_rows) {
+      const size_type begin = m_graph.row_map(ahead);
+      const size_type end   = m_graph.row_map(ahead + 1);
+
+      if (begin < end) {
+        const char* const p =
+            reinterpret_cast<const char*>(&m_graph.entries(begin));
+        size_t bytes =
+            (end - begin) * sizeof(typename GraphType::data_type);
+        if (size_t(max_prefetch_bytes) < bytes) {
+          bytes = size_t(max_prefetch_bytes);
+        }
+        for (size_t b = 0; b < bytes; b += cache_line_bytes) {
+          static_crs_graph_prefetch_line(p + b);
+        }
+      }
+    }
+
+    m_functor(row, m_graph.rowConst(row));
+  }
+};
+
+}  // namespace Impl
+
+namespace Experimental {
+
+/** \brief  Parallel traversal of the rows of a StaticCrsGraph with
+ *          lookahead prefetching of upcoming rows' entries.
+ *
+ *  Invokes functor( row , graph.rowConst(row) ) for every row in a
+ *  parallel_for over the graph's execution space.  Before each row is
+ *  processed the column indices of the row lookahead iterations ahead
+ *  are requested from memory, computed from the row_map, so the
+ *  irregular-stride misses of the entries array overlap the current
+ *  row's work.  The default lookahead of one row suits short rows;
+ *  raise it when the per-row work is too small to hide a miss.
+ *
+ *  Works unchanged for graph types sharing the rowConst interface.
+ */
+template <class GraphType, class Functor>
+void for_each_row(const std::string& label, const GraphType& graph,
+                  const Functor& functor,
+                  const typename GraphType::data_type lookahead = 1) {
+  typedef Kokkos::Impl::StaticCrsGraphForEachRow<GraphType, Functor>
+      closure_type;
+  typedef typename GraphType::execution_space execution_space;
+  typedef typename GraphType::data_type ordinal_type;
+
+  const ordinal_type num_rows = ordinal_type(graph.numRows());
+
+  Kokkos::parallel_for(
+      label, Kokkos::RangePolicy<execution_space>(0, num_rows),
+      closure_type{graph, functor, num_rows,
+                   lookahead < 1 ? ordinal_type(1) : lookahead});
+}
+
+template <class GraphType, class Functor>
+void for_each_row(const GraphType& graph, const Functor& functor,
+                  const typename GraphType::data_type lookahead = 1) {
+  for_each_row("Kokkos::Experimental::for_each_row", graph, functor,
+               lookahead);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+namespace Experimental {
+
+/// \class SlicedEllGraph
+/// \brief Sliced-ELLPACK storage of a static graph.
+///
+/// Rows are grouped into slices of \c SliceLength consecutive rows and
+/// every row of a slice is padded to the longest row of that slice.
+/// Within a slice the entries are stored entry-major, so entry k of
+/// rows i and i+1 are adjacent in memory: threads of a warp assigned
+/// to consecutive rows load their column indices coalesced, where the
+/// row-pointer layout of StaticCrsGraph scatters them.
+///
+/// Entry k of row i lives at
+/// <tt> entries( slice_map(i / SliceLength)
+///               + k * SliceLength + i % SliceLength ) </tt>.
+///
+/// The traversal interface matches StaticCrsGraph::rowConst: kernels
+/// written against GraphRowViewConst work on either storage unchanged.
+/// Build from an existing graph with create_sliced_ell_graph.
+template <class CrsGraphType, unsigned SliceLength = 32>
+class SlicedEllGraph {
+  static_assert(0 == (SliceLength & (SliceLength - 1)),
+                "SliceLength must be a power of two");
+
+ public:
+  typedef typename CrsGraphType::data_type data_type;
+  typedef typename CrsGraphType::array_layout array_layout;
+  typedef typename CrsGraphType::execution_space execution_space;
+  typedef typename CrsGraphType::device_type device_type;
+  typedef typename CrsGraphType::memory_traits memory_traits;
+  typedef typename CrsGraphType::size_type size_type;
+
+  enum : unsigned { slice_length = SliceLength };
+
+  typedef View<data_type*, array_layout, device_type, memory_traits>
+      entries_type;
+  typedef View<const size_type*, array_layout, device_type, memory_traits>
+      slice_map_type;
+  typedef View<const data_type*, array_layout, device_type, memory_traits>
+      row_length_type;
+
+  //! Column indices in sliced-ELL order, padding stores zero.
+  entries_type entries;
+  //! Offset of each slice into \c entries ; length is num_slices + 1.
+  slice_map_type slice_map;
+  //! Unpadded number of entries of each row.
+  row_length_type row_length;
+
+  //! Construct an empty view.
+  KOKKOS_INLINE_FUNCTION
+  SlicedEllGraph() : entries(), slice_map(), row_length() {}
+
+  //! Copy constructor (shallow copy).
+  KOKKOS_INLINE_FUNCTION
+  SlicedEllGraph(const SlicedEllGraph& rhs)
+      : entries(rhs.entries),
+        slice_map(rhs.slice_map),
+        row_length(rhs.row_length) {}
+
+  /** \brief  Assign to a view of the rhs array.  */
+  SlicedEllGraph& operator=(const SlicedEllGraph& rhs) {
+    entries    = rhs.entries;
+    slice_map  = rhs.slice_map;
+    row_length = rhs.row_length;
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  ~SlicedEllGraph() {}
+
+  /**  \brief  Return number of rows in the graph
+   */
+  KOKKOS_INLINE_FUNCTION
+  size_type numRows() const { return row_length.extent(0); }
+
+  /// \brief Return a const view of row i of the graph.
+  ///
+  /// Same interface and semantics as StaticCrsGraph::rowConst; the
+  /// stride between successive entries is \c SliceLength instead
+  /// of one.
+  KOKKOS_INLINE_FUNCTION
+  GraphRowViewConst<SlicedEllGraph> rowConst(const data_type i) const {
+    const data_type count = row_length(i);
+
+    if (count == 0) {
+      return GraphRowViewConst<SlicedEllGraph>(NULL, 1, 0);
+    } else {
+      return GraphRowViewConst<SlicedEllGraph>(
+          entries, data_type(slice_length), count,
+          slice_map(size_type(i) / slice_length) +
+              (size_type(i) & (slice_length - 1)));
+    }
+  }
+};
+
+}  // namespace Experimental
+
+namespace Impl {
+
+template <class CrsGraphType, class SizesViewType, unsigned SliceLength>
+struct SlicedEllSliceSizes {
+  typedef typename CrsGraphType::size_type size_type;
+
+  typename CrsGraphType::row_map_type row_map;
+  SizesViewType slice_sizes;
+  size_type num_rows;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_type s) const {
+    const size_type begin = s * SliceLength;
+    const size_type end =
+        begin + SliceLength < num_rows ? begin + SliceLength : num_rows;
+    size_type max_len = 0;
+    for (size_type i = begin; i < end; ++i) {
+      const size_type len = row_map(i + 1) - row_map(i);
+      if (max_len < len) max_len = len;
+    }
+    slice_sizes(s) = max_len * SliceLength;
+  }
+};
+
+template <class CrsGraphType, class SliceMapViewType, class EntriesViewType,
+          class LengthsViewType, unsigned SliceLength>
+struct SlicedEllFillEntries {
+  typedef typename CrsGraphType::size_type size_type;
+  typedef typename CrsGraphType::data_type data_type;
+
+  typename CrsGraphType::row_map_type row_map;
+  typename CrsGraphType::entries_type in_entries;
+  SliceMapViewType slice_map;
+  EntriesViewType ell_entries;
+  LengthsViewType row_length;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_type i) const {
+    const size_type s     = i / SliceLength;
+    const size_type base  = slice_map(s) + (i & (SliceLength - 1));
+    const size_type begin = row_map(i);
+    const size_type len   = row_map(i + 1) - begin;
+    const size_type max_len =
+        (slice_map(s + 1) - slice_map(s)) / SliceLength;
+    for (size_type k = 0; k < len; ++k) {
+      ell_entries(base + k * SliceLength) = in_entries(begin + k);
+    }
+    for (size_type k = len; k < max_len; ++k) {
+      ell_entries(base + k * SliceLength) = data_type(0);
+    }
+    row_length(i) = data_type(len);
+  }
+};
+
+}  // namespace Impl
+
+namespace Experimental {
+
+/** \brief  Build a SlicedEllGraph from an existing StaticCrsGraph,
+ *          entirely in the graph's execution space.
+ */
+template <unsigned SliceLength = 32, class CrsGraphType>
+SlicedEllGraph<CrsGraphType, SliceLength> create_sliced_ell_graph(
+    const CrsGraphType& input, const std::string& label = "sliced_ell") {
+  typedef SlicedEllGraph<CrsGraphType, SliceLength> output_type;
+  typedef typename CrsGraphType::execution_space execution_space;
+  typedef typename CrsGraphType::size_type size_type;
+
+  typedef View<size_type*, typename CrsGraphType::array_layout,
+               typename CrsGraphType::device_type,
+               typename CrsGraphType::memory_traits>
+      work_type;
+  typedef View<typename CrsGraphType::data_type*,
+               typename CrsGraphType::array_layout,
+               typename CrsGraphType::device_type,
+               typename CrsGraphType::memory_traits>
+      lengths_work_type;
+
+  const size_type num_rows = input.numRows();
+  const size_type num_slices =
+      (num_rows + SliceLength - 1) / size_type(SliceLength);
+
+  output_type output;
+
+  // Padded size of every slice:
+  work_type slice_sizes(
+      ViewAllocateWithoutInitializing(label + "_slice_sizes"), num_slices);
+  {
+    Kokkos::Impl::SlicedEllSliceSizes<CrsGraphType, work_type, SliceLength>
+        sizes = {input.row_map, slice_sizes, num_rows};
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<execution_space>(0, num_slices), sizes);
+  }
+
+  // Slice offsets by parallel_scan, total gives the padded allocation:
+  work_type slice_work(ViewAllocateWithoutInitializing(label + "_slice_map"),
+                       num_slices + 1);
+  Kokkos::Impl::CrsRowMapFromCounts<work_type, work_type> scan(slice_sizes,
+                                                               slice_work);
+  const size_type total = scan.execute();
+
+  typename output_type::entries_type ell_entries(
+      ViewAllocateWithoutInitializing(label), total);
+  lengths_work_type lengths(
+      ViewAllocateWithoutInitializing(label + "_row_length"), num_rows);
+
+  {
+    Kokkos::Impl::SlicedEllFillEntries<CrsGraphType, work_type,
+                                       typename output_type::entries_type,
+                                       lengths_work_type, SliceLength>
+        fill = {input.row_map, input.entries, slice_work, ell_entries,
+                lengths};
+    Kokkos::parallel_for(Kokkos::RangePolicy<execution_space>(0, num_rows),
+                         fill);
+  }
+  execution_space().fence();
+
+  output.entries    = ell_entries;
+  output.slice_map  = slice_work;
+  output.row_length = lengths;
+
+  return output;
+}
+
+}  // namespace Experimental
+
+}  // namespace Kokkos
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
 #endif /* #ifndef KOKKOS_CRSARRAY_HPP */
@@ -367,16 +367,24 @@ class UnorderedMap {
 
   /// \brief Change the capacity of the the map
   ///
-  /// If there are no failed inserts the current size of the map will
-  /// be used as a lower bound for the input capacity.
-  /// If the map is not empty and does not have failed inserts
-  /// and the capacity changes then the current data is copied
-  /// into the resized / rehashed map.
+  /// The current size of the map is used as a lower bound for the input
+  /// capacity.  Entries are migrated into the resized map by a single
+  /// parallel kernel over the old buckets; there is no host-side
+  /// re-insertion.
+  ///
+  /// When the map has failed inserts and no explicit capacity is
+  /// requested the capacity grows geometrically, so the standard
+  /// overflow-recovery sequence is one rehash() call followed by
+  /// re-issuing the failed inserts.  A successful rehash clears the
+  /// failed-insert flag; inserts that fail during migration itself are
+  /// reported through failed_insert() of the rehashed map.
   ///
   /// This is <i>not</i> a device function; it may <i>not</i> be
   /// called in a parallel kernel.
   bool rehash(size_type requested_capacity = 0) {
     const bool bounded_insert = (capacity() == 0) || (size() == 0u);
+    if (requested_capacity == 0 && failed_insert())
+      requested_capacity = capacity() ? capacity() * 2u : 128u;
     return rehash(requested_capacity, bounded_insert);
   }
 
@@ -457,6 +465,39 @@ class UnorderedMap {
   KOKKOS_FORCEINLINE_FUNCTION
   size_type capacity() const { return m_available_indexes.size(); }
 
+  /// \brief Attempt to insert a batch of entries with one kernel launch.
+  ///
+  /// Returns a bitset with one bit per input element, set where that
+  /// element's insert failed.  If duplicate keys are grouped adjacently
+  /// (for example when the batch is sorted) only the first element of
+  /// each run performs a contended insert; the remaining elements of the
+  /// run resolve their result through an uncontended lookup.  Sorting the
+  /// batch is left to the caller, e.g. with BinSort from the algorithms
+  /// subpackage, which cannot be used here without inverting the package
+  /// dependency.
+  ///
+  /// This is <i>not</i> a device function; it may <i>not</i> be
+  /// called in a parallel kernel.
+  template <typename KeysView, typename ValuesView>
+  typename std::enable_if<Kokkos::is_view<KeysView>::value &&
+                              Kokkos::is_view<ValuesView>::value,
+                          Kokkos::Bitset<device_type>>::type
+  insert(KeysView const &keys, ValuesView const &values) const {
+    Kokkos::Bitset<device_type> failed(keys.extent(0));
+    Impl::UnorderedMapBulkInsert<declared_map_type, KeysView, ValuesView> f(
+        *this, keys, values, failed);
+    f.apply();
+    return failed;
+  }
+
+  /// \brief Batch insert for maps used as sets (Value = void).
+  template <typename KeysView>
+  typename std::enable_if<Kokkos::is_view<KeysView>::value,
+                          Kokkos::Bitset<device_type>>::type
+  insert(KeysView const &keys) const {
+    return insert(keys, keys);
+  }
+
   /// \brief The number of hash table "buckets."
   ///
   /// This is different than the number of entries that the table can
@@ -212,13 +212,73 @@ class vector : public DualView<Scalar*, LayoutLeft, Arg1Type> {
     return begin() + start;
   }
 
-  size_type size() const { return _size; }
+  /* Append the contents of a rank-1 view in one bulk deep_copy, growing the
+   * storage with the usual over-allocation factor.  The copy lands on
+   * whichever side (host or device) currently holds the up-to-date data, so
+   * appending a device view to a device-resident vector never touches the
+   * host. */
+  template <class DT, class... DP>
+  void append(const Kokkos::View<DT, DP...>& src) {
+    static_assert(unsigned(Kokkos::View<DT, DP...>::rank) == 1,
+                  "Kokkos::vector::append requires a rank-1 View");
+    const size_t count    = src.extent(0);
+    const size_t old_size = _size;
+    if (count == 0) return;
+    if (old_size + count > span()) {
+      size_t new_span = size_t((old_size + count) * _extra_storage);
+      if (new_span < old_size + count) new_span = old_size + count;
+      DV::resize(new_span);
+    }
+    _size      = old_size + count;
+    auto range = std::make_pair(old_size, old_size + count);
+    if (DV::template need_sync<typename DV::t_dev::device_type>()) {
+      Kokkos::deep_copy(Kokkos::subview(DV::h_view, range), src);
+      DV::template modify<typename DV::t_host::device_type>();
+    } else {
+      Kokkos::deep_copy(Kokkos::subview(DV::d_view, range), src);
+      DV::template modify<typename DV::t_dev::device_type>();
+    }
+  }
+
+  /* Remove all elements satisfying the predicate with a device-side
+   * compaction scan, preserving the relative order of the kept elements.
+   * The predicate must be callable on the device with a const element.
+   * Returns the number of removed elements. */
+  template <class UnaryPredicate>
+  size_type erase_if(UnaryPredicate pred) {
+    const size_t n = _size;
+    if (n == 0) return 0;
+    DV::template sync<typename DV::t_dev::device_type>();
+
+    typename DV::t_dev compacted(
+        Kokkos::ViewAllocateWithoutInitializing("Kokkos::vector::erase_if"),
+        n);
+    Kokkos::View<size_t, typename DV::t_dev::device_type> new_size_dev(
+        "Kokkos::vector::erase_if::size");
+    erase_if_functor<UnaryPredicate> f(DV::d_view, compacted, new_size_dev,
+                                       pred, n);
+    parallel_scan(
+        Kokkos::RangePolicy<typename DV::t_dev::execution_space>(0, n), f);
+
+    size_t new_size = 0;
+    Kokkos::deep_copy(new_size, new_size_dev);
+    if (new_size < n) {
+      auto range = std::make_pair(size_t(0), new_size);
+      Kokkos::deep_copy(Kokkos::subview(DV::d_view, range),
+                        Kokkos::subview(compacted, range));
+      _size = new_size;
+      DV::template modify<typename DV::t_dev::device_type>();
+    }
+    return n - new_size;
+  }
+
+  KOKKOS_INLINE_FUNCTION size_type size() const { return _size; }
   size_type max_size() const { return 2000000000; }
 #ifdef KOKKOS_ENABLE_DEPRECATED_CODE
   size_type capacity() const { return DV::capacity(); }
 #endif
   size_type span() const { return DV::span(); }
-  bool empty() const { return _size == 0; }
+  KOKKOS_INLINE_FUNCTION bool empty() const { return _size == 0; }
 
   iterator begin() const { return DV::h_view.data(); }
 
@@ -331,6 +391,34 @@ class vector : public DualView<Scalar*, LayoutLeft, Arg1Type> {
     KOKKOS_INLINE_FUNCTION
     void operator()(const int& i) const { _data(i) = _val; }
   };
+
+  template <class UnaryPredicate>
+  struct erase_if_functor {
+    typedef typename DV::t_dev::execution_space execution_space;
+    typedef size_t value_type;
+    typename DV::t_dev _src;
+    typename DV::t_dev _dst;
+    Kokkos::View<size_t, typename DV::t_dev::device_type> _new_size;
+    UnaryPredicate _pred;
+    size_t _n;
+
+    erase_if_functor(typename DV::t_dev src, typename DV::t_dev dst,
+                     Kokkos::View<size_t, typename DV::t_dev::device_type>
+                         new_size,
+                     UnaryPredicate pred, size_t n)
+        : _src(src), _dst(dst), _new_size(new_size), _pred(pred), _n(n) {}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const int& i, size_t& offset, const bool& final) const {
+      const Scalar val = _src(i);
+      const bool keep  = !_pred(val);
+      if (final) {
+        if (keep) _dst(offset) = val;
+        if (size_t(i) == _n - 1) _new_size() = offset + (keep ? 1 : 0);
+      }
+      if (keep) ++offset;
+    }
+  };
 };
 
 }  // namespace Kokkos
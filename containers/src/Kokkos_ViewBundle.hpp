@@ -0,0 +1,264 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_ViewBundle.hpp
+/// \brief Declaration and definition of Kokkos::Experimental::ViewBundle.
+///
+/// This header file declares and defines
+/// Kokkos::Experimental::ViewBundle and associated free functions.
+
+#ifndef KOKKOS_VIEWBUNDLE_HPP
+#define KOKKOS_VIEWBUNDLE_HPP
+
+#include <Kokkos_Core.hpp>
+
+#include <string>
+
+namespace Kokkos {
+namespace Experimental {
+
+/// \brief Compile-time list of the member view data types of a ViewBundle.
+template <class... Types>
+struct ViewTypes {
+  enum { size = sizeof...(Types) };
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+namespace Kokkos {
+namespace Impl {
+
+template <unsigned I, class... Types>
+struct ViewBundleMemberType;
+
+template <unsigned I, class T, class... Types>
+struct ViewBundleMemberType<I, T, Types...>
+    : ViewBundleMemberType<I - 1, Types...> {};
+
+template <class T, class... Types>
+struct ViewBundleMemberType<0, T, Types...> {
+  typedef T type;
+};
+
+constexpr size_t view_bundle_align_up(size_t x, size_t a) {
+  return ((x + a - 1) / a) * a;
+}
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  Several Views of mixed data type and rank carved from one
+ *          contiguous allocation.
+ *
+ *  A ViewBundle registers N view data types once and places all N
+ *  member views back-to-back in a single backing buffer, with each
+ *  member's byte span computed through the ViewMapping machinery and
+ *  its offset aligned to KOKKOS_MEMORY_ALIGNMENT.  Because the members
+ *  are contiguous, the backing buffer IS the packed message: a halo
+ *  exchange that packed 40 small Views with one kernel and one copy
+ *  apiece collapses to writing through the member views plus one bulk
+ *  transfer of the bundle.
+ *
+ *  get<I>() returns an unmanaged View of member I; it does not extend
+ *  the lifetime of the bundle, so keep the ViewBundle alive while
+ *  member views are in use.  All members share one array layout type so
+ *  a bundle and its HostMirror have byte-identical packing, which makes
+ *  bundle-to-bundle deep_copy a single contiguous transfer.
+ */
+template <class ViewTypesT, class DeviceType = Kokkos::DefaultExecutionSpace,
+          class Layout =
+              typename DeviceType::execution_space::array_layout>
+class ViewBundle;
+
+template <class... DataTypes, class DeviceType, class Layout>
+class ViewBundle<ViewTypes<DataTypes...>, DeviceType, Layout> {
+ public:
+  typedef ViewTypes<DataTypes...> view_types;
+  typedef DeviceType device_type;
+  typedef typename device_type::execution_space execution_space;
+  typedef typename device_type::memory_space memory_space;
+  typedef Layout array_layout;
+  typedef size_t size_type;
+
+  enum : unsigned { number_of_members = sizeof...(DataTypes) };
+
+  static_assert(0 < sizeof...(DataTypes),
+                "ViewBundle requires at least one member view");
+
+  /// \brief Data type of member I.
+  template <unsigned I>
+  struct member {
+    typedef
+        typename Kokkos::Impl::ViewBundleMemberType<I, DataTypes...>::type type;
+  };
+
+  /// \brief Unmanaged View type of member I.
+  template <unsigned I>
+  using member_view_type =
+      Kokkos::View<typename member<I>::type, array_layout, device_type,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  typedef Kokkos::View<char*, device_type> buffer_type;
+
+  typedef ViewBundle<view_types,
+                     typename buffer_type::HostMirror::device_type, Layout>
+      HostMirror;
+
+  ViewBundle() : m_buffer(), m_offset{} {}
+
+  /** \brief  Allocate the bundle; one layout per member view. */
+  template <class... Layouts>
+  ViewBundle(const std::string& arg_label, const Layouts&... arg_layouts)
+      : m_layout{array_layout(arg_layouts)...} {
+    static_assert(sizeof...(Layouts) == number_of_members,
+                  "ViewBundle requires one layout per member view");
+
+    const size_type spans[number_of_members] = {
+        member_span<DataTypes>(array_layout(arg_layouts))...};
+
+    m_offset[0] = 0;
+    for (unsigned i = 0; i < number_of_members; ++i) {
+      m_offset[i + 1] = Kokkos::Impl::view_bundle_align_up(
+          m_offset[i] + spans[i], KOKKOS_MEMORY_ALIGNMENT);
+    }
+
+    m_buffer = buffer_type(Kokkos::view_alloc(arg_label, WithoutInitializing),
+                           m_offset[number_of_members]);
+  }
+
+  /// \brief Unmanaged View of member I over the shared allocation.
+  template <unsigned I>
+  member_view_type<I> get() const {
+    typedef member_view_type<I> view_type;
+    return view_type(reinterpret_cast<typename view_type::pointer_type>(
+                         m_buffer.data() + m_offset[I]),
+                     m_layout[I]);
+  }
+
+  /// \brief Byte offset of member I within the backing buffer.
+  size_type offset(const unsigned i) const { return m_offset[i]; }
+
+  /// \brief Total bytes of the backing buffer, including alignment padding.
+  size_type span() const { return m_buffer.extent(0); }
+
+  /// \brief The contiguous backing buffer; members are packed inside it,
+  ///        so this View is the bundle's wire format.
+  buffer_type buffer() const { return m_buffer; }
+
+  char* data() const { return m_buffer.data(); }
+
+  std::string label() const { return m_buffer.label(); }
+
+ private:
+  /* Byte span a member view of the given data type needs under the
+   * given layout, from the view's mapping. */
+  template <class DataType>
+  static size_type member_span(const array_layout& arg_layout) {
+    typedef Kokkos::View<DataType, array_layout, device_type,
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged>>
+        view_type;
+    typedef Kokkos::Impl::ViewMapping<typename view_type::traits, void>
+        mapping_type;
+    return mapping_type::memory_span(arg_layout);
+  }
+
+  buffer_type m_buffer;
+  size_type m_offset[number_of_members + 1];
+  array_layout m_layout[number_of_members];
+
+  template <class, class, class>
+  friend class ViewBundle;
+
+  template <class VT, class DstDevice, class SrcDevice, class L>
+  friend void deep_copy(ViewBundle<VT, DstDevice, L>& dst,
+                        const ViewBundle<VT, SrcDevice, L>& src);
+
+  template <class VT, class DD, class L>
+  friend typename ViewBundle<VT, DD, L>::HostMirror create_mirror(
+      const ViewBundle<VT, DD, L>& src);
+};
+
+/// \brief Copy the contents of one ViewBundle into another with the
+///        same member types and layout, possibly across memory spaces.
+///
+/// Both bundles pack their members identically, so this is one bulk
+/// byte copy of the shared allocation covering every member view.
+template <class ViewTypesT, class DstDevice, class SrcDevice, class Layout>
+inline void deep_copy(ViewBundle<ViewTypesT, DstDevice, Layout>& dst,
+                      const ViewBundle<ViewTypesT, SrcDevice, Layout>& src) {
+  if (dst.span() != src.span()) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::deep_copy( ViewBundle ): bundles have different extents, "
+        "construct the destination with create_mirror()");
+  }
+  Kokkos::deep_copy(dst.m_buffer, src.m_buffer);
+}
+
+/// \brief Allocate a host bundle with the same member layouts and
+///        packing as \c src, suitable as the target of a bundle
+///        deep_copy.
+template <class ViewTypesT, class DeviceType, class Layout>
+inline typename ViewBundle<ViewTypesT, DeviceType, Layout>::HostMirror
+create_mirror(const ViewBundle<ViewTypesT, DeviceType, Layout>& src) {
+  typedef typename ViewBundle<ViewTypesT, DeviceType, Layout>::HostMirror
+      mirror_type;
+
+  mirror_type mirror;
+  for (unsigned i = 0; i < mirror_type::number_of_members; ++i) {
+    mirror.m_offset[i + 1] = src.m_offset[i + 1];
+    mirror.m_layout[i]     = src.m_layout[i];
+  }
+  mirror.m_buffer = typename mirror_type::buffer_type(
+      Kokkos::view_alloc(src.label(), WithoutInitializing), src.span());
+  return mirror;
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_VIEWBUNDLE_HPP */
@@ -0,0 +1,177 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+/// \file Kokkos_WriteCombiningView.hpp
+/// \brief Declaration and definition of Kokkos::WriteCombiningView.
+///
+/// This header file declares and defines Kokkos::WriteCombiningView and
+/// associated free functions.
+
+#ifndef KOKKOS_WRITECOMBININGVIEW_HPP
+#define KOKKOS_WRITECOMBININGVIEW_HPP
+
+#include <Kokkos_Core.hpp>
+
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  Staged atomic accumulation into a rank-1 View.
+ *
+ *  An atomic-access View turns every contribution into a contended
+ *  read-modify-write on the destination.  A WriteCombiningView instead
+ *  stages (index, value) contributions in a small per-thread buffer,
+ *  indexed through a UniqueToken, and applies them with atomics only
+ *  when a thread's buffer fills or flush() is called.  Consecutive
+ *  contributions to the same index combine in the buffer without any
+ *  atomic at all, which is the common pattern in finite-element
+ *  assembly where one element touches the same row repeatedly.
+ *
+ *  Copies are shallow and share both the destination and the staging
+ *  buffers.  Call flush() after the contributing kernels have completed
+ *  (and before reading the destination); contributions staged by a
+ *  kernel are not visible in the destination until then.
+ */
+template <class ViewType>
+class WriteCombiningView {
+ public:
+  using view_type       = ViewType;
+  using execution_space = typename view_type::execution_space;
+  using memory_space    = typename view_type::memory_space;
+  using value_type      = typename view_type::non_const_value_type;
+  using size_type       = typename view_type::size_type;
+
+  static_assert(unsigned(view_type::rank) == 1,
+                "WriteCombiningView only supports rank-1 Views");
+
+ private:
+  using device_type = typename view_type::device_type;
+  using index_buffer_type =
+      Kokkos::View<size_type**, Kokkos::LayoutRight, device_type>;
+  using value_buffer_type =
+      Kokkos::View<value_type**, Kokkos::LayoutRight, device_type>;
+  using count_type = Kokkos::View<int*, device_type>;
+  using token_type = UniqueToken<execution_space>;
+
+  view_type m_view;
+  token_type m_token;
+  index_buffer_type m_idx;
+  value_buffer_type m_val;
+  count_type m_count;
+
+  KOKKOS_INLINE_FUNCTION
+  void drain(int t, int n) const {
+    for (int j = 0; j < n; ++j) {
+      Kokkos::atomic_add(&m_view(m_idx(t, j)), m_val(t, j));
+    }
+    m_count(t) = 0;
+  }
+
+ public:
+  WriteCombiningView() = default;
+
+  /// \brief stage contributions to arg_view, arg_capacity entries per
+  /// concurrent thread
+  WriteCombiningView(view_type const& arg_view, int arg_capacity = 256)
+      : m_view(arg_view),
+        m_token(),
+        m_idx(view_alloc("Kokkos::WriteCombiningView::idx",
+                         WithoutInitializing),
+              m_token.size(), arg_capacity),
+        m_val(view_alloc("Kokkos::WriteCombiningView::val",
+                         WithoutInitializing),
+              m_token.size(), arg_capacity),
+        m_count("Kokkos::WriteCombiningView::count", m_token.size()) {}
+
+  /// \brief the destination View
+  view_type const& destination() const { return m_view; }
+
+  /// \brief stage the contribution v to entry i of the destination
+  KOKKOS_INLINE_FUNCTION
+  void add(size_type i, value_type const& v) const {
+    auto const t = m_token.acquire();
+    int n        = m_count(t);
+    if (0 < n && m_idx(t, n - 1) == i) {
+      // combine with the immediately preceding contribution
+      m_val(t, n - 1) += v;
+    } else {
+      if (n == int(m_idx.extent(1))) {
+        drain(t, n);
+        n = 0;
+      }
+      m_idx(t, n) = i;
+      m_val(t, n) = v;
+      m_count(t)  = n + 1;
+    }
+    m_token.release(t);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(int t) const { drain(t, m_count(t)); }
+
+  /// \brief apply all staged contributions to the destination
+  ///
+  /// Call from host code after the contributing kernels have completed.
+  void flush() {
+    Kokkos::parallel_for("Kokkos::WriteCombiningView::flush",
+                         Kokkos::RangePolicy<execution_space>(
+                             0, int(m_count.extent(0))),
+                         *this);
+    Kokkos::fence();
+  }
+};
+
+/// \brief convenience function to deduce the View type
+template <class DataType, class... Properties>
+WriteCombiningView<Kokkos::View<DataType, Properties...>>
+create_write_combining_view(Kokkos::View<DataType, Properties...> const& view,
+                            int capacity = 256) {
+  return WriteCombiningView<Kokkos::View<DataType, Properties...>>(view,
+                                                                   capacity);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_WRITECOMBININGVIEW_HPP
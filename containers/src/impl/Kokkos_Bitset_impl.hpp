@@ -95,6 +95,100 @@ struct BitsetCount {
   }
 };
 
+// Compact the indices of all set bits into an output view with a single
+// parallel_scan over the blocks.  Entries beyond the extent of the
+// output view are counted but not written.
+template <typename Bitset, typename OutView>
+struct BitsetExtract {
+  typedef Bitset bitset_type;
+  typedef
+      typename bitset_type::execution_space::execution_space execution_space;
+  typedef typename bitset_type::size_type size_type;
+  typedef size_type value_type;
+  typedef View<unsigned, execution_space> total_type;
+
+  bitset_type m_bitset;
+  OutView m_out;
+  total_type m_total;
+  unsigned m_num_blocks;
+
+  BitsetExtract(bitset_type const& bitset, OutView const& out)
+      : m_bitset(bitset),
+        m_out(out),
+        m_total("BitsetExtract::total"),
+        m_num_blocks(bitset.m_blocks.extent(0)) {}
+
+  unsigned apply() const {
+    parallel_scan(RangePolicy<execution_space>(0, m_num_blocks + 1), *this);
+    typename total_type::HostMirror total_host = create_mirror_view(m_total);
+    deep_copy(total_host, m_total);
+    return total_host();
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void init(value_type& update) const { update = 0u; }
+
+  KOKKOS_INLINE_FUNCTION
+  void join(volatile value_type& update,
+            const volatile value_type& input) const {
+    update += input;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(size_type i, value_type& update,
+                  const bool final_pass) const {
+    if (i < m_num_blocks) {
+      const unsigned block = m_bitset.m_blocks[i];
+      if (final_pass) {
+        size_type offset = update;
+        unsigned bits    = block;
+        while (bits) {
+          if (offset < m_out.extent(0)) {
+            m_out(offset) =
+                (i << bitset_type::block_shift) + bit_scan_forward(bits);
+          }
+          ++offset;
+          bits &= bits - 1u;
+        }
+      }
+      update += bit_count(block);
+    } else if (final_pass) {
+      m_total() = update;
+    }
+  }
+};
+
+enum BitsetBinaryOperation { BITSET_AND, BITSET_OR, BITSET_XOR };
+
+// Combine two bitsets block-wise into a third with one fused kernel.
+template <typename DstBitset, typename SrcBitset, BitsetBinaryOperation Op>
+struct BitsetBinaryOp {
+  typedef
+      typename DstBitset::execution_space::execution_space execution_space;
+  typedef typename DstBitset::size_type size_type;
+
+  DstBitset m_dst;
+  SrcBitset m_a;
+  SrcBitset m_b;
+
+  BitsetBinaryOp(DstBitset const& dst, SrcBitset const& a, SrcBitset const& b)
+      : m_dst(dst), m_a(a), m_b(b) {}
+
+  void apply() const {
+    parallel_for(RangePolicy<execution_space>(0, m_dst.m_blocks.extent(0)),
+                 *this);
+    execution_space().fence();
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(size_type i) const {
+    const unsigned a = m_a.m_blocks[i];
+    const unsigned b = m_b.m_blocks[i];
+    m_dst.m_blocks[i] =
+        Op == BITSET_AND ? (a & b) : Op == BITSET_OR ? (a | b) : (a ^ b);
+  }
+};
+
 }  // namespace Impl
 }  // namespace Kokkos
 
@@ -249,6 +249,100 @@ inline typename StaticCrsGraphType::staticcrsgraph_type create_staticcrsgraph(
   return output;
 }
 
+//----------------------------------------------------------------------------
+
+namespace Impl {
+
+// Invoke fill( row , ptr ) for every row of the graph, where ptr points
+// at the first entry of the row, following the convention of
+// Kokkos::count_and_fill_crs.
+template <class OutputType, class FunctorType>
+struct StaticCrsGraphFillEntries {
+  typedef typename OutputType::execution_space execution_space;
+  typedef typename OutputType::size_type size_type;
+  typedef typename OutputType::entries_type::value_type value_type;
+
+  OutputType m_graph;
+  FunctorType m_functor;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_type i) const {
+    const size_type j = m_graph.row_map(i);
+    // Do not form the address of entries(entries.size()), which can
+    // happen when row i and every row after it are empty.
+    value_type* const fill =
+        (j == size_type(m_graph.entries.extent(0))) ? nullptr
+                                                    : &m_graph.entries(j);
+    m_functor(i, fill);
+  }
+
+  typedef StaticCrsGraphFillEntries<OutputType, FunctorType> self_type;
+
+  StaticCrsGraphFillEntries(OutputType const& arg_graph,
+                            FunctorType const& arg_functor)
+      : m_graph(arg_graph), m_functor(arg_functor) {
+    typedef RangePolicy<size_type, execution_space> policy_type;
+    typedef Kokkos::Impl::ParallelFor<self_type, policy_type> closure_type;
+    const closure_type closure(*this,
+                               policy_type(0, m_graph.numRows()));
+    closure.execute();
+    execution_space().fence();
+  }
+};
+
+}  // namespace Impl
+
+template <class StaticCrsGraphType, class CountsViewType>
+inline typename StaticCrsGraphType::staticcrsgraph_type create_staticcrsgraph(
+    const std::string& label, const CountsViewType& counts,
+    typename Impl::enable_if<Kokkos::is_view<CountsViewType>::value>::type*) {
+  typedef StaticCrsGraphType output_type;
+  typedef typename output_type::entries_type entries_type;
+
+  static_assert(unsigned(CountsViewType::rank) == 1,
+                "Counts view must be rank one");
+
+  typedef View<typename output_type::size_type[],
+               typename output_type::array_layout,
+               typename output_type::execution_space,
+               typename output_type::memory_traits>
+      work_type;
+
+  output_type output;
+
+  // Create the row map by parallel_scan of the counts, all on device:
+
+  work_type row_work(ViewAllocateWithoutInitializing(label + "_row_map"),
+                     counts.extent(0) + 1);
+
+  Kokkos::Impl::CrsRowMapFromCounts<CountsViewType, work_type> scan(counts,
+                                                                    row_work);
+  const typename output_type::size_type total = scan.execute();
+
+  output.row_map = row_work;
+  output.entries = entries_type(ViewAllocateWithoutInitializing(label), total);
+
+  return output;
+}
+
+template <class StaticCrsGraphType, class CountsViewType,
+          class FillFunctorType>
+inline typename StaticCrsGraphType::staticcrsgraph_type create_staticcrsgraph(
+    const std::string& label, const CountsViewType& counts,
+    const FillFunctorType& fill,
+    typename Impl::enable_if<Kokkos::is_view<CountsViewType>::value>::type*) {
+  typedef StaticCrsGraphType output_type;
+
+  output_type output =
+      create_staticcrsgraph<StaticCrsGraphType>(label, counts);
+
+  // Fill in the entries:
+
+  Impl::StaticCrsGraphFillEntries<output_type, FillFunctorType>(output, fill);
+
+  return output;
+}
+
 }  // namespace Kokkos
 
 //----------------------------------------------------------------------------
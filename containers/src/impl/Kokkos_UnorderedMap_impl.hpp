@@ -79,6 +79,64 @@ struct UnorderedMapRehash {
   }
 };
 
+template <typename Map, typename KeysView, typename ValuesView>
+struct UnorderedMapBulkInsert {
+  typedef Map map_type;
+  typedef typename map_type::execution_space execution_space;
+  typedef typename map_type::size_type size_type;
+  typedef Kokkos::Bitset<typename map_type::device_type> bitset_type;
+
+  struct HeadTag {};
+  struct DuplicateTag {};
+
+  map_type m_map;
+  KeysView m_keys;
+  ValuesView m_values;
+  bitset_type m_failed;
+
+  UnorderedMapBulkInsert(map_type const& map, KeysView const& keys,
+                         ValuesView const& values, bitset_type const& failed)
+      : m_map(map), m_keys(keys), m_values(values), m_failed(failed) {}
+
+  void apply() const {
+    typedef RangePolicy<execution_space, HeadTag> head_policy;
+    typedef RangePolicy<execution_space, DuplicateTag> duplicate_policy;
+    parallel_for(head_policy(0, m_keys.extent(0)), *this);
+    execution_space().fence();
+    parallel_for(duplicate_policy(0, m_keys.extent(0)), *this);
+  }
+
+  template <bool IsSet = map_type::is_set>
+  KOKKOS_FORCEINLINE_FUNCTION
+      typename std::enable_if<!IsSet, typename map_type::insert_result>::type
+      do_insert(size_type i) const {
+    return m_map.insert(m_keys(i), m_values(i));
+  }
+
+  template <bool IsSet = map_type::is_set>
+  KOKKOS_FORCEINLINE_FUNCTION
+      typename std::enable_if<IsSet, typename map_type::insert_result>::type
+      do_insert(size_type i) const {
+    return m_map.insert(m_keys(i));
+  }
+
+  // Only the first element of a run of equal keys performs the contended
+  // insert; for sorted batches this costs one atomic per unique key.
+  KOKKOS_INLINE_FUNCTION
+  void operator()(HeadTag, size_type i) const {
+    if (0 < i && m_keys(i) == m_keys(i - 1)) return;
+    if (do_insert(i).failed()) m_failed.set(i);
+  }
+
+  // Elements skipped in the first pass take the outcome of their run's
+  // head through an uncontended lookup.
+  KOKKOS_INLINE_FUNCTION
+  void operator()(DuplicateTag, size_type i) const {
+    if (!(0 < i && m_keys(i) == m_keys(i - 1))) return;
+    if (!m_map.exists(m_keys(i))) m_failed.set(i);
+  }
+};
+
 template <typename UMap>
 struct UnorderedMapErase {
   typedef UMap map_type;
@@ -0,0 +1,190 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_TEST_CHANNEL_HPP
+#define KOKKOS_TEST_CHANNEL_HPP
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Channel.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace Test {
+
+namespace Impl {
+
+// Single-threaded walk along the full, empty and wrap-around
+// boundaries, where the slot sequence numbers are most easily
+// corrupted.
+inline void test_channel_boundaries() {
+  Kokkos::Experimental::Channel<int> channel("test_channel", 4);
+
+  const size_t capacity = channel.capacity();
+  ASSERT_LE(4u, capacity);
+  ASSERT_EQ(0u, capacity & (capacity - 1));  // rounded to a power of two
+
+  int value = -1;
+  ASSERT_FALSE(channel.try_pop(value));  // starts empty
+
+  // Fill to the brim; the next push must be refused, not lost.
+  for (size_t i = 0; i < capacity; ++i) {
+    ASSERT_TRUE(channel.try_push(int(i)));
+  }
+  ASSERT_FALSE(channel.try_push(int(capacity)));
+  ASSERT_EQ(capacity, channel.size());
+
+  // Drain in FIFO order back down to refused-empty.
+  for (size_t i = 0; i < capacity; ++i) {
+    ASSERT_TRUE(channel.try_pop(value));
+    ASSERT_EQ(int(i), value);
+  }
+  ASSERT_FALSE(channel.try_pop(value));
+
+  // March the cursors several times around the ring so every slot
+  // crosses the wrap-around with a non-zero sequence epoch.
+  for (size_t i = 0; i < 5 * capacity; ++i) {
+    channel.push(int(i));
+    channel.pop(value);
+    ASSERT_EQ(int(i), value);
+  }
+  ASSERT_FALSE(channel.try_pop(value));
+}
+
+// Drive producer and consumer threads through a channel much smaller
+// than the item count, so the run repeatedly hits full (producers
+// blocked), empty (consumers blocked) and wrap-around.  Every item is
+// tagged (producer, sequence); afterwards each tag must have been
+// consumed exactly once - nothing lost, nothing duplicated - and each
+// producer's items must have been claimed in its push order.
+inline void test_channel_stress(const int num_producers,
+                                const int num_consumers,
+                                const int items_per_producer) {
+  typedef int64_t item_type;
+
+  const int64_t total = int64_t(num_producers) * items_per_producer;
+  const item_type sentinel = -1;
+
+  Kokkos::Experimental::Channel<item_type> channel("stress_channel", 8);
+
+  std::vector<std::atomic<int> > seen(total);
+  for (int64_t i = 0; i < total; ++i) seen[i].store(0);
+  std::atomic<int> order_errors(0);
+
+  std::vector<std::thread> producers;
+  for (int p = 0; p < num_producers; ++p) {
+    producers.emplace_back([&, p]() {
+      for (int i = 0; i < items_per_producer; ++i) {
+        const item_type item = item_type(p) * items_per_producer + i;
+        if (i % 2) {
+          channel.push(item);
+        } else {
+          while (!channel.try_push(item)) std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  std::vector<std::thread> consumers;
+  for (int c = 0; c < num_consumers; ++c) {
+    consumers.emplace_back([&, c]() {
+      // Per-producer high-water mark: the channel is FIFO, so the
+      // items of one producer must reach any single consumer in push
+      // order.
+      std::vector<int> last(num_producers, -1);
+      for (;;) {
+        item_type item = 0;
+        if (c % 2) {
+          channel.pop(item);
+        } else {
+          while (!channel.try_pop(item)) std::this_thread::yield();
+        }
+        if (item == sentinel) break;
+        const int producer = int(item / items_per_producer);
+        const int sequence = int(item % items_per_producer);
+        if (sequence <= last[producer]) ++order_errors;
+        last[producer] = sequence;
+        seen[item].fetch_add(1);
+      }
+    });
+  }
+
+  for (size_t p = 0; p < producers.size(); ++p) producers[p].join();
+  // One sentinel per consumer releases them after the real items.
+  for (int c = 0; c < num_consumers; ++c) channel.push(sentinel);
+  for (size_t c = 0; c < consumers.size(); ++c) consumers[c].join();
+
+  int64_t lost       = 0;
+  int64_t duplicated = 0;
+  for (int64_t i = 0; i < total; ++i) {
+    const int count = seen[i].load();
+    if (count == 0) ++lost;
+    if (count > 1) ++duplicated;
+  }
+
+  ASSERT_EQ(0, lost);
+  ASSERT_EQ(0, duplicated);
+  ASSERT_EQ(0, order_errors.load());
+
+  item_type leftover = 0;
+  ASSERT_FALSE(channel.try_pop(leftover));
+}
+
+}  // namespace Impl
+
+TEST(TEST_CATEGORY, channel) {
+  Impl::test_channel_boundaries();
+  Impl::test_channel_stress(1, 1, 20000);
+  Impl::test_channel_stress(4, 4, 10000);
+  Impl::test_channel_stress(4, 2, 10000);
+  Impl::test_channel_stress(2, 4, 10000);
+}
+
+}  // namespace Test
+
+#endif  // KOKKOS_TEST_CHANNEL_HPP
@@ -0,0 +1,259 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_TEST_DEVICEQUEUE_HPP
+#define KOKKOS_TEST_DEVICEQUEUE_HPP
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_DeviceQueue.hpp>
+
+#include <stdexcept>
+#include <vector>
+
+namespace Test {
+
+namespace Impl {
+
+// Producer recording per-entry success, so the overflow test can
+// re-run exactly the producers whose pushes failed - the re-run
+// protocol the queue documents.
+template <class DeviceType>
+struct devicequeue_push {
+  typedef typename DeviceType::execution_space execution_space;
+
+  Kokkos::Experimental::DeviceQueue<int, DeviceType> queue;
+  Kokkos::View<int*, DeviceType> pushed;
+
+  devicequeue_push(Kokkos::Experimental::DeviceQueue<int, DeviceType> queue_,
+                   Kokkos::View<int*, DeviceType> pushed_)
+      : queue(queue_), pushed(pushed_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(int i) const {
+    if (!pushed(i) && queue.push(i)) pushed(i) = 1;
+  }
+};
+
+// Concurrent consumers: every pop must yield a distinct entry, and a
+// pop from the emptied queue must be refused.
+template <class DeviceType>
+struct devicequeue_pop {
+  typedef typename DeviceType::execution_space execution_space;
+  typedef int value_type;
+
+  Kokkos::Experimental::DeviceQueue<int, DeviceType> queue;
+  Kokkos::View<int*, DeviceType> seen;
+
+  devicequeue_pop(Kokkos::Experimental::DeviceQueue<int, DeviceType> queue_,
+                  Kokkos::View<int*, DeviceType> seen_)
+      : queue(queue_), seen(seen_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(int, int& errors) const {
+    int value = -1;
+    if (!queue.pop(value)) {
+      ++errors;
+    } else if (value < 0 || uint32_t(value) >= seen.extent(0)) {
+      ++errors;
+    } else if (0 != Kokkos::atomic_fetch_add(&seen(value), 1)) {
+      ++errors;
+    }
+  }
+};
+
+// Single-iteration probe for the stack discipline: pushes then pops in
+// one thread must come back in reverse order, and the final pop from
+// the empty queue must fail.
+template <class DeviceType>
+struct devicequeue_lifo {
+  typedef typename DeviceType::execution_space execution_space;
+  typedef int value_type;
+
+  Kokkos::Experimental::DeviceQueue<int, DeviceType> queue;
+  int count;
+
+  devicequeue_lifo(Kokkos::Experimental::DeviceQueue<int, DeviceType> queue_,
+                   const int count_)
+      : queue(queue_), count(count_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(int, int& errors) const {
+    for (int i = 0; i < count; ++i)
+      if (!queue.push(i)) ++errors;
+    for (int i = count - 1; 0 <= i; --i) {
+      int value = -1;
+      if (!queue.pop(value) || value != i) ++errors;
+    }
+    int leftover = -1;
+    if (queue.pop(leftover)) ++errors;
+  }
+};
+
+// Fill concurrently, drain to a dense View, check every entry arrived
+// exactly once.
+template <class DeviceType>
+void test_devicequeue_fill_drain(const int n) {
+  typedef typename DeviceType::execution_space execution_space;
+
+  Kokkos::Experimental::DeviceQueue<int, DeviceType> queue("test_queue", 128,
+                                                           1 << 20);
+  queue.reserve(n);
+  ASSERT_LE(uint64_t(n), queue.capacity());
+
+  Kokkos::View<int*, DeviceType> pushed("pushed", n);
+  Kokkos::parallel_for(Kokkos::RangePolicy<execution_space>(0, n),
+                       devicequeue_push<DeviceType>(queue, pushed));
+  execution_space().fence();
+
+  ASSERT_EQ(uint64_t(n), queue.size());
+  ASSERT_EQ(uint64_t(0), queue.failed_push());
+
+  Kokkos::View<int*, DeviceType> dst("dst", n);
+  ASSERT_EQ(uint64_t(n), queue.drain(dst));
+  ASSERT_EQ(uint64_t(0), queue.size());
+
+  auto h_dst = Kokkos::create_mirror_view(dst);
+  Kokkos::deep_copy(h_dst, dst);
+  std::vector<int> histogram(n, 0);
+  for (int i = 0; i < n; ++i) {
+    ASSERT_LE(0, h_dst(i));
+    ASSERT_GT(n, h_dst(i));
+    ++histogram[h_dst(i)];
+  }
+  for (int i = 0; i < n; ++i) ASSERT_EQ(1, histogram[i]);
+
+  // Draining into a too-small destination must throw, not truncate.
+  Kokkos::parallel_for(Kokkos::RangePolicy<execution_space>(0, n),
+                       devicequeue_push<DeviceType>(
+                           queue, Kokkos::View<int*, DeviceType>("again", n)));
+  execution_space().fence();
+  Kokkos::View<int*, DeviceType> small("small", n / 2);
+  ASSERT_THROW(queue.drain(small), std::runtime_error);
+}
+
+// Push past the reserved capacity: the overflow is tallied, entries
+// already stored are kept, and re-running only the failed producers
+// after reserve() completes the list.
+template <class DeviceType>
+void test_devicequeue_overflow(const int n) {
+  typedef typename DeviceType::execution_space execution_space;
+
+  Kokkos::Experimental::DeviceQueue<int, DeviceType> queue("test_queue", 128,
+                                                           1 << 20);
+  const uint64_t capacity = queue.capacity();
+  ASSERT_LT(capacity, uint64_t(n));
+
+  Kokkos::View<int*, DeviceType> pushed("pushed", n);
+  Kokkos::parallel_for(Kokkos::RangePolicy<execution_space>(0, n),
+                       devicequeue_push<DeviceType>(queue, pushed));
+  execution_space().fence();
+
+  ASSERT_EQ(capacity, queue.size());
+  ASSERT_EQ(uint64_t(n) - capacity, queue.failed_push());
+
+  // The shortfall is known; reserve and re-run the failed producers.
+  queue.reserve(n);
+  Kokkos::parallel_for(Kokkos::RangePolicy<execution_space>(0, n),
+                       devicequeue_push<DeviceType>(queue, pushed));
+  execution_space().fence();
+
+  ASSERT_EQ(uint64_t(n), queue.size());
+  ASSERT_EQ(uint64_t(0), queue.failed_push());
+
+  Kokkos::View<int*, DeviceType> dst("dst", n);
+  ASSERT_EQ(uint64_t(n), queue.drain(dst));
+
+  auto h_dst = Kokkos::create_mirror_view(dst);
+  Kokkos::deep_copy(h_dst, dst);
+  std::vector<int> histogram(n, 0);
+  for (int i = 0; i < n; ++i) ++histogram[h_dst(i)];
+  for (int i = 0; i < n; ++i) ASSERT_EQ(1, histogram[i]);
+}
+
+template <class DeviceType>
+void test_devicequeue_pop(const int n) {
+  typedef typename DeviceType::execution_space execution_space;
+
+  Kokkos::Experimental::DeviceQueue<int, DeviceType> queue("test_queue", 128,
+                                                           1 << 20);
+  queue.reserve(n);
+
+  // Stack discipline within one thread.
+  int errors = 0;
+  Kokkos::parallel_reduce(Kokkos::RangePolicy<execution_space>(0, 1),
+                          devicequeue_lifo<DeviceType>(queue, 100), errors);
+  ASSERT_EQ(0, errors);
+  ASSERT_EQ(uint64_t(0), queue.size());
+
+  // Concurrent pops each claim a distinct entry.
+  Kokkos::View<int*, DeviceType> pushed("pushed", n);
+  Kokkos::parallel_for(Kokkos::RangePolicy<execution_space>(0, n),
+                       devicequeue_push<DeviceType>(queue, pushed));
+  execution_space().fence();
+
+  Kokkos::View<int*, DeviceType> seen("seen", n);
+  errors = 0;
+  Kokkos::parallel_reduce(Kokkos::RangePolicy<execution_space>(0, n),
+                          devicequeue_pop<DeviceType>(queue, seen), errors);
+  ASSERT_EQ(0, errors);
+  ASSERT_EQ(uint64_t(0), queue.size());
+
+  auto h_seen = Kokkos::create_mirror_view(seen);
+  Kokkos::deep_copy(h_seen, seen);
+  for (int i = 0; i < n; ++i) ASSERT_EQ(1, h_seen(i));
+}
+
+}  // namespace Impl
+
+TEST(TEST_CATEGORY, devicequeue) {
+  Impl::test_devicequeue_fill_drain<TEST_EXECSPACE>(10007);
+  Impl::test_devicequeue_overflow<TEST_EXECSPACE>(1000);
+  Impl::test_devicequeue_pop<TEST_EXECSPACE>(4096);
+}
+
+}  // namespace Test
+
+#endif  // KOKKOS_TEST_DEVICEQUEUE_HPP
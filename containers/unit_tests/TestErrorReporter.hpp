@@ -103,6 +103,9 @@ struct ErrorReporterDriverBase {
     bool expect_full   = (reporter_capacity <= (test_size / 2));
     bool reported_full = m_errorReporter.full();
     EXPECT_EQ(expect_full, reported_full);
+
+    int expected_num_overflows = std::max(0, test_size / 2 - reporter_capacity);
+    EXPECT_EQ(expected_num_overflows, m_errorReporter.getNumOverflows());
   }
 };
 
@@ -0,0 +1,282 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_TEST_SLOTPOOL_HPP
+#define KOKKOS_TEST_SLOTPOOL_HPP
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_SlotPool.hpp>
+
+#include <stdexcept>
+
+namespace Test {
+
+namespace Impl {
+
+// All pool operations run inside kernels so the tests are valid for
+// pools living in device-only memory spaces.
+
+template <class DeviceType>
+struct slotpool_acquire_all {
+  typedef typename DeviceType::execution_space execution_space;
+  typedef typename DeviceType::memory_space memory_space;
+  typedef int value_type;
+
+  Kokkos::Experimental::SlotPool<memory_space> pool;
+  Kokkos::View<int*, DeviceType> slots;
+  Kokkos::View<int*, DeviceType> claims;
+
+  slotpool_acquire_all(Kokkos::Experimental::SlotPool<memory_space> pool_,
+                       Kokkos::View<int*, DeviceType> slots_,
+                       Kokkos::View<int*, DeviceType> claims_)
+      : pool(pool_), slots(slots_), claims(claims_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(int i, int& errors) const {
+    const int s = pool.acquire();
+    slots(i)    = s;
+    if (s < 0 || uint32_t(s) >= pool.capacity()) {
+      ++errors;
+    } else if (0 != Kokkos::atomic_fetch_add(&claims(s), 1)) {
+      // Two claimants were handed the same slot.
+      ++errors;
+    }
+  }
+};
+
+template <class DeviceType>
+struct slotpool_release_all {
+  typedef typename DeviceType::execution_space execution_space;
+  typedef typename DeviceType::memory_space memory_space;
+  typedef int value_type;
+
+  Kokkos::Experimental::SlotPool<memory_space> pool;
+  Kokkos::View<int*, DeviceType> slots;
+
+  slotpool_release_all(Kokkos::Experimental::SlotPool<memory_space> pool_,
+                       Kokkos::View<int*, DeviceType> slots_)
+      : pool(pool_), slots(slots_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(int i, int& errors) const {
+    if (pool.release(slots(i)) < 0) ++errors;
+  }
+};
+
+// Single-iteration probes for state only visible from the pool's
+// memory space: the used count, an acquire from a full pool, bulk
+// all-or-nothing refusal and the double-release diagnostic.
+template <class DeviceType>
+struct slotpool_probe {
+  typedef typename DeviceType::execution_space execution_space;
+  typedef typename DeviceType::memory_space memory_space;
+  typedef int value_type;
+
+  enum { USED_COUNT, ACQUIRE_FULL, BULK_REFUSED, DOUBLE_RELEASE };
+
+  Kokkos::Experimental::SlotPool<memory_space> pool;
+  int which;
+  int arg;
+
+  slotpool_probe(Kokkos::Experimental::SlotPool<memory_space> pool_,
+                 const int which_, const int arg_ = 0)
+      : pool(pool_), which(which_), arg(arg_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(int, int& result) const {
+    if (which == USED_COUNT) {
+      result = int(pool.used_count());
+    } else if (which == ACQUIRE_FULL) {
+      result = pool.acquire();
+    } else if (which == BULK_REFUSED) {
+      int local[64];
+      result = pool.acquire_bulk(arg, local);
+    } else if (which == DOUBLE_RELEASE) {
+      const int s = pool.acquire();
+      pool.release(s);
+      result = pool.release(s);
+    }
+  }
+};
+
+template <class DeviceType>
+int slotpool_probe_run(Kokkos::Experimental::SlotPool<
+                           typename DeviceType::memory_space> pool,
+                       const int which, const int arg = 0) {
+  typedef typename DeviceType::execution_space execution_space;
+  int result = 0;
+  Kokkos::parallel_reduce(Kokkos::RangePolicy<execution_space>(0, 1),
+                          slotpool_probe<DeviceType>(pool, which, arg), result);
+  return result;
+}
+
+// Concurrent churn: every iteration repeatedly claims a slot, stamps
+// the payload, verifies exclusive ownership and returns the slot.
+template <class DeviceType>
+struct slotpool_churn {
+  typedef typename DeviceType::execution_space execution_space;
+  typedef typename DeviceType::memory_space memory_space;
+  typedef int value_type;
+
+  Kokkos::Experimental::SlotPool<memory_space> pool;
+  Kokkos::View<int*, DeviceType> owner;
+  Kokkos::View<int*, DeviceType> payload;
+  int rounds;
+
+  slotpool_churn(Kokkos::Experimental::SlotPool<memory_space> pool_,
+                 Kokkos::View<int*, DeviceType> owner_,
+                 Kokkos::View<int*, DeviceType> payload_, const int rounds_)
+      : pool(pool_), owner(owner_), payload(payload_), rounds(rounds_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(int i, int& errors) const {
+    for (int r = 0; r < rounds; ++r) {
+      const int s = pool.acquire_near(uint32_t(i + r));
+      if (s < 0) continue;  // full under contention is legal
+      if (0 != Kokkos::atomic_fetch_add(&owner(s), 1)) ++errors;
+      payload(s) = i;
+      if (payload(s) != i) ++errors;  // exclusively ours until release
+      Kokkos::atomic_fetch_add(&owner(s), -1);
+      if (pool.release(s) < 0) ++errors;
+    }
+  }
+};
+
+template <class DeviceType>
+void test_slotpool_exclusive(const uint32_t capacity) {
+  typedef typename DeviceType::execution_space execution_space;
+  typedef typename DeviceType::memory_space memory_space;
+  typedef slotpool_probe<DeviceType> probe;
+
+  Kokkos::Experimental::SlotPool<memory_space> pool("test_slotpool", capacity);
+  ASSERT_EQ(capacity, pool.capacity());
+  ASSERT_EQ(0, slotpool_probe_run<DeviceType>(pool, probe::USED_COUNT));
+
+  Kokkos::View<int*, DeviceType> slots("slots", capacity);
+  Kokkos::View<int*, DeviceType> claims("claims", capacity);
+
+  // Claiming exactly 'capacity' slots concurrently must succeed with
+  // every slot handed out exactly once.
+  int errors = 0;
+  Kokkos::parallel_reduce(Kokkos::RangePolicy<execution_space>(0, capacity),
+                          slotpool_acquire_all<DeviceType>(pool, slots, claims),
+                          errors);
+  ASSERT_EQ(0, errors);
+  ASSERT_EQ(int(capacity), slotpool_probe_run<DeviceType>(pool, probe::USED_COUNT));
+
+  // The pool is full: one more claim must be refused, not invented.
+  ASSERT_EQ(-1, slotpool_probe_run<DeviceType>(pool, probe::ACQUIRE_FULL));
+
+  // Releasing every claim empties the pool again.
+  errors = 0;
+  Kokkos::parallel_reduce(Kokkos::RangePolicy<execution_space>(0, capacity),
+                          slotpool_release_all<DeviceType>(pool, slots), errors);
+  ASSERT_EQ(0, errors);
+  ASSERT_EQ(0, slotpool_probe_run<DeviceType>(pool, probe::USED_COUNT));
+
+  // Releasing a free slot reports the double-release diagnostic.
+  ASSERT_EQ(-1, slotpool_probe_run<DeviceType>(pool, probe::DOUBLE_RELEASE));
+}
+
+template <class DeviceType>
+void test_slotpool_bulk(const uint32_t capacity) {
+  typedef typename DeviceType::memory_space memory_space;
+  typedef slotpool_probe<DeviceType> probe;
+
+  Kokkos::Experimental::SlotPool<memory_space> pool("test_slotpool", capacity);
+
+  // A bulk claim within capacity succeeds and claims exactly 'count'.
+  ASSERT_EQ(int(capacity / 2),
+            slotpool_probe_run<DeviceType>(pool, probe::BULK_REFUSED,
+                                           int(capacity / 2)));
+  ASSERT_EQ(int(capacity / 2),
+            slotpool_probe_run<DeviceType>(pool, probe::USED_COUNT));
+
+  // A claim larger than the remaining free slots must be refused
+  // without leaking partial claims.
+  ASSERT_EQ(-1, slotpool_probe_run<DeviceType>(pool, probe::BULK_REFUSED,
+                                               int(capacity / 2 + 1)));
+  ASSERT_EQ(int(capacity / 2),
+            slotpool_probe_run<DeviceType>(pool, probe::USED_COUNT));
+}
+
+template <class DeviceType>
+void test_slotpool_churn(const uint32_t capacity, const int claimants,
+                         const int rounds) {
+  typedef typename DeviceType::execution_space execution_space;
+  typedef typename DeviceType::memory_space memory_space;
+  typedef slotpool_probe<DeviceType> probe;
+
+  Kokkos::Experimental::SlotPool<memory_space> pool("test_slotpool", capacity);
+  Kokkos::View<int*, DeviceType> owner("owner", capacity);
+  Kokkos::View<int*, DeviceType> payload("payload", capacity);
+
+  int errors = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<execution_space>(0, claimants),
+      slotpool_churn<DeviceType>(pool, owner, payload, rounds), errors);
+  ASSERT_EQ(0, errors);
+  // Everything claimed in the churn was released.
+  ASSERT_EQ(0, slotpool_probe_run<DeviceType>(pool, probe::USED_COUNT));
+}
+
+}  // namespace Impl
+
+TEST(TEST_CATEGORY, slotpool) {
+  ASSERT_THROW(Kokkos::Experimental::SlotPool<
+                   typename TEST_EXECSPACE::memory_space>("empty", 0),
+               std::runtime_error);
+
+  Impl::test_slotpool_exclusive<TEST_EXECSPACE>(1);
+  Impl::test_slotpool_exclusive<TEST_EXECSPACE>(1024);
+  Impl::test_slotpool_bulk<TEST_EXECSPACE>(64);
+  Impl::test_slotpool_churn<TEST_EXECSPACE>(16, 1024, 25);
+  Impl::test_slotpool_churn<TEST_EXECSPACE>(512, 2048, 10);
+}
+
+}  // namespace Test
+
+#endif  // KOKKOS_TEST_SLOTPOOL_HPP
@@ -238,6 +238,56 @@ void test_failed_insert(uint32_t num_nodes) {
   EXPECT_TRUE(map.failed_insert());
 }
 
+// Overflow recovery: a no-argument rehash after failed inserts must
+// grow the capacity geometrically, keep every entry already inserted,
+// clear the failed-insert flag, and leave room for the re-issued
+// inserts to complete without a further rehash.
+template <typename Device>
+void test_rehash_growth(uint32_t num_nodes) {
+  typedef Kokkos::UnorderedMap<uint32_t, uint32_t, Device> map_type;
+
+  map_type map(num_nodes);
+  const uint32_t original_capacity = map.capacity();
+
+  // Twice as many distinct keys as the capacity holds: overflow.
+  Impl::TestInsert<map_type> test_insert(map, 2u * original_capacity, 1u);
+  test_insert.testit(false /*don't rehash on fail*/);
+  typename Device::execution_space().fence();
+  EXPECT_TRUE(map.failed_insert());
+
+  const uint32_t size_before = map.size();
+  EXPECT_TRUE(map.rehash());
+  EXPECT_LE(2u * original_capacity, map.capacity());
+  EXPECT_FALSE(map.failed_insert());
+  EXPECT_EQ(size_before, map.size());  // migration kept every entry
+
+  // Re-issuing the same inserts now completes.
+  Impl::TestInsert<map_type> test_reissue(map, 2u * original_capacity, 1u);
+  test_reissue.testit(false /*don't rehash on fail*/);
+  typename Device::execution_space().fence();
+  EXPECT_FALSE(map.failed_insert());
+  EXPECT_EQ(2u * original_capacity, map.size());
+
+  {
+    uint32_t find_errors = 0;
+    Impl::TestFind<map_type> test_find(map, 2u * original_capacity, 1u);
+    test_find.testit(find_errors);
+    EXPECT_EQ(0u, find_errors);
+  }
+
+  // An explicitly requested capacity is still honored verbatim when
+  // inserts have failed; only the no-argument form grows on its own.
+  map_type small(num_nodes);
+  Impl::TestInsert<map_type> test_overflow(small, 2u * small.capacity(), 1u);
+  test_overflow.testit(false /*don't rehash on fail*/);
+  typename Device::execution_space().fence();
+  EXPECT_TRUE(small.failed_insert());
+  const uint32_t requested = 4u * small.capacity();
+  EXPECT_TRUE(small.rehash(requested));
+  EXPECT_LE(requested, small.capacity());
+  EXPECT_FALSE(small.failed_insert());
+}
+
 template <typename Device>
 void test_deep_copy(uint32_t num_nodes) {
   typedef Kokkos::UnorderedMap<uint32_t, uint32_t, Device> map_type;
@@ -302,6 +352,10 @@ TEST(TEST_CATEGORY, UnorderedMap_failed_insert) {
   for (int i = 0; i < 1000; ++i) test_failed_insert<TEST_EXECSPACE>(10000);
 }
 
+TEST(TEST_CATEGORY, UnorderedMap_rehash_growth) {
+  for (int i = 0; i < 10; ++i) test_rehash_growth<TEST_EXECSPACE>(1000);
+}
+
 TEST(TEST_CATEGORY, UnorderedMap_deep_copy) {
   for (int i = 0; i < 2; ++i) test_deep_copy<TEST_EXECSPACE>(10000);
 }
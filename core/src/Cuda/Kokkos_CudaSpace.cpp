@@ -59,6 +59,7 @@
 //#include <Cuda/Kokkos_Cuda_BlockSize_Deduction.hpp>
 #include <impl/Kokkos_Error.hpp>
 #include <impl/Kokkos_MemorySpace.hpp>
+#include <Kokkos_MemoryAccounting.hpp>
 
 #if defined(KOKKOS_ENABLE_PROFILING)
 #include <impl/Kokkos_Profiling_Interface.hpp>
@@ -81,11 +82,56 @@ cudaStream_t get_deep_copy_stream() {
   }
   return s;
 }
+
+// Scope guard switching the process's current device, restoring it on
+// exit; a no-op when already current so the common single-device path
+// pays nothing.
+struct CudaDeviceScope {
+  int previous;
+  bool switched;
+
+  explicit CudaDeviceScope(const int device) : previous(device), switched(false) {
+    cudaGetDevice(&previous);
+    if (previous != device) {
+      cudaSetDevice(device);
+      switched = true;
+    }
+  }
+
+  ~CudaDeviceScope() {
+    if (switched) cudaSetDevice(previous);
+  }
+};
+
+// Device id when 'ptr' is device-resident memory, -1 otherwise.
+int cuda_device_of(const void *ptr) {
+  cudaPointerAttributes attr;
+  if (cudaSuccess != cudaPointerGetAttributes(&attr, ptr)) {
+    cudaGetLastError();
+    return -1;
+  }
+#if defined(CUDART_VERSION) && (CUDART_VERSION >= 10000)
+  if (cudaMemoryTypeDevice != attr.type) return -1;
+#else
+  if (cudaMemoryTypeDevice != attr.memoryType) return -1;
+#endif
+  return attr.device;
+}
+
 }  // namespace
 
 DeepCopy<CudaSpace, CudaSpace, Cuda>::DeepCopy(void *dst, const void *src,
                                                size_t n) {
-  CUDA_SAFE_CALL(cudaMemcpy(dst, src, n, cudaMemcpyDefault));
+  // Allocations from different devices take the explicit peer path,
+  // which the driver runs directly over NVLink / PCIe peer-to-peer
+  // when peer access is enabled instead of staging through the host.
+  const int dst_device = cuda_device_of(dst);
+  const int src_device = cuda_device_of(src);
+  if (0 <= dst_device && 0 <= src_device && dst_device != src_device) {
+    CUDA_SAFE_CALL(cudaMemcpyPeer(dst, dst_device, src, src_device, n));
+  } else {
+    CUDA_SAFE_CALL(cudaMemcpy(dst, src, n, cudaMemcpyDefault));
+  }
 }
 
 DeepCopy<HostSpace, CudaSpace, Cuda>::DeepCopy(void *dst, const void *src,
@@ -100,8 +146,15 @@ DeepCopy<CudaSpace, HostSpace, Cuda>::DeepCopy(void *dst, const void *src,
 
 DeepCopy<CudaSpace, CudaSpace, Cuda>::DeepCopy(const Cuda &instance, void *dst,
                                                const void *src, size_t n) {
-  CUDA_SAFE_CALL(
-      cudaMemcpyAsync(dst, src, n, cudaMemcpyDefault, instance.cuda_stream()));
+  const int dst_device = cuda_device_of(dst);
+  const int src_device = cuda_device_of(src);
+  if (0 <= dst_device && 0 <= src_device && dst_device != src_device) {
+    CUDA_SAFE_CALL(cudaMemcpyPeerAsync(dst, dst_device, src, src_device, n,
+                                       instance.cuda_stream()));
+  } else {
+    CUDA_SAFE_CALL(cudaMemcpyAsync(dst, src, n, cudaMemcpyDefault,
+                                   instance.cuda_stream()));
+  }
 }
 
 DeepCopy<HostSpace, CudaSpace, Cuda>::DeepCopy(const Cuda &instance, void *dst,
@@ -118,7 +171,21 @@ DeepCopy<CudaSpace, HostSpace, Cuda>::DeepCopy(const Cuda &instance, void *dst,
 
 void DeepCopyAsyncCuda(void *dst, const void *src, size_t n) {
   cudaStream_t s = get_deep_copy_stream();
-  CUDA_SAFE_CALL(cudaMemcpyAsync(dst, src, n, cudaMemcpyDefault, s));
+  const int dst_device = cuda_device_of(dst);
+  const int src_device = cuda_device_of(src);
+  if (0 <= dst_device && 0 <= src_device && dst_device != src_device) {
+    CUDA_SAFE_CALL(cudaMemcpyPeerAsync(dst, dst_device, src, src_device, n, s));
+  } else {
+    CUDA_SAFE_CALL(cudaMemcpyAsync(dst, src, n, cudaMemcpyDefault, s));
+  }
+  cudaStreamSynchronize(s);
+}
+
+DeepCopy2DCuda::DeepCopy2DCuda(void *dst, size_t dst_pitch, const void *src,
+                               size_t src_pitch, size_t width, size_t rows) {
+  cudaStream_t s = get_deep_copy_stream();
+  CUDA_SAFE_CALL(cudaMemcpy2DAsync(dst, dst_pitch, src, src_pitch, width, rows,
+                                   cudaMemcpyDefault, s));
   cudaStreamSynchronize(s);
 }
 
@@ -191,7 +258,81 @@ void kokkos_impl_cuda_set_pin_uvm_to_host(bool val) {
 
 namespace Kokkos {
 
-CudaSpace::CudaSpace() : m_device(Kokkos::Cuda().cuda_device()) {}
+CudaSpace::CudaSpace()
+    : m_device(Kokkos::Cuda().cuda_device()), m_stream(0) {}
+
+CudaSpace::CudaSpace(int arg_device_id)
+    : m_device(arg_device_id), m_stream(0) {
+  int count = 0;
+  cudaGetDeviceCount(&count);
+  if (arg_device_id < 0 || count <= arg_device_id) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::CudaSpace: device id out of range");
+  }
+}
+
+namespace Experimental {
+
+int cuda_device_count() {
+  int count = 0;
+  CUDA_SAFE_CALL(cudaGetDeviceCount(&count));
+  return count;
+}
+
+bool enable_cuda_peer_access(int arg_device, int arg_peer_device) {
+  if (arg_device == arg_peer_device) return true;
+
+  int can_access = 0;
+  CUDA_SAFE_CALL(
+      cudaDeviceCanAccessPeer(&can_access, arg_device, arg_peer_device));
+  if (!can_access) return false;
+
+  Kokkos::Impl::CudaDeviceScope scope(arg_device);
+  const cudaError_t error_code = cudaDeviceEnablePeerAccess(arg_peer_device, 0);
+  if (cudaErrorPeerAccessAlreadyEnabled == error_code) {
+    cudaGetLastError();
+    return true;
+  }
+  return cudaSuccess == error_code;
+}
+
+int enable_cuda_peer_access() {
+  const int count = cuda_device_count();
+  int enabled     = 0;
+  for (int device = 0; device < count; ++device) {
+    for (int peer = 0; peer < count; ++peer) {
+      if (device != peer && enable_cuda_peer_access(device, peer)) ++enabled;
+    }
+  }
+  return enabled;
+}
+
+}  // namespace Experimental
+
+namespace Impl {
+
+CudaSpace with_stream_ordered(const CudaSpace &arg_space,
+                              const Kokkos::Cuda &arg_exec) {
+#if defined(CUDART_VERSION) && (CUDART_VERSION >= 11020)
+  CudaSpace space = arg_space;
+  space.m_stream  = arg_exec.cuda_stream();
+  // Keep freed blocks in the device's default memory pool so they are
+  // recycled within the stream's ordering instead of returned to the
+  // driver on synchronization.
+  cudaMemPool_t pool = nullptr;
+  if (cudaSuccess == cudaDeviceGetDefaultMemPool(&pool, space.m_device)) {
+    uint64_t threshold = UINT64_MAX;
+    cudaMemPoolSetAttribute(pool, cudaMemPoolAttrReleaseThreshold, &threshold);
+  }
+  return space;
+#else
+  // Runtime without stream-ordered allocation: synchronous behavior.
+  (void)arg_exec;
+  return arg_space;
+#endif
+}
+
+}  // namespace Impl
 
 CudaUVMSpace::CudaUVMSpace() : m_device(Kokkos::Cuda().cuda_device()) {}
 
@@ -203,6 +344,29 @@ CudaHostPinnedSpace::CudaHostPinnedSpace() {}
 void *CudaSpace::allocate(const size_t arg_alloc_size) const {
   void *ptr = nullptr;
 
+  Kokkos::Impl::realtime_phase_vet("CudaSpace::allocate");
+  Kokkos::Impl::allocation_audit_note("CudaSpace::allocate", arg_alloc_size);
+
+  // Allocate on this instance's device, which need not be the
+  // process's current one.
+  Kokkos::Impl::CudaDeviceScope device_scope(m_device);
+
+#if defined(CUDART_VERSION) && (CUDART_VERSION >= 11020)
+  if (0 != m_stream) {
+    auto error_code = cudaMallocAsync(&ptr, arg_alloc_size, m_stream);
+    if (error_code != cudaSuccess) {  // TODO tag as unlikely branch
+      cudaGetLastError();  // This is the only way to clear the last error,
+                           // which we should do here since we're turning it
+                           // into an exception here
+      throw Experimental::CudaRawMemoryAllocationFailure(
+          arg_alloc_size, error_code,
+          Experimental::RawMemoryAllocationFailure::AllocationMechanism::
+              CudaMalloc);
+    }
+    return ptr;
+  }
+#endif
+
   auto error_code = cudaMalloc(&ptr, arg_alloc_size);
   if (error_code != cudaSuccess) {  // TODO tag as unlikely branch
     cudaGetLastError();  // This is the only way to clear the last error, which
@@ -279,6 +443,13 @@ void *CudaHostPinnedSpace::allocate(const size_t arg_alloc_size) const {
 void CudaSpace::deallocate(void *const arg_alloc_ptr,
                            const size_t /* arg_alloc_size */) const {
   try {
+    Kokkos::Impl::CudaDeviceScope device_scope(m_device);
+#if defined(CUDART_VERSION) && (CUDART_VERSION >= 11020)
+    if (0 != m_stream) {
+      CUDA_SAFE_CALL(cudaFreeAsync(arg_alloc_ptr, m_stream));
+      return;
+    }
+#endif
     CUDA_SAFE_CALL(cudaFree(arg_alloc_ptr));
   } catch (...) {
   }
@@ -305,6 +476,18 @@ void CudaHostPinnedSpace::deallocate(void *const arg_alloc_ptr,
   }
 }
 
+uint64_t CudaSpace::high_water_mark() {
+  return Kokkos::Experimental::memory_space_high_water_mark(name());
+}
+
+uint64_t CudaUVMSpace::high_water_mark() {
+  return Kokkos::Experimental::memory_space_high_water_mark(name());
+}
+
+uint64_t CudaHostPinnedSpace::high_water_mark() {
+  return Kokkos::Experimental::memory_space_high_water_mark(name());
+}
+
 }  // namespace Kokkos
 
 //----------------------------------------------------------------------------
@@ -454,6 +637,8 @@ SharedAllocationRecord<Kokkos::CudaSpace, void>::~SharedAllocationRecord() {
   }
 #endif
 
+  Kokkos::Impl::account_deallocation(m_space.name(), data(), size());
+
   m_space.deallocate(SharedAllocationRecord<void, void>::m_alloc_ptr,
                      SharedAllocationRecord<void, void>::m_alloc_size);
 }
@@ -468,6 +653,8 @@ SharedAllocationRecord<Kokkos::CudaUVMSpace, void>::~SharedAllocationRecord() {
   }
 #endif
 
+  Kokkos::Impl::account_deallocation(m_space.name(), data(), size());
+
   m_space.deallocate(SharedAllocationRecord<void, void>::m_alloc_ptr,
                      SharedAllocationRecord<void, void>::m_alloc_size);
 }
@@ -482,6 +669,8 @@ SharedAllocationRecord<Kokkos::CudaHostPinnedSpace,
   }
 #endif
 
+  Kokkos::Impl::account_deallocation(m_space.name(), data(), size());
+
   m_space.deallocate(SharedAllocationRecord<void, void>::m_alloc_ptr,
                      SharedAllocationRecord<void, void>::m_alloc_size);
 }
@@ -515,6 +704,9 @@ SharedAllocationRecord<Kokkos::CudaSpace, void>::SharedAllocationRecord(
   }
 #endif
 
+  Kokkos::Impl::account_allocation(arg_space.name(), arg_label, data(),
+                                   arg_alloc_size);
+
   SharedAllocationHeader header;
 
   // Fill in the Header information
@@ -552,6 +744,9 @@ SharedAllocationRecord<Kokkos::CudaUVMSpace, void>::SharedAllocationRecord(
         arg_alloc_size);
   }
 #endif
+
+  Kokkos::Impl::account_allocation(arg_space.name(), arg_label, data(),
+                                   arg_alloc_size);
   // Fill in the Header information, directly accessible via UVM
 
   RecordBase::m_alloc_ptr->m_record = this;
@@ -587,6 +782,9 @@ SharedAllocationRecord<Kokkos::CudaHostPinnedSpace, void>::
         arg_alloc_size);
   }
 #endif
+
+  Kokkos::Impl::account_allocation(arg_space.name(), arg_label, data(),
+                                   arg_alloc_size);
   // Fill in the Header information, directly accessible on the host
 
   RecordBase::m_alloc_ptr->m_record = this;
@@ -903,6 +1101,8 @@ void *cuda_resize_scratch_space(std::int64_t bytes, bool force_shrink) {
                                                    current_size);
   }
   if (bytes > current_size) {
+    Kokkos::Impl::realtime_phase_vet("Cuda functor scratch resize");
+    Kokkos::Impl::allocation_audit_note("Cuda functor scratch resize", bytes);
     current_size = bytes;
     Kokkos::kokkos_free<Kokkos::CudaSpace>(ptr);
     ptr = Kokkos::kokkos_malloc<Kokkos::CudaSpace>("CudaSpace::ScratchMemory",
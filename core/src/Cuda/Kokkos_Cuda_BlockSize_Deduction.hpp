@@ -49,7 +49,9 @@
 #ifdef KOKKOS_ENABLE_CUDA
 
 #include <iostream>
+#include <mutex>
 #include <Cuda/Kokkos_Cuda_Error.hpp>
+#include <impl/Kokkos_LaunchBoundsRegistry.hpp>
 
 namespace Kokkos {
 namespace Impl {
@@ -67,16 +69,27 @@ int cuda_get_max_block_size(const typename DriverType::functor_type& f,
 }
 
 template <class FunctorType, class LaunchBounds>
-int cuda_get_max_block_size(const CudaInternal* cuda_instance,
-                            const cudaFuncAttributes& attr,
+int cuda_deduce_max_block_size(const CudaInternal* cuda_instance,
+                               const cudaFuncAttributes& attr,
                             const FunctorType& f, const size_t vector_length,
                             const size_t shmem_block,
                             const size_t shmem_thread) {
-  const int min_blocks_per_sm =
+  int min_blocks_per_sm =
       LaunchBounds::minBperSM == 0 ? 1 : LaunchBounds::minBperSM;
-  const int max_threads_per_block = LaunchBounds::maxTperB == 0
-                                        ? cuda_instance->m_maxThreadsPerBlock
-                                        : LaunchBounds::maxTperB;
+  int max_threads_per_block = LaunchBounds::maxTperB == 0
+                                  ? cuda_instance->m_maxThreadsPerBlock
+                                  : LaunchBounds::maxTperB;
+
+  // A launch-bounds hint registered for the labeled launch in flight
+  // tightens the compile-time bounds at runtime.
+  if (const LaunchBoundsEntry* hint = launch_bounds_hint()) {
+    if (hint->max_threads_per_block != 0u)
+      max_threads_per_block =
+          std::min(max_threads_per_block, int(hint->max_threads_per_block));
+    if (hint->min_blocks_per_sm != 0u)
+      min_blocks_per_sm =
+          std::max(min_blocks_per_sm, int(hint->min_blocks_per_sm));
+  }
 
   const int regs_per_thread     = attr.numRegs;
   const int regs_per_sm         = cuda_instance->m_regsPerSM;
@@ -138,9 +151,88 @@ int cuda_get_max_block_size(const CudaInternal* cuda_instance,
     //   regs_per_sm,regs_per_thread,max_blocks_shmem,max_blocks_regs,blocks_per_sm,threads_per_sm,opt_block_size,opt_threads_per_sm);
     block_size -= 32;
   }
+  launch_bounds_hint_record(opt_block_size, regs_per_thread,
+                            (100 * opt_threads_per_sm) / max_threads_per_sm);
   return opt_block_size;
 }
 
+//----------------------------------------------------------------------------
+// Cache of deduced launch configurations.  One instantiation of the getter
+// templates below exists per (functor type, launch bounds), so steady-state
+// launches of a kernel consult a small table keyed by the runtime launch
+// parameters instead of re-walking the occupancy heuristics on every launch.
+// The functor's team shmem request, probed at the device block-size limit,
+// is part of the key so functors with runtime-dependent team_shmem_size()
+// do not alias each other's entries.
+
+struct CudaBlockSizeCache {
+  enum { capacity = 8 };
+
+  struct Entry {
+    size_t vector_length;
+    size_t shmem_block;
+    size_t shmem_thread;
+    size_t functor_shmem;
+    int device;
+    int block_size;
+  };
+
+  Entry m_entries[capacity];
+  int m_size;
+  std::mutex m_lock;
+
+  CudaBlockSizeCache() : m_size(0) {}
+
+  template <class Deduce>
+  int get(const int device, const size_t vector_length,
+          const size_t shmem_block, const size_t shmem_thread,
+          const size_t functor_shmem, const Deduce& deduce) {
+    std::lock_guard<std::mutex> guard(m_lock);
+    for (int i = 0; i < m_size; ++i) {
+      const Entry& e = m_entries[i];
+      if (e.device == device && e.vector_length == vector_length &&
+          e.shmem_block == shmem_block && e.shmem_thread == shmem_thread &&
+          e.functor_shmem == functor_shmem)
+        return e.block_size;
+    }
+    const int block_size = deduce();
+    if (m_size < capacity) {
+      Entry& e        = m_entries[m_size++];
+      e.device        = device;
+      e.vector_length = vector_length;
+      e.shmem_block   = shmem_block;
+      e.shmem_thread  = shmem_thread;
+      e.functor_shmem = functor_shmem;
+      e.block_size    = block_size;
+    }
+    return block_size;
+  }
+};
+
+template <class FunctorType, class LaunchBounds>
+int cuda_get_max_block_size(const CudaInternal* cuda_instance,
+                            const cudaFuncAttributes& attr,
+                            const FunctorType& f, const size_t vector_length,
+                            const size_t shmem_block,
+                            const size_t shmem_thread) {
+  // Hinted launches bypass the cache: the hint changes the outcome and
+  // the recorded feedback must reflect the launch in flight.
+  if (launch_bounds_hint() != nullptr) {
+    return cuda_deduce_max_block_size<FunctorType, LaunchBounds>(
+        cuda_instance, attr, f, vector_length, shmem_block, shmem_thread);
+  }
+  static CudaBlockSizeCache cache;
+  const size_t functor_shmem = FunctorTeamShmemSize<FunctorType>::value(
+      f, cuda_instance->m_maxThreadsPerBlock / vector_length);
+  return cache.get(cuda_instance->m_cudaDev, vector_length, shmem_block,
+                   shmem_thread, functor_shmem, [&]() {
+                     return cuda_deduce_max_block_size<FunctorType,
+                                                       LaunchBounds>(
+                         cuda_instance, attr, f, vector_length, shmem_block,
+                         shmem_thread);
+                   });
+}
+
 template <class DriverType>
 struct CudaGetMaxBlockSize<DriverType, Kokkos::LaunchBounds<>, true> {
   static int get_block_size(const typename DriverType::functor_type& f,
@@ -364,16 +456,27 @@ int cuda_get_opt_block_size(const typename DriverType::functor_type& f,
 }
 
 template <class FunctorType, class LaunchBounds>
-int cuda_get_opt_block_size(const CudaInternal* cuda_instance,
-                            const cudaFuncAttributes& attr,
+int cuda_deduce_opt_block_size(const CudaInternal* cuda_instance,
+                               const cudaFuncAttributes& attr,
                             const FunctorType& f, const size_t vector_length,
                             const size_t shmem_block,
                             const size_t shmem_thread) {
-  const int min_blocks_per_sm =
+  int min_blocks_per_sm =
       LaunchBounds::minBperSM == 0 ? 1 : LaunchBounds::minBperSM;
-  const int max_threads_per_block = LaunchBounds::maxTperB == 0
-                                        ? cuda_instance->m_maxThreadsPerBlock
-                                        : LaunchBounds::maxTperB;
+  int max_threads_per_block = LaunchBounds::maxTperB == 0
+                                  ? cuda_instance->m_maxThreadsPerBlock
+                                  : LaunchBounds::maxTperB;
+
+  // A launch-bounds hint registered for the labeled launch in flight
+  // tightens the compile-time bounds at runtime.
+  if (const LaunchBoundsEntry* hint = launch_bounds_hint()) {
+    if (hint->max_threads_per_block != 0u)
+      max_threads_per_block =
+          std::min(max_threads_per_block, int(hint->max_threads_per_block));
+    if (hint->min_blocks_per_sm != 0u)
+      min_blocks_per_sm =
+          std::max(min_blocks_per_sm, int(hint->min_blocks_per_sm));
+  }
 
   const int regs_per_thread     = attr.numRegs;
   const int regs_per_sm         = cuda_instance->m_regsPerSM;
@@ -428,9 +531,35 @@ int cuda_get_opt_block_size(const CudaInternal* cuda_instance,
     }
     block_size -= 32;
   }
+  launch_bounds_hint_record(opt_block_size, regs_per_thread,
+                            (100 * opt_threads_per_sm) / max_threads_per_sm);
   return opt_block_size;
 }
 
+template <class FunctorType, class LaunchBounds>
+int cuda_get_opt_block_size(const CudaInternal* cuda_instance,
+                            const cudaFuncAttributes& attr,
+                            const FunctorType& f, const size_t vector_length,
+                            const size_t shmem_block,
+                            const size_t shmem_thread) {
+  // Hinted launches bypass the cache: the hint changes the outcome and
+  // the recorded feedback must reflect the launch in flight.
+  if (launch_bounds_hint() != nullptr) {
+    return cuda_deduce_opt_block_size<FunctorType, LaunchBounds>(
+        cuda_instance, attr, f, vector_length, shmem_block, shmem_thread);
+  }
+  static CudaBlockSizeCache cache;
+  const size_t functor_shmem = FunctorTeamShmemSize<FunctorType>::value(
+      f, cuda_instance->m_maxThreadsPerBlock / vector_length);
+  return cache.get(cuda_instance->m_cudaDev, vector_length, shmem_block,
+                   shmem_thread, functor_shmem, [&]() {
+                     return cuda_deduce_opt_block_size<FunctorType,
+                                                       LaunchBounds>(
+                         cuda_instance, attr, f, vector_length, shmem_block,
+                         shmem_thread);
+                   });
+}
+
 template <class DriverType>
 struct CudaGetOptBlockSize<DriverType, Kokkos::LaunchBounds<0, 0>, true> {
   static int get_block_size(const typename DriverType::functor_type& f,
@@ -587,5 +716,29 @@ struct CudaGetOptBlockSize<
 }  // namespace Impl
 }  // namespace Kokkos
 
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  Pre-populate the per-kernel launch-configuration caches.
+ *
+ *  Queries (and caches) the kernel's function attributes and constructs the
+ *  dispatch closure for the given policy/functor combination so the
+ *  occupancy-driven block-size deduction runs at initialization instead of
+ *  on the first time-critical launch.
+ */
+template <class Policy, class FunctorType>
+void cuda_prewarm_launch_configuration(const Policy& policy,
+                                       const FunctorType& f) {
+  typedef Kokkos::Impl::ParallelFor<FunctorType, Policy> closure_type;
+  (void)Kokkos::Impl::CudaParallelLaunch<
+      closure_type,
+      typename Policy::traits::launch_bounds>::get_cuda_func_attributes();
+  closure_type closure(f, policy);
+  (void)closure;
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
 #endif  // KOKKOS_ENABLE_CUDA
 #endif  /* #ifndef KOKKOS_CUDA_INTERNAL_HPP */
@@ -0,0 +1,208 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_CUDA_CONSTANTCACHE_HPP
+#define KOKKOS_CUDA_CONSTANTCACHE_HPP
+
+#include <Kokkos_Macros.hpp>
+#ifdef KOKKOS_ENABLE_CUDA
+
+#include <Cuda/Kokkos_Cuda_Error.hpp>
+#include <Cuda/Kokkos_Cuda_Instance.hpp>
+#include <impl/Kokkos_Error.hpp>
+
+#include <cstddef>
+#include <string>
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+#if defined(__CUDACC__)
+
+/** \brief  Constant-memory bank for small read-only lookup tables.
+ *
+ *  This is a separate symbol from kokkos_impl_cuda_constant_memory_buffer:
+ *  the functor buffer is overwritten on every constant-memory launch while
+ *  a bound table must stay resident across launches.
+ */
+#ifdef KOKKOS_ENABLE_CUDA_RELOCATABLE_DEVICE_CODE
+
+__device__ __constant__ extern unsigned long
+    kokkos_impl_cuda_constant_cache_buffer[];
+
+#else
+
+__device__ __constant__ unsigned long kokkos_impl_cuda_constant_cache_buffer
+    [Kokkos::Impl::CudaTraits::ConstantCacheUsage / sizeof(unsigned long)];
+
+#endif
+
+namespace Kokkos {
+namespace Impl {
+
+/* Host-side record of the currently bound table, so that re-binding the
+ * same data before every launch is a pointer compare instead of a copy.
+ * One record per translation unit matches the per-translation-unit
+ * constant symbol of non-relocatable device code. */
+inline bool cuda_constant_cache_update(const void* arg_ptr,
+                                       const size_t arg_bytes) {
+  static const void* s_bound_ptr  = nullptr;
+  static size_t s_bound_bytes     = 0;
+  if (arg_ptr == s_bound_ptr && arg_bytes == s_bound_bytes) return false;
+  s_bound_ptr   = arg_ptr;
+  s_bound_bytes = arg_bytes;
+  return true;
+}
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  Device handle to the table bound in constant memory.
+ *
+ *  The handle addresses the constant symbol directly, so reads compile
+ *  to constant-cache loads that are broadcast when a warp reads the
+ *  same entry - the access pattern of tabulated-EOS kernels.  The
+ *  handle is an empty-plus-extent value type; copy it into functors
+ *  like a View.  Multi-dimensional tables are indexed flattened.
+ */
+template <class T>
+class ConstantCacheTable {
+ public:
+  typedef T value_type;
+  typedef size_t size_type;
+
+  KOKKOS_INLINE_FUNCTION
+  ConstantCacheTable() : m_extent(0) {}
+
+  KOKKOS_INLINE_FUNCTION
+  explicit ConstantCacheTable(const size_type arg_extent)
+      : m_extent(arg_extent) {}
+
+  /// \brief Number of elements in the bound table.
+  KOKKOS_INLINE_FUNCTION
+  size_type extent() const { return m_extent; }
+
+  KOKKOS_INLINE_FUNCTION
+  T operator()(const size_type i) const {
+#if defined(__CUDA_ARCH__)
+    return reinterpret_cast<const T*>(kokkos_impl_cuda_constant_cache_buffer)[i];
+#else
+    (void)i;
+    return T();
+#endif
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  T operator[](const size_type i) const { return (*this)(i); }
+
+ private:
+  size_type m_extent;
+};
+
+/// \brief Capacity in bytes of the constant-memory table bank.
+KOKKOS_INLINE_FUNCTION
+constexpr size_t constant_cache_capacity() {
+  return size_t(Kokkos::Impl::CudaTraits::ConstantCacheUsage);
+}
+
+/** \brief  Bind a small read-only View to the constant-memory bank and
+ *          return a device handle reading through the constant cache.
+ *
+ *  The view must be contiguous and at most constant_cache_capacity()
+ *  bytes - the functor launch buffer occupies the rest of the 64k
+ *  constant segment; larger tables should stay on the RandomAccess
+ *  (texture/LDG) path.  The copy runs on the default stream and is
+ *  complete when the call returns.  Binding the same view again is a
+ *  no-op, so call sites may bind before every launch and pay only a
+ *  pointer compare once the table is resident; pass arg_force after
+ *  mutating the table in place.  One table is resident at a time; a
+ *  new bind replaces the previous one.
+ */
+template <class ViewType>
+inline ConstantCacheTable<typename ViewType::non_const_value_type>
+bind_constant_cache(const ViewType& arg_table, const bool arg_force = false) {
+  typedef typename ViewType::non_const_value_type value_type;
+
+  if (!arg_table.span_is_contiguous()) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::bind_constant_cache ERROR: table view must "
+        "be contiguous");
+  }
+
+  const size_t bytes = arg_table.span() * sizeof(value_type);
+
+  if (constant_cache_capacity() < bytes) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::bind_constant_cache ERROR: table of " +
+        std::to_string(bytes) + " bytes exceeds the " +
+        std::to_string(constant_cache_capacity()) +
+        " byte constant-memory bank, use a RandomAccess View instead");
+  }
+
+  if (arg_force ||
+      Kokkos::Impl::cuda_constant_cache_update(arg_table.data(), bytes)) {
+    /* cudaMemcpyDefault resolves host or device sources through unified
+     * addressing. */
+    CUDA_SAFE_CALL(cudaMemcpyToSymbol(kokkos_impl_cuda_constant_cache_buffer,
+                                      arg_table.data(), bytes, 0,
+                                      cudaMemcpyDefault));
+  }
+
+  return ConstantCacheTable<value_type>(arg_table.span());
+}
+
+/// \brief Forget the resident table; the next bind always copies.
+inline void unbind_constant_cache() {
+  Kokkos::Impl::cuda_constant_cache_update(nullptr, 0);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* defined( __CUDACC__ ) */
+#endif /* defined( KOKKOS_ENABLE_CUDA ) */
+#endif /* #ifndef KOKKOS_CUDA_CONSTANTCACHE_HPP */
@@ -59,6 +59,7 @@
 
 /*--------------------------------------------------------------------------*/
 /* Standard 'C' libraries */
+#include <atomic>
 #include <cstdlib>
 
 /* Standard 'C++' libraries */
@@ -96,6 +97,9 @@ bool kokkos_impl_cuda_use_serial_execution() {
 __device__ __constant__ unsigned long kokkos_impl_cuda_constant_memory_buffer
     [Kokkos::Impl::CudaTraits::ConstantMemoryUsage / sizeof(unsigned long)];
 
+__device__ __constant__ unsigned long kokkos_impl_cuda_constant_cache_buffer
+    [Kokkos::Impl::CudaTraits::ConstantCacheUsage / sizeof(unsigned long)];
+
 #endif
 
 /*--------------------------------------------------------------------------*/
@@ -237,6 +241,10 @@ const CudaInternalDevices &CudaInternalDevices::singleton() {
 
 int CudaInternal::was_initialized = 0;
 int CudaInternal::was_finalized   = 0;
+
+std::mutex CudaInternal::constantMemMutex;
+cudaEvent_t CudaInternal::constantMemReusable       = nullptr;
+unsigned long *CudaInternal::constantMemHostStaging = nullptr;
 //----------------------------------------------------------------------------
 
 void CudaInternal::print_configuration(std::ostream &s) const {
@@ -300,12 +308,16 @@ int CudaInternal::verify_is_initialized(const char *const label) const {
 }
 
 CudaInternal &CudaInternal::singleton() {
+  // First use of the backend triggers any bring-up that
+  // Kokkos::initialize deferred.
+  Kokkos::Impl::ensure_device_backends_initialized();
   static CudaInternal self;
   return self;
 }
 void CudaInternal::fence() const { cudaStreamSynchronize(m_stream); }
 
-void CudaInternal::initialize(int cuda_device_id, cudaStream_t stream) {
+void CudaInternal::initialize(int cuda_device_id, cudaStream_t stream,
+                              bool manage_stream) {
   if (was_finalized)
     Kokkos::abort("Calling Cuda::initialize after Cuda::finalize is illegal\n");
   was_initialized = 1;
@@ -530,7 +542,17 @@ void CudaInternal::initialize(int cuda_device_id, cudaStream_t stream) {
   // Init the array for used for arbitrarily sized atomics
   if (stream == 0) Impl::initialize_host_cuda_lock_arrays();
 
-  m_stream = stream;
+  // Pinned staging buffer and reuse event for constant-memory functor
+  // launches; shared by all instances so created with the singleton.
+  if (stream == 0) {
+    CUDA_SAFE_CALL(cudaMallocHost((void **)&constantMemHostStaging,
+                                  CudaTraits::ConstantMemoryUsage));
+
+    CUDA_SAFE_CALL(cudaEventCreate(&constantMemReusable));
+  }
+
+  m_stream       = stream;
+  m_manageStream = manage_stream;
 }
 
 //----------------------------------------------------------------------------
@@ -538,10 +560,31 @@ void CudaInternal::initialize(int cuda_device_id, cudaStream_t stream) {
 typedef Cuda::size_type ScratchGrain[Impl::CudaTraits::WarpSize];
 enum { sizeScratchGrain = sizeof(ScratchGrain) };
 
+namespace {
+
+// Round a scratch request up to its power-of-two size class.  Growing in
+// size classes instead of to the exact new maximum keeps the number of
+// cudaFree/cudaMalloc pairs logarithmic in the high-water mark when kernel
+// scratch requirements creep upward across launches.
+Cuda::size_type scratch_size_class(const Cuda::size_type grain_count) {
+  Cuda::size_type c = 1;
+  while (c < grain_count) c <<= 1;
+  return c;
+}
+
+// Host-thread ownership of the pinned result buffer pool.  The first
+// host thread to launch a reduction gets slot 0, i.e. the original
+// unified buffer; later threads get their own slots round-robin.
+std::atomic<int> s_scratch_unified_slot_count(0);
+__thread int t_scratch_unified_slot = -1;
+
+}  // namespace
+
 Cuda::size_type *CudaInternal::scratch_flags(const Cuda::size_type size) const {
   if (verify_is_initialized("scratch_flags") &&
       m_scratchFlagsCount * sizeScratchGrain < size) {
-    m_scratchFlagsCount = (size + sizeScratchGrain - 1) / sizeScratchGrain;
+    m_scratchFlagsCount =
+        scratch_size_class((size + sizeScratchGrain - 1) / sizeScratchGrain);
 
     typedef Kokkos::Impl::SharedAllocationRecord<Kokkos::CudaSpace, void>
         Record;
@@ -566,7 +609,8 @@ Cuda::size_type *CudaInternal::scratch_flags(const Cuda::size_type size) const {
 Cuda::size_type *CudaInternal::scratch_space(const Cuda::size_type size) const {
   if (verify_is_initialized("scratch_space") &&
       m_scratchSpaceCount * sizeScratchGrain < size) {
-    m_scratchSpaceCount = (size + sizeScratchGrain - 1) / sizeScratchGrain;
+    m_scratchSpaceCount =
+        scratch_size_class((size + sizeScratchGrain - 1) / sizeScratchGrain);
 
     typedef Kokkos::Impl::SharedAllocationRecord<Kokkos::CudaSpace, void>
         Record;
@@ -589,7 +633,8 @@ Cuda::size_type *CudaInternal::scratch_unified(
     const Cuda::size_type size) const {
   if (verify_is_initialized("scratch_unified") && m_scratchUnifiedSupported &&
       m_scratchUnifiedCount * sizeScratchGrain < size) {
-    m_scratchUnifiedCount = (size + sizeScratchGrain - 1) / sizeScratchGrain;
+    m_scratchUnifiedCount =
+        scratch_size_class((size + sizeScratchGrain - 1) / sizeScratchGrain);
 
     typedef Kokkos::Impl::SharedAllocationRecord<Kokkos::CudaHostPinnedSpace,
                                                  void>
@@ -610,10 +655,46 @@ Cuda::size_type *CudaInternal::scratch_unified(
   return m_scratchUnified;
 }
 
+int CudaInternal::scratch_unified_host_thread_slot() {
+  if (t_scratch_unified_slot < 0) {
+    t_scratch_unified_slot =
+        s_scratch_unified_slot_count++ % int(ScratchUnifiedPoolSize);
+  }
+  return t_scratch_unified_slot;
+}
+
+Cuda::size_type *CudaInternal::scratch_unified_slot(const Cuda::size_type size,
+                                                    const int slot) const {
+  if (0 == slot) return scratch_unified(size);
+
+  if (verify_is_initialized("scratch_unified") && m_scratchUnifiedSupported &&
+      m_scratchUnifiedPoolCount[slot] * sizeScratchGrain < size) {
+    m_scratchUnifiedPoolCount[slot] =
+        scratch_size_class((size + sizeScratchGrain - 1) / sizeScratchGrain);
+
+    typedef Kokkos::Impl::SharedAllocationRecord<Kokkos::CudaHostPinnedSpace,
+                                                 void>
+        Record;
+
+    if (m_scratchUnifiedPool[slot])
+      Record::decrement(Record::get_record(m_scratchUnifiedPool[slot]));
+
+    Record *const r = Record::allocate(
+        Kokkos::CudaHostPinnedSpace(), "InternalScratchUnified",
+        (sizeof(ScratchGrain) * m_scratchUnifiedPoolCount[slot]));
+
+    Record::increment(r);
+
+    m_scratchUnifiedPool[slot] = reinterpret_cast<size_type *>(r->data());
+  }
+
+  return m_scratchUnifiedPool[slot];
+}
+
 Cuda::size_type *CudaInternal::scratch_functor(
     const Cuda::size_type size) const {
   if (verify_is_initialized("scratch_functor") && m_scratchFunctorSize < size) {
-    m_scratchFunctorSize = size;
+    m_scratchFunctorSize = scratch_size_class(size);
 
     typedef Kokkos::Impl::SharedAllocationRecord<Kokkos::CudaSpace, void>
         Record;
@@ -632,6 +713,56 @@ Cuda::size_type *CudaInternal::scratch_functor(
   return m_scratchFunctor;
 }
 
+void CudaInternal::scratch_trim() {
+  if (!is_initialized()) return;
+
+  // Retired buffers may still be read by in-flight kernels.
+  fence();
+
+  typedef Kokkos::Impl::SharedAllocationRecord<Kokkos::CudaSpace, void>
+      RecordCuda;
+  typedef Kokkos::Impl::SharedAllocationRecord<Kokkos::CudaHostPinnedSpace,
+                                               void>
+      RecordHost;
+
+  if (m_scratchFunctor) {
+    RecordCuda::decrement(RecordCuda::get_record(m_scratchFunctor));
+    m_scratchFunctor     = 0;
+    m_scratchFunctorSize = 0;
+  }
+
+  if (m_scratchUnified) {
+    RecordHost::decrement(RecordHost::get_record(m_scratchUnified));
+    m_scratchUnified      = 0;
+    m_scratchUnifiedCount = 0;
+  }
+
+  for (int i = 1; i < int(ScratchUnifiedPoolSize); ++i) {
+    if (m_scratchUnifiedPool[i]) {
+      RecordHost::decrement(RecordHost::get_record(m_scratchUnifiedPool[i]));
+      m_scratchUnifiedPool[i]      = 0;
+      m_scratchUnifiedPoolCount[i] = 0;
+    }
+  }
+
+  RecordCuda::decrement(RecordCuda::get_record(m_scratchSpace));
+  m_scratchSpace      = 0;
+  m_scratchSpaceCount = 0;
+
+  RecordCuda::decrement(RecordCuda::get_record(m_scratchFlags));
+  m_scratchFlags      = 0;
+  m_scratchFlagsCount = 0;
+
+  // Re-establish the bring-up sizes from initialize() so multiblock
+  // reduction keeps working without a growth step on the next launch.
+  const unsigned reduce_block_count =
+      m_maxWarpCount * Impl::CudaTraits::WarpSize;
+
+  (void)scratch_unified(16 * sizeof(size_type));
+  (void)scratch_flags(reduce_block_count * 2 * sizeof(size_type));
+  (void)scratch_space(reduce_block_count * 16 * sizeof(size_type));
+}
+
 //----------------------------------------------------------------------------
 
 void CudaInternal::finalize() {
@@ -639,7 +770,7 @@ void CudaInternal::finalize() {
   if (0 != m_scratchSpace || 0 != m_scratchFlags) {
     Impl::finalize_host_cuda_lock_arrays();
 
-    if (m_stream != 0) cudaStreamDestroy(m_stream);
+    if (m_manageStream && m_stream != 0) cudaStreamDestroy(m_stream);
 
     typedef Kokkos::Impl::SharedAllocationRecord<CudaSpace> RecordCuda;
     typedef Kokkos::Impl::SharedAllocationRecord<CudaHostPinnedSpace>
@@ -648,10 +779,25 @@ void CudaInternal::finalize() {
     RecordCuda::decrement(RecordCuda::get_record(m_scratchFlags));
     RecordCuda::decrement(RecordCuda::get_record(m_scratchSpace));
     RecordHost::decrement(RecordHost::get_record(m_scratchUnified));
+    for (int i = 1; i < int(ScratchUnifiedPoolSize); ++i) {
+      if (m_scratchUnifiedPool[i]) {
+        RecordHost::decrement(RecordHost::get_record(m_scratchUnifiedPool[i]));
+        m_scratchUnifiedPool[i]      = 0;
+        m_scratchUnifiedPoolCount[i] = 0;
+      }
+    }
     RecordCuda::decrement(RecordCuda::get_record(m_scratchConcurrentBitset));
     if (m_scratchFunctorSize > 0)
       RecordCuda::decrement(RecordCuda::get_record(m_scratchFunctor));
 
+    // The singleton owns the constant-memory staging buffer and event.
+    if (this == &singleton()) {
+      cudaFreeHost(constantMemHostStaging);
+      cudaEventDestroy(constantMemReusable);
+      constantMemHostStaging = nullptr;
+      constantMemReusable    = nullptr;
+    }
+
     m_cudaDev                 = -1;
     m_multiProcCount          = 0;
     m_maxWarpCount            = 0;
@@ -666,6 +812,7 @@ void CudaInternal::finalize() {
     m_scratchUnified          = 0;
     m_scratchConcurrentBitset = 0;
     m_stream                  = 0;
+    m_manageStream            = false;
   }
 }
 
@@ -711,7 +858,8 @@ Cuda::size_type *cuda_internal_scratch_flags(const Cuda &instance,
 
 Cuda::size_type *cuda_internal_scratch_unified(const Cuda &instance,
                                                const Cuda::size_type size) {
-  return instance.impl_internal_space_instance()->scratch_unified(size);
+  return instance.impl_internal_space_instance()->scratch_unified_slot(
+      size, CudaInternal::scratch_unified_host_thread_slot());
 }
 
 }  // namespace Impl
@@ -797,11 +945,12 @@ Cuda::Cuda() : m_space_instance(&Impl::CudaInternal::singleton()) {
       "Cuda instance constructor");
 }
 
-Cuda::Cuda(cudaStream_t stream) : m_space_instance(new Impl::CudaInternal) {
+Cuda::Cuda(cudaStream_t stream, bool manage_stream)
+    : m_space_instance(new Impl::CudaInternal) {
   Impl::CudaInternal::singleton().verify_is_initialized(
       "Cuda instance constructor");
   m_space_instance->initialize(Impl::CudaInternal::singleton().m_cudaDev,
-                               stream);
+                               stream, manage_stream);
 }
 
 void Cuda::print_configuration(std::ostream &s, const bool) {
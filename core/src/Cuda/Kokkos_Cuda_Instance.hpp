@@ -1,6 +1,8 @@
 #ifndef KOKKOS_CUDA_INSTANCE_HPP_
 #define KOKKOS_CUDA_INSTANCE_HPP_
 
+#include <mutex>
+
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
 // These functions fulfill the purpose of allowing to work around
@@ -22,6 +24,9 @@ struct CudaTraits {
   enum { ConstantMemoryUsage = 0x008000 /* 32k bytes */ };
   enum { ConstantMemoryCache = 0x002000 /*  8k bytes */ };
   enum { KernelArgumentLimit = 0x001000 /*  4k bytes */ };
+  /* Constant-memory bank reserved for bound lookup tables; shares the
+   * 64k constant segment with the kernel-launch functor buffer above. */
+  enum { ConstantCacheUsage = 0x006000 /* 24k bytes */ };
 
   typedef unsigned long
       ConstantGlobalBufferType[ConstantMemoryUsage / sizeof(unsigned long)];
@@ -108,11 +113,30 @@ class CudaInternal {
   mutable size_type* m_scratchUnified;
   mutable size_type* m_scratchFunctor;
   uint32_t* m_scratchConcurrentBitset;
+
+  // Pool of pinned result buffers so concurrent reductions launched by
+  // distinct host threads do not deliver through the same unified buffer.
+  // Slot 0 is m_scratchUnified itself.
+  enum { ScratchUnifiedPoolSize = 32 };
+  mutable size_type m_scratchUnifiedPoolCount[ScratchUnifiedPoolSize];
+  mutable size_type* m_scratchUnifiedPool[ScratchUnifiedPoolSize];
   cudaStream_t m_stream;
+  bool m_manageStream;
 
   static int was_initialized;
   static int was_finalized;
 
+  // Coordination of constant-memory functor launches across all
+  // instances of the device: a launch stages its functor in pinned host
+  // memory, copies it to the constant buffer on its own stream, and
+  // records an event when the buffer may be overwritten.  The next
+  // constant-memory launch synchronizes on that event instead of
+  // fencing the whole device, so launches through the local- and
+  // global-memory mechanisms on other streams proceed concurrently.
+  static std::mutex constantMemMutex;
+  static cudaEvent_t constantMemReusable;
+  static unsigned long* constantMemHostStaging;
+
   static CudaInternal& singleton();
 
   int verify_is_initialized(const char* const label) const;
@@ -121,7 +145,8 @@ class CudaInternal {
     return 0 != m_scratchSpace && 0 != m_scratchFlags;
   }
 
-  void initialize(int cuda_device_id, cudaStream_t stream = 0);
+  void initialize(int cuda_device_id, cudaStream_t stream = 0,
+                  bool manage_stream = false);
   void finalize();
 
   void print_configuration(std::ostream&) const;
@@ -160,12 +185,29 @@ class CudaInternal {
         m_scratchUnified(0),
         m_scratchFunctor(0),
         m_scratchConcurrentBitset(0),
-        m_stream(0) {}
+        m_stream(0),
+        m_manageStream(false) {
+    for (int i = 0; i < int(ScratchUnifiedPoolSize); ++i) {
+      m_scratchUnifiedPoolCount[i] = 0;
+      m_scratchUnifiedPool[i]      = 0;
+    }
+  }
 
   size_type* scratch_space(const size_type size) const;
   size_type* scratch_flags(const size_type size) const;
   size_type* scratch_unified(const size_type size) const;
   size_type* scratch_functor(const size_type size) const;
+
+  // Pinned result buffer for one pool slot; slot 0 is scratch_unified.
+  size_type* scratch_unified_slot(const size_type size, const int slot) const;
+
+  // Pool slot owned by the calling host thread, assigned round-robin on
+  // first use.
+  static int scratch_unified_host_thread_slot();
+
+  // Release the retained internal scratch buffers back to the driver and
+  // re-establish the bring-up sizes.  Fences the device first.
+  void scratch_trim();
 };
 
 }  // Namespace Impl
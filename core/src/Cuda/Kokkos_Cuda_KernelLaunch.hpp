@@ -50,6 +50,8 @@
 
 #include <string>
 #include <cstdint>
+#include <cstring>
+#include <mutex>
 #include <Kokkos_Parallel.hpp>
 #include <impl/Kokkos_Error.hpp>
 #include <Cuda/Kokkos_Cuda_abort.hpp>
@@ -244,9 +246,6 @@ struct CudaParallelLaunch<
                             const CudaInternal* cuda_instance,
                             const bool prefer_shmem) {
     if ((grid.x != 0) && ((block.x * block.y * block.z) != 0)) {
-      // Fence before changing settings and copying closure
-      Kokkos::Cuda().fence();
-
       if (cuda_instance->m_maxShmemPerBlock < shmem) {
         Kokkos::Impl::throw_runtime_exception(std::string(
             "CudaParallelLaunch FAILED: shared memory request is too large"));
@@ -262,8 +261,18 @@ struct CudaParallelLaunch<
       }
 #endif
 
-      // Copy functor to constant memory on the device
-      cudaMemcpyToSymbolAsync(kokkos_impl_cuda_constant_memory_buffer, &driver,
+      // Wait until the previous launch through the constant buffer has
+      // consumed it; launches on other streams through the local- and
+      // global-memory mechanisms are unaffected.
+      std::lock_guard<std::mutex> lock(CudaInternal::constantMemMutex);
+      CUDA_SAFE_CALL(cudaEventSynchronize(CudaInternal::constantMemReusable));
+
+      // Copy functor (synchronously) into the pinned staging buffer, then
+      // asynchronously from there to constant memory on this stream.
+      unsigned long* staging = cuda_instance->constantMemHostStaging;
+      memcpy(staging, &driver, sizeof(DriverType));
+
+      cudaMemcpyToSymbolAsync(kokkos_impl_cuda_constant_memory_buffer, staging,
                               sizeof(DriverType), 0, cudaMemcpyHostToDevice,
                               cudaStream_t(cuda_instance->m_stream));
 
@@ -274,6 +283,10 @@ struct CudaParallelLaunch<
                                            MinBlocksPerSM>
           <<<grid, block, shmem, cuda_instance->m_stream>>>();
 
+      // Record an event to mark when the constant buffer may be reused
+      CUDA_SAFE_CALL(cudaEventRecord(CudaInternal::constantMemReusable,
+                                     cudaStream_t(cuda_instance->m_stream)));
+
 #if defined(KOKKOS_ENABLE_DEBUG_BOUNDS_CHECK)
       CUDA_SAFE_CALL(cudaGetLastError());
       Kokkos::Cuda().fence();
@@ -282,11 +295,16 @@ struct CudaParallelLaunch<
   }
 
   static cudaFuncAttributes get_cuda_func_attributes() {
-    cudaFuncAttributes attr;
-    CUDA_SAFE_CALL(cudaFuncGetAttributes(
-        &attr,
-        cuda_parallel_launch_constant_memory<DriverType, MaxThreadsPerBlock,
-                                             MinBlocksPerSM>));
+    // The attribute query costs a runtime call per launch; the result is
+    // invariant per driver instantiation, so resolve it once.
+    static const cudaFuncAttributes attr = []() {
+      cudaFuncAttributes attr_query;
+      CUDA_SAFE_CALL(cudaFuncGetAttributes(
+          &attr_query,
+          cuda_parallel_launch_constant_memory<DriverType, MaxThreadsPerBlock,
+                                               MinBlocksPerSM>));
+      return attr_query;
+    }();
     return attr;
   }
 };
@@ -302,9 +320,6 @@ struct CudaParallelLaunch<DriverType, Kokkos::LaunchBounds<0, 0>,
                             const CudaInternal* cuda_instance,
                             const bool prefer_shmem) {
     if ((grid.x != 0) && ((block.x * block.y * block.z) != 0)) {
-      // Fence before changing settings and copying closure
-      Kokkos::Cuda().fence();
-
       if (cuda_instance->m_maxShmemPerBlock < shmem) {
         Kokkos::Impl::throw_runtime_exception(std::string(
             "CudaParallelLaunch FAILED: shared memory request is too large"));
@@ -319,8 +334,18 @@ struct CudaParallelLaunch<DriverType, Kokkos::LaunchBounds<0, 0>,
       }
 #endif
 
-      // Copy functor to constant memory on the device
-      cudaMemcpyToSymbolAsync(kokkos_impl_cuda_constant_memory_buffer, &driver,
+      // Wait until the previous launch through the constant buffer has
+      // consumed it; launches on other streams through the local- and
+      // global-memory mechanisms are unaffected.
+      std::lock_guard<std::mutex> lock(CudaInternal::constantMemMutex);
+      CUDA_SAFE_CALL(cudaEventSynchronize(CudaInternal::constantMemReusable));
+
+      // Copy functor (synchronously) into the pinned staging buffer, then
+      // asynchronously from there to constant memory on this stream.
+      unsigned long* staging = cuda_instance->constantMemHostStaging;
+      memcpy(staging, &driver, sizeof(DriverType));
+
+      cudaMemcpyToSymbolAsync(kokkos_impl_cuda_constant_memory_buffer, staging,
                               sizeof(DriverType), 0, cudaMemcpyHostToDevice,
                               cudaStream_t(cuda_instance->m_stream));
 
@@ -330,6 +355,10 @@ struct CudaParallelLaunch<DriverType, Kokkos::LaunchBounds<0, 0>,
       cuda_parallel_launch_constant_memory<DriverType>
           <<<grid, block, shmem, cuda_instance->m_stream>>>();
 
+      // Record an event to mark when the constant buffer may be reused
+      CUDA_SAFE_CALL(cudaEventRecord(CudaInternal::constantMemReusable,
+                                     cudaStream_t(cuda_instance->m_stream)));
+
 #if defined(KOKKOS_ENABLE_DEBUG_BOUNDS_CHECK)
       CUDA_SAFE_CALL(cudaGetLastError());
       Kokkos::Cuda().fence();
@@ -338,9 +367,14 @@ struct CudaParallelLaunch<DriverType, Kokkos::LaunchBounds<0, 0>,
   }
 
   static cudaFuncAttributes get_cuda_func_attributes() {
-    cudaFuncAttributes attr;
-    CUDA_SAFE_CALL(cudaFuncGetAttributes(
-        &attr, cuda_parallel_launch_constant_memory<DriverType>));
+    // The attribute query costs a runtime call per launch; the result is
+    // invariant per driver instantiation, so resolve it once.
+    static const cudaFuncAttributes attr = []() {
+      cudaFuncAttributes attr_query;
+      CUDA_SAFE_CALL(cudaFuncGetAttributes(
+          &attr_query, cuda_parallel_launch_constant_memory<DriverType>));
+      return attr_query;
+    }();
     return attr;
   }
 };
@@ -388,10 +422,16 @@ struct CudaParallelLaunch<
   }
 
   static cudaFuncAttributes get_cuda_func_attributes() {
-    cudaFuncAttributes attr;
-    CUDA_SAFE_CALL(cudaFuncGetAttributes(
-        &attr, cuda_parallel_launch_local_memory<DriverType, MaxThreadsPerBlock,
-                                                 MinBlocksPerSM>));
+    // The attribute query costs a runtime call per launch; the result is
+    // invariant per driver instantiation, so resolve it once.
+    static const cudaFuncAttributes attr = []() {
+      cudaFuncAttributes attr_query;
+      CUDA_SAFE_CALL(cudaFuncGetAttributes(
+          &attr_query,
+          cuda_parallel_launch_local_memory<DriverType, MaxThreadsPerBlock,
+                                            MinBlocksPerSM>));
+      return attr_query;
+    }();
     return attr;
   }
 };
@@ -435,9 +475,14 @@ struct CudaParallelLaunch<DriverType, Kokkos::LaunchBounds<0, 0>,
   }
 
   static cudaFuncAttributes get_cuda_func_attributes() {
-    cudaFuncAttributes attr;
-    CUDA_SAFE_CALL(cudaFuncGetAttributes(
-        &attr, cuda_parallel_launch_local_memory<DriverType>));
+    // The attribute query costs a runtime call per launch; the result is
+    // invariant per driver instantiation, so resolve it once.
+    static const cudaFuncAttributes attr = []() {
+      cudaFuncAttributes attr_query;
+      CUDA_SAFE_CALL(cudaFuncGetAttributes(
+          &attr_query, cuda_parallel_launch_local_memory<DriverType>));
+      return attr_query;
+    }();
     return attr;
   }
 };
@@ -487,11 +532,16 @@ struct CudaParallelLaunch<
     }
   }
   static cudaFuncAttributes get_cuda_func_attributes() {
-    cudaFuncAttributes attr;
-    CUDA_SAFE_CALL(cudaFuncGetAttributes(
-        &attr,
-        cuda_parallel_launch_global_memory<DriverType, MaxThreadsPerBlock,
-                                           MinBlocksPerSM>));
+    // The attribute query costs a runtime call per launch; the result is
+    // invariant per driver instantiation, so resolve it once.
+    static const cudaFuncAttributes attr = []() {
+      cudaFuncAttributes attr_query;
+      CUDA_SAFE_CALL(cudaFuncGetAttributes(
+          &attr_query,
+          cuda_parallel_launch_global_memory<DriverType, MaxThreadsPerBlock,
+                                             MinBlocksPerSM>));
+      return attr_query;
+    }();
     return attr;
   }
 };
@@ -537,9 +587,14 @@ struct CudaParallelLaunch<DriverType, Kokkos::LaunchBounds<0, 0>,
   }
 
   static cudaFuncAttributes get_cuda_func_attributes() {
-    cudaFuncAttributes attr;
-    CUDA_SAFE_CALL(cudaFuncGetAttributes(
-        &attr, cuda_parallel_launch_global_memory<DriverType>));
+    // The attribute query costs a runtime call per launch; the result is
+    // invariant per driver instantiation, so resolve it once.
+    static const cudaFuncAttributes attr = []() {
+      cudaFuncAttributes attr_query;
+      CUDA_SAFE_CALL(cudaFuncGetAttributes(
+          &attr_query, cuda_parallel_launch_global_memory<DriverType>));
+      return attr_query;
+    }();
     return attr;
   }
 };
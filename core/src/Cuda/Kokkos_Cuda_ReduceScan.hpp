@@ -954,6 +954,96 @@ inline unsigned cuda_single_inter_block_reduce_scan_shmem(
          Impl::FunctorValueTraits<FunctorType, ArgTag>::value_size(functor);
 }
 
+//----------------------------------------------------------------------------
+/* Decoupled-lookback single-pass scan.
+ *
+ * Used by ParallelScan only when KOKKOS_IMPL_CUDA_USE_DECOUPLED_LOOKBACK_SCAN
+ * is defined; the two-pass scan remains the default until this
+ * protocol has been validated on the target hardware.
+ *
+ * Global scratch holds one descriptor per tile, in size_type words:
+ *
+ *   [0]             status flag
+ *   [1 .. wc]       tile aggregate
+ *   [1+wc .. 2*wc]  inclusive prefix through this tile
+ *
+ * Descriptors must be zeroed before the launch.  Tiles are claimed in
+ * issue order through a ticket counter, so every predecessor of a
+ * running tile is itself resident or complete and the spin below is
+ * deadlock free.  Values cross global memory as raw size_type words;
+ * joins only ever run on properly aligned shared memory copies, so
+ * arbitrary value types and array values (value_count > 1) work.
+ */
+
+enum : Cuda::size_type {
+  CUDA_SCAN_TILE_INVALID   = 0,
+  CUDA_SCAN_TILE_AGGREGATE = 1,
+  CUDA_SCAN_TILE_INCLUSIVE = 2
+};
+
+// Scratch words per tile descriptor
+template <class FunctorType, class ArgTag>
+inline unsigned cuda_decoupled_lookback_scan_tile_words(
+    const FunctorType& functor) {
+  return 1 + 2 * (FunctorValueTraits<FunctorType, ArgTag>::value_size(functor) /
+                  sizeof(Cuda::size_type));
+}
+
+/* Publish 'tile_aggregate', walk predecessor descriptors to produce
+ * the exclusive prefix in 'tile_prefix', then publish the inclusive
+ * prefix.  Must be called by exactly one thread of the tile's block;
+ * 'tile_tmp' is caller-provided scratch one value wide.
+ */
+template <class FunctorType, class ArgTag>
+__device__ void cuda_decoupled_lookback_scan(
+    const FunctorType& functor, Cuda::size_type* const global_data,
+    const int tile_id, Cuda::size_type* const tile_aggregate,
+    Cuda::size_type* const tile_prefix, Cuda::size_type* const tile_tmp) {
+  typedef Cuda::size_type size_type;
+  typedef FunctorValueTraits<FunctorType, ArgTag> ValueTraits;
+  typedef FunctorValueJoin<FunctorType, ArgTag> ValueJoin;
+  typedef FunctorValueInit<FunctorType, ArgTag> ValueInit;
+
+  const unsigned wc     = ValueTraits::value_size(functor) / sizeof(size_type);
+  const unsigned stride = 1 + 2 * wc;
+
+  volatile size_type* const my_tile =
+      global_data + size_t(tile_id) * size_t(stride);
+
+  for (unsigned i = 0; i < wc; ++i) my_tile[1 + i] = tile_aggregate[i];
+  __threadfence();
+  my_tile[0] = CUDA_SCAN_TILE_AGGREGATE;
+
+  // Walk predecessors until one has published an inclusive prefix,
+  // accumulating aggregates right-to-left: prefix = pred op prefix.
+  // Join order preserves associativity; commutativity is not assumed.
+  bool have_prefix = false;
+  for (int pred = tile_id - 1; 0 <= pred; --pred) {
+    volatile size_type* const pred_tile =
+        global_data + size_t(pred) * size_t(stride);
+    size_type flag;
+    while (CUDA_SCAN_TILE_INVALID == (flag = pred_tile[0]))
+      ;
+    __threadfence();
+    const unsigned offset = CUDA_SCAN_TILE_INCLUSIVE == flag ? 1 + wc : 1;
+    for (unsigned i = 0; i < wc; ++i) tile_tmp[i] = pred_tile[offset + i];
+    if (have_prefix) {
+      ValueJoin::join(functor, tile_tmp, tile_prefix);
+    }
+    for (unsigned i = 0; i < wc; ++i) tile_prefix[i] = tile_tmp[i];
+    have_prefix = true;
+    if (CUDA_SCAN_TILE_INCLUSIVE == flag) break;
+  }
+  if (!have_prefix) ValueInit::init(functor, tile_prefix);
+
+  // Inclusive prefix = exclusive prefix joined with the tile aggregate.
+  for (unsigned i = 0; i < wc; ++i) tile_tmp[i] = tile_prefix[i];
+  ValueJoin::join(functor, tile_tmp, tile_aggregate);
+  for (unsigned i = 0; i < wc; ++i) my_tile[1 + wc + i] = tile_tmp[i];
+  __threadfence();
+  my_tile[0] = CUDA_SCAN_TILE_INCLUSIVE;
+}
+
 }  // namespace Impl
 }  // namespace Kokkos
 
@@ -205,6 +205,36 @@ __device__ inline T shfl_up(const T& val, int delta, int width,
   return rv;
 }
 
+#if defined(__CUDA_ARCH__)
+
+/// \brief Warp-aggregated fetch-add for heavily contended counters.
+///
+/// The active lanes of the warp elect a leader, the leader issues a
+/// single atomic on behalf of the whole warp, and every lane derives the
+/// value its own atomic_fetch_add would have returned from its rank
+/// among the active lanes.  All active lanes must pass the same dest and
+/// the same val (the hot-counter pattern); lanes may be inactive due to
+/// divergence.
+template <class T>
+__device__ inline T atomic_fetch_add_aggregated(volatile T* const dest,
+                                                const T val) {
+  // BALLOT(1) rather than ACTIVEMASK so that pre-Volta toolchains, where
+  // ACTIVEMASK is unavailable, still see the set of active lanes
+  const unsigned mask = KOKKOS_IMPL_CUDA_BALLOT(1);
+  unsigned lane_id;
+  asm volatile("mov.u32 %0, %%laneid;" : "=r"(lane_id));
+  const int leader    = __ffs(mask) - 1;
+  const unsigned rank = __popc(mask & ((1u << lane_id) - 1));
+  T base              = {};
+  if (lane_id == unsigned(leader)) {
+    base = atomic_fetch_add(dest, T(__popc(mask)) * val);
+  }
+  Impl::in_place_shfl(base, base, leader, 32, mask);
+  return base + T(rank) * val;
+}
+
+#endif  // defined( __CUDA_ARCH__ )
+
 }  // end namespace Kokkos
 
 #endif  // defined( KOKKOS_ENABLE_CUDA )
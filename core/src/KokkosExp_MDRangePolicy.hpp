@@ -48,6 +48,7 @@
 #include <initializer_list>
 
 #include <Kokkos_Layout.hpp>
+#include <Kokkos_hwloc.hpp>
 
 #include <impl/KokkosExp_Host_IterateTile.hpp>
 #include <Kokkos_ExecPolicy.hpp>
@@ -104,6 +105,9 @@ struct Rank {
   static_assert(N != 1u,
                 "Kokkos Error: rank 1 is not a multi-dimensional range");
   static_assert(N < 7u, "Kokkos Error: Unsupported rank...");
+  static_assert(OuterDir != Iterate::Morton,
+                "Kokkos Error: Morton order applies to the intra-tile (inner) "
+                "iteration only");
 
   using iteration_pattern = Rank<N, OuterDir, InnerDir>;
 
@@ -113,6 +117,28 @@ struct Rank {
 };
 
 // multi-dimensional iteration pattern
+// ------------------------------------------------------------------ //
+
+/// \brief Opt-in request to derive host tile sizes from cache geometry.
+///
+/// Passed as the first constructor argument of MDRangePolicy in place of
+/// explicit tile sizes.  bytes_per_iteration is the functor's per-iteration
+/// memory footprint (bytes read plus written); the policy sizes tiles so a
+/// tile's footprint fills about half of the requested cache level, giving
+/// the innermost dimension the longest contiguous run.  On device backends
+/// the tag is ignored and the backend defaults apply.
+struct TuneTileSizes {
+  size_t bytes_per_iteration;
+  unsigned cache_level;
+
+  explicit TuneTileSizes(size_t bytes_per_iteration_ = 8,
+                         unsigned cache_level_      = 2)
+      : bytes_per_iteration(bytes_per_iteration_),
+        cache_level(cache_level_) {}
+};
+
+// ------------------------------------------------------------------ //
+
 template <typename... Properties>
 struct MDRangePolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
   using traits       = Kokkos::Impl::PolicyTraits<Properties...>;
@@ -190,8 +216,9 @@ struct MDRangePolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
           : default_inner_direction<typename traits::execution_space>::value);
 
   // Ugly ugly workaround intel 14 not handling scoped enum correctly
-  static constexpr int Right = static_cast<int>(Iterate::Right);
-  static constexpr int Left  = static_cast<int>(Iterate::Left);
+  static constexpr int Right  = static_cast<int>(Iterate::Right);
+  static constexpr int Left   = static_cast<int>(Iterate::Left);
+  static constexpr int Morton = static_cast<int>(Iterate::Morton);
 
   KOKKOS_INLINE_FUNCTION const typename traits::execution_space& space() const {
     return m_space;
@@ -213,6 +240,38 @@ struct MDRangePolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
     init(lower, upper, tile);
   }
 
+  template <typename LT, typename UT>
+  MDRangePolicy(TuneTileSizes const& tune,
+                std::initializer_list<LT> const& lower,
+                std::initializer_list<UT> const& upper)
+      : m_space() {
+    if (static_cast<int>(lower.size()) != rank ||
+        static_cast<int>(upper.size()) != rank)
+      Kokkos::abort(
+          "MDRangePolicy: Constructor initializer lists have wrong size");
+    for (auto i = 0; i < rank; ++i) {
+      m_lower[i] = static_cast<array_index_type>(lower.begin()[i]);
+      m_upper[i] = static_cast<array_index_type>(upper.begin()[i]);
+      m_tile[i]  = 0;
+    }
+    m_num_tiles      = 1;
+    m_prod_tile_dims = 1;
+    tune_tile_sizes(tune);
+    init();
+  }
+
+  MDRangePolicy(TuneTileSizes const& tune, point_type const& lower,
+                point_type const& upper)
+      : m_space(),
+        m_lower(lower),
+        m_upper(upper),
+        m_tile(tile_type{}),
+        m_num_tiles(1),
+        m_prod_tile_dims(1) {
+    tune_tile_sizes(tune);
+    init();
+  }
+
   MDRangePolicy(point_type const& lower, point_type const& upper,
                 tile_type const& tile = tile_type{})
       : m_space(),
@@ -247,6 +306,40 @@ struct MDRangePolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
         m_prod_tile_dims(p.m_prod_tile_dims) {}
 
  private:
+  // Fill m_tile from cache geometry: budget half the requested cache level
+  // for one tile's footprint and hand the innermost dimension the longest
+  // contiguous run.  Device backends keep their own defaults.
+  void tune_tile_sizes(TuneTileSizes const& tune) {
+    if (false
+#if defined(KOKKOS_ENABLE_CUDA)
+        || std::is_same<typename traits::execution_space, Kokkos::Cuda>::value
+#endif
+#if defined(KOKKOS_ENABLE_ROCM)
+        || std::is_same<typename traits::execution_space,
+                        Kokkos::Experimental::ROCm>::value
+#endif
+    )
+      return;
+
+    const size_t cache = Kokkos::hwloc::get_cache_size(tune.cache_level);
+    const size_t bytes =
+        tune.bytes_per_iteration > 0 ? tune.bytes_per_iteration : 1;
+    array_index_type budget =
+        static_cast<array_index_type>(cache / 2 / bytes);
+    if (budget < 1) budget = 1;
+
+    const int increment = (int)inner_direction == (int)Right ? -1 : 1;
+    const int start     = (int)inner_direction == (int)Right ? rank - 1 : 0;
+    const int end       = (int)inner_direction == (int)Right ? -1 : rank;
+    for (int i = start; i != end; i += increment) {
+      array_index_type span = m_upper[i] - m_lower[i];
+      if (span < 1) span = 1;
+      m_tile[i] = span < budget ? span : budget;
+      budget /= m_tile[i];
+      if (budget < 1) budget = 1;
+    }
+  }
+
   void init() {
     // Host
     if (true
@@ -512,6 +605,58 @@ struct MDRangePolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
 
 }  // namespace Kokkos
 
+#if defined(KOKKOS_ENABLE_PROFILING)
+
+namespace Kokkos {
+namespace Impl {
+
+/* MDRangePolicy exposes its tile extents to a tuning tool; a rewritten
+ * tile is validated by reconstructing the policy through the regular
+ * constructor. */
+template <class... Properties>
+struct PolicyTuningAdaptor<Kokkos::MDRangePolicy<Properties...>> {
+  typedef Kokkos::MDRangePolicy<Properties...> policy_type;
+
+  static policy_type apply(const policy_type& policy,
+                           const std::string& kernelPrefix) {
+    Kokkos::Profiling::PolicyTuning tuning = {};
+
+    int64_t work_size = 1;
+    for (int i = 0; i < int(policy_type::rank); ++i) {
+      work_size *= int64_t(policy.m_upper[i]) - int64_t(policy.m_lower[i]);
+    }
+    tuning.work_size     = work_size;
+    tuning.team_size     = -1;
+    tuning.vector_length = -1;
+    tuning.tile_rank     = int(policy_type::rank);
+    for (int i = 0; i < int(policy_type::rank); ++i) {
+      tuning.tile[i] = policy.m_tile[i];
+    }
+
+    Kokkos::Profiling::tunePolicy(kernelPrefix, 0, tuning);
+
+    bool changed = false;
+    typename policy_type::tile_type tile;
+    for (int i = 0; i < int(policy_type::rank); ++i) {
+      if (0 < tuning.tile[i] && tuning.tile[i] != policy.m_tile[i]) {
+        tile[i] = tuning.tile[i];
+        changed = true;
+      } else {
+        tile[i] = policy.m_tile[i];
+      }
+    }
+    if (changed) {
+      return policy_type(policy.space(), policy.m_lower, policy.m_upper, tile);
+    }
+    return policy;
+  }
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif /* defined( KOKKOS_ENABLE_PROFILING ) */
+
 // For backward compatibility
 namespace Kokkos {
 namespace Experimental {
@@ -0,0 +1,260 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_AllocationAudit.hpp
+/// \brief Audit mode attributing host allocations to kernel dispatches.
+///
+/// A steady-state loop that should be allocation-free can still hide a
+/// host allocation inside the runtime - a scratch resize, a host
+/// staging buffer for a reduction result - and the resulting malloc
+/// spike is jitter that a latency budget cannot absorb.  The audit
+/// here answers "which kernel allocated, from where": while an
+/// AllocationAudit guard is live, the runtime's host allocation paths
+/// report into a fixed table keyed by (kernel label, allocation site),
+/// and the table is printed on request and at finalize.  Recording is
+/// itself allocation-free - the table and per-thread label buffers are
+/// statically sized - and with no guard live every hook is a single
+/// relaxed atomic load.
+///
+/// Only allocations made between dispatch entry and return are
+/// attributed; the current kernel label is tracked per host thread, so
+/// concurrent dispatches from different threads audit independently.
+/// For hard enforcement rather than reporting, see
+/// Kokkos_RealtimePhase.hpp.
+
+#ifndef KOKKOS_ALLOCATIONAUDIT_HPP
+#define KOKKOS_ALLOCATIONAUDIT_HPP
+
+#include <Kokkos_Macros.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+
+namespace Kokkos {
+namespace Impl {
+
+//! Global audit table; all storage statically sized, never reallocated.
+struct AllocationAuditState {
+  enum : int { record_capacity = 64, label_capacity = 64 };
+
+  struct Record {
+    char region[label_capacity];
+    char site[label_capacity];
+    uint64_t count;
+    uint64_t bytes;
+  };
+
+  std::atomic<int> enabled;
+  std::mutex mutex;
+  Record records[record_capacity];
+  int num_records;
+  uint64_t dropped;
+
+  AllocationAuditState() : enabled(0), num_records(0), dropped(0) {
+    memset(records, 0, sizeof(records));
+  }
+};
+
+inline AllocationAuditState& allocation_audit_state() {
+  static AllocationAuditState state;
+  return state;
+}
+
+//! Per-host-thread dispatch context: depth and current kernel label.
+struct AllocationAuditThread {
+  int depth;
+  char region[AllocationAuditState::label_capacity];
+};
+
+inline AllocationAuditThread& allocation_audit_thread() {
+  static thread_local AllocationAuditThread self = {0, {0}};
+  return self;
+}
+
+/** \brief  Report a host allocation to the audit.
+ *
+ *  Called from the runtime's host allocation paths with a static site
+ *  string.  One relaxed load when no audit is live; ignored outside
+ *  dispatch regions, where allocation is setup rather than jitter.
+ */
+inline void allocation_audit_note(const char* const site,
+                                  const size_t bytes) {
+  AllocationAuditState& state = allocation_audit_state();
+  if (0 == state.enabled.load(std::memory_order_relaxed)) return;
+
+  AllocationAuditThread& self = allocation_audit_thread();
+  if (0 == self.depth) return;
+
+  std::lock_guard<std::mutex> lock(state.mutex);
+  for (int i = 0; i < state.num_records; ++i) {
+    AllocationAuditState::Record& r = state.records[i];
+    if (0 == strncmp(r.region, self.region,
+                     AllocationAuditState::label_capacity) &&
+        0 == strncmp(r.site, site, AllocationAuditState::label_capacity)) {
+      ++r.count;
+      r.bytes += bytes;
+      return;
+    }
+  }
+  if (state.num_records < int(AllocationAuditState::record_capacity)) {
+    AllocationAuditState::Record& r = state.records[state.num_records++];
+    strncpy(r.region, self.region, AllocationAuditState::label_capacity - 1);
+    strncpy(r.site, site, AllocationAuditState::label_capacity - 1);
+    r.count = 1;
+    r.bytes = bytes;
+  } else {
+    ++state.dropped;
+  }
+}
+
+/** \brief  Scope marking a parallel dispatch region on this thread.
+ *
+ *  Constructed at the top of the dispatch wrappers with the kernel
+ *  label; while in scope, audited allocations on this thread are
+ *  attributed to that label.  Nested dispatches keep the outermost
+ *  label.  Costs one relaxed load when no audit is live.
+ */
+class AllocationAuditRegion {
+ public:
+  explicit AllocationAuditRegion(const char* const label) : m_active(false) {
+    if (0 == allocation_audit_state().enabled.load(std::memory_order_relaxed))
+      return;
+    AllocationAuditThread& self = allocation_audit_thread();
+    if (0 == self.depth++) {
+      strncpy(self.region, label && label[0] ? label : "(unnamed kernel)",
+              AllocationAuditState::label_capacity - 1);
+      self.region[AllocationAuditState::label_capacity - 1] = 0;
+    }
+    m_active = true;
+  }
+
+  explicit AllocationAuditRegion(const std::string& label)
+      : AllocationAuditRegion(label.c_str()) {}
+
+  ~AllocationAuditRegion() {
+    if (m_active) --allocation_audit_thread().depth;
+  }
+
+  AllocationAuditRegion(const AllocationAuditRegion&) = delete;
+  AllocationAuditRegion& operator=(const AllocationAuditRegion&) = delete;
+
+ private:
+  bool m_active;
+};
+
+}  // namespace Impl
+
+namespace Experimental {
+
+/** \brief  Scope guard enabling the host allocation audit.
+ *
+ *  Wrap the steady-state loop; any host allocation the runtime makes
+ *  inside a parallel dispatch while the guard is live is tallied per
+ *  (kernel label, allocation site).  Guards nest.  A clean run - an
+ *  allocation-free hot path - leaves the table empty.
+ *
+ *  \code
+ *    {
+ *      Kokkos::Experimental::AllocationAudit audit;
+ *      for (int step = 0; step < warmed_steps; ++step) time_step();
+ *    }
+ *    Kokkos::Experimental::allocation_audit_report();
+ *  \endcode
+ */
+class AllocationAudit {
+ public:
+  AllocationAudit() { ++Kokkos::Impl::allocation_audit_state().enabled; }
+  ~AllocationAudit() { --Kokkos::Impl::allocation_audit_state().enabled; }
+
+  AllocationAudit(const AllocationAudit&) = delete;
+  AllocationAudit& operator=(const AllocationAudit&) = delete;
+};
+
+//! Number of distinct (kernel label, site) pairs recorded so far.
+inline int allocation_audit_count() {
+  Kokkos::Impl::AllocationAuditState& state = Kokkos::Impl::allocation_audit_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  return state.num_records;
+}
+
+//! Clear the audit table.
+inline void allocation_audit_reset() {
+  Kokkos::Impl::AllocationAuditState& state = Kokkos::Impl::allocation_audit_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.num_records = 0;
+  state.dropped     = 0;
+}
+
+/** \brief  Print the audit table to the given stream (default stderr);
+ *          also invoked by Kokkos::finalize when the table is nonempty.
+ */
+inline void allocation_audit_report(FILE* const out = stderr) {
+  Kokkos::Impl::AllocationAuditState& state = Kokkos::Impl::allocation_audit_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  if (0 == state.num_records) return;
+  fprintf(out,
+          "Kokkos::AllocationAudit: host allocations inside parallel "
+          "dispatch:\n");
+  for (int i = 0; i < state.num_records; ++i) {
+    const Kokkos::Impl::AllocationAuditState::Record& r = state.records[i];
+    fprintf(out,
+            "  kernel \"%s\" : %s : %llu allocation%s, %llu bytes total\n",
+            r.region, r.site, (unsigned long long)r.count,
+            r.count == 1 ? "" : "s", (unsigned long long)r.bytes);
+  }
+  if (state.dropped) {
+    fprintf(out, "  ... and %llu allocations dropped (table full)\n",
+            (unsigned long long)state.dropped);
+  }
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_ALLOCATIONAUDIT_HPP */
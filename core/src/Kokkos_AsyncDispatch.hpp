@@ -0,0 +1,154 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_AsyncDispatch.hpp
+/// \brief Future-returning kernel dispatch with dependency chaining.
+///
+/// parallel_for_async and parallel_reduce_async launch a kernel after
+/// a set of prerequisite futures are ready and return a future that
+/// completes when the kernel (and its fence) has completed, so
+/// independent kernels form a dataflow graph instead of executing in
+/// strict program order behind global fences.  On an HPX build the
+/// futures are hpx::shared_future, kernels run as HPX tasks, and the
+/// results compose directly with HPX dataflow.  The other host
+/// backends must dispatch from their master thread, so there the
+/// kernel runs inline and the returned std::shared_future is already
+/// satisfied - code written against this API behaves identically
+/// everywhere and gains the overlap where the runtime provides it.
+
+#ifndef KOKKOS_ASYNCDISPATCH_HPP
+#define KOKKOS_ASYNCDISPATCH_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_Parallel.hpp>
+#include <Kokkos_Parallel_Reduce.hpp>
+
+#if defined(KOKKOS_ENABLE_HPX)
+#include <hpx/include/async.hpp>
+#include <hpx/include/future.hpp>
+#else
+#include <future>
+#endif
+
+#include <string>
+#include <vector>
+
+namespace Kokkos {
+namespace Experimental {
+
+#if defined(KOKKOS_ENABLE_HPX)
+/// \brief Future type returned by the async dispatches.
+template <class T = void>
+using kernel_future = hpx::shared_future<T>;
+#else
+template <class T = void>
+using kernel_future = std::shared_future<T>;
+#endif
+
+namespace Impl {
+
+#if defined(KOKKOS_ENABLE_HPX)
+template <class F>
+auto async_task(F&& f) -> hpx::shared_future<decltype(f())> {
+  return hpx::async(std::forward<F>(f)).share();
+}
+#else
+template <class F>
+auto async_task(F&& f) -> std::shared_future<decltype(f())> {
+  // Host backends must dispatch from the master thread: run the task
+  // inline and hand back the already-satisfied future
+  std::future<decltype(f())> task =
+      std::async(std::launch::deferred, std::forward<F>(f));
+  task.wait();
+  return task.share();
+}
+#endif
+
+}  // namespace Impl
+
+/// \brief Launch a parallel_for once every dependency is ready; the
+///        returned future completes when the kernel has completed.
+template <class Policy, class Functor>
+kernel_future<void> parallel_for_async(
+    const std::string& arg_label, const Policy& arg_policy,
+    const Functor& arg_functor,
+    const std::vector<kernel_future<void>>& arg_dependencies =
+        std::vector<kernel_future<void>>()) {
+  return Impl::async_task(
+      [arg_label, arg_policy, arg_functor, arg_dependencies]() {
+        for (const kernel_future<void>& dep : arg_dependencies) dep.wait();
+        Kokkos::parallel_for(arg_label, arg_policy, arg_functor);
+        typename Policy::execution_space().fence();
+      });
+}
+
+/// \brief Launch a parallel_reduce once every dependency is ready; the
+///        returned future carries the reduction result.
+template <class ValueType, class Policy, class Functor>
+kernel_future<ValueType> parallel_reduce_async(
+    const std::string& arg_label, const Policy& arg_policy,
+    const Functor& arg_functor,
+    const std::vector<kernel_future<void>>& arg_dependencies =
+        std::vector<kernel_future<void>>()) {
+  return Impl::async_task(
+      [arg_label, arg_policy, arg_functor, arg_dependencies]() -> ValueType {
+        for (const kernel_future<void>& dep : arg_dependencies) dep.wait();
+        ValueType result = ValueType();
+        Kokkos::parallel_reduce(arg_label, arg_policy, arg_functor, result);
+        return result;
+      });
+}
+
+/// \brief Future that completes when all of the given futures have.
+inline kernel_future<void> when_all_kernels(
+    const std::vector<kernel_future<void>>& arg_futures) {
+  return Impl::async_task([arg_futures]() {
+    for (const kernel_future<void>& f : arg_futures) f.wait();
+  });
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_ASYNCDISPATCH_HPP */
@@ -294,6 +294,16 @@ extern KOKKOS_INLINE_FUNCTION void unlock_address_rocm_space(void* ptr);
 #include "impl/Kokkos_Atomic_Load.hpp"
 #include "impl/Kokkos_Atomic_Store.hpp"
 
+//----------------------------------------------------------------------------
+// Provide read-modify-write atomics with memory order and scope semantics
+
+#include "impl/Kokkos_Atomic_Fetch_Ops_Ordered.hpp"
+
+//----------------------------------------------------------------------------
+// Report which implementation the atomics of this build resolve to
+
+#include "impl/Kokkos_Atomic_Audit.hpp"
+
 //----------------------------------------------------------------------------
 // This atomic-style macro should be an inlined function, not a macro
 
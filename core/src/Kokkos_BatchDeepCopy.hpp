@@ -0,0 +1,245 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_BatchDeepCopy.hpp
+/// \brief Fused dispatch for many small deep_copy operations.
+///
+/// A halo or ghost exchange issues hundreds of small deep_copy calls
+/// per step, and each one pays the full dispatch in Kokkos_CopyViews.hpp
+/// plus a kernel launch.  deep_copy_batch takes whole arrays of
+/// destination and source Views, uploads one descriptor table, and
+/// moves every pair in a single parallel_for: the kernel locates its
+/// segment in the table by binary search and copies element-wise, so
+/// the launch count per exchange drops from the number of faces to one.
+
+#ifndef KOKKOS_BATCHDEEPCOPY_HPP
+#define KOKKOS_BATCHDEEPCOPY_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_View.hpp>
+#include <Kokkos_Parallel.hpp>
+#include <Kokkos_ExecPolicy.hpp>
+#include <Kokkos_CopyViews.hpp>
+#include <impl/Kokkos_Error.hpp>
+
+#include <string>
+#include <vector>
+
+namespace Kokkos {
+namespace Impl {
+
+/* One copy segment of the fused operation.  Offsets are in elements,
+ * cumulative over the batch; strides support rank-1 non-contiguous
+ * pairs, every other pair is copied through its contiguous span. */
+template <class ValueType>
+struct BatchCopySegment {
+  ValueType* dst;
+  const ValueType* src;
+  uint64_t offset;
+  uint64_t dst_stride;
+  uint64_t src_stride;
+};
+
+template <class ValueType, class ExecSpace>
+struct BatchCopyFunctor {
+  typedef Kokkos::View<const BatchCopySegment<ValueType>*,
+                       typename ExecSpace::memory_space>
+      segment_view;
+
+  segment_view m_segments;
+  uint64_t m_total;
+
+  BatchCopyFunctor(const segment_view& arg_segments, const uint64_t arg_total)
+      : m_segments(arg_segments), m_total(arg_total) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const uint64_t i) const {
+    // Binary search for the last segment whose offset is <= i
+    unsigned lo = 0;
+    unsigned hi = unsigned(m_segments.extent(0));
+    while (1 < hi - lo) {
+      const unsigned mid = (lo + hi) >> 1;
+      if (m_segments(mid).offset <= i)
+        lo = mid;
+      else
+        hi = mid;
+    }
+    const BatchCopySegment<ValueType>& seg = m_segments(lo);
+    const uint64_t k                       = i - seg.offset;
+    seg.dst[k * seg.dst_stride] = seg.src[k * seg.src_stride];
+  }
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  Copy 'count' View pairs in one fused kernel launch.
+ *
+ *  Each pair must have matching extents and must either be contiguous
+ *  on both sides or of rank 1, the same constraint the element-wise
+ *  remap in deep_copy resolves per pair.  The transfer is enqueued on
+ *  'exec' and is asynchronous with respect to the caller, like
+ *  deep_copy with an execution space argument.
+ */
+template <class ExecSpace, class DstView, class SrcView>
+void deep_copy_batch(const ExecSpace& exec, const DstView* const dst,
+                     const SrcView* const src, const size_t count) {
+  typedef typename DstView::non_const_value_type value_type;
+  typedef Kokkos::Impl::BatchCopySegment<value_type> segment_type;
+  typedef Kokkos::View<segment_type*, typename ExecSpace::memory_space>
+      segment_view;
+
+  static_assert(Kokkos::is_execution_space<ExecSpace>::value,
+                "Kokkos::Experimental::deep_copy_batch: first argument must "
+                "be an execution space instance");
+  static_assert(
+      std::is_same<value_type, typename SrcView::non_const_value_type>::value,
+      "Kokkos::Experimental::deep_copy_batch: incompatible value types");
+  static_assert(
+      std::is_same<typename DstView::value_type, value_type>::value,
+      "Kokkos::Experimental::deep_copy_batch: destination must be non-const");
+  static_assert(
+      Kokkos::Impl::SpaceAccessibility<
+          ExecSpace, typename DstView::memory_space>::accessible &&
+          Kokkos::Impl::SpaceAccessibility<
+              ExecSpace, typename SrcView::memory_space>::accessible,
+      "Kokkos::Experimental::deep_copy_batch: execution space cannot access "
+      "the views");
+
+  if (0 == count) return;
+
+  segment_view segments(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "deep_copy_batch"),
+      count);
+  typename segment_view::HostMirror host_segments =
+      Kokkos::create_mirror_view(segments);
+
+  uint64_t total = 0;
+
+  for (size_t p = 0; p < count; ++p) {
+    for (unsigned r = 0; r < DstView::rank; ++r) {
+      if (dst[p].extent(r) != src[p].extent(r)) {
+        Kokkos::Impl::throw_runtime_exception(
+            "Kokkos::Experimental::deep_copy_batch: extent mismatch in pair " +
+            std::to_string(p));
+      }
+    }
+
+    segment_type& seg = host_segments(p);
+    seg.offset        = total;
+
+    if (dst[p].span_is_contiguous() && src[p].span_is_contiguous()) {
+      seg.dst        = dst[p].data();
+      seg.src        = src[p].data();
+      seg.dst_stride = 1;
+      seg.src_stride = 1;
+      total += dst[p].span();
+    } else if (1 == DstView::rank && 1 == SrcView::rank) {
+      seg.dst        = dst[p].data();
+      seg.src        = src[p].data();
+      seg.dst_stride = dst[p].stride_0();
+      seg.src_stride = src[p].stride_0();
+      total += dst[p].extent(0);
+    } else {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::deep_copy_batch: pair " + std::to_string(p) +
+          " is neither contiguous nor rank 1");
+    }
+  }
+
+  // On host backends the mirror aliases the table itself
+  if (host_segments.data() != segments.data())
+    Kokkos::deep_copy(exec, segments, host_segments);
+
+  Kokkos::parallel_for(
+      "Kokkos::deep_copy_batch",
+      Kokkos::RangePolicy<ExecSpace, Kokkos::IndexType<uint64_t>>(exec, 0,
+                                                                  total),
+      Kokkos::Impl::BatchCopyFunctor<value_type, ExecSpace>(segments, total));
+}
+
+/** \brief  Copy 'count' View pairs in one fused kernel launch on the
+ *          destination's execution space, fencing on completion like
+ *          the two-argument deep_copy.
+ */
+template <class DstView, class SrcView>
+void deep_copy_batch(const DstView* const dst, const SrcView* const src,
+                     const size_t count) {
+  typedef typename DstView::execution_space execution_space;
+  execution_space exec;
+  deep_copy_batch(exec, dst, src, count);
+  exec.fence();
+}
+
+/** \brief  Convenience overload over std::vector of View pairs. */
+template <class ExecSpace, class DstView, class SrcView>
+void deep_copy_batch(const ExecSpace& exec, const std::vector<DstView>& dst,
+                     const std::vector<SrcView>& src) {
+  if (dst.size() != src.size()) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::deep_copy_batch: dst and src counts differ");
+  }
+  deep_copy_batch(exec, dst.data(), src.data(), dst.size());
+}
+
+/** \brief  Convenience overload over std::vector of View pairs; fences
+ *          on completion.
+ */
+template <class DstView, class SrcView>
+void deep_copy_batch(const std::vector<DstView>& dst,
+                     const std::vector<SrcView>& src) {
+  if (dst.size() != src.size()) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::deep_copy_batch: dst and src counts differ");
+  }
+  deep_copy_batch(dst.data(), src.data(), dst.size());
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_BATCHDEEPCOPY_HPP
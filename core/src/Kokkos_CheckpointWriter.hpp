@@ -0,0 +1,284 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+/// \file Kokkos_CheckpointWriter.hpp
+/// \brief Asynchronous double-buffered checkpointing of registered Views.
+///
+/// CheckpointWriter snapshots a set of registered Views with
+/// execution-space-instance deep_copy into pinned host staging buffers
+/// and streams them to disk from a background thread, so the next
+/// timestep computes while the previous checkpoint is still being
+/// written.  Two staging buffer sets alternate: checkpoint N+1 stages
+/// while checkpoint N drains to disk, and a call blocks only if the
+/// buffer set it needs is still in flight.
+///
+/// Files are written in the Kokkos_ViewSerialization.hpp container
+/// format, one file per registered View named <prefix>.<label>, and
+/// restore with MappedView.
+
+#ifndef KOKKOS_CHECKPOINTWRITER_HPP
+#define KOKKOS_CHECKPOINTWRITER_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_ViewSerialization.hpp>
+
+#include <condition_variable>
+#include <cstdio>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Kokkos {
+namespace Experimental {
+
+template <class ExecutionSpace = Kokkos::DefaultExecutionSpace>
+class CheckpointWriter {
+ public:
+  using execution_space = ExecutionSpace;
+
+// Device-to-host copies overlap with compute only when the host side is
+// pinned; on non-Cuda builds plain HostSpace is the staging target.
+#if defined(KOKKOS_ENABLE_CUDA)
+  using staging_memory_space = Kokkos::CudaHostPinnedSpace;
+#else
+  using staging_memory_space = Kokkos::HostSpace;
+#endif
+
+  CheckpointWriter() = default;
+
+  CheckpointWriter(const CheckpointWriter&) = delete;
+  CheckpointWriter& operator=(const CheckpointWriter&) = delete;
+
+  ~CheckpointWriter() {
+    wait();
+    if (m_worker.joinable()) {
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+      }
+      m_work_ready.notify_all();
+      m_worker.join();
+    }
+  }
+
+  /// \brief Register a View; its contents are captured by every
+  ///        subsequent checkpoint call.
+  ///
+  /// The View's label names the file, so registered labels must be
+  /// unique within one writer.
+  template <class ViewType>
+  void register_view(const ViewType& v) {
+    using staging_type =
+        Kokkos::View<typename ViewType::non_const_data_type,
+                     typename ViewType::array_layout, staging_memory_space>;
+    using value_type = typename ViewType::non_const_value_type;
+
+    Entry entry;
+    entry.label = v.label();
+
+    staging_type staging[2];
+    for (int which = 0; which < 2; ++which) {
+      staging[which] = staging_type(
+          Kokkos::view_alloc(entry.label + "::checkpoint_staging",
+                             WithoutInitializing),
+          v.layout());
+      entry.data[which] = staging[which].data();
+    }
+    entry.bytes = uint64_t(staging[0].span()) * sizeof(value_type);
+
+    std::memset(&entry.header, 0, sizeof(entry.header));
+    std::strncpy(entry.header.magic, "KokkosV", sizeof(entry.header.magic));
+    entry.header.version =
+        Kokkos::Impl::ViewSerializationHeader::current_version;
+    entry.header.rank   = uint32_t(ViewType::Rank);
+    entry.header.layout = Kokkos::Impl::view_serialization_layout<
+        typename ViewType::array_layout>::value;
+    entry.header.value_size = uint32_t(sizeof(value_type));
+    entry.header.value_hash = Kokkos::Impl::view_serialization_type_hash(
+        typeid(value_type).name());
+    for (unsigned r = 0; r < ViewType::Rank; ++r)
+      entry.header.extents[r] = v.extent(r);
+    entry.header.payload_bytes = entry.bytes;
+
+    entry.stage = [staging, v](const execution_space& exec, int which) {
+      Kokkos::deep_copy(exec, staging[which], v);
+    };
+
+    m_entries.push_back(std::move(entry));
+  }
+
+  /// \brief Snapshot all registered Views and write them in the
+  ///        background to files named <prefix>.<label>.
+  ///
+  /// Returns once the snapshot is staged on the host; disk I/O
+  /// proceeds concurrently with subsequent work.  Blocks first if the
+  /// staging buffer set it needs is still being written.
+  void checkpoint(const execution_space& exec, const std::string& prefix) {
+    start_worker();
+
+    int const which = m_next_buffer;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      // The single job slot must be empty and this buffer set drained
+      m_buffer_free.wait(lock, [this, which] {
+        return !m_has_job && !m_in_flight[which];
+      });
+    }
+
+    for (Entry const& entry : m_entries) entry.stage(exec, which);
+    exec.fence();
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_in_flight[which] = true;
+      m_job              = Job{which, prefix};
+      m_has_job          = true;
+    }
+    m_work_ready.notify_all();
+    m_next_buffer ^= 1;
+  }
+
+  void checkpoint(const std::string& prefix) {
+    checkpoint(execution_space(), prefix);
+  }
+
+  /// \brief Block until all issued checkpoints are on disk.
+  void wait() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_buffer_free.wait(lock, [this] {
+      return !m_has_job && !m_in_flight[0] && !m_in_flight[1];
+    });
+    if (!m_error.empty()) {
+      std::string error = m_error;
+      m_error.clear();
+      lock.unlock();
+      Kokkos::Impl::throw_runtime_exception(error);
+    }
+  }
+
+ private:
+  struct Entry {
+    std::string label;
+    Kokkos::Impl::ViewSerializationHeader header;
+    std::function<void(const execution_space&, int)> stage;
+    const void* data[2];
+    uint64_t bytes;
+  };
+
+  struct Job {
+    int which;
+    std::string prefix;
+  };
+
+  void start_worker() {
+    if (m_worker.joinable()) return;
+    m_worker = std::thread([this] { worker_loop(); });
+  }
+
+  void worker_loop() {
+    for (;;) {
+      Job job;
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_work_ready.wait(lock, [this] { return m_has_job || m_stop; });
+        if (!m_has_job && m_stop) return;
+        job       = m_job;
+        m_has_job = false;
+      }
+      // A checkpoint call may be waiting on the job slot
+      m_buffer_free.notify_all();
+
+      std::string error;
+      for (Entry const& entry : m_entries) {
+        if (!write_entry(entry, job.which, job.prefix) && error.empty()) {
+          error = "Kokkos::Experimental::CheckpointWriter failed writing " +
+                  job.prefix + "." + entry.label;
+        }
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_in_flight[job.which] = false;
+        if (!error.empty()) m_error = error;
+      }
+      m_buffer_free.notify_all();
+    }
+  }
+
+  bool write_entry(Entry const& entry, int which,
+                   const std::string& prefix) const {
+    std::FILE* f = std::fopen((prefix + "." + entry.label).c_str(), "wb");
+    if (nullptr == f) return false;
+
+    char block[Kokkos::Impl::ViewSerializationHeader::payload_offset];
+    std::memset(block, 0, sizeof(block));
+    std::memcpy(block, &entry.header, sizeof(entry.header));
+
+    bool ok = 1 == std::fwrite(block, sizeof(block), 1, f);
+    if (ok && 0 != entry.bytes) {
+      ok = 1 == std::fwrite(entry.data[which], size_t(entry.bytes), 1, f);
+    }
+    return (0 == std::fclose(f)) && ok;
+  }
+
+  std::vector<Entry> m_entries;
+  std::thread m_worker;
+  std::mutex m_mutex;
+  std::condition_variable m_work_ready;
+  std::condition_variable m_buffer_free;
+  Job m_job;
+  std::string m_error;
+  bool m_has_job       = false;
+  bool m_stop          = false;
+  bool m_in_flight[2]  = {false, false};
+  int m_next_buffer    = 0;
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_CHECKPOINTWRITER_HPP */
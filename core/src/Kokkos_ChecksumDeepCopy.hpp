@@ -0,0 +1,204 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_ChecksumDeepCopy.hpp
+/// \brief deep_copy with transfer-time corruption detection.
+///
+/// Silent corruption on a transfer path is typically discovered long
+/// after the copy that introduced it, when revalidating the data is no
+/// longer affordable.  checksummed_deep_copy digests the source on its
+/// own execution space, performs the copy, digests the destination, and
+/// throws if the two disagree — catching the corruption at the transfer
+/// that caused it for one extra read of each side.  view_digest exposes
+/// the same digest for ad-hoc revalidation of data at rest.
+
+#ifndef KOKKOS_CHECKSUMDEEPCOPY_HPP
+#define KOKKOS_CHECKSUMDEEPCOPY_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_View.hpp>
+#include <Kokkos_Parallel.hpp>
+#include <Kokkos_ExecPolicy.hpp>
+#include <Kokkos_CopyViews.hpp>
+#include <impl/Kokkos_Error.hpp>
+
+#include <string>
+
+namespace Kokkos {
+namespace Impl {
+
+/* Finalizer of the SplitMix64 generator; bijective on 64-bit words */
+KOKKOS_FORCEINLINE_FUNCTION
+uint64_t view_digest_mix(uint64_t x) {
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+  return x ^ (x >> 31);
+}
+
+/* Position-salted sum of mixed 64-bit words.  The salt makes the digest
+ * sensitive to where a byte sits, not just its value, while the
+ * commutative sum keeps the reduction independent of iteration order
+ * across backends.  Each index digests one 8-byte word; the final
+ * partial word is assembled byte-wise. */
+struct ViewDigestFunctor {
+  typedef uint64_t value_type;
+
+  const unsigned char* m_ptr;
+  uint64_t m_bytes;
+
+  ViewDigestFunctor(const unsigned char* const arg_ptr,
+                    const uint64_t arg_bytes)
+      : m_ptr(arg_ptr), m_bytes(arg_bytes) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const uint64_t i, uint64_t& sum) const {
+    const uint64_t b = i << 3;
+    uint64_t word    = 0;
+    if (b + 8 <= m_bytes) {
+      for (int k = 0; k < 8; ++k)
+        word |= uint64_t(m_ptr[b + k]) << (8 * k);
+    } else {
+      for (uint64_t k = 0; b + k < m_bytes; ++k)
+        word |= uint64_t(m_ptr[b + k]) << (8 * k);
+    }
+    sum += view_digest_mix(word + view_digest_mix(i + 1));
+  }
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  64-bit digest of a contiguous View's memory, computed with a
+ *          parallel reduction on 'exec'.  Equal data yields equal
+ *          digests regardless of backend or concurrency.
+ */
+template <class ExecSpace, class ViewType>
+uint64_t view_digest(const ExecSpace& exec, const ViewType& view) {
+  static_assert(Kokkos::is_execution_space<ExecSpace>::value,
+                "Kokkos::Experimental::view_digest: first argument must be "
+                "an execution space instance");
+  static_assert(Kokkos::Impl::SpaceAccessibility<
+                    ExecSpace, typename ViewType::memory_space>::accessible,
+                "Kokkos::Experimental::view_digest: execution space cannot "
+                "access the view");
+
+  if (!view.span_is_contiguous()) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::view_digest: view must be contiguous");
+  }
+
+  const uint64_t bytes =
+      uint64_t(view.span()) * sizeof(typename ViewType::value_type);
+
+  uint64_t digest = 0;
+  Kokkos::parallel_reduce(
+      "Kokkos::view_digest",
+      Kokkos::RangePolicy<ExecSpace, Kokkos::IndexType<uint64_t>>(
+          exec, 0, (bytes + 7) >> 3),
+      Kokkos::Impl::ViewDigestFunctor(
+          reinterpret_cast<const unsigned char*>(view.data()), bytes),
+      digest);
+  return digest;
+}
+
+/** \brief  64-bit digest of a contiguous View's memory on the View's
+ *          default execution space.
+ */
+template <class ViewType>
+uint64_t view_digest(const ViewType& view) {
+  typedef typename ViewType::execution_space execution_space;
+  return view_digest(execution_space(), view);
+}
+
+/** \brief  deep_copy that digests both sides and throws on mismatch.
+ *
+ *  The source is digested before the copy and the destination after it,
+ *  each on the execution space of its own memory, so corruption on the
+ *  transfer path between them is caught at the transfer that introduced
+ *  it.  Both views must be contiguous with equal spans — the byte-exact
+ *  copy regime where the two digests are comparable.  Costs one extra
+ *  read of each side on top of the copy itself.
+ */
+template <class DstView, class SrcView>
+void checksummed_deep_copy(const DstView& dst, const SrcView& src) {
+  typedef typename DstView::non_const_value_type value_type;
+
+  static_assert(
+      std::is_same<value_type, typename SrcView::non_const_value_type>::value,
+      "Kokkos::Experimental::checksummed_deep_copy: incompatible value "
+      "types");
+  static_assert(std::is_same<typename DstView::value_type, value_type>::value,
+                "Kokkos::Experimental::checksummed_deep_copy: destination "
+                "must be non-const");
+
+  if (!dst.span_is_contiguous() || !src.span_is_contiguous() ||
+      dst.span() != src.span()) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::checksummed_deep_copy: views must be "
+        "contiguous with equal spans");
+  }
+
+  const uint64_t src_digest = view_digest(src);
+
+  Kokkos::deep_copy(dst, src);
+
+  const uint64_t dst_digest = view_digest(dst);
+
+  if (src_digest != dst_digest) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::checksummed_deep_copy: digest mismatch "
+        "copying to \"" +
+        dst.label() + "\" from \"" + src.label() +
+        "\": source " + std::to_string(src_digest) + " destination " +
+        std::to_string(dst_digest));
+  }
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_CHECKSUMDEEPCOPY_HPP
@@ -0,0 +1,258 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_ColorMDRange.hpp
+/// \brief Color-strided multidimensional iteration over dense ranges.
+///
+/// Red-black and multicolor sweeps visit every stride-th cell per
+/// dimension.  Written against a plain MDRangePolicy that is either
+/// one launch per color over the full domain with a parity branch per
+/// cell - wasting half the lanes - or strided accesses with poor
+/// coalescing.  The dispatches here iterate a dense MDRange over the
+/// cells of one color and remap indices in the closure, so consecutive
+/// work items are consecutive color members and the sweep runs at full
+/// occupancy:
+///
+///  - parallel_for_strided: an independent stride and phase per
+///    dimension, covering multicolor orderings (e.g. 2x2x2 colorings
+///    take stride 2 per dimension and the color's phase vector).
+///
+///  - parallel_for_red_black: the classic checkerboard where a cell's
+///    color is the parity of its index sum.  The innermost dimension
+///    is halved and its phase computed from the outer indices, so the
+///    inner traversal stays unit-density; only odd-length innermost
+///    rows pay a boundary guard on their last cell.
+///
+/// Both take the full-domain MDRangePolicy, so existing policy bounds
+/// (and the functor's index signature) carry over unchanged.
+
+#ifndef KOKKOS_COLORMDRANGE_HPP
+#define KOKKOS_COLORMDRANGE_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_Array.hpp>
+#include <Kokkos_Parallel.hpp>
+#include <KokkosExp_MDRangePolicy.hpp>
+#include <impl/Kokkos_Error.hpp>
+
+#include <cstdint>
+#include <string>
+
+namespace Kokkos {
+namespace Impl {
+
+//! Remap dense color-local indices to strided domain indices.
+template <int Rank, class FunctorType>
+struct MDRangeStridedApply {
+  FunctorType m_functor;
+  Kokkos::Array<int64_t, Rank> m_begin;
+  Kokkos::Array<int64_t, Rank> m_stride;
+  Kokkos::Array<int64_t, Rank> m_phase;
+
+  KOKKOS_INLINE_FUNCTION
+  int64_t map(const int d, const int64_t k) const {
+    return m_begin[d] + m_phase[d] + m_stride[d] * k;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t k0, const int64_t k1) const {
+    m_functor(map(0, k0), map(1, k1));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t k0, const int64_t k1,
+                  const int64_t k2) const {
+    m_functor(map(0, k0), map(1, k1), map(2, k2));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t k0, const int64_t k1, const int64_t k2,
+                  const int64_t k3) const {
+    m_functor(map(0, k0), map(1, k1), map(2, k2), map(3, k3));
+  }
+};
+
+/* Checkerboard remap: the innermost dimension is halved and its phase
+ * follows the parity of the outer indices, so each inner row visits
+ * exactly the cells whose index-sum parity matches the color.
+ */
+template <int Rank, class FunctorType>
+struct MDRangeRedBlackApply {
+  FunctorType m_functor;
+  Kokkos::Array<int64_t, Rank> m_begin;
+  int64_t m_inner_end;
+  int m_color;
+
+  KOKKOS_INLINE_FUNCTION
+  static int64_t parity(const int64_t n) { return ((n % 2) + 2) % 2; }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t k0, const int64_t k1) const {
+    const int64_t i0 = m_begin[0] + k0;
+    const int64_t i1 =
+        m_begin[1] + 2 * k1 + parity(m_color + i0 + m_begin[1]);
+    if (i1 < m_inner_end) m_functor(i0, i1);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t k0, const int64_t k1,
+                  const int64_t k2) const {
+    const int64_t i0 = m_begin[0] + k0;
+    const int64_t i1 = m_begin[1] + k1;
+    const int64_t i2 =
+        m_begin[2] + 2 * k2 + parity(m_color + i0 + i1 + m_begin[2]);
+    if (i2 < m_inner_end) m_functor(i0, i1, i2);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t k0, const int64_t k1, const int64_t k2,
+                  const int64_t k3) const {
+    const int64_t i0 = m_begin[0] + k0;
+    const int64_t i1 = m_begin[1] + k1;
+    const int64_t i2 = m_begin[2] + k2;
+    const int64_t i3 =
+        m_begin[3] + 2 * k3 + parity(m_color + i0 + i1 + i2 + m_begin[3]);
+    if (i3 < m_inner_end) m_functor(i0, i1, i2, i3);
+  }
+};
+
+}  // namespace Impl
+
+namespace Experimental {
+
+/** \brief  Iterate the cells of one color of a per-dimension strided
+ *          coloring, densely.
+ *
+ *  Visits index i_d = lower_d + phase_d + stride_d * k_d for every
+ *  in-bounds k_d >= 0; the functor receives domain indices with its
+ *  usual MDRange signature.  For a 2x2 multicolor sweep:
+ *
+ *  \code
+ *    for (int c = 0; c < 4; ++c)
+ *      Kokkos::Experimental::parallel_for_strided(
+ *          "smooth", policy, {2, 2}, {c / 2, c % 2}, smoother);
+ *  \endcode
+ */
+template <class... Properties, class FunctorType>
+void parallel_for_strided(
+    const std::string& label,
+    const Kokkos::MDRangePolicy<Properties...>& policy,
+    const Kokkos::Array<
+        int64_t, static_cast<int>(Kokkos::MDRangePolicy<Properties...>::rank)>&
+        strides,
+    const Kokkos::Array<
+        int64_t, static_cast<int>(Kokkos::MDRangePolicy<Properties...>::rank)>&
+        phases,
+    const FunctorType& functor) {
+  typedef Kokkos::MDRangePolicy<Properties...> policy_type;
+
+  constexpr int rank = static_cast<int>(policy_type::rank);
+  static_assert(rank >= 2 && rank <= 4,
+                "Kokkos::Experimental::parallel_for_strided: only rank-2 to "
+                "rank-4 MDRangePolicy is supported");
+
+  typename policy_type::point_type lower, upper;
+  Kokkos::Array<int64_t, rank> begin;
+  for (int d = 0; d < rank; ++d) {
+    const int64_t stride = strides[d];
+    const int64_t phase  = phases[d];
+    if (stride < 1 || phase < 0 || stride <= phase) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::parallel_for_strided: require "
+          "0 <= phase < stride per dimension");
+    }
+    begin[d] = int64_t(policy.m_lower[d]);
+    const int64_t extent = int64_t(policy.m_upper[d]) - begin[d] - phase;
+    if (extent <= 0) return;
+    lower[d] = 0;
+    upper[d] = (extent + stride - 1) / stride;
+  }
+
+  Kokkos::Impl::MDRangeStridedApply<rank, FunctorType> closure{functor, begin, strides,
+                                                       phases};
+  Kokkos::parallel_for(label, policy_type(lower, upper), closure);
+}
+
+/** \brief  One color of a red-black (checkerboard) sweep: the cells
+ *          where the parity of the index sum equals color, densely.
+ *
+ *  \code
+ *    for (int color = 0; color < 2; ++color)
+ *      Kokkos::Experimental::parallel_for_red_black(
+ *          "gauss_seidel", policy, color, smoother);
+ *  \endcode
+ */
+template <class... Properties, class FunctorType>
+void parallel_for_red_black(
+    const std::string& label,
+    const Kokkos::MDRangePolicy<Properties...>& policy, const int color,
+    const FunctorType& functor) {
+  typedef Kokkos::MDRangePolicy<Properties...> policy_type;
+
+  constexpr int rank = static_cast<int>(policy_type::rank);
+  static_assert(rank >= 2 && rank <= 4,
+                "Kokkos::Experimental::parallel_for_red_black: only rank-2 "
+                "to rank-4 MDRangePolicy is supported");
+
+  typename policy_type::point_type lower, upper;
+  Kokkos::Array<int64_t, rank> begin;
+  for (int d = 0; d < rank; ++d) {
+    begin[d] = int64_t(policy.m_lower[d]);
+    const int64_t extent = int64_t(policy.m_upper[d]) - begin[d];
+    if (extent <= 0) return;
+    lower[d] = 0;
+    // halve the innermost dimension, rounding up: odd-length rows
+    // guard their last cell in the closure
+    upper[d] = d == rank - 1 ? (extent + 1) / 2 : extent;
+  }
+
+  Kokkos::Impl::MDRangeRedBlackApply<rank, FunctorType> closure{
+      functor, begin, int64_t(policy.m_upper[rank - 1]), ((color % 2) + 2) % 2};
+  Kokkos::parallel_for(label, policy_type(lower, upper), closure);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_COLORMDRANGE_HPP */
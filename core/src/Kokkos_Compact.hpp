@@ -0,0 +1,138 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+#ifndef KOKKOS_COMPACT_HPP
+#define KOKKOS_COMPACT_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_Core_fwd.hpp>
+#include <Kokkos_View.hpp>
+#include <Kokkos_Parallel.hpp>
+
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+namespace Impl {
+
+// Scan functor fusing the offset computation with the scatter: the final
+// scan pass writes every accepted element at its exclusive-scan offset and
+// the last iteration records the total count in a device-resident scalar.
+template <class InputViewType, class OutputViewType, class Predicate,
+          class CountViewType>
+struct CompactFunctor {
+  typedef typename InputViewType::size_type size_type;
+  typedef size_type value_type;
+
+  typename InputViewType::const_type input;
+  OutputViewType output;
+  Predicate predicate;
+  CountViewType count;
+  size_type length;
+
+  CompactFunctor(InputViewType const& input_, OutputViewType const& output_,
+                 Predicate const& predicate_, CountViewType const& count_)
+      : input(input_),
+        output(output_),
+        predicate(predicate_),
+        count(count_),
+        length(input_.extent(0)) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_type& i, value_type& update,
+                  const bool& final) const {
+    const bool keep = predicate(input(i));
+    if (final) {
+      if (keep) output(update) = input(i);
+      if (i == length - 1) count() = update + (keep ? 1 : 0);
+    }
+    if (keep) ++update;
+  }
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+namespace Experimental {
+
+/// \brief Copy the elements of \c input satisfying \c predicate into the
+///        front of \c output, preserving order.
+///
+/// Runs as a single parallel_scan dispatch: the scan's final pass scatters
+/// accepted elements at their exclusive-scan offsets, so no separate marker
+/// pass or flag allocation is needed.  The number of accepted elements is
+/// written into the returned rank-0 view in the output's memory space; the
+/// call does not fence, so the count can feed a later device-side consumer
+/// without a device-host sync.  \c output must be at least as long as
+/// \c input (or as the expected count).
+template <class InputViewType, class OutputViewType, class Predicate>
+Kokkos::View<typename InputViewType::size_type,
+             typename OutputViewType::device_type>
+compact(InputViewType const& input, Predicate const& predicate,
+        OutputViewType const& output) {
+  typedef typename InputViewType::execution_space execution_space;
+  typedef typename InputViewType::size_type size_type;
+  typedef Kokkos::View<size_type, typename OutputViewType::device_type>
+      count_view_type;
+
+  count_view_type count("Kokkos::CompactImpl::count");
+  if (input.extent(0) == 0) return count;
+
+  Kokkos::parallel_scan(
+      "Kokkos::compact",
+      Kokkos::RangePolicy<execution_space>(0, input.extent(0)),
+      Kokkos::Impl::CompactFunctor<InputViewType, OutputViewType, Predicate,
+                                   count_view_type>(input, output, predicate,
+                                                    count));
+
+  return count;
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_COMPACT_HPP */
@@ -58,12 +58,18 @@ namespace Kokkos {
 // Schedules for Execution Policies
 struct Static {};
 struct Dynamic {};
+// Dynamic scheduling that refills each thread's work in multi-chunk blocks
+// from its own partition and steals in single-chunk units, reducing atomic
+// traffic on the work counters for very large irregular ranges.  Backends
+// without a dedicated implementation treat it as Dynamic or Static.
+struct DynamicChunked {};
 
 // Schedule Wrapper Type
 template <class T>
 struct Schedule {
   static_assert(std::is_same<T, Static>::value ||
-                    std::is_same<T, Dynamic>::value,
+                    std::is_same<T, Dynamic>::value ||
+                    std::is_same<T, DynamicChunked>::value,
                 "Kokkos: Invalid Schedule<> type.");
   using schedule_type = Schedule;
   using type          = T;
@@ -95,11 +101,17 @@ struct WorkItemProperty {
       ImplWorkItemProperty<4>();
   constexpr static const ImplWorkItemProperty<8> HintIrregular =
       ImplWorkItemProperty<8>();
+  constexpr static const ImplWorkItemProperty<16> HintWideVector =
+      ImplWorkItemProperty<16>();
+  constexpr static const ImplWorkItemProperty<32> HintThrottleAware =
+      ImplWorkItemProperty<32>();
   typedef ImplWorkItemProperty<0> None_t;
   typedef ImplWorkItemProperty<1> HintLightWeight_t;
   typedef ImplWorkItemProperty<2> HintHeavyWeight_t;
   typedef ImplWorkItemProperty<4> HintRegular_t;
   typedef ImplWorkItemProperty<8> HintIrregular_t;
+  typedef ImplWorkItemProperty<16> HintWideVector_t;
+  typedef ImplWorkItemProperty<32> HintThrottleAware_t;
 };
 
 template <unsigned long pv1, unsigned long pv2>
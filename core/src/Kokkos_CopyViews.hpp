@@ -767,6 +767,428 @@ struct ViewCopy<ViewTypeA, ViewTypeB, Layout, ExecSpace, 8, iType,
 namespace Kokkos {
 namespace Impl {
 
+//----------------------------------------------------------------------------
+// Attempt to express a view as rows of contiguous elements separated by a
+// single constant pitch: shape[0] = elements per row, shape[1] = number of
+// rows, shape[2] = pitch in elements.  This is the pattern a bulk 2D copy
+// engine can consume: face slabs of 3D views, LayoutLeft/LayoutRight
+// subviews with one stride jump, and fully contiguous views.
+
+template <class ViewType>
+inline bool view_copy_pitched_shape(const ViewType& v, ptrdiff_t shape[3],
+                                    int order[8], int& n_order) {
+  enum : int { rank = ViewType::Rank };
+  int64_t strides[rank + 1];
+  v.stride(strides);
+
+  ptrdiff_t stride[rank ? rank : 1];
+  ptrdiff_t extent[rank ? rank : 1];
+  int n = 0;
+  for (int r = 0; r < int(rank); ++r) {
+    if (v.extent(r) == size_t(1)) continue;
+    stride[n] = strides[r];
+    extent[n] = v.extent(r);
+    order[n]  = r;
+    ++n;
+  }
+  n_order = n;
+
+  // Sort by stride; there are at most eight dimensions
+  for (int i = 1; i < n; ++i)
+    for (int j = i; j > 0 && stride[j] < stride[j - 1]; --j) {
+      ptrdiff_t tmp = stride[j];
+      stride[j]     = stride[j - 1];
+      stride[j - 1] = tmp;
+      tmp           = extent[j];
+      extent[j]     = extent[j - 1];
+      extent[j - 1] = tmp;
+      int const to  = order[j];
+      order[j]      = order[j - 1];
+      order[j - 1]  = to;
+    }
+
+  if ((0 < n) && (stride[0] != 1)) return false;
+
+  // Merge the unit-stride run of dimensions into one contiguous row
+  ptrdiff_t row = 1;
+  int i         = 0;
+  while (i < n && stride[i] == row) {
+    row *= extent[i];
+    ++i;
+  }
+
+  if (i == n) {  // fully contiguous
+    shape[0] = row;
+    shape[1] = 1;
+    shape[2] = row;
+    return true;
+  }
+
+  // The remaining dimensions must collapse into one pitched dimension
+  const ptrdiff_t pitch = stride[i];
+  ptrdiff_t rows        = 1;
+  while (i < n && stride[i] == pitch * rows) {
+    rows *= extent[i];
+    ++i;
+  }
+  if (i != n || pitch < row) return false;
+
+  shape[0] = row;
+  shape[1] = rows;
+  shape[2] = pitch;
+  return true;
+}
+
+template <class DstType, class SrcType>
+inline bool view_copy_pitched(const DstType& dst, const SrcType& src,
+                              std::true_type) {
+  if (dst.size() == 0) return true;
+
+  ptrdiff_t d[3];
+  ptrdiff_t s[3];
+  int d_order[8];
+  int s_order[8];
+  int d_n;
+  int s_n;
+  if (!view_copy_pitched_shape(dst, d, d_order, d_n) ||
+      !view_copy_pitched_shape(src, s, s_order, s_n))
+    return false;
+
+  // Both sides must traverse the logical dimensions in the same
+  // stride order, otherwise identical byte patterns would still be a
+  // layout remap (LayoutLeft to LayoutRight), not a copy
+  if (d_n != s_n) return false;
+  for (int k = 0; k < d_n; ++k)
+    if (d_order[k] != s_order[k]) return false;
+
+  // When one side's rows are longer, that side must be one contiguous
+  // run so that it can be re-split at the other side's row boundary
+  const ptrdiff_t row = d[0] < s[0] ? d[0] : s[0];
+  ptrdiff_t* shapes[2] = {d, s};
+  for (int i = 0; i < 2; ++i) {
+    ptrdiff_t* sh = shapes[i];
+    if (sh[0] == row) continue;
+    if (sh[1] != 1 || sh[0] % row != 0) return false;
+    sh[1] = sh[0] / row;
+    sh[0] = row;
+    sh[2] = row;
+  }
+  if (d[1] != s[1]) return false;
+
+  enum : size_t { value_size = sizeof(typename DstType::value_type) };
+  DeepCopy2D<typename DstType::memory_space, typename SrcType::memory_space>(
+      dst.data(), d[2] * value_size, src.data(), s[2] * value_size,
+      row * value_size, d[1]);
+  return true;
+}
+
+template <class DstType, class SrcType>
+inline bool view_copy_pitched(const DstType&, const SrcType&,
+                              std::false_type) {
+  return false;
+}
+
+//----------------------------------------------------------------------------
+// Copies between Views whose extents past the leading dimension are all
+// compile-time constants (e.g. double*[3][3]) iterate the leading
+// dimension with a RangePolicy and run the inner dimensions as loops
+// with constant bounds, which the compiler fully unrolls and
+// vectorizes.  The generic rank-N MDRange engine cannot do that because
+// its tile extents are runtime values.
+
+template <class DstType, class SrcType>
+struct view_copy_static_inner_available {
+ private:
+  typedef typename DstType::traits::dimension dst_dim;
+  typedef typename SrcType::traits::dimension src_dim;
+
+  template <class Layout>
+  struct regular_layout {
+    enum {
+      value = std::is_same<Layout, Kokkos::LayoutLeft>::value ||
+              std::is_same<Layout, Kokkos::LayoutRight>::value
+    };
+  };
+
+ public:
+  enum {
+    value = (unsigned(DstType::Rank) >= 2) &&
+            (unsigned(dst_dim::rank_dynamic) <= 1) &&
+            (unsigned(src_dim::rank_dynamic) <= 1) &&
+            regular_layout<typename DstType::array_layout>::value &&
+            regular_layout<typename SrcType::array_layout>::value &&
+            (size_t(dst_dim::ArgN1) == size_t(src_dim::ArgN1)) &&
+            (size_t(dst_dim::ArgN2) == size_t(src_dim::ArgN2)) &&
+            (size_t(dst_dim::ArgN3) == size_t(src_dim::ArgN3)) &&
+            (size_t(dst_dim::ArgN4) == size_t(src_dim::ArgN4)) &&
+            (size_t(dst_dim::ArgN5) == size_t(src_dim::ArgN5)) &&
+            (size_t(dst_dim::ArgN6) == size_t(src_dim::ArgN6)) &&
+            (size_t(dst_dim::ArgN7) == size_t(src_dim::ArgN7))
+  };
+};
+
+template <class DstType, class SrcType, class ExecSpace, typename iType>
+struct ViewCopyStaticInner {
+  DstType a;
+  SrcType b;
+
+  typedef typename DstType::traits::dimension dim;
+  enum {
+    N1 = dim::ArgN1,
+    N2 = dim::ArgN2,
+    N3 = dim::ArgN3,
+    N4 = dim::ArgN4,
+    N5 = dim::ArgN5,
+    N6 = dim::ArgN6,
+    N7 = dim::ArgN7
+  };
+
+  typedef Kokkos::RangePolicy<ExecSpace, Kokkos::IndexType<iType>> policy_type;
+
+  ViewCopyStaticInner(const DstType& a_, const SrcType& b_) : a(a_), b(b_) {
+    ExecSpace().fence();
+    Kokkos::parallel_for("Kokkos::ViewCopyStaticInner",
+                         policy_type(0, a.extent(0)), *this);
+    ExecSpace().fence();
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const iType& i0) const {
+    for (iType i1 = 0; i1 < iType(N1); ++i1)
+      for (iType i2 = 0; i2 < iType(N2); ++i2)
+        for (iType i3 = 0; i3 < iType(N3); ++i3)
+          for (iType i4 = 0; i4 < iType(N4); ++i4)
+            for (iType i5 = 0; i5 < iType(N5); ++i5)
+              for (iType i6 = 0; i6 < iType(N6); ++i6)
+                for (iType i7 = 0; i7 < iType(N7); ++i7)
+                  a.access(i0, i1, i2, i3, i4, i5, i6, i7) =
+                      b.access(i0, i1, i2, i3, i4, i5, i6, i7);
+  }
+};
+
+template <class ExecSpace, class DstType, class SrcType>
+inline void view_copy_static_inner(const DstType& dst, const SrcType& src,
+                                   std::true_type) {
+  if ((dst.span() >= size_t(std::numeric_limits<int>::max())) ||
+      (src.span() >= size_t(std::numeric_limits<int>::max())))
+    ViewCopyStaticInner<DstType, SrcType, ExecSpace, int64_t>(dst, src);
+  else
+    ViewCopyStaticInner<DstType, SrcType, ExecSpace, int>(dst, src);
+}
+
+template <class ExecSpace, class DstType, class SrcType>
+inline void view_copy_static_inner(const DstType&, const SrcType&,
+                                   std::false_type) {}
+
+template <class ViewType, class ExecSpace, typename iType>
+struct ViewFillStaticInner {
+  ViewType a;
+  typename ViewType::const_value_type val;
+
+  typedef typename ViewType::traits::dimension dim;
+  enum {
+    N1 = dim::ArgN1,
+    N2 = dim::ArgN2,
+    N3 = dim::ArgN3,
+    N4 = dim::ArgN4,
+    N5 = dim::ArgN5,
+    N6 = dim::ArgN6,
+    N7 = dim::ArgN7
+  };
+
+  typedef Kokkos::RangePolicy<ExecSpace, Kokkos::IndexType<iType>> policy_type;
+
+  ViewFillStaticInner(const ViewType& a_,
+                      typename ViewType::const_value_type& val_)
+      : a(a_), val(val_) {
+    Kokkos::parallel_for("Kokkos::ViewFillStaticInner",
+                         policy_type(0, a.extent(0)), *this);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const iType& i0) const {
+    for (iType i1 = 0; i1 < iType(N1); ++i1)
+      for (iType i2 = 0; i2 < iType(N2); ++i2)
+        for (iType i3 = 0; i3 < iType(N3); ++i3)
+          for (iType i4 = 0; i4 < iType(N4); ++i4)
+            for (iType i5 = 0; i5 < iType(N5); ++i5)
+              for (iType i6 = 0; i6 < iType(N6); ++i6)
+                for (iType i7 = 0; i7 < iType(N7); ++i7)
+                  a.access(i0, i1, i2, i3, i4, i5, i6, i7) = val;
+  }
+};
+
+template <class ViewType>
+inline void view_fill_static_inner(
+    const ViewType& dst, typename ViewType::const_value_type& value,
+    std::true_type) {
+  typedef typename ViewType::execution_space exec_space;
+  if (dst.span() >= size_t(std::numeric_limits<int>::max()))
+    ViewFillStaticInner<ViewType, exec_space, int64_t>(dst, value);
+  else
+    ViewFillStaticInner<ViewType, exec_space, int>(dst, value);
+}
+
+template <class ViewType>
+inline void view_fill_static_inner(const ViewType&,
+                                   typename ViewType::const_value_type&,
+                                   std::false_type) {}
+
+//----------------------------------------------------------------------------
+// A copy between conflicting regular layouts (LayoutLeft destination,
+// LayoutRight source or vice versa) strides through one side's memory
+// in every possible single iteration order, consuming one element per
+// cache line brought in.  Processing the plane spanned by the two
+// conflicting dimensions in square tiles sized against the per-core L2
+// touches every cache line of both sides only once.
+
+// Largest power-of-two tile dimension such that a source tile plus a
+// destination tile occupy at most half of a typical 1MB per-core L2
+constexpr ptrdiff_t view_copy_blocked_tile_dim(const size_t value_size,
+                                               const ptrdiff_t dim = 256) {
+  return (dim <= 8 ||
+          2 * dim * dim * ptrdiff_t(value_size) <= (ptrdiff_t(1) << 19))
+             ? dim
+             : view_copy_blocked_tile_dim(value_size, dim / 2);
+}
+
+template <class DstType, class SrcType>
+struct view_copy_blocked_available {
+ private:
+  template <class LayoutA, class LayoutB>
+  struct layout_conflict {
+    enum {
+      value = (std::is_same<LayoutA, Kokkos::LayoutLeft>::value &&
+               std::is_same<LayoutB, Kokkos::LayoutRight>::value) ||
+              (std::is_same<LayoutA, Kokkos::LayoutRight>::value &&
+               std::is_same<LayoutB, Kokkos::LayoutLeft>::value)
+    };
+  };
+
+ public:
+  enum {
+    value = ((unsigned(DstType::Rank) == 2) ||
+             (unsigned(DstType::Rank) == 3)) &&
+            layout_conflict<typename DstType::array_layout,
+                            typename SrcType::array_layout>::value &&
+            std::is_same<typename DstType::memory_space,
+                         Kokkos::HostSpace>::value &&
+            std::is_same<typename SrcType::memory_space,
+                         Kokkos::HostSpace>::value
+  };
+};
+
+template <class DstType, class SrcType, class ExecSpace, unsigned Rank,
+          typename iType>
+struct ViewCopyBlocked;
+
+template <class DstType, class SrcType, class ExecSpace, typename iType>
+struct ViewCopyBlocked<DstType, SrcType, ExecSpace, 2, iType> {
+  DstType a;
+  SrcType b;
+  iType m_tiles0;
+
+  enum : iType {
+    tile =
+        iType(view_copy_blocked_tile_dim(sizeof(typename DstType::value_type)))
+  };
+  enum {
+    dst_stride_one_first =
+        std::is_same<typename DstType::array_layout, Kokkos::LayoutLeft>::value
+  };
+
+  typedef Kokkos::RangePolicy<ExecSpace, Kokkos::IndexType<iType>> policy_type;
+
+  ViewCopyBlocked(const DstType& a_, const SrcType& b_)
+      : a(a_), b(b_), m_tiles0((iType(a_.extent(0)) + tile - 1) / tile) {
+    const iType tiles1 = (iType(a.extent(1)) + tile - 1) / tile;
+    ExecSpace().fence();
+    Kokkos::parallel_for("Kokkos::ViewCopyBlocked-2D",
+                         policy_type(0, m_tiles0 * tiles1), *this);
+    ExecSpace().fence();
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const iType& t) const {
+    const iType b0 = (t % m_tiles0) * tile;
+    const iType b1 = (t / m_tiles0) * tile;
+    const iType e0 =
+        b0 + tile < iType(a.extent(0)) ? b0 + tile : iType(a.extent(0));
+    const iType e1 =
+        b1 + tile < iType(a.extent(1)) ? b1 + tile : iType(a.extent(1));
+    // Within the tile both orders hit cache; stream the stores
+    if (dst_stride_one_first)
+      for (iType i1 = b1; i1 < e1; ++i1)
+        for (iType i0 = b0; i0 < e0; ++i0) a(i0, i1) = b(i0, i1);
+    else
+      for (iType i0 = b0; i0 < e0; ++i0)
+        for (iType i1 = b1; i1 < e1; ++i1) a(i0, i1) = b(i0, i1);
+  }
+};
+
+template <class DstType, class SrcType, class ExecSpace, typename iType>
+struct ViewCopyBlocked<DstType, SrcType, ExecSpace, 3, iType> {
+  DstType a;
+  SrcType b;
+  iType m_tiles0;
+
+  enum : iType {
+    tile =
+        iType(view_copy_blocked_tile_dim(sizeof(typename DstType::value_type)))
+  };
+  enum {
+    dst_stride_one_first =
+        std::is_same<typename DstType::array_layout, Kokkos::LayoutLeft>::value
+  };
+
+  typedef Kokkos::RangePolicy<ExecSpace, Kokkos::IndexType<iType>> policy_type;
+
+  ViewCopyBlocked(const DstType& a_, const SrcType& b_)
+      : a(a_), b(b_), m_tiles0((iType(a_.extent(0)) + tile - 1) / tile) {
+    const iType tiles2 = (iType(a.extent(2)) + tile - 1) / tile;
+    ExecSpace().fence();
+    Kokkos::parallel_for("Kokkos::ViewCopyBlocked-3D",
+                         policy_type(0, m_tiles0 * tiles2), *this);
+    ExecSpace().fence();
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const iType& t) const {
+    // Dimensions 0 and 2 trade stride roles between LayoutLeft and
+    // LayoutRight; the middle dimension strides identically on both
+    // sides and runs outside the tile
+    const iType b0 = (t % m_tiles0) * tile;
+    const iType b2 = (t / m_tiles0) * tile;
+    const iType e0 =
+        b0 + tile < iType(a.extent(0)) ? b0 + tile : iType(a.extent(0));
+    const iType e2 =
+        b2 + tile < iType(a.extent(2)) ? b2 + tile : iType(a.extent(2));
+    if (dst_stride_one_first)
+      for (iType i1 = 0; i1 < iType(a.extent(1)); ++i1)
+        for (iType i2 = b2; i2 < e2; ++i2)
+          for (iType i0 = b0; i0 < e0; ++i0) a(i0, i1, i2) = b(i0, i1, i2);
+    else
+      for (iType i1 = 0; i1 < iType(a.extent(1)); ++i1)
+        for (iType i0 = b0; i0 < e0; ++i0)
+          for (iType i2 = b2; i2 < e2; ++i2) a(i0, i1, i2) = b(i0, i1, i2);
+  }
+};
+
+template <class ExecSpace, class DstType, class SrcType>
+inline void view_copy_blocked(const DstType& dst, const SrcType& src,
+                              std::true_type) {
+  if ((dst.span() >= size_t(std::numeric_limits<int>::max())) ||
+      (src.span() >= size_t(std::numeric_limits<int>::max())))
+    ViewCopyBlocked<DstType, SrcType, ExecSpace, DstType::Rank, int64_t>(dst,
+                                                                         src);
+  else
+    ViewCopyBlocked<DstType, SrcType, ExecSpace, DstType::Rank, int>(dst, src);
+}
+
+template <class ExecSpace, class DstType, class SrcType>
+inline void view_copy_blocked(const DstType&, const SrcType&,
+                              std::false_type) {}
+
 template <class DstType, class SrcType>
 void view_copy(const DstType& dst, const SrcType& src) {
   typedef typename DstType::execution_space dst_execution_space;
@@ -795,6 +1217,43 @@ void view_copy(const DstType& dst, const SrcType& src) {
     Kokkos::Impl::throw_runtime_exception(message);
   }
 
+  // Strided copies that reduce to a single pitched pattern on both sides
+  // go to the bulk 2D copy engine instead of an element-wise kernel
+  typedef std::integral_constant<
+      bool,
+      deep_copy_2d_available<dst_memory_space, src_memory_space>::value &&
+          std::is_same<typename DstType::value_type,
+                       typename SrcType::non_const_value_type>::value>
+      use_pitched_copy;
+  if (view_copy_pitched(dst, src, use_pitched_copy())) return;
+
+  // Views with all-static inner extents get constant inner loop bounds
+  typedef std::integral_constant<
+      bool, view_copy_static_inner_available<DstType, SrcType>::value>
+      use_static_inner;
+  if (use_static_inner::value) {
+    if (DstExecCanAccessSrc)
+      view_copy_static_inner<dst_execution_space>(dst, src,
+                                                  use_static_inner());
+    else
+      view_copy_static_inner<src_execution_space>(dst, src,
+                                                  use_static_inner());
+    return;
+  }
+
+  // Host-side layout remaps (LayoutLeft/LayoutRight conflict) go to the
+  // cache-blocked engine so both footprints stay resident per tile
+  typedef std::integral_constant<
+      bool, view_copy_blocked_available<DstType, SrcType>::value>
+      use_blocked;
+  if (use_blocked::value) {
+    if (DstExecCanAccessSrc)
+      view_copy_blocked<dst_execution_space>(dst, src, use_blocked());
+    else
+      view_copy_blocked<src_execution_space>(dst, src, use_blocked());
+    return;
+  }
+
   // Figure out iteration order in case we need it
   int64_t strides[DstType::Rank + 1];
   dst.stride(strides);
@@ -1479,6 +1938,22 @@ inline void deep_copy(
     return;
   }
 
+  // Views with all-static inner extents get constant inner loop bounds
+  typedef std::integral_constant<
+      bool, Kokkos::Impl::view_copy_static_inner_available<ViewType,
+                                                           ViewType>::value>
+      use_static_inner_fill;
+  if (use_static_inner_fill::value) {
+    Kokkos::Impl::view_fill_static_inner(dst, value, use_static_inner_fill());
+    Kokkos::fence();
+#if defined(KOKKOS_ENABLE_PROFILING)
+    if (Kokkos::Profiling::profileLibraryLoaded()) {
+      Kokkos::Profiling::endDeepCopy();
+    }
+#endif
+    return;
+  }
+
   // Figure out iteration order to do the ViewFill
   int64_t strides[ViewType::Rank + 1];
   dst.stride(strides);
@@ -2737,13 +3212,13 @@ inline void deep_copy(
     return;
   }
 
-  exec_space.fence();
+  // The copy is enqueued on exec_space and is ordered only with respect to
+  // work already submitted to that instance; no host-side fence is issued.
   if (dst.data() != src.data()) {
     Kokkos::Impl::DeepCopy<dst_memory_space, src_memory_space, ExecSpace>(
         exec_space, dst.data(), src.data(),
         sizeof(typename dst_traits::value_type));
   }
-  exec_space.fence();
 #if defined(KOKKOS_ENABLE_PROFILING)
   if (Kokkos::Profiling::profileLibraryLoaded()) {
     Kokkos::Profiling::endDeepCopy();
@@ -2946,16 +3421,18 @@ inline void deep_copy(
       ((dst_type::rank < 7) || (dst.stride_6() == src.stride_6())) &&
       ((dst_type::rank < 8) || (dst.stride_7() == src.stride_7()))) {
     const size_t nbytes = sizeof(typename dst_type::value_type) * dst.span();
-    exec_space.fence();
+    // Stream-ordered: the byte-wise copy is enqueued on exec_space and is
+    // ordered only against work previously submitted to that instance.  The
+    // caller synchronizes with exec_space.fence() when the data is needed.
     if ((void*)dst.data() != (void*)src.data()) {
       Kokkos::Impl::DeepCopy<dst_memory_space, src_memory_space, ExecSpace>(
           exec_space, dst.data(), src.data(), nbytes);
     }
-    exec_space.fence();
   } else {
+    // The element-wise remap launches on the views' own execution space, so
+    // order it against outstanding work on the given instance first.
     exec_space.fence();
     Impl::view_copy(dst, src);
-    exec_space.fence();
   }
 #if defined(KOKKOS_ENABLE_PROFILING)
   if (Kokkos::Profiling::profileLibraryLoaded()) {
@@ -2966,6 +3443,426 @@ inline void deep_copy(
 
 } /* namespace Kokkos */
 
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+// Fused copy-transform: the ViewCopy kernels above with a unary
+// operation applied on the way through, so dst = op(src) costs one
+// bandwidth pass instead of a deep_copy followed by a transform kernel.
+// The operation type is user-provided, so unlike ViewCopy these cannot
+// be ETI'd and are always compiled inline.
+
+namespace Kokkos {
+namespace Impl {
+
+template <class ViewTypeA, class ViewTypeB, class UnaryOp, class Layout,
+          class ExecSpace, int Rank, typename iType>
+struct ViewCopyTransform;
+
+template <class ViewTypeA, class ViewTypeB, class UnaryOp, class Layout,
+          class ExecSpace, typename iType>
+struct ViewCopyTransform<ViewTypeA, ViewTypeB, UnaryOp, Layout, ExecSpace, 0,
+                         iType> {
+  ViewTypeA a;
+  ViewTypeB b;
+  UnaryOp op;
+
+  typedef Kokkos::RangePolicy<ExecSpace, Kokkos::IndexType<iType>> policy_type;
+
+  ViewCopyTransform(const ViewTypeA& a_, const ViewTypeB& b_,
+                    const UnaryOp& op_)
+      : a(a_), b(b_), op(op_) {
+    ExecSpace().fence();
+    Kokkos::parallel_for("Kokkos::ViewCopyTransform-0D", policy_type(0, 1),
+                         *this);
+    ExecSpace().fence();
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const iType&) const { a() = op(b()); };
+};
+
+template <class ViewTypeA, class ViewTypeB, class UnaryOp, class Layout,
+          class ExecSpace, typename iType>
+struct ViewCopyTransform<ViewTypeA, ViewTypeB, UnaryOp, Layout, ExecSpace, 1,
+                         iType> {
+  ViewTypeA a;
+  ViewTypeB b;
+  UnaryOp op;
+
+  typedef Kokkos::RangePolicy<ExecSpace, Kokkos::IndexType<iType>> policy_type;
+
+  ViewCopyTransform(const ViewTypeA& a_, const ViewTypeB& b_,
+                    const UnaryOp& op_)
+      : a(a_), b(b_), op(op_) {
+    ExecSpace().fence();
+    Kokkos::parallel_for("Kokkos::ViewCopyTransform-1D",
+                         policy_type(0, a.extent(0)), *this);
+    ExecSpace().fence();
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const iType& i0) const { a(i0) = op(b(i0)); };
+};
+
+template <class ViewTypeA, class ViewTypeB, class UnaryOp, class Layout,
+          class ExecSpace, typename iType>
+struct ViewCopyTransform<ViewTypeA, ViewTypeB, UnaryOp, Layout, ExecSpace, 2,
+                         iType> {
+  ViewTypeA a;
+  ViewTypeB b;
+  UnaryOp op;
+
+  static const Kokkos::Iterate outer_iteration_pattern =
+      Kokkos::layout_iterate_type_selector<Layout>::outer_iteration_pattern;
+  static const Kokkos::Iterate inner_iteration_pattern =
+      Kokkos::layout_iterate_type_selector<Layout>::inner_iteration_pattern;
+  typedef Kokkos::Rank<2, outer_iteration_pattern, inner_iteration_pattern>
+      iterate_type;
+  typedef Kokkos::MDRangePolicy<ExecSpace, iterate_type,
+                                Kokkos::IndexType<iType>>
+      policy_type;
+
+  ViewCopyTransform(const ViewTypeA& a_, const ViewTypeB& b_,
+                    const UnaryOp& op_)
+      : a(a_), b(b_), op(op_) {
+    ExecSpace().fence();
+    Kokkos::parallel_for("Kokkos::ViewCopyTransform-2D",
+                         policy_type({0, 0}, {a.extent(0), a.extent(1)}),
+                         *this);
+    ExecSpace().fence();
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const iType& i0, const iType& i1) const {
+    a(i0, i1) = op(b(i0, i1));
+  };
+};
+
+template <class ViewTypeA, class ViewTypeB, class UnaryOp, class Layout,
+          class ExecSpace, typename iType>
+struct ViewCopyTransform<ViewTypeA, ViewTypeB, UnaryOp, Layout, ExecSpace, 3,
+                         iType> {
+  ViewTypeA a;
+  ViewTypeB b;
+  UnaryOp op;
+
+  static const Kokkos::Iterate outer_iteration_pattern =
+      Kokkos::layout_iterate_type_selector<Layout>::outer_iteration_pattern;
+  static const Kokkos::Iterate inner_iteration_pattern =
+      Kokkos::layout_iterate_type_selector<Layout>::inner_iteration_pattern;
+  typedef Kokkos::Rank<3, outer_iteration_pattern, inner_iteration_pattern>
+      iterate_type;
+  typedef Kokkos::MDRangePolicy<ExecSpace, iterate_type,
+                                Kokkos::IndexType<iType>>
+      policy_type;
+
+  ViewCopyTransform(const ViewTypeA& a_, const ViewTypeB& b_,
+                    const UnaryOp& op_)
+      : a(a_), b(b_), op(op_) {
+    ExecSpace().fence();
+    Kokkos::parallel_for(
+        "Kokkos::ViewCopyTransform-3D",
+        policy_type({0, 0, 0}, {a.extent(0), a.extent(1), a.extent(2)}), *this);
+    ExecSpace().fence();
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const iType& i0, const iType& i1, const iType& i2) const {
+    a(i0, i1, i2) = op(b(i0, i1, i2));
+  };
+};
+
+template <class ViewTypeA, class ViewTypeB, class UnaryOp, class Layout,
+          class ExecSpace, typename iType>
+struct ViewCopyTransform<ViewTypeA, ViewTypeB, UnaryOp, Layout, ExecSpace, 4,
+                         iType> {
+  ViewTypeA a;
+  ViewTypeB b;
+  UnaryOp op;
+
+  static const Kokkos::Iterate outer_iteration_pattern =
+      Kokkos::layout_iterate_type_selector<Layout>::outer_iteration_pattern;
+  static const Kokkos::Iterate inner_iteration_pattern =
+      Kokkos::layout_iterate_type_selector<Layout>::inner_iteration_pattern;
+  typedef Kokkos::Rank<4, outer_iteration_pattern, inner_iteration_pattern>
+      iterate_type;
+  typedef Kokkos::MDRangePolicy<ExecSpace, iterate_type,
+                                Kokkos::IndexType<iType>>
+      policy_type;
+
+  ViewCopyTransform(const ViewTypeA& a_, const ViewTypeB& b_,
+                    const UnaryOp& op_)
+      : a(a_), b(b_), op(op_) {
+    ExecSpace().fence();
+    Kokkos::parallel_for(
+        "Kokkos::ViewCopyTransform-4D",
+        policy_type({0, 0, 0, 0},
+                    {a.extent(0), a.extent(1), a.extent(2), a.extent(3)}),
+        *this);
+    ExecSpace().fence();
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const iType& i0, const iType& i1, const iType& i2,
+                  const iType& i3) const {
+    a(i0, i1, i2, i3) = op(b(i0, i1, i2, i3));
+  };
+};
+
+template <class ViewTypeA, class ViewTypeB, class UnaryOp, class Layout,
+          class ExecSpace, typename iType>
+struct ViewCopyTransform<ViewTypeA, ViewTypeB, UnaryOp, Layout, ExecSpace, 5,
+                         iType> {
+  ViewTypeA a;
+  ViewTypeB b;
+  UnaryOp op;
+
+  static const Kokkos::Iterate outer_iteration_pattern =
+      Kokkos::layout_iterate_type_selector<Layout>::outer_iteration_pattern;
+  static const Kokkos::Iterate inner_iteration_pattern =
+      Kokkos::layout_iterate_type_selector<Layout>::inner_iteration_pattern;
+  typedef Kokkos::Rank<5, outer_iteration_pattern, inner_iteration_pattern>
+      iterate_type;
+  typedef Kokkos::MDRangePolicy<ExecSpace, iterate_type,
+                                Kokkos::IndexType<iType>>
+      policy_type;
+
+  ViewCopyTransform(const ViewTypeA& a_, const ViewTypeB& b_,
+                    const UnaryOp& op_)
+      : a(a_), b(b_), op(op_) {
+    ExecSpace().fence();
+    Kokkos::parallel_for(
+        "Kokkos::ViewCopyTransform-5D",
+        policy_type({0, 0, 0, 0, 0}, {a.extent(0), a.extent(1), a.extent(2),
+                                      a.extent(3), a.extent(4)}),
+        *this);
+    ExecSpace().fence();
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const iType& i0, const iType& i1, const iType& i2,
+                  const iType& i3, const iType& i4) const {
+    a(i0, i1, i2, i3, i4) = op(b(i0, i1, i2, i3, i4));
+  };
+};
+
+template <class ViewTypeA, class ViewTypeB, class UnaryOp, class Layout,
+          class ExecSpace, typename iType>
+struct ViewCopyTransform<ViewTypeA, ViewTypeB, UnaryOp, Layout, ExecSpace, 6,
+                         iType> {
+  ViewTypeA a;
+  ViewTypeB b;
+  UnaryOp op;
+
+  static const Kokkos::Iterate outer_iteration_pattern =
+      Kokkos::layout_iterate_type_selector<Layout>::outer_iteration_pattern;
+  static const Kokkos::Iterate inner_iteration_pattern =
+      Kokkos::layout_iterate_type_selector<Layout>::inner_iteration_pattern;
+  typedef Kokkos::Rank<6, outer_iteration_pattern, inner_iteration_pattern>
+      iterate_type;
+  typedef Kokkos::MDRangePolicy<ExecSpace, iterate_type,
+                                Kokkos::IndexType<iType>>
+      policy_type;
+
+  ViewCopyTransform(const ViewTypeA& a_, const ViewTypeB& b_,
+                    const UnaryOp& op_)
+      : a(a_), b(b_), op(op_) {
+    ExecSpace().fence();
+    Kokkos::parallel_for("Kokkos::ViewCopyTransform-6D",
+                         policy_type({0, 0, 0, 0, 0, 0},
+                                     {a.extent(0), a.extent(1), a.extent(2),
+                                      a.extent(3), a.extent(4), a.extent(5)}),
+                         *this);
+    ExecSpace().fence();
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const iType& i0, const iType& i1, const iType& i2,
+                  const iType& i3, const iType& i4, const iType& i5) const {
+    a(i0, i1, i2, i3, i4, i5) = op(b(i0, i1, i2, i3, i4, i5));
+  };
+};
+
+template <class ViewTypeA, class ViewTypeB, class UnaryOp, class Layout,
+          class ExecSpace, typename iType>
+struct ViewCopyTransform<ViewTypeA, ViewTypeB, UnaryOp, Layout, ExecSpace, 7,
+                         iType> {
+  ViewTypeA a;
+  ViewTypeB b;
+  UnaryOp op;
+
+  static const Kokkos::Iterate outer_iteration_pattern =
+      Kokkos::layout_iterate_type_selector<Layout>::outer_iteration_pattern;
+  static const Kokkos::Iterate inner_iteration_pattern =
+      Kokkos::layout_iterate_type_selector<Layout>::inner_iteration_pattern;
+  typedef Kokkos::Rank<6, outer_iteration_pattern, inner_iteration_pattern>
+      iterate_type;
+  typedef Kokkos::MDRangePolicy<ExecSpace, iterate_type,
+                                Kokkos::IndexType<iType>>
+      policy_type;
+
+  ViewCopyTransform(const ViewTypeA& a_, const ViewTypeB& b_,
+                    const UnaryOp& op_)
+      : a(a_), b(b_), op(op_) {
+    ExecSpace().fence();
+    Kokkos::parallel_for("Kokkos::ViewCopyTransform-7D",
+                         policy_type({0, 0, 0, 0, 0, 0},
+                                     {a.extent(0), a.extent(1), a.extent(3),
+                                      a.extent(4), a.extent(5), a.extent(6)}),
+                         *this);
+    ExecSpace().fence();
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const iType& i0, const iType& i1, const iType& i3,
+                  const iType& i4, const iType& i5, const iType& i6) const {
+    for (iType i2 = 0; i2 < iType(a.extent(2)); i2++)
+      a(i0, i1, i2, i3, i4, i5, i6) = op(b(i0, i1, i2, i3, i4, i5, i6));
+  };
+};
+
+template <class ViewTypeA, class ViewTypeB, class UnaryOp, class Layout,
+          class ExecSpace, typename iType>
+struct ViewCopyTransform<ViewTypeA, ViewTypeB, UnaryOp, Layout, ExecSpace, 8,
+                         iType> {
+  ViewTypeA a;
+  ViewTypeB b;
+  UnaryOp op;
+
+  static const Kokkos::Iterate outer_iteration_pattern =
+      Kokkos::layout_iterate_type_selector<Layout>::outer_iteration_pattern;
+  static const Kokkos::Iterate inner_iteration_pattern =
+      Kokkos::layout_iterate_type_selector<Layout>::inner_iteration_pattern;
+  typedef Kokkos::Rank<6, outer_iteration_pattern, inner_iteration_pattern>
+      iterate_type;
+  typedef Kokkos::MDRangePolicy<ExecSpace, iterate_type,
+                                Kokkos::IndexType<iType>>
+      policy_type;
+
+  ViewCopyTransform(const ViewTypeA& a_, const ViewTypeB& b_,
+                    const UnaryOp& op_)
+      : a(a_), b(b_), op(op_) {
+    ExecSpace().fence();
+    Kokkos::parallel_for("Kokkos::ViewCopyTransform-8D",
+                         policy_type({0, 0, 0, 0, 0, 0},
+                                     {a.extent(0), a.extent(1), a.extent(3),
+                                      a.extent(5), a.extent(6), a.extent(7)}),
+                         *this);
+    ExecSpace().fence();
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const iType& i0, const iType& i1, const iType& i3,
+                  const iType& i5, const iType& i6, const iType& i7) const {
+    for (iType i2 = 0; i2 < iType(a.extent(2)); i2++)
+      for (iType i4 = 0; i4 < iType(a.extent(4)); i4++)
+        a(i0, i1, i2, i3, i4, i5, i6, i7) =
+            op(b(i0, i1, i2, i3, i4, i5, i6, i7));
+  };
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  Fused dst = op(src(...)) elementwise: a deep_copy with a
+ *          unary operation applied on the way through.
+ *
+ *  A deep_copy followed by a transform kernel (unit conversions at
+ *  interface boundaries) reads and writes the data twice; this runs the
+ *  fused kernel on whichever side can access both views, paying one
+ *  pass.  When neither execution space can access the other's memory
+ *  the transform runs on the source's side into a contiguous staging
+ *  view and one contiguous transfer delivers the result, so the
+ *  operation is never applied element-wise across the link.  Blocking.
+ */
+template <class DT, class... DP, class ST, class... SP, class UnaryOp>
+inline void deep_copy_transform(const View<DT, DP...>& dst,
+                                const View<ST, SP...>& src, const UnaryOp& op) {
+  typedef View<DT, DP...> dst_type;
+  typedef View<ST, SP...> src_type;
+  typedef typename dst_type::execution_space dst_execution_space;
+  typedef typename src_type::execution_space src_execution_space;
+  typedef typename dst_type::memory_space dst_memory_space;
+  typedef typename src_type::memory_space src_memory_space;
+
+  static_assert(std::is_same<typename dst_type::value_type,
+                             typename dst_type::non_const_value_type>::value,
+                "deep_copy_transform requires non-const destination type");
+
+  static_assert((unsigned(dst_type::rank) == unsigned(src_type::rank)),
+                "deep_copy_transform requires views of equal rank");
+
+  if ((src.extent(0) != dst.extent(0)) || (src.extent(1) != dst.extent(1)) ||
+      (src.extent(2) != dst.extent(2)) || (src.extent(3) != dst.extent(3)) ||
+      (src.extent(4) != dst.extent(4)) || (src.extent(5) != dst.extent(5)) ||
+      (src.extent(6) != dst.extent(6)) || (src.extent(7) != dst.extent(7))) {
+    std::string message(
+        "Error: Kokkos::deep_copy_transform extents of views don't match: ");
+    message += dst.label();
+    message += " ";
+    message += src.label();
+    Kokkos::Impl::throw_runtime_exception(message);
+  }
+
+  if (dst.data() == nullptr || src.data() == nullptr || dst.size() == 0) {
+    Kokkos::fence();
+    return;
+  }
+
+  enum {
+    DstExecCanAccessSrc =
+        Kokkos::Impl::SpaceAccessibility<dst_execution_space,
+                                         src_memory_space>::accessible
+  };
+  enum {
+    SrcExecCanAccessDst =
+        Kokkos::Impl::SpaceAccessibility<src_execution_space,
+                                         dst_memory_space>::accessible
+  };
+
+  typedef typename std::conditional<
+      std::is_same<typename dst_type::array_layout, Kokkos::LayoutLeft>::value,
+      Kokkos::LayoutLeft, Kokkos::LayoutRight>::type iterate_layout;
+
+  if (DstExecCanAccessSrc) {
+    Kokkos::Impl::ViewCopyTransform<dst_type, src_type, UnaryOp, iterate_layout,
+                                    dst_execution_space, int(dst_type::rank),
+                                    int64_t>(dst, src, op);
+  } else if (SrcExecCanAccessDst) {
+    Kokkos::Impl::ViewCopyTransform<dst_type, src_type, UnaryOp, iterate_layout,
+                                    src_execution_space, int(dst_type::rank),
+                                    int64_t>(dst, src, op);
+  } else {
+    // Transform on the source's compute side into contiguous staging
+    // laid out for the destination, then one contiguous transfer.
+    typedef Kokkos::View<typename dst_type::non_const_data_type,
+                         Kokkos::LayoutRight, typename src_type::device_type>
+        staging_type;
+
+    typename staging_type::array_layout layout;
+    for (unsigned r = 0; r < unsigned(dst_type::rank); ++r) {
+      layout.dimension[r] = dst.extent(r);
+    }
+
+    staging_type stage(
+        Kokkos::view_alloc("Kokkos::deep_copy_transform::staging",
+                           WithoutInitializing),
+        layout);
+
+    Kokkos::Impl::ViewCopyTransform<staging_type, src_type, UnaryOp,
+                                    Kokkos::LayoutRight, src_execution_space,
+                                    int(dst_type::rank), int64_t>(stage, src,
+                                                                  op);
+    Kokkos::deep_copy(dst, stage);
+  }
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
 
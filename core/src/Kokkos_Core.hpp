@@ -86,17 +86,58 @@
 #include <Kokkos_AnonymousSpace.hpp>
 #include <Kokkos_Pair.hpp>
 #include <Kokkos_MemoryPool.hpp>
+#include <Kokkos_PooledSpace.hpp>
 #include <Kokkos_Array.hpp>
 #include <Kokkos_View.hpp>
 #include <Kokkos_Vectorization.hpp>
+#include <Kokkos_UniqueTokenPool.hpp>
 #include <Kokkos_Atomic.hpp>
 #include <Kokkos_hwloc.hpp>
 #include <Kokkos_Timer.hpp>
 #include <Kokkos_TaskScheduler.hpp>
 
 #include <Kokkos_Complex.hpp>
+#include <Kokkos_Half.hpp>
 
 #include <Kokkos_CopyViews.hpp>
+#include <Kokkos_KernelGraph.hpp>
+#include <Kokkos_Compact.hpp>
+#include <Kokkos_ScopedArena.hpp>
+#include <Kokkos_Prefetch.hpp>
+#include <Kokkos_TeamSizeTuner.hpp>
+#include <Kokkos_MemoryAccounting.hpp>
+#include <Kokkos_ViewSerialization.hpp>
+#include <Kokkos_CheckpointWriter.hpp>
+#include <Kokkos_Transpose.hpp>
+#include <Kokkos_ScratchPlan.hpp>
+#include <Kokkos_PersistentExecutor.hpp>
+#include <Kokkos_AsyncDispatch.hpp>
+#include <Kokkos_ReductionResult.hpp>
+#include <Kokkos_ParallelFind.hpp>
+#include <Kokkos_LeagueAllReduce.hpp>
+#include <Kokkos_MDRangeScan.hpp>
+#include <Kokkos_KernelRegistry.hpp>
+#include <Kokkos_RuntimeDispatch.hpp>
+#include <Kokkos_TileRange.hpp>
+#include <Kokkos_LeagueOrdering.hpp>
+#include <Kokkos_PackedLocReducers.hpp>
+#include <Kokkos_SimdArray.hpp>
+#include <Kokkos_BatchDeepCopy.hpp>
+#include <Kokkos_ChecksumDeepCopy.hpp>
+#include <Kokkos_TeamCopy.hpp>
+#include <Kokkos_PoolAllocator.hpp>
+#include <Kokkos_MultiDevice.hpp>
+#include <Kokkos_StencilPolicy.hpp>
+#include <Kokkos_PersistentFunctor.hpp>
+#include <Kokkos_DeterministicReduce.hpp>
+#include <Kokkos_FrequencyDispatch.hpp>
+#include <Kokkos_OnCompletion.hpp>
+#include <Kokkos_InterleaveCopy.hpp>
+#include <Kokkos_RealtimePhase.hpp>
+#include <Kokkos_ColorMDRange.hpp>
+#include <Kokkos_PipelineExecutor.hpp>
+#include <Kokkos_SubTeam.hpp>
+#include <Kokkos_AllocationAudit.hpp>
 #include <functional>
 #include <iosfwd>
 
@@ -111,6 +152,7 @@ struct InitArguments {
   int ndevices;
   int skip_device;
   bool disable_warnings;
+  bool defer_device_init;
 
   InitArguments(int nt = -1, int nn = -1, int dv = -1, bool dw = false)
       : num_threads{nt},
@@ -118,7 +160,8 @@ struct InitArguments {
         device_id{dv},
         ndevices{-1},
         skip_device{9999},
-        disable_warnings{dw} {}
+        disable_warnings{dw},
+        defer_device_init{false} {}
 };
 
 void initialize(int& narg, char* arg[]);
@@ -159,6 +202,61 @@ void finalize_all();
 
 void fence();
 
+namespace Impl {
+/* Bring up device backends whose initialization was deferred by
+ * InitArguments::defer_device_init or KOKKOS_DEFER_DEVICE_INIT.
+ * Idempotent; called from the device backends on first use and from
+ * Experimental::prewarm_backends(). */
+void ensure_device_backends_initialized();
+}  // namespace Impl
+
+namespace Experimental {
+/** \brief  Initialize any device backends whose bring-up was deferred.
+ *
+ *  With InitArguments::defer_device_init (or KOKKOS_DEFER_DEVICE_INIT=1
+ *  in the environment), Kokkos::initialize skips device context
+ *  creation so host-only tool runs start in milliseconds; the contexts
+ *  are created on first use of the device execution space instead.
+ *  Codes that want the bring-up cost at a controlled point (e.g. during
+ *  MPI startup) call this to pay it eagerly.  A no-op when nothing was
+ *  deferred.
+ */
+void prewarm_backends();
+
+/** \brief  Release the scratch memory retained by the enabled backends.
+ *
+ *  The per-backend scratch arenas that back team-level scratch and
+ *  multiblock reductions grow to the high-water mark of all launches and
+ *  are retained across kernels, so alternating big/small-scratch kernels
+ *  never pay a driver allocation on the transition.  A code that is done
+ *  with its large-scratch phase calls this to hand the retained memory
+ *  back to the driver or OS; the arenas regrow on demand from their
+ *  bring-up sizes.  Fences all backends first.  Must be called from the
+ *  master thread, outside of any parallel region.
+ */
+void trim_scratch_memory();
+
+/** \brief  How idle host-pool threads wait for the next kernel. */
+enum class HostWaitMode {
+  Adaptive,  ///< learn from recent inter-kernel gaps (the default)
+  Burst,     ///< short kernels are coming: spin longer before sleeping
+  IdleSoon   ///< a gap follows: sleep almost immediately, free the cores
+};
+
+/** \brief  Hint how host-pool threads should wait at their barriers.
+ *
+ *  Spinning through an inter-kernel gap burns cores; sleeping through a
+ *  burst of sub-millisecond kernels adds wakeup latency to every one of
+ *  them.  By default the barriers adapt from the duration of recent
+ *  waits; a code that knows its phase structure (a kernel burst is
+ *  starting, or a long I/O or MPI gap follows) can pin the trade-off
+ *  with Burst or IdleSoon and restore Adaptive afterwards.  Affects all
+ *  host thread pools in the process; takes effect for waits that begin
+ *  after the call.
+ */
+void set_host_wait_mode(HostWaitMode mode);
+}  // namespace Experimental
+
 /** \brief Print "Bill of Materials" */
 void print_configuration(std::ostream&, const bool detail = false);
 
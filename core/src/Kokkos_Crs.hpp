@@ -45,6 +45,12 @@
 #ifndef KOKKOS_CRS_HPP
 #define KOKKOS_CRS_HPP
 
+#include <Kokkos_View.hpp>
+#include <Kokkos_ExecPolicy.hpp>
+#include <Kokkos_Parallel.hpp>
+#include <KokkosExp_MDRangePolicy.hpp>
+#include <Kokkos_CopyViews.hpp>
+
 namespace Kokkos {
 
 /// \class Crs
@@ -263,6 +269,236 @@ class FillCrsTransposeEntries {
   }
 };
 
+// Speculative greedy coloring of the rows of a graph such that no two
+// rows within the given distance (1 or 2) of one another share a color.
+// Adjacency is the union of the graph's out-edges and its transpose's,
+// so directed connectivity input works.  Rows are colored tentatively in
+// parallel with a 32-color forbidden window; conflicts are then detected
+// and the larger-numbered row of a conflicting pair retries in the next
+// round.  The smallest row of any conflicting set always keeps its
+// color, so every round makes progress.
+template <class InCrs, class ColorsView>
+class ColorCrsGraph {
+ public:
+  using execution_space = typename InCrs::execution_space;
+  using memory_space    = typename InCrs::memory_space;
+  using self_type       = ColorCrsGraph<InCrs, ColorsView>;
+  using index_type      = typename InCrs::size_type;
+  using color_type      = typename ColorsView::non_const_value_type;
+  using worklist_type   = View<index_type*, memory_space>;
+  using count_type      = View<color_type, memory_space>;
+
+  struct TagInit {};
+  struct TagTentative {};
+  struct TagConflict {};
+  struct TagNumColors {};
+
+ private:
+  InCrs m_adj[2];  // the graph and its transpose
+  ColorsView m_colors;
+  worklist_type m_work;
+  worklist_type m_next;
+  count_type m_count;
+  int m_distance;
+
+  KOKKOS_INLINE_FUNCTION
+  void forbid(index_type u, index_type v, color_type base,
+              unsigned& forbidden) const {
+    if (u != v) {
+      const color_type c = m_colors(u);
+      if (base <= c && c < base + 32) forbidden |= 1u << (c - base);
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  unsigned forbidden_window(index_type v, color_type base) const {
+    unsigned forbidden = 0;
+    for (int d = 0; d < 2; ++d) {
+      const index_type end = m_adj[d].row_map(v + 1);
+      for (index_type j = m_adj[d].row_map(v); j < end; ++j) {
+        const index_type u = m_adj[d].entries(j);
+        forbid(u, v, base, forbidden);
+        if (1 < m_distance) {
+          for (int d2 = 0; d2 < 2; ++d2) {
+            const index_type end2 = m_adj[d2].row_map(u + 1);
+            for (index_type k = m_adj[d2].row_map(u); k < end2; ++k) {
+              forbid(m_adj[d2].entries(k), v, base, forbidden);
+            }
+          }
+        }
+      }
+    }
+    return forbidden;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  bool conflicts_with(index_type u, index_type v) const {
+    return u < v && m_colors(u) == m_colors(v);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  bool has_conflict(index_type v) const {
+    for (int d = 0; d < 2; ++d) {
+      const index_type end = m_adj[d].row_map(v + 1);
+      for (index_type j = m_adj[d].row_map(v); j < end; ++j) {
+        const index_type u = m_adj[d].entries(j);
+        if (conflicts_with(u, v)) return true;
+        if (1 < m_distance) {
+          for (int d2 = 0; d2 < 2; ++d2) {
+            const index_type end2 = m_adj[d2].row_map(u + 1);
+            for (index_type k = m_adj[d2].row_map(u); k < end2; ++k) {
+              if (conflicts_with(m_adj[d2].entries(k), v)) return true;
+            }
+          }
+        }
+      }
+    }
+    return false;
+  }
+
+  template <class Tag>
+  void run(index_type n) {
+    using policy_type  = RangePolicy<index_type, execution_space, Tag>;
+    using closure_type = Kokkos::Impl::ParallelFor<self_type, policy_type>;
+    const closure_type closure(*this, policy_type(0, n));
+    closure.execute();
+    execution_space().fence();
+  }
+
+ public:
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagInit, index_type i) const {
+    m_colors(i) = -1;
+    m_work(i)   = i;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagTentative, index_type i) const {
+    const index_type v = m_work(i);
+    color_type color   = -1;
+    for (color_type base = 0; color == -1; base += 32) {
+      const unsigned forbidden = forbidden_window(v, base);
+      for (int b = 0; b < 32; ++b) {
+        if (!((forbidden >> b) & 1u)) {
+          color = base + b;
+          break;
+        }
+      }
+    }
+    m_colors(v) = color;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagConflict, index_type i) const {
+    const index_type v = m_work(i);
+    if (has_conflict(v)) {
+      m_colors(v) = -1;
+      m_next(atomic_fetch_add(&m_count(), color_type(1))) = v;
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagNumColors, index_type i) const {
+    atomic_fetch_max(&m_count(), color_type(m_colors(i) + 1));
+  }
+
+  ColorCrsGraph(InCrs const& arg_graph, InCrs const& arg_transpose,
+                ColorsView const& arg_colors, int arg_distance)
+      : m_colors(arg_colors),
+        m_work(ViewAllocateWithoutInitializing("color_worklist"),
+               arg_graph.numRows()),
+        m_next(ViewAllocateWithoutInitializing("color_worklist_next"),
+               arg_graph.numRows()),
+        m_count("color_count"),
+        m_distance(arg_distance) {
+    m_adj[0] = arg_graph;
+    m_adj[1] = arg_transpose;
+  }
+
+  color_type execute() {
+    const index_type num_verts = m_adj[0].numRows();
+    if (num_verts == 0) return 0;
+    run<TagInit>(num_verts);
+    auto count_host   = Kokkos::create_mirror_view(m_count);
+    index_type n_work = num_verts;
+    while (0 < n_work) {
+      run<TagTentative>(n_work);
+      Kokkos::deep_copy(m_count, color_type(0));
+      run<TagConflict>(n_work);
+      Kokkos::deep_copy(count_host, m_count);
+      n_work = index_type(count_host());
+      worklist_type const tmp = m_work;
+      m_work                  = m_next;
+      m_next                  = tmp;
+    }
+    Kokkos::deep_copy(m_count, color_type(0));
+    run<TagNumColors>(num_verts);
+    Kokkos::deep_copy(count_host, m_count);
+    return count_host();
+  }
+};
+
+// Build the color -> rows Crs from a coloring: count the rows of each
+// color, scan the counts into a row map, then scatter the rows
+template <class ColorsView, class OutCrs>
+class FillColorSets {
+ public:
+  using execution_space = typename OutCrs::execution_space;
+  using self_type       = FillColorSets<ColorsView, OutCrs>;
+  using index_type      = typename OutCrs::size_type;
+  using counts_type = View<index_type*, typename OutCrs::memory_space>;
+
+  struct TagCount {};
+  struct TagCursor {};
+  struct TagFill {};
+
+ private:
+  ColorsView m_colors;
+  OutCrs m_sets;
+  counts_type m_counts;  // reused as the per-color fill cursor
+
+  template <class Tag>
+  void run(index_type n) {
+    using policy_type  = RangePolicy<index_type, execution_space, Tag>;
+    using closure_type = Kokkos::Impl::ParallelFor<self_type, policy_type>;
+    const closure_type closure(*this, policy_type(0, n));
+    closure.execute();
+    execution_space().fence();
+  }
+
+ public:
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagCount, index_type i) const {
+    atomic_increment(&m_counts(m_colors(i)));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagCursor, index_type c) const {
+    m_counts(c) = m_sets.row_map(c);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagFill, index_type i) const {
+    m_sets.entries(atomic_fetch_add(&m_counts(m_colors(i)), index_type(1))) =
+        typename OutCrs::data_type(i);
+  }
+
+  FillColorSets(ColorsView const& arg_colors, OutCrs& arg_sets,
+                index_type arg_num_colors)
+      : m_colors(arg_colors),
+        m_counts("color_set_counts", arg_num_colors) {
+    run<TagCount>(index_type(m_colors.size()));
+    Kokkos::get_crs_row_map_from_counts(arg_sets.row_map, m_counts,
+                                        "color_sets_row_map");
+    arg_sets.entries = typename OutCrs::entries_type(
+        ViewAllocateWithoutInitializing("color_sets_entries"),
+        m_colors.size());
+    m_sets = arg_sets;
+    run<TagCursor>(arg_num_colors);
+    run<TagFill>(index_type(m_colors.size()));
+  }
+};
+
 }  // namespace Impl
 }  // namespace Kokkos
 
@@ -415,4 +651,60 @@ void count_and_fill_crs(CrsType& crs, typename CrsType::size_type nrows,
 
 }  // namespace Kokkos
 
+/*--------------------------------------------------------------------------*/
+
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  A conflict-free coloring of the rows of a Crs graph.
+ *
+ *  colors(v) is the color of row v, in [0, num_colors).  color_sets is a
+ *  Crs whose row c lists the rows of color c; each row of color_sets can
+ *  be consumed as one parallel batch in which no two entries are within
+ *  the coloring distance of one another, so batch members may update
+ *  shared neighbor data without atomics.
+ */
+template <class CrsType>
+struct CrsColoring {
+  using colors_type = View<int32_t*, typename CrsType::memory_space>;
+  CrsType color_sets;
+  colors_type colors;
+  int32_t num_colors;
+};
+
+/** \brief  Color the rows of a Crs graph in parallel, on device.
+ *
+ *  Adjacency is taken as the union of the graph's edges and their
+ *  transposes (computed with transpose_crs), so directed connectivity
+ *  input works.  distance must be 1 (no two adjacent rows share a color)
+ *  or 2 (no two rows within two hops share a color, as needed for
+ *  conflict-free scatter to shared neighbors).
+ */
+template <class DataType, class Arg1Type, class Arg2Type, class SizeType>
+CrsColoring<Crs<DataType, Arg1Type, Arg2Type, SizeType>> color_crs(
+    Crs<DataType, Arg1Type, Arg2Type, SizeType> const& in, int distance = 1) {
+  typedef Crs<DataType, Arg1Type, Arg2Type, SizeType> crs_type;
+  typedef CrsColoring<crs_type> coloring_type;
+  typedef typename coloring_type::colors_type colors_type;
+
+  crs_type transpose;
+  Kokkos::transpose_crs(transpose, in);
+
+  coloring_type coloring;
+  coloring.colors =
+      colors_type(ViewAllocateWithoutInitializing("crs_colors"), in.numRows());
+  Kokkos::Impl::ColorCrsGraph<crs_type, colors_type> color_functor(
+      in, transpose, coloring.colors, distance);
+  coloring.num_colors = color_functor.execute();
+
+  Kokkos::Impl::FillColorSets<colors_type, crs_type> fill_functor(
+      coloring.colors, coloring.color_sets,
+      typename crs_type::size_type(coloring.num_colors));
+
+  return coloring;
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
 #endif /* #define KOKKOS_CRS_HPP */
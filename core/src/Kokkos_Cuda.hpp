@@ -209,7 +209,13 @@ class Cuda {
   Cuda& operator=(Cuda&&) = default;
   Cuda& operator=(const Cuda&) = default;
 
-  Cuda(cudaStream_t stream);
+  /// \brief Construct an instance that submits work to the given stream.
+  ///
+  /// Kernels and copies launched through this instance are ordered only
+  /// against work submitted to the same stream, so instances built on
+  /// distinct streams may execute concurrently.  If \c manage_stream is
+  /// true the instance owns the stream and destroys it on finalization.
+  Cuda(cudaStream_t stream, bool manage_stream = false);
 
   //--------------------------------------------------------------------------
   //! \name Device-specific functions
@@ -330,6 +336,7 @@ struct VerifyExecutionCanAccessMemorySpace<Kokkos::HostSpace,
 
 #include <Cuda/Kokkos_Cuda_KernelLaunch.hpp>
 #include <Cuda/Kokkos_Cuda_Instance.hpp>
+#include <Cuda/Kokkos_Cuda_ConstantCache.hpp>
 #include <Cuda/Kokkos_Cuda_View.hpp>
 #include <Cuda/Kokkos_Cuda_Team.hpp>
 #include <Cuda/Kokkos_Cuda_Parallel.hpp>
@@ -67,6 +67,12 @@ extern "C" void kokkos_impl_cuda_set_pin_uvm_to_host(bool);
 
 namespace Kokkos {
 
+class CudaSpace;
+
+namespace Impl {
+CudaSpace with_stream_ordered(const CudaSpace&, const Kokkos::Cuda&);
+}  // namespace Impl
+
 /** \brief  Cuda on-device memory management */
 
 class CudaSpace {
@@ -81,13 +87,29 @@ class CudaSpace {
   /*--------------------------------*/
 
   CudaSpace();
+
+  /**\brief  Memory space instance bound to an explicit device.
+   *
+   *  Allocations made through this instance reside on 'arg_device_id'
+   *  regardless of the process's current device, enabling one process
+   *  to hold memory on several devices.
+   */
+  explicit CudaSpace(int arg_device_id);
+
   CudaSpace(CudaSpace&& rhs)      = default;
   CudaSpace(const CudaSpace& rhs) = default;
   CudaSpace& operator=(CudaSpace&& rhs) = default;
   CudaSpace& operator=(const CudaSpace& rhs) = default;
   ~CudaSpace()                               = default;
 
-  /**\brief  Allocate untracked memory in the cuda space */
+  /**\brief  Allocate untracked memory in the cuda space.
+   *
+   *  An instance obtained from Impl::with_stream_ordered enqueues the
+   *  allocation on its stream instead of synchronizing the device,
+   *  when the CUDA runtime supports stream-ordered allocation; freed
+   *  blocks are recycled within the stream's ordering by the runtime's
+   *  memory pool.
+   */
   void* allocate(const size_t arg_alloc_size) const;
 
   /**\brief  Deallocate untracked memory in the cuda space */
@@ -96,18 +118,51 @@ class CudaSpace {
   /**\brief Return Name of the MemorySpace */
   static constexpr const char* name() { return m_name; }
 
+  /**\brief  The device this instance allocates on */
+  int cuda_device() const noexcept { return m_device; }
+
+  /**\brief  Largest number of bytes ever simultaneously live in this space */
+  static uint64_t high_water_mark();
+
   /*--------------------------------*/
   /** \brief  Error reporting for HostSpace attempt to access CudaSpace */
   static void access_error();
   static void access_error(const void* const);
 
  private:
-  int m_device;  ///< Which Cuda device
+  int m_device;           ///< Which Cuda device
+  cudaStream_t m_stream;  ///< Stream for stream-ordered allocation,
+                          ///  0 = synchronous
 
   static constexpr const char* m_name = "Cuda";
   friend class Kokkos::Impl::SharedAllocationRecord<Kokkos::CudaSpace, void>;
+  friend CudaSpace Kokkos::Impl::with_stream_ordered(const CudaSpace&,
+                                                     const Kokkos::Cuda&);
 };
 
+namespace Experimental {
+
+/** \brief  Number of Cuda devices visible to this process */
+int cuda_device_count();
+
+/** \brief  Enable direct peer access from 'arg_device' to memory on
+ *          'arg_peer_device'.
+ *
+ *  Returns true when the devices can and do access each other's memory
+ *  directly (NVLink or PCIe peer-to-peer); deep_copy between CudaSpace
+ *  instances on the two devices then runs as a direct peer transfer
+ *  instead of staging through the host.  Enabling is one-directional
+ *  and idempotent.  Returns false when the hardware cannot peer.
+ */
+bool enable_cuda_peer_access(int arg_device, int arg_peer_device);
+
+/** \brief  Enable peer access between every capable ordered pair of
+ *          visible devices; returns the number of pairs enabled.
+ */
+int enable_cuda_peer_access();
+
+}  // namespace Experimental
+
 namespace Impl {
 /// \brief Initialize lock array for arbitrary size atomics.
 ///
@@ -188,6 +243,9 @@ class CudaUVMSpace {
   /**\brief Return Name of the MemorySpace */
   static constexpr const char* name() { return m_name; }
 
+  /**\brief  Largest number of bytes ever simultaneously live in this space */
+  static uint64_t high_water_mark();
+
 #ifdef KOKKOS_IMPL_DEBUG_CUDA_PIN_UVM_TO_HOST
   static bool cuda_pin_uvm_to_host();
   static void cuda_set_pin_uvm_to_host(bool val);
@@ -240,6 +298,9 @@ class CudaHostPinnedSpace {
   /**\brief Return Name of the MemorySpace */
   static constexpr const char* name() { return m_name; }
 
+  /**\brief  Largest number of bytes ever simultaneously live in this space */
+  static uint64_t high_water_mark();
+
  private:
   static constexpr const char* m_name = "CudaHostPinned";
 
@@ -383,6 +444,34 @@ namespace Impl {
 
 void DeepCopyAsyncCuda(void* dst, const void* src, size_t n);
 
+// 2D pitched copies dispatch to the cudaMemcpy2D engine, which moves
+// strided slabs at near cudaMemcpy bandwidth without launching a kernel.
+
+template <>
+struct deep_copy_2d_available<CudaSpace, CudaSpace> : std::true_type {};
+template <>
+struct deep_copy_2d_available<CudaSpace, HostSpace> : std::true_type {};
+template <>
+struct deep_copy_2d_available<HostSpace, CudaSpace> : std::true_type {};
+
+struct DeepCopy2DCuda {
+  DeepCopy2DCuda(void* dst, size_t dst_pitch, const void* src,
+                 size_t src_pitch, size_t width, size_t rows);
+};
+
+template <>
+struct DeepCopy2D<CudaSpace, CudaSpace> : DeepCopy2DCuda {
+  using DeepCopy2DCuda::DeepCopy2DCuda;
+};
+template <>
+struct DeepCopy2D<CudaSpace, HostSpace> : DeepCopy2DCuda {
+  using DeepCopy2DCuda::DeepCopy2DCuda;
+};
+template <>
+struct DeepCopy2D<HostSpace, CudaSpace> : DeepCopy2DCuda {
+  using DeepCopy2DCuda::DeepCopy2DCuda;
+};
+
 template <>
 struct DeepCopy<CudaSpace, CudaSpace, Cuda> {
   DeepCopy(void* dst, const void* src, size_t);
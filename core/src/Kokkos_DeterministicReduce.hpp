@@ -0,0 +1,289 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_DeterministicReduce.hpp
+/// \brief Run-to-run reproducible reductions.
+///
+/// The shape of a parallel_reduce's combining tree depends on the
+/// concurrency it runs at, so floating-point results differ between
+/// thread counts, devices and runs - enough to break bitwise regression
+/// baselines.  This header provides two opt-in remedies:
+///
+///  - CompensatedSum, a reducer whose accumulator carries a Neumaier
+///    correction term alongside the running sum.  It shrinks the
+///    rounding error (and hence the tree-shape dependence) by orders of
+///    magnitude but is not bitwise reproducible on its own.
+///
+///  - deterministic_reduce, which evaluates the reduction over
+///    fixed-size chunks - each chunk summed serially in index order -
+///    and combines the chunk partials in chunk order.  The result
+///    depends only on the chunk size, never on how many threads or
+///    teams executed it, so it is bitwise identical across concurrency
+///    levels for a given device's arithmetic.
+///
+/// Combining the two (deterministic_reduce with a CompensatedSum
+/// reducer) gives baselines that are both reproducible and close to the
+/// correctly rounded sum.
+
+#ifndef KOKKOS_DETERMINISTICREDUCE_HPP
+#define KOKKOS_DETERMINISTICREDUCE_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_View.hpp>
+#include <Kokkos_Parallel.hpp>
+
+#include <string>
+#include <type_traits>
+
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  Accumulator of CompensatedSum: a running sum plus a Neumaier
+ *          correction term capturing the rounding error of every add.
+ *
+ *  The corrected result is value(); intermediate states keep sum and
+ *  correction separate so partials can be merged without losing the
+ *  accumulated error.
+ */
+template <class Scalar>
+struct CompensatedScalar {
+  Scalar sum;
+  Scalar correction;
+
+  //! Add one term, banking the rounding error of the add.
+  KOKKOS_INLINE_FUNCTION
+  CompensatedScalar& operator+=(const Scalar& term) {
+    const Scalar t = sum + term;
+    // Neumaier's variant: the smaller-magnitude operand is the one
+    // whose low bits the add discarded.
+    if ((sum < Scalar(0) ? -sum : sum) < (term < Scalar(0) ? -term : term)) {
+      correction += (term - t) + sum;
+    } else {
+      correction += (sum - t) + term;
+    }
+    sum = t;
+    return *this;
+  }
+
+  //! The compensated total.
+  KOKKOS_INLINE_FUNCTION
+  Scalar value() const { return sum + correction; }
+};
+
+/** \brief  Reducer performing compensated (Kahan-Neumaier) summation.
+ *
+ *  Drop-in alternative to Kokkos::Sum for floating-point scalars; the
+ *  functor's update argument is a CompensatedScalar and contributions
+ *  are added with +=:
+ *
+ *  \code
+ *    Kokkos::Experimental::CompensatedScalar<double> total;
+ *    parallel_reduce(n, KOKKOS_LAMBDA(const int i,
+ *        Kokkos::Experimental::CompensatedScalar<double>& upd) {
+ *        upd += x(i);
+ *      }, Kokkos::Experimental::CompensatedSum<double>(total));
+ *    const double sum = total.value();
+ *  \endcode
+ */
+template <class Scalar, class Space = Kokkos::HostSpace>
+struct CompensatedSum {
+ public:
+  // Required
+  typedef CompensatedSum reducer;
+  typedef CompensatedScalar<typename std::remove_cv<Scalar>::type> value_type;
+
+  typedef Kokkos::View<value_type, Space> result_view_type;
+
+ private:
+  result_view_type value;
+  bool references_scalar_v;
+
+ public:
+  KOKKOS_INLINE_FUNCTION
+  CompensatedSum(value_type& value_)
+      : value(&value_), references_scalar_v(true) {}
+
+  KOKKOS_INLINE_FUNCTION
+  CompensatedSum(const result_view_type& value_)
+      : value(value_), references_scalar_v(false) {}
+
+  // Required
+  KOKKOS_INLINE_FUNCTION
+  void join(value_type& dest, const value_type& src) const {
+    dest += src.sum;
+    dest.correction += src.correction;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void join(volatile value_type& dest, const volatile value_type& src) const {
+    value_type d;
+    d.sum        = dest.sum;
+    d.correction = dest.correction;
+    const Scalar src_sum = src.sum;
+    d += src_sum;
+    d.correction += src.correction;
+    dest.sum        = d.sum;
+    dest.correction = d.correction;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void init(value_type& val) const {
+    val.sum        = Scalar(0);
+    val.correction = Scalar(0);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  value_type& reference() const { return *value.data(); }
+
+  KOKKOS_INLINE_FUNCTION
+  result_view_type view() const { return value; }
+
+  KOKKOS_INLINE_FUNCTION
+  bool references_scalar() const { return references_scalar_v; }
+};
+
+namespace Impl {
+
+//! Per-chunk serial evaluation of a range-reduction functor.
+template <class FunctorType, class ReducerType, class ViewType>
+struct DeterministicReducePartials {
+  typedef typename ReducerType::value_type value_type;
+
+  FunctorType m_functor;
+  ReducerType m_reducer;
+  ViewType m_partials;
+  int64_t m_begin;
+  int64_t m_end;
+  int64_t m_chunk;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t c) const {
+    const int64_t begin = m_begin + c * m_chunk;
+    int64_t end         = begin + m_chunk;
+    if (m_end < end) end = m_end;
+
+    value_type partial;
+    m_reducer.init(partial);
+    for (int64_t i = begin; i < end; ++i) m_functor(i, partial);
+    m_partials(c) = partial;
+  }
+};
+
+}  // namespace Impl
+
+/** \brief  Fixed-shape parallel reduction over the range [begin, end).
+ *
+ *  The range is cut into chunks of chunk_size consecutive indices; each
+ *  chunk is summed serially in index order, in parallel across chunks,
+ *  and the chunk partials are then combined in chunk order.  The
+ *  combining shape is a function of chunk_size alone - not of the
+ *  thread or team count - so the result is bitwise identical across
+ *  concurrency levels, letting verification runs use full parallelism.
+ *
+ *  The functor has the parallel_reduce range form
+ *  functor(index, value_type&); the reducer supplies init and the
+ *  accumulation semantics (Kokkos::Sum, CompensatedSum, ...) and
+ *  receives the result exactly as parallel_reduce would deliver it.
+ *  Costs one partials allocation of (range / chunk_size) elements and
+ *  a serial host pass over them.
+ */
+template <class ExecutionSpace = Kokkos::DefaultExecutionSpace,
+          class FunctorType, class ReducerType>
+void deterministic_reduce(const std::string& label, const int64_t begin,
+                          const int64_t end, const FunctorType& functor,
+                          const ReducerType& reducer,
+                          const int64_t chunk_size = 4096) {
+  typedef typename ReducerType::value_type value_type;
+  typedef Kokkos::View<value_type*, typename ExecutionSpace::memory_space>
+      partials_type;
+
+  const int64_t range = end < begin ? 0 : end - begin;
+  const int64_t num_chunks =
+      chunk_size < 1 ? 0 : (range + chunk_size - 1) / chunk_size;
+
+  value_type total;
+  reducer.init(total);
+
+  if (0 < num_chunks) {
+    partials_type partials(
+        Kokkos::view_alloc(label + " [partials]", Kokkos::WithoutInitializing),
+        num_chunks);
+
+    Impl::DeterministicReducePartials<FunctorType, ReducerType, partials_type>
+        closure{functor, reducer, partials, begin, end, chunk_size};
+    Kokkos::parallel_for(
+        label, Kokkos::RangePolicy<ExecutionSpace, int64_t>(0, num_chunks),
+        closure);
+
+    typename partials_type::HostMirror host_partials =
+        Kokkos::create_mirror_view(partials);
+    Kokkos::deep_copy(host_partials, partials);
+
+    // Chunk order is the fixed combining shape; keep it serial.
+    for (int64_t c = 0; c < num_chunks; ++c) {
+      reducer.join(total, host_partials(c));
+    }
+  }
+
+  Kokkos::deep_copy(
+      reducer.view(),
+      Kokkos::View<const value_type, Kokkos::HostSpace,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>(&total));
+}
+
+//! Overload reducing [0, n) into a scalar with Kokkos::Sum semantics.
+template <class ExecutionSpace = Kokkos::DefaultExecutionSpace,
+          class FunctorType, class ValueType>
+void deterministic_reduce(const std::string& label, const int64_t n,
+                          const FunctorType& functor, ValueType& result,
+                          const int64_t chunk_size = 4096) {
+  deterministic_reduce<ExecutionSpace>(
+      label, 0, n, functor, Kokkos::Sum<ValueType, Kokkos::HostSpace>(result),
+      chunk_size);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_DETERMINISTICREDUCE_HPP */
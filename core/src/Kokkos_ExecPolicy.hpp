@@ -51,6 +51,7 @@
 #include <impl/Kokkos_Tags.hpp>
 #include <impl/Kokkos_AnalyzePolicy.hpp>
 #include <Kokkos_Concepts.hpp>
+#include <cstdint>
 #include <iostream>
 #if defined(KOKKOS_ENABLE_PROFILING)
 #include <typeinfo>
@@ -69,6 +70,18 @@ struct ChunkSize {
   ChunkSize(int value_) : value(value_) {}
 };
 
+/** \brief  Minimum number of work items worth a parallel dispatch.
+ *
+ *  Ranges shorter than the given value execute inline on the calling
+ *  thread with no thread-pool wakeup.  A value of 0 disables the serial
+ *  path; a negative value (the default) defers to the backend's
+ *  threshold calibrated at Kokkos::initialize.
+ */
+struct MinParallelGrain {
+  std::int64_t value;
+  MinParallelGrain(std::int64_t value_) : value(value_) {}
+};
+
 /** \brief  Execution policy for work over a range of an integral type.
  *
  * Valid template argument options:
@@ -101,6 +114,7 @@ class RangePolicy : public Impl::PolicyTraits<Properties...> {
   typename traits::index_type m_end;
   typename traits::index_type m_granularity;
   typename traits::index_type m_granularity_mask;
+  std::int64_t m_min_parallel_grain = -1;
 
   template <class... OtherProperties>
   friend class RangePolicy;
@@ -127,13 +141,17 @@ class RangePolicy : public Impl::PolicyTraits<Properties...> {
   RangePolicy(const RangePolicy&) = default;
   RangePolicy(RangePolicy&&)      = default;
 
+  RangePolicy& operator=(const RangePolicy&) = default;
+  RangePolicy& operator=(RangePolicy&&) = default;
+
   template <class... OtherProperties>
   RangePolicy(const RangePolicy<OtherProperties...> p) {
     m_space            = p.m_space;
     m_begin            = p.m_begin;
     m_end              = p.m_end;
-    m_granularity      = p.m_granularity;
-    m_granularity_mask = p.m_granularity_mask;
+    m_granularity         = p.m_granularity;
+    m_granularity_mask    = p.m_granularity_mask;
+    m_min_parallel_grain  = p.m_min_parallel_grain;
   }
 
   inline RangePolicy() : m_space(), m_begin(0), m_end(0) {}
@@ -193,6 +211,13 @@ class RangePolicy : public Impl::PolicyTraits<Properties...> {
   inline void set(const ChunkSize& chunksize, Args... args) {
     m_granularity      = chunksize.value;
     m_granularity_mask = m_granularity - 1;
+    set(args...);
+  }
+
+  template <class... Args>
+  inline void set(const MinParallelGrain& grain, Args... args) {
+    m_min_parallel_grain = grain.value;
+    set(args...);
   }
 
  public:
@@ -207,6 +232,19 @@ class RangePolicy : public Impl::PolicyTraits<Properties...> {
     return p;
   }
 
+  /** \brief return the minimum work count worth a parallel dispatch;
+   *         negative defers to the backend's calibrated threshold */
+  inline std::int64_t min_parallel_grain() const {
+    return m_min_parallel_grain;
+  }
+
+  /** \brief set the minimum work count worth a parallel dispatch */
+  inline RangePolicy set_min_parallel_grain(std::int64_t grain) const {
+    RangePolicy p          = *this;
+    p.m_min_parallel_grain = grain;
+    return p;
+  }
+
  private:
   /** \brief finalize chunk_size if it was set to AUTO*/
   inline void set_auto_chunk_size() {
@@ -998,31 +1036,29 @@ struct ParallelConstructName;
 
 template <typename FunctorType, typename TagType>
 struct ParallelConstructName<FunctorType, TagType, true> {
-  ParallelConstructName(std::string const& label) : label_ref(label) {
-    if (label.empty()) {
-      default_name = std::string(typeid(FunctorType).name()) + "/" +
-                     typeid(TagType).name();
-    }
-  }
+  ParallelConstructName(std::string const& label) : label_ref(label) {}
   std::string const& get() {
-    return (label_ref.empty()) ? default_name : label_ref;
+    if (!label_ref.empty()) return label_ref;
+    // One instantiation per functor/tag pair, so the typeid fallback
+    // name is constructed once instead of on every profiled launch
+    static std::string const default_name =
+        std::string(typeid(FunctorType).name()) + "/" +
+        typeid(TagType).name();
+    return default_name;
   }
   std::string const& label_ref;
-  std::string default_name;
 };
 
 template <typename FunctorType, typename TagType>
 struct ParallelConstructName<FunctorType, TagType, false> {
-  ParallelConstructName(std::string const& label) : label_ref(label) {
-    if (label.empty()) {
-      default_name = std::string(typeid(FunctorType).name());
-    }
-  }
+  ParallelConstructName(std::string const& label) : label_ref(label) {}
   std::string const& get() {
-    return (label_ref.empty()) ? default_name : label_ref;
+    if (!label_ref.empty()) return label_ref;
+    static std::string const default_name =
+        std::string(typeid(FunctorType).name());
+    return default_name;
   }
   std::string const& label_ref;
-  std::string default_name;
 };
 
 }  // namespace Impl
@@ -0,0 +1,200 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_FrequencyDispatch.hpp
+/// \brief Clock-residency-aware choice between kernel variants.
+///
+/// Sustained wide-vector execution draws enough power that dense nodes
+/// downclock under it, and once the clock drops the wide variant of a
+/// kernel can lose end-to-end to its scalar variant.  The monitor here
+/// reads the current core frequency relative to its nominal maximum
+/// from sysfs cpufreq, smooths it, and the dispatch helper launches the
+/// wide variant only while clock residency stays above a threshold -
+/// falling back to the scalar variant for the duration of a throttled
+/// phase and returning once the clocks recover.
+///
+/// Pairs with the WorkItemProperty::HintWideVector and
+/// HintThrottleAware policy hints: tag the wide launch with both so
+/// tools and future backends can see which launches participate.
+/// Where cpufreq is not exposed (non-Linux, restricted containers) the
+/// monitor reports full residency and the wide variant always runs.
+
+#ifndef KOKKOS_FREQUENCYDISPATCH_HPP
+#define KOKKOS_FREQUENCYDISPATCH_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_Parallel.hpp>
+
+#include <fstream>
+#include <string>
+
+namespace Kokkos {
+namespace Experimental {
+
+namespace Impl {
+
+//! One long integer from a sysfs file, or fallback when unreadable.
+inline long frequency_dispatch_read(const char* path, const long fallback) {
+  long value = fallback;
+#if defined(__linux__)
+  std::ifstream file(path);
+  if (file.good()) file >> value;
+#else
+  (void)path;
+#endif
+  return 0 < value ? value : fallback;
+}
+
+}  // namespace Impl
+
+/** \brief  Smoothed observation of core clock residency.
+ *
+ *  residency() is the current frequency of cpu0 as a fraction of its
+ *  maximum, folded into an exponential moving average across calls so
+ *  one sample taken mid-transition does not flip the dispatch.  A
+ *  reading of 1.0 means the core holds its nominal clock; sustained
+ *  license-based downclocking shows up as a stable fraction below it.
+ */
+class FrequencyMonitor {
+ private:
+  double m_residency;
+  double m_alpha;
+
+ public:
+  explicit FrequencyMonitor(const double alpha = 0.5)
+      : m_residency(1.0), m_alpha(alpha) {}
+
+  //! One raw sample, bypassing the smoothing.
+  static double sample() {
+    const long max_khz = Impl::frequency_dispatch_read(
+        "/sys/devices/system/cpu/cpu0/cpufreq/cpuinfo_max_freq", 0);
+    if (max_khz <= 0) return 1.0;
+    const long cur_khz = Impl::frequency_dispatch_read(
+        "/sys/devices/system/cpu/cpu0/cpufreq/scaling_cur_freq", max_khz);
+    const double r = double(cur_khz) / double(max_khz);
+    return r < 1.0 ? r : 1.0;
+  }
+
+  //! Take a sample, fold it into the average, return the average.
+  double residency() {
+    m_residency += m_alpha * (sample() - m_residency);
+    return m_residency;
+  }
+};
+
+/** \brief  Dispatch between a wide-vector and a scalar variant of a
+ *          kernel based on observed clock residency.
+ *
+ *  Construct one dispatcher per registered kernel and keep it across
+ *  launches; it owns the kernel's monitor state and a hysteresis band
+ *  so the choice does not oscillate at the threshold:
+ *
+ *  \code
+ *    static Kokkos::Experimental::ThrottleDispatch dispatch;
+ *    dispatch.parallel_for("axpy", policy, wide_op, scalar_op);
+ *  \endcode
+ *
+ *  The wide variant runs while smoothed residency is at or above
+ *  wide_threshold; once it drops below scalar_threshold the scalar
+ *  variant takes over until residency climbs back above wide_threshold.
+ *  Both functors must accept the policy's work items; they are
+ *  alternative bodies of the same kernel, so either may run for any
+ *  launch.
+ */
+class ThrottleDispatch {
+ private:
+  FrequencyMonitor m_monitor;
+  double m_wide_threshold;
+  double m_scalar_threshold;
+  bool m_wide;
+
+ public:
+  explicit ThrottleDispatch(const double wide_threshold   = 0.95,
+                            const double scalar_threshold = 0.85)
+      : m_monitor(),
+        m_wide_threshold(wide_threshold),
+        m_scalar_threshold(scalar_threshold),
+        m_wide(true) {}
+
+  //! Update the residency average and the hysteresis state.
+  bool prefer_wide() {
+    const double r = m_monitor.residency();
+    if (m_wide) {
+      if (r < m_scalar_threshold) m_wide = false;
+    } else {
+      if (m_wide_threshold <= r) m_wide = true;
+    }
+    return m_wide;
+  }
+
+  //! The variant the last prefer_wide() selected, without sampling.
+  bool wide_selected() const { return m_wide; }
+
+  template <class PolicyType, class WideFunctor, class ScalarFunctor>
+  void parallel_for(const std::string& label, const PolicyType& policy,
+                    const WideFunctor& wide, const ScalarFunctor& scalar) {
+    if (prefer_wide()) {
+      Kokkos::parallel_for(label + " [wide]", policy, wide);
+    } else {
+      Kokkos::parallel_for(label + " [scalar]", policy, scalar);
+    }
+  }
+
+  template <class PolicyType, class WideFunctor, class ScalarFunctor,
+            class ReturnType>
+  void parallel_reduce(const std::string& label, const PolicyType& policy,
+                       const WideFunctor& wide, const ScalarFunctor& scalar,
+                       ReturnType& result) {
+    if (prefer_wide()) {
+      Kokkos::parallel_reduce(label + " [wide]", policy, wide, result);
+    } else {
+      Kokkos::parallel_reduce(label + " [scalar]", policy, scalar, result);
+    }
+  }
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_FREQUENCYDISPATCH_HPP */
@@ -50,6 +50,9 @@
 
 #include <Kokkos_HostSpace.hpp>
 
+#include <cstdint>
+#include <string>
+
 namespace Kokkos {
 
 namespace Experimental {
@@ -87,6 +90,19 @@ void unlock_address_hbw_space(void* ptr);
 
 namespace Kokkos {
 
+namespace Experimental {
+class HBWSpace;
+}  // namespace Experimental
+
+namespace Impl {
+Kokkos::Experimental::HBWSpace with_huge_pages(
+    const Kokkos::Experimental::HBWSpace&);
+}  // namespace Impl
+
+}  // namespace Kokkos
+
+namespace Kokkos {
+
 namespace Experimental {
 
 /// \class HBWSpace
@@ -157,10 +173,80 @@ class HBWSpace {
 
  private:
   AllocationMechanism m_alloc_mech;
+  bool m_huge_pages = false;
   friend class Kokkos::Impl::SharedAllocationRecord<
       Kokkos::Experimental::HBWSpace, void>;
+  friend Kokkos::Experimental::HBWSpace Kokkos::Impl::with_huge_pages(
+      const Kokkos::Experimental::HBWSpace&);
 };
 
+//----------------------------------------------------------------------------
+// Managed DDR-to-HBW promotion.
+//
+// Static placement in HBWSpace requires deciding at allocation time
+// which arrays deserve the limited high-bandwidth capacity.  The
+// managed mode inverts this: arrays are allocated in ordinary DDR
+// HostSpace, registered for tracking, and charged with the bytes each
+// kernel streams through them; at a phase boundary
+// hbw_managed_migrate() promotes the most heavily trafficked arrays
+// into high-bandwidth memory, within a caller-specified capacity, by
+// moving their pages to the HBW NUMA node.  The virtual addresses do
+// not change, so live Views remain valid across promotion.  Promotion
+// works at page granularity: the partial first and last page of an
+// allocation stay in DDR.
+
+/** \brief  Register a DDR allocation as a candidate for promotion. */
+void hbw_managed_track(const void* ptr, const size_t bytes,
+                       const std::string& label);
+
+/** \brief  Remove an allocation from promotion tracking, e.g. before
+ *          it is deallocated. */
+void hbw_managed_untrack(const void* ptr);
+
+/** \brief  Charge bytes_touched bytes of traffic to a tracked
+ *          allocation.
+ *
+ *  Call at kernel boundaries with the bytes the kernel streamed
+ *  through the array; one call per kernel keeps the sampling cost
+ *  negligible.
+ */
+void hbw_managed_access(const void* ptr, const uint64_t bytes_touched);
+
+/** \brief  Promote the hottest tracked allocations to high-bandwidth
+ *          memory.
+ *
+ *  Orders the not-yet-promoted tracked allocations by accumulated
+ *  traffic and moves their pages to the HBW NUMA node until
+ *  capacity_bytes of total promoted data is reached.  Intended to be
+ *  called at a phase boundary, after the access counters reflect a
+ *  representative sample.  Returns the number of bytes promoted by
+ *  this call; returns zero when the HBW node cannot be identified.
+ */
+size_t hbw_managed_migrate(const size_t capacity_bytes);
+
+/** \brief  Zero the access counters of all tracked allocations. */
+void hbw_managed_reset();
+
+/** \brief  Total bytes currently promoted to high-bandwidth memory. */
+size_t hbw_managed_promoted_bytes();
+
+/** \brief  Register a View's allocation as a candidate for promotion. */
+template <class ViewType>
+inline void hbw_managed_track(const ViewType& view) {
+  hbw_managed_track(view.data(),
+                    view.span() * sizeof(typename ViewType::value_type),
+                    view.label());
+}
+
+/** \brief  Charge one full sweep over a View to its access counter. */
+template <class ViewType>
+inline void hbw_managed_access(const ViewType& view,
+                               const uint64_t sweeps = 1) {
+  hbw_managed_access(
+      view.data(),
+      sweeps * view.span() * sizeof(typename ViewType::value_type));
+}
+
 }  // namespace Experimental
 
 }  // namespace Kokkos
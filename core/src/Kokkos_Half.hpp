@@ -0,0 +1,326 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_Half.hpp
+/// \brief Reduced-precision floating point scalar types.
+///
+/// Declares Kokkos::Experimental::half_t (IEEE 754 binary16) and
+/// Kokkos::Experimental::bhalf_t (bfloat16) for use as View value types.
+
+#ifndef KOKKOS_HALF_HPP
+#define KOKKOS_HALF_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_NumericTraits.hpp>
+
+#include <cstdint>
+#include <iosfwd>
+#include <type_traits>
+
+namespace Kokkos {
+namespace Experimental {
+
+namespace Impl {
+
+/* Bit-level float <-> binary16 conversion with round-to-nearest-even.
+ * This is the portable software path; backends with native half
+ * arithmetic can specialize the storage formats below without touching
+ * the wrapper type. */
+
+union FloatBits {
+  float f;
+  uint32_t u;
+};
+
+struct half_format {
+  KOKKOS_INLINE_FUNCTION
+  static uint16_t to_bits(const float v) {
+    FloatBits b;
+    b.f                   = v;
+    const uint16_t sign   = static_cast<uint16_t>((b.u >> 16) & 0x8000u);
+    const uint32_t f_exp  = (b.u >> 23) & 0xffu;
+    uint32_t m            = b.u & 0x7fffffu;
+    const int32_t e       = static_cast<int32_t>(f_exp) - 127 + 15;
+    if (f_exp == 0xffu) {  // infinity or NaN; keep NaNs quiet
+      return sign | 0x7c00u | (m != 0 ? 0x200u : 0u);
+    }
+    if (e >= 0x1f) {  // overflow to infinity
+      return sign | 0x7c00u;
+    }
+    if (e <= 0) {  // subnormal half or underflow to zero
+      if (e < -10) return sign;
+      m |= 0x800000u;
+      const uint32_t shift = static_cast<uint32_t>(14 - e);
+      uint16_t h           = static_cast<uint16_t>(m >> shift);
+      const uint32_t rem   = m & ((1u << shift) - 1u);
+      const uint32_t mid   = 1u << (shift - 1);
+      if (rem > mid || (rem == mid && (h & 1u))) ++h;
+      return sign | h;
+    }
+    uint16_t h = static_cast<uint16_t>(
+        sign | (static_cast<uint32_t>(e) << 10) | (m >> 13));
+    const uint32_t rem = m & 0x1fffu;
+    // rounding may carry into the exponent, which yields the correct
+    // next-larger representable value (or infinity) by construction
+    if (rem > 0x1000u || (rem == 0x1000u && (h & 1u))) ++h;
+    return h;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  static float from_bits(const uint16_t h) {
+    const uint32_t s = static_cast<uint32_t>(h & 0x8000u) << 16;
+    const uint32_t e = (h >> 10) & 0x1fu;
+    uint32_t m       = h & 0x3ffu;
+    FloatBits b;
+    if (e == 0x1fu) {  // infinity or NaN
+      b.u = s | 0x7f800000u | (m << 13);
+    } else if (e != 0u) {  // normal
+      b.u = s | ((e + 112u) << 23) | (m << 13);
+    } else if (m != 0u) {  // subnormal
+      uint32_t k = 0;
+      while (!(m & 0x400u)) {
+        m <<= 1;
+        ++k;
+      }
+      m &= 0x3ffu;
+      b.u = s | ((113u - k) << 23) | (m << 13);
+    } else {  // zero
+      b.u = s;
+    }
+    return b.f;
+  }
+};
+
+/* bfloat16 is the upper half of a float, so conversion is a
+ * round-to-nearest-even truncation and widening is a shift. */
+struct bhalf_format {
+  KOKKOS_INLINE_FUNCTION
+  static uint16_t to_bits(const float v) {
+    FloatBits b;
+    b.f = v;
+    if ((b.u & 0x7f800000u) == 0x7f800000u) {  // infinity or NaN
+      return static_cast<uint16_t>((b.u >> 16) | (b.u & 0x7fffffu ? 0x40u : 0u));
+    }
+    const uint32_t bias = 0x7fffu + ((b.u >> 16) & 1u);
+    return static_cast<uint16_t>((b.u + bias) >> 16);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  static float from_bits(const uint16_t h) {
+    FloatBits b;
+    b.u = static_cast<uint32_t>(h) << 16;
+    return b.f;
+  }
+};
+
+/** \brief  16-bit storage type that computes through float.
+ *
+ *  The wrapper converts implicitly to and from float, so mixed
+ *  expressions promote to float arithmetic and the generic ViewCopy /
+ *  ViewFill kernels fuse the narrowing conversion into the copy pass:
+ *  deep_copy of a View<float*> into a View<half_t*> is a single
+ *  bandwidth-bound kernel with no staging buffer.
+ */
+template <class Format>
+class floating_point_wrapper {
+ private:
+  uint16_t m_bits;
+
+ public:
+  floating_point_wrapper() = default;
+
+  KOKKOS_INLINE_FUNCTION
+  floating_point_wrapper(const float val) : m_bits(Format::to_bits(val)) {}
+
+  KOKKOS_INLINE_FUNCTION
+  floating_point_wrapper(const double val)
+      : m_bits(Format::to_bits(static_cast<float>(val))) {}
+
+  template <class T, typename std::enable_if<std::is_integral<T>::value,
+                                             int>::type = 0>
+  KOKKOS_INLINE_FUNCTION floating_point_wrapper(const T val)
+      : m_bits(Format::to_bits(static_cast<float>(val))) {}
+
+  // The only implicit conversion is to float: a second implicit
+  // conversion to double would make every mixed arithmetic expression
+  // ambiguous.  Widening to double still works through float.
+  KOKKOS_INLINE_FUNCTION
+  operator float() const { return Format::from_bits(m_bits); }
+
+  KOKKOS_INLINE_FUNCTION
+  floating_point_wrapper& operator=(const float val) {
+    m_bits = Format::to_bits(val);
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  floating_point_wrapper& operator=(const double val) {
+    m_bits = Format::to_bits(static_cast<float>(val));
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator=(const floating_point_wrapper& src) volatile {
+    m_bits = src.m_bits;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  floating_point_wrapper& operator=(const floating_point_wrapper& src) {
+    m_bits = src.m_bits;
+    return *this;
+  }
+
+  floating_point_wrapper(const floating_point_wrapper&) = default;
+
+  KOKKOS_INLINE_FUNCTION
+  floating_point_wrapper& operator+=(const float val) {
+    m_bits = Format::to_bits(Format::from_bits(m_bits) + val);
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  floating_point_wrapper& operator-=(const float val) {
+    m_bits = Format::to_bits(Format::from_bits(m_bits) - val);
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  floating_point_wrapper& operator*=(const float val) {
+    m_bits = Format::to_bits(Format::from_bits(m_bits) * val);
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  floating_point_wrapper& operator/=(const float val) {
+    m_bits = Format::to_bits(Format::from_bits(m_bits) / val);
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  floating_point_wrapper operator-() const {
+    return floating_point_wrapper(-Format::from_bits(m_bits));
+  }
+
+  //! Raw storage access, for interoperability with external fp16 buffers
+  KOKKOS_INLINE_FUNCTION
+  uint16_t bits() const { return m_bits; }
+
+  KOKKOS_INLINE_FUNCTION
+  static floating_point_wrapper from_bits(const uint16_t bits) {
+    floating_point_wrapper r;
+    r.m_bits = bits;
+    return r;
+  }
+};
+
+}  // namespace Impl
+
+typedef Impl::floating_point_wrapper<Impl::half_format> half_t;
+typedef Impl::floating_point_wrapper<Impl::bhalf_format> bhalf_t;
+
+KOKKOS_INLINE_FUNCTION
+half_t cast_to_half(const float val) { return half_t(val); }
+
+KOKKOS_INLINE_FUNCTION
+half_t cast_to_half(const double val) { return half_t(val); }
+
+template <class T>
+KOKKOS_INLINE_FUNCTION T cast_from_half(const half_t val) {
+  return static_cast<T>(static_cast<float>(val));
+}
+
+KOKKOS_INLINE_FUNCTION
+bhalf_t cast_to_bhalf(const float val) { return bhalf_t(val); }
+
+KOKKOS_INLINE_FUNCTION
+bhalf_t cast_to_bhalf(const double val) { return bhalf_t(val); }
+
+template <class T>
+KOKKOS_INLINE_FUNCTION T cast_from_bhalf(const bhalf_t val) {
+  return static_cast<T>(static_cast<float>(val));
+}
+
+template <class Format>
+std::ostream& operator<<(
+    std::ostream& os, const Impl::floating_point_wrapper<Format>& val) {
+  return os << static_cast<float>(val);
+}
+
+}  // namespace Experimental
+
+template <>
+struct reduction_identity<Kokkos::Experimental::half_t> {
+  KOKKOS_FORCEINLINE_FUNCTION static Kokkos::Experimental::half_t sum() {
+    return Kokkos::Experimental::half_t(0.0f);
+  }
+  KOKKOS_FORCEINLINE_FUNCTION static Kokkos::Experimental::half_t prod() {
+    return Kokkos::Experimental::half_t(1.0f);
+  }
+  KOKKOS_FORCEINLINE_FUNCTION static Kokkos::Experimental::half_t max() {
+    return Kokkos::Experimental::half_t(-65504.0f);
+  }
+  KOKKOS_FORCEINLINE_FUNCTION static Kokkos::Experimental::half_t min() {
+    return Kokkos::Experimental::half_t(65504.0f);
+  }
+};
+
+template <>
+struct reduction_identity<Kokkos::Experimental::bhalf_t> {
+  KOKKOS_FORCEINLINE_FUNCTION static Kokkos::Experimental::bhalf_t sum() {
+    return Kokkos::Experimental::bhalf_t(0.0f);
+  }
+  KOKKOS_FORCEINLINE_FUNCTION static Kokkos::Experimental::bhalf_t prod() {
+    return Kokkos::Experimental::bhalf_t(1.0f);
+  }
+  KOKKOS_FORCEINLINE_FUNCTION static Kokkos::Experimental::bhalf_t max() {
+    return Kokkos::Experimental::bhalf_t(-3.38953139e38f);
+  }
+  KOKKOS_FORCEINLINE_FUNCTION static Kokkos::Experimental::bhalf_t min() {
+    return Kokkos::Experimental::bhalf_t(3.38953139e38f);
+  }
+};
+
+}  // namespace Kokkos
+
+#endif  // KOKKOS_HALF_HPP
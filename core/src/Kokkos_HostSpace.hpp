@@ -45,6 +45,7 @@
 #ifndef KOKKOS_HOSTSPACE_HPP
 #define KOKKOS_HOSTSPACE_HPP
 
+#include <cstdint>
 #include <cstring>
 #include <string>
 #include <iosfwd>
@@ -153,7 +154,8 @@ class HostSpace {
     STD_MALLOC,
     POSIX_MEMALIGN,
     POSIX_MMAP,
-    INTEL_MM_ALLOC
+    INTEL_MM_ALLOC,
+    POSIX_MMAP_HUGETLB
   };
 
   explicit HostSpace(const AllocationMechanism&);
@@ -167,6 +169,9 @@ class HostSpace {
   /**\brief Return Name of the MemorySpace */
   static constexpr const char* name() { return m_name; }
 
+  /**\brief  Largest number of bytes ever simultaneously live in this space */
+  static uint64_t high_water_mark();
+
  private:
   AllocationMechanism m_alloc_mech;
   static constexpr const char* m_name = "Host";
@@ -177,6 +182,40 @@ class HostSpace {
 
 //----------------------------------------------------------------------------
 
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  Pin an externally-owned host buffer for fast device transfer.
+ *
+ *  Buffers received from outside Kokkos (MPI, I/O layers) and wrapped
+ *  as unmanaged HostSpace Views transfer to device at pageable-memory
+ *  speed.  register_pinned page-locks [arg_ptr, arg_ptr + arg_bytes)
+ *  with the attached device runtime so subsequent deep_copy traffic
+ *  through the buffer runs at full transfer rate without a staging
+ *  copy.  Registrations are tracked by base pointer with a reference
+ *  count: registering the same base again increments the count, and
+ *  the region is unpinned when unregister_pinned brings it back to
+ *  zero.  The caller retains ownership and must unregister before
+ *  freeing the buffer.
+ *
+ *  Returns true when the buffer is pinned; false (without error) when
+ *  no device runtime with host registration is enabled.
+ */
+bool register_pinned(const void* arg_ptr, const size_t arg_bytes);
+
+/** \brief  Decrement the registration count of a buffer pinned with
+ *          register_pinned, unpinning it at zero.
+ *
+ *  arg_ptr must be the base pointer of a registered region.  Returns
+ *  true when the pointer was found.
+ */
+bool unregister_pinned(const void* arg_ptr);
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+//----------------------------------------------------------------------------
+
 namespace Kokkos {
 
 namespace Impl {
@@ -312,6 +351,30 @@ struct DeepCopy<HostSpace, HostSpace, ExecutionSpace> {
   }
 };
 
+//----------------------------------------------------------------------------
+// Pitched (2D) copies: 'rows' runs of 'width' contiguous bytes whose
+// starting addresses advance by a constant byte pitch on each side.
+// Available only for memory-space pairs that have a bulk 2D engine;
+// deep_copy uses these to avoid element-wise kernels for strided slabs.
+
+template <class DstMemorySpace, class SrcMemorySpace>
+struct deep_copy_2d_available : std::false_type {};
+
+template <class DstMemorySpace, class SrcMemorySpace>
+struct DeepCopy2D;
+
+template <>
+struct deep_copy_2d_available<HostSpace, HostSpace> : std::true_type {};
+
+template <>
+struct DeepCopy2D<HostSpace, HostSpace> {
+  DeepCopy2D(void* dst, size_t dst_pitch, const void* src, size_t src_pitch,
+             size_t width, size_t rows) {
+    hostspace_parallel_deepcopy_2d(dst, dst_pitch, src, src_pitch, width,
+                                   rows);
+  }
+};
+
 }  // namespace Impl
 
 }  // namespace Kokkos
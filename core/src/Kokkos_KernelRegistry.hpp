@@ -0,0 +1,180 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_KernelRegistry.hpp
+/// \brief Ahead-of-time compiled launches for hot kernels.
+///
+/// Every parallel_for call site instantiates the full ParallelFor
+/// driver stack for its (functor, policy) pair, and in large
+/// applications those instantiations dominate rebuild time.  The
+/// kernel registry moves the instantiation into one dedicated
+/// translation unit, compiled once into the application's kernel
+/// library: KOKKOS_REGISTERED_PARALLEL_FOR_INST in that unit defines a
+/// stable entry point, KOKKOS_REGISTERED_PARALLEL_FOR_DECL in a shared
+/// header declares it, and call sites go through
+/// Kokkos::Experimental::registered_parallel_for - which resolves to
+/// the precompiled symbol at link time and instantiates nothing.
+///
+/// This extends the ViewCopy ETI pattern (eti/common, eti/user) from
+/// the library's own copy kernels to application functors.  Because
+/// the registered definition runs the ordinary parallel_for, profiling
+/// hooks, naming, and fencing behave exactly as for an inline launch.
+///
+/// Usage - in a header shared by the kernel library and the app:
+///
+///   KOKKOS_REGISTERED_PARALLEL_FOR_DECL(MyFunctor, Kokkos::RangePolicy<>)
+///
+/// in the kernel library translation unit:
+///
+///   KOKKOS_REGISTERED_PARALLEL_FOR_INST("my_kernel", MyFunctor,
+///                                       Kokkos::RangePolicy<>)
+///
+/// at the call site:
+///
+///   Kokkos::Experimental::registered_parallel_for(policy, functor);
+///
+/// The policy is the trailing macro argument so policy types containing
+/// commas need no wrapping; use a typedef for functor types that
+/// contain commas.
+
+#ifndef KOKKOS_KERNELREGISTRY_HPP
+#define KOKKOS_KERNELREGISTRY_HPP
+
+#include <Kokkos_Macros.hpp>
+
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  Entry-point holder for a precompiled kernel launch.
+ *
+ *  The launch member is only ever explicitly specialized - by the
+ *  DECL macro as a declaration in application code and by the INST
+ *  macro as a definition in the kernel library - so including this
+ *  header instantiates nothing.
+ */
+template <class FunctorType, class Policy, class ResultType = void>
+struct RegisteredKernel {
+  static void launch(const Policy&, const FunctorType&, ResultType&);
+};
+
+template <class FunctorType, class Policy>
+struct RegisteredKernel<FunctorType, Policy, void> {
+  static void launch(const Policy&, const FunctorType&);
+};
+
+/** \brief  Launch a kernel registered with
+ *          KOKKOS_REGISTERED_PARALLEL_FOR_INST.  Fails at link time if
+ *          the (functor, policy) pair was never registered.
+ */
+template <class Policy, class FunctorType>
+inline void registered_parallel_for(const Policy& policy,
+                                    const FunctorType& functor) {
+  RegisteredKernel<FunctorType, Policy, void>::launch(policy, functor);
+}
+
+/** \brief  Launch a reduction registered with
+ *          KOKKOS_REGISTERED_PARALLEL_REDUCE_INST.  The result type
+ *          must match the registered one exactly.
+ */
+template <class Policy, class FunctorType, class ResultType>
+inline void registered_parallel_reduce(const Policy& policy,
+                                       const FunctorType& functor,
+                                       ResultType& result) {
+  RegisteredKernel<FunctorType, Policy, ResultType>::launch(policy, functor,
+                                                            result);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+/** \brief  Declare the precompiled entry point; goes in a header
+ *          included by both the kernel library and the application.
+ */
+#define KOKKOS_REGISTERED_PARALLEL_FOR_DECL(FUNCTOR, /*POLICY*/...)    \
+  namespace Kokkos {                                                   \
+  namespace Experimental {                                             \
+  template <>                                                          \
+  void RegisteredKernel<FUNCTOR, __VA_ARGS__, void>::launch(           \
+      const __VA_ARGS__&, const FUNCTOR&);                             \
+  }                                                                    \
+  }
+
+/** \brief  Define the precompiled entry point; goes in the kernel
+ *          library translation unit.  LABEL names the kernel for
+ *          profiling tools.
+ */
+#define KOKKOS_REGISTERED_PARALLEL_FOR_INST(LABEL, FUNCTOR, /*POLICY*/...) \
+  namespace Kokkos {                                                       \
+  namespace Experimental {                                                 \
+  template <>                                                              \
+  void RegisteredKernel<FUNCTOR, __VA_ARGS__, void>::launch(               \
+      const __VA_ARGS__& policy, const FUNCTOR& functor) {                 \
+    Kokkos::parallel_for(LABEL, policy, functor);                          \
+  }                                                                        \
+  }                                                                        \
+  }
+
+#define KOKKOS_REGISTERED_PARALLEL_REDUCE_DECL(FUNCTOR, RESULT,        \
+                                               /*POLICY*/...)          \
+  namespace Kokkos {                                                   \
+  namespace Experimental {                                             \
+  template <>                                                          \
+  void RegisteredKernel<FUNCTOR, __VA_ARGS__, RESULT>::launch(         \
+      const __VA_ARGS__&, const FUNCTOR&, RESULT&);                    \
+  }                                                                    \
+  }
+
+#define KOKKOS_REGISTERED_PARALLEL_REDUCE_INST(LABEL, FUNCTOR, RESULT,     \
+                                               /*POLICY*/...)              \
+  namespace Kokkos {                                                       \
+  namespace Experimental {                                                 \
+  template <>                                                              \
+  void RegisteredKernel<FUNCTOR, __VA_ARGS__, RESULT>::launch(             \
+      const __VA_ARGS__& policy, const FUNCTOR& functor, RESULT& result) { \
+    Kokkos::parallel_reduce(LABEL, policy, functor, result);               \
+  }                                                                        \
+  }                                                                        \
+  }
+
+#endif /* #ifndef KOKKOS_KERNELREGISTRY_HPP */
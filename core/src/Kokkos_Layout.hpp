@@ -244,8 +244,13 @@ struct LayoutTileLeft {
 
 enum class Iterate {
   Default,
-  Left,  // Left indices stride fastest
-  Right  // Right indices stride fastest
+  Left,   // Left indices stride fastest
+  Right,  // Right indices stride fastest
+  Morton  // Bit-interleaved (Z-order) walk within an MDRangePolicy tile.
+          // Keeps successive iterations inside a small multi-dimensional
+          // neighborhood whichever operand layout dominates; honored by the
+          // host backends for rank-2 and rank-3 tiles, any other
+          // configuration falls back to Right.
 };
 
 // To check for LayoutTiled
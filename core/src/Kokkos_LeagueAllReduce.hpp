@@ -0,0 +1,201 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_LeagueAllReduce.hpp
+/// \brief League-scope allreduce collective callable inside a team kernel.
+///
+/// An iterative kernel that must normalize by a league-wide quantity is
+/// usually written as a parallel_reduce, a host fence, and a second
+/// parallel_for - two kernel round trips per sweep.  A LeagueAllReduce
+/// fuses the reduce and the broadcast into one collective call inside a
+/// single launch: each team contributes one value per call, the last
+/// team to arrive combines the contributions and publishes the total,
+/// and every caller returns it, so a sweep is one launch and zero
+/// fences.
+///
+/// The collective requires every league rank to be executing
+/// concurrently - teams that are not yet resident cannot contribute and
+/// the resident teams would spin forever.  Size the league with
+/// max_league_size(), which on host backends is exact (the thread pool
+/// partitioned into teams) and on devices is an occupancy upper bound
+/// to stay safely below.
+
+#ifndef KOKKOS_LEAGUEALLREDUCE_HPP
+#define KOKKOS_LEAGUEALLREDUCE_HPP
+
+#include <Kokkos_Core_fwd.hpp>
+#include <Kokkos_View.hpp>
+#include <Kokkos_Atomic.hpp>
+
+#include <string>
+
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  Reduce-then-broadcast collective across the league of one
+ *          team launch.
+ *
+ *  Construct on the host with the league size of the launch, copy into
+ *  the functor by value like a View, and call sum() (or reduce() with a
+ *  binary operation) from every team.  Calls from different teams pair
+ *  up by arrival order, so every team must make the same sequence of
+ *  collective calls; rounds are separated by a generation counter and a
+ *  launch may perform any number of them.
+ *
+ *  Each team deposits its contribution in a per-rank slot, so the value
+ *  type only needs copy assignment - no atomic support - and
+ *  non-commutative operations see the slots in league-rank order.
+ */
+template <class ValueType, class Space = Kokkos::DefaultExecutionSpace>
+class LeagueAllReduce {
+ public:
+  typedef ValueType value_type;
+  typedef typename Space::execution_space execution_space;
+  typedef typename Space::memory_space memory_space;
+
+ private:
+  struct Control {
+    value_type result;
+    int arrived;
+    int generation;
+  };
+
+  Kokkos::View<value_type*, memory_space> m_slot;
+  Kokkos::View<Control, memory_space> m_control;
+  int m_league_size;
+
+  struct SumOp {
+    KOKKOS_INLINE_FUNCTION
+    value_type operator()(const value_type& a, const value_type& b) const {
+      return a + b;
+    }
+  };
+
+ public:
+  LeagueAllReduce() : m_slot(), m_control(), m_league_size(0) {}
+
+  LeagueAllReduce(const std::string& arg_label, const int arg_league_size)
+      : m_slot(arg_label, arg_league_size),
+        m_control(arg_label),
+        m_league_size(arg_league_size) {}
+
+  /// \brief League size the collective was constructed for.
+  KOKKOS_INLINE_FUNCTION
+  int league_size() const { return m_league_size; }
+
+  /** \brief  Largest league that can be concurrently resident with the
+   *          given team size, and therefore safely call the collective.
+   *
+   *  Exact for host backends; on devices occupancy limits (registers,
+   *  shared memory) may reduce residency further, so stay below it.
+   */
+  static int max_league_size(const int team_size) {
+    return execution_space::concurrency() / (team_size < 1 ? 1 : team_size);
+  }
+
+  /** \brief  Combine one contribution per team with \c op and return
+   *          the league-wide total to every caller.  Blocks until all
+   *          league ranks of the round have arrived.
+   */
+  template <class Member, class BinaryOp>
+  KOKKOS_INLINE_FUNCTION value_type reduce(const Member& member,
+                                           const value_type& contribution,
+                                           const BinaryOp& op) const {
+    value_type total = contribution;
+
+    Kokkos::single(
+        Kokkos::PerTeam(member),
+        [&](value_type& val) {
+          volatile Control& control = m_control();
+
+          // The generation can only advance after this team arrives,
+          // so the pre-arrival read pins this call to its round.
+          const int gen = control.generation;
+
+          m_slot(member.league_rank()) = contribution;
+          Kokkos::memory_fence();
+
+          const int arrived = Kokkos::atomic_fetch_add(&m_control().arrived, 1);
+
+          if (arrived == m_league_size - 1) {
+            // Last team closes the round: the league is small enough to
+            // be resident, so a serial join over the slots is cheap.
+            value_type joined = m_slot(0);
+            for (int r = 1; r < m_league_size; ++r) {
+              joined = op(joined, m_slot(r));
+            }
+            m_control().result  = joined;
+            m_control().arrived = 0;
+            Kokkos::memory_fence();
+            control.generation = gen + 1;
+          } else {
+            // Every other resident team is a few instructions from its
+            // own arrival, so spin rather than yield.
+            while (control.generation == gen) {
+            }
+          }
+
+          // The result slot is not overwritten until every team has
+          // arrived in the next round, which follows this read in each
+          // team's program order.
+          Kokkos::memory_fence();
+          val = m_control().result;
+        },
+        total);
+
+    return total;
+  }
+
+  /// \brief League-wide sum of one contribution per team.
+  template <class Member>
+  KOKKOS_INLINE_FUNCTION value_type sum(const Member& member,
+                                        const value_type& contribution) const {
+    return reduce(member, contribution, SumOp());
+  }
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_LEAGUEALLREDUCE_HPP */
@@ -0,0 +1,193 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_LeagueOrdering.hpp
+/// \brief Locality-preserving league-rank to tile-coordinate maps.
+///
+/// TeamPolicy league ranks map linearly onto a team grid, so over a
+/// structured spatial domain consecutive teams own distant tiles:
+/// concurrently resident teams share no cache lines, wasting L2 on
+/// devices and NUMA locality on host.  MortonLeague remaps league
+/// ranks along a Morton (Z-order) curve so that nearby ranks - which
+/// tend to be resident together - own spatially adjacent tiles and
+/// their halos overlap in cache.
+///
+/// The map handles arbitrary (non-power-of-two) league shapes by
+/// precomputing the permutation on the host: tile coordinates are
+/// sorted by Morton code and stored in a device-resident table, one
+/// entry per team, read once per team at kernel entry.  Usage:
+///
+///   Kokkos::Experimental::MortonLeague<> map(nx, ny);
+///   Kokkos::TeamPolicy<> policy(map.league_size(), Kokkos::AUTO);
+///   ... inside the functor:
+///   int i, j;
+///   map(team.league_rank(), i, j);
+
+#ifndef KOKKOS_LEAGUEORDERING_HPP
+#define KOKKOS_LEAGUEORDERING_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_View.hpp>
+#include <Kokkos_CopyViews.hpp>
+#include <impl/Kokkos_Error.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace Kokkos {
+namespace Impl {
+
+// Spread the low 21 bits of x so consecutive bits land 3 apart
+// (for 3D interleave); the 2D interleave spaces them 2 apart.
+KOKKOS_INLINE_FUNCTION
+uint64_t morton_spread2(uint64_t x) {
+  x &= 0xFFFFFFFFull;
+  x = (x | (x << 16)) & 0x0000FFFF0000FFFFull;
+  x = (x | (x << 8)) & 0x00FF00FF00FF00FFull;
+  x = (x | (x << 4)) & 0x0F0F0F0F0F0F0F0Full;
+  x = (x | (x << 2)) & 0x3333333333333333ull;
+  x = (x | (x << 1)) & 0x5555555555555555ull;
+  return x;
+}
+
+KOKKOS_INLINE_FUNCTION
+uint64_t morton_spread3(uint64_t x) {
+  x &= 0x1FFFFFull;
+  x = (x | (x << 32)) & 0x001F00000000FFFFull;
+  x = (x | (x << 16)) & 0x001F0000FF0000FFull;
+  x = (x | (x << 8)) & 0x100F00F00F00F00Full;
+  x = (x | (x << 4)) & 0x10C30C30C30C30C3ull;
+  x = (x | (x << 2)) & 0x1249249249249249ull;
+  return x;
+}
+
+}  // namespace Impl
+
+namespace Experimental {
+
+/** \brief  Morton-ordered league-rank to tile-coordinate map for 2D
+ *          and 3D team grids.  Copyable into functors; reads one table
+ *          entry per lookup.
+ */
+template <class Device = Kokkos::DefaultExecutionSpace>
+class MortonLeague {
+ public:
+  typedef Device device_type;
+  typedef Kokkos::View<int* [3], typename Device::memory_space> coord_view;
+
+  MortonLeague() : m_coords(), m_size(0) {}
+
+  /** \brief  Map for an n0 x n1 league shape. */
+  MortonLeague(const int n0, const int n1) { build(n0, n1, 1); }
+
+  /** \brief  Map for an n0 x n1 x n2 league shape. */
+  MortonLeague(const int n0, const int n1, const int n2) { build(n0, n1, n2); }
+
+  /** \brief  Number of teams; pass as TeamPolicy league size. */
+  KOKKOS_INLINE_FUNCTION
+  int league_size() const { return m_size; }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int league_rank, int& i0, int& i1) const {
+    i0 = m_coords(league_rank, 0);
+    i1 = m_coords(league_rank, 1);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int league_rank, int& i0, int& i1, int& i2) const {
+    i0 = m_coords(league_rank, 0);
+    i1 = m_coords(league_rank, 1);
+    i2 = m_coords(league_rank, 2);
+  }
+
+ private:
+  void build(const int n0, const int n1, const int n2) {
+    if (n0 < 1 || n1 < 1 || n2 < 1) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Error: Kokkos::MortonLeague league extents must be positive");
+    }
+
+    m_size = n0 * n1 * n2;
+    m_coords =
+        coord_view(Kokkos::ViewAllocateWithoutInitializing(
+                       "Kokkos::MortonLeague::coords"),
+                   m_size);
+
+    // Sort all tile coordinates by Morton code; arbitrary shapes fall
+    // out naturally since only valid coordinates are enumerated.
+    std::vector<std::pair<uint64_t, int>> order;
+    order.reserve(m_size);
+    for (int i2 = 0; i2 < n2; ++i2)
+      for (int i1 = 0; i1 < n1; ++i1)
+        for (int i0 = 0; i0 < n0; ++i0) {
+          const uint64_t code =
+              1 < n2 ? (Kokkos::Impl::morton_spread3(i0) |
+                        (Kokkos::Impl::morton_spread3(i1) << 1) |
+                        (Kokkos::Impl::morton_spread3(i2) << 2))
+                     : (Kokkos::Impl::morton_spread2(i0) |
+                        (Kokkos::Impl::morton_spread2(i1) << 1));
+          order.emplace_back(code, (i2 * n1 + i1) * n0 + i0);
+        }
+    std::sort(order.begin(), order.end());
+
+    typename coord_view::HostMirror host_coords =
+        Kokkos::create_mirror_view(m_coords);
+    for (int rank = 0; rank < m_size; ++rank) {
+      const int linear        = order[rank].second;
+      host_coords(rank, 0)    = linear % n0;
+      host_coords(rank, 1)    = (linear / n0) % n1;
+      host_coords(rank, 2)    = linear / (n0 * n1);
+    }
+    Kokkos::deep_copy(m_coords, host_coords);
+  }
+
+  coord_view m_coords;
+  int m_size;
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_LEAGUEORDERING_HPP */
@@ -0,0 +1,195 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_MDRangeScan.hpp
+/// \brief Directional prefix scans over MDRangePolicy iteration spaces.
+///
+/// parallel_scan exists only for RangePolicy, so cumulative fields
+/// over multidimensional Views (summed-area tables, direction-split
+/// transport sweeps) get hand-flattened into 1D index arithmetic.
+/// The directional scan here runs an independent prefix scan along a
+/// chosen axis for every line of the iteration space, lines in
+/// parallel: one worker owns a whole line, so the scan along it is a
+/// single serial pass with the final-pass flag always set, exactly
+/// like the last pass of a RangePolicy scan.  The functor signature
+/// matches the RangePolicy scan convention with one index per rank:
+/// functor(i0, .., iN-1, update, final).
+
+#ifndef KOKKOS_MDRANGESCAN_HPP
+#define KOKKOS_MDRANGESCAN_HPP
+
+#include <Kokkos_Core_fwd.hpp>
+#include <Kokkos_Parallel.hpp>
+#include <KokkosExp_MDRangePolicy.hpp>
+#include <impl/Kokkos_Error.hpp>
+
+#include <string>
+
+namespace Kokkos {
+namespace Impl {
+
+template <class Policy, class FunctorType, class ValueType>
+struct MDRangeDirectionalScan {
+  enum { rank = static_cast<int>(Policy::rank) };
+
+  using index_type       = typename Policy::index_type;
+  using array_index_type = typename Policy::array_index_type;
+
+  FunctorType m_functor;
+  Kokkos::Array<array_index_type, rank> m_lower;
+  Kokkos::Array<array_index_type, rank> m_upper;
+  ValueType m_init;
+  int m_axis;
+
+  MDRangeDirectionalScan(const FunctorType& arg_functor, const Policy& policy,
+                         const int arg_axis, const ValueType& arg_init)
+      : m_functor(arg_functor),
+        m_lower(policy.m_lower),
+        m_upper(policy.m_upper),
+        m_init(arg_init),
+        m_axis(arg_axis) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void invoke(std::integral_constant<int, 2>,
+              const array_index_type idx[rank], ValueType& update) const {
+    m_functor(static_cast<index_type>(idx[0]),
+              static_cast<index_type>(idx[1]), update, true);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void invoke(std::integral_constant<int, 3>,
+              const array_index_type idx[rank], ValueType& update) const {
+    m_functor(static_cast<index_type>(idx[0]), static_cast<index_type>(idx[1]),
+              static_cast<index_type>(idx[2]), update, true);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void invoke(std::integral_constant<int, 4>,
+              const array_index_type idx[rank], ValueType& update) const {
+    m_functor(static_cast<index_type>(idx[0]), static_cast<index_type>(idx[1]),
+              static_cast<index_type>(idx[2]), static_cast<index_type>(idx[3]),
+              update, true);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t line) const {
+    // Decode the line id into the fixed indices of the non-scan
+    // dimensions, row-major over the remaining dims
+    array_index_type idx[rank];
+    int64_t rem = line;
+    for (int d = rank - 1; d >= 0; --d) {
+      if (d == m_axis) continue;
+      const int64_t extent = m_upper[d] - m_lower[d];
+      idx[d]               = m_lower[d] + static_cast<array_index_type>(
+                                              rem % extent);
+      rem /= extent;
+    }
+    ValueType update = m_init;
+    for (array_index_type i = m_lower[m_axis]; i < m_upper[m_axis]; ++i) {
+      idx[m_axis] = i;
+      invoke(std::integral_constant<int, rank>(), idx, update);
+    }
+  }
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+namespace Kokkos {
+namespace Experimental {
+
+/// \brief Prefix scan along one axis of an MDRangePolicy iteration
+///        space: every line along arg_axis is scanned independently,
+///        lines run in parallel.  update starts at arg_init on each
+///        line; the functor is always called with final == true.
+template <class... Properties, class FunctorType, class ValueType>
+void parallel_scan(const std::string& label,
+                   const Kokkos::MDRangePolicy<Properties...>& policy,
+                   const int arg_axis, const FunctorType& functor,
+                   const ValueType& arg_init) {
+  typedef Kokkos::MDRangePolicy<Properties...> policy_type;
+  typedef typename policy_type::execution_space execution_space;
+
+  constexpr int rank = static_cast<int>(policy_type::rank);
+  static_assert(rank >= 2 && rank <= 4,
+                "Kokkos::Experimental::parallel_scan (directional): only "
+                "rank-2 to rank-4 MDRangePolicy is supported");
+
+  if (arg_axis < 0 || arg_axis >= rank) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::parallel_scan (directional): axis out of "
+        "range");
+  }
+
+  int64_t num_lines = 1;
+  for (int d = 0; d < rank; ++d) {
+    const int64_t extent = policy.m_upper[d] - policy.m_lower[d];
+    if (extent <= 0) return;
+    if (d != arg_axis) num_lines *= extent;
+  }
+
+  Kokkos::Impl::MDRangeDirectionalScan<policy_type, FunctorType, ValueType>
+      closure(functor, policy, arg_axis, arg_init);
+  Kokkos::parallel_for(
+      label,
+      Kokkos::RangePolicy<execution_space, Kokkos::IndexType<int64_t>>(
+          0, num_lines),
+      closure);
+}
+
+/// \brief Directional scan with the initial value taken from the
+///        functor's value_type default; requires the functor to
+///        declare value_type.
+template <class... Properties, class FunctorType>
+void parallel_scan(const std::string& label,
+                   const Kokkos::MDRangePolicy<Properties...>& policy,
+                   const int arg_axis, const FunctorType& functor) {
+  parallel_scan(label, policy, arg_axis, functor,
+                typename FunctorType::value_type());
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_MDRANGESCAN_HPP */
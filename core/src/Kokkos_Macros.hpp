@@ -56,7 +56,8 @@
  *  KOKKOS_ENABLE_OPENMPTARGET        Kokkos::Experimental::OpenMPTarget
  * execution space KOKKOS_ENABLE_HWLOC               HWLOC library is available.
  *  KOKKOS_ENABLE_DEBUG_BOUNDS_CHECK  Insert array bounds checks, is expensive!
- *  KOKKOS_ENABLE_MPI                 Negotiate MPI/execution space
+ *  KOKKOS_ENABLE_DEBUG_BOUNDS_TRAP   Cheap span-granularity bounds check that
+ * aborts on violation. KOKKOS_ENABLE_MPI                 Negotiate MPI/execution space
  * interactions. KOKKOS_ENABLE_CUDA_UVM            Use CUDA UVM for Cuda memory
  * space.
  */
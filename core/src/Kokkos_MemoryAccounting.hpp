@@ -0,0 +1,141 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+/// \file Kokkos_MemoryAccounting.hpp
+/// \brief Aggregate allocation accounting per memory space.
+///
+/// While accounting is enabled, every allocation made through a
+/// SharedAllocationRecord is counted toward its memory space's
+/// live-byte and high-water-mark totals, and toward the innermost
+/// active allocation tag of the allocating thread.  Tags let a named
+/// application phase (a solver setup, a halo exchange) claim the
+/// allocations it makes, so that when a space hits its peak the owner
+/// of the peak can be identified without a heap profiler.
+///
+/// Accounting is off by default and costs the allocation path one
+/// relaxed atomic load; totals reflect only the activity between
+/// enable_memory_accounting and disable_memory_accounting.
+
+#ifndef KOKKOS_MEMORYACCOUNTING_HPP
+#define KOKKOS_MEMORYACCOUNTING_HPP
+
+#include <Kokkos_Macros.hpp>
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+namespace Kokkos {
+namespace Impl {
+
+/* Called from the SharedAllocationRecord constructors and destructors
+ * of every memory space; not a user-facing interface. */
+void account_allocation(const char* space_name, const std::string& label,
+                        const void* ptr, size_t size);
+void account_deallocation(const char* space_name, const void* ptr, size_t size);
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+namespace Kokkos {
+namespace Experimental {
+
+/// \brief Start counting allocations; off by default.
+void enable_memory_accounting();
+
+/// \brief Stop counting; accumulated totals remain queryable.
+void disable_memory_accounting();
+
+/// \brief Whether accounting is currently enabled.
+bool memory_accounting_enabled();
+
+/// \brief Bytes currently allocated in the memory space with this name.
+uint64_t memory_space_live_bytes(const char* space_name);
+
+/// \brief Largest value memory_space_live_bytes has ever reached.
+uint64_t memory_space_high_water_mark(const char* space_name);
+
+template <class MemorySpace>
+inline uint64_t memory_space_live_bytes() {
+  return memory_space_live_bytes(MemorySpace::name());
+}
+
+template <class MemorySpace>
+inline uint64_t memory_space_high_water_mark() {
+  return memory_space_high_water_mark(MemorySpace::name());
+}
+
+/// \brief Attribute subsequent allocations of this thread to a tag.
+///
+/// Tags nest; an allocation is charged to the innermost tag active on
+/// the allocating thread.  Attribution follows the allocation for its
+/// whole lifetime: bytes freed after the tag is popped are still
+/// subtracted from the tag's live total.
+void push_allocation_tag(const char* tag);
+void pop_allocation_tag();
+
+/// \brief Bytes live that were allocated under this tag.
+uint64_t allocation_tag_live_bytes(const char* tag);
+
+/// \brief Largest value allocation_tag_live_bytes has ever reached.
+uint64_t allocation_tag_high_water_mark(const char* tag);
+
+/// \brief Scope guard for push_allocation_tag / pop_allocation_tag.
+class AllocationTagScope {
+ public:
+  explicit AllocationTagScope(const char* tag) { push_allocation_tag(tag); }
+  ~AllocationTagScope() { pop_allocation_tag(); }
+
+  AllocationTagScope(const AllocationTagScope&) = delete;
+  AllocationTagScope& operator=(const AllocationTagScope&) = delete;
+};
+
+/// \brief Print live bytes and high-water marks per space and per tag.
+void print_memory_accounting(std::ostream& s);
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_MEMORYACCOUNTING_HPP */
@@ -168,6 +168,8 @@ class MemoryPool {
     size_t consumed_bytes;        ///<  Bytes allocated
     size_t reserved_blocks;  ///<  Unallocated blocks in assigned superblocks
     size_t reserved_bytes;   ///<  Unallocated bytes in assigned superblocks
+    size_t unassigned_superblocks;   ///<  Superblocks not assigned a size
+    size_t recoverable_superblocks;  ///<  Superblocks defragment() can free
   };
 
   void get_usage_statistics(usage_statistics &stats) const {
@@ -193,6 +195,15 @@ class MemoryPool {
     stats.consumed_bytes       = 0;
     stats.reserved_blocks      = 0;
     stats.reserved_bytes       = 0;
+    stats.unassigned_superblocks  = 0;
+    stats.recoverable_superblocks = 0;
+
+    // Per block-size tallies to compute how many superblocks a
+    // compaction could free: a size class occupying S superblocks for
+    // U used blocks of capacity C per superblock only needs
+    // ceil( U / C ) of them
+    size_t class_superblocks[32] = {};
+    size_t class_used_blocks[32] = {};
 
     const uint32_t *sb_state_ptr = sb_state_array;
 
@@ -210,6 +221,20 @@ class MemoryPool {
         stats.consumed_bytes += block_used * block_size;
         stats.reserved_blocks += block_count - block_used;
         stats.reserved_bytes += (block_count - block_used) * block_size;
+
+        class_superblocks[block_count_lg2]++;
+        class_used_blocks[block_count_lg2] += block_used;
+      } else if (0 == *sb_state_ptr) {
+        stats.unassigned_superblocks++;
+      }
+    }
+
+    for (uint32_t k = 1; k < 32; ++k) {
+      if (class_superblocks[k]) {
+        const size_t block_count = size_t(1) << k;
+        const size_t needed =
+            (class_used_blocks[k] + block_count - 1) >> k;
+        stats.recoverable_superblocks += class_superblocks[k] - needed;
       }
     }
 
@@ -257,6 +282,212 @@ class MemoryPool {
 
   //--------------------------------------------------------------------------
 
+  /**\brief  Return empty superblocks to the unassigned state.
+   *
+   *  A superblock keeps its block-size assignment after its last block
+   *  is deallocated, so a burst of one size can pin superblocks that a
+   *  later phase needs for another size.  Clearing the assignment lets
+   *  the allocation search claim them for any block size.
+   *
+   *  Requires: no concurrent allocate() or deallocate() calls.
+   *  Returns the number of superblocks released.
+   */
+  size_t release_empty_superblocks() const {
+    Kokkos::HostSpace host;
+
+    const size_t alloc_size = m_hint_offset * sizeof(uint32_t);
+
+    uint32_t *const sb_state_array =
+        accessible ? m_sb_state_array : (uint32_t *)host.allocate(alloc_size);
+
+    if (!accessible) {
+      Kokkos::Impl::DeepCopy<Kokkos::HostSpace, base_memory_space>(
+          sb_state_array, m_sb_state_array, alloc_size);
+    }
+
+    size_t released = 0;
+
+    for (int32_t i = 0; i < m_sb_count; ++i) {
+      uint32_t *const sb_state_ptr = sb_state_array + i * m_sb_state_size;
+      if ((*sb_state_ptr >> state_shift) &&
+          (0 == (*sb_state_ptr & state_used_mask))) {
+        *sb_state_ptr = 0;
+        ++released;
+      }
+    }
+
+    if (!accessible) {
+      Kokkos::Impl::DeepCopy<base_memory_space, Kokkos::HostSpace>(
+          m_sb_state_array, sb_state_array, alloc_size);
+      host.deallocate(sb_state_array, alloc_size);
+    } else {
+      Kokkos::memory_fence();
+    }
+
+    return released;
+  }
+
+  /**\brief  Compact live blocks into fewer superblocks.
+   *
+   *  Long-running mixed-size allocation patterns strand a few live
+   *  blocks in each superblock until the pool holds a multiple of its
+   *  live bytes.  For each block size the live blocks of the
+   *  least-populated superblocks are moved into the free slots of the
+   *  most-populated ones; each emptied superblock returns to the
+   *  unassigned state where any block size can claim it.  Every move
+   *  invokes
+   *
+   *      relocate( old_ptr , new_ptr , block_size_bytes )
+   *
+   *  on the host so the owner can redirect its references; the
+   *  pointers address pool (device) memory and the block contents have
+   *  already been copied when the callback runs.
+   *
+   *  Requires: no concurrent allocate() or deallocate() calls, and no
+   *  in-flight kernels reading pool allocations - a phase boundary.
+   *  Returns the number of superblocks freed.
+   */
+  template <typename RelocateFunctor>
+  size_t defragment(RelocateFunctor const &relocate) const {
+    Kokkos::HostSpace host;
+
+    const size_t state_size = m_hint_offset * sizeof(uint32_t);
+
+    uint32_t *const sb_state_array =
+        accessible ? m_sb_state_array : (uint32_t *)host.allocate(state_size);
+
+    if (!accessible) {
+      Kokkos::Impl::DeepCopy<Kokkos::HostSpace, base_memory_space>(
+          sb_state_array, m_sb_state_array, state_size);
+    }
+
+    char *const data_base = (char *)(m_sb_state_array + m_data_offset);
+
+    int32_t *const ids =
+        (int32_t *)host.allocate(m_sb_count * sizeof(int32_t));
+
+    const int32_t number_block_sizes =
+        1 + m_max_block_size_lg2 - m_min_block_size_lg2;
+
+    size_t freed = 0;
+
+    for (int32_t c = 0; c < number_block_sizes; ++c) {
+      const uint32_t block_size_lg2  = m_min_block_size_lg2 + c;
+      const uint32_t block_count_lg2 = m_sb_size_lg2 - block_size_lg2;
+
+      // One-block superblocks share the zero state header with
+      // unassigned superblocks and cannot be compacted anyway
+      if (0 == block_count_lg2) continue;
+
+      const uint32_t block_count = 1u << block_count_lg2;
+      const uint32_t block_state = block_count_lg2 << state_shift;
+
+      // Superblocks of this size, most-populated first
+      int32_t n = 0;
+      for (int32_t i = 0; i < m_sb_count; ++i) {
+        if (block_state ==
+            (sb_state_array[i * m_sb_state_size] & state_header_mask)) {
+          ids[n++] = i;
+        }
+      }
+      for (int32_t i = 1; i < n; ++i)
+        for (int32_t j = i;
+             j > 0 && ((sb_state_array[ids[j] * m_sb_state_size] &
+                        state_used_mask) >
+                       (sb_state_array[ids[j - 1] * m_sb_state_size] &
+                        state_used_mask));
+             --j) {
+          const int32_t tmp = ids[j];
+          ids[j]            = ids[j - 1];
+          ids[j - 1]        = tmp;
+        }
+
+      // Drain the least-populated superblocks into the free slots of
+      // the most-populated ones
+      int32_t recv      = 0;
+      uint32_t recv_bit = 0;
+
+      for (int32_t d = n - 1; recv < d; --d) {
+        uint32_t *const donor_state =
+            sb_state_array + ids[d] * m_sb_state_size;
+
+        for (uint32_t bit = 0;
+             (0 < (*donor_state & state_used_mask)) && (bit < block_count);
+             ++bit) {
+          if (0 == (donor_state[1 + (bit >> bits_per_int_lg2)] &
+                    (1u << (bit & (31u))))) {
+            continue;  // bit is not a live block
+          }
+
+          // Find a receiving superblock with a free slot
+          uint32_t *recv_state = sb_state_array + ids[recv] * m_sb_state_size;
+          while (recv < d && block_count == (*recv_state & state_used_mask)) {
+            ++recv;
+            recv_bit   = 0;
+            recv_state = sb_state_array + ids[recv] * m_sb_state_size;
+          }
+          if (recv == d) break;  // no room left; donor stays partly full
+
+          while (recv_state[1 + (recv_bit >> bits_per_int_lg2)] &
+                 (1u << (recv_bit & 31u))) {
+            ++recv_bit;
+          }
+
+          char *const old_ptr = data_base +
+                                (uint64_t(ids[d]) << m_sb_size_lg2) +
+                                (uint64_t(bit) << block_size_lg2);
+          char *const new_ptr = data_base +
+                                (uint64_t(ids[recv]) << m_sb_size_lg2) +
+                                (uint64_t(recv_bit) << block_size_lg2);
+
+          Kokkos::Impl::DeepCopy<base_memory_space, base_memory_space>(
+              new_ptr, old_ptr, size_t(1) << block_size_lg2);
+
+          recv_state[1 + (recv_bit >> bits_per_int_lg2)] |=
+              1u << (recv_bit & 31u);
+          ++*recv_state;
+          donor_state[1 + (bit >> bits_per_int_lg2)] &= ~(1u << (bit & 31u));
+          --*donor_state;
+
+          relocate((void *)old_ptr, (void *)new_ptr,
+                   size_t(1) << block_size_lg2);
+        }
+
+        if (0 == (*donor_state & state_used_mask)) {
+          *donor_state = 0;  // emptied: return to the unassigned state
+          ++freed;
+        } else {
+          break;  // receivers are full; remaining donors cannot drain
+        }
+      }
+    }
+
+    host.deallocate(ids, m_sb_count * sizeof(int32_t));
+
+    // Superblocks that were already empty - including classes the
+    // drain loop never visits - also return to the unassigned state
+    for (int32_t i = 0; i < m_sb_count; ++i) {
+      uint32_t *const sb_state_ptr = sb_state_array + i * m_sb_state_size;
+      if ((*sb_state_ptr >> state_shift) &&
+          (0 == (*sb_state_ptr & state_used_mask))) {
+        *sb_state_ptr = 0;
+        ++freed;
+      }
+    }
+
+    if (!accessible) {
+      Kokkos::Impl::DeepCopy<base_memory_space, Kokkos::HostSpace>(
+          m_sb_state_array, sb_state_array, state_size);
+      host.deallocate(sb_state_array, state_size);
+    } else {
+      Kokkos::memory_fence();
+    }
+
+    return freed;
+  }
+
+  //--------------------------------------------------------------------------
+
 #ifdef KOKKOS_CUDA_9_DEFAULTED_BUG_WORKAROUND
   KOKKOS_INLINE_FUNCTION MemoryPool(MemoryPool &&rhs)
       : m_tracker(std::move(rhs.m_tracker)),
@@ -111,9 +111,74 @@ typedef Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::RandomAccess>
 
 //----------------------------------------------------------------------------
 
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  Compile-time check that assigning SrcViewType to DstViewType
+ *          keeps the access-pattern memory traits.
+ *
+ *  RandomAccess and Restrict silently drop whenever a View is assigned
+ *  to a type that does not name them - a subview bound to a plain View
+ *  typedef, a traitless kernel argument - and the lost LDG/no-alias
+ *  code paths cost real bandwidth without any diagnostic.  Wrap the
+ *  hand-off in
+ *
+ *    static_assert(memory_traits_preserved<dst_t, src_t>::value, "");
+ *
+ *  to fail the build at the assignment that loses them; the individual
+ *  *_preserved members identify which trait was dropped.  Ownership
+ *  (Unmanaged) is deliberately not checked: dropping it only changes
+ *  reference counting, not code generation.
+ */
+template <class DstViewType, class SrcViewType>
+struct memory_traits_preserved {
+ private:
+  typedef typename DstViewType::memory_traits dst_traits;
+  typedef typename SrcViewType::memory_traits src_traits;
+
+ public:
+  enum : bool {
+    random_access_preserved =
+        !src_traits::is_random_access || dst_traits::is_random_access
+  };
+  enum : bool {
+    restrict_preserved = !src_traits::is_restrict || dst_traits::is_restrict
+  };
+  enum : bool {
+    atomic_preserved = !src_traits::is_atomic || dst_traits::is_atomic
+  };
+  enum : bool {
+    aligned_preserved = !src_traits::is_aligned || dst_traits::is_aligned
+  };
+  enum : bool {
+    value = random_access_preserved && restrict_preserved &&
+            atomic_preserved && aligned_preserved
+  };
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+//----------------------------------------------------------------------------
+
 namespace Kokkos {
 namespace Impl {
 
+/** \brief  Memory traits that propagate onto a compatible host mirror.
+ *
+ *  Access-pattern hints (RandomAccess, Restrict) describe how a kernel
+ *  reads the data and remain valid on the mirror; ownership and access
+ *  semantics (Unmanaged, Atomic, Aligned) must not propagate, since a
+ *  mirror is allocated, deep_copied, and possibly padded differently.
+ */
+template <class T>
+struct HostMirrorMemoryTraits {
+  typedef Kokkos::MemoryTraits<
+      (T::is_random_access ? unsigned(Kokkos::RandomAccess) : 0u) |
+      (T::is_restrict ? unsigned(Kokkos::Restrict) : 0u)>
+      type;
+};
+
 static_assert((0 < int(KOKKOS_MEMORY_ALIGNMENT)) &&
                   (0 == (int(KOKKOS_MEMORY_ALIGNMENT) &
                          (int(KOKKOS_MEMORY_ALIGNMENT) - 1))),
@@ -0,0 +1,336 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+/// \file Kokkos_MultiDevice.hpp
+/// \brief Single-process fan-out of a range across execution space
+///        instances.
+///
+/// Embarrassingly parallel sweeps currently replicate the whole driver
+/// per device and glue the pieces together with MPI even on one node.
+/// MultiDevicePolicy statically partitions an index range across a set
+/// of execution space instances -- device-bound Cuda instances, Cuda
+/// streams, or host instances -- and the parallel_for/parallel_reduce
+/// overloads below launch one asynchronous chunk per instance with the
+/// global index preserved.  DistributedView allocates one chunk View
+/// per instance (through view_alloc(instance), so allocation follows
+/// the instance's device and stream) and composes them for host-side
+/// gather/scatter.
+
+#ifndef KOKKOS_MULTIDEVICE_HPP
+#define KOKKOS_MULTIDEVICE_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_View.hpp>
+#include <Kokkos_Parallel.hpp>
+#include <Kokkos_Parallel_Reduce.hpp>
+#include <Kokkos_CopyViews.hpp>
+
+#include <string>
+#include <vector>
+
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  Static partition of [begin, end) across execution space
+ *          instances.
+ *
+ *  Chunk i covers [chunk_begin(i), chunk_end(i)) and executes on
+ *  instance(i); chunks differ in size by at most one element.  The
+ *  policy is a host-side dispatch plan, not a Kokkos execution policy
+ *  type: the parallel_for/parallel_reduce overloads in this header
+ *  consume it directly.
+ */
+template <class ExecSpace = Kokkos::DefaultExecutionSpace>
+class MultiDevicePolicy {
+ public:
+  typedef ExecSpace execution_space;
+  typedef std::int64_t member_type;
+
+ private:
+  std::vector<ExecSpace> m_instances;
+  member_type m_begin;
+  member_type m_end;
+
+ public:
+  MultiDevicePolicy() : m_instances(), m_begin(0), m_end(0) {}
+
+  MultiDevicePolicy(const std::vector<ExecSpace>& arg_instances,
+                    const member_type arg_begin, const member_type arg_end)
+      : m_instances(arg_instances),
+        m_begin(arg_begin < arg_end ? arg_begin : 0),
+        m_end(arg_begin < arg_end ? arg_end : 0) {
+    if (m_instances.empty()) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::MultiDevicePolicy requires at least one "
+          "execution space instance");
+    }
+  }
+
+  MultiDevicePolicy(const std::vector<ExecSpace>& arg_instances,
+                    const member_type arg_count)
+      : MultiDevicePolicy(arg_instances, 0, arg_count) {}
+
+  int num_instances() const noexcept { return int(m_instances.size()); }
+
+  const ExecSpace& instance(const int i) const { return m_instances[i]; }
+
+  member_type begin() const noexcept { return m_begin; }
+  member_type end() const noexcept { return m_end; }
+
+  member_type chunk_begin(const int i) const {
+    const member_type len = m_end - m_begin;
+    return m_begin + (len * i) / num_instances();
+  }
+
+  member_type chunk_end(const int i) const { return chunk_begin(i + 1); }
+
+  /** \brief  Wait for all member instances to complete */
+  void fence() const {
+    for (int i = 0; i < num_instances(); ++i) m_instances[i].fence();
+  }
+};
+
+/** \brief  Launch one asynchronous chunk of the range per instance;
+ *          the functor receives the global index.
+ *
+ *  Returns without fencing, like any parallel_for; use policy.fence()
+ *  to wait for all chunks.
+ */
+template <class ExecSpace, class FunctorType>
+inline void parallel_for(const std::string& arg_label,
+                         const MultiDevicePolicy<ExecSpace>& arg_policy,
+                         const FunctorType& arg_functor) {
+  typedef Kokkos::RangePolicy<ExecSpace,
+                              Kokkos::IndexType<std::int64_t>>
+      chunk_policy;
+
+  for (int i = 0; i < arg_policy.num_instances(); ++i) {
+    Kokkos::parallel_for(
+        arg_label,
+        chunk_policy(arg_policy.instance(i), arg_policy.chunk_begin(i),
+                     arg_policy.chunk_end(i)),
+        arg_functor);
+  }
+}
+
+template <class ExecSpace, class FunctorType>
+inline void parallel_for(const MultiDevicePolicy<ExecSpace>& arg_policy,
+                         const FunctorType& arg_functor) {
+  Kokkos::Experimental::parallel_for(
+      "Kokkos::Experimental::MultiDevicePolicy::parallel_for", arg_policy,
+      arg_functor);
+}
+
+/** \brief  Sum-reduce the range across the member instances.
+ *
+ *  Each chunk reduces on its own instance; the per-chunk results are
+ *  combined with operator+= on the host.  Fences the instances (the
+ *  scalar-result contract), so the chunks overlap only up to their
+ *  sequential completion checks.
+ */
+template <class ExecSpace, class FunctorType, class ValueType>
+inline void parallel_reduce(const std::string& arg_label,
+                            const MultiDevicePolicy<ExecSpace>& arg_policy,
+                            const FunctorType& arg_functor,
+                            ValueType& arg_result) {
+  typedef Kokkos::RangePolicy<ExecSpace,
+                              Kokkos::IndexType<std::int64_t>>
+      chunk_policy;
+
+  arg_result = ValueType();
+  for (int i = 0; i < arg_policy.num_instances(); ++i) {
+    ValueType partial = ValueType();
+    Kokkos::parallel_reduce(
+        arg_label,
+        chunk_policy(arg_policy.instance(i), arg_policy.chunk_begin(i),
+                     arg_policy.chunk_end(i)),
+        arg_functor, partial);
+    arg_result += partial;
+  }
+}
+
+template <class ExecSpace, class FunctorType, class ValueType>
+inline void parallel_reduce(const MultiDevicePolicy<ExecSpace>& arg_policy,
+                            const FunctorType& arg_functor,
+                            ValueType& arg_result) {
+  Kokkos::Experimental::parallel_reduce(
+      "Kokkos::Experimental::MultiDevicePolicy::parallel_reduce", arg_policy,
+      arg_functor, arg_result);
+}
+
+namespace Impl {
+
+template <class HostViewType, class ChunkViewType>
+inline void distributed_view_gather_chunk(
+    const HostViewType& dst, const ChunkViewType& chunk,
+    const std::int64_t arg_begin, const std::int64_t arg_end,
+    std::integral_constant<unsigned, 1>) {
+  Kokkos::deep_copy(Kokkos::subview(dst, std::make_pair(arg_begin, arg_end)),
+                    chunk);
+}
+
+template <class HostViewType, class ChunkViewType>
+inline void distributed_view_gather_chunk(
+    const HostViewType& dst, const ChunkViewType& chunk,
+    const std::int64_t arg_begin, const std::int64_t arg_end,
+    std::integral_constant<unsigned, 2>) {
+  Kokkos::deep_copy(
+      Kokkos::subview(dst, std::make_pair(arg_begin, arg_end), Kokkos::ALL()),
+      chunk);
+}
+
+template <class HostViewType, class ChunkViewType>
+inline void distributed_view_scatter_chunk(
+    const ChunkViewType& chunk, const HostViewType& src,
+    const std::int64_t arg_begin, const std::int64_t arg_end,
+    std::integral_constant<unsigned, 1>) {
+  Kokkos::deep_copy(chunk,
+                    Kokkos::subview(src, std::make_pair(arg_begin, arg_end)));
+}
+
+template <class HostViewType, class ChunkViewType>
+inline void distributed_view_scatter_chunk(
+    const ChunkViewType& chunk, const HostViewType& src,
+    const std::int64_t arg_begin, const std::int64_t arg_end,
+    std::integral_constant<unsigned, 2>) {
+  Kokkos::deep_copy(
+      chunk,
+      Kokkos::subview(src, std::make_pair(arg_begin, arg_end), Kokkos::ALL()));
+}
+
+}  // namespace Impl
+
+/** \brief  Per-instance chunk Views composing a range-partitioned
+ *          array.
+ *
+ *  The leftmost dimension follows the policy's partition: chunk i holds
+ *  global rows [offset(i), offset(i+1)) and is allocated through
+ *  view_alloc(label, instance(i)), so with device-bound memory spaces
+ *  each chunk lands on its instance's device and allocation is
+ *  enqueued on its stream.  Kernels launched through the matching
+ *  MultiDevicePolicy index their chunk with the local row
+ *  i - offset(chunk).  gather/scatter move the composed array to and
+ *  from a single host View, chunk by chunk.  Rank 1 and 2 are
+ *  supported, which covers the solution-vector and parameter-sweep
+ *  layouts this is for.
+ */
+template <class ViewType>
+class DistributedView {
+ public:
+  typedef ViewType chunk_view_type;
+
+  static_assert(unsigned(ViewType::Rank) == 1 || unsigned(ViewType::Rank) == 2,
+                "Kokkos::Experimental::DistributedView supports rank 1 and 2");
+
+ private:
+  std::vector<ViewType> m_chunks;
+  std::vector<std::int64_t> m_offsets;
+
+ public:
+  DistributedView() = default;
+
+  template <class ExecSpace, class... Extents>
+  DistributedView(const std::string& arg_label,
+                  const MultiDevicePolicy<ExecSpace>& arg_policy,
+                  Extents... arg_tail_extents)
+      : m_chunks(), m_offsets() {
+    static_assert(unsigned(ViewType::Rank) == 1 + sizeof...(Extents),
+                  "DistributedView: trailing extents must cover every "
+                  "dimension after the partitioned one");
+
+    m_chunks.reserve(arg_policy.num_instances());
+    m_offsets.reserve(arg_policy.num_instances() + 1);
+
+    for (int i = 0; i < arg_policy.num_instances(); ++i) {
+      const std::int64_t b = arg_policy.chunk_begin(i);
+      const std::int64_t e = arg_policy.chunk_end(i);
+      m_offsets.push_back(b);
+      m_chunks.push_back(
+          ViewType(Kokkos::view_alloc(arg_label, arg_policy.instance(i)),
+                   size_t(e - b), arg_tail_extents...));
+    }
+    m_offsets.push_back(arg_policy.end());
+  }
+
+  int num_chunks() const noexcept { return int(m_chunks.size()); }
+
+  const ViewType& chunk(const int i) const { return m_chunks[i]; }
+
+  std::int64_t offset(const int i) const { return m_offsets[i]; }
+
+  /** \brief  Total extent of the partitioned dimension */
+  std::int64_t extent_0() const {
+    return m_offsets.empty() ? 0 : m_offsets.back() - m_offsets.front();
+  }
+
+  /** \brief  Copy every chunk into its slice of a host View; fences
+   *          through the per-chunk deep_copy calls
+   */
+  template <class HostViewType>
+  void gather(const HostViewType& arg_dst) const {
+    for (int i = 0; i < num_chunks(); ++i) {
+      Impl::distributed_view_gather_chunk(
+          arg_dst, m_chunks[i], m_offsets[i] - m_offsets.front(),
+          m_offsets[i + 1] - m_offsets.front(),
+          std::integral_constant<unsigned, unsigned(ViewType::Rank)>());
+    }
+  }
+
+  /** \brief  Copy each chunk's slice of a host View into the chunk */
+  template <class HostViewType>
+  void scatter(const HostViewType& arg_src) const {
+    for (int i = 0; i < num_chunks(); ++i) {
+      Impl::distributed_view_scatter_chunk(
+          m_chunks[i], arg_src, m_offsets[i] - m_offsets.front(),
+          m_offsets[i + 1] - m_offsets.front(),
+          std::integral_constant<unsigned, unsigned(ViewType::Rank)>());
+    }
+  }
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_MULTIDEVICE_HPP
@@ -0,0 +1,197 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_OnCompletion.hpp
+/// \brief Host callbacks on execution-space completion.
+///
+/// The only way to learn from the host that asynchronously launched
+/// work has finished is to fence, which blocks the calling thread and,
+/// used for telemetry or I/O triggers, turns every observation into a
+/// full synchronization.  on_completion registers a host callable to
+/// run once all work currently enqueued on an execution space instance
+/// has completed, without blocking the caller.
+///
+/// On Cuda the callback is enqueued onto the instance's stream with
+/// cudaLaunchHostFunc, so it fires from the driver's completion thread
+/// with no host-side waiting at all.  On other backends the callable
+/// is appended to a FIFO queue drained by a single waiter thread that
+/// fences the instance and then invokes it, moving the wait off the
+/// calling thread.  One waiter serves all instances, so waiter-queue
+/// callbacks run one at a time in registration order.
+///
+/// The callback runs on a thread that is not the caller's: it must not
+/// launch work on the same instance it was enqueued on (a Cuda
+/// restriction) and must synchronize its own access to shared state.
+/// wait_all_completions() drains outstanding waiter-thread callbacks
+/// and must run before finalize when any were registered.
+
+#ifndef KOKKOS_ONCOMPLETION_HPP
+#define KOKKOS_ONCOMPLETION_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_Core_fwd.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace Kokkos {
+namespace Experimental {
+
+namespace Impl {
+
+//! FIFO of waiter jobs; a single worker preserves registration order.
+struct OnCompletionQueue {
+  std::mutex lock;
+  std::condition_variable drained;
+  std::deque<std::function<void()>> jobs;
+  int pending;
+  bool worker_running;
+
+  OnCompletionQueue() : pending(0), worker_running(false) {}
+
+  static OnCompletionQueue& singleton() {
+    static OnCompletionQueue s;
+    return s;
+  }
+
+  void enqueue(std::function<void()> job) {
+    std::lock_guard<std::mutex> guard(lock);
+    jobs.push_back(std::move(job));
+    ++pending;
+    // The worker exits when the queue runs dry; revive it lazily so no
+    // thread lingers once all callbacks have fired.
+    if (!worker_running) {
+      worker_running = true;
+      std::thread([]() { singleton().drain(); }).detach();
+    }
+  }
+
+  void drain() {
+    std::unique_lock<std::mutex> guard(lock);
+    while (!jobs.empty()) {
+      std::function<void()> job = std::move(jobs.front());
+      jobs.pop_front();
+      guard.unlock();
+      job();
+      guard.lock();
+      if (0 == --pending) drained.notify_all();
+    }
+    worker_running = false;
+  }
+};
+
+}  // namespace Impl
+
+/** \brief  Run a host callable once all work currently enqueued on the
+ *          instance has completed.  Returns immediately.
+ *
+ *  \code
+ *    Kokkos::parallel_for(policy, functor);
+ *    Kokkos::Experimental::on_completion(
+ *        Kokkos::DefaultExecutionSpace(), [=] { record_sample(); });
+ *    // caller continues; record_sample fires when the kernel is done
+ *  \endcode
+ *
+ *  Callbacks for one instance run in their registration order relative
+ *  to the work between them, but concurrently with the caller.
+ */
+template <class ExecSpace, class Callback>
+void on_completion(const ExecSpace& exec, Callback callback) {
+  Impl::OnCompletionQueue::singleton().enqueue([exec, callback]() {
+    exec.fence();
+    callback();
+  });
+}
+
+#if defined(KOKKOS_ENABLE_CUDA)
+
+/** \brief  Cuda specialization: enqueue the callback onto the
+ *          instance's stream, after everything already enqueued.
+ *
+ *  No host thread waits; the driver invokes the callback when the
+ *  stream reaches it.  The callback must not call into the Cuda API
+ *  (a cudaLaunchHostFunc restriction).
+ */
+template <class Callback>
+void on_completion(const Kokkos::Cuda& exec, Callback callback) {
+#if defined(CUDART_VERSION) && (10000 <= CUDART_VERSION)
+  std::function<void()>* holder = new std::function<void()>(callback);
+  cudaLaunchHostFunc(exec.cuda_stream(),
+                     [](void* arg) {
+                       std::function<void()>* f =
+                           static_cast<std::function<void()>*>(arg);
+                       (*f)();
+                       delete f;
+                     },
+                     holder);
+#else
+  // Runtimes without cudaLaunchHostFunc fall back to the waiter queue.
+  Impl::OnCompletionQueue::singleton().enqueue([exec, callback]() {
+    exec.fence();
+    callback();
+  });
+#endif
+}
+
+#endif /* defined( KOKKOS_ENABLE_CUDA ) */
+
+/** \brief  Block until every waiter-thread callback registered so far
+ *          has finished.  Call before finalize.
+ *
+ *  Stream-enqueued Cuda callbacks are drained by fencing the instance
+ *  instead; this covers the detached waiter threads.
+ */
+inline void wait_all_completions() {
+  Impl::OnCompletionQueue& queue = Impl::OnCompletionQueue::singleton();
+  std::unique_lock<std::mutex> guard(queue.lock);
+  queue.drained.wait(guard, [&queue]() { return queue.pending == 0; });
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_ONCOMPLETION_HPP */
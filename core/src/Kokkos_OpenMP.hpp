@@ -142,6 +142,22 @@ class OpenMP {
   static void partition_master(F const& f, int requested_num_partitions = 0,
                                int requested_partition_size = 0);
 
+  /// \brief Partition the default instance into unequally sized
+  /// partitions and call 'f' on each new 'master' thread
+  ///
+  /// One partition per entry of partition_sizes, with that many worker
+  /// threads; sizes are shrunk proportionally if they oversubscribe the
+  /// pool.  Each partition master is an independent host thread whose
+  /// Kokkos dispatches run on its partition's threads only, so the
+  /// masters co-schedule unequal kernels concurrently (e.g. a 4-thread
+  /// compression alongside a 60-thread solve) instead of time-slicing.
+  ///
+  /// Func is a functor with the following signiture
+  ///   void( int partition_id, int num_partitions )
+  template <typename F>
+  static void partition_master(F const& f,
+                               std::vector<int> const& partition_sizes);
+
   // use UniqueToken
   static int concurrency();
 
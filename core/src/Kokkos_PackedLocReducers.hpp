@@ -0,0 +1,288 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_PackedLocReducers.hpp
+/// \brief MinLoc/MaxLoc variants that reduce over one 64-bit word.
+///
+/// MinLoc and MaxLoc carry a scalar+index struct, which falls off the
+/// fast reduction paths: device shuffles and vectorized host joins
+/// handle power-of-two scalar words, not two-member structs.  For
+/// 4-byte scalars, MinLocPacked and MaxLocPacked instead pack an
+/// order-preserving integer key of the value into the high half of a
+/// uint64_t and the index into the low half; the whole reduction is
+/// then a plain integer min or max that rides every existing scalar
+/// fast path.  The functor packs, the caller unpacks:
+///
+///   typedef Kokkos::Experimental::LocPack<float, unsigned> pack_type;
+///   uint64_t result;
+///   parallel_reduce(n, KOKKOS_LAMBDA(const int i, uint64_t& packed) {
+///       const uint64_t candidate = pack_type::pack(dist(i), i);
+///       if (candidate < packed) packed = candidate;
+///     }, Kokkos::Experimental::MinLocPacked<float, unsigned>(result));
+///   const float    min_value = pack_type::value(result);
+///   const unsigned min_index = pack_type::index(result);
+///
+/// Value ties resolve to the smallest index under MinLocPacked and the
+/// largest under MaxLocPacked - the index participates in the packed
+/// comparison.  Floating-point keys order NaN above all numbers.
+/// Scalars wider than 4 bytes do not fit the 64-bit pack and should
+/// keep using MinLoc/MaxLoc.
+
+#ifndef KOKKOS_PACKEDLOCREDUCERS_HPP
+#define KOKKOS_PACKEDLOCREDUCERS_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_View.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace Kokkos {
+namespace Impl {
+
+// Order-preserving 32-bit integer keys: key(a) < key(b) iff a < b.
+template <class Scalar, class Enable = void>
+struct LocPackKey;
+
+template <>
+struct LocPackKey<float> {
+  KOKKOS_INLINE_FUNCTION
+  static uint32_t to_key(const float value) {
+    union {
+      float f;
+      uint32_t u;
+    } cast;
+    cast.f = value;
+    // Flip the sign bit for non-negatives, all bits for negatives, so
+    // the IEEE ordering becomes the unsigned integer ordering.
+    return (cast.u & 0x80000000u) ? ~cast.u : (cast.u | 0x80000000u);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  static float from_key(const uint32_t key) {
+    union {
+      float f;
+      uint32_t u;
+    } cast;
+    cast.u = (key & 0x80000000u) ? (key & 0x7FFFFFFFu) : ~key;
+    return cast.f;
+  }
+};
+
+template <class Scalar>
+struct LocPackKey<Scalar, typename std::enable_if<
+                              std::is_integral<Scalar>::value &&
+                              std::is_signed<Scalar>::value &&
+                              sizeof(Scalar) == 4>::type> {
+  KOKKOS_INLINE_FUNCTION
+  static uint32_t to_key(const Scalar value) {
+    return uint32_t(value) ^ 0x80000000u;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  static Scalar from_key(const uint32_t key) {
+    return Scalar(key ^ 0x80000000u);
+  }
+};
+
+template <class Scalar>
+struct LocPackKey<Scalar, typename std::enable_if<
+                              std::is_integral<Scalar>::value &&
+                              !std::is_signed<Scalar>::value &&
+                              sizeof(Scalar) == 4>::type> {
+  KOKKOS_INLINE_FUNCTION
+  static uint32_t to_key(const Scalar value) { return uint32_t(value); }
+
+  KOKKOS_INLINE_FUNCTION
+  static Scalar from_key(const uint32_t key) { return Scalar(key); }
+};
+
+}  // namespace Impl
+
+namespace Experimental {
+
+/** \brief  Pack a 4-byte scalar and a 32-bit index into one uint64_t
+ *          ordered first by scalar value, then by index.
+ */
+template <class Scalar, class Index = unsigned>
+struct LocPack {
+  static_assert(sizeof(Scalar) == 4,
+                "Kokkos::LocPack requires a 4-byte scalar type");
+  static_assert(std::is_integral<Index>::value && sizeof(Index) <= 4,
+                "Kokkos::LocPack requires an integral index of at most 4 "
+                "bytes");
+
+  KOKKOS_INLINE_FUNCTION
+  static uint64_t pack(const Scalar value, const Index index) {
+    return (uint64_t(Kokkos::Impl::LocPackKey<Scalar>::to_key(value)) << 32) |
+           uint64_t(uint32_t(index));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  static Scalar value(const uint64_t packed) {
+    return Kokkos::Impl::LocPackKey<Scalar>::from_key(uint32_t(packed >> 32));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  static Index index(const uint64_t packed) {
+    return Index(uint32_t(packed));
+  }
+};
+
+/** \brief  MinLoc over a packed value+index word; joins are plain
+ *          integer min, so device shuffle and vectorized host paths
+ *          apply.  The result is unpacked with LocPack<Scalar,Index>.
+ */
+template <class Scalar, class Index,
+          class Space = Kokkos::DefaultHostExecutionSpace>
+struct MinLocPacked {
+ public:
+  // Required
+  typedef MinLocPacked reducer;
+  typedef uint64_t value_type;
+
+  typedef Kokkos::View<value_type, Space> result_view_type;
+
+  typedef LocPack<Scalar, Index> pack_type;
+
+ private:
+  result_view_type value;
+  bool references_scalar_v;
+
+ public:
+  KOKKOS_INLINE_FUNCTION
+  MinLocPacked(value_type& value_) : value(&value_), references_scalar_v(true) {}
+
+  KOKKOS_INLINE_FUNCTION
+  MinLocPacked(const result_view_type& value_)
+      : value(value_), references_scalar_v(false) {}
+
+  // Required
+  KOKKOS_INLINE_FUNCTION
+  void join(value_type& dest, const value_type& src) const {
+    if (src < dest) dest = src;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void join(volatile value_type& dest, const volatile value_type& src) const {
+    if (src < dest) dest = src;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void init(value_type& val) const {
+    // Highest key and highest index: any packed candidate wins, and
+    // value ties resolve to the smallest index.
+    val = ~uint64_t(0);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  value_type& reference() const { return *value.data(); }
+
+  KOKKOS_INLINE_FUNCTION
+  result_view_type view() const { return value; }
+
+  KOKKOS_INLINE_FUNCTION
+  bool references_scalar() const { return references_scalar_v; }
+};
+
+/** \brief  MaxLoc counterpart of MinLocPacked; value ties resolve to
+ *          the largest index.
+ */
+template <class Scalar, class Index,
+          class Space = Kokkos::DefaultHostExecutionSpace>
+struct MaxLocPacked {
+ public:
+  // Required
+  typedef MaxLocPacked reducer;
+  typedef uint64_t value_type;
+
+  typedef Kokkos::View<value_type, Space> result_view_type;
+
+  typedef LocPack<Scalar, Index> pack_type;
+
+ private:
+  result_view_type value;
+  bool references_scalar_v;
+
+ public:
+  KOKKOS_INLINE_FUNCTION
+  MaxLocPacked(value_type& value_) : value(&value_), references_scalar_v(true) {}
+
+  KOKKOS_INLINE_FUNCTION
+  MaxLocPacked(const result_view_type& value_)
+      : value(value_), references_scalar_v(false) {}
+
+  // Required
+  KOKKOS_INLINE_FUNCTION
+  void join(value_type& dest, const value_type& src) const {
+    if (src > dest) dest = src;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void join(volatile value_type& dest, const volatile value_type& src) const {
+    if (src > dest) dest = src;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void init(value_type& val) const {
+    // Lowest key and lowest index: any packed candidate wins, and
+    // value ties resolve to the largest index.
+    val = uint64_t(0);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  value_type& reference() const { return *value.data(); }
+
+  KOKKOS_INLINE_FUNCTION
+  result_view_type view() const { return value; }
+
+  KOKKOS_INLINE_FUNCTION
+  bool references_scalar() const { return references_scalar_v; }
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_PACKEDLOCREDUCERS_HPP */
@@ -49,6 +49,8 @@
 #define KOKKOS_PARALLEL_HPP
 
 #include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <Kokkos_Core_fwd.hpp>
 #include <Kokkos_View.hpp>
 #include <Kokkos_ExecPolicy.hpp>
@@ -56,10 +58,13 @@
 #if defined(KOKKOS_ENABLE_PROFILING)
 #include <impl/Kokkos_Profiling_Interface.hpp>
 #include <typeinfo>
+#include <type_traits>
 #endif
 
 #include <impl/Kokkos_Tags.hpp>
 #include <impl/Kokkos_Traits.hpp>
+#include <impl/Kokkos_LaunchBoundsRegistry.hpp>
+#include <Kokkos_AllocationAudit.hpp>
 #include <impl/Kokkos_FunctorAnalysis.hpp>
 #include <impl/Kokkos_FunctorAdapter.hpp>
 
@@ -125,6 +130,300 @@ struct FunctorPolicyExecutionSpace<
   typedef typename Functor::execution_space execution_space;
 };
 
+#if defined(KOKKOS_ENABLE_PROFILING)
+
+//----------------------------------------------------------------------------
+/** \brief  Offer the launch parameters of an execution policy to an
+ *          attached tuning tool before dispatch.
+ *
+ *  The primary template covers policies without runtime-adjustable
+ *  launch parameters and returns the policy unchanged.  Specializations
+ *  translate between a concrete policy and the Profiling::PolicyTuning
+ *  struct handed to the tool's kokkosp_tune_policy callback, applying
+ *  whatever fields the tool rewrote.
+ */
+template <class PolicyType, class Enable = void>
+struct PolicyTuningAdaptor {
+  static PolicyType apply(const PolicyType& policy, const std::string&) {
+    return policy;
+  }
+};
+
+/* RangePolicy exposes its scheduling granularity (chunk size). */
+template <class... Properties>
+struct PolicyTuningAdaptor<Kokkos::RangePolicy<Properties...>> {
+  typedef Kokkos::RangePolicy<Properties...> policy_type;
+
+  static policy_type apply(const policy_type& policy,
+                           const std::string& kernelPrefix) {
+    Kokkos::Profiling::PolicyTuning tuning = {};
+
+    tuning.work_size     = int64_t(policy.end()) - int64_t(policy.begin());
+    tuning.team_size     = -1;
+    tuning.vector_length = -1;
+    tuning.chunk_size    = int64_t(policy.chunk_size());
+
+    Kokkos::Profiling::tunePolicy(kernelPrefix, 0, tuning);
+
+    if (0 < tuning.chunk_size &&
+        tuning.chunk_size != int64_t(policy.chunk_size())) {
+      return policy.set_chunk_size(int(tuning.chunk_size));
+    }
+    return policy;
+  }
+};
+
+/* TeamPolicy exposes team size, vector length, and chunk size.  Not
+ * every backend's TeamPolicyInternal stores a vector length or provides
+ * the impl_set_* mutators, so detect them and silently ignore overrides
+ * a backend cannot honor. */
+template <class... Properties>
+struct PolicyTuningAdaptor<Kokkos::TeamPolicy<Properties...>> {
+  typedef Kokkos::TeamPolicy<Properties...> policy_type;
+
+  template <class P>
+  static auto current_vector_length(const P& p, int)
+      -> decltype(int(p.vector_length())) {
+    return p.vector_length();
+  }
+  template <class P>
+  static int current_vector_length(const P&, long) {
+    return -1;
+  }
+
+  template <class P>
+  static auto set_team_size(P& p, const int team_size_request, int)
+      -> decltype(p.impl_set_team_size(team_size_request)) {
+    p.impl_set_team_size(team_size_request);
+  }
+  template <class P>
+  static void set_team_size(P&, const int, long) {}
+
+  template <class P>
+  static auto set_vector_length(P& p, const int vector_length_request, int)
+      -> decltype(p.impl_set_vector_length(vector_length_request)) {
+    p.impl_set_vector_length(vector_length_request);
+  }
+  template <class P>
+  static void set_vector_length(P&, const int, long) {}
+
+  static policy_type apply(const policy_type& policy,
+                           const std::string& kernelPrefix) {
+    Kokkos::Profiling::PolicyTuning tuning = {};
+
+    tuning.work_size     = policy.league_size();
+    tuning.team_size     = policy.team_size();
+    tuning.vector_length = current_vector_length(policy, 0);
+    tuning.chunk_size    = int64_t(policy.chunk_size());
+
+    Kokkos::Profiling::tunePolicy(kernelPrefix, 0, tuning);
+
+    policy_type p = policy;
+    if (0 < tuning.team_size && tuning.team_size != policy.team_size()) {
+      set_team_size(p, tuning.team_size, 0);
+    }
+    if (0 < tuning.vector_length &&
+        tuning.vector_length != current_vector_length(policy, 0)) {
+      set_vector_length(p, tuning.vector_length, 0);
+    }
+    if (0 < tuning.chunk_size &&
+        tuning.chunk_size != int64_t(policy.chunk_size())) {
+      p = p.set_chunk_size(int(tuning.chunk_size));
+    }
+    return p;
+  }
+};
+
+/** \brief  The policy a launch should dispatch with: the caller's
+ *          policy by reference, or a tuned copy of it.
+ *
+ *  Materializing the tuned copy requires the policy type to be
+ *  copy-assignable.  Policies that are not (WorkGraphPolicy's const
+ *  graph member deletes its assignment) take the reference-only
+ *  specialization, never instantiate the copy path, and are simply not
+ *  offered to the tuning tool.
+ */
+template <class PolicyType,
+          bool Assignable = std::is_copy_assignable<PolicyType>::value>
+struct PolicyTuningScope {
+  PolicyType m_policy;
+
+  PolicyTuningScope(const PolicyType& policy) : m_policy(policy) {}
+
+  void tune(const std::string& kernelPrefix) {
+    m_policy = PolicyTuningAdaptor<PolicyType>::apply(m_policy, kernelPrefix);
+  }
+
+  const PolicyType& get() const { return m_policy; }
+};
+
+template <class PolicyType>
+struct PolicyTuningScope<PolicyType, false> {
+  const PolicyType& m_policy;
+
+  PolicyTuningScope(const PolicyType& policy) : m_policy(policy) {}
+
+  void tune(const std::string&) {}
+
+  const PolicyType& get() const { return m_policy; }
+};
+
+#endif /* defined( KOKKOS_ENABLE_PROFILING ) */
+
+//----------------------------------------------------------------------------
+/** \brief  Compile-time selection of launches the Serial backend can
+ *          run as a bare loop at the call site.
+ *
+ *  For a RangePolicy on Serial the ParallelFor closure adds nothing:
+ *  no scratch assignment, no thread pool, no scheduling state.  Code
+ *  that calls kernels from inside host loops (per-cell micro-solves)
+ *  pays tens of nanoseconds of closure and instrumentation ceremony
+ *  per launch against single digits for the loop itself.  When the
+ *  selected launch is Serial and no tool is attached, parallel_for
+ *  runs the loop directly: one untracked functor copy, no closure and
+ *  no profiling hooks.
+ */
+template <class ExecPolicy, class Enabled = void>
+struct SerialInlineLaunch {
+  enum : bool { value = false };
+
+  template <class FunctorType>
+  inline static void run(const ExecPolicy&, const FunctorType&) {}
+};
+
+#if defined(KOKKOS_ENABLE_SERIAL)
+
+template <class... Traits>
+struct SerialInlineLaunch<
+    Kokkos::RangePolicy<Traits...>,
+    typename std::enable_if<std::is_same<
+        typename Kokkos::RangePolicy<Traits...>::execution_space,
+        Kokkos::Serial>::value>::type> {
+ private:
+  typedef Kokkos::RangePolicy<Traits...> Policy;
+
+  template <class FunctorType, class TagType>
+  inline static
+      typename std::enable_if<std::is_same<TagType, void>::value>::type
+      exec(const Policy& policy, const FunctorType& functor) {
+    const typename Policy::member_type e = policy.end();
+    for (typename Policy::member_type i = policy.begin(); i < e; ++i) {
+      functor(i);
+    }
+  }
+
+  template <class FunctorType, class TagType>
+  inline static
+      typename std::enable_if<!std::is_same<TagType, void>::value>::type
+      exec(const Policy& policy, const FunctorType& functor) {
+    const TagType t{};
+    const typename Policy::member_type e = policy.end();
+    for (typename Policy::member_type i = policy.begin(); i < e; ++i) {
+      functor(t, i);
+    }
+  }
+
+ public:
+  enum : bool { value = true };
+
+  template <class FunctorType>
+  inline static void run(const Policy& policy, const FunctorType& functor) {
+    // One functor copy with allocation tracking disabled, exactly as
+    // the closure constructor of every other launch path makes: Views
+    // captured by the kernel must be unmanaged inside it, or copies
+    // made within the kernel would mutate reference counts.
+    Kokkos::Impl::shared_allocation_tracking_disable();
+    const FunctorType kernel_functor(functor);
+    Kokkos::Impl::shared_allocation_tracking_enable();
+
+    exec<FunctorType, typename Policy::work_tag>(policy, kernel_functor);
+  }
+};
+
+#endif /* defined( KOKKOS_ENABLE_SERIAL ) */
+
+//----------------------------------------------------------------------------
+/** \brief  32-bit-index relaunch for device RangePolicy launches.
+ *
+ *  64-bit index arithmetic costs extra registers and instructions on
+ *  device hardware, and most ranges fit comfortably in 32 bits.  When
+ *  a RangePolicy carries a wider-than-32-bit index type (written
+ *  conservatively with IndexType<int64_t> or size_t) but its bounds
+ *  fit std::int32_t, the launch is redirected to the driver
+ *  instantiated for the equivalent 32-bit policy.  The functor sees
+ *  its indices through the usual integral conversion, so the
+ *  redirection is value-preserving by construction.
+ *
+ *  Only policies on non-host memory spaces are redirected: on host
+ *  CPUs 64-bit arithmetic is free and the extra driver instantiation
+ *  would buy nothing.
+ */
+template <class ExecPolicy, class FunctorType, class Enabled = void>
+struct NarrowIndexLaunch {
+  enum : bool { enable = false };
+
+  inline static bool try_launch(const ExecPolicy&, const FunctorType&) {
+    return false;
+  }
+};
+
+template <class FunctorType, class... Traits>
+struct NarrowIndexLaunch<
+    Kokkos::RangePolicy<Traits...>, FunctorType,
+    typename std::enable_if<
+        !std::is_same<typename Kokkos::RangePolicy<
+                          Traits...>::execution_space::memory_space,
+                      Kokkos::HostSpace>::value &&
+        (sizeof(typename Kokkos::RangePolicy<Traits...>::member_type) >
+         sizeof(std::int32_t))>::type> {
+ private:
+  typedef Kokkos::RangePolicy<Traits...> Policy;
+
+  // The 32-bit twin of the policy; the work-tag-free form cannot spell
+  // a void tag so the twin is selected conditionally.  Only the chosen
+  // branch of the conditional is ever instantiated.  The launch bounds
+  // are carried over explicitly - they select the driver's occupancy
+  // configuration and must not be dropped by the redirection.
+  typedef typename std::conditional<
+      std::is_same<typename Policy::work_tag, void>::value,
+      Kokkos::RangePolicy<typename Policy::execution_space,
+                          typename Policy::schedule_type,
+                          typename Policy::launch_bounds,
+                          Kokkos::IndexType<std::int32_t>>,
+      Kokkos::RangePolicy<typename Policy::execution_space,
+                          typename Policy::schedule_type,
+                          typename Policy::work_tag,
+                          typename Policy::launch_bounds,
+                          Kokkos::IndexType<std::int32_t>>>::type narrow_policy;
+
+ public:
+  enum : bool { enable = true };
+
+  inline static bool try_launch(const Policy& policy,
+                                const FunctorType& functor) {
+    typedef typename Policy::member_type member_type;
+
+    if (std::is_signed<member_type>::value &&
+        policy.begin() < member_type(0)) {
+      return false;
+    }
+    if (static_cast<std::uint64_t>(
+            std::numeric_limits<std::int32_t>::max()) <
+        static_cast<std::uint64_t>(policy.end())) {
+      return false;
+    }
+
+    const narrow_policy narrowed(policy);
+
+    Kokkos::Impl::shared_allocation_tracking_disable();
+    ParallelFor<FunctorType, narrow_policy> closure(functor, narrowed);
+    Kokkos::Impl::shared_allocation_tracking_enable();
+
+    closure.execute();
+    return true;
+  }
+};
+
 }  // namespace Impl
 }  // namespace Kokkos
 
@@ -160,21 +459,43 @@ inline void parallel_for(
     const std::string& str = "",
     typename Impl::enable_if<
         Kokkos::Impl::is_execution_policy<ExecPolicy>::value>::type* = 0) {
+  if (Impl::SerialInlineLaunch<ExecPolicy>::value
+#if defined(KOKKOS_ENABLE_PROFILING)
+      && !Kokkos::Profiling::profileLibraryLoaded()
+#endif
+  ) {
+    Impl::SerialInlineLaunch<ExecPolicy>::run(policy, functor);
+    return;
+  }
+
+  const Impl::LaunchBoundsHintScope launch_bounds_hint(str);
+  const Impl::AllocationAuditRegion allocation_audit(str);
+
 #if defined(KOKKOS_ENABLE_PROFILING)
   uint64_t kpID = 0;
+  Impl::PolicyTuningScope<ExecPolicy> tuning_scope(policy);
   if (Kokkos::Profiling::profileLibraryLoaded()) {
     Kokkos::Impl::ParallelConstructName<FunctorType,
                                         typename ExecPolicy::work_tag>
         name(str);
     Kokkos::Profiling::beginParallelFor(name.get(), 0, &kpID);
+    if (Kokkos::Profiling::tuneLibraryLoaded()) {
+      tuning_scope.tune(name.get());
+    }
   }
+  const ExecPolicy& launch_policy = tuning_scope.get();
+#else
+  const ExecPolicy& launch_policy = policy;
 #endif
 
-  Kokkos::Impl::shared_allocation_tracking_disable();
-  Impl::ParallelFor<FunctorType, ExecPolicy> closure(functor, policy);
-  Kokkos::Impl::shared_allocation_tracking_enable();
+  if (!Impl::NarrowIndexLaunch<ExecPolicy, FunctorType>::try_launch(
+          launch_policy, functor)) {
+    Kokkos::Impl::shared_allocation_tracking_disable();
+    Impl::ParallelFor<FunctorType, ExecPolicy> closure(functor, launch_policy);
+    Kokkos::Impl::shared_allocation_tracking_enable();
 
-  closure.execute();
+    closure.execute();
+  }
 
 #if defined(KOKKOS_ENABLE_PROFILING)
   if (Kokkos::Profiling::profileLibraryLoaded()) {
@@ -190,20 +511,41 @@ inline void parallel_for(const size_t work_count, const FunctorType& functor,
       FunctorType, void>::execution_space execution_space;
   typedef RangePolicy<execution_space> policy;
 
+  if (Impl::SerialInlineLaunch<policy>::value
+#if defined(KOKKOS_ENABLE_PROFILING)
+      && !Kokkos::Profiling::profileLibraryLoaded()
+#endif
+  ) {
+    Impl::SerialInlineLaunch<policy>::run(policy(0, work_count), functor);
+    return;
+  }
+
+  const Impl::LaunchBoundsHintScope launch_bounds_hint(str);
+  const Impl::AllocationAuditRegion allocation_audit(str);
+
 #if defined(KOKKOS_ENABLE_PROFILING)
   uint64_t kpID = 0;
+  Impl::PolicyTuningScope<policy> tuning_scope(policy(0, work_count));
   if (Kokkos::Profiling::profileLibraryLoaded()) {
     Kokkos::Impl::ParallelConstructName<FunctorType, void> name(str);
     Kokkos::Profiling::beginParallelFor(name.get(), 0, &kpID);
+    if (Kokkos::Profiling::tuneLibraryLoaded()) {
+      tuning_scope.tune(name.get());
+    }
   }
+  const policy& launch_policy = tuning_scope.get();
+#else
+  const policy launch_policy(0, work_count);
 #endif
 
-  Kokkos::Impl::shared_allocation_tracking_disable();
-  Impl::ParallelFor<FunctorType, policy> closure(functor,
-                                                 policy(0, work_count));
-  Kokkos::Impl::shared_allocation_tracking_enable();
+  if (!Impl::NarrowIndexLaunch<policy, FunctorType>::try_launch(launch_policy,
+                                                                functor)) {
+    Kokkos::Impl::shared_allocation_tracking_disable();
+    Impl::ParallelFor<FunctorType, policy> closure(functor, launch_policy);
+    Kokkos::Impl::shared_allocation_tracking_enable();
 
-  closure.execute();
+    closure.execute();
+  }
 
 #if defined(KOKKOS_ENABLE_PROFILING)
   if (Kokkos::Profiling::profileLibraryLoaded()) {
@@ -229,6 +571,87 @@ inline void parallel_for(const std::string& str, const ExecPolicy& policy,
   (void)str;
 }
 
+// Character-literal overload: with no tool attached a named launch
+// costs one branch - no std::string is constructed.  When a tool is
+// attached the name is interned once so repeated launches reuse the
+// stored copy.
+template <class ExecPolicy, class FunctorType>
+inline void parallel_for(
+    const char* str, const ExecPolicy& policy, const FunctorType& functor,
+    typename Impl::enable_if<
+        Kokkos::Impl::is_execution_policy<ExecPolicy>::value>::type* = 0) {
+#if KOKKOS_ENABLE_DEBUG_PRINT_KERNEL_NAMES
+  Kokkos::fence();
+  std::cout << "KOKKOS_DEBUG Start parallel_for kernel: " << str << std::endl;
+#endif
+
+  if (Impl::SerialInlineLaunch<ExecPolicy>::value
+#if defined(KOKKOS_ENABLE_PROFILING)
+      && !Kokkos::Profiling::profileLibraryLoaded()
+#endif
+  ) {
+    Impl::SerialInlineLaunch<ExecPolicy>::run(policy, functor);
+    return;
+  }
+
+  const Impl::LaunchBoundsHintScope launch_bounds_hint(str);
+  const Impl::AllocationAuditRegion allocation_audit(str);
+
+#if defined(KOKKOS_ENABLE_PROFILING)
+  uint64_t kpID = 0;
+  Impl::PolicyTuningScope<ExecPolicy> tuning_scope(policy);
+  if (Kokkos::Profiling::profileLibraryLoaded()) {
+    static const std::string empty_label;
+    Kokkos::Impl::ParallelConstructName<FunctorType,
+                                        typename ExecPolicy::work_tag>
+        name(str && str[0] ? Kokkos::Profiling::internKernelName(str)
+                           : empty_label);
+    Kokkos::Profiling::beginParallelFor(name.get(), 0, &kpID);
+    if (Kokkos::Profiling::tuneLibraryLoaded()) {
+      tuning_scope.tune(name.get());
+    }
+  }
+  const ExecPolicy& launch_policy = tuning_scope.get();
+#else
+  const ExecPolicy& launch_policy = policy;
+#endif
+
+  if (!Impl::NarrowIndexLaunch<ExecPolicy, FunctorType>::try_launch(
+          launch_policy, functor)) {
+    Kokkos::Impl::shared_allocation_tracking_disable();
+    Impl::ParallelFor<FunctorType, ExecPolicy> closure(functor, launch_policy);
+    Kokkos::Impl::shared_allocation_tracking_enable();
+
+    closure.execute();
+  }
+
+#if defined(KOKKOS_ENABLE_PROFILING)
+  if (Kokkos::Profiling::profileLibraryLoaded()) {
+    Kokkos::Profiling::endParallelFor(kpID);
+  }
+#endif
+
+#if KOKKOS_ENABLE_DEBUG_PRINT_KERNEL_NAMES
+  Kokkos::fence();
+  std::cout << "KOKKOS_DEBUG End   parallel_for kernel: " << str << std::endl;
+#endif
+  (void)str;
+}
+
+// The work count is a template parameter so that both arguments match
+// exactly; otherwise this form is ambiguous with the std::string
+// overload for calls like parallel_for("label", 100, functor)
+template <class FunctorType, class IntType>
+inline void parallel_for(
+    const char* str, const IntType work_count, const FunctorType& functor,
+    typename Impl::enable_if<std::is_integral<IntType>::value>::type* = 0) {
+  typedef typename Impl::FunctorPolicyExecutionSpace<
+      FunctorType, void>::execution_space execution_space;
+  typedef RangePolicy<execution_space> policy;
+
+  ::Kokkos::parallel_for(str, policy(0, work_count), functor);
+}
+
 }  // namespace Kokkos
 
 #include <Kokkos_Parallel_Reduce.hpp>
@@ -415,6 +838,8 @@ inline void parallel_scan(
   }
 #endif
 
+  const Impl::AllocationAuditRegion allocation_audit(str);
+
   Kokkos::Impl::shared_allocation_tracking_disable();
   Impl::ParallelScan<FunctorType, ExecutionPolicy> closure(functor, policy);
   Kokkos::Impl::shared_allocation_tracking_enable();
@@ -444,6 +869,8 @@ inline void parallel_scan(const size_t work_count, const FunctorType& functor,
   }
 #endif
 
+  const Impl::AllocationAuditRegion allocation_audit(str);
+
   Kokkos::Impl::shared_allocation_tracking_disable();
   Impl::ParallelScan<FunctorType, policy> closure(functor,
                                                   policy(0, work_count));
@@ -475,6 +902,51 @@ inline void parallel_scan(const std::string& str, const ExecutionPolicy& policy,
   (void)str;
 }
 
+// Character-literal overload: no std::string is constructed unless a
+// tool is attached (see the parallel_for overload above)
+template <class ExecutionPolicy, class FunctorType>
+inline void parallel_scan(
+    const char* str, const ExecutionPolicy& policy, const FunctorType& functor,
+    typename Impl::enable_if<
+        Kokkos::Impl::is_execution_policy<ExecutionPolicy>::value>::type* = 0) {
+#if KOKKOS_ENABLE_DEBUG_PRINT_KERNEL_NAMES
+  Kokkos::fence();
+  std::cout << "KOKKOS_DEBUG Start parallel_scan kernel: " << str << std::endl;
+#endif
+
+#if defined(KOKKOS_ENABLE_PROFILING)
+  uint64_t kpID = 0;
+  if (Kokkos::Profiling::profileLibraryLoaded()) {
+    static const std::string empty_label;
+    Kokkos::Impl::ParallelConstructName<FunctorType,
+                                        typename ExecutionPolicy::work_tag>
+        name(str && str[0] ? Kokkos::Profiling::internKernelName(str)
+                           : empty_label);
+    Kokkos::Profiling::beginParallelScan(name.get(), 0, &kpID);
+  }
+#endif
+
+  const Impl::AllocationAuditRegion allocation_audit(str);
+
+  Kokkos::Impl::shared_allocation_tracking_disable();
+  Impl::ParallelScan<FunctorType, ExecutionPolicy> closure(functor, policy);
+  Kokkos::Impl::shared_allocation_tracking_enable();
+
+  closure.execute();
+
+#if defined(KOKKOS_ENABLE_PROFILING)
+  if (Kokkos::Profiling::profileLibraryLoaded()) {
+    Kokkos::Profiling::endParallelScan(kpID);
+  }
+#endif
+
+#if KOKKOS_ENABLE_DEBUG_PRINT_KERNEL_NAMES
+  Kokkos::fence();
+  std::cout << "KOKKOS_DEBUG End parallel_scan kernel: " << str << std::endl;
+#endif
+  (void)str;
+}
+
 template <class ExecutionPolicy, class FunctorType, class ReturnType>
 inline void parallel_scan(
     const ExecutionPolicy& policy, const FunctorType& functor,
@@ -491,6 +963,8 @@ inline void parallel_scan(
   }
 #endif
 
+  const Impl::AllocationAuditRegion allocation_audit(str);
+
   Kokkos::Impl::shared_allocation_tracking_disable();
   Impl::ParallelScanWithTotal<FunctorType, ExecutionPolicy, ReturnType> closure(
       functor, policy, return_value);
@@ -523,6 +997,8 @@ inline void parallel_scan(const size_t work_count, const FunctorType& functor,
   }
 #endif
 
+  const Impl::AllocationAuditRegion allocation_audit(str);
+
   Kokkos::Impl::shared_allocation_tracking_disable();
   Impl::ParallelScanWithTotal<FunctorType, policy, ReturnType> closure(
       functor, policy(0, work_count), return_value);
@@ -556,6 +1032,77 @@ inline void parallel_scan(const std::string& str, const ExecutionPolicy& policy,
   (void)str;
 }
 
+// Character-literal overload of the scan-with-total form
+template <class ExecutionPolicy, class FunctorType, class ReturnType>
+inline void parallel_scan(
+    const char* str, const ExecutionPolicy& policy, const FunctorType& functor,
+    ReturnType& return_value,
+    typename Impl::enable_if<
+        Kokkos::Impl::is_execution_policy<ExecutionPolicy>::value>::type* =
+        0) {
+#if KOKKOS_ENABLE_DEBUG_PRINT_KERNEL_NAMES
+  Kokkos::fence();
+  std::cout << "KOKKOS_DEBUG Start parallel_scan kernel: " << str << std::endl;
+#endif
+
+#if defined(KOKKOS_ENABLE_PROFILING)
+  uint64_t kpID = 0;
+  if (Kokkos::Profiling::profileLibraryLoaded()) {
+    static const std::string empty_label;
+    Kokkos::Impl::ParallelConstructName<FunctorType,
+                                        typename ExecutionPolicy::work_tag>
+        name(str && str[0] ? Kokkos::Profiling::internKernelName(str)
+                           : empty_label);
+    Kokkos::Profiling::beginParallelScan(name.get(), 0, &kpID);
+  }
+#endif
+
+  const Impl::AllocationAuditRegion allocation_audit(str);
+
+  Kokkos::Impl::shared_allocation_tracking_disable();
+  Impl::ParallelScanWithTotal<FunctorType, ExecutionPolicy, ReturnType> closure(
+      functor, policy, return_value);
+  Kokkos::Impl::shared_allocation_tracking_enable();
+
+  closure.execute();
+
+#if defined(KOKKOS_ENABLE_PROFILING)
+  if (Kokkos::Profiling::profileLibraryLoaded()) {
+    Kokkos::Profiling::endParallelScan(kpID);
+  }
+#endif
+  Kokkos::fence();
+
+#if KOKKOS_ENABLE_DEBUG_PRINT_KERNEL_NAMES
+  Kokkos::fence();
+  std::cout << "KOKKOS_DEBUG End parallel_scan kernel: " << str << std::endl;
+#endif
+  (void)str;
+}
+
+template <class FunctorType, class IntType>
+inline void parallel_scan(
+    const char* str, const IntType work_count, const FunctorType& functor,
+    typename Impl::enable_if<std::is_integral<IntType>::value>::type* = 0) {
+  typedef typename Kokkos::Impl::FunctorPolicyExecutionSpace<
+      FunctorType, void>::execution_space execution_space;
+  typedef Kokkos::RangePolicy<execution_space> policy;
+
+  ::Kokkos::parallel_scan(str, policy(0, work_count), functor);
+}
+
+template <class FunctorType, class ReturnType, class IntType>
+inline void parallel_scan(
+    const char* str, const IntType work_count, const FunctorType& functor,
+    ReturnType& return_value,
+    typename Impl::enable_if<std::is_integral<IntType>::value>::type* = 0) {
+  typedef typename Kokkos::Impl::FunctorPolicyExecutionSpace<
+      FunctorType, void>::execution_space execution_space;
+  typedef Kokkos::RangePolicy<execution_space> policy;
+
+  ::Kokkos::parallel_scan(str, policy(0, work_count), functor, return_value);
+}
+
 }  // namespace Kokkos
 
 //----------------------------------------------------------------------------
@@ -595,4 +1142,68 @@ struct FunctorTeamShmemSize<
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
 
+namespace Kokkos {
+namespace Impl {
+
+// Composition of functors executed in sequence for each work item; used by
+// Kokkos::fuse to run stacked elementwise passes in one dispatch.
+template <class... Functors>
+struct FusedFunctor;
+
+template <class Functor>
+struct FusedFunctor<Functor> {
+  Functor m_functor;
+
+  FusedFunctor(const Functor& arg_functor) : m_functor(arg_functor) {}
+
+  template <class... Args>
+  KOKKOS_INLINE_FUNCTION void operator()(Args&&... args) const {
+    m_functor(args...);
+  }
+};
+
+template <class Functor, class... Rest>
+struct FusedFunctor<Functor, Rest...> {
+  Functor m_functor;
+  FusedFunctor<Rest...> m_rest;
+
+  FusedFunctor(const Functor& arg_functor, const Rest&... arg_rest)
+      : m_functor(arg_functor), m_rest(arg_rest...) {}
+
+  template <class... Args>
+  KOKKOS_INLINE_FUNCTION void operator()(Args&&... args) const {
+    m_functor(args...);
+    m_rest(args...);
+  }
+};
+
+}  // namespace Impl
+
+/** \brief  Execute several functors over the same policy in one dispatch.
+ *
+ *  Each work item invokes the functors in argument order, so back-to-back
+ *  bandwidth-bound passes over the same views pay for the memory traffic
+ *  once instead of once per pass.  By calling fuse the caller asserts that
+ *  for any index i no functor reads data another functor writes at an index
+ *  other than i; fused stages see each other's writes only at the same work
+ *  item and in argument order.
+ */
+template <class ExecPolicy, class... Functors>
+inline void fuse(const std::string& str, const ExecPolicy& policy,
+                 const Functors&... functors) {
+  Kokkos::parallel_for(str, policy, Impl::FusedFunctor<Functors...>(functors...));
+}
+
+template <class ExecPolicy, class... Functors>
+inline typename std::enable_if<
+    Kokkos::is_execution_policy<ExecPolicy>::value>::type
+fuse(const ExecPolicy& policy, const Functors&... functors) {
+  Kokkos::parallel_for(policy, Impl::FusedFunctor<Functors...>(functors...));
+}
+
+}  // namespace Kokkos
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
 #endif /* KOKKOS_PARALLEL_HPP */
@@ -0,0 +1,198 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_ParallelFind.hpp
+/// \brief Parallel first-hit search with cooperative cancellation.
+///
+/// Searches written as a full-range parallel_reduce with a Min
+/// reducer over indices always sweep the whole range, even when the
+/// hit sits in the first percent.  parallel_find processes the range
+/// in ascending chunks that poll a shared done flag: a worker checks
+/// the current best hit before each chunk and every few hundred
+/// iterations inside one, publishes a hit with an atomic compare-
+/// and-swap minimum, and abandons everything at or beyond it.  Workers
+/// whose chunks lie past the hit fall through almost immediately, so
+/// an early hit costs a small multiple of the distance to it rather
+/// than the full sweep.
+
+#ifndef KOKKOS_PARALLELFIND_HPP
+#define KOKKOS_PARALLELFIND_HPP
+
+#include <Kokkos_Core_fwd.hpp>
+#include <Kokkos_View.hpp>
+#include <Kokkos_Parallel.hpp>
+#include <Kokkos_Atomic.hpp>
+
+#include <string>
+
+namespace Kokkos {
+namespace Impl {
+
+template <class Predicate, class IndexType, class BestView>
+struct ParallelFindFunctor {
+  // Poll the shared best-hit between blocks of this many iterations:
+  // long enough to amortize the volatile read, short enough that a
+  // cancelled worker stops within a few microseconds
+  enum { poll_interval = 256 };
+
+  Predicate m_pred;
+  BestView m_best;
+  IndexType m_begin;
+  int64_t m_extent;
+  int64_t m_chunk;
+
+  ParallelFindFunctor(const Predicate& arg_pred, const BestView& arg_best,
+                      const IndexType arg_begin, const int64_t arg_extent,
+                      const int64_t arg_chunk)
+      : m_pred(arg_pred),
+        m_best(arg_best),
+        m_begin(arg_begin),
+        m_extent(arg_extent),
+        m_chunk(arg_chunk) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void publish(const int64_t hit) const {
+    int64_t cur = *((volatile int64_t*)&m_best());
+    while (hit < cur) {
+      const int64_t prev = atomic_compare_exchange(&m_best(), cur, hit);
+      if (prev == cur) break;
+      cur = prev;
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int64_t chunk) const {
+    const int64_t chunk_lo = chunk * m_chunk;
+    const int64_t chunk_hi =
+        chunk_lo + m_chunk < m_extent ? chunk_lo + m_chunk : m_extent;
+    for (int64_t lo = chunk_lo; lo < chunk_hi; lo += poll_interval) {
+      if (lo >= *((volatile int64_t*)&m_best())) return;
+      const int64_t hi =
+          lo + poll_interval < chunk_hi ? lo + poll_interval : chunk_hi;
+      for (int64_t i = lo; i < hi; ++i) {
+        if (m_pred(static_cast<IndexType>(m_begin + i))) {
+          publish(i);
+          return;
+        }
+      }
+    }
+  }
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+namespace Kokkos {
+namespace Experimental {
+
+/// \brief Return the smallest index in [policy.begin(), policy.end())
+///        for which pred(index) is true, or policy.end() if there is
+///        none.  Blocking.
+template <class ExecPolicy, class Predicate>
+typename ExecPolicy::member_type parallel_find(const std::string& label,
+                                               const ExecPolicy& policy,
+                                               const Predicate& pred) {
+  typedef typename ExecPolicy::execution_space execution_space;
+  typedef typename ExecPolicy::member_type index_type;
+  typedef Kokkos::View<int64_t, typename execution_space::memory_space>
+      best_view;
+
+  const index_type begin = policy.begin();
+  const index_type end   = policy.end();
+  const int64_t n        = int64_t(end) - int64_t(begin);
+  if (n <= 0) return end;
+
+  // A few chunks per worker bounds the wasted work behind an early
+  // hit without making the chunk loop itself the cost
+  const int64_t concurrency = execution_space::concurrency();
+  int64_t chunk             = (n + 4 * concurrency - 1) / (4 * concurrency);
+  if (chunk < Kokkos::Impl::ParallelFindFunctor<
+                  Predicate, index_type, best_view>::poll_interval)
+    chunk = Kokkos::Impl::ParallelFindFunctor<Predicate, index_type,
+                                              best_view>::poll_interval;
+  const int64_t nchunks = (n + chunk - 1) / chunk;
+
+  best_view best("Kokkos::parallel_find::best");
+  Kokkos::deep_copy(best, n);
+
+  Kokkos::Impl::ParallelFindFunctor<Predicate, index_type, best_view> functor(
+      pred, best, begin, n, chunk);
+  Kokkos::parallel_for(
+      label,
+      Kokkos::RangePolicy<execution_space, Kokkos::IndexType<int64_t>>(
+          0, nchunks),
+      functor);
+  execution_space().fence();
+
+  int64_t rel = n;
+  Kokkos::deep_copy(rel, best);
+  return rel < n ? static_cast<index_type>(begin + rel) : end;
+}
+
+template <class ExecPolicy, class Predicate>
+typename ExecPolicy::member_type parallel_find(const ExecPolicy& policy,
+                                               const Predicate& pred) {
+  return parallel_find("Kokkos::parallel_find", policy, pred);
+}
+
+/// \brief Work-count form over the default execution space.
+template <class Predicate>
+int64_t parallel_find(const std::string& label, const int64_t work_count,
+                      const Predicate& pred) {
+  return parallel_find(
+      label,
+      Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace,
+                          Kokkos::IndexType<int64_t>>(0, work_count),
+      pred);
+}
+
+template <class Predicate>
+int64_t parallel_find(const int64_t work_count, const Predicate& pred) {
+  return parallel_find("Kokkos::parallel_find", work_count, pred);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_PARALLELFIND_HPP */
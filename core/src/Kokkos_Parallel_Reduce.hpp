@@ -854,9 +854,30 @@ struct ParallelReduceAdaptor {
       typename PolicyType::execution_space>
       functor_adaptor;
 #endif
+  static inline void execute_impl(const PolicyType& policy,
+                                  const FunctorType& functor,
+                                  ReturnType& return_value) {
+    Kokkos::Impl::shared_allocation_tracking_disable();
+#ifdef KOKKOS_IMPL_NEED_FUNCTOR_WRAPPER
+    Impl::ParallelReduce<typename functor_adaptor::functor_type, PolicyType,
+                         typename return_value_adapter::reducer_type>
+        closure(functor_adaptor::functor(functor), policy,
+                return_value_adapter::return_value(return_value, functor));
+#else
+    Impl::ParallelReduce<FunctorType, PolicyType,
+                         typename return_value_adapter::reducer_type>
+        closure(functor, policy,
+                return_value_adapter::return_value(return_value, functor));
+#endif
+    Kokkos::Impl::shared_allocation_tracking_enable();
+    closure.execute();
+  }
+
   static inline void execute(const std::string& label, const PolicyType& policy,
                              const FunctorType& functor,
                              ReturnType& return_value) {
+    const Impl::AllocationAuditRegion allocation_audit(label);
+
 #if defined(KOKKOS_ENABLE_PROFILING)
     uint64_t kpID = 0;
     if (Kokkos::Profiling::profileLibraryLoaded()) {
@@ -867,20 +888,38 @@ struct ParallelReduceAdaptor {
     }
 #endif
 
-    Kokkos::Impl::shared_allocation_tracking_disable();
-#ifdef KOKKOS_IMPL_NEED_FUNCTOR_WRAPPER
-    Impl::ParallelReduce<typename functor_adaptor::functor_type, PolicyType,
-                         typename return_value_adapter::reducer_type>
-        closure(functor_adaptor::functor(functor), policy,
-                return_value_adapter::return_value(return_value, functor));
+    execute_impl(policy, functor, return_value);
+
+#if defined(KOKKOS_ENABLE_PROFILING)
+    if (Kokkos::Profiling::profileLibraryLoaded()) {
+      Kokkos::Profiling::endParallelReduce(kpID);
+    }
+#endif
+  }
+
+  // Character-literal form: with no tool attached no std::string is
+  // constructed; with one attached the label is interned once and
+  // repeated launches reuse the stored copy
+  static inline void execute(const char* label, const PolicyType& policy,
+                             const FunctorType& functor,
+                             ReturnType& return_value) {
+    const Impl::AllocationAuditRegion allocation_audit(label);
+
+#if defined(KOKKOS_ENABLE_PROFILING)
+    uint64_t kpID = 0;
+    if (Kokkos::Profiling::profileLibraryLoaded()) {
+      static const std::string empty_label;
+      Kokkos::Impl::ParallelConstructName<FunctorType,
+                                          typename PolicyType::work_tag>
+          name(label && label[0] ? Kokkos::Profiling::internKernelName(label)
+                                 : empty_label);
+      Kokkos::Profiling::beginParallelReduce(name.get(), 0, &kpID);
+    }
 #else
-    Impl::ParallelReduce<FunctorType, PolicyType,
-                         typename return_value_adapter::reducer_type>
-        closure(functor, policy,
-                return_value_adapter::return_value(return_value, functor));
+    (void)label;
 #endif
-    Kokkos::Impl::shared_allocation_tracking_enable();
-    closure.execute();
+
+    execute_impl(policy, functor, return_value);
 
 #if defined(KOKKOS_ENABLE_PROFILING)
     if (Kokkos::Profiling::profileLibraryLoaded()) {
@@ -1015,6 +1054,33 @@ inline void parallel_reduce(const std::string& label, const size_t& policy,
   Impl::ParallelReduceFence<ReturnType>::fence(return_value);
 }
 
+// Character-literal overloads: route the label to the adaptor as a
+// plain pointer so no std::string is constructed unless a tool is
+// attached (see ParallelReduceAdaptor::execute)
+
+template <class PolicyType, class FunctorType, class ReturnType>
+inline void parallel_reduce(
+    const char* label, const PolicyType& policy, const FunctorType& functor,
+    ReturnType& return_value,
+    typename Impl::enable_if<
+        Kokkos::Impl::is_execution_policy<PolicyType>::value>::type* = 0) {
+  Impl::ParallelReduceAdaptor<PolicyType, FunctorType, ReturnType>::execute(
+      label, policy, functor, return_value);
+  Impl::ParallelReduceFence<ReturnType>::fence(return_value);
+}
+
+template <class FunctorType, class ReturnType, class IntType>
+inline void parallel_reduce(
+    const char* label, const IntType policy, const FunctorType& functor,
+    ReturnType& return_value,
+    typename Impl::enable_if<std::is_integral<IntType>::value>::type* = 0) {
+  typedef typename Impl::ParallelReducePolicyType<
+      void, size_t, FunctorType>::policy_type policy_type;
+  Impl::ParallelReduceAdaptor<policy_type, FunctorType, ReturnType>::execute(
+      label, policy_type(0, policy), functor, return_value);
+  Impl::ParallelReduceFence<ReturnType>::fence(return_value);
+}
+
 // ReturnValue as View or Reducer: take by copy to allow for inline construction
 
 template <class PolicyType, class FunctorType, class ReturnType>
@@ -1064,6 +1130,31 @@ inline void parallel_reduce(const std::string& label, const size_t& policy,
   Impl::ParallelReduceFence<ReturnType>::fence(return_value);
 }
 
+template <class PolicyType, class FunctorType, class ReturnType>
+inline void parallel_reduce(
+    const char* label, const PolicyType& policy, const FunctorType& functor,
+    const ReturnType& return_value,
+    typename Impl::enable_if<
+        Kokkos::Impl::is_execution_policy<PolicyType>::value>::type* = 0) {
+  ReturnType return_value_impl = return_value;
+  Impl::ParallelReduceAdaptor<PolicyType, FunctorType, ReturnType>::execute(
+      label, policy, functor, return_value_impl);
+  Impl::ParallelReduceFence<ReturnType>::fence(return_value);
+}
+
+template <class FunctorType, class ReturnType, class IntType>
+inline void parallel_reduce(
+    const char* label, const IntType policy, const FunctorType& functor,
+    const ReturnType& return_value,
+    typename Impl::enable_if<std::is_integral<IntType>::value>::type* = 0) {
+  typedef typename Impl::ParallelReducePolicyType<
+      void, size_t, FunctorType>::policy_type policy_type;
+  ReturnType return_value_impl = return_value;
+  Impl::ParallelReduceAdaptor<policy_type, FunctorType, ReturnType>::execute(
+      label, policy_type(0, policy), functor, return_value_impl);
+  Impl::ParallelReduceFence<ReturnType>::fence(return_value);
+}
+
 // No Return Argument
 
 template <class PolicyType, class FunctorType>
@@ -1168,6 +1259,208 @@ inline void parallel_reduce(const std::string& label, const size_t& policy,
 
 }  // namespace Kokkos
 
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+namespace Impl {
+
+// Aggregate reduction value holding one slot per component reducer.
+template <class... Ts>
+struct CombinedReductionValue;
+
+template <class T>
+struct CombinedReductionValue<T> {
+  T head;
+};
+
+template <class T, class... Ts>
+struct CombinedReductionValue<T, Ts...> {
+  T head;
+  CombinedReductionValue<Ts...> tail;
+};
+
+template <size_t I>
+struct CombinedReductionGet {
+  template <class S>
+  KOKKOS_INLINE_FUNCTION static auto& get(S& s) {
+    return CombinedReductionGet<I - 1>::get(s.tail);
+  }
+};
+
+template <>
+struct CombinedReductionGet<0> {
+  template <class S>
+  KOKKOS_INLINE_FUNCTION static auto& get(S& s) {
+    return s.head;
+  }
+};
+
+// Reducer composing several component reducers: join and init apply each
+// component to its slot of the combined value, so one pass over memory
+// produces every result.
+template <class... Reducers>
+struct CombinedReducer {
+ public:
+  typedef CombinedReducer reducer;
+  typedef CombinedReductionValue<typename Reducers::value_type...> value_type;
+  typedef Kokkos::View<value_type, Kokkos::HostSpace,
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> >
+      result_view_type;
+
+ private:
+  CombinedReductionValue<Reducers...> m_reducers;
+  result_view_type m_value;
+
+  template <size_t... I>
+  KOKKOS_INLINE_FUNCTION void join_impl(value_type& dest,
+                                        const value_type& src,
+                                        std::index_sequence<I...>) const {
+    int dummy[] = {(CombinedReductionGet<I>::get(m_reducers)
+                        .join(CombinedReductionGet<I>::get(dest),
+                              CombinedReductionGet<I>::get(src)),
+                    0)...};
+    (void)dummy;
+  }
+
+  template <size_t... I>
+  KOKKOS_INLINE_FUNCTION void join_impl(volatile value_type& dest,
+                                        const volatile value_type& src,
+                                        std::index_sequence<I...>) const {
+    int dummy[] = {(CombinedReductionGet<I>::get(m_reducers)
+                        .join(CombinedReductionGet<I>::get(dest),
+                              CombinedReductionGet<I>::get(src)),
+                    0)...};
+    (void)dummy;
+  }
+
+  template <size_t... I>
+  KOKKOS_INLINE_FUNCTION void init_impl(value_type& val,
+                                        std::index_sequence<I...>) const {
+    int dummy[] = {(CombinedReductionGet<I>::get(m_reducers)
+                        .init(CombinedReductionGet<I>::get(val)),
+                    0)...};
+    (void)dummy;
+  }
+
+  template <size_t... I>
+  void scatter_impl(const value_type& val, std::index_sequence<I...>) const {
+    int dummy[] = {
+        (deep_copy(
+             CombinedReductionGet<I>::get(m_reducers).view(),
+             Kokkos::View<const typename Reducers::value_type,
+                          Kokkos::HostSpace,
+                          Kokkos::MemoryTraits<Kokkos::Unmanaged> >(
+                 &CombinedReductionGet<I>::get(val))),
+         0)...};
+    (void)dummy;
+  }
+
+ public:
+  KOKKOS_INLINE_FUNCTION
+  CombinedReducer(value_type& value_, const Reducers&... reducers)
+      : m_reducers{reducers...}, m_value(&value_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void join(value_type& dest, const value_type& src) const {
+    join_impl(dest, src, std::make_index_sequence<sizeof...(Reducers)>());
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void join(volatile value_type& dest, const volatile value_type& src) const {
+    join_impl(dest, src, std::make_index_sequence<sizeof...(Reducers)>());
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void init(value_type& val) const {
+    init_impl(val, std::make_index_sequence<sizeof...(Reducers)>());
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  value_type& reference() const { return *m_value.data(); }
+
+  KOKKOS_INLINE_FUNCTION
+  result_view_type view() const { return m_value; }
+
+  KOKKOS_INLINE_FUNCTION
+  bool references_scalar() const { return true; }
+
+  // Host-side: copy each slot of the combined result into the view or
+  // scalar the corresponding component reducer references.
+  void copy_result_to_components(const value_type& val) const {
+    scatter_impl(val, std::make_index_sequence<sizeof...(Reducers)>());
+  }
+};
+
+// Adapts a functor taking one reference per component reducer to the single
+// combined-value signature the reduction drivers expect.
+template <class FunctorType, class... Reducers>
+struct CombinedReductionFunctor {
+  typedef CombinedReductionValue<typename Reducers::value_type...> value_type;
+
+  FunctorType m_functor;
+
+  CombinedReductionFunctor(const FunctorType& functor) : m_functor(functor) {}
+
+  template <class Index, size_t... I>
+  KOKKOS_INLINE_FUNCTION void invoke(const Index& i, value_type& val,
+                                     std::index_sequence<I...>) const {
+    m_functor(i, CombinedReductionGet<I>::get(val)...);
+  }
+
+  template <class Index>
+  KOKKOS_INLINE_FUNCTION void operator()(const Index& i,
+                                         value_type& val) const {
+    invoke(i, val, std::make_index_sequence<sizeof...(Reducers)>());
+  }
+};
+
+}  // namespace Impl
+
+/** \brief  parallel_reduce with several reducers evaluated in one pass.
+ *
+ *  The functor takes one reference per reducer after the index, e.g.
+ *    parallel_reduce("stats", policy, functor, Sum(s), Min(mn), Max(mx));
+ *  with functor(i, sum_update, min_update, max_update).  All component
+ *  reductions share a single sweep over memory; each reducer's result is
+ *  written to its referenced scalar or view after the dispatch.
+ */
+template <class PolicyType, class FunctorType, class Reducer1, class Reducer2,
+          class... Reducers>
+inline typename std::enable_if<
+    Kokkos::is_reducer_type<Reducer1>::value &&
+    Kokkos::is_reducer_type<Reducer2>::value>::type
+parallel_reduce(const std::string& label, const PolicyType& policy,
+                const FunctorType& functor, const Reducer1& reducer1,
+                const Reducer2& reducer2, const Reducers&... reducers) {
+  typedef Impl::CombinedReducer<Reducer1, Reducer2, Reducers...>
+      combined_reducer_type;
+  typename combined_reducer_type::value_type value;
+  combined_reducer_type combined_reducer(value, reducer1, reducer2,
+                                         reducers...);
+  Kokkos::parallel_reduce(
+      label, policy,
+      Impl::CombinedReductionFunctor<FunctorType, Reducer1, Reducer2,
+                                     Reducers...>(functor),
+      combined_reducer);
+  Kokkos::fence();
+  combined_reducer.copy_result_to_components(value);
+}
+
+template <class PolicyType, class FunctorType, class Reducer1, class Reducer2,
+          class... Reducers>
+inline typename std::enable_if<
+    Kokkos::is_reducer_type<Reducer1>::value &&
+    Kokkos::is_reducer_type<Reducer2>::value>::type
+parallel_reduce(const PolicyType& policy, const FunctorType& functor,
+                const Reducer1& reducer1, const Reducer2& reducer2,
+                const Reducers&... reducers) {
+  parallel_reduce("", policy, functor, reducer1, reducer2, reducers...);
+}
+
+}  // namespace Kokkos
+
+//----------------------------------------------------------------------------
+
 #ifdef KOKKOS_ENABLE_DEPRECATED_CODE
 // backwards compatiblity for Kokkos::Experimental reducers
 namespace Kokkos {
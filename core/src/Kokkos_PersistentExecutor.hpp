@@ -0,0 +1,195 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_PersistentExecutor.hpp
+/// \brief Resident worker pool for latency-critical small dispatches.
+///
+/// Launching a regular parallel_for costs more than the work when the
+/// kernel itself runs for a few microseconds: the dispatch allocates,
+/// wakes the backend's thread pool, and joins it again.  A
+/// PersistentExecutor keeps its own workers resident and spinning on a
+/// lock-free mailbox; parallel_for publishes a work descriptor with two
+/// atomic stores and the workers pick up chunks immediately, cutting
+/// dispatch latency to well under a microsecond.
+///
+/// The executor owns its threads for its whole lifetime and the
+/// workers busy-wait between dispatches, so create one for an opted-in
+/// latency-critical kernel set and keep it - this is a deliberate
+/// trade of idle CPU for dispatch latency, not a general replacement
+/// for the execution-space backends.
+
+#ifndef KOKKOS_PERSISTENTEXECUTOR_HPP
+#define KOKKOS_PERSISTENTEXECUTOR_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <impl/Kokkos_Error.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  Resident spinning worker pool with a lock-free mailbox.
+ *
+ *  parallel_for(n, f) runs f(i) for i in [0, n) across the resident
+ *  workers plus the calling thread and returns when every iteration
+ *  has completed; dispatches are synchronous and may only be issued
+ *  from one thread at a time.  The functor is referenced in place, not
+ *  copied, which keeps the mailbox write constant-time.
+ */
+class PersistentExecutor {
+ public:
+  /// \brief Spawn arg_worker_count resident workers; by default one
+  ///        per hardware thread beyond the calling thread.
+  explicit PersistentExecutor(int arg_worker_count = -1)
+      : m_epoch(0),
+        m_next(0),
+        m_done(0),
+        m_stop(false),
+        m_invoke(nullptr),
+        m_functor(nullptr),
+        m_extent(0),
+        m_nchunks(0),
+        m_chunk(0) {
+    if (arg_worker_count < 0) {
+      const unsigned hw = std::thread::hardware_concurrency();
+      arg_worker_count  = hw > 1 ? int(hw) - 1 : 1;
+    }
+    m_workers.reserve(arg_worker_count);
+    for (int i = 0; i < arg_worker_count; ++i) {
+      m_workers.emplace_back([this] { worker_loop(); });
+    }
+  }
+
+  PersistentExecutor(const PersistentExecutor&) = delete;
+  PersistentExecutor& operator=(const PersistentExecutor&) = delete;
+
+  ~PersistentExecutor() {
+    m_stop.store(true, std::memory_order_release);
+    for (std::thread& worker : m_workers) worker.join();
+  }
+
+  int concurrency() const { return int(m_workers.size()) + 1; }
+
+  /// \brief Run f(i) for i in [0, n); returns when all iterations are
+  ///        done.
+  template <class Functor>
+  void parallel_for(const int n, const Functor& f) {
+    if (n <= 0) return;
+
+    const int participants = concurrency();
+
+    // One chunk per participant minimizes mailbox traffic; small
+    // dispatches are the whole point here
+    m_chunk   = (n + participants - 1) / participants;
+    m_nchunks = (n + m_chunk - 1) / m_chunk;
+    m_extent  = n;
+    m_functor = &f;
+    m_invoke  = &invoke_functor<Functor>;
+
+    m_done.store(0, std::memory_order_relaxed);
+    m_next.store(0, std::memory_order_relaxed);
+    // Publish: workers spin on the epoch
+    m_epoch.fetch_add(1, std::memory_order_release);
+
+    participate();
+
+    // Wait until every worker has drained the mailbox for this epoch,
+    // so the descriptor may be overwritten by the next dispatch
+    const int workers = participants - 1;
+    while (m_done.load(std::memory_order_acquire) != workers) {
+      std::this_thread::yield();
+    }
+  }
+
+ private:
+  template <class Functor>
+  static void invoke_functor(const void* arg_functor, const int begin,
+                             const int end) {
+    const Functor& f = *static_cast<const Functor*>(arg_functor);
+    for (int i = begin; i < end; ++i) f(i);
+  }
+
+  void participate() {
+    for (;;) {
+      const int c = m_next.fetch_add(1, std::memory_order_relaxed);
+      if (c >= m_nchunks) break;
+      const int begin = c * m_chunk;
+      const int end   = begin + m_chunk < m_extent ? begin + m_chunk : m_extent;
+      (*m_invoke)(m_functor, begin, end);
+    }
+  }
+
+  void worker_loop() {
+    uint64_t seen = 0;
+    for (;;) {
+      while (m_epoch.load(std::memory_order_acquire) == seen) {
+        if (m_stop.load(std::memory_order_acquire)) return;
+        std::this_thread::yield();
+      }
+      seen = m_epoch.load(std::memory_order_relaxed);
+      participate();
+      m_done.fetch_add(1, std::memory_order_release);
+    }
+  }
+
+  std::vector<std::thread> m_workers;
+  std::atomic<uint64_t> m_epoch;
+  std::atomic<int> m_next;
+  std::atomic<int> m_done;
+  std::atomic<bool> m_stop;
+  void (*m_invoke)(const void*, int, int);
+  const void* m_functor;
+  int m_extent;
+  int m_nchunks;
+  int m_chunk;
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_PERSISTENTEXECUTOR_HPP */
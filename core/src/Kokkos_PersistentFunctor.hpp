@@ -0,0 +1,171 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_PERSISTENTFUNCTOR_HPP
+#define KOKKOS_PERSISTENTFUNCTOR_HPP
+
+#include <Kokkos_Core_fwd.hpp>
+#include <Kokkos_View.hpp>
+#include <Kokkos_CopyViews.hpp>
+
+#include <string>
+#include <utility>
+
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+namespace Impl {
+
+/** \brief  Thin device-side proxy for a functor resident in device memory.
+ *
+ *  Captures only the address of the uploaded functor, so the per-launch
+ *  argument marshalled by the backend is one pointer regardless of how
+ *  much state the wrapped functor carries.  Every call operator forwards
+ *  to the resident copy.
+ */
+template <class FunctorType>
+struct PersistentFunctorRef {
+  const FunctorType* m_ptr;
+
+  template <class... Args>
+  KOKKOS_FORCEINLINE_FUNCTION void operator()(Args&&... args) const {
+    (*m_ptr)(std::forward<Args>(args)...);
+  }
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  A functor uploaded once to device-resident storage and
+ *          launched by reference.
+ *
+ *  Dispatch copies the functor into the launch arguments every time it
+ *  runs; for operators that capture a large state (many Views of
+ *  coefficients) and are launched at high rates, that per-launch copy is
+ *  pure overhead because the state never changes between launches.
+ *
+ *  A PersistentFunctor keeps the authoritative copy on the host and a
+ *  byte-for-byte replica in the execution space's memory.  get() hands
+ *  back a proxy capturing only the replica's address, so the state
+ *  crosses to the device once instead of once per launch:
+ *
+ *  \code
+ *    Kokkos::Experimental::PersistentFunctor<Op> op("apply_A", make_op());
+ *    for (int iter = 0; iter < num_iters; ++iter)
+ *      Kokkos::parallel_for(policy, op.get());
+ *  \endcode
+ *
+ *  Mutating the host copy through host() marks the replica stale; the
+ *  next get() (or an explicit sync()) re-uploads it.  The upload has the
+ *  same byte-copy semantics the dispatch layer already applies to
+ *  functors, so anything legal to launch is legal to persist.
+ *
+ *  The proxy forwards its call operators but not nested typedefs, so use
+ *  it with parallel_for; reductions deduce value_type from the functor
+ *  type and should keep launching the functor directly.
+ */
+template <class FunctorType,
+          class Space = Kokkos::DefaultExecutionSpace::memory_space>
+class PersistentFunctor {
+ public:
+  typedef FunctorType functor_type;
+  typedef Space memory_space;
+  typedef Kokkos::Impl::PersistentFunctorRef<FunctorType> reference_type;
+
+ private:
+  // Rank-zero views of the functor bytes; construction and destruction
+  // are skipped because the replica is written only by byte copies from
+  // the host original, exactly as a launch would.
+  typedef Kokkos::View<FunctorType, memory_space> device_copy_type;
+  typedef Kokkos::View<const FunctorType, Kokkos::HostSpace,
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged>>
+      host_wrapper_type;
+
+  FunctorType m_host;
+  device_copy_type m_device;
+  bool m_modified;
+
+ public:
+  PersistentFunctor(const std::string& label, const FunctorType& functor)
+      : m_host(functor),
+        m_device(Kokkos::view_alloc(label, Kokkos::WithoutInitializing)),
+        m_modified(true) {}
+
+  /// \brief The host-side copy, for in-place mutation between launches.
+  ///
+  /// Marks the device replica stale; it is refreshed by the next get()
+  /// or sync().  Do not mutate while a launch referencing the replica is
+  /// still in flight.
+  FunctorType& host() {
+    m_modified = true;
+    return m_host;
+  }
+
+  //! Re-upload the host copy if it has been modified since the last one.
+  void sync() {
+    if (m_modified) {
+      Kokkos::deep_copy(m_device, host_wrapper_type(&m_host));
+      m_modified = false;
+    }
+  }
+
+  /// \brief Proxy to pass to parallel_for in place of the functor.
+  ///
+  /// Uploads first when the host copy is stale, so a launch never
+  /// observes a partially updated replica.
+  reference_type get() {
+    sync();
+    return reference_type{m_device.data()};
+  }
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_PERSISTENTFUNCTOR_HPP */
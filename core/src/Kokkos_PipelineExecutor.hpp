@@ -0,0 +1,187 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_PipelineExecutor.hpp
+/// \brief Chunked software pipelining across a chain of kernel stages.
+///
+/// A fixed chain of kernels with intermediates sized for the full
+/// problem either exhausts memory or, processed in chunks, leaves the
+/// device idle between stages while each chunk traverses the chain
+/// serially.  PipelineExecutor owns the chunking and the staging:
+/// stages are declared in order, every edge between consecutive stages
+/// gets two chunk-sized buffers, and run() advances a software
+/// pipeline in which step t executes stage s on chunk t - s.  Within a
+/// step every eligible stage launches on its own execution space
+/// instance against its own buffer pair, so on backends with
+/// concurrent instances the stages of different chunks overlap; one
+/// fence per step enforces the cross-step dependences, which the
+/// double buffering reduces to exactly that barrier.
+///
+/// Intermediates are rank-1 Views of one value type, the common case
+/// for signal chains; stages needing richer state capture it.  For
+/// host/device staging of pipeline endpoints see
+/// Kokkos_PipelineBuffer.hpp.
+
+#ifndef KOKKOS_PIPELINEEXECUTOR_HPP
+#define KOKKOS_PIPELINEEXECUTOR_HPP
+
+#include <Kokkos_Core_fwd.hpp>
+#include <Kokkos_View.hpp>
+#include <impl/Kokkos_Error.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  Executor software-pipelining a linear chain of kernel
+ *          stages over chunks, with double-buffered intermediates.
+ *
+ *  A stage is a callable launching its kernel(s) on the given instance
+ *  for one chunk:
+ *
+ *    void stage(const execution_space& exec, const buffer_type& in,
+ *               const buffer_type& out, int64_t chunk);
+ *
+ *  The first stage receives an unallocated 'in' (it produces from its
+ *  captured source), the last an unallocated 'out' (it consumes into
+ *  its captured sink); interior stages read 'in' and fill 'out', both
+ *  of the chunk capacity declared at construction.  Work launched by a
+ *  stage must go to the instance it was handed and must not fence -
+ *  the executor owns synchronization:
+ *
+ *  \code
+ *    Kokkos::Experimental::PipelineExecutor<float> chain("filter", 4096);
+ *    chain.add_stage(load);     // (exec, unused, out, chunk)
+ *    chain.add_stage(window);   // (exec, in, out, chunk)
+ *    chain.add_stage(store);    // (exec, in, unused, chunk)
+ *    chain.run(num_chunks);
+ *  \endcode
+ */
+template <class ValueType, class ExecSpace = Kokkos::DefaultExecutionSpace>
+class PipelineExecutor {
+ public:
+  typedef ExecSpace execution_space;
+  typedef Kokkos::View<ValueType*, typename ExecSpace::memory_space>
+      buffer_type;
+  typedef std::function<void(const execution_space&, const buffer_type&,
+                             const buffer_type&, int64_t)>
+      stage_type;
+
+ private:
+  std::string m_label;
+  size_t m_chunk_capacity;
+  std::vector<stage_type> m_stages;
+  std::vector<buffer_type> m_edges;  // two buffers per edge: [2*e + c%2]
+  std::vector<execution_space> m_exec;
+
+ public:
+  PipelineExecutor(const std::string& label, const size_t chunk_capacity)
+      : m_label(label), m_chunk_capacity(chunk_capacity) {
+    if (chunk_capacity == 0) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::PipelineExecutor requires a nonzero chunk "
+          "capacity");
+    }
+  }
+
+  //! Number of stages declared so far.
+  int num_stages() const { return int(m_stages.size()); }
+
+  //! The chunk capacity every edge buffer is allocated with.
+  size_t chunk_capacity() const { return m_chunk_capacity; }
+
+  /// \brief Append a stage; an edge with two chunk-sized buffers is
+  ///        allocated between it and the previously added stage.
+  void add_stage(const stage_type& stage) {
+    if (!m_stages.empty()) {
+      const size_t e = m_edges.size() / 2;
+      for (int buf = 0; buf < 2; ++buf) {
+        m_edges.push_back(buffer_type(
+            m_label + " [edge " + std::to_string(e) + "." +
+                std::to_string(buf) + "]",
+            m_chunk_capacity));
+      }
+    }
+    m_stages.push_back(stage);
+    m_exec.push_back(execution_space());
+  }
+
+  /// \brief Run the chain over num_chunks chunks.
+  ///
+  /// Step t launches stage s on chunk t - s for every stage with a
+  /// chunk in flight, each on its own instance, then fences them all;
+  /// chunks retire in order.  Returns with the pipeline drained.
+  void run(const int64_t num_chunks) const {
+    const int64_t stages = int64_t(m_stages.size());
+    if (stages == 0 || num_chunks <= 0) return;
+
+    const buffer_type unused;
+
+    for (int64_t t = 0; t < num_chunks + stages - 1; ++t) {
+      // Launch deepest stage first so earlier stages' submissions do
+      // not delay the chunk closest to retiring.
+      for (int64_t s = stages - 1; 0 <= s; --s) {
+        const int64_t chunk = t - s;
+        if (chunk < 0 || num_chunks <= chunk) continue;
+
+        const buffer_type& in =
+            0 < s ? m_edges[2 * (s - 1) + (chunk % 2)] : unused;
+        const buffer_type& out =
+            s < stages - 1 ? m_edges[2 * s + (chunk % 2)] : unused;
+
+        m_stages[s](m_exec[s], in, out, chunk);
+      }
+      for (int64_t s = 0; s < stages; ++s) m_exec[s].fence();
+    }
+  }
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_PIPELINEEXECUTOR_HPP */
@@ -0,0 +1,327 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_PoolAllocator.hpp
+/// \brief Instrumented MemoryPool facade with size-class telemetry.
+///
+/// MemoryPool takes four sizing parameters (total, min block, max block,
+/// superblock) and mis-choosing them is expensive: a min block far below
+/// the real traffic inflates the per-superblock bitset that allocate()
+/// must search, while a max block below the largest request aborts the
+/// kernel.  InstrumentedMemoryPool wraps MemoryPool and records a
+/// histogram of allocation requests by power-of-two size class, so one
+/// representative run yields the block-size bounds directly instead of a
+/// trial-and-error search.  The facade is a value type like MemoryPool
+/// itself: give each execution space instance its own copy to keep the
+/// telemetry per stream.
+
+#ifndef KOKKOS_POOLALLOCATOR_HPP
+#define KOKKOS_POOLALLOCATOR_HPP
+
+#include <Kokkos_Core_fwd.hpp>
+#include <Kokkos_MemoryPool.hpp>
+#include <Kokkos_Atomic.hpp>
+#include <Kokkos_View.hpp>
+#include <impl/Kokkos_MemoryPoolAllocator.hpp>
+
+namespace Kokkos {
+namespace Experimental {
+
+template <typename DeviceType>
+class InstrumentedMemoryPool {
+ public:
+  typedef Kokkos::MemoryPool<DeviceType> pool_type;
+  typedef typename DeviceType::memory_space memory_space;
+  typedef typename DeviceType::execution_space execution_space;
+
+ private:
+  enum : uint32_t { num_size_classes = 32 };
+  enum : uint32_t { failure_slot = num_size_classes };
+  enum : uint32_t { oversize_slot = num_size_classes + 1 };
+  enum : uint32_t { num_counters = num_size_classes + 2 };
+
+  typedef Kokkos::View<uint64_t *, DeviceType> counters_type;
+
+  pool_type m_pool;
+  counters_type m_counters;
+
+ public:
+  //--------------------------------------------------------------------------
+
+  KOKKOS_INLINE_FUNCTION InstrumentedMemoryPool()      = default;
+  KOKKOS_INLINE_FUNCTION InstrumentedMemoryPool(InstrumentedMemoryPool &&) =
+      default;
+  KOKKOS_INLINE_FUNCTION
+  InstrumentedMemoryPool(const InstrumentedMemoryPool &) = default;
+  KOKKOS_INLINE_FUNCTION
+  InstrumentedMemoryPool &operator=(InstrumentedMemoryPool &&) = default;
+  KOKKOS_INLINE_FUNCTION
+  InstrumentedMemoryPool &operator=(const InstrumentedMemoryPool &) = default;
+
+  /**\brief  Allocate an instrumented memory pool from 'memspace'.
+   *
+   *  Sizing arguments are forwarded to MemoryPool unchanged; omit the
+   *  block sizes to accept the MemoryPool defaults and let the recorded
+   *  histogram drive a tuned rebuild via create_tuned_pool().
+   */
+  InstrumentedMemoryPool(const memory_space &memspace,
+                         const size_t min_total_alloc_size,
+                         size_t min_block_alloc_size = 0,
+                         size_t max_block_alloc_size = 0,
+                         size_t min_superblock_size  = 0)
+      : m_pool(memspace, min_total_alloc_size, min_block_alloc_size,
+               max_block_alloc_size, min_superblock_size),
+        m_counters("InstrumentedMemoryPool::counters", num_counters) {}
+
+  /**\brief  Attach telemetry to an existing pool. */
+  explicit InstrumentedMemoryPool(const pool_type &arg_pool)
+      : m_pool(arg_pool),
+        m_counters("InstrumentedMemoryPool::counters", num_counters) {}
+
+  KOKKOS_INLINE_FUNCTION
+  bool operator==(InstrumentedMemoryPool const &other) const {
+    return m_pool == other.m_pool;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  const pool_type &pool() const noexcept { return m_pool; }
+
+  KOKKOS_INLINE_FUNCTION
+  size_t capacity() const noexcept { return m_pool.capacity(); }
+
+  KOKKOS_INLINE_FUNCTION
+  size_t min_block_size() const noexcept { return m_pool.min_block_size(); }
+
+  KOKKOS_INLINE_FUNCTION
+  size_t max_block_size() const noexcept { return m_pool.max_block_size(); }
+
+  //--------------------------------------------------------------------------
+  /**\brief  Allocate a block of memory that is at least 'alloc_size',
+   *         recording the request in the size-class histogram.
+   *
+   *  Unlike MemoryPool::allocate, a request larger than the pool's
+   *  maximum block size returns nullptr instead of aborting, after
+   *  recording the request; a profiling run with a mis-sized pool must
+   *  survive long enough to report the sizes it actually needed.
+   */
+  KOKKOS_FUNCTION
+  void *allocate(size_t alloc_size, int32_t attempt_limit = 1) const noexcept {
+    if (0 == alloc_size) return (void *)0;
+
+    const unsigned size_lg2 = Kokkos::Impl::integral_power_of_two_that_contains(
+        unsigned(alloc_size));
+
+    Kokkos::atomic_increment(&m_counters(size_lg2 < num_size_classes
+                                             ? size_lg2
+                                             : num_size_classes - 1));
+
+    if (m_pool.max_block_size() < alloc_size) {
+      Kokkos::atomic_increment(&m_counters(oversize_slot));
+      Kokkos::atomic_increment(&m_counters(failure_slot));
+      return (void *)0;
+    }
+
+    void *const p = m_pool.allocate(alloc_size, attempt_limit);
+
+    if (0 == p) Kokkos::atomic_increment(&m_counters(failure_slot));
+
+    return p;
+  }
+
+  /**\brief  Return an allocated block of memory to the pool.
+   *
+   *  Requires: p is return value from allocate( alloc_size );
+   */
+  KOKKOS_INLINE_FUNCTION
+  void deallocate(void *p, size_t alloc_size) const noexcept {
+    m_pool.deallocate(p, alloc_size);
+  }
+
+  //--------------------------------------------------------------------------
+
+  struct allocation_statistics {
+    size_t min_block_bytes;  ///<  Current minimum block size in bytes
+    size_t max_block_bytes;  ///<  Current maximum block size in bytes
+    uint64_t request_count;  ///<  Total allocation requests recorded
+    uint64_t failure_count;  ///<  Requests that returned nullptr
+    uint64_t oversize_count;  ///<  Requests above the maximum block size
+    uint64_t size_class_count[num_size_classes];  ///<  Requests of size
+                                                  ///   contained by 2^k bytes
+  };
+
+  /**\brief  Snapshot the request histogram accumulated since
+   *         construction or the last clear_allocation_statistics().
+   */
+  void get_allocation_statistics(allocation_statistics &stats) const {
+    uint64_t host_counters[num_counters];
+
+    Kokkos::Impl::DeepCopy<Kokkos::HostSpace, memory_space>(
+        host_counters, m_counters.data(), num_counters * sizeof(uint64_t));
+    Kokkos::fence();
+
+    stats.min_block_bytes = m_pool.min_block_size();
+    stats.max_block_bytes = m_pool.max_block_size();
+    stats.request_count   = 0;
+    stats.failure_count   = host_counters[failure_slot];
+    stats.oversize_count  = host_counters[oversize_slot];
+
+    for (uint32_t k = 0; k < num_size_classes; ++k) {
+      stats.size_class_count[k] = host_counters[k];
+      stats.request_count += host_counters[k];
+    }
+  }
+
+  /**\brief  Reset the request histogram to zero.
+   *
+   *  Requires: no concurrent allocate() calls.
+   */
+  void clear_allocation_statistics() const {
+    Kokkos::deep_copy(m_counters, uint64_t(0));
+  }
+
+  //--------------------------------------------------------------------------
+  /**\brief  Smallest block size covering the recorded traffic.
+   *
+   *  Size classes carrying less than 1/128 of all requests are dropped
+   *  from the low end: rounding that trace of tiny requests up to the
+   *  next class wastes little memory, while honoring them would double
+   *  the per-superblock block count - and the ConcurrentBitset words
+   *  allocate() searches - for every halving of the minimum block size.
+   *  Returns zero (defer to the MemoryPool default) when no requests
+   *  have been recorded.
+   */
+  size_t recommended_min_block_size() const {
+    allocation_statistics stats;
+    get_allocation_statistics(stats);
+
+    if (0 == stats.request_count) return 0;
+
+    const uint64_t threshold = 1 + stats.request_count / 128;
+
+    unsigned k_min = 0;
+    for (unsigned k = 0; k < num_size_classes; ++k) {
+      if (stats.size_class_count[k]) {
+        k_min = k;
+        if (threshold <= stats.size_class_count[k]) break;
+      }
+    }
+    return size_t(1) << k_min;
+  }
+
+  /**\brief  Smallest block size admitting every recorded request.
+   *
+   *  Oversize requests are recorded at their true size class, so the
+   *  recommendation from a failed run grows to cover them.  Returns
+   *  zero when no requests have been recorded.
+   */
+  size_t recommended_max_block_size() const {
+    allocation_statistics stats;
+    get_allocation_statistics(stats);
+
+    for (unsigned k = num_size_classes; k-- > 0;) {
+      if (stats.size_class_count[k]) return size_t(1) << k;
+    }
+    return 0;
+  }
+
+  /**\brief  Construct a pool of at least 'min_total_alloc_size' bytes
+   *         in 'memspace' with block sizes tuned to the recorded
+   *         request histogram.
+   *
+   *  The superblock size is chosen to hold 1024 blocks of the most
+   *  requested size class, clamped to the MemoryPool constraints
+   *  (at least one maximum-size block, at most the total size and the
+   *  per-superblock bitset capacity).  With no recorded requests the
+   *  MemoryPool defaults apply.
+   */
+  pool_type create_tuned_pool(const memory_space &memspace,
+                              const size_t min_total_alloc_size) const {
+    allocation_statistics stats;
+    get_allocation_statistics(stats);
+
+    if (0 == stats.request_count) {
+      return pool_type(memspace, min_total_alloc_size);
+    }
+
+    const size_t min_block = recommended_min_block_size();
+    size_t max_block       = recommended_max_block_size();
+
+    if (min_total_alloc_size < max_block) max_block = min_total_alloc_size;
+
+    unsigned k_mode    = 0;
+    uint64_t mode_freq = 0;
+    for (unsigned k = 0; k < num_size_classes; ++k) {
+      if (mode_freq < stats.size_class_count[k]) {
+        mode_freq = stats.size_class_count[k];
+        k_mode    = k;
+      }
+    }
+
+    size_t superblock = size_t(1) << (k_mode + 10); /* 1024 mode blocks */
+
+    if (superblock < max_block) superblock = max_block;
+    if (min_total_alloc_size < superblock) superblock = min_total_alloc_size;
+    {
+      const size_t bitset_limit =
+          min_block * pool_type::max_block_per_superblock;
+      if (bitset_limit < superblock) superblock = bitset_limit;
+    }
+    if (superblock < max_block) superblock = max_block;
+
+    return pool_type(memspace, min_total_alloc_size, min_block, max_block,
+                     superblock);
+  }
+};
+
+/**\brief  Allocator facade over an instrumented pool, for containers
+ *         parameterized on an allocator type.
+ */
+template <typename DeviceType, typename T>
+using PoolAllocator =
+    Kokkos::Impl::MemoryPoolAllocator<InstrumentedMemoryPool<DeviceType>, T>;
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_POOLALLOCATOR_HPP
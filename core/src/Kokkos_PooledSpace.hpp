@@ -0,0 +1,496 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+#ifndef KOKKOS_POOLEDSPACE_HPP
+#define KOKKOS_POOLEDSPACE_HPP
+
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+
+#include <Kokkos_Core_fwd.hpp>
+#include <Kokkos_Concepts.hpp>
+#include <Kokkos_AnonymousSpace.hpp>
+#include <Kokkos_MemoryPool.hpp>
+#include <impl/Kokkos_SharedAlloc.hpp>
+#include <Kokkos_MemoryAccounting.hpp>
+#include <impl/Kokkos_MemorySpace.hpp>
+#include <impl/Kokkos_Error.hpp>
+#if defined(KOKKOS_ENABLE_PROFILING)
+#include <impl/Kokkos_Profiling_Interface.hpp>
+#endif
+
+/*--------------------------------------------------------------------------*/
+
+namespace Kokkos {
+// Declared in Kokkos_Core.hpp, which cannot be included from here.
+void push_finalize_hook(std::function<void()>);
+}  // namespace Kokkos
+
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  Memory space adapter routing tracked allocations through a
+ *          process-wide Kokkos::MemoryPool of the base memory space.
+ *
+ *  A View declared as
+ *
+ *    View< double * , PooledSpace< SomeSpace > >
+ *
+ *  behaves exactly as a View in SomeSpace except that allocations no
+ *  larger than the pool's maximum block size are served from a shared
+ *  MemoryPool superblock instead of calling into the base space's
+ *  allocator.  In steady state an allocate/free cycle is then a
+ *  lock-free bitset update rather than a malloc or driver call, which
+ *  matters for codes that create and destroy many short-lived Views
+ *  per iteration.
+ *
+ *  Allocations larger than the maximum block size, and allocations made
+ *  when the pool is exhausted, fall back to the base space allocator.
+ *  The pool is created on first use; its capacity defaults to 64MB and
+ *  its maximum block size to 1MB, overridable with the environment
+ *  variables KOKKOS_POOLED_SPACE_CAPACITY and
+ *  KOKKOS_POOLED_SPACE_MAX_BLOCK (both in bytes).
+ *
+ *  The pool's bookkeeping is updated by the allocating thread, so the
+ *  base memory space must be host accessible; e.g. HostSpace,
+ *  CudaUVMSpace or CudaHostPinnedSpace, but not CudaSpace.
+ */
+template <class BaseSpace>
+class PooledSpace {
+  static_assert(
+      Kokkos::Impl::MemorySpaceAccess<Kokkos::HostSpace,
+                                      BaseSpace>::accessible,
+      "Kokkos::Experimental::PooledSpace requires a host accessible base "
+      "memory space: allocation happens on the host");
+
+ public:
+  //! Tag this class as a kokkos memory space
+  typedef PooledSpace memory_space;
+  typedef typename BaseSpace::execution_space execution_space;
+  typedef typename BaseSpace::size_type size_type;
+
+  //! This memory space preferred device_type
+  typedef Kokkos::Device<execution_space, memory_space> device_type;
+
+  //! The base memory space being pooled
+  typedef BaseSpace base_space;
+
+  typedef Kokkos::MemoryPool<
+      Kokkos::Device<Kokkos::DefaultHostExecutionSpace, BaseSpace>>
+      pool_type;
+
+  PooledSpace()                   = default;
+  PooledSpace(PooledSpace&&)      = default;
+  PooledSpace(const PooledSpace&) = default;
+  PooledSpace& operator=(PooledSpace&&) = default;
+  PooledSpace& operator=(const PooledSpace&) = default;
+  ~PooledSpace()                             = default;
+
+  /**\brief  Allocate untracked memory in the space.
+   *
+   *  Untracked allocations bypass the pool: without the tracking record
+   *  there is nowhere to remember whether a block came from the pool,
+   *  so only tracked (View / kokkos_malloc) allocations are pooled.
+   */
+  void* allocate(const size_t arg_alloc_size) const {
+    return m_base.allocate(arg_alloc_size);
+  }
+
+  /**\brief  Deallocate untracked memory in the space */
+  void deallocate(void* const arg_alloc_ptr,
+                  const size_t arg_alloc_size) const {
+    m_base.deallocate(arg_alloc_ptr, arg_alloc_size);
+  }
+
+  /**\brief  The base space instance used for fall-back allocations */
+  const base_space& base() const { return m_base; }
+
+  /**\brief Return Name of the MemorySpace */
+  static constexpr const char* name() { return "Pooled"; }
+
+  /**\brief  The process-wide pool, created on first use and destroyed
+   *         by Kokkos::finalize.
+   *
+   *  The first use must not race with another first use: as with pool
+   *  construction in general it must be externally ordered, e.g. by the
+   *  first pooled View allocation happening outside a parallel region.
+   */
+  static pool_type& pool() {
+    pool_type*& instance = pool_instance();
+    if (0 == instance) {
+      instance = new pool_type(make_pool());
+      Kokkos::push_finalize_hook([]() {
+        delete pool_instance();
+        pool_instance() = 0;
+      });
+    }
+    return *instance;
+  }
+
+ private:
+  static pool_type*& pool_instance() {
+    static pool_type* s_pool = 0;
+    return s_pool;
+  }
+
+  static size_t env_size(const char* const env, const size_t default_value) {
+    const char* const val = getenv(env);
+    return val ? size_t(atoll(val)) : default_value;
+  }
+
+  static pool_type make_pool() {
+    const size_t capacity =
+        env_size("KOKKOS_POOLED_SPACE_CAPACITY", size_t(1) << 26);
+    const size_t max_block =
+        env_size("KOKKOS_POOLED_SPACE_MAX_BLOCK", size_t(1) << 20);
+    return pool_type(base_space(), capacity, 64 /* min block */, max_block,
+                     max_block /* superblock */);
+  }
+
+  base_space m_base;
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+/*--------------------------------------------------------------------------*/
+/* Access and deep-copy relationships mirror those of the base space.       */
+
+namespace Kokkos {
+namespace Impl {
+
+template <class BaseSpace, class OtherSpace>
+struct MemorySpaceAccess<Kokkos::Experimental::PooledSpace<BaseSpace>,
+                         OtherSpace> : MemorySpaceAccess<BaseSpace,
+                                                         OtherSpace> {};
+
+template <class OtherSpace, class BaseSpace>
+struct MemorySpaceAccess<OtherSpace,
+                         Kokkos::Experimental::PooledSpace<BaseSpace>>
+    : MemorySpaceAccess<OtherSpace, BaseSpace> {};
+
+template <class DstBaseSpace, class SrcBaseSpace>
+struct MemorySpaceAccess<Kokkos::Experimental::PooledSpace<DstBaseSpace>,
+                         Kokkos::Experimental::PooledSpace<SrcBaseSpace>>
+    : MemorySpaceAccess<DstBaseSpace, SrcBaseSpace> {};
+
+/* Disambiguate against the AnonymousSpace blanket specializations */
+
+template <class BaseSpace>
+struct MemorySpaceAccess<Kokkos::AnonymousSpace,
+                         Kokkos::Experimental::PooledSpace<BaseSpace>> {
+  enum { assignable = true };
+  enum { accessible = true };
+  enum { deepcopy = true };
+};
+
+template <class BaseSpace>
+struct MemorySpaceAccess<Kokkos::Experimental::PooledSpace<BaseSpace>,
+                         Kokkos::AnonymousSpace> {
+  enum { assignable = true };
+  enum { accessible = true };
+  enum { deepcopy = true };
+};
+
+template <class Space, class BaseSpace>
+struct VerifyExecutionCanAccessMemorySpace<
+    Space, Kokkos::Experimental::PooledSpace<BaseSpace>>
+    : VerifyExecutionCanAccessMemorySpace<Space, BaseSpace> {};
+
+template <class DstBaseSpace, class SrcBaseSpace>
+struct VerifyExecutionCanAccessMemorySpace<
+    Kokkos::Experimental::PooledSpace<DstBaseSpace>,
+    Kokkos::Experimental::PooledSpace<SrcBaseSpace>>
+    : VerifyExecutionCanAccessMemorySpace<DstBaseSpace, SrcBaseSpace> {};
+
+template <class BaseSpace>
+struct VerifyExecutionCanAccessMemorySpace<
+    Kokkos::AnonymousSpace, Kokkos::Experimental::PooledSpace<BaseSpace>> {
+  enum { value = 1 };
+  KOKKOS_INLINE_FUNCTION static void verify(void) {}
+  KOKKOS_INLINE_FUNCTION static void verify(const void*) {}
+};
+
+template <class BaseSpace, class SrcSpace, class ExecutionSpace>
+struct DeepCopy<Kokkos::Experimental::PooledSpace<BaseSpace>, SrcSpace,
+                ExecutionSpace> : DeepCopy<BaseSpace, SrcSpace,
+                                           ExecutionSpace> {
+  using DeepCopy<BaseSpace, SrcSpace, ExecutionSpace>::DeepCopy;
+};
+
+template <class DstSpace, class BaseSpace, class ExecutionSpace>
+struct DeepCopy<DstSpace, Kokkos::Experimental::PooledSpace<BaseSpace>,
+                ExecutionSpace> : DeepCopy<DstSpace, BaseSpace,
+                                           ExecutionSpace> {
+  using DeepCopy<DstSpace, BaseSpace, ExecutionSpace>::DeepCopy;
+};
+
+template <class DstBaseSpace, class SrcBaseSpace, class ExecutionSpace>
+struct DeepCopy<Kokkos::Experimental::PooledSpace<DstBaseSpace>,
+                Kokkos::Experimental::PooledSpace<SrcBaseSpace>,
+                ExecutionSpace> : DeepCopy<DstBaseSpace, SrcBaseSpace,
+                                           ExecutionSpace> {
+  using DeepCopy<DstBaseSpace, SrcBaseSpace, ExecutionSpace>::DeepCopy;
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+/*--------------------------------------------------------------------------*/
+
+namespace Kokkos {
+namespace Impl {
+
+template <class BaseSpace>
+class SharedAllocationRecord<Kokkos::Experimental::PooledSpace<BaseSpace>,
+                             void> : public SharedAllocationRecord<void,
+                                                                   void> {
+ private:
+  typedef Kokkos::Experimental::PooledSpace<BaseSpace> SpaceType;
+  typedef SharedAllocationRecord<void, void> RecordBase;
+
+  friend SpaceType;
+
+  SharedAllocationRecord(const SharedAllocationRecord&) = delete;
+  SharedAllocationRecord& operator=(const SharedAllocationRecord&) = delete;
+
+  static void deallocate(RecordBase* arg_rec) {
+    delete static_cast<SharedAllocationRecord*>(arg_rec);
+  }
+
+#ifdef KOKKOS_DEBUG
+  /**\brief  Root record for tracked allocations from PooledSpace instances */
+  static RecordBase s_root_record;
+#endif
+
+  /* Whether the most recent allocation on this thread was served by the
+   * pool.  The base class constructor consumes the header pointer before
+   * any member of this class can be initialized, so allocate_header
+   * parks the routing decision here for the member initializer to pick
+   * up; both run on the allocating thread.
+   */
+  static bool& last_allocation_pooled() {
+    static thread_local bool flag = false;
+    return flag;
+  }
+
+  static SharedAllocationHeader* allocate_header(const SpaceType& arg_space,
+                                                 const std::string& arg_label,
+                                                 const size_t arg_alloc_size) {
+    const size_t total = sizeof(SharedAllocationHeader) + arg_alloc_size;
+
+    void* ptr = total <= SpaceType::pool().max_block_size()
+                    ? SpaceType::pool().allocate(total, 32)
+                    : (void*)0;
+
+    last_allocation_pooled() = (0 != ptr);
+
+    if (0 == ptr) {
+      /* Too large for a pool block, or the pool is exhausted */
+      return Impl::checked_allocation_with_header(arg_space.base(), arg_label,
+                                                  arg_alloc_size);
+    }
+
+    return reinterpret_cast<SharedAllocationHeader*>(ptr);
+  }
+
+  const SpaceType m_space;
+  const bool m_pooled;
+
+ protected:
+  ~SharedAllocationRecord() {
+#if defined(KOKKOS_ENABLE_PROFILING)
+    if (Kokkos::Profiling::profileLibraryLoaded()) {
+      Kokkos::Profiling::deallocateData(
+          Kokkos::Profiling::SpaceHandle(SpaceType::name()),
+          RecordBase::m_alloc_ptr->m_label, data(), size());
+    }
+#endif
+
+    Kokkos::Impl::account_deallocation(SpaceType::name(), data(), size());
+
+    if (m_pooled) {
+      SpaceType::pool().deallocate(RecordBase::m_alloc_ptr,
+                                   RecordBase::m_alloc_size);
+    } else {
+      m_space.base().deallocate(RecordBase::m_alloc_ptr,
+                                RecordBase::m_alloc_size);
+    }
+  }
+
+  SharedAllocationRecord(
+      const SpaceType& arg_space, const std::string& arg_label,
+      const size_t arg_alloc_size,
+      const RecordBase::function_type arg_dealloc = &deallocate)
+      // Pass through allocated [ SharedAllocationHeader , user_memory ]
+      // Pass through deallocation function
+      : RecordBase(
+#ifdef KOKKOS_DEBUG
+            &SharedAllocationRecord::s_root_record,
+#endif
+            allocate_header(arg_space, arg_label, arg_alloc_size),
+            sizeof(SharedAllocationHeader) + arg_alloc_size, arg_dealloc),
+        m_space(arg_space),
+        m_pooled(last_allocation_pooled()) {
+#if defined(KOKKOS_ENABLE_PROFILING)
+    if (Kokkos::Profiling::profileLibraryLoaded()) {
+      Kokkos::Profiling::allocateData(
+          Kokkos::Profiling::SpaceHandle(SpaceType::name()), arg_label, data(),
+          arg_alloc_size);
+    }
+#endif
+
+    Kokkos::Impl::account_allocation(SpaceType::name(), arg_label, data(),
+                                     arg_alloc_size);
+    // Fill in the Header information
+    RecordBase::m_alloc_ptr->m_record =
+        static_cast<SharedAllocationRecord<void, void>*>(this);
+
+    strncpy(RecordBase::m_alloc_ptr->m_label, arg_label.c_str(),
+            SharedAllocationHeader::maximum_label_length);
+    // Set last element zero, in case c_str is too long
+    RecordBase::m_alloc_ptr
+        ->m_label[SharedAllocationHeader::maximum_label_length - 1] = (char)0;
+  }
+
+ public:
+  inline std::string get_label() const {
+    return std::string(RecordBase::head()->m_label);
+  }
+
+  KOKKOS_INLINE_FUNCTION static SharedAllocationRecord* allocate(
+      const SpaceType& arg_space, const std::string& arg_label,
+      const size_t arg_alloc_size) {
+#if defined(KOKKOS_ACTIVE_EXECUTION_MEMORY_SPACE_HOST)
+    return new SharedAllocationRecord(arg_space, arg_label, arg_alloc_size);
+#else
+    return (SharedAllocationRecord*)0;
+#endif
+  }
+
+  /**\brief  Allocate tracked memory in the space */
+  static void* allocate_tracked(const SpaceType& arg_space,
+                                const std::string& arg_alloc_label,
+                                const size_t arg_alloc_size) {
+    if (!arg_alloc_size) return (void*)0;
+
+    SharedAllocationRecord* const r =
+        allocate(arg_space, arg_alloc_label, arg_alloc_size);
+
+    RecordBase::increment(r);
+
+    return r->data();
+  }
+
+  /**\brief  Reallocate tracked memory in the space */
+  static void* reallocate_tracked(void* const arg_alloc_ptr,
+                                  const size_t arg_alloc_size) {
+    SharedAllocationRecord* const r_old = get_record(arg_alloc_ptr);
+    SharedAllocationRecord* const r_new =
+        allocate(r_old->m_space, r_old->get_label(), arg_alloc_size);
+
+    Kokkos::Impl::DeepCopy<BaseSpace, BaseSpace>(
+        r_new->data(), r_old->data(), std::min(r_old->size(), r_new->size()));
+
+    RecordBase::increment(r_new);
+    RecordBase::decrement(r_old);
+
+    return r_new->data();
+  }
+
+  /**\brief  Deallocate tracked memory in the space */
+  static void deallocate_tracked(void* const arg_alloc_ptr) {
+    if (arg_alloc_ptr != 0) {
+      SharedAllocationRecord* const r = get_record(arg_alloc_ptr);
+
+      RecordBase::decrement(r);
+    }
+  }
+
+  static SharedAllocationRecord* get_record(void* alloc_ptr) {
+    typedef SharedAllocationHeader Header;
+
+    Header const* const head =
+        alloc_ptr ? Header::get_header(alloc_ptr) : (Header*)0;
+    SharedAllocationRecord* const record =
+        alloc_ptr ? static_cast<SharedAllocationRecord*>(head->m_record)
+                  : (SharedAllocationRecord*)0;
+
+    if (!alloc_ptr || record->m_alloc_ptr != head) {
+      Kokkos::Impl::throw_runtime_exception(std::string(
+          "Kokkos::Impl::SharedAllocationRecord< Kokkos::Experimental::"
+          "PooledSpace , void >::get_record ERROR"));
+    }
+
+    return record;
+  }
+
+  static void print_records(std::ostream& s, const SpaceType&,
+                            bool detail = false) {
+#ifdef KOKKOS_DEBUG
+    SharedAllocationRecord<void, void>::print_host_accessible_records(
+        s, "Pooled", &s_root_record, detail);
+#else
+    (void)s;
+    (void)detail;
+    Kokkos::Impl::throw_runtime_exception(
+        "SharedAllocationRecord<PooledSpace>::print_records only works with "
+        "KOKKOS_DEBUG enabled");
+#endif
+  }
+};
+
+#ifdef KOKKOS_DEBUG
+template <class BaseSpace>
+SharedAllocationRecord<void, void> SharedAllocationRecord<
+    Kokkos::Experimental::PooledSpace<BaseSpace>, void>::s_root_record;
+#endif
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif  // #define KOKKOS_POOLEDSPACE_HPP
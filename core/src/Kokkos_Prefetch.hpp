@@ -0,0 +1,229 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+#ifndef KOKKOS_PREFETCH_HPP
+#define KOKKOS_PREFETCH_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_Core_fwd.hpp>
+#include <Kokkos_Concepts.hpp>
+#include <Kokkos_View.hpp>
+
+#if defined(KOKKOS_ENABLE_CUDA)
+#include <Kokkos_Cuda.hpp>
+#include <Kokkos_CudaSpace.hpp>
+#include <Cuda/Kokkos_Cuda_Error.hpp>
+#endif
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+
+namespace Impl {
+
+/* Customization point for memory spaces whose pages migrate on demand.
+ * The primary template is a no-op so that staging hints may be placed
+ * unconditionally in portable code; only spaces with a paging runtime
+ * (currently CudaUVMSpace) specialize it. */
+template <class MemorySpace>
+struct MemoryPageHints {
+  template <class ExecSpace>
+  static void prefetch(const void*, const size_t, const ExecSpace&) {}
+
+  static void read_mostly(const void*, const size_t, const bool) {}
+
+  template <class ExecSpace>
+  static void preferred_location(const void*, const size_t, const ExecSpace&) {
+  }
+};
+
+#if defined(KOKKOS_ENABLE_CUDA)
+
+template <>
+struct MemoryPageHints<Kokkos::CudaUVMSpace> {
+ private:
+  // Destination of a hint is the device of a Cuda instance,
+  // or the CPU for any host-side execution space.
+  static int device_id(const Kokkos::Cuda& exec) { return exec.cuda_device(); }
+
+  template <class ExecSpace>
+  static int device_id(const ExecSpace&) {
+    return cudaCpuDeviceId;
+  }
+
+  static cudaStream_t stream(const Kokkos::Cuda& exec) {
+    return exec.cuda_stream();
+  }
+
+  template <class ExecSpace>
+  static cudaStream_t stream(const ExecSpace&) {
+    return (cudaStream_t)0;
+  }
+
+ public:
+  template <class ExecSpace>
+  static void prefetch(const void* arg_ptr, const size_t arg_bytes,
+                       const ExecSpace& exec) {
+    if (arg_ptr != nullptr && 0 < arg_bytes) {
+      CUDA_SAFE_CALL(cudaMemPrefetchAsync(arg_ptr, arg_bytes, device_id(exec),
+                                          stream(exec)));
+    }
+  }
+
+  static void read_mostly(const void* arg_ptr, const size_t arg_bytes,
+                          const bool arg_enable) {
+    if (arg_ptr != nullptr && 0 < arg_bytes) {
+      CUDA_SAFE_CALL(cudaMemAdvise(arg_ptr, arg_bytes,
+                                   arg_enable ? cudaMemAdviseSetReadMostly
+                                              : cudaMemAdviseUnsetReadMostly,
+                                   0 /* device argument is ignored */));
+    }
+  }
+
+  template <class ExecSpace>
+  static void preferred_location(const void* arg_ptr, const size_t arg_bytes,
+                                 const ExecSpace& exec) {
+    if (arg_ptr != nullptr && 0 < arg_bytes) {
+      CUDA_SAFE_CALL(cudaMemAdvise(arg_ptr, arg_bytes,
+                                   cudaMemAdviseSetPreferredLocation,
+                                   device_id(exec)));
+    }
+  }
+};
+
+#endif /* #if defined( KOKKOS_ENABLE_CUDA ) */
+
+}  // namespace Impl
+
+}  // namespace Kokkos
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+
+namespace Experimental {
+
+/** \brief  Asynchronously migrate the pages spanned by a View toward the
+ *          given execution space.
+ *
+ *  For a View in CudaUVMSpace this issues cudaMemPrefetchAsync on the
+ *  stream of the execution space instance: toward the device for a
+ *  Kokkos::Cuda instance and toward the CPU for any host execution space.
+ *  The call is asynchronous; a kernel subsequently launched on the same
+ *  instance observes the migrated pages.  For all other memory spaces
+ *  the call is a no-op, so prefetch hints may be left in portable code.
+ */
+template <class DataType, class... Properties, class ExecSpace>
+inline void prefetch(const Kokkos::View<DataType, Properties...>& arg_view,
+                     const ExecSpace& arg_exec) {
+  typedef Kokkos::View<DataType, Properties...> view_type;
+
+  static_assert(Kokkos::is_execution_space<ExecSpace>::value,
+                "Kokkos::Experimental::prefetch requires an execution space "
+                "instance as its second argument");
+
+  Kokkos::Impl::MemoryPageHints<typename view_type::memory_space>::prefetch(
+      arg_view.data(),
+      arg_view.span() * sizeof(typename view_type::value_type), arg_exec);
+}
+
+/** \brief  Prefetch toward the View's own execution space. */
+template <class DataType, class... Properties>
+inline void prefetch(const Kokkos::View<DataType, Properties...>& arg_view) {
+  typedef Kokkos::View<DataType, Properties...> view_type;
+
+  prefetch(arg_view, typename view_type::execution_space());
+}
+
+/** \brief  Advise the paging runtime that a View is read mostly.
+ *
+ *  Read-mostly data may be replicated on every processor that touches it
+ *  instead of migrating back and forth.  Pass enable = false to retract
+ *  the hint, e.g. before a phase that overwrites the data.  No-op for
+ *  memory spaces without a paging runtime.
+ */
+template <class DataType, class... Properties>
+inline void advise_read_mostly(
+    const Kokkos::View<DataType, Properties...>& arg_view,
+    const bool arg_enable = true) {
+  typedef Kokkos::View<DataType, Properties...> view_type;
+
+  Kokkos::Impl::MemoryPageHints<typename view_type::memory_space>::read_mostly(
+      arg_view.data(),
+      arg_view.span() * sizeof(typename view_type::value_type), arg_enable);
+}
+
+/** \brief  Advise the paging runtime where a View's pages should live.
+ *
+ *  The preferred location is the device of a Kokkos::Cuda instance or
+ *  the CPU for a host execution space.  Pages are still migrated on
+ *  access faults but are returned to the preferred location when the
+ *  remote accessor is done.  No-op for memory spaces without a paging
+ *  runtime.
+ */
+template <class DataType, class... Properties, class ExecSpace>
+inline void advise_preferred_location(
+    const Kokkos::View<DataType, Properties...>& arg_view,
+    const ExecSpace& arg_exec) {
+  typedef Kokkos::View<DataType, Properties...> view_type;
+
+  static_assert(
+      Kokkos::is_execution_space<ExecSpace>::value,
+      "Kokkos::Experimental::advise_preferred_location requires an "
+      "execution space instance as its second argument");
+
+  Kokkos::Impl::MemoryPageHints<typename view_type::memory_space>::
+      preferred_location(
+          arg_view.data(),
+          arg_view.span() * sizeof(typename view_type::value_type), arg_exec);
+}
+
+}  // namespace Experimental
+
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_PREFETCH_HPP */
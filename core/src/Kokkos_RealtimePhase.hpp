@@ -0,0 +1,171 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_RealtimePhase.hpp
+/// \brief Scoped detection of latency hazards in deadline-critical code.
+///
+/// Inside a hard-deadline window, a stray allocation or scratch resize
+/// triggered from library internals can blow the budget: the cost is
+/// rare, unbounded, and invisible at the call site.  A RealtimePhase
+/// guard marks such a window.  While any guard is held, the runtime's
+/// allocation and scratch-growth paths vet themselves: in the default
+/// Abort mode the offending operation throws immediately, naming what
+/// was attempted and which phase it violated, so the hazard is found
+/// in testing rather than felt in production; in Count mode violations
+/// are tallied for post-phase inspection and the work proceeds.
+///
+/// Vetted operations: HostSpace allocations (which all host
+/// SharedAllocationRecord bookkeeping funnels through), OpenMP
+/// thread-data/scratch growth, and device allocations and functor
+/// scratch growth on Cuda.  A phase does not make those operations
+/// cheaper - warm everything up before entering, then use the guard to
+/// prove the window stays clean.
+
+#ifndef KOKKOS_REALTIMEPHASE_HPP
+#define KOKKOS_REALTIMEPHASE_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <impl/Kokkos_Error.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace Kokkos {
+namespace Impl {
+
+struct RealtimePhaseState {
+  std::atomic<int> depth;
+  std::atomic<uint64_t> violations;
+  std::atomic<bool> abort_on_violation;
+  std::string label;  // written only on outermost entry
+
+  RealtimePhaseState()
+      : depth(0), violations(0), abort_on_violation(true), label() {}
+
+  static RealtimePhaseState& singleton() {
+    static RealtimePhaseState s;
+    return s;
+  }
+};
+
+/* Called from the runtime's allocation and scratch-growth paths.
+ * Outside a phase this is one relaxed atomic load.
+ */
+inline void realtime_phase_vet(const char* const what) {
+  RealtimePhaseState& s = RealtimePhaseState::singleton();
+  if (s.depth.load(std::memory_order_relaxed) == 0) return;
+  if (s.abort_on_violation.load(std::memory_order_relaxed)) {
+    Kokkos::Impl::throw_runtime_exception(
+        std::string("Kokkos::RealtimePhase violation: ") + what +
+        " attempted during realtime phase '" + s.label + "'");
+  }
+  s.violations.fetch_add(1, std::memory_order_relaxed);
+}
+
+}  // namespace Impl
+
+namespace Experimental {
+
+/** \brief  RAII guard marking a deadline-critical window.
+ *
+ *  \code
+ *    {
+ *      Kokkos::Experimental::RealtimePhase phase("control_loop");
+ *      // any runtime allocation or scratch growth in here throws,
+ *      // naming the operation and the phase
+ *      Kokkos::parallel_for(policy, warm_functor);
+ *    }
+ *  \endcode
+ *
+ *  Guards nest; the phase ends when the outermost guard is destroyed,
+ *  and the outermost guard supplies the label and mode.  The state is
+ *  process-wide: work launched from any thread during the phase is
+ *  subject to the same vetting.
+ */
+class RealtimePhase {
+ public:
+  enum violation_mode {
+    Abort,  //!< throw at the violating operation (default)
+    Count   //!< tally violations, let the operation proceed
+  };
+
+ private:
+  RealtimePhase(const RealtimePhase&) = delete;
+  RealtimePhase& operator=(const RealtimePhase&) = delete;
+
+ public:
+  explicit RealtimePhase(const std::string& label,
+                         const violation_mode mode = Abort) {
+    Kokkos::Impl::RealtimePhaseState& s =
+        Kokkos::Impl::RealtimePhaseState::singleton();
+    if (s.depth.fetch_add(1, std::memory_order_acq_rel) == 0) {
+      s.label = label;
+      s.abort_on_violation.store(mode == Abort, std::memory_order_relaxed);
+      s.violations.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  ~RealtimePhase() {
+    Kokkos::Impl::RealtimePhaseState::singleton().depth.fetch_sub(
+        1, std::memory_order_acq_rel);
+  }
+
+  //! Whether any phase is currently open.
+  static bool active() {
+    return 0 < Kokkos::Impl::RealtimePhaseState::singleton().depth.load(
+                   std::memory_order_relaxed);
+  }
+
+  //! Violations tallied since the current outermost phase began.
+  static uint64_t violation_count() {
+    return Kokkos::Impl::RealtimePhaseState::singleton().violations.load(
+        std::memory_order_relaxed);
+  }
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_REALTIMEPHASE_HPP */
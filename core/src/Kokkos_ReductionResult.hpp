@@ -0,0 +1,141 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_ReductionResult.hpp
+/// \brief Asynchronous reduction results that synchronize on host read.
+///
+/// parallel_reduce into a scalar reference fences and copies the
+/// result back before returning, so a solver that only needs the dot
+/// product several kernels later still stalls the pipeline at the
+/// reduction.  A ReductionResult owns a rank-0 device View; reducing
+/// into it through async_reduce is non-blocking (the View form of
+/// parallel_reduce does not fence), the device View can feed
+/// subsequent kernels directly with no host round trip, and only
+/// get() - the first host read - fences and copies.  This lets an
+/// iterative solver queue the next iteration's kernels behind its
+/// convergence-check reductions and test convergence afterwards.
+
+#ifndef KOKKOS_REDUCTIONRESULT_HPP
+#define KOKKOS_REDUCTIONRESULT_HPP
+
+#include <Kokkos_Core_fwd.hpp>
+#include <Kokkos_View.hpp>
+#include <Kokkos_Parallel.hpp>
+#include <Kokkos_Parallel_Reduce.hpp>
+#include <Kokkos_CopyViews.hpp>
+
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  Future-like handle for a reduction result living on the
+ *          device.
+ *
+ *  view() exposes the rank-0 result View for device-side consumers
+ *  and never synchronizes; get() fences the execution space on the
+ *  first read, copies the value to the host, and memoizes it.  Copies
+ *  of a handle share the device View (ordinary View reference
+ *  counting) but memoize independently.
+ */
+template <class ValueType, class ExecSpace = Kokkos::DefaultExecutionSpace>
+class ReductionResult {
+ public:
+  using execution_space = ExecSpace;
+  using result_view_type =
+      Kokkos::View<ValueType, typename ExecSpace::memory_space>;
+
+  ReductionResult()
+      : m_result("Kokkos::ReductionResult"),
+        m_host(),
+        m_synced(false) {}
+
+  /// \brief The device-resident result; reading it from a kernel
+  ///        queued on the same execution space needs no host sync.
+  result_view_type const& view() const { return m_result; }
+
+  /// \brief Read the result on the host: fences and copies on the
+  ///        first call, then returns the memoized value.
+  ValueType get() const {
+    if (!m_synced) {
+      execution_space().fence();
+      Kokkos::deep_copy(m_host, m_result);
+      m_synced = true;
+    }
+    return m_host;
+  }
+
+  /// \brief Forget a memoized value so the handle's storage can carry
+  ///        the next iteration's reduction.
+  void reset() { m_synced = false; }
+
+ private:
+  result_view_type m_result;
+  mutable ValueType m_host;
+  mutable bool m_synced;
+};
+
+/// \brief Non-blocking reduction: returns immediately with a handle
+///        whose device View receives the result.
+template <class ValueType, class PolicyType, class FunctorType>
+ReductionResult<ValueType, typename PolicyType::execution_space> async_reduce(
+    const char* label, const PolicyType& policy, const FunctorType& functor) {
+  ReductionResult<ValueType, typename PolicyType::execution_space> result;
+  Kokkos::parallel_reduce(label, policy, functor, result.view());
+  return result;
+}
+
+/// \brief Non-blocking reduction into an existing handle, reusing its
+///        device storage across iterations.
+template <class PolicyType, class FunctorType, class ValueType,
+          class ExecSpace>
+void async_reduce(const char* label, const PolicyType& policy,
+                  const FunctorType& functor,
+                  ReductionResult<ValueType, ExecSpace>& result) {
+  result.reset();
+  Kokkos::parallel_reduce(label, policy, functor, result.view());
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_REDUCTIONRESULT_HPP */
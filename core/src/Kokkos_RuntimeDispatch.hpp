@@ -0,0 +1,168 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_RuntimeDispatch.hpp
+/// \brief Per-launch backend selection within one binary.
+///
+/// Execution spaces are compile-time types, so a launch is normally
+/// bound to one backend when its translation unit is compiled.
+/// ExecutionSpaceHandle erases that choice to a runtime value over the
+/// two backends every configuration enables - DefaultExecutionSpace
+/// and DefaultHostExecutionSpace - and the dispatch helpers below
+/// compile a kernel for both and branch on the handle.  This lets
+/// small problems run on the host where device launch latency would
+/// dominate, and lets an application select the backend per kernel
+/// from init-time measurements instead of shipping separate host and
+/// device builds of its driver logic.
+///
+/// The functor must be compilable for both backends (the usual
+/// KOKKOS_INLINE_FUNCTION operator) and any views it captures must be
+/// accessible from whichever backend the handle selects - e.g.
+/// CudaUVMSpace or HostSpace in a CUDA configuration.  In host-only
+/// configurations the two backends may coincide and every handle
+/// dispatches identically.
+
+#ifndef KOKKOS_RUNTIMEDISPATCH_HPP
+#define KOKKOS_RUNTIMEDISPATCH_HPP
+
+#include <Kokkos_Core_fwd.hpp>
+#include <Kokkos_Parallel.hpp>
+#include <Kokkos_Parallel_Reduce.hpp>
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  Runtime-valued choice between the device and host default
+ *          execution spaces.
+ */
+class ExecutionSpaceHandle {
+ public:
+  enum backend_kind { DeviceBackend, HostBackend };
+
+  /** \brief  Defaults to the device (DefaultExecutionSpace). */
+  KOKKOS_INLINE_FUNCTION
+  ExecutionSpaceHandle() : m_kind(DeviceBackend) {}
+
+  KOKKOS_INLINE_FUNCTION
+  backend_kind kind() const { return m_kind; }
+
+  static ExecutionSpaceHandle device() {
+    return ExecutionSpaceHandle(DeviceBackend);
+  }
+
+  static ExecutionSpaceHandle host() {
+    return ExecutionSpaceHandle(HostBackend);
+  }
+
+  /** \brief  Whether this configuration's default backend is distinct
+   *          from its host backend; false means every handle dispatches
+   *          to the same space.
+   */
+  static constexpr bool has_distinct_device() {
+    return !std::is_same<Kokkos::DefaultExecutionSpace,
+                         Kokkos::DefaultHostExecutionSpace>::value;
+  }
+
+  /** \brief  Pick a backend for a launch of work_count iterations:
+   *          the host below host_threshold, where launch latency
+   *          dominates, the device above it.
+   */
+  static ExecutionSpaceHandle select(const size_t work_count,
+                                     const size_t host_threshold = 4096) {
+    return (has_distinct_device() && host_threshold <= work_count)
+               ? device()
+               : host();
+  }
+
+ private:
+  explicit ExecutionSpaceHandle(const backend_kind kind) : m_kind(kind) {}
+
+  backend_kind m_kind;
+};
+
+/** \brief  Launch functor over [begin,end) on the backend the handle
+ *          selects.  Instantiates the kernel for both default spaces.
+ */
+template <class FunctorType>
+inline void parallel_for(const ExecutionSpaceHandle& handle,
+                         const std::string& label, const size_t begin,
+                         const size_t end, const FunctorType& functor) {
+  if (handle.kind() == ExecutionSpaceHandle::HostBackend) {
+    Kokkos::parallel_for(
+        label,
+        Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(begin, end),
+        functor);
+  } else {
+    Kokkos::parallel_for(
+        label, Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(begin, end),
+        functor);
+  }
+}
+
+/** \brief  Reduction counterpart of the handle-dispatched parallel_for. */
+template <class FunctorType, class ReturnType>
+inline void parallel_reduce(const ExecutionSpaceHandle& handle,
+                            const std::string& label, const size_t begin,
+                            const size_t end, const FunctorType& functor,
+                            ReturnType& return_value) {
+  if (handle.kind() == ExecutionSpaceHandle::HostBackend) {
+    Kokkos::parallel_reduce(
+        label,
+        Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(begin, end),
+        functor, return_value);
+  } else {
+    Kokkos::parallel_reduce(
+        label, Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(begin, end),
+        functor, return_value);
+  }
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_RUNTIMEDISPATCH_HPP */
@@ -0,0 +1,271 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+/// \file Kokkos_SIMD.hpp
+/// \brief A portable simd<T, Abi> value type for explicit host
+///        vectorization of gather/scatter-heavy kernels.
+
+#ifndef KOKKOS_SIMD_HPP
+#define KOKKOS_SIMD_HPP
+
+#include <Kokkos_Macros.hpp>
+
+#include <cstddef>
+
+namespace Kokkos {
+namespace Experimental {
+
+namespace simd_abi {
+
+//! One lane; every operation degenerates to a scalar.  Used on device
+//! passes where the vector dimension is covered by ThreadVectorRange.
+struct scalar {
+  enum : int { size = 1 };
+};
+
+//! N contiguous lanes operated on by vectorizable fixed-trip-count loops,
+//! which the host compilers turn into SIMD (including AVX-512 gathers for
+//! the indexed accesses) at -O2 and above.
+template <int N>
+struct pack {
+  enum : int { size = N };
+};
+
+#if defined(__CUDA_ARCH__)
+typedef scalar native;
+#else
+typedef pack<8> native;
+#endif
+
+}  // namespace simd_abi
+
+template <class T, class Abi = simd_abi::native>
+class simd;
+
+//------------------------------------------------------------------------
+// Scalar ABI: a transparent wrapper so functors written against simd<T>
+// compile unchanged inside Cuda ThreadVectorRange loops.
+
+template <class T>
+class simd<T, simd_abi::scalar> {
+ public:
+  typedef T value_type;
+  typedef simd_abi::scalar abi_type;
+
+  KOKKOS_FORCEINLINE_FUNCTION static constexpr int size() { return 1; }
+
+  KOKKOS_FORCEINLINE_FUNCTION simd() {}
+  KOKKOS_FORCEINLINE_FUNCTION simd(const T value) : m_value(value) {}
+
+  KOKKOS_FORCEINLINE_FUNCTION T& operator[](int) { return m_value; }
+  KOKKOS_FORCEINLINE_FUNCTION const T& operator[](int) const {
+    return m_value;
+  }
+
+  //! Contiguous load / store.
+  KOKKOS_FORCEINLINE_FUNCTION void copy_from(const T* ptr) {
+    m_value = *ptr;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION void copy_to(T* ptr) const { *ptr = m_value; }
+
+  //! Indexed gather / scatter.
+  template <class Integral>
+  KOKKOS_FORCEINLINE_FUNCTION void gather_from(const T* ptr,
+                                               const Integral* idx) {
+    m_value = ptr[idx[0]];
+  }
+  template <class Integral>
+  KOKKOS_FORCEINLINE_FUNCTION void scatter_to(T* ptr,
+                                              const Integral* idx) const {
+    ptr[idx[0]] = m_value;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION simd operator+(const simd& rhs) const {
+    return simd(m_value + rhs.m_value);
+  }
+  KOKKOS_FORCEINLINE_FUNCTION simd operator-(const simd& rhs) const {
+    return simd(m_value - rhs.m_value);
+  }
+  KOKKOS_FORCEINLINE_FUNCTION simd operator*(const simd& rhs) const {
+    return simd(m_value * rhs.m_value);
+  }
+  KOKKOS_FORCEINLINE_FUNCTION simd operator/(const simd& rhs) const {
+    return simd(m_value / rhs.m_value);
+  }
+  KOKKOS_FORCEINLINE_FUNCTION simd& operator+=(const simd& rhs) {
+    m_value += rhs.m_value;
+    return *this;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION simd& operator-=(const simd& rhs) {
+    m_value -= rhs.m_value;
+    return *this;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION simd& operator*=(const simd& rhs) {
+    m_value *= rhs.m_value;
+    return *this;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION simd& operator/=(const simd& rhs) {
+    m_value /= rhs.m_value;
+    return *this;
+  }
+
+  //! Horizontal sum of the lanes.
+  KOKKOS_FORCEINLINE_FUNCTION T reduce_add() const { return m_value; }
+
+ private:
+  T m_value;
+};
+
+//------------------------------------------------------------------------
+// Pack ABI: fixed-width lane arrays; all lane loops have compile-time trip
+// counts and no cross-lane dependencies so host compilers vectorize them.
+
+template <class T, int N>
+class simd<T, simd_abi::pack<N>> {
+ public:
+  typedef T value_type;
+  typedef simd_abi::pack<N> abi_type;
+
+  KOKKOS_FORCEINLINE_FUNCTION static constexpr int size() { return N; }
+
+  KOKKOS_FORCEINLINE_FUNCTION simd() {}
+
+  KOKKOS_FORCEINLINE_FUNCTION simd(const T value) {
+    for (int i = 0; i < N; ++i) m_value[i] = value;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION T& operator[](int i) { return m_value[i]; }
+  KOKKOS_FORCEINLINE_FUNCTION const T& operator[](int i) const {
+    return m_value[i];
+  }
+
+  //! Contiguous load / store.
+  KOKKOS_FORCEINLINE_FUNCTION void copy_from(const T* ptr) {
+    for (int i = 0; i < N; ++i) m_value[i] = ptr[i];
+  }
+  KOKKOS_FORCEINLINE_FUNCTION void copy_to(T* ptr) const {
+    for (int i = 0; i < N; ++i) ptr[i] = m_value[i];
+  }
+
+  //! Indexed gather / scatter.
+  template <class Integral>
+  KOKKOS_FORCEINLINE_FUNCTION void gather_from(const T* ptr,
+                                               const Integral* idx) {
+    for (int i = 0; i < N; ++i) m_value[i] = ptr[idx[i]];
+  }
+  template <class Integral>
+  KOKKOS_FORCEINLINE_FUNCTION void scatter_to(T* ptr,
+                                              const Integral* idx) const {
+    for (int i = 0; i < N; ++i) ptr[idx[i]] = m_value[i];
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION simd operator+(const simd& rhs) const {
+    simd r;
+    for (int i = 0; i < N; ++i) r.m_value[i] = m_value[i] + rhs.m_value[i];
+    return r;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION simd operator-(const simd& rhs) const {
+    simd r;
+    for (int i = 0; i < N; ++i) r.m_value[i] = m_value[i] - rhs.m_value[i];
+    return r;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION simd operator*(const simd& rhs) const {
+    simd r;
+    for (int i = 0; i < N; ++i) r.m_value[i] = m_value[i] * rhs.m_value[i];
+    return r;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION simd operator/(const simd& rhs) const {
+    simd r;
+    for (int i = 0; i < N; ++i) r.m_value[i] = m_value[i] / rhs.m_value[i];
+    return r;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION simd& operator+=(const simd& rhs) {
+    for (int i = 0; i < N; ++i) m_value[i] += rhs.m_value[i];
+    return *this;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION simd& operator-=(const simd& rhs) {
+    for (int i = 0; i < N; ++i) m_value[i] -= rhs.m_value[i];
+    return *this;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION simd& operator*=(const simd& rhs) {
+    for (int i = 0; i < N; ++i) m_value[i] *= rhs.m_value[i];
+    return *this;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION simd& operator/=(const simd& rhs) {
+    for (int i = 0; i < N; ++i) m_value[i] /= rhs.m_value[i];
+    return *this;
+  }
+
+  //! Horizontal sum of the lanes.
+  KOKKOS_FORCEINLINE_FUNCTION T reduce_add() const {
+    T sum = m_value[0];
+    for (int i = 1; i < N; ++i) sum += m_value[i];
+    return sum;
+  }
+
+ private:
+  alignas(N * sizeof(T)) T m_value[N];
+};
+
+/** \brief  Iterate a range in simd-width chunks.
+ *
+ *  Invokes op(i, width_tag) for each aligned chunk start i, where
+ *  width_tag is simd<T, Abi> sized, and op(i, scalar_tag) for the
+ *  remainder, so one functor covers both the vector body and the tail.
+ *  Inside Cuda kernels Abi is simd_abi::scalar and every iteration is a
+ *  remainder iteration, matching ThreadVectorRange semantics.
+ */
+template <class Abi, class iType, class Operation>
+KOKKOS_FORCEINLINE_FUNCTION void simd_for(const iType count,
+                                          const Operation& op) {
+  const iType vend = count - (count % iType(Abi::size));
+  for (iType i = 0; i < vend; i += iType(Abi::size)) op(i, Abi());
+  for (iType i = vend; i < count; ++i) op(i, simd_abi::scalar());
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_SIMD_HPP */
@@ -0,0 +1,188 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+#ifndef KOKKOS_SCOPEDARENA_HPP
+#define KOKKOS_SCOPEDARENA_HPP
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <Kokkos_Core_fwd.hpp>
+#include <Kokkos_View.hpp>
+#include <Kokkos_MemoryTraits.hpp>
+
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  Arena allocator for temporary Views with scoped lifetime.
+ *
+ *  A ScopedArena owns one untracked slab of its memory space and hands
+ *  out unmanaged Views by bumping an offset into that slab:
+ *
+ *    Kokkos::Experimental::ScopedArena<> arena( 1 << 20 );
+ *    auto tmp  = arena.view<double*>( n );
+ *    auto tmp2 = arena.view<double**>( n , m );
+ *
+ *  Handing out a View is a pointer bump with no SharedAllocationRecord
+ *  header, no atomic reference count and no allocator call; everything
+ *  is released at once when the arena goes out of scope.  This is the
+ *  right tool for intermediate results whose lifetime is strictly
+ *  nested inside a host code scope, where full tracked allocation is
+ *  pure overhead.
+ *
+ *  Requests that do not fit in the remaining slab space fall back to an
+ *  untracked allocation from the memory space, released in the arena
+ *  destructor, so exceeding the capacity costs performance rather than
+ *  correctness.  The high_water_mark() accessor reports the slab size
+ *  that would have avoided any fallback.
+ *
+ *  The Views are unmanaged: their elements are not initialized, they
+ *  must not outlive the arena, and reset() invalidates all Views
+ *  previously handed out.  The arena itself is not thread safe; create
+ *  one per thread or request Views outside parallel regions.
+ */
+template <class Space = Kokkos::HostSpace>
+class ScopedArena {
+ public:
+  typedef typename Space::memory_space memory_space;
+  typedef typename Space::execution_space execution_space;
+  typedef Kokkos::Device<execution_space, memory_space> device_type;
+
+  /**\brief  The type of View handed out for a given data type */
+  template <class DataType>
+  using view_type = Kokkos::View<DataType, device_type,
+                                 Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  explicit ScopedArena(const size_t arg_capacity,
+                       const memory_space& arg_space = memory_space())
+      : m_space(arg_space),
+        m_slab(reinterpret_cast<char*>(arg_space.allocate(arg_capacity))),
+        m_capacity(arg_capacity),
+        m_used(0),
+        m_high_water(0),
+        m_overflow() {}
+
+  ~ScopedArena() {
+    for (size_t i = 0; i < m_overflow.size(); ++i) {
+      m_space.deallocate(m_overflow[i].first, m_overflow[i].second);
+    }
+    m_space.deallocate(m_slab, m_capacity);
+  }
+
+  ScopedArena()                   = delete;
+  ScopedArena(const ScopedArena&) = delete;
+  ScopedArena& operator=(const ScopedArena&) = delete;
+
+  /**\brief  Hand out an unmanaged View of the given dimensions */
+  template <class DataType>
+  view_type<DataType> view(const size_t arg_N0 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                           const size_t arg_N1 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                           const size_t arg_N2 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                           const size_t arg_N3 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                           const size_t arg_N4 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                           const size_t arg_N5 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                           const size_t arg_N6 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                           const size_t arg_N7 = KOKKOS_IMPL_CTOR_DEFAULT_ARG) {
+    typedef view_type<DataType> v_t;
+
+    const size_t bytes = v_t::required_allocation_size(
+        arg_N0, arg_N1, arg_N2, arg_N3, arg_N4, arg_N5, arg_N6, arg_N7);
+
+    return v_t(reinterpret_cast<typename v_t::pointer_type>(claim(bytes)),
+               arg_N0, arg_N1, arg_N2, arg_N3, arg_N4, arg_N5, arg_N6, arg_N7);
+  }
+
+  /**\brief  Release all Views handed out and rewind to an empty slab */
+  void reset() {
+    for (size_t i = 0; i < m_overflow.size(); ++i) {
+      m_space.deallocate(m_overflow[i].first, m_overflow[i].second);
+    }
+    m_overflow.clear();
+    m_used = 0;
+  }
+
+  size_t capacity() const { return m_capacity; }
+  size_t used() const { return m_used; }
+
+  /**\brief  Largest concurrent slab demand observed, including fallback
+   *         allocations; a capacity of this size avoids any fallback. */
+  size_t high_water_mark() const { return m_high_water; }
+
+ private:
+  enum : size_t { alignment = Kokkos::Impl::MEMORY_ALIGNMENT };
+  enum : size_t { alignment_mask = alignment - 1 };
+
+  void* claim(const size_t arg_bytes) {
+    const size_t offset = (m_used + alignment_mask) & ~size_t(alignment_mask);
+
+    if (offset + arg_bytes <= m_capacity) {
+      m_used = offset + arg_bytes;
+      if (m_high_water < m_used) m_high_water = m_used;
+      return m_slab + offset;
+    }
+
+    // Does not fit: fall back to an untracked base space allocation
+    // released in the destructor (or at reset).
+
+    void* const ptr = m_space.allocate(arg_bytes);
+    m_overflow.push_back(
+        std::pair<void*, size_t>(ptr, arg_bytes));
+    if (m_high_water < offset + arg_bytes) m_high_water = offset + arg_bytes;
+    return ptr;
+  }
+
+  const memory_space m_space;
+  char* const m_slab;
+  const size_t m_capacity;
+  size_t m_used;
+  size_t m_high_water;
+  std::vector<std::pair<void*, size_t> > m_overflow;
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // #define KOKKOS_SCOPEDARENA_HPP
@@ -0,0 +1,268 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_ScratchPlan.hpp
+/// \brief Priority-negotiated placement of team scratch across levels.
+///
+/// A ScratchPlan takes a set of per-team scratch array requests with
+/// declared priorities and places them across scratch level 0 (shared
+/// memory on GPUs) and level 1 (global scratch) against a level-0
+/// capacity, keeping the hottest arrays in level 0 and spilling the
+/// rest, so one functor source runs at its best-achievable occupancy
+/// on devices with different shared memory capacities.
+
+#ifndef KOKKOS_SCRATCHPLAN_HPP
+#define KOKKOS_SCRATCHPLAN_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_Core_fwd.hpp>
+#include <impl/Kokkos_Error.hpp>
+
+#include <cstddef>
+
+namespace Kokkos {
+namespace Impl {
+
+// Conservative per-team level-0 scratch capacity to negotiate against
+// when the caller does not supply one.  GPUs have a hard shared memory
+// limit; host backends draw scratch from the heap, so everything can
+// stay in level 0 there.
+template <class ExecSpace>
+struct ScratchLevel0Limit {
+  enum : size_t { value = size_t(1) << 20 };
+};
+
+#if defined(KOKKOS_ENABLE_CUDA)
+template <>
+struct ScratchLevel0Limit<Kokkos::Cuda> {
+  enum : size_t { value = size_t(48) << 10 };
+};
+#endif
+
+#if defined(KOKKOS_ENABLE_ROCM)
+template <>
+struct ScratchLevel0Limit<Kokkos::Experimental::ROCm> {
+  enum : size_t { value = size_t(64) << 10 };
+};
+#endif
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  Negotiated placement of per-team scratch arrays.
+ *
+ *  Host side: add() each per-team array with its byte size and a
+ *  priority (lower value = hotter = placed in level 0 first), then
+ *  negotiate() against a level-0 capacity - explicit, or the backend
+ *  default via negotiate<ExecSpace>().  Arrays are kept in level 0 in
+ *  priority order while they fit and spill to level 1 otherwise.
+ *  apply(policy) returns the policy with both levels' scratch sizes
+ *  set.
+ *
+ *  Device side: bind(team) draws each level's block from the team's
+ *  scratch exactly once and returns per-slot pointers; get<T>(slot)
+ *  yields the array regardless of where it landed, so the functor
+ *  source does not change when the placement does.
+ *
+ *  The plan is a trivially copyable value - capture it in the functor
+ *  by value after negotiating.
+ */
+class ScratchPlan {
+ public:
+  enum : int { max_slots = 16 };
+  enum : size_t { alignment = 16 };
+
+  ScratchPlan() : m_count(0), m_negotiated(false) {
+    for (int i = 0; i < max_slots; ++i) {
+      m_bytes[i]    = 0;
+      m_priority[i] = 0;
+      m_level[i]    = 0;
+      m_offset[i]   = 0;
+    }
+    m_level_bytes[0] = 0;
+    m_level_bytes[1] = 0;
+  }
+
+  /// \brief Request a per-team array of arg_bytes bytes; lower
+  ///        arg_priority values are kept in level 0 first.  Returns the
+  ///        slot handle used with get().
+  int add(const size_t arg_bytes, const int arg_priority = 0) {
+    if (max_slots == m_count) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::ScratchPlan exceeded max_slots");
+    }
+    m_bytes[m_count]    = arg_bytes;
+    m_priority[m_count] = arg_priority;
+    m_negotiated        = false;
+    return m_count++;
+  }
+
+  /// \brief Request a per-team array of arg_count elements of type T.
+  template <class T>
+  int add_array(const size_t arg_count, const int arg_priority = 0) {
+    return add(arg_count * sizeof(T), arg_priority);
+  }
+
+  /// \brief Place every slot against an explicit level-0 capacity in
+  ///        bytes.
+  void negotiate(const size_t arg_level0_capacity) {
+    // Stable order by priority: hottest first, insertion order among
+    // equals
+    int order[max_slots];
+    for (int i = 0; i < m_count; ++i) order[i] = i;
+    for (int i = 1; i < m_count; ++i) {
+      const int s = order[i];
+      int j       = i;
+      while (0 < j && m_priority[order[j - 1]] > m_priority[s]) {
+        order[j] = order[j - 1];
+        --j;
+      }
+      order[j] = s;
+    }
+
+    m_level_bytes[0] = 0;
+    m_level_bytes[1] = 0;
+    for (int i = 0; i < m_count; ++i) {
+      const int s          = order[i];
+      const size_t aligned = align_up(m_bytes[s]);
+      if (m_level_bytes[0] + aligned <= arg_level0_capacity) {
+        m_level[s]  = 0;
+        m_offset[s] = m_level_bytes[0];
+        m_level_bytes[0] += aligned;
+      } else {
+        m_level[s]  = 1;
+        m_offset[s] = m_level_bytes[1];
+        m_level_bytes[1] += aligned;
+      }
+    }
+    m_negotiated = true;
+  }
+
+  /// \brief Place every slot against the backend's default level-0
+  ///        capacity.
+  template <class ExecSpace = Kokkos::DefaultExecutionSpace>
+  void negotiate() {
+    negotiate(size_t(Kokkos::Impl::ScratchLevel0Limit<ExecSpace>::value));
+  }
+
+  /// \brief Per-team bytes the plan occupies on a scratch level.
+  size_t level_bytes(const int arg_level) const {
+    verify_negotiated();
+    return m_level_bytes[arg_level];
+  }
+
+  /// \brief Level a slot was placed on.
+  int level(const int arg_slot) const {
+    verify_negotiated();
+    return m_level[arg_slot];
+  }
+
+  /// \brief The policy with both levels' per-team scratch sizes set.
+  template <class Policy>
+  Policy apply(Policy arg_policy) const {
+    verify_negotiated();
+    return arg_policy.set_scratch_size(0, Kokkos::PerTeam(m_level_bytes[0]))
+        .set_scratch_size(1, Kokkos::PerTeam(m_level_bytes[1]));
+  }
+
+  /// \brief Per-team pointers into the scratch levels; obtain once per
+  ///        team inside the kernel.
+  class TeamScratch {
+   public:
+    template <class T>
+    KOKKOS_INLINE_FUNCTION T* get(const int arg_slot) const {
+      return reinterpret_cast<T*>(m_ptr[arg_slot]);
+    }
+
+   private:
+    friend class ScratchPlan;
+    void* m_ptr[max_slots];
+  };
+
+  template <class Member>
+  KOKKOS_INLINE_FUNCTION TeamScratch bind(const Member& team) const {
+    char* base[2] = {nullptr, nullptr};
+    if (0 != m_level_bytes[0]) {
+      base[0] = reinterpret_cast<char*>(
+          team.team_shmem().get_shmem(m_level_bytes[0]));
+    }
+    if (0 != m_level_bytes[1]) {
+      base[1] = reinterpret_cast<char*>(
+          team.team_scratch(1).get_shmem(m_level_bytes[1]));
+    }
+    TeamScratch scratch;
+    for (int i = 0; i < m_count; ++i) {
+      scratch.m_ptr[i] = base[m_level[i]] + m_offset[i];
+    }
+    return scratch;
+  }
+
+ private:
+  static constexpr size_t align_up(const size_t x) {
+    return ((x + alignment - 1) / alignment) * alignment;
+  }
+
+  void verify_negotiated() const {
+    if (!m_negotiated) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::ScratchPlan used before negotiate()");
+    }
+  }
+
+  size_t m_bytes[max_slots];
+  size_t m_offset[max_slots];
+  size_t m_level_bytes[2];
+  int m_priority[max_slots];
+  int m_level[max_slots];
+  int m_count;
+  bool m_negotiated;
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_SCRATCHPLAN_HPP */
@@ -227,6 +227,9 @@ void serial_resize_thread_team_data(size_t pool_reduce_bytes,
 
 HostThreadTeamData* serial_get_thread_team_data();
 
+// Release the retained thread team data scratch memory
+void serial_trim_thread_team_data();
+
 } /* namespace Impl */
 } /* namespace Kokkos */
 
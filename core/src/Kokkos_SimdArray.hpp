@@ -0,0 +1,356 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_SimdArray.hpp
+/// \brief Aligned fixed-size array with elementwise arithmetic.
+///
+/// Kokkos::Array is a bare aggregate: no alignment control and no
+/// operators, so a register tile of Array<double, 8> spills instead of
+/// living in vector registers.  SimdArray pads its alignment up to the
+/// power of two covering its footprint (capped at 64 bytes) and adds
+/// elementwise arithmetic, fused multiply-add, and reduction members
+/// whose fixed-count loops compile to packed SIMD on host compilers
+/// and fully unrolled scalar code on device.  It stays an aggregate -
+/// brace-initializable like Array - and a scalar can be assigned to
+/// broadcast it.  reduction_identity is specialized, so SimdArray
+/// works directly as the value type of a parallel_reduce.
+
+#ifndef KOKKOS_SIMDARRAY_HPP
+#define KOKKOS_SIMDARRAY_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_NumericTraits.hpp>
+
+#include <type_traits>
+#include <cstddef>
+
+namespace Kokkos {
+namespace Impl {
+
+constexpr size_t simd_array_pow2(size_t n, size_t p = 1) {
+  return p >= n ? p : simd_array_pow2(n, p * 2);
+}
+
+// Alignment covering the whole footprint, capped at one cache line.
+constexpr size_t simd_array_alignment(size_t bytes) {
+  return simd_array_pow2(bytes) > 64 ? 64 : simd_array_pow2(bytes);
+}
+
+}  // namespace Impl
+
+namespace Experimental {
+
+template <class T, size_t N>
+struct alignas(
+    Kokkos::Impl::simd_array_alignment(sizeof(T) * N)) SimdArray {
+  static_assert(std::is_arithmetic<T>::value,
+                "Kokkos::SimdArray requires an arithmetic value type");
+  static_assert(N > 0, "Kokkos::SimdArray requires a positive extent");
+
+ public:
+  /**
+   * Public for aggregate initialization as in Kokkos::Array; shall
+   * not be accessed directly.
+   * @private
+   */
+  T m_internal_implementation_private_member_data[N];
+
+ public:
+  typedef T& reference;
+  typedef typename std::add_const<T>::type& const_reference;
+  typedef size_t size_type;
+  typedef ptrdiff_t difference_type;
+  typedef T value_type;
+  typedef T* pointer;
+  typedef typename std::add_const<T>::type* const_pointer;
+
+  KOKKOS_INLINE_FUNCTION static constexpr size_type size() { return N; }
+  KOKKOS_INLINE_FUNCTION static constexpr bool empty() { return false; }
+  KOKKOS_INLINE_FUNCTION constexpr size_type max_size() const { return N; }
+
+  template <typename iType>
+  KOKKOS_INLINE_FUNCTION reference operator[](const iType& i) {
+    static_assert(
+        (std::is_integral<iType>::value || std::is_enum<iType>::value),
+        "Must be integral argument");
+    return m_internal_implementation_private_member_data[i];
+  }
+
+  template <typename iType>
+  KOKKOS_INLINE_FUNCTION const_reference operator[](const iType& i) const {
+    static_assert(
+        (std::is_integral<iType>::value || std::is_enum<iType>::value),
+        "Must be integral argument");
+    return m_internal_implementation_private_member_data[i];
+  }
+
+  KOKKOS_INLINE_FUNCTION pointer data() {
+    return &m_internal_implementation_private_member_data[0];
+  }
+  KOKKOS_INLINE_FUNCTION const_pointer data() const {
+    return &m_internal_implementation_private_member_data[0];
+  }
+
+  SimdArray& operator=(const SimdArray&) = default;
+
+  // Volatile copy and accumulate, as required of reduction value types.
+  KOKKOS_INLINE_FUNCTION void operator=(const volatile SimdArray& rhs) volatile {
+    for (size_t i = 0; i < N; ++i)
+      m_internal_implementation_private_member_data[i] =
+          rhs.m_internal_implementation_private_member_data[i];
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator+=(const volatile SimdArray& rhs) volatile {
+    for (size_t i = 0; i < N; ++i)
+      m_internal_implementation_private_member_data[i] +=
+          rhs.m_internal_implementation_private_member_data[i];
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator*=(const volatile SimdArray& rhs) volatile {
+    for (size_t i = 0; i < N; ++i)
+      m_internal_implementation_private_member_data[i] *=
+          rhs.m_internal_implementation_private_member_data[i];
+  }
+
+  /** \brief  Broadcast a scalar to every lane. */
+  KOKKOS_INLINE_FUNCTION SimdArray& operator=(const T rhs) {
+    for (size_t i = 0; i < N; ++i)
+      m_internal_implementation_private_member_data[i] = rhs;
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION SimdArray& operator+=(const SimdArray& rhs) {
+    for (size_t i = 0; i < N; ++i)
+      m_internal_implementation_private_member_data[i] +=
+          rhs.m_internal_implementation_private_member_data[i];
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION SimdArray& operator-=(const SimdArray& rhs) {
+    for (size_t i = 0; i < N; ++i)
+      m_internal_implementation_private_member_data[i] -=
+          rhs.m_internal_implementation_private_member_data[i];
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION SimdArray& operator*=(const SimdArray& rhs) {
+    for (size_t i = 0; i < N; ++i)
+      m_internal_implementation_private_member_data[i] *=
+          rhs.m_internal_implementation_private_member_data[i];
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION SimdArray& operator/=(const SimdArray& rhs) {
+    for (size_t i = 0; i < N; ++i)
+      m_internal_implementation_private_member_data[i] /=
+          rhs.m_internal_implementation_private_member_data[i];
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION SimdArray& operator+=(const T rhs) {
+    for (size_t i = 0; i < N; ++i)
+      m_internal_implementation_private_member_data[i] += rhs;
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION SimdArray& operator-=(const T rhs) {
+    for (size_t i = 0; i < N; ++i)
+      m_internal_implementation_private_member_data[i] -= rhs;
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION SimdArray& operator*=(const T rhs) {
+    for (size_t i = 0; i < N; ++i)
+      m_internal_implementation_private_member_data[i] *= rhs;
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION SimdArray& operator/=(const T rhs) {
+    for (size_t i = 0; i < N; ++i)
+      m_internal_implementation_private_member_data[i] /= rhs;
+    return *this;
+  }
+
+  /** \brief  Accumulate a*b into this array elementwise. */
+  KOKKOS_INLINE_FUNCTION SimdArray& fma(const SimdArray& a,
+                                        const SimdArray& b) {
+    for (size_t i = 0; i < N; ++i)
+      m_internal_implementation_private_member_data[i] +=
+          a.m_internal_implementation_private_member_data[i] *
+          b.m_internal_implementation_private_member_data[i];
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION T sum() const {
+    T r = m_internal_implementation_private_member_data[0];
+    for (size_t i = 1; i < N; ++i)
+      r += m_internal_implementation_private_member_data[i];
+    return r;
+  }
+
+  KOKKOS_INLINE_FUNCTION T min() const {
+    T r = m_internal_implementation_private_member_data[0];
+    for (size_t i = 1; i < N; ++i)
+      if (m_internal_implementation_private_member_data[i] < r)
+        r = m_internal_implementation_private_member_data[i];
+    return r;
+  }
+
+  KOKKOS_INLINE_FUNCTION T max() const {
+    T r = m_internal_implementation_private_member_data[0];
+    for (size_t i = 1; i < N; ++i)
+      if (r < m_internal_implementation_private_member_data[i])
+        r = m_internal_implementation_private_member_data[i];
+    return r;
+  }
+};
+
+template <class T, size_t N>
+KOKKOS_INLINE_FUNCTION SimdArray<T, N> operator+(SimdArray<T, N> lhs,
+                                                 const SimdArray<T, N>& rhs) {
+  lhs += rhs;
+  return lhs;
+}
+
+template <class T, size_t N>
+KOKKOS_INLINE_FUNCTION SimdArray<T, N> operator-(SimdArray<T, N> lhs,
+                                                 const SimdArray<T, N>& rhs) {
+  lhs -= rhs;
+  return lhs;
+}
+
+template <class T, size_t N>
+KOKKOS_INLINE_FUNCTION SimdArray<T, N> operator*(SimdArray<T, N> lhs,
+                                                 const SimdArray<T, N>& rhs) {
+  lhs *= rhs;
+  return lhs;
+}
+
+template <class T, size_t N>
+KOKKOS_INLINE_FUNCTION SimdArray<T, N> operator/(SimdArray<T, N> lhs,
+                                                 const SimdArray<T, N>& rhs) {
+  lhs /= rhs;
+  return lhs;
+}
+
+template <class T, size_t N>
+KOKKOS_INLINE_FUNCTION SimdArray<T, N> operator*(SimdArray<T, N> lhs,
+                                                 const T rhs) {
+  lhs *= rhs;
+  return lhs;
+}
+
+template <class T, size_t N>
+KOKKOS_INLINE_FUNCTION SimdArray<T, N> operator*(const T lhs,
+                                                 SimdArray<T, N> rhs) {
+  rhs *= lhs;
+  return rhs;
+}
+
+template <class T, size_t N>
+KOKKOS_INLINE_FUNCTION SimdArray<T, N> operator+(SimdArray<T, N> lhs,
+                                                 const T rhs) {
+  lhs += rhs;
+  return lhs;
+}
+
+template <class T, size_t N>
+KOKKOS_INLINE_FUNCTION SimdArray<T, N> operator+(const T lhs,
+                                                 SimdArray<T, N> rhs) {
+  rhs += lhs;
+  return rhs;
+}
+
+/** \brief  Elementwise a*b+c. */
+template <class T, size_t N>
+KOKKOS_INLINE_FUNCTION SimdArray<T, N> fma(const SimdArray<T, N>& a,
+                                           const SimdArray<T, N>& b,
+                                           SimdArray<T, N> c) {
+  c.fma(a, b);
+  return c;
+}
+
+/** \brief  Lanewise dot product reduced to a scalar. */
+template <class T, size_t N>
+KOKKOS_INLINE_FUNCTION T dot(const SimdArray<T, N>& a,
+                             const SimdArray<T, N>& b) {
+  T r = a[0] * b[0];
+  for (size_t i = 1; i < N; ++i) r += a[i] * b[i];
+  return r;
+}
+
+}  // namespace Experimental
+
+template <class T, size_t N>
+struct reduction_identity<Kokkos::Experimental::SimdArray<T, N> > {
+  typedef reduction_identity<T> t_red_ident;
+  KOKKOS_FORCEINLINE_FUNCTION static Kokkos::Experimental::SimdArray<T, N>
+  sum() noexcept {
+    Kokkos::Experimental::SimdArray<T, N> r;
+    r = t_red_ident::sum();
+    return r;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION static Kokkos::Experimental::SimdArray<T, N>
+  prod() noexcept {
+    Kokkos::Experimental::SimdArray<T, N> r;
+    r = t_red_ident::prod();
+    return r;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION static Kokkos::Experimental::SimdArray<T, N>
+  min() noexcept {
+    Kokkos::Experimental::SimdArray<T, N> r;
+    r = t_red_ident::min();
+    return r;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION static Kokkos::Experimental::SimdArray<T, N>
+  max() noexcept {
+    Kokkos::Experimental::SimdArray<T, N> r;
+    r = t_red_ident::max();
+    return r;
+  }
+};
+
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_SIMDARRAY_HPP */
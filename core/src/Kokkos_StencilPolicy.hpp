@@ -0,0 +1,525 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+/// \file Kokkos_StencilPolicy.hpp
+/// \brief Tiled stencil dispatch with automatic halo staging.
+///
+/// Every stencil application that wants scratch-staged tiles writes the
+/// same TeamPolicy boilerplate: compute tile coordinates from the
+/// league rank, cooperatively gather tile plus halo into scratch,
+/// barrier, then index the staged block with hand-maintained offsets.
+/// StencilPolicy declares the tile shape and halo width once; the
+/// parallel_for overloads below stage the input View tile into team
+/// scratch and hand the functor its global coordinates together with a
+/// stencil accessor addressed by offsets from the current point.
+/// Halo reads outside the index domain clamp to the domain boundary.
+
+#ifndef KOKKOS_STENCILPOLICY_HPP
+#define KOKKOS_STENCILPOLICY_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_View.hpp>
+#include <Kokkos_Parallel.hpp>
+#include <Kokkos_ExecPolicy.hpp>
+#include <Kokkos_TeamCopy.hpp>
+
+#include <string>
+
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  Rank-2 or rank-3 index box decomposed into tiles, each
+ *          staged into team scratch with a halo of the given width.
+ *
+ *  One team processes one tile; the staged block has extent
+ *  tile + 2 * halo in every dimension.  The staged block must fit the
+ *  execution space's level-0 team scratch.  With set_tiles_per_team(k)
+ *  each team processes k consecutive tiles through a double-buffered
+ *  staging pipeline — the next tile's stage is issued asynchronously
+ *  while the current one computes — at the cost of twice the scratch.
+ */
+template <class ExecSpace = Kokkos::DefaultExecutionSpace>
+class StencilPolicy {
+ public:
+  typedef ExecSpace execution_space;
+  typedef std::int64_t index_type;
+
+ private:
+  int m_rank;
+  index_type m_begin[3];
+  index_type m_end[3];
+  int m_tile[3];
+  int m_halo;
+  int m_tiles_per_team;
+
+  void validate() const {
+    if (m_halo < 0 || m_tile[0] <= 0 || m_tile[1] <= 0 || m_tile[2] <= 0) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::StencilPolicy requires positive tile "
+          "extents and a non-negative halo width");
+    }
+  }
+
+ public:
+  StencilPolicy(const index_type (&arg_begin)[2], const index_type (&arg_end)[2],
+                const int (&arg_tile)[2], const int arg_halo)
+      : m_rank(2), m_halo(arg_halo), m_tiles_per_team(1) {
+    for (int d = 0; d < 2; ++d) {
+      m_begin[d] = arg_begin[d];
+      m_end[d]   = arg_end[d] > arg_begin[d] ? arg_end[d] : arg_begin[d];
+      m_tile[d]  = arg_tile[d];
+    }
+    m_begin[2] = 0;
+    m_end[2]   = 1;
+    m_tile[2]  = 1;
+    validate();
+  }
+
+  StencilPolicy(const index_type (&arg_begin)[3], const index_type (&arg_end)[3],
+                const int (&arg_tile)[3], const int arg_halo)
+      : m_rank(3), m_halo(arg_halo), m_tiles_per_team(1) {
+    for (int d = 0; d < 3; ++d) {
+      m_begin[d] = arg_begin[d];
+      m_end[d]   = arg_end[d] > arg_begin[d] ? arg_end[d] : arg_begin[d];
+      m_tile[d]  = arg_tile[d];
+    }
+    validate();
+  }
+
+  int rank() const noexcept { return m_rank; }
+  index_type begin(const int d) const { return m_begin[d]; }
+  index_type end(const int d) const { return m_end[d]; }
+  int tile(const int d) const { return m_tile[d]; }
+  int halo() const noexcept { return m_halo; }
+
+  /** \brief  Staged extent of dimension d: tile plus halo on both sides */
+  int stage_extent(const int d) const {
+    return d < m_rank ? m_tile[d] + 2 * m_halo : 1;
+  }
+
+  int tiles_in_dim(const int d) const {
+    return d < m_rank
+               ? int((m_end[d] - m_begin[d] + m_tile[d] - 1) / m_tile[d])
+               : 1;
+  }
+
+  index_type num_tiles() const {
+    return index_type(tiles_in_dim(0)) * tiles_in_dim(1) * tiles_in_dim(2);
+  }
+
+  /** \brief  Process 'count' consecutive tiles per team, staging tile
+   *          k+1 while tile k computes.  Doubles the scratch request
+   *          when count > 1.
+   */
+  StencilPolicy& set_tiles_per_team(const int count) {
+    if (count <= 0) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::StencilPolicy::set_tiles_per_team requires "
+          "a positive count");
+    }
+    m_tiles_per_team = count;
+    return *this;
+  }
+
+  int tiles_per_team() const noexcept { return m_tiles_per_team; }
+
+  /** \brief  Number of teams to launch given tiles_per_team. */
+  index_type num_leagues() const {
+    return (num_tiles() + m_tiles_per_team - 1) / m_tiles_per_team;
+  }
+};
+
+namespace Impl {
+
+/** \brief  Offset-addressed window into a staged tile.
+ *
+ *  operator()(d0, d1[, d2]) reads input(i0 + d0, i1 + d1[, i2 + d2])
+ *  from scratch, where (i0, i1, i2) is the point the functor was called
+ *  for.  Offsets beyond the halo width are out of the staged block.
+ */
+template <class ValueType>
+struct StencilStage2 {
+  const ValueType* m_stage;
+  int m_stride0;
+  int m_center;
+
+  KOKKOS_INLINE_FUNCTION const ValueType& operator()(const int d0,
+                                                     const int d1) const {
+    return m_stage[m_center + d0 * m_stride0 + d1];
+  }
+};
+
+template <class ValueType>
+struct StencilStage3 {
+  const ValueType* m_stage;
+  int m_stride0;
+  int m_stride1;
+  int m_center;
+
+  KOKKOS_INLINE_FUNCTION const ValueType& operator()(const int d0,
+                                                     const int d1,
+                                                     const int d2) const {
+    return m_stage[m_center + d0 * m_stride0 + d1 * m_stride1 + d2];
+  }
+};
+
+KOKKOS_INLINE_FUNCTION std::int64_t stencil_clamp(const std::int64_t i,
+                                                  const std::int64_t lo,
+                                                  const std::int64_t hi) {
+  return i < lo ? lo : (i < hi ? i : hi - 1);
+}
+
+template <class ExecSpace, class ViewType, class FunctorType>
+struct StencilTeamFunctor2 {
+  typedef typename Kokkos::TeamPolicy<ExecSpace>::member_type member_type;
+  typedef typename ViewType::non_const_value_type value_type;
+  typedef std::int64_t index_type;
+
+  ViewType m_input;
+  FunctorType m_functor;
+  index_type m_begin[2];
+  index_type m_end[2];
+  int m_tile[2];
+  int m_halo;
+  int m_tiles1;
+  index_type m_num_tiles;
+  int m_tiles_per_team;
+
+  // Cooperative staging: consecutive lanes load consecutive elements
+  // of the fastest staged dimension.  Out-of-domain halo clamps to
+  // the boundary.  Issued without a barrier so it can overlap the
+  // previous tile's compute in the double-buffered pipeline.
+  KOKKOS_INLINE_FUNCTION void stage_tile(const member_type& member,
+                                         value_type* const stage,
+                                         const index_type tile_rank) const {
+    const int t0 = int(tile_rank) / m_tiles1;
+    const int t1 = int(tile_rank) % m_tiles1;
+
+    const index_type g0 = m_begin[0] + index_type(t0) * m_tile[0];
+    const index_type g1 = m_begin[1] + index_type(t1) * m_tile[1];
+
+    const int s0 = m_tile[0] + 2 * m_halo;
+    const int s1 = m_tile[1] + 2 * m_halo;
+
+    Kokkos::parallel_for(
+        Kokkos::TeamVectorRange(member, s0 * s1), [&](const int idx) {
+          const int l0 = idx / s1;
+          const int l1 = idx % s1;
+          stage[idx]   = m_input(
+              stencil_clamp(g0 - m_halo + l0, m_begin[0], m_end[0]),
+              stencil_clamp(g1 - m_halo + l1, m_begin[1], m_end[1]));
+        });
+  }
+
+  KOKKOS_INLINE_FUNCTION void compute_tile(const member_type& member,
+                                           const value_type* const stage,
+                                           const index_type tile_rank) const {
+    const int t0 = int(tile_rank) / m_tiles1;
+    const int t1 = int(tile_rank) % m_tiles1;
+
+    const index_type g0 = m_begin[0] + index_type(t0) * m_tile[0];
+    const index_type g1 = m_begin[1] + index_type(t1) * m_tile[1];
+
+    const int s1 = m_tile[1] + 2 * m_halo;
+
+    const int n0 = int(m_end[0] - g0 < m_tile[0] ? m_end[0] - g0 : m_tile[0]);
+    const int n1 = int(m_end[1] - g1 < m_tile[1] ? m_end[1] - g1 : m_tile[1]);
+
+    Kokkos::parallel_for(
+        Kokkos::TeamVectorRange(member, n0 * n1), [&](const int idx) {
+          const int p0 = idx / n1;
+          const int p1 = idx % n1;
+          StencilStage2<value_type> window = {
+              stage, s1, (m_halo + p0) * s1 + (m_halo + p1)};
+          m_functor(g0 + p0, g1 + p1, window);
+        });
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const member_type& member) const {
+    const index_type first =
+        index_type(member.league_rank()) * m_tiles_per_team;
+    index_type count = m_num_tiles - first;
+    if (count <= 0) return;
+    if (count > m_tiles_per_team) count = m_tiles_per_team;
+
+    const size_t block = sizeof(value_type) *
+                         size_t(m_tile[0] + 2 * m_halo) *
+                         size_t(m_tile[1] + 2 * m_halo);
+
+    value_type* buffer[2];
+    buffer[0] = (value_type*)member.team_shmem().get_shmem(block);
+    buffer[1] = m_tiles_per_team > 1
+                    ? (value_type*)member.team_shmem().get_shmem(block)
+                    : buffer[0];
+
+    stage_tile(member, buffer[0], first);
+    Kokkos::Experimental::team_copy_wait(member);
+
+    for (index_type k = 0; k < count; ++k) {
+      // Double buffer: issue the next tile's stage, compute the current
+      // one, then wait — completing the stage and protecting the buffer
+      // the next iteration overwrites.
+      if (k + 1 < count)
+        stage_tile(member, buffer[int((k + 1) & 1)], first + k + 1);
+      compute_tile(member, buffer[int(k & 1)], first + k);
+      Kokkos::Experimental::team_copy_wait(member);
+    }
+  }
+};
+
+template <class ExecSpace, class ViewType, class FunctorType>
+struct StencilTeamFunctor3 {
+  typedef typename Kokkos::TeamPolicy<ExecSpace>::member_type member_type;
+  typedef typename ViewType::non_const_value_type value_type;
+  typedef std::int64_t index_type;
+
+  ViewType m_input;
+  FunctorType m_functor;
+  index_type m_begin[3];
+  index_type m_end[3];
+  int m_tile[3];
+  int m_halo;
+  int m_tiles1;
+  int m_tiles2;
+  index_type m_num_tiles;
+  int m_tiles_per_team;
+
+  // Cooperative staging; see the rank-2 functor.
+  KOKKOS_INLINE_FUNCTION void stage_tile(const member_type& member,
+                                         value_type* const stage,
+                                         const index_type arg_tile) const {
+    index_type tile_rank = arg_tile;
+    const int t2         = int(tile_rank % m_tiles2);
+    tile_rank /= m_tiles2;
+    const int t1 = int(tile_rank % m_tiles1);
+    const int t0 = int(tile_rank / m_tiles1);
+
+    const index_type g0 = m_begin[0] + index_type(t0) * m_tile[0];
+    const index_type g1 = m_begin[1] + index_type(t1) * m_tile[1];
+    const index_type g2 = m_begin[2] + index_type(t2) * m_tile[2];
+
+    const int s0 = m_tile[0] + 2 * m_halo;
+    const int s1 = m_tile[1] + 2 * m_halo;
+    const int s2 = m_tile[2] + 2 * m_halo;
+
+    Kokkos::parallel_for(
+        Kokkos::TeamVectorRange(member, s0 * s1 * s2), [&](const int idx) {
+          const int l2  = idx % s2;
+          const int l01 = idx / s2;
+          const int l1  = l01 % s1;
+          const int l0  = l01 / s1;
+          stage[idx]    = m_input(
+              stencil_clamp(g0 - m_halo + l0, m_begin[0], m_end[0]),
+              stencil_clamp(g1 - m_halo + l1, m_begin[1], m_end[1]),
+              stencil_clamp(g2 - m_halo + l2, m_begin[2], m_end[2]));
+        });
+  }
+
+  KOKKOS_INLINE_FUNCTION void compute_tile(const member_type& member,
+                                           const value_type* const stage,
+                                           const index_type arg_tile) const {
+    index_type tile_rank = arg_tile;
+    const int t2         = int(tile_rank % m_tiles2);
+    tile_rank /= m_tiles2;
+    const int t1 = int(tile_rank % m_tiles1);
+    const int t0 = int(tile_rank / m_tiles1);
+
+    const index_type g0 = m_begin[0] + index_type(t0) * m_tile[0];
+    const index_type g1 = m_begin[1] + index_type(t1) * m_tile[1];
+    const index_type g2 = m_begin[2] + index_type(t2) * m_tile[2];
+
+    const int s1 = m_tile[1] + 2 * m_halo;
+    const int s2 = m_tile[2] + 2 * m_halo;
+
+    const int n0 = int(m_end[0] - g0 < m_tile[0] ? m_end[0] - g0 : m_tile[0]);
+    const int n1 = int(m_end[1] - g1 < m_tile[1] ? m_end[1] - g1 : m_tile[1]);
+    const int n2 = int(m_end[2] - g2 < m_tile[2] ? m_end[2] - g2 : m_tile[2]);
+
+    Kokkos::parallel_for(
+        Kokkos::TeamVectorRange(member, n0 * n1 * n2), [&](const int idx) {
+          const int p2  = idx % n2;
+          const int p01 = idx / n2;
+          const int p1  = p01 % n1;
+          const int p0  = p01 / n1;
+          StencilStage3<value_type> window = {
+              stage, s1 * s2, s2,
+              ((m_halo + p0) * s1 + (m_halo + p1)) * s2 + (m_halo + p2)};
+          m_functor(g0 + p0, g1 + p1, g2 + p2, window);
+        });
+  }
+
+  KOKKOS_INLINE_FUNCTION void operator()(const member_type& member) const {
+    const index_type first =
+        index_type(member.league_rank()) * m_tiles_per_team;
+    index_type count = m_num_tiles - first;
+    if (count <= 0) return;
+    if (count > m_tiles_per_team) count = m_tiles_per_team;
+
+    const size_t block = sizeof(value_type) *
+                         size_t(m_tile[0] + 2 * m_halo) *
+                         size_t(m_tile[1] + 2 * m_halo) *
+                         size_t(m_tile[2] + 2 * m_halo);
+
+    value_type* buffer[2];
+    buffer[0] = (value_type*)member.team_shmem().get_shmem(block);
+    buffer[1] = m_tiles_per_team > 1
+                    ? (value_type*)member.team_shmem().get_shmem(block)
+                    : buffer[0];
+
+    stage_tile(member, buffer[0], first);
+    Kokkos::Experimental::team_copy_wait(member);
+
+    for (index_type k = 0; k < count; ++k) {
+      // Double buffer: issue the next tile's stage, compute the current
+      // one, then wait — completing the stage and protecting the buffer
+      // the next iteration overwrites.
+      if (k + 1 < count)
+        stage_tile(member, buffer[int((k + 1) & 1)], first + k + 1);
+      compute_tile(member, buffer[int(k & 1)], first + k);
+      Kokkos::Experimental::team_copy_wait(member);
+    }
+  }
+};
+
+}  // namespace Impl
+
+/** \brief  Staged stencil sweep over a rank-2 View.
+ *
+ *  The functor is called as functor(i0, i1, window) for every point of
+ *  [begin, end) with 'window' reading input(i0 + d0, i1 + d1) from
+ *  scratch for offsets within the halo width.
+ */
+template <class ExecSpace, class ViewType, class FunctorType>
+inline typename std::enable_if<unsigned(ViewType::Rank) == 2>::type
+parallel_for(const std::string& arg_label,
+             const StencilPolicy<ExecSpace>& arg_policy,
+             const ViewType& arg_input, const FunctorType& arg_functor) {
+  typedef typename ViewType::non_const_value_type value_type;
+  typedef Impl::StencilTeamFunctor2<ExecSpace, ViewType, FunctorType> closure;
+
+  if (2 != arg_policy.rank()) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::parallel_for(StencilPolicy): rank-2 input "
+        "View requires a rank-2 policy");
+  }
+
+  closure c = {arg_input,
+               arg_functor,
+               {arg_policy.begin(0), arg_policy.begin(1)},
+               {arg_policy.end(0), arg_policy.end(1)},
+               {arg_policy.tile(0), arg_policy.tile(1)},
+               arg_policy.halo(),
+               arg_policy.tiles_in_dim(1),
+               arg_policy.num_tiles(),
+               arg_policy.tiles_per_team()};
+
+  const size_t shmem = sizeof(value_type) *
+                       size_t(arg_policy.stage_extent(0)) *
+                       size_t(arg_policy.stage_extent(1)) *
+                       (arg_policy.tiles_per_team() > 1 ? 2 : 1);
+
+  Kokkos::parallel_for(
+      arg_label,
+      Kokkos::TeamPolicy<ExecSpace>(int(arg_policy.num_leagues()),
+                                    Kokkos::AUTO)
+          .set_scratch_size(0, Kokkos::PerTeam(shmem)),
+      c);
+}
+
+/** \brief  Staged stencil sweep over a rank-3 View; see the rank-2
+ *          overload.
+ */
+template <class ExecSpace, class ViewType, class FunctorType>
+inline typename std::enable_if<unsigned(ViewType::Rank) == 3>::type
+parallel_for(const std::string& arg_label,
+             const StencilPolicy<ExecSpace>& arg_policy,
+             const ViewType& arg_input, const FunctorType& arg_functor) {
+  typedef typename ViewType::non_const_value_type value_type;
+  typedef Impl::StencilTeamFunctor3<ExecSpace, ViewType, FunctorType> closure;
+
+  if (3 != arg_policy.rank()) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::parallel_for(StencilPolicy): rank-3 input "
+        "View requires a rank-3 policy");
+  }
+
+  closure c = {arg_input,
+               arg_functor,
+               {arg_policy.begin(0), arg_policy.begin(1), arg_policy.begin(2)},
+               {arg_policy.end(0), arg_policy.end(1), arg_policy.end(2)},
+               {arg_policy.tile(0), arg_policy.tile(1), arg_policy.tile(2)},
+               arg_policy.halo(),
+               arg_policy.tiles_in_dim(1),
+               arg_policy.tiles_in_dim(2),
+               arg_policy.num_tiles(),
+               arg_policy.tiles_per_team()};
+
+  const size_t shmem = sizeof(value_type) *
+                       size_t(arg_policy.stage_extent(0)) *
+                       size_t(arg_policy.stage_extent(1)) *
+                       size_t(arg_policy.stage_extent(2)) *
+                       (arg_policy.tiles_per_team() > 1 ? 2 : 1);
+
+  Kokkos::parallel_for(
+      arg_label,
+      Kokkos::TeamPolicy<ExecSpace>(int(arg_policy.num_leagues()),
+                                    Kokkos::AUTO)
+          .set_scratch_size(0, Kokkos::PerTeam(shmem)),
+      c);
+}
+
+template <class ExecSpace, class ViewType, class FunctorType>
+inline void parallel_for(const StencilPolicy<ExecSpace>& arg_policy,
+                         const ViewType& arg_input,
+                         const FunctorType& arg_functor) {
+  Kokkos::Experimental::parallel_for(
+      "Kokkos::Experimental::StencilPolicy::parallel_for", arg_policy,
+      arg_input, arg_functor);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_STENCILPOLICY_HPP
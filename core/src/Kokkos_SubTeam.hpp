@@ -0,0 +1,226 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_SubTeam.hpp
+/// \brief Sub-warp-width logical teams packed into hardware teams.
+///
+/// Kernels with narrow natural parallelism - 4, 8, or 16 cooperating
+/// lanes per work item - waste most of a warp when each work item
+/// occupies a full team, since the minimum effective team on Cuda is a
+/// warp.  The dispatch here lays logical teams on the vector dimension
+/// of TeamPolicy: each (league_rank, team_rank) pair of the underlying
+/// policy is one logical team whose lanes are the policy's vector
+/// lanes.  On Cuda that packs warp_size / sub_team_size independent
+/// logical teams into every warp, with lane cooperation through
+/// ThreadVectorRange and masked warp sync; on host backends the lanes
+/// are the usual serial vector loop of one thread.  League sizes scale
+/// accordingly: the launch covers num_sub_teams logical teams with
+/// num_sub_teams / team_size hardware teams.
+
+#ifndef KOKKOS_SUBTEAM_HPP
+#define KOKKOS_SUBTEAM_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_Parallel.hpp>
+#include <Kokkos_ExecPolicy.hpp>
+#include <impl/Kokkos_Error.hpp>
+
+#if defined(KOKKOS_ENABLE_CUDA)
+#include <Cuda/Kokkos_Cuda_Version_9_8_Compatibility.hpp>
+#endif
+
+#include <cstdint>
+#include <string>
+
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  Handle to one logical sub-team: a single team rank of the
+ *          underlying policy plus its vector lanes.
+ *
+ *  league_rank()/league_size() number the logical teams, not the
+ *  hardware teams.  Lanes cooperate through lane_range(n) - a
+ *  ThreadVectorRange over the member - so nested parallel_for /
+ *  parallel_reduce / parallel_scan and the vector single policy all
+ *  apply unchanged.  barrier() orders lane-private memory accesses
+ *  within this logical team only; diverged sibling teams in the same
+ *  warp are not required to participate.
+ */
+template <class MemberType>
+class SubTeamMember {
+ private:
+  const MemberType& m_member;
+  int64_t m_league_rank;
+  int64_t m_league_size;
+
+ public:
+  typedef MemberType member_type;
+
+  KOKKOS_INLINE_FUNCTION
+  SubTeamMember(const MemberType& member, const int64_t league_rank,
+                const int64_t league_size)
+      : m_member(member),
+        m_league_rank(league_rank),
+        m_league_size(league_size) {}
+
+  //! Rank of this logical team among all logical teams.
+  KOKKOS_INLINE_FUNCTION
+  int64_t league_rank() const { return m_league_rank; }
+
+  //! Total number of logical teams of the dispatch.
+  KOKKOS_INLINE_FUNCTION
+  int64_t league_size() const { return m_league_size; }
+
+  //! The underlying hardware team member, for scratch access etc.
+  KOKKOS_INLINE_FUNCTION
+  const MemberType& member() const { return m_member; }
+
+  //! Range over [0, count) distributed across this team's lanes.
+  template <typename iType>
+  KOKKOS_INLINE_FUNCTION
+  Kokkos::Impl::ThreadVectorRangeBoundariesStruct<iType, MemberType>
+  lane_range(const iType& count) const {
+    return Kokkos::ThreadVectorRange(m_member, count);
+  }
+
+  /** \brief  Synchronize the lanes of this logical team.
+   *
+   *  On Cuda this is a masked warp sync over exactly this team's
+   *  lanes, so sibling logical teams may diverge - including executing
+   *  different numbers of barriers - without deadlock.  On host
+   *  backends the lanes of a logical team execute on one thread and
+   *  the barrier is a no-op.
+   */
+  KOKKOS_INLINE_FUNCTION
+  void barrier() const {
+#if defined(__CUDA_ARCH__)
+    // Vector lanes are threadIdx.x; blockDim.x is the sub-team size
+    // and divides the warp, so a team's lanes are consecutive in it.
+    const unsigned lane = (threadIdx.y * blockDim.x + threadIdx.x) & 31u;
+    const unsigned mask =
+        (blockDim.x < 32 ? (1u << blockDim.x) - 1u : 0xffffffffu)
+        << (lane - threadIdx.x);
+    KOKKOS_IMPL_CUDA_SYNCWARP_MASK(mask);
+#endif
+  }
+};
+
+}  // namespace Experimental
+
+namespace Impl {
+
+//! Fan a hardware team member out to its logical sub-teams' functor calls.
+template <class FunctorType, class MemberType>
+struct SubTeamApply {
+  FunctorType m_functor;
+  int64_t m_num_sub_teams;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const MemberType& member) const {
+    const int64_t logical =
+        int64_t(member.league_rank()) * member.team_size() +
+        member.team_rank();
+    if (logical < m_num_sub_teams) {
+      m_functor(Kokkos::Experimental::SubTeamMember<MemberType>(
+          member, logical, m_num_sub_teams));
+    }
+  }
+};
+
+}  // namespace Impl
+
+namespace Experimental {
+
+/** \brief  Execute the functor once per logical sub-team of
+ *          sub_team_size lanes, packing logical teams into hardware
+ *          teams at full lane utilization.
+ *
+ *  The functor is called with a SubTeamMember.  sub_team_size must be
+ *  a power of two no larger than a warp; the hardware team size and
+ *  league size are derived from the policy's recommendation for the
+ *  wrapped functor.
+ *
+ *  \code
+ *    Kokkos::Experimental::parallel_for_sub_teams(
+ *        "trace", num_rays, 8, KOKKOS_LAMBDA(const sub_team& sub) {
+ *          Kokkos::parallel_for(sub.lane_range(8), [&](const int lane) {
+ *            ...  // 8 cooperating lanes per ray
+ *          });
+ *        });
+ *  \endcode
+ */
+template <class ExecSpace = Kokkos::DefaultExecutionSpace, class FunctorType>
+void parallel_for_sub_teams(const std::string& label,
+                            const int64_t num_sub_teams,
+                            const int sub_team_size,
+                            const FunctorType& functor) {
+  typedef Kokkos::TeamPolicy<ExecSpace> policy_type;
+  typedef typename policy_type::member_type member_type;
+
+  if (sub_team_size < 1 || 32 < sub_team_size ||
+      (sub_team_size & (sub_team_size - 1))) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::parallel_for_sub_teams: sub_team_size must "
+        "be a power of two in [1, 32]");
+  }
+  if (num_sub_teams <= 0) return;
+
+  const Kokkos::Impl::SubTeamApply<FunctorType, member_type> closure{
+      functor, num_sub_teams};
+
+  int team_size = policy_type(1, 1, sub_team_size)
+                      .team_size_recommended(closure, Kokkos::ParallelForTag());
+  if (team_size < 1) team_size = 1;
+  if (num_sub_teams < team_size) team_size = int(num_sub_teams);
+
+  const int64_t league = (num_sub_teams + team_size - 1) / team_size;
+
+  Kokkos::parallel_for(label, policy_type(league, team_size, sub_team_size),
+                       closure);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_SUBTEAM_HPP */
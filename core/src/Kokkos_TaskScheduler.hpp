@@ -677,6 +677,122 @@ respawn(FunctorType* arg_self, T const& arg,
   T::scheduler_type::respawn(arg_self, arg, arg_priority);
 }
 
+namespace Impl {
+
+// Helpers for Experimental::when_all_reduce (below)
+
+// Copies the value of one predecessor future into its slot; spawned with
+// that predecessor, so it runs as soon as the predecessor completes
+template <class Scheduler, class ValueType, class SlotsViewType>
+struct WhenAllReduceCapture {
+  using value_type = void;
+
+  Kokkos::BasicFuture<ValueType, Scheduler> m_predecessor;
+  SlotsViewType m_slots;
+  int m_slot;
+
+  template <class Member>
+  KOKKOS_INLINE_FUNCTION void operator()(Member&) const {
+    m_slots(m_slot) = m_predecessor.get();
+  }
+};
+
+// Joins the captured slots into the result of the returned future
+template <class ReducerType, class SlotsViewType>
+struct WhenAllReduceJoin {
+  using value_type = typename ReducerType::value_type;
+
+  ReducerType m_reducer;
+  SlotsViewType m_slots;
+
+  template <class Member>
+  KOKKOS_INLINE_FUNCTION void operator()(Member&, value_type& result) const {
+    m_reducer.init(result);
+    for (int i = 0; i < int(m_slots.extent(0)); ++i) {
+      m_reducer.join(result, m_slots(i));
+    }
+  }
+};
+
+// Generator for the when_all aggregate over the capture tasks
+template <class Scheduler, class ValueType, class SlotsViewType>
+struct WhenAllReduceCaptureSpawner {
+  Scheduler m_scheduler;
+  Kokkos::BasicFuture<ValueType, Scheduler> const* m_predecessors;
+  SlotsViewType m_slots;
+
+  Kokkos::BasicFuture<void, Scheduler> operator()(int i) const {
+    return Kokkos::host_spawn(
+        Kokkos::TaskSingle(m_scheduler, m_predecessors[i]),
+        WhenAllReduceCapture<Scheduler, ValueType, SlotsViewType>{
+            m_predecessors[i], m_slots, i});
+  }
+};
+
+}  // namespace Impl
+
+namespace Experimental {
+
+/**\brief  Aggregate predecessor futures into a future whose value is the
+ *  reduction of their values.
+ *
+ *  Each predecessor's value is captured by a small single task spawned
+ *  with that predecessor, so the capture runs as soon as the predecessor
+ *  completes and the predecessor's task record can be reclaimed without
+ *  waiting for the whole aggregate.  The reducer's join then combines
+ *  the captured values in one final task, whose future is returned.
+ *
+ *  Host-callable only.  The predecessor futures must be non-null,
+ *  non-void, and from the given scheduler.
+ */
+template <class ValueType, class Scheduler, class ReducerType>
+Kokkos::BasicFuture<typename ReducerType::value_type, Scheduler>
+when_all_reduce(
+    Scheduler arg_scheduler,
+    Kokkos::BasicFuture<ValueType, Scheduler> const arg_predecessors[],
+    int arg_n_predecessors, ReducerType const& arg_reducer) {
+  using result_type = typename ReducerType::value_type;
+  using slots_view_type =
+      Kokkos::View<result_type*, typename Scheduler::memory_space>;
+
+  static_assert(
+      !std::is_void<ValueType>::value,
+      "Kokkos when_all_reduce requires predecessor futures with values");
+
+  slots_view_type slots(
+      Kokkos::ViewAllocateWithoutInitializing("Kokkos::when_all_reduce"),
+      arg_n_predecessors);
+
+  auto all_captured = arg_scheduler.when_all(
+      arg_n_predecessors,
+      Kokkos::Impl::WhenAllReduceCaptureSpawner<Scheduler, ValueType, slots_view_type>{
+          arg_scheduler, arg_predecessors, slots});
+
+  return Kokkos::host_spawn(
+      Kokkos::TaskSingle(arg_scheduler, std::move(all_captured)),
+      Kokkos::Impl::WhenAllReduceJoin<ReducerType, slots_view_type>{arg_reducer,
+                                                            slots});
+}
+
+/**\brief  Spawn a batch of independent single tasks through a scheduler
+ *
+ *  Equivalent to calling task_spawn count times with TaskSingle and no
+ *  predecessor, but amortizes the per-task spawn setup; see
+ *  SimpleTaskScheduler::spawn_batch.  No futures are returned.
+ */
+template <typename Scheduler, typename FunctorGenerator>
+void spawn_batch(Scheduler& arg_scheduler, int arg_count,
+                 FunctorGenerator&& arg_generator,
+                 TaskPriority const& arg_priority = TaskPriority::Regular) {
+  static_assert(Kokkos::is_scheduler<Scheduler>::value,
+                "Kokkos spawn_batch argument must be a TaskScheduler");
+
+  arg_scheduler.spawn_batch(
+      arg_count, std::forward<FunctorGenerator>(arg_generator), arg_priority);
+}
+
+}  // namespace Experimental
+
 //----------------------------------------------------------------------------
 
 // template<typename ValueType, typename Scheduler>
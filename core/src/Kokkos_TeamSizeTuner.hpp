@@ -0,0 +1,218 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+#ifndef KOKKOS_TEAMSIZETUNER_HPP
+#define KOKKOS_TEAMSIZETUNER_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_Core_fwd.hpp>
+#include <Kokkos_Timer.hpp>
+
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+namespace Experimental {
+
+/// \class TeamSizeTuner
+/// \brief Measured team-size selection with a persistent tuning cache.
+///
+/// TeamPolicy's AUTO team size is a static heuristic; the measured-best team
+/// size for a given kernel can differ substantially between devices.  The
+/// tuner benchmarks a small candidate set over the first invocations of each
+/// kernel name, then locks in the fastest candidate.  If the environment
+/// variable KOKKOS_TUNING_CACHE_FILE names a file, converged results are
+/// written there and loaded again on the next run (the cache is read the
+/// first time the tuner is used after Kokkos::initialize), so production
+/// runs start tuned.
+///
+/// Usage, wrapping the dispatch in a scoped measurement:
+/// \code
+///   Kokkos::Experimental::TeamSizeTuner::Measurement tune("spmv", 512);
+///   Kokkos::TeamPolicy<> policy(nrows, tune.team_size());
+///   Kokkos::parallel_for("spmv", policy, functor);
+/// \endcode
+/// The measurement fences and records the elapsed time when it goes out of
+/// scope; once every candidate has been timed the choice is fixed.
+class TeamSizeTuner {
+ public:
+  enum { trials_per_candidate = 3 };
+
+ private:
+  struct Entry {
+    std::vector<int> candidates;
+    std::vector<double> best_times;
+    int invocations;
+    int best;
+    bool converged;
+
+    Entry() : invocations(0), best(0), converged(false) {}
+  };
+
+  std::map<std::string, Entry> m_entries;
+  std::string m_cache_file;
+  std::mutex m_mutex;
+
+  TeamSizeTuner() {
+    const char* file = std::getenv("KOKKOS_TUNING_CACHE_FILE");
+    if (file != nullptr) {
+      m_cache_file = file;
+      std::ifstream in(m_cache_file);
+      std::string name;
+      int team_size;
+      while (in >> name >> team_size) {
+        Entry entry;
+        entry.best      = team_size;
+        entry.converged = true;
+        m_entries[name] = entry;
+      }
+    }
+  }
+
+  void save_cache() {
+    if (m_cache_file.empty()) return;
+    std::ofstream out(m_cache_file);
+    for (std::map<std::string, Entry>::const_iterator it = m_entries.begin();
+         it != m_entries.end(); ++it) {
+      if (it->second.converged)
+        out << it->first << ' ' << it->second.best << '\n';
+    }
+  }
+
+ public:
+  static TeamSizeTuner& singleton() {
+    static TeamSizeTuner tuner;
+    return tuner;
+  }
+
+  /// \brief Team size to use for this invocation of the named kernel.
+  ///
+  /// Cycles through the candidates until each has been timed
+  /// trials_per_candidate times, then always returns the fastest one.
+  int tune(const std::string& name, const std::vector<int>& candidates) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Entry& entry = m_entries[name];
+    if (entry.converged) return entry.best;
+    if (entry.candidates.empty()) {
+      entry.candidates = candidates;
+      entry.best_times.assign(candidates.size(),
+                              std::numeric_limits<double>::max());
+    }
+    const int index =
+        (entry.invocations / trials_per_candidate) % int(candidates.size());
+    return entry.candidates[index];
+  }
+
+  /// \brief Record a measured execution time for one invocation.
+  void record(const std::string& name, const int team_size,
+              const double seconds) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Entry& entry = m_entries[name];
+    if (entry.converged || entry.candidates.empty()) return;
+    for (size_t i = 0; i < entry.candidates.size(); ++i) {
+      if (entry.candidates[i] == team_size && seconds < entry.best_times[i])
+        entry.best_times[i] = seconds;
+    }
+    ++entry.invocations;
+    if (entry.invocations >=
+        trials_per_candidate * int(entry.candidates.size())) {
+      size_t best = 0;
+      for (size_t i = 1; i < entry.best_times.size(); ++i)
+        if (entry.best_times[i] < entry.best_times[best]) best = i;
+      entry.best      = entry.candidates[best];
+      entry.converged = true;
+      save_cache();
+    }
+  }
+
+  /// \brief Powers of two from 32 (or 1 on serial backends) up to max.
+  static std::vector<int> default_candidates(const int max_team_size) {
+    std::vector<int> candidates;
+    for (int size = max_team_size >= 32 ? 32 : 1; size <= max_team_size;
+         size *= 2)
+      candidates.push_back(size);
+    if (candidates.empty()) candidates.push_back(1);
+    return candidates;
+  }
+
+  /// \brief Scoped measurement: picks the team size in the constructor and
+  ///        fences and records the elapsed time in the destructor.
+  class Measurement {
+    std::string m_name;
+    int m_team_size;
+    Kokkos::Timer m_timer;
+
+   public:
+    Measurement(const std::string& name, const std::vector<int>& candidates)
+        : m_name(name),
+          m_team_size(singleton().tune(name, candidates)),
+          m_timer() {}
+
+    Measurement(const std::string& name, const int max_team_size)
+        : Measurement(name, default_candidates(max_team_size)) {}
+
+    Measurement(const Measurement&) = delete;
+    Measurement& operator=(const Measurement&) = delete;
+
+    int team_size() const { return m_team_size; }
+
+    ~Measurement() {
+      Kokkos::fence();
+      singleton().record(m_name, m_team_size, m_timer.seconds());
+    }
+  };
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_TEAMSIZETUNER_HPP */
@@ -203,6 +203,41 @@ class Threads {
   static const char* name();
   //@}
   //----------------------------------------
+  //! \name Pool partitioning
+  //@{
+
+  /** \brief  Split the worker threads into 'count' disjoint sub-pools of
+   *          the given sizes (which must sum to the number of spawned
+   *          workers).
+   *
+   *  Each sub-pool keeps its own fan-in tree, so kernels dispatched on
+   *  different partition_instance() handles run concurrently without
+   *  synchronizing with each other; a latency-critical instance never
+   *  queues behind a batch instance.  The worker threads keep the
+   *  affinity they were bound to at initialize, so contiguous sub-pools
+   *  occupy disjoint sets of cores.  TeamPolicy dispatch and whole-pool
+   *  launches are rejected while the pool is partitioned.
+   */
+  static void partition_pool(const int* sizes, const int count);
+
+  /** \brief  Quiesce all sub-pools and restore the whole pool. */
+  static void unpartition_pool();
+
+  /** \brief  Execution space instance dispatching to one sub-pool.
+   *
+   *  May be used concurrently from distinct application threads, one
+   *  launching thread per sub-pool.
+   */
+  static Threads partition_instance(const int partition);
+
+  /** \brief  Sub-pool this instance dispatches to, -1 for the whole pool. */
+  inline int impl_pool_partition() const { return m_pool_partition; }
+
+  //@}
+  //----------------------------------------
+
+ private:
+  int m_pool_partition = -1;
 };
 
 }  // namespace Kokkos
@@ -0,0 +1,151 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_TileRange.hpp
+/// \brief A fourth nesting level below vector lanes: compile-time
+///        register tiles.
+///
+/// The hierarchical policies stop at ThreadVectorRange; blocking over
+/// register tiles below the vector level has to be hand-unrolled in
+/// the lambda body.  TileRange<N0,...> is a nested range whose extents
+/// are template parameters, so its parallel_for expands to a fully
+/// unrolled sequence at compile time - every index is a constant, the
+/// tile's working set stays in registers, and no loop-carried counter
+/// survives into the generated code.  It executes sequentially on the
+/// calling lane, exactly like ThreadVectorRange does on backends
+/// without vector hardware, so it composes under any of the existing
+/// levels on every backend:
+///
+///   parallel_for(TeamThreadRange(team, m), [&](const int i) {
+///     parallel_for(ThreadVectorRange(team, n), [&](const int j) {
+///       parallel_for(TileRange<4, 4>(), [&](const int a, const int b) {
+///         acc[a][b] += lhs(i, a) * rhs(j, b);
+///       });
+///     });
+///   });
+///
+/// Up to the compiler's template depth any number of extents is
+/// accepted; the closure receives one int per extent.  Unrolling is by
+/// template recursion rather than pragmas, so it is guaranteed on
+/// every compiler.  Keep tiles small - N0*N1*... closure bodies are
+/// emitted inline.
+
+#ifndef KOKKOS_TILERANGE_HPP
+#define KOKKOS_TILERANGE_HPP
+
+#include <Kokkos_Macros.hpp>
+
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  Nested range over a compile-time extent tile, executed
+ *          fully unrolled on the calling thread or vector lane.
+ */
+template <int... Extents>
+struct TileRange {};
+
+}  // namespace Experimental
+
+namespace Impl {
+
+template <class TileType>
+struct TileRangeExpand;
+
+// All extents consumed: invoke the closure with the collected indices.
+template <>
+struct TileRangeExpand<Kokkos::Experimental::TileRange<>> {
+  template <class Closure, class... Indices>
+  KOKKOS_FORCEINLINE_FUNCTION static void apply(const Closure& closure,
+                                                const Indices... indices) {
+    closure(indices...);
+  }
+};
+
+// Emit index I of the current extent, then step to I+1; the remaining
+// extents are expanded recursively below each emitted index.
+template <int I, int N, class RestTile>
+struct TileRangeStep {
+  template <class Closure, class... Indices>
+  KOKKOS_FORCEINLINE_FUNCTION static void apply(const Closure& closure,
+                                                const Indices... indices) {
+    TileRangeExpand<RestTile>::apply(closure, indices..., I);
+    TileRangeStep<I + 1, N, RestTile>::apply(closure, indices...);
+  }
+};
+
+template <int N, class RestTile>
+struct TileRangeStep<N, N, RestTile> {
+  template <class Closure, class... Indices>
+  KOKKOS_FORCEINLINE_FUNCTION static void apply(const Closure&,
+                                                const Indices...) {}
+};
+
+template <int N0, int... Rest>
+struct TileRangeExpand<Kokkos::Experimental::TileRange<N0, Rest...>> {
+  static_assert(0 < N0, "Kokkos::TileRange extents must be positive");
+
+  template <class Closure, class... Indices>
+  KOKKOS_FORCEINLINE_FUNCTION static void apply(const Closure& closure,
+                                                const Indices... indices) {
+    TileRangeStep<0, N0, Kokkos::Experimental::TileRange<Rest...>>::apply(
+        closure, indices...);
+  }
+};
+
+}  // namespace Impl
+
+/** \brief  Execute closure once per tile index, fully unrolled; the
+ *          closure receives one int argument per TileRange extent.
+ */
+template <int... Extents, class Closure>
+KOKKOS_FORCEINLINE_FUNCTION void parallel_for(
+    const Kokkos::Experimental::TileRange<Extents...>&,
+    const Closure& closure) {
+  Impl::TileRangeExpand<Kokkos::Experimental::TileRange<Extents...>>::apply(
+      closure);
+}
+
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_TILERANGE_HPP */
@@ -0,0 +1,272 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+/// \file Kokkos_Transpose.hpp
+/// \brief Tiled layout-remap engine for rank-2 Views.
+///
+/// deep_copy between a LayoutLeft and a LayoutRight View falls back to
+/// the element-wise remap, which strides badly on one side no matter
+/// the iteration order.  transpose_copy performs the same remap through
+/// square scratch tiles -- team scratch, i.e. shared memory on device
+/// backends and cache-resident blocks on host -- so each memory stream
+/// is contiguous.  transpose_inplace transposes a square View in place,
+/// after which transposed_layout_view aliases the data with the
+/// opposite layout at zero cost.
+
+#ifndef KOKKOS_TRANSPOSE_HPP
+#define KOKKOS_TRANSPOSE_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_View.hpp>
+#include <Kokkos_Parallel.hpp>
+#include <Kokkos_ExecPolicy.hpp>
+
+namespace Kokkos {
+namespace Impl {
+
+template <class DstView, class SrcView>
+struct TransposeCopy {
+  enum : int { tile = 32 };
+
+  using execution_space = typename DstView::execution_space;
+  using policy_type     = Kokkos::TeamPolicy<execution_space>;
+  using member_type     = typename policy_type::member_type;
+  using value_type      = typename DstView::non_const_value_type;
+
+  // Which view has the second index fastest decides the tile traversal
+  enum : bool {
+    dst_fast_second =
+        std::is_same<typename DstView::array_layout, LayoutRight>::value
+  };
+
+  DstView m_dst;
+  SrcView m_src;
+  int m_tiles0;
+
+  TransposeCopy(const DstView& arg_dst, const SrcView& arg_src)
+      : m_dst(arg_dst),
+        m_src(arg_src),
+        m_tiles0(int((arg_dst.extent(0) + tile - 1) / tile)) {
+    const int tiles1  = int((arg_dst.extent(1) + tile - 1) / tile);
+    const int nteams  = m_tiles0 * tiles1;
+    const closure_type closure(*this, policy_type(nteams, Kokkos::AUTO));
+    closure.execute();
+    execution_space().fence();
+  }
+
+  using closure_type = Kokkos::Impl::ParallelFor<TransposeCopy, policy_type>;
+
+  unsigned team_shmem_size(int) const {
+    return tile * (tile + 1) * sizeof(value_type);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const member_type& team) const {
+    value_type* const scratch = reinterpret_cast<value_type*>(
+        team.team_shmem().get_shmem(tile * (tile + 1) * sizeof(value_type)));
+
+    const int i0 = (team.league_rank() % m_tiles0) * tile;
+    const int j0 = (team.league_rank() / m_tiles0) * tile;
+    const int ni = i0 + tile <= int(m_dst.extent(0))
+                       ? tile
+                       : int(m_dst.extent(0)) - i0;
+    const int nj = j0 + tile <= int(m_dst.extent(1))
+                       ? tile
+                       : int(m_dst.extent(1)) - j0;
+
+    if (dst_fast_second) {
+      // src is fast in i: stream src along i, then dst along j
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team, nj), [&](const int j) {
+        Kokkos::parallel_for(Kokkos::ThreadVectorRange(team, ni),
+                             [&](const int i) {
+                               scratch[i * (tile + 1) + j] =
+                                   m_src(i0 + i, j0 + j);
+                             });
+      });
+      team.team_barrier();
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team, ni), [&](const int i) {
+        Kokkos::parallel_for(Kokkos::ThreadVectorRange(team, nj),
+                             [&](const int j) {
+                               m_dst(i0 + i, j0 + j) =
+                                   scratch[i * (tile + 1) + j];
+                             });
+      });
+    } else {
+      // src is fast in j: stream src along j, then dst along i
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team, ni), [&](const int i) {
+        Kokkos::parallel_for(Kokkos::ThreadVectorRange(team, nj),
+                             [&](const int j) {
+                               scratch[j * (tile + 1) + i] =
+                                   m_src(i0 + i, j0 + j);
+                             });
+      });
+      team.team_barrier();
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team, nj), [&](const int j) {
+        Kokkos::parallel_for(Kokkos::ThreadVectorRange(team, ni),
+                             [&](const int i) {
+                               m_dst(i0 + i, j0 + j) =
+                                   scratch[j * (tile + 1) + i];
+                             });
+      });
+    }
+  }
+};
+
+template <class ViewType>
+struct TransposeInPlace {
+  enum : int { tile = 32 };
+
+  using execution_space = typename ViewType::execution_space;
+  using policy_type     = Kokkos::TeamPolicy<execution_space>;
+  using member_type     = typename policy_type::member_type;
+
+  ViewType m_view;
+
+  explicit TransposeInPlace(const ViewType& arg_view) : m_view(arg_view) {
+    const int tiles  = int((arg_view.extent(0) + tile - 1) / tile);
+    const int nteams = tiles * (tiles + 1) / 2;
+    const closure_type closure(*this, policy_type(nteams, Kokkos::AUTO));
+    closure.execute();
+    execution_space().fence();
+  }
+
+  using closure_type = Kokkos::Impl::ParallelFor<TransposeInPlace, policy_type>;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const member_type& team) const {
+    // Decode the triangular tile-pair index; the loop is over tile
+    // counts, not matrix entries
+    int ti = 0;
+    while ((ti + 1) * (ti + 2) / 2 <= team.league_rank()) ++ti;
+    const int tj = team.league_rank() - ti * (ti + 1) / 2;
+
+    const int n  = int(m_view.extent(0));
+    const int i0 = ti * tile;
+    const int j0 = tj * tile;
+    const int ni = i0 + tile <= n ? tile : n - i0;
+    const int nj = j0 + tile <= n ? tile : n - j0;
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, ni), [&](const int i) {
+      // On the diagonal tile swap only below the matrix diagonal
+      const int jend = ti == tj ? (i0 + i - j0 < nj ? i0 + i - j0 : nj) : nj;
+      Kokkos::parallel_for(
+          Kokkos::ThreadVectorRange(team, jend), [&](const int j) {
+            const auto tmp           = m_view(i0 + i, j0 + j);
+            m_view(i0 + i, j0 + j)   = m_view(j0 + j, i0 + i);
+            m_view(j0 + j, i0 + i)   = tmp;
+          });
+    });
+  }
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+namespace Kokkos {
+namespace Experimental {
+
+/// \brief Remap src into dst across opposite layouts through scratch tiles.
+///
+/// dst(i,j) = src(i,j) for rank-2 Views where one is LayoutLeft and the
+/// other LayoutRight; the result is what deep_copy produces, at tiled
+/// bandwidth instead of one strided stream.
+template <class DstView, class SrcView>
+void transpose_copy(const DstView& dst, const SrcView& src) {
+  static_assert(unsigned(DstView::Rank) == 2 && unsigned(SrcView::Rank) == 2,
+                "transpose_copy requires rank-2 Views");
+  static_assert(
+      (std::is_same<typename DstView::array_layout, LayoutLeft>::value &&
+       std::is_same<typename SrcView::array_layout, LayoutRight>::value) ||
+          (std::is_same<typename DstView::array_layout, LayoutRight>::value &&
+           std::is_same<typename SrcView::array_layout, LayoutLeft>::value),
+      "transpose_copy requires one LayoutLeft and one LayoutRight View");
+  if (dst.extent(0) != src.extent(0) || dst.extent(1) != src.extent(1)) {
+    Kokkos::abort("transpose_copy requires matching extents");
+  }
+  if (0 == dst.size()) return;
+  const Kokkos::Impl::TransposeCopy<DstView, SrcView> engine(dst, src);
+  (void)engine;
+}
+
+/// \brief Transpose a square rank-2 View in place: a(i,j) <-> a(j,i).
+template <class ViewType>
+void transpose_inplace(const ViewType& a) {
+  static_assert(unsigned(ViewType::Rank) == 2,
+                "transpose_inplace requires a rank-2 View");
+  if (a.extent(0) != a.extent(1)) {
+    Kokkos::abort("transpose_inplace requires square extents");
+  }
+  if (0 == a.size()) return;
+  const Kokkos::Impl::TransposeInPlace<ViewType> engine(a);
+  (void)engine;
+}
+
+/// \brief Unmanaged alias of a rank-2 View with the opposite layout.
+///
+/// After transpose_inplace(a), transposed_layout_view(a)(i,j) holds the
+/// value a(i,j) held before the transpose: together they switch a square
+/// View's layout without allocating.
+template <class ViewType>
+auto transposed_layout_view(const ViewType& a) -> Kokkos::View<
+    typename ViewType::non_const_data_type,
+    typename std::conditional<
+        std::is_same<typename ViewType::array_layout, LayoutLeft>::value,
+        LayoutRight, LayoutLeft>::type,
+    typename ViewType::device_type, Kokkos::MemoryTraits<Kokkos::Unmanaged>> {
+  static_assert(unsigned(ViewType::Rank) == 2,
+                "transposed_layout_view requires a rank-2 View");
+  using result_type = Kokkos::View<
+      typename ViewType::non_const_data_type,
+      typename std::conditional<
+          std::is_same<typename ViewType::array_layout, LayoutLeft>::value,
+          LayoutRight, LayoutLeft>::type,
+      typename ViewType::device_type, Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+  return result_type(a.data(), a.extent(1), a.extent(0));
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_TRANSPOSE_HPP */
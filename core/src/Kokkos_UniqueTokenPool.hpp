@@ -0,0 +1,146 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+#ifndef KOKKOS_UNIQUE_TOKEN_POOL_HPP
+#define KOKKOS_UNIQUE_TOKEN_POOL_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_UniqueToken.hpp>
+#include <Kokkos_View.hpp>
+#include <impl/Kokkos_ConcurrentBitset.hpp>
+
+namespace Kokkos {
+namespace Experimental {
+
+/// \brief pool of unique ids whose size is chosen at construction rather
+/// than fixed at the concurrency of the execution space
+///
+/// When per-token scratch buffers are sized by UniqueToken::size() they
+/// must accommodate the full concurrency of the device even if far fewer
+/// workers ever hold a token simultaneously.  A UniqueTokenPool holds a
+/// user-chosen number of tokens, acquired and released from within
+/// parallel regions through a shared concurrent bitset.  Copies are
+/// shallow and share the pool; the backing allocation is reference
+/// counted like a View.
+///
+/// acquire() spins while all tokens are in use, so the pool size must be
+/// at least the number of workers that can hold a token simultaneously.
+template <typename ExecutionSpace = Kokkos::DefaultExecutionSpace>
+class UniqueTokenPool {
+ public:
+  using execution_space = ExecutionSpace;
+  using size_type       = typename execution_space::size_type;
+
+ private:
+  using buffer_type =
+      Kokkos::View<uint32_t*, typename execution_space::memory_space>;
+
+  buffer_type m_buffer;
+  uint32_t m_size;
+
+ public:
+  UniqueTokenPool() : m_buffer(), m_size(0) {}
+
+  UniqueTokenPool(UniqueTokenPool&&)      = default;
+  UniqueTokenPool(const UniqueTokenPool&) = default;
+  UniqueTokenPool& operator=(UniqueTokenPool&&) = default;
+  UniqueTokenPool& operator=(const UniqueTokenPool&) = default;
+
+  /// \brief create a pool of arg_size tokens
+  ///
+  /// The buffer is zero-initialized, i.e. all tokens begin available
+  explicit UniqueTokenPool(size_type arg_size,
+                           execution_space const& = execution_space())
+      : m_buffer("UniqueTokenPool",
+                 Kokkos::Impl::concurrent_bitset::buffer_bound(
+                     uint32_t(arg_size))),
+        m_size(uint32_t(arg_size)) {}
+
+  /// \brief upper bound for acquired values, i.e. 0 <= value < size()
+  KOKKOS_INLINE_FUNCTION
+  size_type size() const noexcept { return size_type(m_size); }
+
+  /// \brief acquire value such that 0 <= value < size()
+  ///
+  /// Spins until a token is available, so do not hold a token across
+  /// synchronization with other workers that may also be acquiring
+  KOKKOS_INLINE_FUNCTION
+  size_type acquire() const {
+    int bit = -1;
+    while (bit < 0) {
+      bit = Kokkos::Impl::concurrent_bitset::acquire_bounded(
+                m_buffer.data(), m_size,
+                uint32_t(Kokkos::Impl::clock_tic() % m_size))
+                .first;
+    }
+    return size_type(bit);
+  }
+
+  /// \brief release a value acquired by acquire()
+  KOKKOS_INLINE_FUNCTION
+  void release(size_type i) const noexcept {
+    Kokkos::Impl::concurrent_bitset::release(m_buffer.data(), uint32_t(i));
+  }
+};
+
+/// \brief number of elements of type T to allot per token so that no two
+/// tokens' slots share a cache line
+///
+/// For per-token accumulation buffers indexed as
+/// buffer( token * stride + j ), j < per_token, a stride padded out to
+/// the cache line keeps numerically adjacent tokens from falsely sharing
+/// a line.  The returned stride spans a multiple of 64 bytes and is at
+/// least per_token.
+template <typename T>
+KOKKOS_INLINE_FUNCTION constexpr size_t unique_token_padded_stride(
+    size_t per_token = 1) noexcept {
+  return (((per_token * sizeof(T) + 63) / 64) * 64 + sizeof(T) - 1) /
+         sizeof(T);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_UNIQUE_TOKEN_POOL_HPP
@@ -59,6 +59,10 @@
 #include <impl/Kokkos_Profiling_Interface.hpp>
 #endif
 
+#if defined(KOKKOS_ENABLE_VIEW_ACCESS_PROFILING)
+#include <impl/Kokkos_ViewAccessAdvisor.hpp>
+#endif
+
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
 
@@ -473,6 +477,8 @@ constexpr Kokkos::Impl::WithoutInitializing_t WithoutInitializing =
 constexpr Kokkos::Impl::AllowPadding_t AllowPadding =
     Kokkos::Impl::AllowPadding_t();
 
+constexpr Kokkos::Impl::HugePages_t HugePages = Kokkos::Impl::HugePages_t();
+
 }  // namespace
 
 /** \brief  Create View allocation parameter bundle from argument list.
@@ -480,10 +486,14 @@ constexpr Kokkos::Impl::AllowPadding_t AllowPadding =
  *  Valid argument list members are:
  *    1) label as a "string" or std::string
  *    2) memory space instance of the View::memory_space type
- *    3) execution space instance compatible with the View::memory_space
+ *    3) execution space instance compatible with the View::memory_space;
+ *       when the memory space has a stream-ordered allocation mechanism
+ *       the allocation and deallocation are enqueued on that instance
  *    4) Kokkos::WithoutInitializing to bypass initialization
  *    4) Kokkos::AllowPadding to allow allocation to pad dimensions for memory
  * alignment
+ *    5) Kokkos::HugePages to back the allocation with explicit huge pages
+ * when the memory space has such a mechanism
  */
 template <class... Args>
 inline Impl::ViewCtorProp<typename Impl::ViewCtorProp<void, Args>::type...>
@@ -569,17 +579,22 @@ class View : public ViewTraits<DataType, Properties...> {
                typename traits::memory_traits>
       non_const_type;
 
-  /** \brief  Compatible HostMirror view */
+  /** \brief  Compatible HostMirror view; access-pattern memory traits
+   *          (RandomAccess, Restrict) propagate onto the mirror */
   typedef View<typename traits::non_const_data_type,
                typename traits::array_layout,
                Device<DefaultHostExecutionSpace,
-                      typename traits::host_mirror_space::memory_space>>
+                      typename traits::host_mirror_space::memory_space>,
+               typename Impl::HostMirrorMemoryTraits<
+                   typename traits::memory_traits>::type>
       HostMirror;
 
   /** \brief  Compatible HostMirror view */
   typedef View<typename traits::non_const_data_type,
                typename traits::array_layout,
-               typename traits::host_mirror_space>
+               typename traits::host_mirror_space,
+               typename Impl::HostMirrorMemoryTraits<
+                   typename traits::memory_traits>::type>
       host_mirror_type;
 
   /** \brief Unified types */
@@ -821,18 +836,43 @@ class View : public ViewTraits<DataType, Properties...> {
     };
   };
 
+#if defined(KOKKOS_ENABLE_VIEW_ACCESS_PROFILING)
+
+#define KOKKOS_IMPL_VIEW_ACCESS_SAMPLE(ARG)                          \
+  Kokkos::Impl::view_access_sample<typename traits::array_layout,    \
+                                   typename traits::memory_space,    \
+                                   (bool)traits::memory_traits::     \
+                                       is_random_access> ARG;
+
+#else
+
+#define KOKKOS_IMPL_VIEW_ACCESS_SAMPLE(ARG)
+
+#endif
+
 #if defined(KOKKOS_ENABLE_DEBUG_BOUNDS_CHECK)
 
+#define KOKKOS_IMPL_VIEW_OPERATOR_VERIFY(ARG)                                  \
+  View::template verify_space<                                                 \
+      Kokkos::Impl::ActiveExecutionMemorySpace>::check();                      \
+  Kokkos::Impl::view_verify_operator_bounds<typename traits::memory_space>    \
+      ARG;                                                                     \
+  KOKKOS_IMPL_VIEW_ACCESS_SAMPLE(ARG)
+
+#elif defined(KOKKOS_ENABLE_DEBUG_BOUNDS_TRAP)
+
 #define KOKKOS_IMPL_VIEW_OPERATOR_VERIFY(ARG)             \
   View::template verify_space<                            \
       Kokkos::Impl::ActiveExecutionMemorySpace>::check(); \
-  Kokkos::Impl::view_verify_operator_bounds<typename traits::memory_space> ARG;
+  Kokkos::Impl::view_verify_operator_span ARG;            \
+  KOKKOS_IMPL_VIEW_ACCESS_SAMPLE(ARG)
 
 #else
 
-#define KOKKOS_IMPL_VIEW_OPERATOR_VERIFY(ARG) \
-  View::template verify_space<                \
-      Kokkos::Impl::ActiveExecutionMemorySpace>::check();
+#define KOKKOS_IMPL_VIEW_OPERATOR_VERIFY(ARG)             \
+  View::template verify_space<                            \
+      Kokkos::Impl::ActiveExecutionMemorySpace>::check(); \
+  KOKKOS_IMPL_VIEW_ACCESS_SAMPLE(ARG)
 
 #endif
 
@@ -1873,6 +1913,19 @@ class View : public ViewTraits<DataType, Properties...> {
     // Copy the input allocation properties with possibly defaulted properties
     alloc_prop prop_copy(arg_prop);
 
+    // If an execution space instance was given, substitute a memory
+    // space instance that enqueues the allocation (and the eventual
+    // deallocation) on that instance, when the space has a
+    // stream-ordered allocation mechanism.
+    if (alloc_prop_input::has_execution_space) {
+      typedef typename traits::device_type::memory_space mem_space;
+      typedef typename alloc_prop::execution_space exec_space;
+      ((Impl::ViewCtorProp<void, mem_space>&)prop_copy).value =
+          Kokkos::Impl::with_stream_ordered(
+              ((Impl::ViewCtorProp<void, mem_space> const&)prop_copy).value,
+              ((Impl::ViewCtorProp<void, exec_space> const&)prop_copy).value);
+    }
+
 //------------------------------------------------------------
 #if defined(KOKKOS_ENABLE_CUDA)
     // If allocating in CudaUVMSpace must fence before and after
@@ -2249,6 +2302,85 @@ subview(const View<D, P...>& src, Args... args) {
 
 } /* namespace Kokkos */
 
+namespace Kokkos {
+namespace Impl {
+
+// Memory traits of a view with Unmanaged added to its existing traits
+template <class Traits>
+struct UnmanagedMemoryTraits {
+ private:
+  typedef typename Traits::memory_traits mt;
+
+ public:
+  typedef Kokkos::MemoryTraits<
+      Kokkos::Unmanaged | (mt::is_random_access ? Kokkos::RandomAccess : 0u) |
+      (mt::is_atomic ? Kokkos::Atomic : 0u) |
+      (mt::is_restrict ? Kokkos::Restrict : 0u) |
+      (mt::is_aligned ? Kokkos::Aligned : 0u)>
+      type;
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+namespace Kokkos {
+namespace Experimental {
+
+/** \brief  Unmanaged alias of a View.
+ *
+ *  The alias shares the source's data and layout but carries the
+ *  Unmanaged memory trait, so constructing it, copying it, and taking
+ *  subviews of it perform no reference-count atomics.  Hoist the alias
+ *  out of a hot loop that slices a View every iteration and slice the
+ *  alias instead.  The caller guarantees the source allocation outlives
+ *  every use of the alias and its subviews.
+ */
+template <class D, class... P>
+KOKKOS_INLINE_FUNCTION Kokkos::View<
+    typename Kokkos::ViewTraits<D, P...>::data_type,
+    typename Kokkos::ViewTraits<D, P...>::array_layout,
+    typename Kokkos::ViewTraits<D, P...>::device_type,
+    typename Kokkos::Impl::UnmanagedMemoryTraits<
+        Kokkos::ViewTraits<D, P...>>::type>
+unmanaged_view(const View<D, P...>& src) {
+  return Kokkos::View<
+      typename Kokkos::ViewTraits<D, P...>::data_type,
+      typename Kokkos::ViewTraits<D, P...>::array_layout,
+      typename Kokkos::ViewTraits<D, P...>::device_type,
+      typename Kokkos::Impl::UnmanagedMemoryTraits<
+          Kokkos::ViewTraits<D, P...>>::type>(src);
+}
+
+/** \brief  Subview without reference-count traffic.
+ *
+ *  Identical slicing semantics to Kokkos::subview, but the result
+ *  carries the Unmanaged memory trait so neither its construction nor
+ *  its destruction touches the SharedAllocationTracker atomics.  The
+ *  caller guarantees the parent allocation outlives the subview.
+ */
+template <class D, class... P, class... Args>
+KOKKOS_INLINE_FUNCTION typename Kokkos::Impl::ViewMapping<
+    void /* deduce subview type from source view traits */
+    ,
+    ViewTraits<D, P...>, Args...>::
+    template apply<typename Kokkos::Impl::UnmanagedMemoryTraits<
+        Kokkos::ViewTraits<D, P...>>::type>::type
+    unmanaged_subview(const View<D, P...>& src, Args... args) {
+  static_assert(View<D, P...>::Rank == sizeof...(Args),
+                "unmanaged_subview requires one argument for each source View "
+                "rank");
+
+  return typename Kokkos::Impl::ViewMapping<
+      void /* deduce subview type from source view traits */
+      ,
+      ViewTraits<D, P...>, Args...>::
+      template apply<typename Kokkos::Impl::UnmanagedMemoryTraits<
+          Kokkos::ViewTraits<D, P...>>::type>::type(src, args...);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
 
@@ -0,0 +1,307 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+/// \file Kokkos_ViewSerialization.hpp
+/// \brief Binary View container format with zero-copy restore.
+///
+/// save_view writes a View as a fixed header (rank, layout, extents,
+/// value-type fingerprint) followed by the packed payload at a 4096-byte
+/// offset, so the file can be written and read with O_DIRECT.  MappedView
+/// restores by mmap-ing the file and constructing an unmanaged HostSpace
+/// View directly over the mapped payload pages: restore touches no bytes
+/// until the caller does.
+///
+/// The value-type fingerprint is derived from the implementation's mangled
+/// type name; files are exchangeable between builds of the same toolchain
+/// and ABI, which is the checkpoint/restart use case, not a portable
+/// interchange format.
+
+#ifndef KOKKOS_VIEWSERIALIZATION_HPP
+#define KOKKOS_VIEWSERIALIZATION_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_View.hpp>
+#include <Kokkos_CopyViews.hpp>
+#include <impl/Kokkos_Error.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <typeinfo>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Kokkos {
+namespace Impl {
+
+struct ViewSerializationHeader {
+  // Payload begins at this offset so both header and payload I/O are
+  // aligned for O_DIRECT
+  enum : uint64_t { payload_offset = 4096 };
+  enum : uint32_t { current_version = 1 };
+
+  char magic[8];  // "KokkosV"
+  uint32_t version;
+  uint32_t rank;
+  uint32_t layout;  // 0 = LayoutLeft, 1 = LayoutRight
+  uint32_t value_size;
+  uint64_t value_hash;
+  uint64_t extents[8];
+  uint64_t payload_bytes;
+};
+
+inline uint64_t view_serialization_type_hash(const char* name) {
+  uint64_t h = 1099511628211ull;
+  for (; *name; ++name) {
+    h = (h ^ uint64_t(uint8_t(*name))) * 1099511628211ull;
+  }
+  return h;
+}
+
+template <class Layout>
+struct view_serialization_layout;
+
+template <>
+struct view_serialization_layout<Kokkos::LayoutLeft> {
+  enum : uint32_t { value = 0 };
+};
+
+template <>
+struct view_serialization_layout<Kokkos::LayoutRight> {
+  enum : uint32_t { value = 1 };
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+namespace Kokkos {
+namespace Experimental {
+
+/// \brief Write a View to a file in the Kokkos binary container format.
+///
+/// The payload is a packed (unpadded) copy in the View's own layout, so
+/// Views of any memory space, including padded device allocations, can
+/// be saved; the data is staged through a packed HostSpace copy.
+template <class ViewType>
+void save_view(const ViewType& v, const std::string& path) {
+  static_assert(
+      Kokkos::Impl::view_serialization_layout<typename ViewType::array_layout>::value +
+              1 !=
+          0,
+      "save_view requires LayoutLeft or LayoutRight");
+
+  using value_type = typename ViewType::non_const_value_type;
+  using staging_type =
+      Kokkos::View<typename ViewType::non_const_data_type,
+                   typename ViewType::array_layout, Kokkos::HostSpace>;
+
+  // A fresh allocation is never padded, so the staging copy is packed
+  staging_type packed(
+      Kokkos::view_alloc(std::string("Kokkos::save_view::staging"),
+                         WithoutInitializing),
+      v.layout());
+  Kokkos::deep_copy(packed, v);
+  Kokkos::fence();
+
+  Kokkos::Impl::ViewSerializationHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::strncpy(header.magic, "KokkosV", sizeof(header.magic));
+  header.version = Kokkos::Impl::ViewSerializationHeader::current_version;
+  header.rank    = uint32_t(ViewType::Rank);
+  header.layout  = Kokkos::Impl::view_serialization_layout<
+      typename ViewType::array_layout>::value;
+  header.value_size = uint32_t(sizeof(value_type));
+  header.value_hash =
+      Kokkos::Impl::view_serialization_type_hash(typeid(value_type).name());
+  for (unsigned r = 0; r < ViewType::Rank; ++r) header.extents[r] = v.extent(r);
+  header.payload_bytes = uint64_t(packed.span()) * sizeof(value_type);
+
+  std::FILE* f = std::fopen(path.c_str(), "wb");
+  if (nullptr == f) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::save_view failed to open " + path);
+  }
+
+  char block[Kokkos::Impl::ViewSerializationHeader::payload_offset];
+  std::memset(block, 0, sizeof(block));
+  std::memcpy(block, &header, sizeof(header));
+
+  bool ok = 1 == std::fwrite(block, sizeof(block), 1, f);
+  if (ok && 0 != header.payload_bytes) {
+    ok = 1 == std::fwrite(packed.data(), size_t(header.payload_bytes), 1, f);
+  }
+  ok = (0 == std::fclose(f)) && ok;
+  if (!ok) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::save_view failed to write " + path);
+  }
+}
+
+#if !defined(_WIN32)
+
+/// \brief A View file mapped into memory, viewable without deserialization.
+///
+/// Holds the mapping for its lifetime; view() returns an unmanaged
+/// const HostSpace View over the mapped payload pages.  The pages are
+/// faulted in on access, so restore cost is independent of file size.
+template <class ViewType>
+class MappedView {
+ public:
+  using mapped_view_type =
+      Kokkos::View<typename ViewType::const_data_type,
+                   typename ViewType::array_layout, Kokkos::HostSpace,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+  using value_type = typename ViewType::non_const_value_type;
+
+  explicit MappedView(const std::string& path)
+      : m_base(nullptr), m_length(0) {
+    int const fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::MappedView failed to open " + path);
+    }
+
+    struct stat info;
+    if (0 != ::fstat(fd, &info) ||
+        size_t(info.st_size) <
+            size_t(Kokkos::Impl::ViewSerializationHeader::payload_offset)) {
+      ::close(fd);
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::MappedView: truncated file " + path);
+    }
+
+    m_length = size_t(info.st_size);
+    void* const base =
+        ::mmap(nullptr, m_length, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);  // the mapping keeps the file referenced
+    if (MAP_FAILED == base) {
+      m_length = 0;
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::MappedView failed to mmap " + path);
+    }
+    m_base = base;
+
+    Kokkos::Impl::ViewSerializationHeader header;
+    std::memcpy(&header, m_base, sizeof(header));
+
+    const bool valid =
+        (0 == std::strncmp(header.magic, "KokkosV", sizeof(header.magic))) &&
+        (Kokkos::Impl::ViewSerializationHeader::current_version == header.version) &&
+        (uint32_t(ViewType::Rank) == header.rank) &&
+        (Kokkos::Impl::view_serialization_layout<
+             typename ViewType::array_layout>::value == header.layout) &&
+        (uint32_t(sizeof(value_type)) == header.value_size) &&
+        (Kokkos::Impl::view_serialization_type_hash(typeid(value_type).name()) ==
+         header.value_hash) &&
+        (Kokkos::Impl::ViewSerializationHeader::payload_offset +
+             header.payload_bytes <=
+         uint64_t(m_length));
+    if (!valid) {
+      unmap();
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::MappedView: " + path +
+          " does not hold a view of the requested type");
+    }
+
+    typename ViewType::array_layout layout(
+        header.extents[0], header.extents[1], header.extents[2],
+        header.extents[3], header.extents[4], header.extents[5],
+        header.extents[6], header.extents[7]);
+    m_view = mapped_view_type(
+        reinterpret_cast<const value_type*>(
+            static_cast<const char*>(m_base) +
+            Kokkos::Impl::ViewSerializationHeader::payload_offset),
+        layout);
+
+    if (uint64_t(m_view.span()) * sizeof(value_type) != header.payload_bytes) {
+      unmap();
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::MappedView: payload size mismatch in " +
+          path);
+    }
+  }
+
+  ~MappedView() { unmap(); }
+
+  MappedView(MappedView&& rhs)
+      : m_view(rhs.m_view), m_base(rhs.m_base), m_length(rhs.m_length) {
+    rhs.m_view   = mapped_view_type();
+    rhs.m_base   = nullptr;
+    rhs.m_length = 0;
+  }
+
+  MappedView(const MappedView&) = delete;
+  MappedView& operator=(const MappedView&) = delete;
+
+  /// \brief Unmanaged const View over the mapped payload.
+  ///
+  /// Valid only while this MappedView is alive.
+  mapped_view_type view() const { return m_view; }
+
+ private:
+  void unmap() {
+    if (m_base) ::munmap(m_base, m_length);
+    m_view   = mapped_view_type();
+    m_base   = nullptr;
+    m_length = 0;
+  }
+
+  mapped_view_type m_view;
+  void* m_base;
+  size_t m_length;
+};
+
+#endif /* #if !defined( _WIN32 ) */
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_VIEWSERIALIZATION_HPP */
@@ -77,26 +77,37 @@ class WorkGraphPolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
  private:
   using ints_type = Kokkos::View<std::int32_t*, memory_space>;
 
-  // Let N = m_graph.numRows(), the total work
-  // m_queue[  0 ..   N-1] = the ready queue
-  // m_queue[  N .. 2*N-1] = the waiting queue counts
-  // m_queue[2*N .. 2*N+2] = the ready queue hints
+  // Let N = m_graph.numRows(), the total work, and K the number of
+  // priority buckets (1 unless priority ordering was requested)
+  // m_queue[  0 ..     N-1] = the ready queue, sliced into K buckets
+  // m_queue[  N ..   2*N-1] = the waiting queue counts
+  // m_queue[2*N .. 2*N+2*K-1] = begin/end hints, one pair per bucket
+  //
+  // Each node belongs to exactly one bucket and is pushed exactly
+  // once, so bucket b owns the fixed ready-queue slice
+  // [ m_bucket_offsets(b) .. m_bucket_offsets(b+1) ).
 
   graph_type const m_graph;
   ints_type m_queue;
+  ints_type m_queue_init;
+  ints_type m_priority;        // node -> bucket; empty unless priority order
+  ints_type m_bucket_offsets;  // K+1 slice boundaries in the ready queue
+  std::int32_t m_nbuckets;
 
   KOKKOS_INLINE_FUNCTION
   void push_work(const std::int32_t w) const noexcept {
     const std::int32_t N = m_graph.numRows();
+    const std::int32_t b = (1 < m_nbuckets) ? m_priority(w) : 0;
 
     std::int32_t volatile* const ready_queue = &m_queue[0];
-    std::int32_t volatile* const end_hint    = &m_queue[2 * N + 1];
+    std::int32_t volatile* const end_hint    = &m_queue[2 * N + 2 * b + 1];
 
-    // Push work to end of queue
-    const std::int32_t j = atomic_fetch_add(end_hint, 1);
+    // Push work to end of the node's bucket slice
+    const std::int32_t j = m_bucket_offsets(b) + atomic_fetch_add(end_hint, 1);
 
-    if ((N <= j) || (END_TOKEN != atomic_exchange(ready_queue + j, w))) {
-      // ERROR: past the end of queue or did not replace END_TOKEN
+    if ((m_bucket_offsets(b + 1) <= j) ||
+        (END_TOKEN != atomic_exchange(ready_queue + j, w))) {
+      // ERROR: past the end of the slice or did not replace END_TOKEN
       Kokkos::abort("WorkGraphPolicy push_work error");
     }
 
@@ -123,30 +134,43 @@ class WorkGraphPolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
     const std::int32_t N = m_graph.numRows();
 
     std::int32_t volatile* const ready_queue = &m_queue[0];
-    std::int32_t volatile* const begin_hint  = &m_queue[2 * N];
 
-    // begin hint is guaranteed to be less than or equal to
-    // actual begin location in the queue.
+    // Buckets are ordered most critical first; a bucket whose slice is
+    // currently drained but not fully claimed may still receive pushes,
+    // so fall through to the next bucket instead of spinning on it.
 
-    for (std::int32_t i = *begin_hint; i < N; ++i) {
-      const std::int32_t w = ready_queue[i];
+    bool pending = false;
 
-      if (w == END_TOKEN) {
-        return END_TOKEN;
-      }
+    for (std::int32_t b = 0; b < m_nbuckets; ++b) {
+      const std::int32_t base = m_bucket_offsets(b);
+      const std::int32_t len  = m_bucket_offsets(b + 1) - base;
+
+      std::int32_t volatile* const begin_hint = &m_queue[2 * N + 2 * b];
+
+      // begin hint is guaranteed to be less than or equal to
+      // actual begin location in the slice.
+
+      for (std::int32_t i = *begin_hint; i < len; ++i) {
+        const std::int32_t w = ready_queue[base + i];
 
-      if ((w != BEGIN_TOKEN) &&
-          (w == atomic_compare_exchange(ready_queue + i, w,
-                                        (std::int32_t)BEGIN_TOKEN))) {
-        // Attempt to claim ready work index succeeded,
-        // update the hint and return work index
-        atomic_increment(begin_hint);
-        return w;
+        if (w == END_TOKEN) {
+          pending = true;
+          break;
+        }
+
+        if ((w != BEGIN_TOKEN) &&
+            (w == atomic_compare_exchange(ready_queue + base + i, w,
+                                          (std::int32_t)BEGIN_TOKEN))) {
+          // Attempt to claim ready work index succeeded,
+          // update the hint and return work index
+          atomic_increment(begin_hint);
+          return w;
+        }
+        // arrive here when ready_queue[base+i] == BEGIN_TOKEN
       }
-      // arrive here when ready_queue[i] == BEGIN_TOKEN
     }
 
-    return COMPLETED_TOKEN;
+    return pending ? std::int32_t(END_TOKEN) : std::int32_t(COMPLETED_TOKEN);
   }
 
   KOKKOS_INLINE_FUNCTION
@@ -178,7 +202,7 @@ class WorkGraphPolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
    *
    *  m_queue[0..N-1] = END_TOKEN, the ready queue
    *  m_queue[N..2*N-1] = 0, the waiting count queue
-   *  m_queue[2*N..2*N+1] = 0, begin/end hints for ready queue
+   *  m_queue[2*N..2*N+2*K-1] = 0, begin/end hints per bucket
    */
   KOKKOS_INLINE_FUNCTION
   void operator()(const TagInit, int i) const noexcept {
@@ -199,10 +223,112 @@ class WorkGraphPolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
     if (0 == count_queue[w]) push_work(w);
   }
 
-  WorkGraphPolicy(const graph_type& arg_graph)
-      : m_graph(arg_graph),
-        m_queue(view_alloc("queue", WithoutInitializing),
-                arg_graph.numRows() * 2 + 2) {
+  /**\brief  Construct the scheduling queues for the graph.
+   *
+   *  With arg_priority_order set, each node's critical-path height --
+   *  the longest dependency chain hanging off it -- is precomputed by a
+   *  reverse topological traversal at construction, and pop_work claims
+   *  ready nodes from the highest remaining height first through
+   *  per-height bucket slices of the ready queue.  For depth-bound
+   *  graphs (triangular solves, sweeps) this keeps workers on the
+   *  critical path instead of burning them on work whose successors
+   *  are short chains.
+   */
+  WorkGraphPolicy(const graph_type& arg_graph,
+                  const bool arg_priority_order = false)
+      : m_graph(arg_graph), m_nbuckets(1) {
+    typedef Kokkos::View<std::int32_t*, Kokkos::HostSpace> host_ints_type;
+
+    const std::int32_t N = m_graph.numRows();
+
+    host_ints_type host_offsets;
+
+    if (arg_priority_order && 0 < N) {
+      auto row_map_host = Kokkos::create_mirror_view(m_graph.row_map);
+      auto entries_host = Kokkos::create_mirror_view(m_graph.entries);
+      // On host backends the mirrors alias the graph itself
+      if (row_map_host.data() != m_graph.row_map.data())
+        Kokkos::deep_copy(row_map_host, m_graph.row_map);
+      if (entries_host.data() != m_graph.entries.data())
+        Kokkos::deep_copy(entries_host, m_graph.entries);
+      const std::int32_t E = entries_host.extent(0);
+
+      // Reverse adjacency: for each node the list of its predecessors
+      host_ints_type pred_offset("WorkGraphPolicy::pred_offset", N + 1);
+      host_ints_type pred_list(
+          view_alloc("WorkGraphPolicy::pred_list", WithoutInitializing), E);
+      host_ints_type cursor(
+          view_alloc("WorkGraphPolicy::cursor", WithoutInitializing), N);
+      for (std::int32_t e = 0; e < E; ++e)
+        ++pred_offset(std::int32_t(entries_host(e)) + 1);
+      for (std::int32_t w = 0; w < N; ++w)
+        pred_offset(w + 1) += pred_offset(w);
+      for (std::int32_t w = 0; w < N; ++w) cursor(w) = pred_offset(w);
+      for (std::int32_t w = 0; w < N; ++w)
+        for (auto e = row_map_host(w); e < row_map_host(w + 1); ++e)
+          pred_list(cursor(std::int32_t(entries_host(e)))++) = w;
+
+      // Critical-path height by reverse topological traversal: sinks
+      // have height zero, every other node one more than its tallest
+      // successor
+      host_ints_type height("WorkGraphPolicy::height", N);
+      host_ints_type out_count(
+          view_alloc("WorkGraphPolicy::out_count", WithoutInitializing), N);
+      host_ints_type stack(
+          view_alloc("WorkGraphPolicy::stack", WithoutInitializing), N);
+      std::int32_t top       = 0;
+      std::int32_t processed = 0;
+      for (std::int32_t w = 0; w < N; ++w) {
+        out_count(w) = std::int32_t(row_map_host(w + 1) - row_map_host(w));
+        if (0 == out_count(w)) stack(top++) = w;
+      }
+      std::int32_t max_height = 0;
+      while (0 < top) {
+        const std::int32_t j = stack(--top);
+        ++processed;
+        for (std::int32_t k = pred_offset(j); k < pred_offset(j + 1); ++k) {
+          const std::int32_t w = pred_list(k);
+          if (height(w) < height(j) + 1) {
+            height(w) = height(j) + 1;
+            if (max_height < height(w)) max_height = height(w);
+          }
+          if (0 == --out_count(w)) stack(top++) = w;
+        }
+      }
+      if (processed != N) {
+        Kokkos::Impl::throw_runtime_exception(
+            "WorkGraphPolicy: priority ordering requires an acyclic graph");
+      }
+
+      // Bucket 0 holds the tallest nodes; slice boundaries come from a
+      // prefix sum of the per-height populations
+      m_nbuckets  = max_height + 1;
+      host_offsets = host_ints_type("WorkGraphPolicy::bucket_offsets",
+                                    m_nbuckets + 1);
+      host_ints_type bucket(
+          view_alloc("WorkGraphPolicy::bucket", WithoutInitializing), N);
+      for (std::int32_t w = 0; w < N; ++w) {
+        bucket(w) = max_height - height(w);
+        ++host_offsets(bucket(w) + 1);
+      }
+      for (std::int32_t b = 0; b < m_nbuckets; ++b)
+        host_offsets(b + 1) += host_offsets(b);
+
+      m_priority = ints_type(view_alloc("priority", WithoutInitializing), N);
+      Kokkos::deep_copy(m_priority, bucket);
+    } else {
+      host_offsets    = host_ints_type("WorkGraphPolicy::bucket_offsets", 2);
+      host_offsets(1) = N;
+    }
+
+    m_bucket_offsets =
+        ints_type(view_alloc("bucket_offsets", WithoutInitializing),
+                  m_nbuckets + 1);
+    Kokkos::deep_copy(m_bucket_offsets, host_offsets);
+
+    m_queue = ints_type(view_alloc("queue", WithoutInitializing),
+                        N * 2 + 2 * m_nbuckets);
+
     {  // Initialize
       using policy_type  = RangePolicy<std::int32_t, execution_space, TagInit>;
       using closure_type = Kokkos::Impl::ParallelFor<self_type, policy_type>;
@@ -226,6 +352,28 @@ class WorkGraphPolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
       closure.execute();
       execution_space().fence();
     }
+
+    {  // Keep the freshly initialized image of the queue so that reset()
+       // can restore it with one copy instead of re-running the three
+       // kernels above; see reset()
+      m_queue_init = ints_type(view_alloc("queue_init", WithoutInitializing),
+                               m_queue.size());
+      Kokkos::deep_copy(m_queue_init, m_queue);
+    }
+  }
+
+  /**\brief  Restore the policy to its just-constructed state.
+   *
+   *  An execution consumes the ready queue, the waiting counts and the
+   *  queue hints, so a policy can normally drive only one parallel_for.
+   *  Restoring the initialized queue image -- dependency counts template
+   *  and ready queue preloaded with the source nodes -- allows the same
+   *  policy object to be reused for repeated executions over the same
+   *  graph, paying one device-to-device copy instead of reconstruction.
+   */
+  void reset() {
+    Kokkos::deep_copy(m_queue, m_queue_init);
+    execution_space().fence();
   }
 };
 
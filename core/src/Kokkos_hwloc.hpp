@@ -82,6 +82,12 @@ unsigned get_available_cores_per_numa();
  * hyperthreads */
 unsigned get_available_threads_per_core();
 
+/** \brief  Query the data cache capacity in bytes at the given level
+ *          (1, 2 or 3).  Falls back to conservative defaults when the
+ *          operating system does not report cache geometry.
+ */
+size_t get_cache_size(unsigned level);
+
 } /* namespace hwloc */
 } /* namespace Kokkos */
 
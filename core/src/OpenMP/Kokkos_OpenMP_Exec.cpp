@@ -45,6 +45,7 @@
 #include <Kokkos_Macros.hpp>
 #if defined(KOKKOS_ENABLE_OPENMP)
 
+#include <chrono>
 #include <cstdio>
 #include <cstdlib>
 
@@ -63,6 +64,8 @@ namespace Impl {
 
 int g_openmp_hardware_max_threads = 1;
 
+std::int64_t g_openmp_min_parallel_grain = 0;
+
 __thread int t_openmp_hardware_id            = 0;
 __thread Impl::OpenMPExec *t_openmp_instance = nullptr;
 
@@ -118,6 +121,41 @@ void OpenMPExec::validate_partition(const int nthreads, int &num_partitions,
   }
 }
 
+void OpenMPExec::validate_partition_sizes(const int nthreads,
+                                          std::vector<int> &partition_sizes) {
+  if (partition_sizes.empty()) {
+    partition_sizes.push_back(nthreads);
+    return;
+  }
+
+  long sum = 0;
+  for (size_t i = 0; i < partition_sizes.size(); ++i) {
+    if (partition_sizes[i] < 1) partition_sizes[i] = 1;
+    sum += partition_sizes[i];
+  }
+
+  if (sum <= nthreads) return;
+
+  // Oversubscribed: shrink proportionally, no partition below one
+  // thread, trimming the largest partitions until the pool fits
+  long new_sum = 0;
+  for (size_t i = 0; i < partition_sizes.size(); ++i) {
+    int sz = int((long(partition_sizes[i]) * nthreads) / sum);
+    if (sz < 1) sz = 1;
+    partition_sizes[i] = sz;
+    new_sum += sz;
+  }
+  while (new_sum > nthreads) {
+    size_t largest = 0;
+    for (size_t i = 1; i < partition_sizes.size(); ++i) {
+      if (partition_sizes[i] > partition_sizes[largest]) largest = i;
+    }
+    if (partition_sizes[largest] <= 1) break;
+    --partition_sizes[largest];
+    --new_sum;
+  }
+}
+
 void OpenMPExec::verify_is_master(const char *const label) {
   if (!t_openmp_instance) {
     std::string msg(label);
@@ -136,12 +174,12 @@ namespace Kokkos {
 namespace Impl {
 
 void OpenMPExec::clear_thread_data() {
-  const size_t member_bytes =
-      sizeof(int64_t) *
-      HostThreadTeamData::align_to_int64(sizeof(HostThreadTeamData));
-
-  const int old_alloc_bytes =
-      m_pool[0] ? (member_bytes + m_pool[0]->scratch_bytes()) : 0;
+  // scratch_bytes() reports the size of the whole allocation, which
+  // includes the leading HostThreadTeamData member.  The deallocation
+  // size must match the allocation exactly: the mmap-backed HostSpace
+  // mechanism unmaps the given length, and an over-sized length would
+  // take neighboring mappings with it.
+  const int old_alloc_bytes = m_pool[0] ? m_pool[0]->scratch_bytes() : 0;
 
   OpenMP::memory_space space;
 
@@ -152,6 +190,14 @@ void OpenMPExec::clear_thread_data() {
     if (0 != m_pool[rank]) {
       m_pool[rank]->disband_pool();
 
+#if defined(KOKKOS_ENABLE_PROFILING)
+      if (Kokkos::Profiling::profileLibraryLoaded()) {
+        Kokkos::Profiling::deallocateData(
+            Kokkos::Profiling::SpaceHandle(space.name()),
+            "InternalThreadTeamData", m_pool[rank], old_alloc_bytes);
+      }
+#endif
+
       space.deallocate(m_pool[rank], old_alloc_bytes);
 
       m_pool[rank] = 0;
@@ -174,8 +220,9 @@ void OpenMPExec::resize_thread_data(size_t pool_reduce_bytes,
   const size_t old_team_reduce  = root ? root->team_reduce_bytes() : 0;
   const size_t old_team_shared  = root ? root->team_shared_bytes() : 0;
   const size_t old_thread_local = root ? root->thread_local_bytes() : 0;
-  const size_t old_alloc_bytes =
-      root ? (member_bytes + root->scratch_bytes()) : 0;
+  // scratch_bytes() covers the whole allocation including the leading
+  // HostThreadTeamData member; see clear_thread_data.
+  const size_t old_alloc_bytes = root ? root->scratch_bytes() : 0;
 
   // Allocate if any of the old allocation is tool small:
 
@@ -185,6 +232,12 @@ void OpenMPExec::resize_thread_data(size_t pool_reduce_bytes,
                         (old_thread_local < thread_local_bytes);
 
   if (allocate) {
+    Kokkos::Impl::realtime_phase_vet("OpenMP thread data resize");
+    Kokkos::Impl::allocation_audit_note(
+        "OpenMP thread data resize",
+        pool_reduce_bytes + team_reduce_bytes + team_shared_bytes +
+            thread_local_bytes);
+
     if (pool_reduce_bytes < old_pool_reduce) {
       pool_reduce_bytes = old_pool_reduce;
     }
@@ -214,6 +267,14 @@ void OpenMPExec::resize_thread_data(size_t pool_reduce_bytes,
       if (0 != m_pool[rank]) {
         m_pool[rank]->disband_pool();
 
+#if defined(KOKKOS_ENABLE_PROFILING)
+        if (Kokkos::Profiling::profileLibraryLoaded()) {
+          Kokkos::Profiling::deallocateData(
+              Kokkos::Profiling::SpaceHandle(space.name()),
+              "InternalThreadTeamData", m_pool[rank], old_alloc_bytes);
+        }
+#endif
+
         space.deallocate(m_pool[rank], old_alloc_bytes);
       }
 
@@ -226,6 +287,14 @@ void OpenMPExec::resize_thread_data(size_t pool_reduce_bytes,
         Kokkos::Impl::throw_runtime_exception(failure.get_error_message());
       }
 
+#if defined(KOKKOS_ENABLE_PROFILING)
+      if (Kokkos::Profiling::profileLibraryLoaded()) {
+        Kokkos::Profiling::allocateData(
+            Kokkos::Profiling::SpaceHandle(space.name()),
+            "InternalThreadTeamData", ptr, alloc_bytes);
+      }
+#endif
+
       m_pool[rank] = new (ptr) HostThreadTeamData();
 
       m_pool[rank]->scratch_assign(((char *)ptr) + member_bytes, alloc_bytes,
@@ -358,6 +427,14 @@ void OpenMP::impl_initialize(int thread_count)
       Kokkos::Impl::throw_runtime_exception(f.get_error_message());
     }
 
+#if defined(KOKKOS_ENABLE_PROFILING)
+    if (Kokkos::Profiling::profileLibraryLoaded()) {
+      Kokkos::Profiling::allocateData(
+          Kokkos::Profiling::SpaceHandle(space.name()), "InternalExecInstance",
+          ptr, sizeof(Impl::OpenMPExec));
+    }
+#endif
+
     Impl::t_openmp_instance =
         new (ptr) Impl::OpenMPExec(Impl::g_openmp_hardware_max_threads);
 
@@ -372,6 +449,34 @@ void OpenMP::impl_initialize(int thread_count)
           pool_reduce_bytes, team_reduce_bytes, team_shared_bytes,
           thread_local_bytes);
     }
+
+    // Calibrate the small-range serial threshold: measure the fork/barrier
+    // cost of an empty parallel region (best of several trials, the pool is
+    // warm by now) and convert it to an iteration count assuming a cheap
+    // (~16ns) loop body.  parallel_for over fewer iterations than this runs
+    // inline on the calling thread; a policy's MinParallelGrain overrides.
+    {
+      int64_t overhead_ns = std::numeric_limits<int64_t>::max();
+      for (int trial = 0; trial < 8; ++trial) {
+        int count = 0;
+        const auto t0 = std::chrono::steady_clock::now();
+#pragma omp parallel num_threads(Impl::g_openmp_hardware_max_threads)
+        {
+#pragma omp atomic
+          ++count;
+        }
+        const auto t1 = std::chrono::steady_clock::now();
+        const int64_t ns =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0)
+                .count() +
+            (count ? 0 : 1);  // keep the region from being elided
+        if (ns < overhead_ns) overhead_ns = ns;
+      }
+      int64_t grain = overhead_ns / 16;
+      if (grain < 16) grain = 16;
+      if (grain > 1024) grain = 1024;
+      Impl::g_openmp_min_parallel_grain = grain;
+    }
   }
 
   // Check for over-subscription
@@ -425,6 +530,15 @@ void OpenMP::impl_finalize()
     instance->~Exec();
 
     OpenMP::memory_space space;
+
+#if defined(KOKKOS_ENABLE_PROFILING)
+    if (Kokkos::Profiling::profileLibraryLoaded()) {
+      Kokkos::Profiling::deallocateData(
+          Kokkos::Profiling::SpaceHandle(space.name()), "InternalExecInstance",
+          instance, sizeof(Exec));
+    }
+#endif
+
     space.deallocate(instance, sizeof(Exec));
 
 #pragma omp parallel num_threads(nthreads)
@@ -57,11 +57,13 @@
 
 #include <impl/Kokkos_Traits.hpp>
 #include <impl/Kokkos_HostThreadTeam.hpp>
+#include <impl/Kokkos_Profiling_Interface.hpp>
 
 #include <Kokkos_Atomic.hpp>
 
 #include <Kokkos_UniqueToken.hpp>
 
+#include <cstdint>
 #include <iostream>
 #include <sstream>
 #include <fstream>
@@ -78,6 +80,12 @@ class OpenMPExec;
 
 extern int g_openmp_hardware_max_threads;
 
+/* Minimum RangePolicy work count worth waking the thread pool for;
+ * calibrated once in OpenMP::impl_initialize from the measured cost of
+ * an empty parallel region.  Shorter parallel_for ranges run inline on
+ * the calling thread unless the policy carries its own MinParallelGrain. */
+extern std::int64_t g_openmp_min_parallel_grain;
+
 extern __thread int t_openmp_hardware_id;
 extern __thread OpenMPExec* t_openmp_instance;
 
@@ -95,6 +103,9 @@ class OpenMPExec {
   static void validate_partition(const int nthreads, int& num_partitions,
                                  int& partition_size);
 
+  static void validate_partition_sizes(const int nthreads,
+                                       std::vector<int>& partition_sizes);
+
  private:
   OpenMPExec(int arg_pool_size)
       : m_pool_size{arg_pool_size}, m_level{omp_get_level()}, m_pool() {}
@@ -210,6 +221,14 @@ void OpenMP::partition_master(F const& f, int num_partitions,
         Kokkos::Impl::throw_runtime_exception(failure.get_error_message());
       }
 
+#if defined(KOKKOS_ENABLE_PROFILING)
+      if (Kokkos::Profiling::profileLibraryLoaded()) {
+        Kokkos::Profiling::allocateData(
+            Kokkos::Profiling::SpaceHandle(space.name()),
+            "InternalExecInstance", ptr, sizeof(Exec));
+      }
+#endif
+
       Impl::t_openmp_instance = new (ptr) Exec(partition_size);
 
       size_t pool_reduce_bytes  = 32 * partition_size;
@@ -225,6 +244,86 @@ void OpenMP::partition_master(F const& f, int num_partitions,
       f(omp_get_thread_num(), omp_get_num_threads());
 
       Impl::t_openmp_instance->~Exec();
+
+#if defined(KOKKOS_ENABLE_PROFILING)
+      if (Kokkos::Profiling::profileLibraryLoaded()) {
+        Kokkos::Profiling::deallocateData(
+            Kokkos::Profiling::SpaceHandle(space.name()),
+            "InternalExecInstance", Impl::t_openmp_instance, sizeof(Exec));
+      }
+#endif
+
+      space.deallocate(Impl::t_openmp_instance, sizeof(Exec));
+      Impl::t_openmp_instance = nullptr;
+    }
+
+    Impl::t_openmp_instance = prev_instance;
+  } else {
+    // nested openmp not enabled
+    f(0, 1);
+  }
+}
+
+template <typename F>
+void OpenMP::partition_master(F const& f,
+                              std::vector<int> const& partition_sizes) {
+  if (omp_get_nested()) {
+    using Exec = Impl::OpenMPExec;
+
+    Exec* prev_instance = Impl::t_openmp_instance;
+
+    std::vector<int> sizes(partition_sizes);
+    Exec::validate_partition_sizes(prev_instance->m_pool_size, sizes);
+
+    const int num_partitions = int(sizes.size());
+
+    OpenMP::memory_space space;
+
+#pragma omp parallel num_threads(num_partitions)
+    {
+      const int partition_size = sizes[omp_get_thread_num()];
+
+      void* ptr = nullptr;
+      try {
+        ptr = space.allocate(sizeof(Exec));
+      } catch (
+          Kokkos::Experimental::RawMemoryAllocationFailure const& failure) {
+        // For now, just rethrow the error message the existing way
+        Kokkos::Impl::throw_runtime_exception(failure.get_error_message());
+      }
+
+#if defined(KOKKOS_ENABLE_PROFILING)
+      if (Kokkos::Profiling::profileLibraryLoaded()) {
+        Kokkos::Profiling::allocateData(
+            Kokkos::Profiling::SpaceHandle(space.name()),
+            "InternalExecInstance", ptr, sizeof(Exec));
+      }
+#endif
+
+      Impl::t_openmp_instance = new (ptr) Exec(partition_size);
+
+      size_t pool_reduce_bytes  = 32 * partition_size;
+      size_t team_reduce_bytes  = 32 * partition_size;
+      size_t team_shared_bytes  = 1024 * partition_size;
+      size_t thread_local_bytes = 1024;
+
+      Impl::t_openmp_instance->resize_thread_data(
+          pool_reduce_bytes, team_reduce_bytes, team_shared_bytes,
+          thread_local_bytes);
+
+      omp_set_num_threads(partition_size);
+      f(omp_get_thread_num(), num_partitions);
+
+      Impl::t_openmp_instance->~Exec();
+
+#if defined(KOKKOS_ENABLE_PROFILING)
+      if (Kokkos::Profiling::profileLibraryLoaded()) {
+        Kokkos::Profiling::deallocateData(
+            Kokkos::Profiling::SpaceHandle(space.name()),
+            "InternalExecInstance", Impl::t_openmp_instance, sizeof(Exec));
+      }
+#endif
+
       space.deallocate(Impl::t_openmp_instance, sizeof(Exec));
       Impl::t_openmp_instance = nullptr;
     }
@@ -107,12 +107,28 @@ class ParallelFor<FunctorType, Kokkos::RangePolicy<Traits...>, Kokkos::OpenMP> {
  public:
   inline void execute() const {
     enum {
-      is_dynamic = std::is_same<typename Policy::schedule_type::type,
+      is_chunked = std::is_same<typename Policy::schedule_type::type,
+                                Kokkos::DynamicChunked>::value
+    };
+    enum {
+      is_dynamic = is_chunked ||
+                   std::is_same<typename Policy::schedule_type::type,
                                 Kokkos::Dynamic>::value
     };
+    // Number of chunks a DynamicChunked thread claims from its own
+    // partition per atomic update before falling back to stealing.
+    enum { work_block_chunks = 8 };
 
     if (OpenMP::in_parallel()) {
       exec_range<WorkTag>(m_functor, m_policy.begin(), m_policy.end());
+    } else if (int64_t(m_policy.end() - m_policy.begin()) <
+               (m_policy.min_parallel_grain() < 0
+                    ? g_openmp_min_parallel_grain
+                    : m_policy.min_parallel_grain())) {
+      // Too little work to pay for waking the pool: run inline on the
+      // calling thread.  Semantics are unchanged, host parallel_for is
+      // synchronous either way.
+      exec_range<WorkTag>(m_functor, m_policy.begin(), m_policy.end());
     } else {
       OpenMPExec::verify_is_master("Kokkos::OpenMP parallel_for");
 
@@ -135,8 +151,10 @@ class ParallelFor<FunctorType, Kokkos::RangePolicy<Traits...>, Kokkos::OpenMP> {
         std::pair<int64_t, int64_t> range(0, 0);
 
         do {
-          range = is_dynamic ? data.get_work_stealing_chunk()
-                             : data.get_work_partition();
+          range = is_chunked
+                      ? data.get_work_stealing_block(work_block_chunks)
+                      : is_dynamic ? data.get_work_stealing_chunk()
+                                   : data.get_work_partition();
 
           ParallelFor::template exec_range<WorkTag>(
               m_functor, range.first + m_policy.begin(),
@@ -191,9 +209,17 @@ class ParallelFor<FunctorType, Kokkos::MDRangePolicy<Traits...>,
  public:
   inline void execute() const {
     enum {
-      is_dynamic = std::is_same<typename Policy::schedule_type::type,
+      is_chunked = std::is_same<typename Policy::schedule_type::type,
+                                Kokkos::DynamicChunked>::value
+    };
+    enum {
+      is_dynamic = is_chunked ||
+                   std::is_same<typename Policy::schedule_type::type,
                                 Kokkos::Dynamic>::value
     };
+    // Number of chunks a DynamicChunked thread claims from its own
+    // partition per atomic update before falling back to stealing.
+    enum { work_block_chunks = 8 };
 
     if (OpenMP::in_parallel()) {
       ParallelFor::exec_range(m_mdr_policy, m_functor, m_policy.begin(),
@@ -220,8 +246,10 @@ class ParallelFor<FunctorType, Kokkos::MDRangePolicy<Traits...>,
         std::pair<int64_t, int64_t> range(0, 0);
 
         do {
-          range = is_dynamic ? data.get_work_stealing_chunk()
-                             : data.get_work_partition();
+          range = is_chunked
+                      ? data.get_work_stealing_block(work_block_chunks)
+                      : is_dynamic ? data.get_work_stealing_chunk()
+                                   : data.get_work_partition();
 
           ParallelFor::exec_range(m_mdr_policy, m_functor,
                                   range.first + m_policy.begin(),
@@ -308,9 +336,17 @@ class ParallelReduce<FunctorType, Kokkos::RangePolicy<Traits...>, ReducerType,
  public:
   inline void execute() const {
     enum {
-      is_dynamic = std::is_same<typename Policy::schedule_type::type,
+      is_chunked = std::is_same<typename Policy::schedule_type::type,
+                                Kokkos::DynamicChunked>::value
+    };
+    enum {
+      is_dynamic = is_chunked ||
+                   std::is_same<typename Policy::schedule_type::type,
                                 Kokkos::Dynamic>::value
     };
+    // Number of chunks a DynamicChunked thread claims from its own
+    // partition per atomic update before falling back to stealing.
+    enum { work_block_chunks = 8 };
 
     OpenMPExec::verify_is_master("Kokkos::OpenMP parallel_reduce");
 
@@ -348,8 +384,10 @@ class ParallelReduce<FunctorType, Kokkos::RangePolicy<Traits...>, ReducerType,
       std::pair<int64_t, int64_t> range(0, 0);
 
       do {
-        range = is_dynamic ? data.get_work_stealing_chunk()
-                           : data.get_work_partition();
+        range = is_chunked
+                    ? data.get_work_stealing_block(work_block_chunks)
+                    : is_dynamic ? data.get_work_stealing_chunk()
+                                 : data.get_work_partition();
 
         ParallelReduce::template exec_range<WorkTag>(
             m_functor, range.first + m_policy.begin(),
@@ -469,9 +507,17 @@ class ParallelReduce<FunctorType, Kokkos::MDRangePolicy<Traits...>, ReducerType,
  public:
   inline void execute() const {
     enum {
-      is_dynamic = std::is_same<typename Policy::schedule_type::type,
+      is_chunked = std::is_same<typename Policy::schedule_type::type,
+                                Kokkos::DynamicChunked>::value
+    };
+    enum {
+      is_dynamic = is_chunked ||
+                   std::is_same<typename Policy::schedule_type::type,
                                 Kokkos::Dynamic>::value
     };
+    // Number of chunks a DynamicChunked thread claims from its own
+    // partition per atomic update before falling back to stealing.
+    enum { work_block_chunks = 8 };
 
     OpenMPExec::verify_is_master("Kokkos::OpenMP parallel_reduce");
 
@@ -509,8 +555,10 @@ class ParallelReduce<FunctorType, Kokkos::MDRangePolicy<Traits...>, ReducerType,
       std::pair<int64_t, int64_t> range(0, 0);
 
       do {
-        range = is_dynamic ? data.get_work_stealing_chunk()
-                           : data.get_work_partition();
+        range = is_chunked
+                    ? data.get_work_stealing_block(work_block_chunks)
+                    : is_dynamic ? data.get_work_stealing_chunk()
+                                 : data.get_work_partition();
 
         ParallelReduce::exec_range(m_mdr_policy, m_functor,
                                    range.first + m_policy.begin(),
@@ -899,7 +947,16 @@ class ParallelFor<FunctorType, Kokkos::TeamPolicy<Properties...>,
 
  public:
   inline void execute() const {
-    enum { is_dynamic = std::is_same<SchedTag, Kokkos::Dynamic>::value };
+    enum {
+      is_chunked = std::is_same<SchedTag, Kokkos::DynamicChunked>::value
+    };
+    enum {
+      is_dynamic =
+          is_chunked || std::is_same<SchedTag, Kokkos::Dynamic>::value
+    };
+    // For one-thread teams DynamicChunked claims blocks of chunks from the
+    // local partition; larger teams fall back to single-chunk stealing.
+    enum { work_block_chunks = 8 };
 
     OpenMPExec::verify_is_master("Kokkos::OpenMP parallel_for");
 
@@ -938,8 +995,10 @@ class ParallelFor<FunctorType, Kokkos::TeamPolicy<Properties...>,
         std::pair<int64_t, int64_t> range(0, 0);
 
         do {
-          range = is_dynamic ? data.get_work_stealing_chunk()
-                             : data.get_work_partition();
+          range = is_chunked
+                      ? data.get_work_stealing_block(work_block_chunks)
+                      : is_dynamic ? data.get_work_stealing_chunk()
+                                   : data.get_work_partition();
 
           ParallelFor::template exec_team<WorkTag>(m_functor, data, range.first,
                                                    range.second,
@@ -1043,7 +1102,16 @@ class ParallelReduce<FunctorType, Kokkos::TeamPolicy<Properties...>,
 
  public:
   inline void execute() const {
-    enum { is_dynamic = std::is_same<SchedTag, Kokkos::Dynamic>::value };
+    enum {
+      is_chunked = std::is_same<SchedTag, Kokkos::DynamicChunked>::value
+    };
+    enum {
+      is_dynamic =
+          is_chunked || std::is_same<SchedTag, Kokkos::Dynamic>::value
+    };
+    // For one-thread teams DynamicChunked claims blocks of chunks from the
+    // local partition; larger teams fall back to single-chunk stealing.
+    enum { work_block_chunks = 8 };
 
     OpenMPExec::verify_is_master("Kokkos::OpenMP parallel_reduce");
 
@@ -1089,8 +1157,10 @@ class ParallelReduce<FunctorType, Kokkos::TeamPolicy<Properties...>,
         std::pair<int64_t, int64_t> range(0, 0);
 
         do {
-          range = is_dynamic ? data.get_work_stealing_chunk()
-                             : data.get_work_partition();
+          range = is_chunked
+                      ? data.get_work_stealing_block(work_block_chunks)
+                      : is_dynamic ? data.get_work_stealing_chunk()
+                                   : data.get_work_partition();
 
           ParallelReduce::template exec_team<WorkTag>(m_functor, data, update,
                                                       range.first, range.second,
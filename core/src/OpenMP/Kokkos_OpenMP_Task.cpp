@@ -49,6 +49,7 @@
 
 #include <impl/Kokkos_TaskQueue_impl.hpp>
 #include <impl/Kokkos_HostThreadTeam.hpp>
+#include <impl/Kokkos_Profiling_Interface.hpp>
 #include <OpenMP/Kokkos_OpenMP_Task.hpp>
 #include <cassert>
 
@@ -89,6 +90,14 @@ HostThreadTeamDataSingleton::HostThreadTeamDataSingleton()
         f.get_error_message());
   }
 
+#if defined(KOKKOS_ENABLE_PROFILING)
+  if (Kokkos::Profiling::profileLibraryLoaded()) {
+    Kokkos::Profiling::allocateData(
+        Kokkos::Profiling::SpaceHandle(space.name()), "InternalTaskTeamData",
+        ptr, alloc_bytes);
+  }
+#endif
+
   HostThreadTeamData::scratch_assign(
       ptr, alloc_bytes, num_pool_reduce_bytes, num_team_reduce_bytes,
       num_team_shared_bytes, num_thread_local_bytes);
@@ -96,6 +105,16 @@ HostThreadTeamDataSingleton::HostThreadTeamDataSingleton()
 
 HostThreadTeamDataSingleton::~HostThreadTeamDataSingleton() {
   Kokkos::OpenMP::memory_space space;
+
+#if defined(KOKKOS_ENABLE_PROFILING)
+  if (Kokkos::Profiling::profileLibraryLoaded()) {
+    Kokkos::Profiling::deallocateData(
+        Kokkos::Profiling::SpaceHandle(space.name()), "InternalTaskTeamData",
+        HostThreadTeamData::scratch_buffer(),
+        static_cast<size_t>(HostThreadTeamData::scratch_bytes()));
+  }
+#endif
+
   space.deallocate(HostThreadTeamData::scratch_buffer(),
                    static_cast<size_t>(HostThreadTeamData::scratch_bytes()));
 }
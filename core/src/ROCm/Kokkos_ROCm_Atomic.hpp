@@ -326,6 +326,15 @@ long long atomic_fetch_add(volatile long long* dest, const long long& val) {
   return (long long)hc::atomic_fetch_add((uint64_t*)dest, (const uint64_t&)val);
 }
 
+// Hardware float add rather than the CAS-union template below.  Newer
+// ISAs also have a global f64 add, but the HC API does not expose it, so
+// double stays on the 64-bit compare-exchange path; see
+// impl/Kokkos_Atomic_Audit.hpp for querying which types fall back.
+KOKKOS_INLINE_FUNCTION
+float atomic_fetch_add(volatile float* dest, const float& val) {
+  return hc::atomic_fetch_add((float*)dest, val);
+}
+
 KOKKOS_INLINE_FUNCTION
 int atomic_fetch_sub(volatile int* dest, const int& val) {
   return hc::atomic_fetch_sub((int*)dest, val);
@@ -425,16 +425,32 @@ struct ROCmTeamMember {
 #endif
     m_idx.barrier.wait();
 
-    for (std::size_t s = 1; s < size; s *= 2) {
-      const std::size_t index = 2 * s * team;
-      if (index < size) {
+    // Sequential-addressing tree: active threads stay contiguous so
+    // whole trailing wavefronts retire early, and adjacent threads
+    // touch adjacent LDS banks.  Fold the non-power-of-two tail first
+    // (every vector lane participates) so the tree below is dense.
+    if (team + size < std::size_t(m_team_size)) {
 #if defined(ROCM15)
-        op.join(buffer[vector_rank + index * m_vector_length],
-                buffer[vector_rank + (index + s) * m_vector_length]);
+      op.join(buffer[vector_rank + team * m_vector_length],
+              buffer[vector_rank + (team + size) * m_vector_length]);
 #else
-        lds_for(buffer[vector_rank + index * m_vector_length],
+      lds_for(buffer[vector_rank + team * m_vector_length], [&](ValueType& x) {
+        lds_for(buffer[vector_rank + (team + size) * m_vector_length],
+                [&](ValueType& y) { op.join(x, y); });
+      });
+#endif
+    }
+    m_idx.barrier.wait();
+
+    for (std::size_t s = size / 2; 0 < s; s >>= 1) {
+      if (std::size_t(team) < s) {
+#if defined(ROCM15)
+        op.join(buffer[vector_rank + team * m_vector_length],
+                buffer[vector_rank + (team + s) * m_vector_length]);
+#else
+        lds_for(buffer[vector_rank + team * m_vector_length],
                 [&](ValueType& x) {
-                  lds_for(buffer[vector_rank + (index + s) * m_vector_length],
+                  lds_for(buffer[vector_rank + (team + s) * m_vector_length],
                           [&](ValueType& y) { op.join(x, y); });
                 });
 #endif
@@ -442,20 +458,6 @@ struct ROCmTeamMember {
       m_idx.barrier.wait();
     }
 
-    if (local == 0) {
-      for (int i = size * m_vector_length; i < m_team_size * m_vector_length;
-           i += m_vector_length)
-#if defined(ROCM15)
-        op.join(buffer[vector_rank], buffer[vector_rank + i]);
-#else
-        lds_for(buffer[vector_rank], [&](ValueType& x) {
-          lds_for(buffer[vector_rank + i],
-                  [&](ValueType& y) { op.join(x, y); });
-        });
-#endif
-    }
-    m_idx.barrier.wait();
-
     return buffer[0];
   }
 
@@ -485,40 +487,42 @@ struct ROCmTeamMember {
     buffer[local] = reducer.reference();
 #else
     // ROCM 1.5 handles address spaces better, previous version didn't
-    lds_for(buffer[local], [&](ValueType& x) { x = value; });
+    lds_for(buffer[local], [&](value_type& x) { x = reducer.reference(); });
 #endif
     m_idx.barrier.wait();
 
-    for (std::size_t s = 1; s < size; s *= 2) {
-      const std::size_t index = 2 * s * team;
-      if (index < size) {
+    // Sequential-addressing tree: active threads stay contiguous so
+    // whole trailing wavefronts retire early, and adjacent threads
+    // touch adjacent LDS banks.  Fold the non-power-of-two tail first
+    // (every vector lane participates) so the tree below is dense.
+    if (team + size < std::size_t(m_team_size)) {
 #if defined(ROCM15)
-        reducer.join(buffer[vector_rank + index * m_vector_length],
-                     buffer[vector_rank + (index + s) * m_vector_length]);
+      reducer.join(buffer[vector_rank + team * m_vector_length],
+                   buffer[vector_rank + (team + size) * m_vector_length]);
 #else
-        lds_for(buffer[vector_rank + index * m_vector_length],
-                [&](ValueType& x) {
-                  lds_for(buffer[vector_rank + (index + s) * m_vector_length],
-                          [&](ValueType& y) { reducer.join(x, y); });
-                });
+      lds_for(buffer[vector_rank + team * m_vector_length], [&](value_type& x) {
+        lds_for(buffer[vector_rank + (team + size) * m_vector_length],
+                [&](value_type& y) { reducer.join(x, y); });
+      });
 #endif
-      }
-      m_idx.barrier.wait();
     }
+    m_idx.barrier.wait();
 
-    if (local == 0) {
-      for (int i = size * m_vector_length; i < m_team_size * m_vector_length;
-           i += m_vector_length)
+    for (std::size_t s = size / 2; 0 < s; s >>= 1) {
+      if (std::size_t(team) < s) {
 #if defined(ROCM15)
-        reducer.join(buffer[vector_rank], buffer[vector_rank + i]);
+        reducer.join(buffer[vector_rank + team * m_vector_length],
+                     buffer[vector_rank + (team + s) * m_vector_length]);
 #else
-        lds_for(buffer[vector_rank], [&](ValueType& x) {
-          lds_for(buffer[vector_rank + i],
-                  [&](ValueType& y) { reducer.join(x, y); });
-        });
+        lds_for(buffer[vector_rank + team * m_vector_length],
+                [&](value_type& x) {
+                  lds_for(buffer[vector_rank + (team + s) * m_vector_length],
+                          [&](value_type& y) { reducer.join(x, y); });
+                });
 #endif
+      }
+      m_idx.barrier.wait();
     }
-    m_idx.barrier.wait();
     reducer.reference() = buffer[0];
   }
 
@@ -545,15 +549,17 @@ struct ROCmTeamMember {
     auto thread_base = team_rank() * m_vector_length;
     lds_for(buffer[local], [&](ValueType& x) { x = value; });
     m_idx.barrier.wait();
-    for (std::size_t s = 1; s < size; s *= 2) {
-      const std::size_t index = 2 * s * vector_rank;
-      if (index < size) {
+    // Sequential-addressing tree over the (power of 2) vector lanes:
+    // active lanes stay contiguous and hit adjacent LDS banks.
+    for (std::size_t s = size / 2; 0 < s; s >>= 1) {
+      if (std::size_t(vector_rank) < s) {
 #if defined(ROCM15)
-        op.join(buffer[thread_base + index], buffer[thread_base + index + s]);
+        op.join(buffer[thread_base + vector_rank],
+                buffer[thread_base + vector_rank + s]);
 #else
 
-        lds_for(buffer[thread_base + index], [&](ValueType& x) {
-          lds_for(buffer[thread_base + index + s],
+        lds_for(buffer[thread_base + vector_rank], [&](ValueType& x) {
+          lds_for(buffer[thread_base + vector_rank + s],
                   [&](ValueType& y) { op.join(x, y); });
         });
 #endif
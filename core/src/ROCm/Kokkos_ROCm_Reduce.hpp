@@ -129,10 +129,21 @@ void reduce_enqueue(const int szElements,  // size of the extent
         });
         t_idx.barrier.wait();
 
-        for (std::size_t s = 1; s < buffer.size(); s *= 2) {
-          const std::size_t index = 2 * s * local;
-          if (index < buffer.size()) {
-            buffer.action_at(index, index + s, [&](T* x, T* y) {
+        // Sequential-addressing tree: active lanes stay contiguous so
+        // whole trailing wavefronts retire early, and stride-one LDS
+        // indexing avoids bank conflicts.  Fold the non-power-of-two
+        // tail first so the tree below is dense.
+        const std::size_t half = next_pow_2(buffer.size() + 1) / 2;
+        if (local + half < buffer.size()) {
+          buffer.action_at(local, local + half, [&](T* x, T* y) {
+            ValueJoin::join(ReducerConditional::select(f, reducer), x, y);
+          });
+        }
+        t_idx.barrier.wait();
+
+        for (std::size_t s = half / 2; 0 < s; s >>= 1) {
+          if (std::size_t(local) < s) {
+            buffer.action_at(local, local + s, [&](T* x, T* y) {
               ValueJoin::join(ReducerConditional::select(f, reducer), x, y);
             });
           }
@@ -58,6 +58,7 @@
 #include <Kokkos_ROCmSpace.hpp>
 
 #include <impl/Kokkos_Error.hpp>
+#include <Kokkos_MemoryAccounting.hpp>
 
 #if defined(KOKKOS_ENABLE_PROFILING)
 #include <impl/Kokkos_Profiling_Interface.hpp>
@@ -311,6 +312,8 @@ SharedAllocationRecord<Kokkos::Experimental::ROCmSpace,
   }
 #endif
 
+  Kokkos::Impl::account_deallocation(m_space.name(), data(), size());
+
   m_space.deallocate(SharedAllocationRecord<void, void>::m_alloc_ptr,
                      SharedAllocationRecord<void, void>::m_alloc_size);
 }
@@ -326,6 +329,8 @@ SharedAllocationRecord<Kokkos::Experimental::ROCmHostPinnedSpace,
   }
 #endif
 
+  Kokkos::Impl::account_deallocation(m_space.name(), data(), size());
+
   m_space.deallocate(SharedAllocationRecord<void, void>::m_alloc_ptr,
                      SharedAllocationRecord<void, void>::m_alloc_size);
 }
@@ -354,6 +359,9 @@ SharedAllocationRecord<Kokkos::Experimental::ROCmSpace, void>::
   }
 #endif
 
+  Kokkos::Impl::account_allocation(arg_space.name(), arg_label, data(),
+                                   arg_alloc_size);
+
   SharedAllocationHeader header;
 
   // Fill in the Header information
@@ -392,6 +400,9 @@ SharedAllocationRecord<Kokkos::Experimental::ROCmHostPinnedSpace, void>::
         arg_alloc_size);
   }
 #endif
+
+  Kokkos::Impl::account_allocation(arg_space.name(), arg_label, data(),
+                                   arg_alloc_size);
   // Fill in the Header information, directly accessible via host pinned memory
 
   RecordBase::m_alloc_ptr->m_record = this;
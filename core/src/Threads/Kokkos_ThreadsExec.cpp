@@ -77,6 +77,19 @@ unsigned s_current_shared_size = 0;
 void (*volatile s_current_function)(ThreadsExec &, const void *);
 const void *volatile s_current_function_arg = 0;
 
+// Sub-pool partitioning of the spawned worker threads.  Each partition is
+// a contiguous range of entries in 's_threads_exec' with its own fan-in
+// tree and its own function slot, so launches on distinct partitions
+// proceed without synchronizing with each other.
+enum { MAX_POOL_PARTITIONS = 16 };
+
+int s_num_partitions                                 = 0;
+int s_partition_entry_begin[MAX_POOL_PARTITIONS + 1] = {0};
+
+void (*volatile s_partition_function[MAX_POOL_PARTITIONS])(ThreadsExec &,
+                                                           const void *) = {0};
+const void *volatile s_partition_function_arg[MAX_POOL_PARTITIONS]       = {0};
+
 struct Sentinel {
   Sentinel() {}
 
@@ -119,7 +132,14 @@ void ThreadsExec::driver(void) {
   ThreadsExec this_thread;
 
   while (ThreadsExec::Active == this_thread.m_pool_state) {
-    (*s_current_function)(this_thread, s_current_function_arg);
+    const int partition = this_thread.m_pool_partition;
+
+    if (partition < 0) {
+      (*s_current_function)(this_thread, s_current_function_arg);
+    } else {
+      (*s_partition_function[partition])(this_thread,
+                                         s_partition_function_arg[partition]);
+    }
 
     // Deactivate thread and wait for reactivation
     this_thread.m_pool_state = ThreadsExec::Inactive;
@@ -138,6 +158,7 @@ ThreadsExec::ThreadsExec()
       m_pool_rank(0),
       m_pool_size(0),
       m_pool_fan_size(0),
+      m_pool_partition(-1),
       m_pool_state(ThreadsExec::Terminating) {
   if (&s_threads_process != this) {
     // A spawned thread
@@ -205,6 +226,7 @@ ThreadsExec::~ThreadsExec() {
   m_pool_rank          = 0;
   m_pool_size          = 0;
   m_pool_fan_size      = 0;
+  m_pool_partition     = -1;
 
   m_pool_state = ThreadsExec::Terminating;
 
@@ -292,7 +314,26 @@ int ThreadsExec::in_parallel() {
 }
 
 // Wait for root thread to become inactive
-void ThreadsExec::fence() {
+void ThreadsExec::fence(const int partition) {
+  if (0 <= partition) {
+    if (s_num_partitions <= partition) {
+      Kokkos::Impl::throw_runtime_exception(
+          std::string("ThreadsExec::fence() FAILED : no such pool partition"));
+    }
+
+    // Wait for the sub-pool's root thread to complete:
+    Impl::spinwait_while_equal<int>(
+        s_threads_exec[s_partition_entry_begin[partition]]->m_pool_state,
+        ThreadsExec::Active);
+
+    s_partition_function[partition]     = 0;
+    s_partition_function_arg[partition] = 0;
+
+    memory_fence();
+
+    return;
+  }
+
   if (s_thread_pool_size[0]) {
     // Wait for the root thread to complete:
     Impl::spinwait_while_equal<int>(s_threads_exec[0]->m_pool_state,
@@ -309,9 +350,46 @@ void ThreadsExec::fence() {
 
 /** \brief  Begin execution of the asynchronous functor */
 void ThreadsExec::start(void (*func)(ThreadsExec &, const void *),
-                        const void *arg) {
+                        const void *arg, const int partition) {
+  if (0 <= partition) {
+    // Sub-pool launch.  Deliberately do not require the master process:
+    // the point of partitioning is that independent application threads
+    // drive their own sub-pools, one launching thread per sub-pool.
+    if (s_num_partitions <= partition) {
+      Kokkos::Impl::throw_runtime_exception(
+          std::string("ThreadsExec::start() FAILED : no such pool partition"));
+    }
+
+    if (s_partition_function[partition]) {
+      Kokkos::Impl::throw_runtime_exception(std::string(
+          "ThreadsExec::start() FAILED : partition already executing"));
+    }
+
+    s_partition_function_arg[partition] = arg;
+    s_partition_function[partition]     = func;
+
+    // Make sure function and arguments are written before activating threads.
+    memory_fence();
+
+    // Activate this sub-pool's threads, root thread (lowest entry) last:
+    const int entry_begin = s_partition_entry_begin[partition];
+
+    for (int i = s_partition_entry_begin[partition + 1]; entry_begin < i--;) {
+      s_threads_exec[i]->m_pool_state = ThreadsExec::Active;
+    }
+
+    return;
+  }
+
   verify_is_process("ThreadsExec::start", true);
 
+  if (s_num_partitions) {
+    Kokkos::Impl::throw_runtime_exception(
+        std::string("ThreadsExec::start() FAILED : pool is partitioned, "
+                    "launch on partition instances or call "
+                    "Threads::unpartition_pool()"));
+  }
+
   if (s_current_function || s_current_function_arg) {
     Kokkos::Impl::throw_runtime_exception(
         std::string("ThreadsExec::start() FAILED : already executing"));
@@ -340,6 +418,11 @@ void ThreadsExec::start(void (*func)(ThreadsExec &, const void *),
 bool ThreadsExec::sleep() {
   verify_is_process("ThreadsExec::sleep", true);
 
+  if (s_num_partitions) {
+    Kokkos::Impl::throw_runtime_exception(
+        std::string("ThreadsExec::sleep() FAILED : pool is partitioned"));
+  }
+
   if (&execute_sleep == s_current_function) return false;
 
   fence();
@@ -407,7 +490,12 @@ void ThreadsExec::execute_serial(void (*func)(ThreadsExec &, const void *)) {
 
 //----------------------------------------------------------------------------
 
-void *ThreadsExec::root_reduce_scratch() {
+void *ThreadsExec::root_reduce_scratch(const int partition) {
+  if (0 <= partition && partition < s_num_partitions) {
+    // The sub-pool's root thread occupies its lowest entry:
+    return s_threads_exec[s_partition_entry_begin[partition]]->reduce_memory();
+  }
+
   return s_threads_process.reduce_memory();
 }
 
@@ -447,18 +535,40 @@ void ThreadsExec::execute_resize_scratch(ThreadsExec &exec, const void *) {
   }
 }
 
-void *ThreadsExec::resize_scratch(size_t reduce_size, size_t thread_size) {
+void *ThreadsExec::resize_scratch(size_t reduce_size, size_t thread_size,
+                                  const int partition) {
   enum { ALIGN_MASK = Kokkos::Impl::MEMORY_ALIGNMENT - 1 };
 
+  reduce_size = (reduce_size + ALIGN_MASK) & ~ALIGN_MASK;
+  thread_size = (thread_size + ALIGN_MASK) & ~ALIGN_MASK;
+
+  if (0 <= partition) {
+    // Scratch is pool-wide state and cannot be re-sized while other
+    // sub-pools may be running concurrently.  It grows monotonically and
+    // is pre-sized at initialization, so only an unusually large value
+    // type can trip this: run the kernel once before partition_pool().
+    if (s_num_partitions <= partition) {
+      Kokkos::Impl::throw_runtime_exception(std::string(
+          "ThreadsExec::resize_scratch FAILED : no such pool partition"));
+    }
+
+    if ((size_t(s_threads_process.m_scratch_reduce_end) < reduce_size) ||
+        (size_t(s_threads_process.m_scratch_thread_end) <
+         reduce_size + thread_size)) {
+      Kokkos::Impl::throw_runtime_exception(std::string(
+          "ThreadsExec::resize_scratch FAILED : cannot grow scratch while "
+          "the pool is partitioned, size it before partition_pool()"));
+    }
+
+    return s_threads_exec[s_partition_entry_begin[partition]]->m_scratch;
+  }
+
   fence();
 
   const size_t old_reduce_size = s_threads_process.m_scratch_reduce_end;
   const size_t old_thread_size = s_threads_process.m_scratch_thread_end -
                                  s_threads_process.m_scratch_reduce_end;
 
-  reduce_size = (reduce_size + ALIGN_MASK) & ~ALIGN_MASK;
-  thread_size = (thread_size + ALIGN_MASK) & ~ALIGN_MASK;
-
   // Increase size or deallocate completely.
 
   if ((old_reduce_size < reduce_size) || (old_thread_size < thread_size) ||
@@ -466,6 +576,12 @@ void *ThreadsExec::resize_scratch(size_t reduce_size, size_t thread_size) {
        (old_reduce_size != 0 || old_thread_size != 0))) {
     verify_is_process("ThreadsExec::resize_scratch", true);
 
+    if (s_num_partitions) {
+      Kokkos::Impl::throw_runtime_exception(std::string(
+          "ThreadsExec::resize_scratch FAILED : cannot resize scratch while "
+          "the pool is partitioned, call Threads::unpartition_pool()"));
+    }
+
     s_threads_process.m_scratch_reduce_end = reduce_size;
     s_threads_process.m_scratch_thread_end = reduce_size + thread_size;
 
@@ -479,6 +595,102 @@ void *ThreadsExec::resize_scratch(size_t reduce_size, size_t thread_size) {
 
 //----------------------------------------------------------------------------
 
+int ThreadsExec::partition_count() { return s_num_partitions; }
+
+void ThreadsExec::partition_pool(const int *sizes, const int count) {
+  verify_is_process("ThreadsExec::partition_pool", true);
+
+  fence();
+
+  if (s_num_partitions) {
+    Kokkos::Impl::throw_runtime_exception(
+        std::string("ThreadsExec::partition_pool FAILED : already "
+                    "partitioned, call Threads::unpartition_pool() first"));
+  }
+
+  // Only the spawned workers are partitioned.  When the master process is
+  // a pool member (synchronous pool) it stands aside, so that sub-pool
+  // launches never wait on the master's attention.
+  const int entry_begin = s_threads_process.m_pool_base ? 1 : 0;
+  const int num_workers = s_thread_pool_size[0] - entry_begin;
+
+  bool valid = 0 < count && count <= int(MAX_POOL_PARTITIONS);
+
+  int total = 0;
+  for (int p = 0; valid && p < count; ++p) {
+    valid = 0 < sizes[p];
+    total += sizes[p];
+  }
+
+  if (!valid || total != num_workers) {
+    std::ostringstream msg;
+    msg << "ThreadsExec::partition_pool FAILED : requested sizes [";
+    for (int p = 0; p < count; ++p) {
+      msg << " " << sizes[p];
+    }
+    msg << " ] must be positive, at most " << int(MAX_POOL_PARTITIONS)
+        << " partitions, and sum to the " << num_workers
+        << " spawned worker threads";
+    Kokkos::Impl::throw_runtime_exception(msg.str());
+  }
+
+  s_partition_entry_begin[0] = entry_begin;
+
+  for (int p = 0; p < count; ++p) {
+    s_partition_entry_begin[p + 1] = s_partition_entry_begin[p] + sizes[p];
+
+    // A contiguous range of entries holds a contiguous, descending range
+    // of ranks, so the sub-pool reuses the fan-in/scan machinery
+    // unchanged with partition-local base, rank, and fan size.
+    for (int i = 0; i < sizes[p]; ++i) {
+      ThreadsExec &th = *s_threads_exec[s_partition_entry_begin[p] + i];
+
+      th.m_pool_base      = s_threads_exec + s_partition_entry_begin[p];
+      th.m_pool_rank      = sizes[p] - (i + 1);
+      th.m_pool_rank_rev  = i;
+      th.m_pool_size      = sizes[p];
+      th.m_pool_fan_size  = fan_size(th.m_pool_rank, th.m_pool_size);
+      th.m_pool_partition = p;
+    }
+  }
+
+  s_num_partitions = count;
+
+  // Workers are inactive and re-read their pool members only after a
+  // subsequent activation; make the writes visible before any launch.
+  memory_fence();
+}
+
+void ThreadsExec::unpartition_pool() {
+  verify_is_process("ThreadsExec::unpartition_pool", true);
+
+  // Quiesce every sub-pool before restoring the whole-pool fan-in:
+  for (int p = 0; p < s_num_partitions; ++p) {
+    fence(p);
+  }
+
+  if (0 == s_num_partitions) return;
+
+  const int entry_begin = s_threads_process.m_pool_base ? 1 : 0;
+
+  for (int i = entry_begin; i < s_thread_pool_size[0]; ++i) {
+    ThreadsExec &th = *s_threads_exec[i];
+
+    th.m_pool_base      = s_threads_exec;
+    th.m_pool_rank      = s_thread_pool_size[0] - (i + 1);
+    th.m_pool_rank_rev  = i;
+    th.m_pool_size      = s_thread_pool_size[0];
+    th.m_pool_fan_size  = fan_size(th.m_pool_rank, th.m_pool_size);
+    th.m_pool_partition = -1;
+  }
+
+  s_num_partitions = 0;
+
+  memory_fence();
+}
+
+//----------------------------------------------------------------------------
+
 void ThreadsExec::print_configuration(std::ostream &s, const bool detail) {
   verify_is_process("ThreadsExec::print_configuration", false);
 
@@ -722,6 +934,8 @@ void ThreadsExec::finalize() {
 
   fence();
 
+  if (s_num_partitions) unpartition_pool();
+
   resize_scratch(0, 0);
 
   const unsigned begin = s_threads_process.m_pool_base ? 1 : 0;
@@ -783,9 +997,22 @@ int Threads::concurrency() {
 #endif
 }
 #ifndef KOKKOS_ENABLE_DEPRECATED_CODE
-void Threads::fence() const { Impl::ThreadsExec::fence(); }
+void Threads::fence() const { Impl::ThreadsExec::fence(m_pool_partition); }
 #endif
 
+Threads Threads::partition_instance(const int partition) {
+  if (partition < 0 || Impl::ThreadsExec::partition_count() <= partition) {
+    std::ostringstream msg;
+    msg << "Kokkos::Threads::partition_instance ERROR : partition "
+        << partition << " of " << Impl::ThreadsExec::partition_count();
+    Kokkos::Impl::throw_runtime_exception(msg.str());
+  }
+
+  Threads instance;
+  instance.m_pool_partition = partition;
+  return instance;
+}
+
 #ifdef KOKKOS_ENABLE_DEPRECATED_CODE
 Threads &Threads::instance(int)
 #else
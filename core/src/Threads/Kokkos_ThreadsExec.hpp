@@ -105,6 +105,7 @@ class ThreadsExec {
   int m_pool_rank_rev;
   int m_pool_size;
   int m_pool_fan_size;
+  int m_pool_partition;       ///< Sub-pool membership, -1 for the whole pool
   int volatile m_pool_state;  ///< State for global synchronizations
 
   // Members for dynamic scheduling
@@ -155,9 +156,10 @@ class ThreadsExec {
   ~ThreadsExec();
   ThreadsExec();
 
-  static void *resize_scratch(size_t reduce_size, size_t thread_size);
+  static void *resize_scratch(size_t reduce_size, size_t thread_size,
+                              const int partition = -1);
 
-  static void *root_reduce_scratch();
+  static void *root_reduce_scratch(const int partition = -1);
 
   static bool is_process();
 
@@ -171,6 +173,24 @@ class ThreadsExec {
 
   static void finalize();
 
+  //------------------------------------
+  /** \brief  Split the spawned worker threads into 'count' disjoint,
+   *          contiguous sub-pools of the given sizes, each with its own
+   *          fan-in tree so that kernels launched on different sub-pools
+   *          never synchronize with each other.
+   *
+   *  The sizes must sum to the number of spawned workers; when the master
+   *  process is a pool member it stands aside so that sub-pool launches
+   *  never wait on the master's attention.  Whole-pool launches (and
+   *  TeamPolicy dispatch) are rejected until unpartition_pool().
+   */
+  static void partition_pool(const int *sizes, const int count);
+
+  /** \brief  Quiesce all sub-pools and restore the whole-pool fan-in. */
+  static void unpartition_pool();
+
+  static int partition_count();
+
   /* Given a requested team size, return valid team size */
   static unsigned team_size_valid(unsigned);
 
@@ -208,17 +228,21 @@ class ThreadsExec {
       int accum = 0;
 
       for (int rank = 0; rank < m_pool_size; ++rank) {
-        accum += *((volatile int *)get_thread(rank)->reduce_memory());
+        accum += *(
+            (volatile int *)m_pool_base[m_pool_size - (rank + 1)]
+                ->reduce_memory());
       }
 
       for (int rank = 0; rank < m_pool_size; ++rank) {
-        *((volatile int *)get_thread(rank)->reduce_memory()) = accum;
+        *((volatile int *)m_pool_base[m_pool_size - (rank + 1)]
+              ->reduce_memory()) = accum;
       }
 
       memory_fence();
 
       for (int rank = 0; rank < m_pool_size; ++rank) {
-        get_thread(rank)->m_pool_state = ThreadsExec::Active;
+        m_pool_base[m_pool_size - (rank + 1)]->m_pool_state =
+            ThreadsExec::Active;
       }
     }
 
@@ -248,7 +272,8 @@ class ThreadsExec {
       memory_fence();
 
       for (int rank = 0; rank < m_pool_size; ++rank) {
-        get_thread(rank)->m_pool_state = ThreadsExec::Active;
+        m_pool_base[m_pool_size - (rank + 1)]->m_pool_state =
+            ThreadsExec::Active;
       }
     }
   }
@@ -445,7 +470,8 @@ class ThreadsExec {
 
       for (int rank = 0; rank < m_pool_size; ++rank) {
         scalar_type *const ptr =
-            (scalar_type *)get_thread(rank)->reduce_memory();
+            (scalar_type *)m_pool_base[m_pool_size - (rank + 1)]
+                ->reduce_memory();
         if (rank) {
           for (unsigned i = 0; i < count; ++i) {
             ptr[i] = ptr_prev[i + count];
@@ -467,11 +493,16 @@ class ThreadsExec {
   /** \brief  Wait for previous asynchronous functor to
    *          complete and release the Threads device.
    *          Acquire the Threads device and start this functor.
+   *
+   *  A non-negative 'partition' launches on that sub-pool only and may
+   *  be called concurrently from distinct application threads, one
+   *  launching thread per sub-pool.
    */
-  static void start(void (*)(ThreadsExec &, const void *), const void *);
+  static void start(void (*)(ThreadsExec &, const void *), const void *,
+                    const int partition = -1);
 
   static int in_parallel();
-  static void fence();
+  static void fence(const int partition = -1);
   static bool sleep();
   static bool wake();
 
@@ -649,6 +680,14 @@ inline void Threads::print_configuration(std::ostream &s, const bool detail) {
   Impl::ThreadsExec::print_configuration(s, detail);
 }
 
+inline void Threads::partition_pool(const int *sizes, const int count) {
+  Impl::ThreadsExec::partition_pool(sizes, count);
+}
+
+inline void Threads::unpartition_pool() {
+  Impl::ThreadsExec::unpartition_pool();
+}
+
 #ifdef KOKKOS_ENABLE_DEPRECATED_CODE
 inline bool Threads::sleep() { return Impl::ThreadsExec::sleep(); }
 
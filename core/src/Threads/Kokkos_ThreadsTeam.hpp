@@ -798,6 +798,15 @@ class TeamPolicyInternal<Kokkos::Threads, Properties...>
 #endif
   inline int chunk_size() const { return m_chunk_size; }
 
+  /** \brief  Replace the requested team size.
+   *
+   *  League size and scratch requests are preserved; the automatic
+   *  chunk size is recomputed for the new team layout.
+   */
+  inline void impl_set_team_size(const int team_size_request) {
+    init(m_league_size, team_size_request);
+  }
+
 #ifdef KOKKOS_ENABLE_DEPRECATED_CODE
   /** \brief set chunk_size to a discrete value*/
   inline TeamPolicyInternal set_chunk_size(
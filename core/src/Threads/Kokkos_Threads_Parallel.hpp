@@ -158,8 +158,10 @@ class ParallelFor<FunctorType, Kokkos::RangePolicy<Traits...>,
 
  public:
   inline void execute() const {
-    ThreadsExec::start(&ParallelFor::exec, this);
-    ThreadsExec::fence();
+    const int partition = m_policy.space().impl_pool_partition();
+
+    ThreadsExec::start(&ParallelFor::exec, this, partition);
+    ThreadsExec::fence(partition);
   }
 
   ParallelFor(const FunctorType &arg_functor, const Policy &arg_policy)
@@ -249,8 +251,10 @@ class ParallelFor<FunctorType, Kokkos::MDRangePolicy<Traits...>,
 
  public:
   inline void execute() const {
-    ThreadsExec::start(&ParallelFor::exec, this);
-    ThreadsExec::fence();
+    const int partition = m_mdr_policy.space().impl_pool_partition();
+
+    ThreadsExec::start(&ParallelFor::exec, this, partition);
+    ThreadsExec::fence(partition);
   }
 
   ParallelFor(const FunctorType &arg_functor, const MDRangePolicy &arg_policy)
@@ -465,18 +469,20 @@ class ParallelReduce<FunctorType, Kokkos::RangePolicy<Traits...>, ReducerType,
 
  public:
   inline void execute() const {
+    const int partition = m_policy.space().impl_pool_partition();
+
     ThreadsExec::resize_scratch(
         ValueTraits::value_size(
             ReducerConditional::select(m_functor, m_reducer)),
-        0);
+        0, partition);
 
-    ThreadsExec::start(&ParallelReduce::exec, this);
+    ThreadsExec::start(&ParallelReduce::exec, this, partition);
 
-    ThreadsExec::fence();
+    ThreadsExec::fence(partition);
 
     if (m_result_ptr) {
       const pointer_type data =
-          (pointer_type)ThreadsExec::root_reduce_scratch();
+          (pointer_type)ThreadsExec::root_reduce_scratch(partition);
 
       const unsigned n = ValueTraits::value_count(
           ReducerConditional::select(m_functor, m_reducer));
@@ -623,18 +629,20 @@ class ParallelReduce<FunctorType, Kokkos::MDRangePolicy<Traits...>, ReducerType,
 
  public:
   inline void execute() const {
+    const int partition = m_mdr_policy.space().impl_pool_partition();
+
     ThreadsExec::resize_scratch(
         ValueTraits::value_size(
             ReducerConditional::select(m_functor, m_reducer)),
-        0);
+        0, partition);
 
-    ThreadsExec::start(&ParallelReduce::exec, this);
+    ThreadsExec::start(&ParallelReduce::exec, this, partition);
 
-    ThreadsExec::fence();
+    ThreadsExec::fence(partition);
 
     if (m_result_ptr) {
       const pointer_type data =
-          (pointer_type)ThreadsExec::root_reduce_scratch();
+          (pointer_type)ThreadsExec::root_reduce_scratch(partition);
 
       const unsigned n = ValueTraits::value_count(
           ReducerConditional::select(m_functor, m_reducer));
@@ -871,9 +879,12 @@ class ParallelScan<FunctorType, Kokkos::RangePolicy<Traits...>,
 
  public:
   inline void execute() const {
-    ThreadsExec::resize_scratch(2 * ValueTraits::value_size(m_functor), 0);
-    ThreadsExec::start(&ParallelScan::exec, this);
-    ThreadsExec::fence();
+    const int partition = m_policy.space().impl_pool_partition();
+
+    ThreadsExec::resize_scratch(2 * ValueTraits::value_size(m_functor), 0,
+                                partition);
+    ThreadsExec::start(&ParallelScan::exec, this, partition);
+    ThreadsExec::fence(partition);
   }
 
   ParallelScan(const FunctorType &arg_functor, const Policy &arg_policy)
@@ -953,9 +964,12 @@ class ParallelScanWithTotal<FunctorType, Kokkos::RangePolicy<Traits...>,
 
  public:
   inline void execute() const {
-    ThreadsExec::resize_scratch(2 * ValueTraits::value_size(m_functor), 0);
-    ThreadsExec::start(&ParallelScanWithTotal::exec, this);
-    ThreadsExec::fence();
+    const int partition = m_policy.space().impl_pool_partition();
+
+    ThreadsExec::resize_scratch(2 * ValueTraits::value_size(m_functor), 0,
+                                partition);
+    ThreadsExec::start(&ParallelScanWithTotal::exec, this, partition);
+    ThreadsExec::fence(partition);
   }
 
   ParallelScanWithTotal(const FunctorType &arg_functor,
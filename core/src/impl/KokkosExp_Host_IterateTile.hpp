@@ -1518,6 +1518,208 @@ struct Tile_Loop_Type<
                              a, b, 8);
   }
 };
+// Morton (Z-order) intra-tile walk: the linear intra-tile index is
+// bit-deinterleaved into the tile coordinates, so consecutive iterations stay
+// inside a small multi-dimensional neighborhood regardless of which operand
+// layout dominates.  The tile is padded to a power-of-two bounding box and
+// box points outside the (possibly partial) tile are skipped, so full and
+// partial tiles share one loop.  Only ranks 2 and 3 define a Morton walk;
+// the primary template falls back to the Right walk for other ranks.
+
+// Extract the coordinate of dimension 'dim' from the interleaved index t
+template <typename IType>
+inline IType morton_coordinate(IType t, const int dim, const int rank) {
+  IType coord = 0;
+  int bit     = 0;
+  for (t >>= dim; t != 0; t >>= rank, ++bit) {
+    coord |= (t & IType(1)) << bit;
+  }
+  return coord;
+}
+
+template <int Rank, typename IType, typename Tagged = void,
+          typename Enable = void>
+struct Morton_Tile_Loop {
+  template <typename Func, typename Offset, typename Extent>
+  static void apply(Func const& func, Offset const& offset,
+                    Extent const& extent) {
+    Tile_Loop_Type<Rank, false, IType, Tagged>::apply(func, true, offset,
+                                                      extent, extent);
+  }
+
+  template <typename ValType, typename Func, typename Offset, typename Extent>
+  static void apply(ValType& value, Func const& func, Offset const& offset,
+                    Extent const& extent) {
+    Tile_Loop_Type<Rank, false, IType, Tagged>::apply(value, func, true,
+                                                      offset, extent, extent);
+  }
+};
+
+template <typename IType>
+struct Morton_Tile_Loop<2, IType, void, void> {
+  template <typename Func, typename Offset, typename Extent>
+  static void apply(Func const& func, Offset const& offset,
+                    Extent const& extent) {
+    IType box = 1;
+    while (box < static_cast<IType>(extent[0]) ||
+           box < static_cast<IType>(extent[1]))
+      box <<= 1;
+    for (IType t = 0; t < box * box; ++t) {
+      const IType i0 = morton_coordinate(t, 0, 2);
+      const IType i1 = morton_coordinate(t, 1, 2);
+      if (i0 < static_cast<IType>(extent[0]) &&
+          i1 < static_cast<IType>(extent[1])) {
+        func(i0 + offset[0], i1 + offset[1]);
+      }
+    }
+  }
+
+  template <typename ValType, typename Func, typename Offset, typename Extent>
+  static void apply(ValType& value, Func const& func, Offset const& offset,
+                    Extent const& extent) {
+    IType box = 1;
+    while (box < static_cast<IType>(extent[0]) ||
+           box < static_cast<IType>(extent[1]))
+      box <<= 1;
+    for (IType t = 0; t < box * box; ++t) {
+      const IType i0 = morton_coordinate(t, 0, 2);
+      const IType i1 = morton_coordinate(t, 1, 2);
+      if (i0 < static_cast<IType>(extent[0]) &&
+          i1 < static_cast<IType>(extent[1])) {
+        func(i0 + offset[0], i1 + offset[1], value);
+      }
+    }
+  }
+};
+
+template <typename IType>
+struct Morton_Tile_Loop<3, IType, void, void> {
+  template <typename Func, typename Offset, typename Extent>
+  static void apply(Func const& func, Offset const& offset,
+                    Extent const& extent) {
+    IType box = 1;
+    while (box < static_cast<IType>(extent[0]) ||
+           box < static_cast<IType>(extent[1]) ||
+           box < static_cast<IType>(extent[2]))
+      box <<= 1;
+    for (IType t = 0; t < box * box * box; ++t) {
+      const IType i0 = morton_coordinate(t, 0, 3);
+      const IType i1 = morton_coordinate(t, 1, 3);
+      const IType i2 = morton_coordinate(t, 2, 3);
+      if (i0 < static_cast<IType>(extent[0]) &&
+          i1 < static_cast<IType>(extent[1]) &&
+          i2 < static_cast<IType>(extent[2])) {
+        func(i0 + offset[0], i1 + offset[1], i2 + offset[2]);
+      }
+    }
+  }
+
+  template <typename ValType, typename Func, typename Offset, typename Extent>
+  static void apply(ValType& value, Func const& func, Offset const& offset,
+                    Extent const& extent) {
+    IType box = 1;
+    while (box < static_cast<IType>(extent[0]) ||
+           box < static_cast<IType>(extent[1]) ||
+           box < static_cast<IType>(extent[2]))
+      box <<= 1;
+    for (IType t = 0; t < box * box * box; ++t) {
+      const IType i0 = morton_coordinate(t, 0, 3);
+      const IType i1 = morton_coordinate(t, 1, 3);
+      const IType i2 = morton_coordinate(t, 2, 3);
+      if (i0 < static_cast<IType>(extent[0]) &&
+          i1 < static_cast<IType>(extent[1]) &&
+          i2 < static_cast<IType>(extent[2])) {
+        func(i0 + offset[0], i1 + offset[1], i2 + offset[2], value);
+      }
+    }
+  }
+};
+
+// tagged versions
+
+template <typename IType, typename Tagged>
+struct Morton_Tile_Loop<
+    2, IType, Tagged,
+    typename std::enable_if<!std::is_same<Tagged, void>::value>::type> {
+  template <typename Func, typename Offset, typename Extent>
+  static void apply(Func const& func, Offset const& offset,
+                    Extent const& extent) {
+    IType box = 1;
+    while (box < static_cast<IType>(extent[0]) ||
+           box < static_cast<IType>(extent[1]))
+      box <<= 1;
+    for (IType t = 0; t < box * box; ++t) {
+      const IType i0 = morton_coordinate(t, 0, 2);
+      const IType i1 = morton_coordinate(t, 1, 2);
+      if (i0 < static_cast<IType>(extent[0]) &&
+          i1 < static_cast<IType>(extent[1])) {
+        func(Tagged(), i0 + offset[0], i1 + offset[1]);
+      }
+    }
+  }
+
+  template <typename ValType, typename Func, typename Offset, typename Extent>
+  static void apply(ValType& value, Func const& func, Offset const& offset,
+                    Extent const& extent) {
+    IType box = 1;
+    while (box < static_cast<IType>(extent[0]) ||
+           box < static_cast<IType>(extent[1]))
+      box <<= 1;
+    for (IType t = 0; t < box * box; ++t) {
+      const IType i0 = morton_coordinate(t, 0, 2);
+      const IType i1 = morton_coordinate(t, 1, 2);
+      if (i0 < static_cast<IType>(extent[0]) &&
+          i1 < static_cast<IType>(extent[1])) {
+        func(Tagged(), i0 + offset[0], i1 + offset[1], value);
+      }
+    }
+  }
+};
+
+template <typename IType, typename Tagged>
+struct Morton_Tile_Loop<
+    3, IType, Tagged,
+    typename std::enable_if<!std::is_same<Tagged, void>::value>::type> {
+  template <typename Func, typename Offset, typename Extent>
+  static void apply(Func const& func, Offset const& offset,
+                    Extent const& extent) {
+    IType box = 1;
+    while (box < static_cast<IType>(extent[0]) ||
+           box < static_cast<IType>(extent[1]) ||
+           box < static_cast<IType>(extent[2]))
+      box <<= 1;
+    for (IType t = 0; t < box * box * box; ++t) {
+      const IType i0 = morton_coordinate(t, 0, 3);
+      const IType i1 = morton_coordinate(t, 1, 3);
+      const IType i2 = morton_coordinate(t, 2, 3);
+      if (i0 < static_cast<IType>(extent[0]) &&
+          i1 < static_cast<IType>(extent[1]) &&
+          i2 < static_cast<IType>(extent[2])) {
+        func(Tagged(), i0 + offset[0], i1 + offset[1], i2 + offset[2]);
+      }
+    }
+  }
+
+  template <typename ValType, typename Func, typename Offset, typename Extent>
+  static void apply(ValType& value, Func const& func, Offset const& offset,
+                    Extent const& extent) {
+    IType box = 1;
+    while (box < static_cast<IType>(extent[0]) ||
+           box < static_cast<IType>(extent[1]) ||
+           box < static_cast<IType>(extent[2]))
+      box <<= 1;
+    for (IType t = 0; t < box * box * box; ++t) {
+      const IType i0 = morton_coordinate(t, 0, 3);
+      const IType i1 = morton_coordinate(t, 1, 3);
+      const IType i2 = morton_coordinate(t, 2, 3);
+      if (i0 < static_cast<IType>(extent[0]) &&
+          i1 < static_cast<IType>(extent[1]) &&
+          i2 < static_cast<IType>(extent[2])) {
+        func(Tagged(), i0 + offset[0], i1 + offset[1], i2 + offset[2], value);
+      }
+    }
+  }
+};
 // end Structs for calling loops
 
 template <typename T>
@@ -1602,9 +1804,14 @@ struct HostIterateTile<
     // partial tile dims
     const bool full_tile = check_iteration_bounds(m_tiledims, m_offset);
 
-    Tile_Loop_Type<RP::rank, (RP::inner_direction == RP::Left), index_type,
-                   Tag>::apply(m_func, full_tile, m_offset, m_rp.m_tile,
-                               m_tiledims);
+    if (RP::inner_direction == RP::Morton) {
+      Morton_Tile_Loop<RP::rank, index_type, Tag>::apply(m_func, m_offset,
+                                                         m_tiledims);
+    } else {
+      Tile_Loop_Type<RP::rank, (RP::inner_direction == RP::Left), index_type,
+                     Tag>::apply(m_func, full_tile, m_offset, m_rp.m_tile,
+                                 m_tiledims);
+    }
   }
 
 #else
@@ -2023,9 +2230,14 @@ struct HostIterateTile<
     // partial tile dims
     const bool full_tile = check_iteration_bounds(m_tiledims, m_offset);
 
-    Tile_Loop_Type<RP::rank, (RP::inner_direction == RP::Left), index_type,
-                   Tag>::apply(m_v, m_func, full_tile, m_offset, m_rp.m_tile,
-                               m_tiledims);
+    if (RP::inner_direction == RP::Morton) {
+      Morton_Tile_Loop<RP::rank, index_type, Tag>::apply(m_v, m_func, m_offset,
+                                                         m_tiledims);
+    } else {
+      Tile_Loop_Type<RP::rank, (RP::inner_direction == RP::Left), index_type,
+                     Tag>::apply(m_v, m_func, full_tile, m_offset, m_rp.m_tile,
+                                 m_tiledims);
+    }
   }
 
 #else
@@ -2446,9 +2658,14 @@ struct HostIterateTile<
     // partial tile dims
     const bool full_tile = check_iteration_bounds(m_tiledims, m_offset);
 
-    Tile_Loop_Type<RP::rank, (RP::inner_direction == RP::Left), index_type,
-                   Tag>::apply(m_v, m_func, full_tile, m_offset, m_rp.m_tile,
-                               m_tiledims);
+    if (RP::inner_direction == RP::Morton) {
+      Morton_Tile_Loop<RP::rank, index_type, Tag>::apply(m_v, m_func, m_offset,
+                                                         m_tiledims);
+    } else {
+      Tile_Loop_Type<RP::rank, (RP::inner_direction == RP::Left), index_type,
+                     Tag>::apply(m_v, m_func, full_tile, m_offset, m_rp.m_tile,
+                                 m_tiledims);
+    }
   }
 
 #else
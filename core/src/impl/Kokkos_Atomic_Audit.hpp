@@ -0,0 +1,187 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+#ifndef KOKKOS_IMPL_KOKKOS_ATOMIC_AUDIT_HPP
+#define KOKKOS_IMPL_KOKKOS_ATOMIC_AUDIT_HPP
+
+#include <Kokkos_Macros.hpp>
+#if defined(KOKKOS_ATOMIC_HPP)
+
+#include <iosfwd>
+#include <ostream>
+#include <type_traits>
+
+//----------------------------------------------------------------------------
+// Compile-time audit of which implementation the atomic operations on a
+// type resolve to, so that hot data structures can be restructured before
+// deploying on hardware where they would fall back to a CAS loop or the
+// address-hashed lock array.  The classification mirrors the dispatch in
+// impl/Kokkos_Atomic_Fetch_Add.hpp and impl/Kokkos_Atomic_Generic.hpp;
+// when a device backend is enabled the device implementation is
+// reported, since that is where the fallbacks hurt.
+
+namespace Kokkos {
+namespace Experimental {
+
+enum class AtomicImplementation {
+  native,                 // a single hardware atomic instruction or builtin
+  compare_exchange_loop,  // a retry loop over a same-size hardware CAS
+  lock_array              // spinlock from the address-hashed lock array
+};
+
+inline const char* atomic_implementation_name(AtomicImplementation kind) {
+  switch (kind) {
+    case AtomicImplementation::native: return "native";
+    case AtomicImplementation::compare_exchange_loop:
+      return "compare-exchange loop";
+    case AtomicImplementation::lock_array: return "lock array";
+  }
+  return "unknown";
+}
+
+/// \brief implementation used by atomic_fetch_add / atomic_fetch_sub and
+/// the other arithmetic read-modify-write atomics on T
+template <class T>
+constexpr AtomicImplementation atomic_arithmetic_implementation() {
+#if defined(KOKKOS_ENABLE_SERIAL_ATOMICS)
+  // no concurrency: plain loads and stores
+  return AtomicImplementation::native;
+#elif defined(KOKKOS_ENABLE_ROCM_ATOMICS)
+  return ((std::is_integral<T>::value &&
+           (sizeof(T) == 4 || sizeof(T) == 8)) ||
+          std::is_same<T, float>::value)
+             ? AtomicImplementation::native
+             : (sizeof(T) == 4 || sizeof(T) == 8)
+                   ? AtomicImplementation::compare_exchange_loop
+                   : AtomicImplementation::lock_array;
+#elif defined(KOKKOS_ENABLE_CUDA)
+  // reports the device implementation, per the build's CUDA architecture
+  return (std::is_same<T, int>::value ||
+          std::is_same<T, unsigned int>::value ||
+          std::is_same<T, unsigned long long int>::value ||
+          std::is_same<T, float>::value
+#if defined(KOKKOS_ARCH_PASCAL60) || defined(KOKKOS_ARCH_PASCAL61) || \
+    defined(KOKKOS_ARCH_VOLTA70) || defined(KOKKOS_ARCH_VOLTA72) ||   \
+    defined(KOKKOS_ARCH_TURING75)
+          || std::is_same<T, double>::value
+#endif
+          )
+             ? AtomicImplementation::native
+             : (sizeof(T) == 4 || sizeof(T) == 8)
+                   ? AtomicImplementation::compare_exchange_loop
+                   : AtomicImplementation::lock_array;
+#elif defined(KOKKOS_ENABLE_GNU_ATOMICS) || defined(KOKKOS_ENABLE_INTEL_ATOMICS)
+  return (std::is_same<T, int>::value || std::is_same<T, long int>::value ||
+          std::is_same<T, unsigned int>::value ||
+          std::is_same<T, unsigned long int>::value)
+             ? AtomicImplementation::native
+             : (sizeof(T) == 4 || sizeof(T) == 8
+#if defined(KOKKOS_ENABLE_ASM) && defined(KOKKOS_ENABLE_ISA_X86_64)
+                || sizeof(T) == 16
+#endif
+                )
+                   ? AtomicImplementation::compare_exchange_loop
+                   : AtomicImplementation::lock_array;
+#elif defined(KOKKOS_ENABLE_OPENMP_ATOMICS)
+  // '#pragma omp atomic' covers any type the compiler can update natively;
+  // non-arithmetic types go through the generic paths
+  return std::is_arithmetic<T>::value
+             ? AtomicImplementation::native
+             : (sizeof(T) == 4 || sizeof(T) == 8)
+                   ? AtomicImplementation::compare_exchange_loop
+                   : AtomicImplementation::lock_array;
+#else
+  return AtomicImplementation::lock_array;
+#endif
+}
+
+/// \brief implementation used by the generic operations without a
+/// dedicated overload set (atomic_fetch_min/max/mul, atomic_oper_fetch)
+template <class T>
+constexpr AtomicImplementation atomic_generic_implementation() {
+#if defined(KOKKOS_ENABLE_SERIAL_ATOMICS)
+  return AtomicImplementation::native;
+#else
+  return (sizeof(T) == 4 || sizeof(T) == 8
+#if defined(KOKKOS_ENABLE_ASM) && defined(KOKKOS_ENABLE_ISA_X86_64) && \
+    !defined(KOKKOS_ENABLE_CUDA) && !defined(KOKKOS_ENABLE_ROCM)
+          || sizeof(T) == 16
+#endif
+          )
+             ? AtomicImplementation::compare_exchange_loop
+             : AtomicImplementation::lock_array;
+#endif
+}
+
+/// \brief print, for the common scalar types, which implementation the
+/// atomics of this build resolve to
+inline void atomic_implementation_report(std::ostream& s) {
+  s << "Kokkos atomic implementations"
+#if defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_ROCM)
+    << " (device)"
+#endif
+    << ":\n";
+#define KOKKOS_IMPL_ATOMIC_AUDIT_LINE(TYPE)                                  \
+  s << "  " #TYPE ": arithmetic = "                                          \
+    << atomic_implementation_name(atomic_arithmetic_implementation<TYPE>())  \
+    << ", generic = "                                                        \
+    << atomic_implementation_name(atomic_generic_implementation<TYPE>())     \
+    << "\n"
+  KOKKOS_IMPL_ATOMIC_AUDIT_LINE(int);
+  KOKKOS_IMPL_ATOMIC_AUDIT_LINE(unsigned int);
+  KOKKOS_IMPL_ATOMIC_AUDIT_LINE(long int);
+  KOKKOS_IMPL_ATOMIC_AUDIT_LINE(unsigned long int);
+  KOKKOS_IMPL_ATOMIC_AUDIT_LINE(long long int);
+  KOKKOS_IMPL_ATOMIC_AUDIT_LINE(float);
+  KOKKOS_IMPL_ATOMIC_AUDIT_LINE(double);
+  KOKKOS_IMPL_ATOMIC_AUDIT_LINE(long double);
+#undef KOKKOS_IMPL_ATOMIC_AUDIT_LINE
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // defined(KOKKOS_ATOMIC_HPP)
+#endif  // KOKKOS_IMPL_KOKKOS_ATOMIC_AUDIT_HPP
@@ -396,5 +396,16 @@ KOKKOS_INLINE_FUNCTION void atomic_add(volatile T* const dest, const T src) {
   atomic_fetch_add(dest, src);
 }
 
+// Warp-aggregated fetch-add for heavily contended counters.  On host
+// architectures, where contended atomics do not serialize a warp, this
+// is the plain atomic; the aggregating Cuda definition lives with the
+// warp primitives in Cuda/Kokkos_Cuda_Vectorization.hpp.
+#if !defined(__CUDA_ARCH__)
+template <typename T>
+inline T atomic_fetch_add_aggregated(volatile T* const dest, const T val) {
+  return atomic_fetch_add(dest, val);
+}
+#endif
+
 }  // namespace Kokkos
 #endif
@@ -115,6 +115,30 @@ constexpr memory_order_acq_rel_t memory_order_acq_rel = {};
 
 // Intentionally omit consume (for now)
 
+/** Strongly-typed memory scopes for scoped atomic operations.
+ *
+ * The scope names the set of threads with respect to which an atomic
+ * operation must be ordered.  On host architectures every atomic is
+ * performed at system scope regardless of the tag; the tag is a hint
+ * that permits narrower (cheaper) synchronization on devices whose
+ * instruction sets have scoped atomics.
+ */
+
+struct memory_scope_system_t {
+  using memory_scope = memory_scope_system_t;
+};
+constexpr memory_scope_system_t memory_scope_system = {};
+
+struct memory_scope_device_t {
+  using memory_scope = memory_scope_device_t;
+};
+constexpr memory_scope_device_t memory_scope_device = {};
+
+struct memory_scope_core_t {
+  using memory_scope = memory_scope_core_t;
+};
+constexpr memory_scope_core_t memory_scope_core = {};
+
 }  // end namespace Impl
 }  // end namespace Kokkos
 
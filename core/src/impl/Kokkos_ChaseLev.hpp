@@ -248,6 +248,35 @@ struct ChaseLevDeque {
     }
     return return_value;
   }
+
+  // Steal roughly half of the entries in this deque, returning the first
+  // stolen entry and moving the rest into the thief's deque so that the
+  // thief's subsequent pops are local instead of repeated single steals.
+  // Each entry is claimed with its own steal(); a single multi-entry
+  // compare-and-swap on m_top would race with the owner's pop path, which
+  // takes all but the last entry without touching m_top.
+  KOKKOS_INLINE_FUNCTION
+  OptionalRef<T> steal_half(ChaseLevDeque& thief) {
+    auto return_value = steal();
+    if (return_value) {
+      // Half of what remains after the entry being returned; relaxed
+      // loads, so this is just an estimate
+      auto batch = (m_bottom - m_top) / 2;
+      while (batch > 0) {
+        // Only steal while the thief has room: a stolen entry could not
+        // be handed back, since only the owner may push to this deque.
+        // The thief is the owner of its own deque, so its bottom cannot
+        // move under us, and concurrent steals only create more room.
+        auto thief_t = Impl::atomic_load(&thief.m_top, memory_order_acquire);
+        if (thief.m_bottom - thief_t > thief.m_array.size() - 2) break;
+        auto extra = steal();
+        if (not extra) break;
+        thief.push(*extra);  // can't fail; room was checked above
+        --batch;
+      }
+    }
+    return return_value;
+  }
 };
 
 /*
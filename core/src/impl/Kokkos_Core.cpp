@@ -44,6 +44,9 @@
 
 #include <Kokkos_Core.hpp>
 #include <impl/Kokkos_Error.hpp>
+#include <impl/Kokkos_FenceTelemetry.hpp>
+#include <impl/Kokkos_HostBarrier.hpp>
+#include <chrono>
 #include <cctype>
 #include <cstring>
 #include <iostream>
@@ -51,6 +54,7 @@
 #include <cstdlib>
 #include <stack>
 #include <cerrno>
+#include <mutex>
 #include <unistd.h>
 
 //----------------------------------------------------------------------------
@@ -59,6 +63,10 @@ namespace {
 bool g_is_initialized = false;
 bool g_show_warnings  = true;
 std::stack<std::function<void()> > finalize_hooks;
+// Deferred device backend bring-up, see InitArguments::defer_device_init
+Kokkos::InitArguments g_deferred_device_args;
+bool g_device_init_deferred = false;
+std::mutex g_device_init_mutex;
 }  // namespace
 
 namespace Kokkos {
@@ -74,26 +82,8 @@ bool is_unsigned_int(const char* str) {
   }
   return true;
 }
-void initialize_internal(const InitArguments& args) {
-// This is an experimental setting
-// For KNL in Flat mode this variable should be set, so that
-// memkind allocates high bandwidth memory correctly.
-#ifdef KOKKOS_ENABLE_HBWSPACE
-  setenv("MEMKIND_HBW_NODES", "1", 0);
-#endif
-
-  if (args.disable_warnings) {
-    g_show_warnings = false;
-  }
-
-  // Protect declarations, to prevent "unused variable" warnings.
-#if defined(KOKKOS_ENABLE_OPENMP) || defined(KOKKOS_ENABLE_THREADS) || \
-    defined(KOKKOS_ENABLE_OPENMPTARGET) || defined(KOKKOS_ENABLE_HPX)
-  const int num_threads = args.num_threads;
-#endif
-#if defined(KOKKOS_ENABLE_THREADS) || defined(KOKKOS_ENABLE_OPENMPTARGET)
-  const int use_numa = args.num_numa;
-#endif
+void initialize_device_internal(const InitArguments& args) {
+  (void)args;
 #if defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_ROCM)
   int use_gpu           = args.device_id;
   const int ndevices    = args.ndevices;
@@ -119,6 +109,76 @@ void initialize_internal(const InitArguments& args) {
   }
 #endif  // defined( KOKKOS_ENABLE_CUDA )
 
+#if defined(KOKKOS_ENABLE_CUDA)
+  if (std::is_same<Kokkos::Cuda, Kokkos::DefaultExecutionSpace>::value ||
+      0 < use_gpu) {
+    if (use_gpu > -1) {
+#ifdef KOKKOS_ENABLE_DEPRECATED_CODE
+      Kokkos::Cuda::initialize(Kokkos::Cuda::SelectDevice(use_gpu));
+#else
+      Kokkos::Cuda::impl_initialize(Kokkos::Cuda::SelectDevice(use_gpu));
+#endif
+    } else {
+#ifdef KOKKOS_ENABLE_DEPRECATED_CODE
+      Kokkos::Cuda::initialize();
+#else
+      Kokkos::Cuda::impl_initialize();
+#endif
+    }
+    // std::cout << "Kokkos::initialize() fyi: Cuda enabled and initialized" <<
+    // std::endl ;
+  }
+#endif
+
+#if defined(KOKKOS_ENABLE_ROCM)
+  if (std::is_same<Kokkos::Experimental::ROCm,
+                   Kokkos::DefaultExecutionSpace>::value ||
+      0 < use_gpu) {
+    if (use_gpu > -1) {
+      Kokkos::Experimental::ROCm::initialize(
+          Kokkos::Experimental::ROCm::SelectDevice(use_gpu));
+    } else {
+      Kokkos::Experimental::ROCm::initialize();
+    }
+    std::cout << "Kokkos::initialize() fyi: ROCm enabled and initialized"
+              << std::endl;
+  }
+#endif
+}
+
+void initialize_internal(const InitArguments& args) {
+// This is an experimental setting
+// For KNL in Flat mode this variable should be set, so that
+// memkind allocates high bandwidth memory correctly.
+#ifdef KOKKOS_ENABLE_HBWSPACE
+  setenv("MEMKIND_HBW_NODES", "1", 0);
+#endif
+
+  if (args.disable_warnings) {
+    g_show_warnings = false;
+  }
+
+// Load the profiling tool library before any backend initializes so that
+// tools observe the backends' internal startup allocations.
+#if defined(KOKKOS_ENABLE_PROFILING)
+  Kokkos::Profiling::initialize();
+#else
+  if (getenv("KOKKOS_PROFILE_LIBRARY") != nullptr) {
+    std::cerr << "Kokkos::initialize() warning: Requested Kokkos Profiling, "
+                 "but Kokkos was built without Profiling support"
+              << std::endl;
+  }
+#endif
+
+  // Protect declarations, to prevent "unused variable" warnings.
+#if defined(KOKKOS_ENABLE_OPENMP) || defined(KOKKOS_ENABLE_THREADS) || \
+    defined(KOKKOS_ENABLE_OPENMPTARGET) || defined(KOKKOS_ENABLE_HPX)
+  const int num_threads = args.num_threads;
+#endif
+#if defined(KOKKOS_ENABLE_THREADS) || defined(KOKKOS_ENABLE_OPENMPTARGET)
+  const int use_numa = args.num_numa;
+#endif
+
 #if defined(KOKKOS_ENABLE_OPENMP)
   if (std::is_same<Kokkos::OpenMP, Kokkos::DefaultExecutionSpace>::value ||
       std::is_same<Kokkos::OpenMP, Kokkos::HostSpace::execution_space>::value) {
@@ -218,55 +278,29 @@ void initialize_internal(const InitArguments& args) {
   }
 #endif
 
-#if defined(KOKKOS_ENABLE_CUDA)
-  if (std::is_same<Kokkos::Cuda, Kokkos::DefaultExecutionSpace>::value ||
-      0 < use_gpu) {
-    if (use_gpu > -1) {
-#ifdef KOKKOS_ENABLE_DEPRECATED_CODE
-      Kokkos::Cuda::initialize(Kokkos::Cuda::SelectDevice(use_gpu));
-#else
-      Kokkos::Cuda::impl_initialize(Kokkos::Cuda::SelectDevice(use_gpu));
-#endif
-    } else {
-#ifdef KOKKOS_ENABLE_DEPRECATED_CODE
-      Kokkos::Cuda::initialize();
-#else
-      Kokkos::Cuda::impl_initialize();
-#endif
+  bool defer_device_init = args.defer_device_init;
+  char* env_defer_str    = std::getenv("KOKKOS_DEFER_DEVICE_INIT");
+  if (env_defer_str != nullptr) {
+    std::string env_str(env_defer_str);  // deep-copies string
+    for (char& c : env_str) {
+      c = toupper(c);
     }
-    // std::cout << "Kokkos::initialize() fyi: Cuda enabled and initialized" <<
-    // std::endl ;
+    if ((env_str == "TRUE") || (env_str == "ON") || (env_str == "1"))
+      defer_device_init = true;
   }
-#endif
-
-#if defined(KOKKOS_ENABLE_ROCM)
-  if (std::is_same<Kokkos::Experimental::ROCm,
-                   Kokkos::DefaultExecutionSpace>::value ||
-      0 < use_gpu) {
-    if (use_gpu > -1) {
-      Kokkos::Experimental::ROCm::initialize(
-          Kokkos::Experimental::ROCm::SelectDevice(use_gpu));
-    } else {
-      Kokkos::Experimental::ROCm::initialize();
-    }
-    std::cout << "Kokkos::initialize() fyi: ROCm enabled and initialized"
-              << std::endl;
+  if (defer_device_init) {
+    g_deferred_device_args = args;
+    g_device_init_deferred = true;
+  } else {
+    initialize_device_internal(args);
   }
-#endif
 
-#if defined(KOKKOS_ENABLE_PROFILING)
-  Kokkos::Profiling::initialize();
-#else
-  if (getenv("KOKKOS_PROFILE_LIBRARY") != nullptr) {
-    std::cerr << "Kokkos::initialize() warning: Requested Kokkos Profiling, "
-                 "but Kokkos was built without Profiling support"
-              << std::endl;
-  }
-#endif
   g_is_initialized = true;
 }
 
 void finalize_internal(const bool all_spaces = false) {
+  g_device_init_deferred = false;
+
   typename decltype(finalize_hooks)::size_type numSuccessfulCalls = 0;
   while (!finalize_hooks.empty()) {
     auto f = finalize_hooks.top();
@@ -298,6 +332,10 @@ void finalize_internal(const bool all_spaces = false) {
   Kokkos::Profiling::finalize();
 #endif
 
+  // Nonempty only when an AllocationAudit guard caught the runtime
+  // allocating inside a dispatch; see Kokkos_AllocationAudit.hpp.
+  Kokkos::Experimental::allocation_audit_report();
+
 #if defined(KOKKOS_ENABLE_CUDA)
   if (std::is_same<Kokkos::Cuda, Kokkos::DefaultExecutionSpace>::value ||
       all_spaces) {
@@ -456,6 +494,16 @@ bool check_int_arg(char const* arg, char const* expected, int* value) {
 
 }  // namespace
 
+void ensure_device_backends_initialized() {
+  if (!g_device_init_deferred) return;
+  std::lock_guard<std::mutex> lock(g_device_init_mutex);
+  if (!g_device_init_deferred) return;
+  // Clear the flag before the bring-up: backend initialization re-enters
+  // this function through the space singletons.
+  g_device_init_deferred = false;
+  initialize_device_internal(g_deferred_device_args);
+}
+
 }  // namespace Impl
 }  // namespace Kokkos
 
@@ -819,6 +867,50 @@ void initialize(const InitArguments& arguments) {
   Impl::initialize_internal(arguments);
 }
 
+namespace Experimental {
+void prewarm_backends() { Kokkos::Impl::ensure_device_backends_initialized(); }
+
+void trim_scratch_memory() {
+  // Retired scratch buffers may still be read by in-flight kernels.
+  Kokkos::fence();
+
+#if defined(KOKKOS_ENABLE_CUDA)
+#ifdef KOKKOS_ENABLE_DEPRECATED_CODE
+  if (Kokkos::Cuda::is_initialized())
+#else
+  if (Kokkos::Cuda::impl_is_initialized())
+#endif
+    Kokkos::Impl::CudaInternal::singleton().scratch_trim();
+#endif
+
+#if defined(KOKKOS_ENABLE_OPENMP)
+  // Only the master thread carries an instance; clear_thread_data
+  // already fans out across the pool.
+  if (Kokkos::Impl::t_openmp_instance)
+    Kokkos::Impl::t_openmp_instance->clear_thread_data();
+#endif
+
+#if defined(KOKKOS_ENABLE_THREADS)
+#ifdef KOKKOS_ENABLE_DEPRECATED_CODE
+  if (Kokkos::Threads::is_initialized())
+#else
+  if (Kokkos::Threads::impl_is_initialized())
+#endif
+    Kokkos::Impl::ThreadsExec::resize_scratch(0, 0);
+#endif
+
+#if defined(KOKKOS_ENABLE_SERIAL)
+  Kokkos::Impl::serial_trim_thread_team_data();
+#endif
+}
+
+void set_host_wait_mode(HostWaitMode mode) {
+  Kokkos::Impl::HostBarrier::set_wait_hint(
+      HostWaitMode::Burst == mode ? 1 : HostWaitMode::IdleSoon == mode ? -1
+                                                                       : 0);
+}
+}  // namespace Experimental
+
 void push_finalize_hook(std::function<void()> f) { finalize_hooks.push(f); }
 
 void finalize() { Impl::finalize_internal(); }
@@ -828,7 +920,25 @@ void finalize_all() {
   Impl::finalize_internal(all_spaces);
 }
 
-void fence() { Impl::fence_internal(); }
+#if defined(__GNUC__) || defined(__clang__)
+#define KOKKOS_IMPL_FENCE_RETURN_ADDRESS __builtin_return_address(0)
+#else
+#define KOKKOS_IMPL_FENCE_RETURN_ADDRESS nullptr
+#endif
+
+void fence() {
+  if (Kokkos::Profiling::fenceTelemetryEnabled()) {
+    const void* site = KOKKOS_IMPL_FENCE_RETURN_ADDRESS;
+    const std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+    Impl::fence_internal();
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    Kokkos::Profiling::recordFence(site, elapsed.count());
+    return;
+  }
+  Impl::fence_internal();
+}
 
 void print_configuration(std::ostream& out, const bool detail) {
   std::ostringstream msg;
@@ -0,0 +1,181 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <impl/Kokkos_FenceTelemetry.hpp>
+
+#if defined(KOKKOS_ENABLE_PROFILING)
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#ifndef _WIN32
+#include <dlfcn.h>
+#endif
+
+namespace Kokkos {
+namespace Profiling {
+
+namespace {
+
+// Fences shorter than this had nothing to wait for on a host backend.
+constexpr double idle_threshold_seconds = 1.0e-6;
+
+struct FenceSiteStats {
+  uint64_t count      = 0;
+  uint64_t idle_count = 0;
+  double total_s      = 0.0;
+  double max_s        = 0.0;
+};
+
+struct FenceTelemetryState {
+  bool enabled = false;
+  std::mutex mutex;
+  std::map<const void*, FenceSiteStats> sites;
+};
+
+FenceTelemetryState& state() {
+  static FenceTelemetryState s;
+  return s;
+}
+
+void print_site_name(const void* site) {
+#ifndef _WIN32
+  Dl_info info;
+  if (dladdr(site, &info) && info.dli_sname) {
+    fprintf(stderr, "%s+0x%lx", info.dli_sname,
+            static_cast<unsigned long>(static_cast<const char*>(site) -
+                                       static_cast<const char*>(info.dli_saddr)));
+    return;
+  }
+#endif
+  fprintf(stderr, "%p", site);
+}
+
+}  // namespace
+
+bool fenceTelemetryEnabled() { return state().enabled; }
+
+void initializeFenceTelemetry() {
+  char const* env = getenv("KOKKOS_PROFILE_FENCES");
+  state().enabled = (env != nullptr && atoi(env) != 0);
+}
+
+void recordFence(const void* site, double seconds) {
+  FenceTelemetryState& s = state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  FenceSiteStats& stats = s.sites[site];
+  ++stats.count;
+  if (seconds < idle_threshold_seconds) ++stats.idle_count;
+  stats.total_s += seconds;
+  if (seconds > stats.max_s) stats.max_s = seconds;
+}
+
+void finalizeFenceTelemetry() {
+  FenceTelemetryState& s = state();
+  if (!s.enabled) return;
+  s.enabled = false;
+
+  std::vector<std::pair<const void*, FenceSiteStats>> ranked;
+  {
+    std::lock_guard<std::mutex> lock(s.mutex);
+    ranked.assign(s.sites.begin(), s.sites.end());
+  }
+  if (ranked.empty()) return;
+
+  std::sort(ranked.begin(), ranked.end(),
+            [](const std::pair<const void*, FenceSiteStats>& a,
+               const std::pair<const void*, FenceSiteStats>& b) {
+              return a.second.total_s > b.second.total_s;
+            });
+
+  uint64_t total_count = 0;
+  double total_s       = 0.0;
+  for (auto& site : ranked) {
+    total_count += site.second.count;
+    total_s += site.second.total_s;
+  }
+
+  fprintf(stderr,
+          "\nKokkos fence telemetry: %llu fences at %zu sites, %.3f ms total "
+          "fenced wall time\n",
+          static_cast<unsigned long long>(total_count), ranked.size(),
+          total_s * 1.0e3);
+  fprintf(stderr,
+          "  %10s %12s %12s %6s  site (ranked by total fenced time)\n",
+          "count", "total(ms)", "max(us)", "idle%");
+  for (auto& site : ranked) {
+    const FenceSiteStats& st = site.second;
+    const double idle_pct    = 100.0 * double(st.idle_count) / double(st.count);
+    fprintf(stderr, "  %10llu %12.3f %12.2f %5.0f%%  ",
+            static_cast<unsigned long long>(st.count), st.total_s * 1.0e3,
+            st.max_s * 1.0e6, idle_pct);
+    print_site_name(site.first);
+    if (st.idle_count == st.count) {
+      fprintf(stderr, "  <- never had work to wait for; likely removable");
+    }
+    fprintf(stderr, "\n");
+  }
+}
+
+}  // namespace Profiling
+}  // namespace Kokkos
+
+#else
+
+namespace Kokkos {
+namespace Profiling {
+
+bool fenceTelemetryEnabled() { return false; }
+void initializeFenceTelemetry() {}
+void finalizeFenceTelemetry() {}
+void recordFence(const void*, double) {}
+
+}  // namespace Profiling
+}  // namespace Kokkos
+
+#endif
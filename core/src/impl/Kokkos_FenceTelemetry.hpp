@@ -0,0 +1,85 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+#ifndef KOKKOSP_FENCE_TELEMETRY_HPP
+#define KOKKOSP_FENCE_TELEMETRY_HPP
+
+#include <Kokkos_Macros.hpp>
+
+#include <cstdint>
+
+namespace Kokkos {
+namespace Profiling {
+
+/** Fence site telemetry and redundant-fence advisor.
+ *
+ *  When enabled with KOKKOS_PROFILE_FENCES=1 in the environment, every
+ *  global Kokkos::fence() records its call site (the caller's return
+ *  address), the wall time spent inside the fence, and whether there
+ *  was anything to wait for.  On host backends a fence that returns in
+ *  under a microsecond had no outstanding work, which is the portable
+ *  proxy for "device already idle"; an asynchronous backend can query
+ *  its queue instead when it adopts the hook.
+ *
+ *  Profiling::finalize() writes a report to stderr ranking sites by
+ *  total fenced wall time, with per-site call counts and the fraction
+ *  of calls that found the backend idle.  Sites whose fences always
+ *  found nothing to wait for are flagged as candidates for removal.
+ *  Call sites are resolved through dladdr where possible, so the report
+ *  names the enclosing function of each fence.
+ */
+
+bool fenceTelemetryEnabled();
+
+void initializeFenceTelemetry();
+void finalizeFenceTelemetry();
+
+//! Record one completed global fence that took the given wall time.
+void recordFence(const void* site, double seconds);
+
+}  // namespace Profiling
+}  // namespace Kokkos
+
+#endif
@@ -46,7 +46,9 @@
 #define KOKKOS_FUNCTORADAPTER_HPP
 
 #include <cstddef>
+#include <cstring>
 #include <Kokkos_Core_fwd.hpp>
+#include <Kokkos_Atomic.hpp>
 #include <impl/Kokkos_Traits.hpp>
 #include <impl/Kokkos_Tags.hpp>
 
@@ -1365,8 +1367,15 @@ template <class FunctorType, class ArgTag, class T, class Enable>
 struct FunctorValueInit<FunctorType, ArgTag, T*, Enable> {
   KOKKOS_FORCEINLINE_FUNCTION static T* init(const FunctorType& f, void* p) {
     const int n = FunctorValueTraits<FunctorType, ArgTag>::value_count(f);
-    for (int i = 0; i < n; ++i) {
-      new (((T*)p) + i) T();
+    if (std::is_trivial<T>::value) {
+      // Value-initializing a trivial element type is a zero fill;
+      // spell that out so a wide identity costs one memset rather
+      // than n constructor calls.
+      memset(p, 0, n * sizeof(T));
+    } else {
+      for (int i = 0; i < n; ++i) {
+        new (((T*)p) + i) T();
+      }
     }
     return (T*)p;
   }
@@ -1549,24 +1558,46 @@ struct FunctorValueJoin<FunctorType, ArgTag, T*, Enable> {
                                                const volatile void* const rhs) {
     const int n = FunctorValueTraits<FunctorType, ArgTag>::value_count(f_);
 
+#if !defined(__CUDA_ARCH__) && !defined(__HIP_DEVICE_COMPILE__)
+    // Host-side joins are ordered by the barrier or lock protocol of
+    // the calling backend; the per-element volatile accesses only
+    // serve to serialize the loop.  Fence, join through restrict
+    // pointers so the element loop vectorizes, fence again.
+    T* const KOKKOS_RESTRICT dst       = (T*)lhs;
+    T const* const KOKKOS_RESTRICT src = (T const*)rhs;
+    Kokkos::memory_fence();
+    for (int i = 0; i < n; ++i) dst[i] += src[i];
+    Kokkos::memory_fence();
+#else
     for (int i = 0; i < n; ++i) {
       ((volatile T*)lhs)[i] += ((const volatile T*)rhs)[i];
     }
+#endif
   }
   KOKKOS_FORCEINLINE_FUNCTION
   void operator()(volatile T* const lhs, const volatile T* const rhs) const {
     const int n = FunctorValueTraits<FunctorType, ArgTag>::value_count(f);
 
+#if !defined(__CUDA_ARCH__) && !defined(__HIP_DEVICE_COMPILE__)
+    T* const KOKKOS_RESTRICT dst       = (T*)lhs;
+    T const* const KOKKOS_RESTRICT src = (T const*)rhs;
+    Kokkos::memory_fence();
+    for (int i = 0; i < n; ++i) dst[i] += src[i];
+    Kokkos::memory_fence();
+#else
     for (int i = 0; i < n; ++i) {
       lhs[i] += rhs[i];
     }
+#endif
   }
   KOKKOS_FORCEINLINE_FUNCTION
   void operator()(T* lhs, const T* rhs) const {
     const int n = FunctorValueTraits<FunctorType, ArgTag>::value_count(f);
 
+    T* const KOKKOS_RESTRICT dst       = lhs;
+    T const* const KOKKOS_RESTRICT src = rhs;
     for (int i = 0; i < n; ++i) {
-      lhs[i] += rhs[i];
+      dst[i] += src[i];
     }
   }
 };
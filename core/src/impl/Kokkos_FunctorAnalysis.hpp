@@ -47,6 +47,7 @@
 
 #include <cstddef>
 #include <Kokkos_Core_fwd.hpp>
+#include <Kokkos_Atomic.hpp>
 #include <impl/Kokkos_Traits.hpp>
 #include <impl/Kokkos_Tags.hpp>
 
@@ -485,7 +486,18 @@ struct FunctorAnalysis {
                                             ValueType volatile* dst,
                                             ValueType volatile const* src) {
       const int n = FunctorAnalysis::value_count(*f);
+#if !defined(__CUDA_ARCH__) && !defined(__HIP_DEVICE_COMPILE__)
+      // As in FunctorValueJoin: host joins are ordered by the calling
+      // backend's barrier protocol, so join through restrict pointers
+      // bracketed by fences and let the element loop vectorize.
+      ValueType* const KOKKOS_RESTRICT d       = (ValueType*)dst;
+      ValueType const* const KOKKOS_RESTRICT s = (ValueType const*)src;
+      Kokkos::memory_fence();
+      for (int i = 0; i < n; ++i) d[i] += s[i];
+      Kokkos::memory_fence();
+#else
       for (int i = 0; i < n; ++i) dst[i] += src[i];
+#endif
     }
   };
 
@@ -57,9 +57,16 @@
 #include <Kokkos_HBWSpace.hpp>
 #include <impl/Kokkos_Error.hpp>
 #include <impl/Kokkos_MemorySpace.hpp>
+#include <Kokkos_MemoryAccounting.hpp>
 #include <Kokkos_Atomic.hpp>
 #ifdef KOKKOS_ENABLE_HBWSPACE
 #include <memkind.h>
+#include <numaif.h>
+#include <unistd.h>
+
+#include <map>
+#include <mutex>
+#include <vector>
 #endif
 
 #if defined(KOKKOS_ENABLE_PROFILING)
@@ -110,7 +117,14 @@ void *HBWSpace::allocate(const size_t arg_alloc_size) const {
       // Over-allocate to and round up to guarantee proper alignment.
       size_t size_padded = arg_alloc_size + sizeof(void *) + alignment;
 
-      void *alloc_ptr = memkind_malloc(MEMKIND_TYPE, size_padded);
+      void *alloc_ptr = memkind_malloc(
+          m_huge_pages ? MEMKIND_HBW_HUGETLB : MEMKIND_TYPE, size_padded);
+
+      // Huge pages are only available if the system reserved a hugetlb
+      // pool; fall back gracefully to regular high-bandwidth pages.
+      if (0 == alloc_ptr && m_huge_pages) {
+        alloc_ptr = memkind_malloc(MEMKIND_TYPE, size_padded);
+      }
 
       if (alloc_ptr) {
         uintptr_t address = reinterpret_cast<uintptr_t>(alloc_ptr);
@@ -156,12 +170,26 @@ void HBWSpace::deallocate(void *const arg_alloc_ptr,
   if (arg_alloc_ptr) {
     if (m_alloc_mech == STD_MALLOC) {
       void *alloc_ptr = *(reinterpret_cast<void **>(arg_alloc_ptr) - 1);
-      memkind_free(MEMKIND_TYPE, alloc_ptr);
+      // A huge page request may have fallen back to regular pages, so
+      // let memkind detect the kind (kind == NULL) in that case.
+      memkind_free(m_huge_pages ? 0 : MEMKIND_TYPE, alloc_ptr);
     }
   }
 }
 
 }  // namespace Experimental
+
+namespace Impl {
+
+Kokkos::Experimental::HBWSpace with_huge_pages(
+    const Kokkos::Experimental::HBWSpace &arg_space) {
+  Kokkos::Experimental::HBWSpace space = arg_space;
+  space.m_huge_pages                   = true;
+  return space;
+}
+
+}  // namespace Impl
+
 }  // namespace Kokkos
 
 //----------------------------------------------------------------------------
@@ -190,6 +218,8 @@ SharedAllocationRecord<Kokkos::Experimental::HBWSpace,
   }
 #endif
 
+  Kokkos::Impl::account_deallocation(m_space.name(), data(), size());
+
   m_space.deallocate(SharedAllocationRecord<void, void>::m_alloc_ptr,
                      SharedAllocationRecord<void, void>::m_alloc_size);
 }
@@ -218,6 +248,9 @@ SharedAllocationRecord<Kokkos::Experimental::HBWSpace, void>::
   }
 #endif
 
+  Kokkos::Impl::account_allocation(arg_space.name(), arg_label, data(),
+                                   arg_alloc_size);
+
   // Fill in the Header information
   RecordBase::m_alloc_ptr->m_record =
       static_cast<SharedAllocationRecord<void, void> *>(this);
@@ -344,6 +377,170 @@ void unlock_address_hbw_space(void *ptr) {
 }
 
 }  // namespace Impl
+}  // namespace Experimental
+}  // namespace Kokkos
+
+/*--------------------------------------------------------------------------*/
+
+namespace Kokkos {
+namespace Experimental {
+
+namespace {
+
+struct ManagedAllocation {
+  std::string label;
+  size_t bytes;
+  uint64_t accessed_bytes;
+  bool promoted;
+};
+
+struct ManagedState {
+  std::mutex mutex;
+  std::map<const void *, ManagedAllocation> tracked;
+  size_t promoted_bytes = 0;
+};
+
+ManagedState &managed_state() {
+  static ManagedState s;
+  return s;
+}
+
+/* The NUMA node backing memkind high-bandwidth allocations, discovered
+ * once by querying the kernel for the placement of a probe page.
+ * Returns a negative value when no high-bandwidth node is available.
+ */
+int hbw_numa_node() {
+  static int node = -2;
+  if (-2 == node) {
+    node        = -1;
+    void *probe = memkind_malloc(MEMKIND_TYPE, 4096);
+    if (probe) {
+      *static_cast<volatile char *>(probe) = 1;  // fault the page in
+      void *pages[1]                       = {probe};
+      int status                           = -1;
+      if (0 == move_pages(0, 1, pages, nullptr, &status, 0) && 0 <= status) {
+        node = status;
+      }
+      memkind_free(MEMKIND_TYPE, probe);
+    }
+  }
+  return node;
+}
+
+/* Move the whole pages of [ptr, ptr+bytes) to the given NUMA node.
+ * The partial first and last page are left in place: they may carry
+ * unrelated neighboring data.  Returns true when every page moved.
+ */
+bool move_allocation_pages(const void *ptr, const size_t bytes,
+                           const int node) {
+  const size_t page = sysconf(_SC_PAGESIZE);
+
+  uintptr_t begin = reinterpret_cast<uintptr_t>(ptr);
+  uintptr_t end   = begin + bytes;
+  begin           = (begin + page - 1) & ~(page - 1);
+  end             = end & ~(page - 1);
+  if (end <= begin) return false;
+
+  const size_t count = (end - begin) / page;
+
+  std::vector<void *> pages(count);
+  std::vector<int> nodes(count, node);
+  std::vector<int> status(count, 0);
+
+  for (size_t i = 0; i < count; ++i) {
+    pages[i] = reinterpret_cast<void *>(begin + i * page);
+  }
+
+  if (move_pages(0, count, pages.data(), nodes.data(), status.data(),
+                 MPOL_MF_MOVE)) {
+    return false;
+  }
+  for (size_t i = 0; i < count; ++i) {
+    if (status[i] != node) return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+void hbw_managed_track(const void *ptr, const size_t bytes,
+                       const std::string &label) {
+  if (nullptr == ptr || 0 == bytes) return;
+  ManagedState &s = managed_state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  s.tracked[ptr] = ManagedAllocation{label, bytes, 0, false};
+}
+
+void hbw_managed_untrack(const void *ptr) {
+  ManagedState &s = managed_state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  auto it = s.tracked.find(ptr);
+  if (it != s.tracked.end()) {
+    if (it->second.promoted) s.promoted_bytes -= it->second.bytes;
+    s.tracked.erase(it);
+  }
+}
+
+void hbw_managed_access(const void *ptr, const uint64_t bytes_touched) {
+  ManagedState &s = managed_state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  auto it = s.tracked.find(ptr);
+  if (it != s.tracked.end()) it->second.accessed_bytes += bytes_touched;
+}
+
+size_t hbw_managed_migrate(const size_t capacity_bytes) {
+  ManagedState &s = managed_state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+
+  const int node = hbw_numa_node();
+  if (node < 0) return 0;
+
+  // Hottest first; only allocations that saw traffic are candidates.
+  std::vector<ManagedAllocation *> candidates;
+  std::vector<const void *> candidate_ptrs;
+  for (auto &entry : s.tracked) {
+    if (!entry.second.promoted && 0 < entry.second.accessed_bytes) {
+      candidates.push_back(&entry.second);
+      candidate_ptrs.push_back(entry.first);
+    }
+  }
+  std::vector<size_t> order(candidates.size());
+  for (size_t i = 0; i < order.size(); ++i) order[i] = i;
+  std::sort(order.begin(), order.end(), [&](const size_t a, const size_t b) {
+    return candidates[a]->accessed_bytes > candidates[b]->accessed_bytes;
+  });
+
+  size_t budget = capacity_bytes > s.promoted_bytes
+                      ? capacity_bytes - s.promoted_bytes
+                      : 0;
+  size_t moved = 0;
+
+  for (size_t i = 0; i < order.size(); ++i) {
+    ManagedAllocation &alloc = *candidates[order[i]];
+    if (budget < alloc.bytes) continue;  // try the next, smaller-or-colder
+    if (move_allocation_pages(candidate_ptrs[order[i]], alloc.bytes, node)) {
+      alloc.promoted = true;
+      s.promoted_bytes += alloc.bytes;
+      budget -= alloc.bytes;
+      moved += alloc.bytes;
+    }
+  }
+
+  return moved;
+}
+
+void hbw_managed_reset() {
+  ManagedState &s = managed_state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  for (auto &entry : s.tracked) entry.second.accessed_bytes = 0;
+}
+
+size_t hbw_managed_promoted_bytes() {
+  ManagedState &s = managed_state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  return s.promoted_bytes;
+}
+
 }  // namespace Experimental
 }  // namespace Kokkos
 #endif
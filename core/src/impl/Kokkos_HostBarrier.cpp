@@ -49,6 +49,9 @@
 
 #include <impl/Kokkos_HostBarrier.hpp>
 
+#include <atomic>
+#include <chrono>
+
 #if !defined(_WIN32)
 #include <sched.h>
 #include <time.h>
@@ -58,9 +61,39 @@
 #include <windows.h>
 #endif
 
+namespace {
+
+// Adaptive backoff state shared by the host thread pools: how many
+// doublings of the spin count a waiter burns before its first sleep.
+// Learned with one-notch hysteresis from how long recent waits actually
+// lasted -- short waits mean a kernel burst, so trade sleeps back into
+// spins; long waits mean inter-kernel gaps, so sleep sooner and stop
+// burning cores.  HostBarrier::set_wait_hint overrides the learning.
+constexpr int log2_spin_budget_min = 0;
+constexpr int log2_spin_budget_max = 12;
+
+constexpr int64_t burst_wait_ns = 50 * 1000;    // waits shorter: spin longer
+constexpr int64_t idle_wait_ns  = 1000 * 1000;  // waits longer: sleep sooner
+
+std::atomic<int> g_log2_spin_budget{6};  // former log2_iterations_till_sleep
+std::atomic<int> g_wait_hint{0};
+
+inline int64_t wall_ns() noexcept {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+}  // namespace
+
 namespace Kokkos {
 namespace Impl {
 
+void HostBarrier::set_wait_hint(const int hint) noexcept {
+  g_wait_hint.store(hint < 0 ? -1 : hint > 0 ? 1 : 0,
+                    std::memory_order_relaxed);
+}
+
 void HostBarrier::impl_backoff_wait_until_equal(
     int* ptr, const int v, const bool active_wait) noexcept {
 #if !defined(_WIN32)
@@ -68,9 +101,16 @@ void HostBarrier::impl_backoff_wait_until_equal(
   req.tv_sec     = 0;
   unsigned count = 0u;
 
+  const int hint = g_wait_hint.load(std::memory_order_relaxed);
+  const int log2_spin_budget =
+      hint > 0 ? log2_spin_budget_max
+               : hint < 0 ? log2_spin_budget_min
+                          : g_log2_spin_budget.load(std::memory_order_relaxed);
+  const int64_t t_enter = wall_ns();
+
   while (!test_equal(ptr, v)) {
     const int c = ::Kokkos::log2(++count);
-    if (!active_wait || c > log2_iterations_till_sleep) {
+    if (!active_wait || c > log2_spin_budget) {
       req.tv_nsec = c < 16 ? 256 * c : 4096;
       nanosleep(&req, nullptr);
     } else if (c > log2_iterations_till_yield) {
@@ -91,6 +131,22 @@ void HostBarrier::impl_backoff_wait_until_equal(
 #endif
 #endif
   }
+
+  // One-notch hysteresis on the shared spin budget: a burst of short
+  // waits gradually converts sleeps back into spins, a long gap does the
+  // opposite.  Benign if two waiters race on the update.
+  if (0 == hint && active_wait) {
+    const int64_t waited = wall_ns() - t_enter;
+    if (waited < burst_wait_ns) {
+      if (log2_spin_budget < log2_spin_budget_max)
+        g_log2_spin_budget.store(log2_spin_budget + 1,
+                                 std::memory_order_relaxed);
+    } else if (waited > idle_wait_ns) {
+      if (log2_spin_budget > log2_spin_budget_min)
+        g_log2_spin_budget.store(log2_spin_budget - 1,
+                                 std::memory_order_relaxed);
+    }
+  }
 #else  // _WIN32
   while (!try_wait()) {
 #if defined(KOKKOS_ENABLE_ASM)
@@ -92,9 +92,15 @@ class HostBarrier {
   static constexpr int num_nops                   = 32;
   static constexpr int iterations_till_backoff    = 64;
   static constexpr int log2_iterations_till_yield = 4;
-  static constexpr int log2_iterations_till_sleep = 6;
 
  public:
+  // Hint how waiting threads should trade spin time against sleep latency:
+  // hint > 0 ("burst"): more short kernels are coming, spin longer before
+  // sleeping; hint < 0 ("idle soon"): a gap follows, sleep almost
+  // immediately; hint == 0: adapt from the duration of recent waits
+  // (the default).  Shared by all host thread pools in the process.
+  static void set_wait_hint(const int hint) noexcept;
+
   // will return true if call is the last thread to arrive
   KOKKOS_INLINE_FUNCTION
   static bool split_arrive(int* buffer, const int size, int& step,
@@ -47,6 +47,9 @@
 #include <Kokkos_Macros.hpp>
 #include <impl/Kokkos_Error.hpp>
 #include <impl/Kokkos_MemorySpace.hpp>
+#include <Kokkos_MemoryAccounting.hpp>
+#include <Kokkos_RealtimePhase.hpp>
+#include <Kokkos_AllocationAudit.hpp>
 #if defined(KOKKOS_ENABLE_PROFILING)
 #include <impl/Kokkos_Profiling_Interface.hpp>
 #endif
@@ -63,7 +66,11 @@
 
 /*--------------------------------------------------------------------------*/
 
-#if defined(KOKKOS_ENABLE_POSIX_MEMALIGN)
+/* mmap is used by the POSIX_MMAP and POSIX_MMAP_HUGETLB mechanisms
+ * and is available independent of the posix_memalign performance option.
+ */
+#if defined(KOKKOS_ENABLE_POSIX_MEMALIGN) || defined(__linux__) || \
+    defined(__APPLE__)
 
 #include <unistd.h>
 #include <sys/mman.h>
@@ -99,6 +106,8 @@
 #include <iostream>
 #include <sstream>
 #include <cstring>
+#include <map>
+#include <mutex>
 
 #include <Kokkos_HostSpace.hpp>
 #include <impl/Kokkos_Error.hpp>
@@ -114,12 +123,20 @@
 
 namespace Kokkos {
 
-/* Default allocation mechanism */
+/* Default allocation mechanism.
+ *
+ * The mmap mechanisms are compiled in on any POSIX system for the
+ * opt-in huge-page allocation property, but only serve as the default
+ * where they historically did - posix_memalign performance builds.
+ * Everywhere else the default stays malloc; one raw mmap per
+ * allocation is the wrong trade for small host Views.
+ */
 HostSpace::HostSpace()
     : m_alloc_mech(
 #if defined(KOKKOS_ENABLE_INTEL_MM_ALLOC)
           HostSpace::INTEL_MM_ALLOC
-#elif defined(KOKKOS_IMPL_POSIX_MMAP_FLAGS)
+#elif defined(KOKKOS_ENABLE_POSIX_MEMALIGN) && \
+    defined(KOKKOS_IMPL_POSIX_MMAP_FLAGS)
           HostSpace::POSIX_MMAP
 #elif defined(KOKKOS_ENABLE_POSIX_MEMALIGN)
           HostSpace::POSIX_MEMALIGN
@@ -143,9 +160,11 @@ HostSpace::HostSpace(const HostSpace::AllocationMechanism &arg_alloc_mech)
   else if (arg_alloc_mech == HostSpace::POSIX_MEMALIGN) {
     m_alloc_mech = HostSpace::POSIX_MEMALIGN;
   }
-#elif defined(KOKKOS_IMPL_POSIX_MMAP_FLAGS)
-  else if (arg_alloc_mech == HostSpace::POSIX_MMAP) {
-    m_alloc_mech = HostSpace::POSIX_MMAP;
+#endif
+#if defined(KOKKOS_IMPL_POSIX_MMAP_FLAGS)
+  else if (arg_alloc_mech == HostSpace::POSIX_MMAP ||
+           arg_alloc_mech == HostSpace::POSIX_MMAP_HUGETLB) {
+    m_alloc_mech = arg_alloc_mech;
   }
 #endif
   else {
@@ -154,8 +173,11 @@ HostSpace::HostSpace(const HostSpace::AllocationMechanism &arg_alloc_mech)
             ? "INTEL_MM_ALLOC"
             : ((arg_alloc_mech == HostSpace::POSIX_MEMALIGN)
                    ? "POSIX_MEMALIGN"
-                   : ((arg_alloc_mech == HostSpace::POSIX_MMAP) ? "POSIX_MMAP"
-                                                                : ""));
+                   : ((arg_alloc_mech == HostSpace::POSIX_MMAP)
+                          ? "POSIX_MMAP"
+                          : ((arg_alloc_mech == HostSpace::POSIX_MMAP_HUGETLB)
+                                 ? "POSIX_MMAP_HUGETLB"
+                                 : "")));
 
     std::string msg;
     msg.append("Kokkos::HostSpace ");
@@ -179,6 +201,8 @@ void *HostSpace::allocate(const size_t arg_alloc_size) const {
   void *ptr = nullptr;
 
   if (arg_alloc_size) {
+    Kokkos::Impl::realtime_phase_vet("HostSpace::allocate");
+    Kokkos::Impl::allocation_audit_note("HostSpace::allocate", arg_alloc_size);
     if (m_alloc_mech == STD_MALLOC) {
       // Over-allocate to and round up to guarantee proper alignment.
       size_t size_padded = arg_alloc_size + sizeof(void *) + alignment;
@@ -212,18 +236,29 @@ void *HostSpace::allocate(const size_t arg_alloc_size) const {
 #endif
 
 #if defined(KOKKOS_IMPL_POSIX_MMAP_FLAGS)
-    else if (m_alloc_mech == POSIX_MMAP) {
+    else if (m_alloc_mech == POSIX_MMAP ||
+             m_alloc_mech == POSIX_MMAP_HUGETLB) {
       constexpr size_t use_huge_pages = (1u << 27);
       constexpr int prot              = PROT_READ | PROT_WRITE;
-      const int flags                 = arg_alloc_size < use_huge_pages
-                            ? KOKKOS_IMPL_POSIX_MMAP_FLAGS
-                            : KOKKOS_IMPL_POSIX_MMAP_FLAGS_HUGE;
+      const int flags                 = (m_alloc_mech == POSIX_MMAP_HUGETLB ||
+                         use_huge_pages <= arg_alloc_size)
+                            ? KOKKOS_IMPL_POSIX_MMAP_FLAGS_HUGE
+                            : KOKKOS_IMPL_POSIX_MMAP_FLAGS;
+
+      // A huge page mapping requires the length be a multiple of the
+      // huge page size; round up assuming the common 2MB size.  The
+      // matching round-up happens in deallocate.
+      const size_t alloc_size =
+          flags != KOKKOS_IMPL_POSIX_MMAP_FLAGS
+              ? (arg_alloc_size + (size_t(1) << 21) - 1) &
+                    ~((size_t(1) << 21) - 1)
+              : arg_alloc_size;
 
       // read write access to private memory
 
       ptr = mmap(NULL /* address hint, if NULL OS kernel chooses address */
                  ,
-                 arg_alloc_size /* size in bytes */
+                 alloc_size /* size in bytes */
                  ,
                  prot /* memory protection */
                  ,
@@ -234,6 +269,15 @@ void *HostSpace::allocate(const size_t arg_alloc_size) const {
                  0 /* offset */
       );
 
+      // Huge pages are only available if the system reserved a hugetlb
+      // pool; fall back gracefully to regular pages.
+      if (MAP_FAILED == ptr && flags != KOKKOS_IMPL_POSIX_MMAP_FLAGS) {
+        ptr = mmap(NULL, arg_alloc_size, prot, KOKKOS_IMPL_POSIX_MMAP_FLAGS,
+                   -1, 0);
+      }
+
+      if (MAP_FAILED == ptr) ptr = nullptr;
+
       /* Associated reallocation:
              ptr = mremap( old_ptr , old_size , new_size , MREMAP_MAYMOVE );
       */
@@ -261,6 +305,7 @@ void *HostSpace::allocate(const size_t arg_alloc_size) const {
             AllocationMechanism::PosixMemAlign;
         break;
       case POSIX_MMAP:
+      case POSIX_MMAP_HUGETLB:
         alloc_mec = Experimental::RawMemoryAllocationFailure::
             AllocationMechanism::PosixMMap;
         break;
@@ -300,13 +345,124 @@ void HostSpace::deallocate(void *const arg_alloc_ptr, const size_t
 #endif
 
 #if defined(KOKKOS_IMPL_POSIX_MMAP_FLAGS)
-    else if (m_alloc_mech == POSIX_MMAP) {
-      munmap(arg_alloc_ptr, arg_alloc_size);
+    else if (m_alloc_mech == POSIX_MMAP ||
+             m_alloc_mech == POSIX_MMAP_HUGETLB) {
+      // A hugetlb mapping requires the unmap length be rounded up to
+      // the huge page size; munmap fails without side effects when the
+      // length does not match the mapping, so retry rounded.
+      if (munmap(arg_alloc_ptr, arg_alloc_size)) {
+        const size_t huge_mask = (size_t(1) << 21) - 1;
+        munmap(arg_alloc_ptr, (arg_alloc_size + huge_mask) & ~huge_mask);
+      }
     }
 #endif
   }
 }
 
+uint64_t HostSpace::high_water_mark() {
+  return Kokkos::Experimental::memory_space_high_water_mark(name());
+}
+
+namespace Impl {
+
+HostSpace with_huge_pages(const HostSpace &arg_space) {
+#if defined(KOKKOS_IMPL_POSIX_MMAP_FLAGS)
+  (void)arg_space;
+  return HostSpace(HostSpace::POSIX_MMAP_HUGETLB);
+#else
+  return arg_space;
+#endif
+}
+
+}  // namespace Impl
+
+namespace Experimental {
+
+#if defined(KOKKOS_ENABLE_CUDA)
+
+namespace {
+
+struct PinnedRegion {
+  size_t bytes;
+  int count;
+  bool owned;  // false when the region was page-locked outside Kokkos
+};
+
+std::mutex pinned_region_mutex;
+std::map<const void *, PinnedRegion> pinned_region_map;
+
+}  // namespace
+
+bool register_pinned(const void *arg_ptr, const size_t arg_bytes) {
+  if (nullptr == arg_ptr || 0 == arg_bytes) return false;
+
+  std::lock_guard<std::mutex> lock(pinned_region_mutex);
+
+  std::map<const void *, PinnedRegion>::iterator it =
+      pinned_region_map.find(arg_ptr);
+
+  if (it != pinned_region_map.end()) {
+    ++it->second.count;
+    return true;
+  }
+
+  const cudaError_t error_code = cudaHostRegister(
+      const_cast<void *>(arg_ptr), arg_bytes, cudaHostRegisterDefault);
+
+  bool owned = true;
+
+  if (cudaErrorHostMemoryAlreadyRegistered == error_code) {
+    // Page-locked outside Kokkos (e.g. by a CUDA-aware MPI): track the
+    // reference but leave the final unregistration to the owner.
+    cudaGetLastError();
+    owned = false;
+  } else if (cudaSuccess != error_code) {
+    cudaGetLastError();
+    Kokkos::Impl::throw_runtime_exception(
+        std::string("Kokkos::Experimental::register_pinned: "
+                    "cudaHostRegister failed: ") +
+        cudaGetErrorString(error_code));
+  }
+
+  PinnedRegion region;
+  region.bytes             = arg_bytes;
+  region.count             = 1;
+  region.owned             = owned;
+  pinned_region_map[arg_ptr] = region;
+
+  return true;
+}
+
+bool unregister_pinned(const void *arg_ptr) {
+  std::lock_guard<std::mutex> lock(pinned_region_mutex);
+
+  std::map<const void *, PinnedRegion>::iterator it =
+      pinned_region_map.find(arg_ptr);
+
+  if (it == pinned_region_map.end()) return false;
+
+  if (0 == --it->second.count) {
+    if (it->second.owned) {
+      cudaHostUnregister(const_cast<void *>(arg_ptr));
+    }
+    pinned_region_map.erase(it);
+  }
+
+  return true;
+}
+
+#else
+
+// No device runtime with host registration: pinning is a no-op and the
+// caller's buffer already transfers at full (host) speed.
+bool register_pinned(const void *, const size_t) { return false; }
+
+bool unregister_pinned(const void *) { return false; }
+
+#endif
+
+}  // namespace Experimental
+
 }  // namespace Kokkos
 
 //----------------------------------------------------------------------------
@@ -334,6 +490,8 @@ SharedAllocationRecord<Kokkos::HostSpace, void>::~SharedAllocationRecord() {
   }
 #endif
 
+  Kokkos::Impl::account_deallocation(m_space.name(), data(), size());
+
   m_space.deallocate(SharedAllocationRecord<void, void>::m_alloc_ptr,
                      SharedAllocationRecord<void, void>::m_alloc_size);
 }
@@ -381,6 +539,9 @@ SharedAllocationRecord<Kokkos::HostSpace, void>::SharedAllocationRecord(
         arg_alloc_size);
   }
 #endif
+
+  Kokkos::Impl::account_allocation(arg_space.name(), arg_label, data(),
+                                   arg_alloc_size);
   // Fill in the Header information
   RecordBase::m_alloc_ptr->m_record =
       static_cast<SharedAllocationRecord<void, void> *>(this);
@@ -53,6 +53,29 @@ namespace Impl {
 #define KOKKOS_IMPL_HOST_DEEP_COPY_SERIAL_LIMIT 10 * 8192
 #endif
 
+void hostspace_parallel_deepcopy_2d(void* dst, ptrdiff_t dst_pitch,
+                                    const void* src, ptrdiff_t src_pitch,
+                                    ptrdiff_t width, ptrdiff_t rows) {
+  char* dst_c       = reinterpret_cast<char*>(dst);
+  const char* src_c = reinterpret_cast<const char*>(src);
+
+  if ((width * rows < KOKKOS_IMPL_HOST_DEEP_COPY_SERIAL_LIMIT) ||
+      (Kokkos::DefaultHostExecutionSpace().concurrency() == 1)) {
+    for (ptrdiff_t row = 0; row < rows; ++row) {
+      std::memcpy(dst_c + row * dst_pitch, src_c + row * src_pitch, width);
+    }
+    return;
+  }
+
+  typedef Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace> policy_t;
+
+  Kokkos::parallel_for("Kokkos::Impl::host_space_deepcopy_2d",
+                       policy_t(0, rows), [=](const ptrdiff_t row) {
+                         std::memcpy(dst_c + row * dst_pitch,
+                                     src_c + row * src_pitch, width);
+                       });
+}
+
 void hostspace_parallel_deepcopy(void* dst, const void* src, ptrdiff_t n) {
   if ((n < KOKKOS_IMPL_HOST_DEEP_COPY_SERIAL_LIMIT) ||
       (Kokkos::DefaultHostExecutionSpace().concurrency() == 1)) {
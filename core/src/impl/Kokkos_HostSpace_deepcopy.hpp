@@ -49,6 +49,12 @@ namespace Impl {
 
 void hostspace_parallel_deepcopy(void* dst, const void* src, ptrdiff_t n);
 
+/* Copy 'rows' runs of 'width' contiguous bytes whose starting addresses
+ * advance by a constant pitch on each side. */
+void hostspace_parallel_deepcopy_2d(void* dst, ptrdiff_t dst_pitch,
+                                    const void* src, ptrdiff_t src_pitch,
+                                    ptrdiff_t width, ptrdiff_t rows);
+
 }  // namespace Impl
 
 }  // namespace Kokkos
@@ -91,6 +91,7 @@ void HostThreadTeamData::organize_pool(HostThreadTeamData *members[],
         mem->m_league_rank            = rank;
         mem->m_league_size            = size;
         mem->m_team_rendezvous_step   = 0;
+        mem->m_team_reduce_epoch      = 0;
         pool[rank]                    = mem;
       }
     }
@@ -117,6 +118,7 @@ void HostThreadTeamData::disband_pool() {
   m_league_rank          = 0;
   m_league_size          = 1;
   m_team_rendezvous_step = 0;
+  m_team_reduce_epoch    = 0;
 }
 
 int HostThreadTeamData::organize_team(const int team_size) {
@@ -162,6 +164,11 @@ int HostThreadTeamData::organize_team(const int team_size) {
     m_league_rank          = league_rank;
     m_league_size          = league_size;
     m_team_rendezvous_step = 0;
+    m_team_reduce_epoch    = 0;
+
+    // Reset this member's tree-combining flag; the pool rendezvous below
+    // publishes the reset before any team reduction can observe it.
+    if (m_scratch) team_reduce_local()[0] = 0;
 
     if (team_base_rank == m_pool_rank) {
       // Initialize team's rendezvous memory
@@ -197,6 +204,7 @@ void HostThreadTeamData::disband_team() {
   m_league_rank          = m_pool_rank;
   m_league_size          = m_pool_size;
   m_team_rendezvous_step = 0;
+  m_team_reduce_epoch    = 0;
 }
 
 //----------------------------------------------------------------------------
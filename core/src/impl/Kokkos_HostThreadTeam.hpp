@@ -97,7 +97,9 @@ class HostThreadTeamData {
   using pair_int_t = Kokkos::pair<int64_t, int64_t>;
 
   pair_int_t m_work_range;
+  pair_int_t m_part_range;  // memoized initial partition
   int64_t m_work_end;
+  int64_t m_part_length;  // memoized set_work_partition key
   int64_t* m_scratch;       // per-thread buffer
   int64_t* m_pool_scratch;  // == pool[0]->m_scratch
   int64_t* m_team_scratch;  // == pool[ 0 + m_team_base ]->m_scratch
@@ -114,9 +116,13 @@ class HostThreadTeamData {
   int m_league_rank;
   int m_league_size;
   int m_work_chunk;
+  int m_part_chunk;        // memoized set_work_partition key
+  int m_part_league_rank;  // memoized set_work_partition key
+  int m_part_league_size;  // memoized set_work_partition key
   int m_steal_rank;  // work stealing rank
   int mutable m_pool_rendezvous_step;
   int mutable m_team_rendezvous_step;
+  int mutable m_team_reduce_epoch;
 
   HostThreadTeamData* team_member(int r) const noexcept {
     return ((HostThreadTeamData**)(m_pool_scratch +
@@ -187,7 +193,9 @@ class HostThreadTeamData {
 
   constexpr HostThreadTeamData() noexcept
       : m_work_range(-1, -1),
+        m_part_range(-1, -1),
         m_work_end(0),
+        m_part_length(-1),
         m_scratch(0),
         m_pool_scratch(0),
         m_team_scratch(0),
@@ -204,9 +212,13 @@ class HostThreadTeamData {
         m_league_rank(0),
         m_league_size(1),
         m_work_chunk(0),
+        m_part_chunk(0),
+        m_part_league_rank(-1),
+        m_part_league_size(-1),
         m_steal_rank(0),
         m_pool_rendezvous_step(0),
-        m_team_rendezvous_step(0) {}
+        m_team_rendezvous_step(0),
+        m_team_reduce_epoch(0) {}
 
   //----------------------------------------
   // Organize array of members into a pool.
@@ -373,6 +385,18 @@ fflush(stdout);
   // with granularity of chunk
 
   void set_work_partition(int64_t const length, int const chunk) noexcept {
+    // Repeated identical dispatches are the common case for iterative
+    // solvers; when (length, chunk) and the team shape match the last
+    // computation, restore the memoized partition instead of redoing
+    // the chunk arithmetic.  Dynamic scheduling consumes m_work_range
+    // in place, so the initial partition is kept separately.
+    if (length == m_part_length && chunk == m_part_chunk &&
+        m_league_rank == m_part_league_rank &&
+        m_league_size == m_part_league_size) {
+      m_work_range = m_part_range;
+      return;
+    }
+
     // Minimum chunk size to insure that
     //   m_work_end < std::numeric_limits<int>::max() * m_work_chunk
 
@@ -395,6 +419,12 @@ fflush(stdout);
     m_steal_rank = m_team_base + m_team_alloc + m_team_size <= m_pool_size
                        ? m_team_base + m_team_alloc
                        : 0;
+
+    m_part_range       = m_work_range;
+    m_part_length      = length;
+    m_part_chunk       = chunk;
+    m_part_league_rank = m_league_rank;
+    m_part_league_size = m_league_size;
   }
 
   std::pair<int64_t, int64_t> get_work_partition() noexcept {
@@ -419,6 +449,47 @@ fflush(stdout);
 
     return x;
   }
+
+  // Claim a block of up to nchunk chunks.  The block is taken from the
+  // beginning of this thread's own partition with a single atomic update;
+  // only when the local partition is exhausted does the call fall back to
+  // stealing one chunk at a time from another partition.  Only valid for
+  // one-thread teams (RangePolicy dispatch).
+  std::pair<int64_t, int64_t> get_work_stealing_block(
+      const int nchunk) noexcept {
+    if (1 == m_team_size) {
+      pair_int_t w(-1, -1);
+      int n = 1;
+
+      for (int attempt = m_work_range.first < m_work_range.second; attempt;) {
+        // Query and attempt to advance the beginning of m_work_range by the
+        // block size, clipped to the remaining extent of the partition.
+        //
+        // If w is invalid then is just a query.
+
+        const pair_int_t w_new(w.first + n, w.second);
+
+        w = Kokkos::atomic_compare_exchange(&m_work_range, w, w_new);
+
+        if (w.first < w.second) {
+          if (w_new.first == w.first + n && w_new.second == w.second) {
+            // Claimed chunks [ w.first .. w.first + n )
+            std::pair<int64_t, int64_t> x(
+                int64_t(m_work_chunk) * w.first,
+                int64_t(m_work_chunk) * (w.first + n));
+            if (m_work_end < x.second) x.second = m_work_end;
+            return x;
+          }
+          const int avail = w.second - w.first;
+          n               = nchunk < avail ? nchunk : avail;
+        } else {
+          attempt = 0;
+        }
+      }
+    }
+
+    return get_work_stealing_chunk();
+  }
 };
 
 //----------------------------------------------------------------------------
@@ -600,6 +671,51 @@ class HostThreadTeamMember {
     if (1 < m_data.m_team_size) {
       using value_type = typename ReducerType::value_type;
 
+      // For larger teams combine contributions along a log2-depth tree
+      // instead of a linear gather by the root: rank r folds in the value
+      // of rank r + 2^round until its own low bit is reached, at which
+      // point it publishes its subtree's partial result.  Flags are
+      // monotonic (epoch,round) values in the first word of each member's
+      // team-reduce buffer, reset when the team is organized, so no
+      // per-call flag cleanup or extra barrier is needed.  Pairing
+      // adjacent ranks keeps the first combining rounds within a NUMA
+      // domain under the contiguous thread mapping.
+      enum : int { tree_combining_threshold = 8 };
+
+      if (int(tree_combining_threshold) <= m_data.m_team_size) {
+        const int64_t flag_base = int64_t(++m_data.m_team_reduce_epoch) << 32;
+
+        int64_t* const my_buf = m_data.team_reduce_local();
+
+        for (int round = 0; (1 << round) < m_data.m_team_size; ++round) {
+          if (m_data.m_team_rank & (1 << round)) {
+            *((value_type*)(my_buf + 2)) = contribution;
+            Kokkos::memory_fence();
+            *((volatile int64_t*)my_buf) = flag_base + round + 1;
+            break;
+          }
+          const int partner = m_data.m_team_rank + (1 << round);
+          if (partner < m_data.m_team_size) {
+            int64_t* const partner_buf =
+                m_data.team_member(partner)->team_reduce_local();
+            while (*((volatile int64_t*)partner_buf) < flag_base + round + 1)
+              ;
+            Kokkos::memory_fence();
+            reducer.join(contribution, *((value_type*)(partner_buf + 2)));
+          }
+        }
+
+        if (m_data.team_rendezvous()) {
+          // Root of the tree holds the complete reduction value.
+          *((value_type*)m_data.team_reduce()) = contribution;
+          reducer.reference()                  = contribution;
+          m_data.team_rendezvous_release();
+        } else {
+          reducer.reference() = *((value_type*)m_data.team_reduce());
+        }
+        return;
+      }
+
       if (0 != m_data.m_team_rank) {
         // Non-root copies to their local buffer:
         /*reducer.copy( (value_type*) m_data.team_reduce_local()
@@ -257,6 +257,11 @@ class LockBasedLIFO : private LockBasedLIFOCommon<T> {
     return pop(/* abort_on_locked = */ true);
   }
 
+  // Interface parity with ChaseLevDeque: this queue doesn't track its
+  // size, so there is no cheap bound for a batch; steal a single entry.
+  KOKKOS_INLINE_FUNCTION
+  OptionalRef<T> steal_half(LockBasedLIFO& /*thief*/) { return steal(); }
+
   KOKKOS_INLINE_FUNCTION
   bool push(node_type& node) {
     while (!this->_try_push_node(node)) { /* retry until success */
@@ -0,0 +1,147 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <impl/Kokkos_LaunchBoundsRegistry.hpp>
+#include <impl/Kokkos_Error.hpp>
+
+#include <atomic>
+#include <map>
+#include <mutex>
+
+namespace Kokkos {
+namespace Impl {
+
+namespace {
+
+// Entries live in a node-based map so pointers handed out to the
+// per-thread hint stay valid across later registrations.
+std::map<std::string, LaunchBoundsEntry>& registry() {
+  static std::map<std::string, LaunchBoundsEntry> s_registry;
+  return s_registry;
+}
+
+std::mutex& registry_mutex() {
+  static std::mutex s_mutex;
+  return s_mutex;
+}
+
+std::atomic<int> s_registry_size(0);
+
+LaunchBoundsEntry*& hint_tls() {
+  static thread_local LaunchBoundsEntry* t_hint = nullptr;
+  return t_hint;
+}
+
+}  // namespace
+
+bool launch_bounds_registry_empty() {
+  return s_registry_size.load(std::memory_order_relaxed) == 0;
+}
+
+LaunchBoundsEntry* launch_bounds_find(const std::string& label) {
+  std::lock_guard<std::mutex> guard(registry_mutex());
+  std::map<std::string, LaunchBoundsEntry>::iterator entry =
+      registry().find(label);
+  return entry != registry().end() ? &entry->second : nullptr;
+}
+
+LaunchBoundsEntry* launch_bounds_find(const char* label) {
+  return label != nullptr ? launch_bounds_find(std::string(label)) : nullptr;
+}
+
+LaunchBoundsEntry* launch_bounds_hint() { return hint_tls(); }
+
+void launch_bounds_hint_record(const int block_size,
+                               const int regs_per_thread,
+                               const int occupancy_pct) {
+  LaunchBoundsEntry* const entry = hint_tls();
+  if (entry != nullptr) {
+    entry->block_size      = block_size;
+    entry->regs_per_thread = regs_per_thread;
+    entry->occupancy_pct   = occupancy_pct;
+    ++entry->launch_count;
+  }
+}
+
+void LaunchBoundsHintScope::activate(LaunchBoundsEntry* entry) {
+  if (entry != nullptr) {
+    m_previous = hint_tls();
+    m_active   = true;
+    hint_tls() = entry;
+  }
+}
+
+void LaunchBoundsHintScope::deactivate() { hint_tls() = m_previous; }
+
+}  // namespace Impl
+
+namespace Experimental {
+
+void set_kernel_launch_bounds(const std::string& label,
+                              const unsigned max_threads_per_block,
+                              const unsigned min_blocks_per_sm) {
+  std::lock_guard<std::mutex> guard(Impl::registry_mutex());
+  Impl::LaunchBoundsEntry& entry = Impl::registry()[label];
+  entry.max_threads_per_block    = max_threads_per_block;
+  entry.min_blocks_per_sm        = min_blocks_per_sm;
+  Impl::s_registry_size.store(int(Impl::registry().size()),
+                              std::memory_order_relaxed);
+}
+
+KernelOccupancy get_kernel_occupancy(const std::string& label) {
+  Impl::LaunchBoundsEntry* const entry = Impl::launch_bounds_find(label);
+  if (entry == nullptr) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Error: Kokkos::get_kernel_occupancy of unregistered label: " + label);
+  }
+  KernelOccupancy report;
+  report.block_size      = entry->block_size;
+  report.regs_per_thread = entry->regs_per_thread;
+  report.occupancy_pct   = entry->occupancy_pct;
+  report.launch_count    = entry->launch_count;
+  return report;
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
@@ -0,0 +1,165 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_LaunchBoundsRegistry.hpp
+/// \brief Per-label launch-bounds hints with occupancy feedback.
+///
+/// LaunchBounds is a policy template argument, so a bound has to be
+/// spelled at every call site and cannot be attached to lambda
+/// kernels at all.  The registry binds kernel labels to launch
+/// limits at startup: a labeled parallel dispatch activates the
+/// matching entry for the duration of the launch, and the backend's
+/// block-size deduction clamps its configuration by the active hint
+/// and writes back what it actually chose - block size, registers
+/// per thread, and theoretical occupancy - so occupancy-limited
+/// kernels can be identified and tuned without recompiling.
+///
+/// With no entries registered the per-launch cost is one relaxed
+/// atomic load.
+
+#ifndef KOKKOS_IMPL_LAUNCHBOUNDSREGISTRY_HPP
+#define KOKKOS_IMPL_LAUNCHBOUNDSREGISTRY_HPP
+
+#include <Kokkos_Macros.hpp>
+
+#include <cstdint>
+#include <string>
+
+namespace Kokkos {
+namespace Impl {
+
+/** \brief  One registered kernel: the requested limits and the
+ *          configuration the backend last chose under them.
+ */
+struct LaunchBoundsEntry {
+  unsigned max_threads_per_block;
+  unsigned min_blocks_per_sm;
+
+  // Feedback written by the backend block-size deduction.
+  int block_size;
+  int regs_per_thread;
+  int occupancy_pct;
+  uint64_t launch_count;
+};
+
+/** \brief  True while no entry has ever been registered; one relaxed
+ *          atomic load.
+ */
+bool launch_bounds_registry_empty();
+
+/** \brief  Entry registered under label, or nullptr. */
+LaunchBoundsEntry* launch_bounds_find(const std::string& label);
+LaunchBoundsEntry* launch_bounds_find(const char* label);
+
+/** \brief  Entry active for the launch in flight on this thread, or
+ *          nullptr.
+ */
+LaunchBoundsEntry* launch_bounds_hint();
+
+/** \brief  Record the configuration the backend chose under the
+ *          active hint; no-op when no hint is active.
+ */
+void launch_bounds_hint_record(const int block_size,
+                               const int regs_per_thread,
+                               const int occupancy_pct);
+
+/** \brief  Activates the entry matching a launch label, if any, for
+ *          the scope of one dispatch on the calling thread.
+ */
+class LaunchBoundsHintScope {
+ public:
+  template <class Label>
+  explicit LaunchBoundsHintScope(const Label& label)
+      : m_previous(nullptr), m_active(false) {
+    if (!launch_bounds_registry_empty()) activate(launch_bounds_find(label));
+  }
+
+  ~LaunchBoundsHintScope() {
+    if (m_active) deactivate();
+  }
+
+  LaunchBoundsHintScope(const LaunchBoundsHintScope&) = delete;
+  LaunchBoundsHintScope& operator=(const LaunchBoundsHintScope&) = delete;
+
+ private:
+  void activate(LaunchBoundsEntry* entry);
+  void deactivate();
+
+  LaunchBoundsEntry* m_previous;
+  bool m_active;
+};
+
+}  // namespace Impl
+
+namespace Experimental {
+
+/** \brief  Bind launch limits to a kernel label; subsequent launches
+ *          with that label are configured within them.  A zero limit
+ *          leaves the corresponding dimension unconstrained.
+ *          Re-registering a label updates its limits.
+ */
+void set_kernel_launch_bounds(const std::string& label,
+                              const unsigned max_threads_per_block,
+                              const unsigned min_blocks_per_sm = 0);
+
+/** \brief  What the backend chose for a registered kernel; zeros
+ *          until the kernel's first configured launch.  Registers per
+ *          thread and occupancy are filled by device backends.
+ */
+struct KernelOccupancy {
+  int block_size;
+  int regs_per_thread;
+  int occupancy_pct;
+  uint64_t launch_count;
+};
+
+/** \brief  Feedback for a label registered with
+ *          set_kernel_launch_bounds; throws for unknown labels.
+ */
+KernelOccupancy get_kernel_occupancy(const std::string& label);
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_IMPL_LAUNCHBOUNDSREGISTRY_HPP */
@@ -0,0 +1,199 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+#include <Kokkos_MemoryAccounting.hpp>
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+namespace Kokkos {
+namespace Impl {
+
+namespace {
+
+struct Totals {
+  uint64_t live_bytes      = 0;
+  uint64_t high_water_mark = 0;
+
+  void add(uint64_t size) {
+    live_bytes += size;
+    if (live_bytes > high_water_mark) high_water_mark = live_bytes;
+  }
+};
+
+// Attribution must follow an allocation for its whole lifetime, so each
+// live allocation remembers the tag it was charged to.
+struct LiveAllocation {
+  std::string tag;
+  uint64_t size;
+};
+
+struct AccountingState {
+  std::mutex mutex;
+  std::map<std::string, Totals> spaces;
+  std::map<std::string, Totals> tags;
+  std::unordered_map<const void*, LiveAllocation> live;
+};
+
+AccountingState& state() {
+  static AccountingState s;
+  return s;
+}
+
+// Disabled is the default; the allocation-path hooks must then cost one
+// relaxed atomic load, like realtime_phase_vet and allocation_audit_note,
+// never a mutex.
+std::atomic<int> g_accounting_enabled(0);
+
+thread_local std::vector<std::string> t_tag_stack;
+
+}  // namespace
+
+void account_allocation(const char* space_name, const std::string& /*label*/,
+                        const void* ptr, size_t size) {
+  if (0 == g_accounting_enabled.load(std::memory_order_relaxed)) return;
+  auto& s = state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  s.spaces[space_name].add(size);
+  if (!t_tag_stack.empty()) {
+    std::string const& tag = t_tag_stack.back();
+    s.tags[tag].add(size);
+    s.live[ptr] = LiveAllocation{tag, uint64_t(size)};
+  }
+}
+
+void account_deallocation(const char* space_name, const void* ptr,
+                          size_t size) {
+  if (0 == g_accounting_enabled.load(std::memory_order_relaxed)) return;
+  auto& s = state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  s.spaces[space_name].live_bytes -= size;
+  auto it = s.live.find(ptr);
+  if (it != s.live.end()) {
+    s.tags[it->second.tag].live_bytes -= it->second.size;
+    s.live.erase(it);
+  }
+}
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+namespace Kokkos {
+namespace Experimental {
+
+namespace {
+
+Impl::Totals lookup(std::map<std::string, Impl::Totals> const& m,
+                    const char* name) {
+  auto it = m.find(name);
+  return it == m.end() ? Impl::Totals() : it->second;
+}
+
+}  // namespace
+
+void enable_memory_accounting() {
+  Impl::g_accounting_enabled.store(1, std::memory_order_relaxed);
+}
+
+void disable_memory_accounting() {
+  Impl::g_accounting_enabled.store(0, std::memory_order_relaxed);
+}
+
+bool memory_accounting_enabled() {
+  return 0 != Impl::g_accounting_enabled.load(std::memory_order_relaxed);
+}
+
+uint64_t memory_space_live_bytes(const char* space_name) {
+  auto& s = Impl::state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  return lookup(s.spaces, space_name).live_bytes;
+}
+
+uint64_t memory_space_high_water_mark(const char* space_name) {
+  auto& s = Impl::state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  return lookup(s.spaces, space_name).high_water_mark;
+}
+
+void push_allocation_tag(const char* tag) {
+  Impl::t_tag_stack.push_back(tag);
+}
+
+void pop_allocation_tag() {
+  if (!Impl::t_tag_stack.empty()) Impl::t_tag_stack.pop_back();
+}
+
+uint64_t allocation_tag_live_bytes(const char* tag) {
+  auto& s = Impl::state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  return lookup(s.tags, tag).live_bytes;
+}
+
+uint64_t allocation_tag_high_water_mark(const char* tag) {
+  auto& s = Impl::state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  return lookup(s.tags, tag).high_water_mark;
+}
+
+void print_memory_accounting(std::ostream& os) {
+  auto& s = Impl::state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  os << "Kokkos memory accounting:\n";
+  for (auto const& space : s.spaces) {
+    os << "  space " << space.first << ": live=" << space.second.live_bytes
+       << " high_water_mark=" << space.second.high_water_mark << "\n";
+  }
+  for (auto const& tag : s.tags) {
+    os << "  tag " << tag.first << ": live=" << tag.second.live_bytes
+       << " high_water_mark=" << tag.second.high_water_mark << "\n";
+  }
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
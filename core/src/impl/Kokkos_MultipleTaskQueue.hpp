@@ -52,6 +52,7 @@
 #include <Kokkos_Core_fwd.hpp>
 
 #include <Kokkos_MemoryPool.hpp>
+#include <Kokkos_hwloc.hpp>
 
 #include <impl/Kokkos_TaskBase.hpp>
 #include <impl/Kokkos_TaskResult.hpp>
@@ -60,6 +61,7 @@
 #include <impl/Kokkos_TaskQueueCommon.hpp>
 #include <impl/Kokkos_Memory_Fence.hpp>
 #include <impl/Kokkos_Atomic_Increment.hpp>
+#include <Kokkos_Atomic.hpp>
 #include <impl/Kokkos_OptionalRef.hpp>
 #include <impl/Kokkos_LIFO.hpp>
 
@@ -112,10 +114,17 @@ struct MultipleTaskQueueTeamEntry {
   // Number of allowed priorities
   static constexpr int NumPriorities = 3;
 
+  // Every this many pops, service the queues lowest priority first so
+  // that a steady stream of high-priority tasks cannot starve the rest
+  static constexpr int32_t StarvationAgingPeriod = 16;
+
   ready_queue_type m_ready_queues[NumPriorities][2];
 
   task_base_type* m_failed_heads[NumPriorities][2];
 
+  // Pops since the last aging pass; see pop_ready_task
+  int32_t m_pop_count = 0;
+
   KOKKOS_INLINE_FUNCTION
   task_base_type*& failed_head_for(runnable_task_base_type const& task) {
     return m_failed_heads[int(task.get_priority())][int(task.get_task_type())];
@@ -163,8 +172,9 @@ struct MultipleTaskQueueTeamEntry {
   KOKKOS_INLINE_FUNCTION
   OptionalRef<task_base_type> try_to_steal_ready_task() {
     auto return_value = OptionalRef<task_base_type>{};
-    // prefer lower priority tasks when stealing
-    for (int i_priority = NumPriorities - 1; i_priority >= 0; --i_priority) {
+    // prefer higher priority tasks when stealing, so that critical-path
+    // work spreads across teams rather than waiting behind bulk tasks
+    for (int i_priority = 0; i_priority < NumPriorities; ++i_priority) {
       // Check for a single task with this priority
       return_value = m_ready_queues[i_priority][TaskSingle].steal();
       if (return_value) return return_value;
@@ -176,10 +186,40 @@ struct MultipleTaskQueueTeamEntry {
     return return_value;
   }
 
+  // Batched variant: return one task to run and move up to half of the
+  // victim's remaining ready tasks of the same priority and type into the
+  // thief's entry, so that the thief's subsequent pops hit its own queues
+  // instead of re-stealing one task at a time.
   KOKKOS_INLINE_FUNCTION
-  OptionalRef<task_base_type> pop_ready_task() {
+  OptionalRef<task_base_type> try_to_steal_ready_task(
+      MultipleTaskQueueTeamEntry& thief) {
     auto return_value = OptionalRef<task_base_type>{};
+    // prefer higher priority tasks when stealing, so that critical-path
+    // work spreads across teams rather than waiting behind bulk tasks
     for (int i_priority = 0; i_priority < NumPriorities; ++i_priority) {
+      // Check for a single task with this priority
+      return_value = m_ready_queues[i_priority][TaskSingle].steal_half(
+          thief.m_ready_queues[i_priority][TaskSingle]);
+      if (return_value) return return_value;
+
+      // Check for a team task with this priority
+      return_value = m_ready_queues[i_priority][TaskTeam].steal_half(
+          thief.m_ready_queues[i_priority][TaskTeam]);
+      if (return_value) return return_value;
+    }
+    return return_value;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  OptionalRef<task_base_type> pop_ready_task() {
+    auto return_value = OptionalRef<task_base_type>{};
+    // periodically invert the priority order as an aging mechanism for
+    // the lower-priority queues
+    bool const aging_pass =
+        Kokkos::atomic_fetch_add(&m_pop_count, 1) % StarvationAgingPeriod ==
+        StarvationAgingPeriod - 1;
+    for (int i = 0; i < NumPriorities; ++i) {
+      int const i_priority = aging_pass ? NumPriorities - 1 - i : i;
       return_value = _pop_failed_insertion(i_priority, TaskTeam);
       if (not return_value)
         return_value = m_ready_queues[i_priority][TaskTeam].pop();
@@ -380,6 +420,16 @@ class MultipleTaskQueue final
     return this->n_vla_entries();
   }
 
+ private:
+  // Number of consecutive team queues assumed to share a locality (NUMA)
+  // domain; victims in the thief's own domain are tried before remote
+  // ones.  Computed on the host at construction; equals n_queues() when
+  // no topology information is available, which reduces victim selection
+  // to the old purely circular order.
+  int32_t m_queues_per_domain = 1;
+
+ public:
+
  public:
   //----------------------------------------------------------------------------
   // <editor-fold desc="Constructors, destructors, and assignment"> {{{2
@@ -400,7 +450,18 @@ class MultipleTaskQueue final
                 // SimpleTaskScheduler directly?
                 SimpleTaskScheduler<typename base_t::execution_space,
                                     MultipleTaskQueue>>::
-                get_max_team_count(arg_execution_space)) {}
+                get_max_team_count(arg_execution_space)) {
+    // Group the per-team queues into locality domains so that stealing
+    // can prefer victims whose queues live on the same NUMA domain.
+    // Without hwloc get_available_numa_count() reports one domain and
+    // all queues end up in the same group.
+    int32_t const n_domains =
+        static_cast<int32_t>(Kokkos::hwloc::get_available_numa_count());
+    int32_t const n = static_cast<int32_t>(this->n_queues());
+    m_queues_per_domain =
+        n_domains > 1 ? (n + n_domains - 1) / n_domains : n;
+    if (m_queues_per_domain < 1) m_queues_per_domain = 1;
+  }
 
   // </editor-fold> end Constructors, destructors, and assignment }}}2
   //----------------------------------------------------------------------------
@@ -439,13 +500,22 @@ class MultipleTaskQueue final
     return_value = team_queue_info.pop_ready_task();
 
     if (not return_value) {
-      // loop through the rest of the teams and try to steal
-      for (auto isteal = (team_association + 1) % this->n_queues();
-           isteal != team_association;
-           isteal = (isteal + 1) % this->n_queues()) {
-        return_value = this->vla_value_at(isteal).try_to_steal_ready_task();
-        if (return_value) {
-          break;
+      // loop through the rest of the teams and try to steal, visiting
+      // victims in the thief's own locality domain before remote ones so
+      // that stolen task data preferentially stays within a NUMA domain
+      auto const my_domain = team_association / m_queues_per_domain;
+      for (int i_pass = 0; i_pass < 2 && not return_value; ++i_pass) {
+        for (auto isteal = (team_association + 1) % this->n_queues();
+             isteal != team_association;
+             isteal = (isteal + 1) % this->n_queues()) {
+          bool const same_domain =
+              (isteal / m_queues_per_domain) == my_domain;
+          if (same_domain != (i_pass == 0)) continue;
+          return_value = this->vla_value_at(isteal).try_to_steal_ready_task(
+              team_queue_info);
+          if (return_value) {
+            break;
+          }
         }
       }
 
@@ -0,0 +1,238 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+#include <Kokkos_Macros.hpp>
+
+#if defined(KOKKOS_ENABLE_PROFILING)
+
+#include <impl/Kokkos_Profiling_Counters.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace Kokkos {
+namespace Profiling {
+
+namespace {
+
+enum { n_counters = 3 };
+
+char const* const counter_names[n_counters] = {"instructions", "cycles",
+                                               "llc-misses"};
+
+struct KernelCounters {
+  uint64_t calls       = 0;
+  double seconds       = 0;
+  uint64_t values[n_counters] = {0, 0, 0};
+};
+
+struct CollectionState {
+  bool enabled            = false;
+  bool counters_available = false;
+  int fds[n_counters]     = {-1, -1, -1};
+  // host dispatches are serial, so one pending begin at a time suffices;
+  // nested dispatches (e.g. from within a host task) stack
+  struct Pending {
+    std::string name;
+    std::chrono::steady_clock::time_point start;
+    uint64_t values[n_counters];
+  };
+  std::vector<Pending> pending;
+  std::map<std::string, KernelCounters> totals;
+};
+
+CollectionState& state() {
+  static CollectionState s;
+  return s;
+}
+
+#if defined(__linux__)
+int open_counter(uint32_t type, uint64_t config) {
+  struct perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.size           = sizeof(attr);
+  attr.type           = type;
+  attr.config         = config;
+  attr.disabled       = 0;
+  attr.inherit        = 1;  // count threads spawned after this open
+  attr.exclude_kernel = 1;
+  attr.exclude_hv     = 1;
+  return (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+}
+#endif
+
+void read_counters(uint64_t values[n_counters]) {
+  for (int i = 0; i < n_counters; ++i) {
+    values[i] = 0;
+#if defined(__linux__)
+    if (state().fds[i] >= 0) {
+      uint64_t v = 0;
+      if (read(state().fds[i], &v, sizeof(v)) == sizeof(v)) values[i] = v;
+    }
+#endif
+  }
+}
+
+}  // namespace
+
+bool counterCollectionEnabled() { return state().enabled; }
+
+void initializeCounterCollection() {
+  char const* env = getenv("KOKKOS_PROFILE_COUNTERS");
+  if (env == nullptr || atoi(env) == 0) return;
+  state().enabled = true;
+#if defined(__linux__)
+  state().fds[0] =
+      open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+  state().fds[1] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+  state().fds[2] =
+      open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+  state().counters_available =
+      state().fds[0] >= 0 || state().fds[1] >= 0 || state().fds[2] >= 0;
+#endif
+}
+
+void beginKernelCounters(const std::string& kernelName) {
+  if (!state().enabled) return;
+  state().pending.emplace_back();
+  auto& p = state().pending.back();
+  p.name  = kernelName;
+  read_counters(p.values);
+  p.start = std::chrono::steady_clock::now();
+}
+
+void endKernelCounters() {
+  if (!state().enabled || state().pending.empty()) return;
+  auto const stop = std::chrono::steady_clock::now();
+  uint64_t now[n_counters];
+  read_counters(now);
+  auto const& p = state().pending.back();
+  auto& total   = state().totals[p.name];
+  total.calls += 1;
+  total.seconds +=
+      std::chrono::duration_cast<std::chrono::duration<double>>(stop - p.start)
+          .count();
+  for (int i = 0; i < n_counters; ++i) {
+    if (now[i] >= p.values[i]) total.values[i] += now[i] - p.values[i];
+  }
+  state().pending.pop_back();
+}
+
+void finalizeCounterCollection() {
+  if (!state().enabled) return;
+  state().enabled = false;
+
+  std::vector<std::pair<std::string, KernelCounters>> rows(
+      state().totals.begin(), state().totals.end());
+  // largest estimated memory traffic first
+  std::sort(rows.begin(), rows.end(),
+            [](std::pair<std::string, KernelCounters> const& a,
+               std::pair<std::string, KernelCounters> const& b) {
+              return a.second.values[2] != b.second.values[2]
+                         ? a.second.values[2] > b.second.values[2]
+                         : a.second.seconds > b.second.seconds;
+            });
+
+  std::cerr << "Kokkos per-kernel counter report ("
+            << (state().counters_available
+                    ? "perf_event hardware counters"
+                    : "hardware counters unavailable; wall times only")
+            << "):\n";
+  for (auto const& row : rows) {
+    auto const& c = row.second;
+    std::cerr << "  " << row.first << ": calls=" << c.calls
+              << " time=" << c.seconds << "s";
+    if (state().counters_available) {
+      for (int i = 0; i < n_counters; ++i) {
+        std::cerr << " " << counter_names[i] << "=" << c.values[i];
+      }
+      // cache-line-sized transfers per LLC miss approximate DRAM traffic
+      double const bytes = double(c.values[2]) * 64.0;
+      std::cerr << " dram~=" << bytes * 1e-9 << "GB";
+      if (c.seconds > 0) std::cerr << " bw~=" << bytes * 1e-9 / c.seconds << "GB/s";
+    }
+    std::cerr << "\n";
+  }
+
+#if defined(__linux__)
+  for (int i = 0; i < n_counters; ++i) {
+    if (state().fds[i] >= 0) close(state().fds[i]);
+    state().fds[i] = -1;
+  }
+#endif
+  state().totals.clear();
+}
+
+}  // namespace Profiling
+}  // namespace Kokkos
+
+#else
+
+#include <impl/Kokkos_Profiling_Counters.hpp>
+
+namespace Kokkos {
+namespace Profiling {
+
+bool counterCollectionEnabled() { return false; }
+void initializeCounterCollection() {}
+void finalizeCounterCollection() {}
+void beginKernelCounters(const std::string&) {}
+void endKernelCounters() {}
+
+}  // namespace Profiling
+}  // namespace Kokkos
+
+#endif
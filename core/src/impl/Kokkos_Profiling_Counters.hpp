@@ -0,0 +1,86 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+#ifndef KOKKOSP_PROFILING_COUNTERS_HPP
+#define KOKKOSP_PROFILING_COUNTERS_HPP
+
+#include <Kokkos_Macros.hpp>
+
+#include <cstdint>
+#include <string>
+
+namespace Kokkos {
+namespace Profiling {
+
+/** In-tree per-kernel hardware counter collection.
+ *
+ *  When enabled with KOKKOS_PROFILE_COUNTERS=1 in the environment, the
+ *  profiling begin/end hooks snapshot hardware counters (instructions,
+ *  cycles and last-level cache misses via perf_event on Linux hosts)
+ *  around every parallel dispatch and aggregate the deltas per kernel
+ *  name.  A report sorted by estimated memory traffic is written to
+ *  stderr from Profiling::finalize(), so bandwidth-bound kernels can be
+ *  identified in production batch jobs without attaching external
+ *  tools.  No external profiling library is required.
+ *
+ *  The perf events are opened with inheritance so that work executed by
+ *  worker threads spawned after initialization is counted; if the
+ *  kernel refuses the events (perf_event_paranoid, containers), the
+ *  report states that counters were unavailable and only wall times are
+ *  aggregated.
+ */
+
+bool counterCollectionEnabled();
+
+void initializeCounterCollection();
+void finalizeCounterCollection();
+
+void beginKernelCounters(const std::string& kernelName);
+void endKernelCounters();
+
+}  // namespace Profiling
+}  // namespace Kokkos
+
+#endif
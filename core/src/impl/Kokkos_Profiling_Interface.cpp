@@ -47,7 +47,13 @@
 #if defined(KOKKOS_ENABLE_PROFILING)
 
 #include <impl/Kokkos_Profiling_Interface.hpp>
+#include <impl/Kokkos_Profiling_Counters.hpp>
+#include <impl/Kokkos_Profiling_LatencyHistogram.hpp>
+#include <impl/Kokkos_FenceTelemetry.hpp>
 #include <cstring>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
 
 namespace Kokkos {
 namespace Profiling {
@@ -78,11 +84,48 @@ static destroyProfileSectionFunction destroySectionCallee = nullptr;
 
 static profileEventFunction profileEventCallee = nullptr;
 
+static tunePolicyFunction tunePolicyCallee = nullptr;
+
 SpaceHandle::SpaceHandle(const char* space_name) {
   strncpy(name, space_name, 64);
 }
 
-bool profileLibraryLoaded() { return (nullptr != initProfileLibrary); }
+bool profileLibraryLoaded() {
+  // in-tree counter collection uses the same dispatch hooks as an
+  // external library
+  return (nullptr != initProfileLibrary) || counterCollectionEnabled() ||
+         latencyHistogramEnabled();
+}
+
+namespace {
+
+// Kernel name registry: content-keyed, ids dense in first-intern
+// order.  A deque keeps the stored strings at stable addresses so the
+// returned references remain valid for the process lifetime.
+std::mutex kernel_name_mutex;
+std::deque<std::string> kernel_names;
+std::unordered_map<std::string, uint32_t> kernel_name_ids;
+
+uint32_t intern_kernel_name_locked(const char* name) {
+  auto it = kernel_name_ids.find(name);
+  if (it != kernel_name_ids.end()) return it->second;
+  const uint32_t id = static_cast<uint32_t>(kernel_names.size());
+  kernel_names.push_back(name);
+  kernel_name_ids.insert({kernel_names.back(), id});
+  return id;
+}
+
+}  // namespace
+
+std::string const& internKernelName(const char* name) {
+  std::lock_guard<std::mutex> lock(kernel_name_mutex);
+  return kernel_names[intern_kernel_name_locked(name)];
+}
+
+uint32_t internKernelNameId(const char* name) {
+  std::lock_guard<std::mutex> lock(kernel_name_mutex);
+  return intern_kernel_name_locked(name);
+}
 
 void beginParallelFor(const std::string& kernelPrefix, const uint32_t devID,
                       uint64_t* kernelID) {
@@ -90,6 +133,14 @@ void beginParallelFor(const std::string& kernelPrefix, const uint32_t devID,
     Kokkos::fence();
     (*beginForCallee)(kernelPrefix.c_str(), devID, kernelID);
   }
+  if (counterCollectionEnabled()) {
+    Kokkos::fence();
+    beginKernelCounters(kernelPrefix);
+  }
+  if (latencyHistogramEnabled()) {
+    Kokkos::fence();
+    latencyHistogramBegin(kernelPrefix.c_str());
+  }
 }
 
 void endParallelFor(const uint64_t kernelID) {
@@ -97,6 +148,14 @@ void endParallelFor(const uint64_t kernelID) {
     Kokkos::fence();
     (*endForCallee)(kernelID);
   }
+  if (counterCollectionEnabled()) {
+    Kokkos::fence();
+    endKernelCounters();
+  }
+  if (latencyHistogramEnabled()) {
+    Kokkos::fence();
+    latencyHistogramEnd();
+  }
 }
 
 void beginParallelScan(const std::string& kernelPrefix, const uint32_t devID,
@@ -105,6 +164,14 @@ void beginParallelScan(const std::string& kernelPrefix, const uint32_t devID,
     Kokkos::fence();
     (*beginScanCallee)(kernelPrefix.c_str(), devID, kernelID);
   }
+  if (counterCollectionEnabled()) {
+    Kokkos::fence();
+    beginKernelCounters(kernelPrefix);
+  }
+  if (latencyHistogramEnabled()) {
+    Kokkos::fence();
+    latencyHistogramBegin(kernelPrefix.c_str());
+  }
 }
 
 void endParallelScan(const uint64_t kernelID) {
@@ -112,6 +179,14 @@ void endParallelScan(const uint64_t kernelID) {
     Kokkos::fence();
     (*endScanCallee)(kernelID);
   }
+  if (counterCollectionEnabled()) {
+    Kokkos::fence();
+    endKernelCounters();
+  }
+  if (latencyHistogramEnabled()) {
+    Kokkos::fence();
+    latencyHistogramEnd();
+  }
 }
 
 void beginParallelReduce(const std::string& kernelPrefix, const uint32_t devID,
@@ -120,6 +195,14 @@ void beginParallelReduce(const std::string& kernelPrefix, const uint32_t devID,
     Kokkos::fence();
     (*beginReduceCallee)(kernelPrefix.c_str(), devID, kernelID);
   }
+  if (counterCollectionEnabled()) {
+    Kokkos::fence();
+    beginKernelCounters(kernelPrefix);
+  }
+  if (latencyHistogramEnabled()) {
+    Kokkos::fence();
+    latencyHistogramBegin(kernelPrefix.c_str());
+  }
 }
 
 void endParallelReduce(const uint64_t kernelID) {
@@ -127,6 +210,14 @@ void endParallelReduce(const uint64_t kernelID) {
     Kokkos::fence();
     (*endReduceCallee)(kernelID);
   }
+  if (counterCollectionEnabled()) {
+    Kokkos::fence();
+    endKernelCounters();
+  }
+  if (latencyHistogramEnabled()) {
+    Kokkos::fence();
+    latencyHistogramEnd();
+  }
 }
 
 void pushRegion(const std::string& kName) {
@@ -173,6 +264,15 @@ void endDeepCopy() {
   }
 }
 
+bool tuneLibraryLoaded() { return nullptr != tunePolicyCallee; }
+
+void tunePolicy(const std::string& kernelPrefix, const uint32_t devID,
+                PolicyTuning& tuning) {
+  if (nullptr != tunePolicyCallee) {
+    (*tunePolicyCallee)(kernelPrefix.c_str(), devID, &tuning);
+  }
+}
+
 void createProfileSection(const std::string& sectionName, uint32_t* secID) {
   if (nullptr != createSectionCallee) {
     (*createSectionCallee)(sectionName.c_str(), secID);
@@ -209,6 +309,10 @@ void initialize() {
   if (is_initialized) return;
   is_initialized = 1;
 
+  initializeCounterCollection();
+  initializeLatencyHistogram();
+  initializeFenceTelemetry();
+
   void* firstProfileLibrary;
 
   char* envProfileLibrary = getenv("KOKKOS_PROFILE_LIBRARY");
@@ -289,6 +393,9 @@ void initialize() {
 
       auto p19           = dlsym(firstProfileLibrary, "kokkosp_profile_event");
       profileEventCallee = *((profileEventFunction*)&p19);
+
+      auto p20         = dlsym(firstProfileLibrary, "kokkosp_tune_policy");
+      tunePolicyCallee = *((tunePolicyFunction*)&p20);
     }
   }
 
@@ -306,6 +413,10 @@ void finalize() {
   if (is_finalized) return;
   is_finalized = 1;
 
+  finalizeCounterCollection();
+  finalizeLatencyHistogram();
+  finalizeFenceTelemetry();
+
   if (nullptr != finalizeProfileLibrary) {
     (*finalizeProfileLibrary)();
 
@@ -337,6 +448,8 @@ void finalize() {
     destroySectionCallee = nullptr;
 
     profileEventCallee = nullptr;
+
+    tunePolicyCallee = nullptr;
   }
 }
 }  // namespace Profiling
@@ -378,6 +491,9 @@ void beginDeepCopy(const SpaceHandle, const std::string, const void*,
                    const uint64_t) {}
 void endDeepCopy() {}
 
+bool tuneLibraryLoaded() { return false; }
+void tunePolicy(const std::string&, const uint32_t, PolicyTuning&) {}
+
 void initialize() {}
 void finalize() {}
 
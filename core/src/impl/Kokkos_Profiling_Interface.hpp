@@ -95,6 +95,25 @@ typedef void (*beginDeepCopyFunction)(SpaceHandle, const char*, const void*,
                                       uint64_t);
 typedef void (*endDeepCopyFunction)();
 
+/// \brief Launch parameters a tuning tool may rewrite before dispatch.
+///
+/// The runtime fills this struct from the execution policy of a launch
+/// and passes it to the tool's kokkosp_tune_policy callback; fields the
+/// tool changes are applied to the policy before the launch is
+/// instantiated.  Fields that do not apply to the policy at hand are
+/// set to -1 (team_size, vector_length) or 0 (tile_rank) and changes to
+/// them are ignored.
+struct PolicyTuning {
+  int64_t work_size;      ///< range length or league size, informational
+  int32_t team_size;      ///< threads per team, -1 for non-team launches
+  int32_t vector_length;  ///< vector lanes, -1 when the policy stores none
+  int64_t chunk_size;     ///< scheduling granularity, 0 selects AUTO
+  int32_t tile_rank;      ///< number of valid tile[] entries, 0 if none
+  int64_t tile[8];        ///< MDRange tile extents
+};
+
+typedef void (*tunePolicyFunction)(const char*, const uint32_t, PolicyTuning*);
+
 bool profileLibraryLoaded();
 
 void beginParallelFor(const std::string& kernelPrefix, const uint32_t devID,
@@ -107,6 +126,17 @@ void beginParallelReduce(const std::string& kernelPrefix, const uint32_t devID,
                          uint64_t* kernelID);
 void endParallelReduce(const uint64_t kernelID);
 
+/// \brief Stable interned copy of a kernel name.
+///
+/// The same content always maps to the same storage, so repeated
+/// launches of a named kernel cost one registry lookup instead of a
+/// std::string construction per launch; the storage lives for the
+/// process lifetime, so tools may hold the reference or pointer.
+std::string const& internKernelName(const char* name);
+
+/// \brief Stable dense id for a kernel name, assigned on first intern.
+uint32_t internKernelNameId(const char* name);
+
 void pushRegion(const std::string& kName);
 void popRegion();
 
@@ -128,6 +158,13 @@ void beginDeepCopy(const SpaceHandle dst_space, const std::string dst_label,
                    const uint64_t size);
 void endDeepCopy();
 
+/// \brief True when the attached tool provides kokkosp_tune_policy.
+bool tuneLibraryLoaded();
+
+/// \brief Offer the launch parameters of a kernel to the tuning tool.
+void tunePolicy(const std::string& kernelPrefix, const uint32_t devID,
+                PolicyTuning& tuning);
+
 void initialize();
 void finalize();
 
@@ -171,6 +208,11 @@ void beginDeepCopy(const SpaceHandle, const std::string, const void*,
                    const uint64_t);
 void endDeepCopy();
 
+struct PolicyTuning;
+
+bool tuneLibraryLoaded();
+void tunePolicy(const std::string&, const uint32_t, PolicyTuning&);
+
 void initialize();
 void finalize();
 
@@ -0,0 +1,246 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+#include <Kokkos_Macros.hpp>
+
+#if defined(KOKKOS_ENABLE_PROFILING)
+
+#include <impl/Kokkos_Profiling_LatencyHistogram.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+namespace Kokkos {
+namespace Profiling {
+
+namespace {
+
+// Log-bucketed histogram: major bucket = floor(log2(ns)), eight linear
+// sub-buckets per major, covering 1ns .. ~584 years in 512 counters with
+// <= 12.5% relative error per bucket.
+enum : int { n_majors = 64, n_subs = 8, n_buckets = n_majors * n_subs };
+enum : int { max_kernels = 1024 };
+enum : int { max_pending = 16 };
+enum : int { name_capacity = 128 };
+
+struct KernelHistogram {
+  std::atomic<uint64_t> id;
+  char name[name_capacity];
+  std::atomic<uint64_t> buckets[n_buckets];
+  std::atomic<uint64_t> total_ns;
+};
+
+struct HistogramState {
+  bool enabled = false;
+  KernelHistogram* table = nullptr;  // max_kernels entries
+  struct Pending {
+    KernelHistogram* histogram;
+    std::chrono::steady_clock::time_point start;
+  } pending[max_pending];
+  int n_pending = 0;
+};
+
+HistogramState& state() {
+  static HistogramState s;
+  return s;
+}
+
+inline uint64_t hash_name(const char* name) {
+  // FNV-1a; a few ns for typical kernel names
+  uint64_t h = 1099511628211ull;
+  for (; *name; ++name) {
+    h = (h ^ uint64_t(uint8_t(*name))) * 1099511628211ull;
+  }
+  // zero is the empty-slot marker
+  return h == 0 ? 1 : h;
+}
+
+inline int bucket_index(uint64_t ns) {
+  int const major = 63 - __builtin_clzll(ns | 1);
+  int const sub =
+      major < 3 ? int(ns) & (n_subs - 1)
+                : int((ns >> (major - 3)) & (n_subs - 1));
+  return major * n_subs + sub;
+}
+
+inline double bucket_value(int index) {
+  int const major = index / n_subs;
+  int const sub   = index % n_subs;
+  double const base = double(uint64_t(1) << major);
+  return base + (sub + 0.5) * base / n_subs;
+}
+
+KernelHistogram* find_histogram(const char* name) {
+  uint64_t const id = hash_name(name);
+  auto* table       = state().table;
+  for (unsigned probe = 0; probe < max_kernels; ++probe) {
+    auto& slot = table[(id + probe) & (max_kernels - 1)];
+    uint64_t stored = slot.id.load(std::memory_order_acquire);
+    if (stored == id) return &slot;
+    if (stored == 0) {
+      // claim the slot; racing claimers for different names probe on
+      uint64_t expected = 0;
+      if (slot.id.compare_exchange_strong(expected, id,
+                                          std::memory_order_acq_rel)) {
+        strncpy(slot.name, name, name_capacity - 1);
+        slot.name[name_capacity - 1] = '\0';
+        return &slot;
+      }
+      if (expected == id) return &slot;
+    }
+  }
+  return nullptr;  // table full: drop the sample
+}
+
+}  // namespace
+
+bool latencyHistogramEnabled() { return state().enabled; }
+
+void initializeLatencyHistogram() {
+  char const* env = getenv("KOKKOS_PROFILE_LATENCY_HISTOGRAM");
+  if (env == nullptr || atoi(env) == 0) return;
+  state().table = new KernelHistogram[max_kernels]();
+  state().enabled = true;
+}
+
+void latencyHistogramBegin(const char* kernelName) {
+  auto& s = state();
+  if (!s.enabled || s.n_pending == max_pending) return;
+  auto& p     = s.pending[s.n_pending++];
+  p.histogram = find_histogram(kernelName);
+  p.start     = std::chrono::steady_clock::now();
+}
+
+void latencyHistogramEnd() {
+  auto const stop = std::chrono::steady_clock::now();
+  auto& s         = state();
+  if (!s.enabled || s.n_pending == 0) return;
+  auto const& p = s.pending[--s.n_pending];
+  if (p.histogram == nullptr) return;
+  uint64_t const ns = uint64_t(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(stop - p.start)
+          .count());
+  p.histogram->buckets[bucket_index(ns)].fetch_add(
+      1, std::memory_order_relaxed);
+  p.histogram->total_ns.fetch_add(ns, std::memory_order_relaxed);
+}
+
+void finalizeLatencyHistogram() {
+  auto& s = state();
+  if (!s.enabled) return;
+  s.enabled = false;
+
+  struct Row {
+    KernelHistogram* h;
+    uint64_t count;
+  };
+  std::vector<Row> rows;
+  for (int i = 0; i < max_kernels; ++i) {
+    auto& h = s.table[i];
+    if (h.id.load(std::memory_order_relaxed) == 0) continue;
+    uint64_t count = 0;
+    for (int b = 0; b < n_buckets; ++b)
+      count += h.buckets[b].load(std::memory_order_relaxed);
+    if (count) rows.push_back({&h, count});
+  }
+  std::sort(rows.begin(), rows.end(), [](Row const& a, Row const& b) {
+    return a.h->total_ns.load(std::memory_order_relaxed) >
+           b.h->total_ns.load(std::memory_order_relaxed);
+  });
+
+  std::cerr << "Kokkos kernel latency histogram:\n";
+  for (auto const& row : rows) {
+    auto& h = *row.h;
+    double const quantiles[3] = {0.50, 0.90, 0.99};
+    double values[3]          = {0, 0, 0};
+    double max_value          = 0;
+    uint64_t seen             = 0;
+    int iq                    = 0;
+    for (int b = 0; b < n_buckets; ++b) {
+      uint64_t const c = h.buckets[b].load(std::memory_order_relaxed);
+      if (c == 0) continue;
+      seen += c;
+      max_value = bucket_value(b);
+      while (iq < 3 && double(seen) >= quantiles[iq] * double(row.count)) {
+        values[iq++] = bucket_value(b);
+      }
+    }
+    std::cerr << "  " << h.name << ": count=" << row.count << " mean="
+              << double(h.total_ns.load(std::memory_order_relaxed)) /
+                     double(row.count) * 1e-3
+              << "us p50=" << values[0] * 1e-3 << "us p90=" << values[1] * 1e-3
+              << "us p99=" << values[2] * 1e-3 << "us max~=" << max_value * 1e-3
+              << "us\n";
+  }
+
+  delete[] s.table;
+  s.table = nullptr;
+}
+
+}  // namespace Profiling
+}  // namespace Kokkos
+
+#else
+
+#include <impl/Kokkos_Profiling_LatencyHistogram.hpp>
+
+namespace Kokkos {
+namespace Profiling {
+
+bool latencyHistogramEnabled() { return false; }
+void initializeLatencyHistogram() {}
+void finalizeLatencyHistogram() {}
+void latencyHistogramBegin(const char*) {}
+void latencyHistogramEnd() {}
+
+}  // namespace Profiling
+}  // namespace Kokkos
+
+#endif
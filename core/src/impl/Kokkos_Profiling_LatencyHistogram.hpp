@@ -0,0 +1,85 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+#ifndef KOKKOSP_PROFILING_LATENCY_HISTOGRAM_HPP
+#define KOKKOSP_PROFILING_LATENCY_HISTOGRAM_HPP
+
+#include <Kokkos_Macros.hpp>
+
+#include <cstdint>
+#include <string>
+
+namespace Kokkos {
+namespace Profiling {
+
+/** Always-on lightweight kernel latency histogram.
+ *
+ *  When enabled with KOKKOS_PROFILE_LATENCY_HISTOGRAM=1 in the
+ *  environment, every parallel dispatch records its duration into a
+ *  per-kernel log-bucketed (HDR-style) histogram.  The record path does
+ *  no allocation, no locking and no string handling beyond a hash of
+ *  the kernel name to its histogram slot: one clock read at begin, one
+ *  clock read plus a relaxed atomic bucket increment at end.  Kernels
+ *  are keyed by the hash, so distinct dispatches of the same name
+ *  accumulate into one histogram.
+ *
+ *  Profiling::finalize() dumps count, mean and p50/p90/p99/max per
+ *  kernel, which makes latency outliers (e.g. device throttling events)
+ *  visible from production runs where callback-based profiling
+ *  connectors are too expensive.
+ */
+
+bool latencyHistogramEnabled();
+
+void initializeLatencyHistogram();
+void finalizeLatencyHistogram();
+
+void latencyHistogramBegin(const char* kernelName);
+void latencyHistogramEnd();
+
+}  // namespace Profiling
+}  // namespace Kokkos
+
+#endif
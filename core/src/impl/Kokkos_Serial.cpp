@@ -52,6 +52,7 @@
 #include <impl/Kokkos_Error.hpp>
 
 #include <impl/Kokkos_SharedAlloc.hpp>
+#include <impl/Kokkos_Profiling_Interface.hpp>
 
 /*--------------------------------------------------------------------------*/
 
@@ -94,6 +95,16 @@ void serial_resize_thread_team_data(size_t pool_reduce_bytes,
       g_serial_thread_team_data.disband_team();
       g_serial_thread_team_data.disband_pool();
 
+#if defined(KOKKOS_ENABLE_PROFILING)
+      if (Kokkos::Profiling::profileLibraryLoaded()) {
+        Kokkos::Profiling::deallocateData(
+            Kokkos::Profiling::SpaceHandle(space.name()),
+            "InternalThreadTeamData",
+            g_serial_thread_team_data.scratch_buffer(),
+            g_serial_thread_team_data.scratch_bytes());
+      }
+#endif
+
       space.deallocate(g_serial_thread_team_data.scratch_buffer(),
                        g_serial_thread_team_data.scratch_bytes());
     }
@@ -123,6 +134,14 @@ void serial_resize_thread_team_data(size_t pool_reduce_bytes,
       Kokkos::Impl::throw_runtime_exception(failure.get_error_message());
     }
 
+#if defined(KOKKOS_ENABLE_PROFILING)
+    if (Kokkos::Profiling::profileLibraryLoaded()) {
+      Kokkos::Profiling::allocateData(
+          Kokkos::Profiling::SpaceHandle(space.name()),
+          "InternalThreadTeamData", ptr, alloc_bytes);
+    }
+#endif
+
     g_serial_thread_team_data.scratch_assign(
         ((char*)ptr), alloc_bytes, pool_reduce_bytes, team_reduce_bytes,
         team_shared_bytes, thread_local_bytes);
@@ -138,6 +157,31 @@ HostThreadTeamData* serial_get_thread_team_data() {
   return &g_serial_thread_team_data;
 }
 
+// Release the retained thread team data scratch memory; the next
+// parallel dispatch reallocates at its own requested sizes.
+void serial_trim_thread_team_data() {
+  if (g_serial_thread_team_data.scratch_buffer()) {
+    g_serial_thread_team_data.disband_team();
+    g_serial_thread_team_data.disband_pool();
+
+    Kokkos::HostSpace space;
+
+#if defined(KOKKOS_ENABLE_PROFILING)
+    if (Kokkos::Profiling::profileLibraryLoaded()) {
+      Kokkos::Profiling::deallocateData(
+          Kokkos::Profiling::SpaceHandle(space.name()),
+          "InternalThreadTeamData", g_serial_thread_team_data.scratch_buffer(),
+          g_serial_thread_team_data.scratch_bytes());
+    }
+#endif
+
+    space.deallocate(g_serial_thread_team_data.scratch_buffer(),
+                     g_serial_thread_team_data.scratch_bytes());
+
+    g_serial_thread_team_data.scratch_assign((void*)0, 0, 0, 0, 0, 0);
+  }
+}
+
 }  // namespace Impl
 }  // namespace Kokkos
 
@@ -183,17 +227,7 @@ void Serial::finalize()
 void Serial::impl_finalize()
 #endif
 {
-  if (Impl::g_serial_thread_team_data.scratch_buffer()) {
-    Impl::g_serial_thread_team_data.disband_team();
-    Impl::g_serial_thread_team_data.disband_pool();
-
-    Kokkos::HostSpace space;
-
-    space.deallocate(Impl::g_serial_thread_team_data.scratch_buffer(),
-                     Impl::g_serial_thread_team_data.scratch_bytes());
-
-    Impl::g_serial_thread_team_data.scratch_assign((void*)0, 0, 0, 0, 0, 0);
-  }
+  Impl::serial_trim_thread_team_data();
 
 #if defined(KOKKOS_ENABLE_PROFILING)
   Kokkos::Profiling::finalize();
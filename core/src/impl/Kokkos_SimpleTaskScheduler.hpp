@@ -414,6 +414,71 @@ class SimpleTaskScheduler
                                  std::forward<FunctorType>(arg_functor));
   }
 
+  /**\brief Spawn \c count independent single tasks in one call.
+   *
+   *  Amortizes the per-task setup of a task_spawn loop: the apply and
+   *  destroy function pointers are resolved once for the whole batch and
+   *  the spawned tasks are made visible with one memory fence per chunk
+   *  rather than one per task.  Each task record is still allocated from
+   *  the queue's memory pool individually, since completed tasks are
+   *  deallocated one at a time.
+   *
+   *  The generator is invoked as generator(i) for i in [0, count) and
+   *  must return the functor for task i.  The spawned tasks have no
+   *  predecessors and no futures are returned (the reference count
+   *  starts at one, for the completion decrement), so dependencies on
+   *  them must be expressed by the spawned functors themselves.
+   */
+  template <class FunctorGenerator>
+  void spawn_batch(int count, FunctorGenerator&& generator,
+                   TaskPriority priority = TaskPriority::Regular) {
+    using functor_type = typename std::decay<decltype(generator(0))>::type;
+    using task_type    = runnable_task_type<functor_type>;
+
+    KOKKOS_EXPECTS(m_queue != nullptr);
+
+    // May be spawning Cuda tasks, must use the specialization to query
+    // the on-device function pointers (resolved once for the batch)
+    typename task_type::function_type ptr;
+    typename task_type::destroy_type dtor;
+    Kokkos::Impl::TaskQueueSpecialization<
+        SimpleTaskScheduler>::template get_function_pointer<task_type>(ptr,
+                                                                       dtor);
+    (void)dtor;
+
+    constexpr int chunk_size = 32;
+    task_type* chunk[chunk_size];
+
+    for (int chunk_begin = 0; chunk_begin < count; chunk_begin += chunk_size) {
+      int const n =
+          count - chunk_begin < chunk_size ? count - chunk_begin : chunk_size;
+      for (int i = 0; i < n; ++i) {
+        auto& runnable_task =
+            *m_queue->template allocate_and_construct<task_type>(
+                /* functor = */ generator(chunk_begin + i),
+                /* apply_function_ptr = */ ptr,
+                /* task_type = */ Impl::TaskType::TaskSingle,
+                /* priority = */ priority,
+                /* queue_base = */ m_queue,
+                /* initial_reference_count = */ 1);
+        m_queue->initialize_scheduling_info_from_team_scheduler_info(
+            runnable_task, team_scheduler_info());
+        chunk[i] = &runnable_task;
+      }
+
+      // one fence for the whole chunk to ensure the stores constructing
+      // the tasks are visible before any of them can be popped and run
+      Kokkos::memory_fence();
+
+      for (int i = 0; i < n; ++i) {
+        m_queue->schedule_runnable(std::move(*chunk[i]),
+                                   team_scheduler_info());
+        // note that the task may be already completed even here, so don't
+        // touch it again
+      }
+    }
+  }
+
   template <class FunctorType, class ValueType, class Scheduler>
   KOKKOS_FUNCTION static void respawn(
       FunctorType* functor,
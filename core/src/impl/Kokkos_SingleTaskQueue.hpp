@@ -60,6 +60,7 @@
 #include <impl/Kokkos_TaskQueueCommon.hpp>
 #include <impl/Kokkos_Memory_Fence.hpp>
 #include <impl/Kokkos_Atomic_Increment.hpp>
+#include <Kokkos_Atomic.hpp>
 #include <impl/Kokkos_OptionalRef.hpp>
 #include <impl/Kokkos_LIFO.hpp>
 
@@ -113,9 +114,16 @@ class SingleTaskQueue
   // Number of allowed priorities
   static constexpr int NumQueue = 3;
 
+  // Every this many pops, service the queues lowest priority first so
+  // that a steady stream of high-priority tasks cannot starve the rest
+  static constexpr int32_t StarvationAgingPeriod = 16;
+
  private:
   ready_queue_type m_ready_queues[NumQueue][2];
 
+  // Pops since the last aging pass; see pop_ready_task
+  int32_t m_pop_count = 0;
+
  public:
   //----------------------------------------------------------------------------
   // <editor-fold desc="Constructors, destructors, and assignment"> {{{2
@@ -157,8 +165,13 @@ class SingleTaskQueue
       team_scheduler_info_type const& info) {
     OptionalRef<task_base_type> return_value;
     // always loop in order of priority first, then prefer team tasks over
-    // single tasks
-    for (int i_priority = 0; i_priority < NumQueue; ++i_priority) {
+    // single tasks; periodically invert the priority order as an aging
+    // mechanism for the lower-priority queues
+    bool const aging_pass =
+        Kokkos::atomic_fetch_add(&m_pop_count, 1) % StarvationAgingPeriod ==
+        StarvationAgingPeriod - 1;
+    for (int i = 0; i < NumQueue; ++i) {
+      int const i_priority = aging_pass ? NumQueue - 1 - i : i;
       // Check for a team task with this priority
       return_value = m_ready_queues[i_priority][TaskTeam].pop();
       if (return_value) return return_value;
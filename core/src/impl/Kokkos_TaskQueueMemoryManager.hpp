@@ -94,6 +94,12 @@ class TaskQueueMemoryManager : public TaskQueueBase {
     void* pointer;
   };
 
+  // Transient pool exhaustion is expected when deep task recursions spawn
+  // from within running tasks: blocks are returned to the pool as
+  // concurrently running tasks complete, so retry for a while before
+  // giving up
+  enum : int { allocation_retry_limit = 4096 };
+
   KOKKOS_INLINE_FUNCTION
   _allocation_result _do_pool_allocate(allocation_size_type requested_size) {
     // KOKKOS_EXPECTS(requested_size >= 0); generates a warning when
@@ -102,6 +108,11 @@ class TaskQueueMemoryManager : public TaskQueueBase {
       return {true, nullptr};
     } else {
       void* data = m_pool.allocate(static_cast<size_t>(requested_size));
+      for (int i_attempt = 0;
+           data == nullptr && i_attempt < allocation_retry_limit;
+           ++i_attempt) {
+        data = m_pool.allocate(static_cast<size_t>(requested_size));
+      }
 
       // Kokkos::atomic_increment(&m_accum_alloc); // memory_order_relaxed
       Kokkos::atomic_increment(&m_count_alloc);  // memory_order_relaxed
@@ -154,7 +165,13 @@ class TaskQueueMemoryManager : public TaskQueueBase {
 
     auto result = _do_pool_allocate(allocation_size);
 
-    KOKKOS_ASSERT(result.success && "Memory allocation failure");
+    if (!result.success) {
+      // constructing at a null pointer would silently corrupt memory in
+      // release builds; fail loudly instead
+      Kokkos::abort(
+          "TaskQueueMemoryManager: memory pool exhausted; increase the "
+          "scheduler's memory pool size");
+    }
 
     auto rv = _do_contruct<T>(result.pointer, allocation_size,
                               std::forward<Args>(args)...);
@@ -186,7 +203,13 @@ class TaskQueueMemoryManager : public TaskQueueBase {
         vla_emulation_base::required_allocation_size(n_vla_entries);
     auto result = _do_pool_allocate(allocation_size);
 
-    KOKKOS_ASSERT(result.success && "Memory allocation failure");
+    if (!result.success) {
+      // constructing at a null pointer would silently corrupt memory in
+      // release builds; fail loudly instead
+      Kokkos::abort(
+          "TaskQueueMemoryManager: memory pool exhausted; increase the "
+          "scheduler's memory pool size");
+    }
 
     auto rv = _do_contruct<T>(result.pointer, allocation_size,
                               std::forward<Args>(args)...);
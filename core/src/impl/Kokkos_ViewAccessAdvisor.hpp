@@ -0,0 +1,247 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+/// \file Kokkos_ViewAccessAdvisor.hpp
+/// \brief Opt-in access-pattern sampling behind View::operator().
+///
+/// Compiling with KOKKOS_ENABLE_VIEW_ACCESS_PROFILING makes every host
+/// View access tick a thread-local countdown; when it expires the next
+/// two consecutive accesses to the same View are captured as a pair and
+/// the index delta between them is classified: unit step in the first
+/// index, unit step in the last index, or a jump.  Classification
+/// happens once per ~500 accesses, so the steady-state cost is a
+/// decrement and a predictable branch.  At process exit the per-View
+/// tallies are compared against each View's declared layout and traits
+/// and mismatches are reported to stderr - a LayoutLeft View traversed
+/// row-wise, a gather-dominated View without the RandomAccess trait.
+///
+/// Device-side accesses are not sampled; run the kernels of interest in
+/// a host build to profile them.
+
+#ifndef KOKKOS_VIEWACCESSADVISOR_HPP
+#define KOKKOS_VIEWACCESSADVISOR_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_Layout.hpp>
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace Kokkos {
+namespace Impl {
+
+struct ViewAccessRecord {
+  std::string label;
+  unsigned rank;
+  int layout;  // 0 == LayoutLeft, 1 == LayoutRight, 2 == other
+  bool random_access;
+  uint64_t pairs;       // consecutive-access pairs classified
+  uint64_t unit_first;  // unit step in the first index
+  uint64_t unit_last;   // unit step in the last index
+  uint64_t jump;        // everything else
+
+  ViewAccessRecord()
+      : label(),
+        rank(0),
+        layout(2),
+        random_access(false),
+        pairs(0),
+        unit_first(0),
+        unit_last(0),
+        jump(0) {}
+};
+
+/* Countdown between sampled pairs.  Prime, so that loop trip counts do
+ * not resonate with the sampling and always capture the same phase. */
+enum : unsigned { view_access_sample_interval = 509 };
+
+// One armed-pair capture per thread; arming is rare so the only
+// per-access cost is the countdown and the disarmed branch.
+struct ViewAccessThreadState {
+  unsigned countdown;
+  unsigned rank;
+  bool armed;
+  const void* ptr;
+  int64_t idx[9];
+};
+
+inline ViewAccessThreadState& view_access_thread_state() {
+  static thread_local ViewAccessThreadState state = {
+      view_access_sample_interval, 0, false, nullptr, {0}};
+  return state;
+}
+
+void view_access_advisor_report();
+
+inline std::mutex& view_access_registry_mutex() {
+  static std::mutex mtx;
+  return mtx;
+}
+
+inline std::map<const void*, ViewAccessRecord>& view_access_registry() {
+  static std::map<const void*, ViewAccessRecord>* registry = []() {
+    std::atexit(view_access_advisor_report);
+    return new std::map<const void*, ViewAccessRecord>();
+  }();
+  return *registry;
+}
+
+/// \brief Compare per-View tallies against the declared layout and
+///        print recommendations.  Runs at process exit.
+inline void view_access_advisor_report() {
+  std::lock_guard<std::mutex> lock(view_access_registry_mutex());
+  for (auto& entry : view_access_registry()) {
+    const ViewAccessRecord& r = entry.second;
+    if (r.pairs < 32) continue;  // too few pairs to trust
+
+    const char* const name =
+        r.label.empty() ? "(unlabeled view)" : r.label.c_str();
+
+    std::cerr << "Kokkos::ViewAccessAdvisor: \"" << name << "\" rank "
+              << r.rank << " "
+              << (r.layout == 0 ? "LayoutLeft"
+                                : r.layout == 1 ? "LayoutRight" : "layout")
+              << ": " << r.pairs << " sampled pairs, " << r.unit_first
+              << " unit-first, " << r.unit_last << " unit-last, " << r.jump
+              << " jumps" << std::endl;
+
+    if (2 <= r.rank && r.layout == 0 && r.unit_last > 4 * r.unit_first) {
+      std::cerr << "Kokkos::ViewAccessAdvisor:   traversal varies the last "
+                   "index fastest; LayoutRight would make it stride-one"
+                << std::endl;
+    }
+    if (2 <= r.rank && r.layout == 1 && r.unit_first > 4 * r.unit_last) {
+      std::cerr << "Kokkos::ViewAccessAdvisor:   traversal varies the first "
+                   "index fastest; LayoutLeft would make it stride-one"
+                << std::endl;
+    }
+    if (!r.random_access && r.jump > 2 * (r.unit_first + r.unit_last)) {
+      std::cerr << "Kokkos::ViewAccessAdvisor:   accesses are "
+                   "gather-dominated; consider the RandomAccess memory trait"
+                << std::endl;
+    }
+  }
+}
+
+/// \brief Classify the index delta of an armed pair and merge it into
+///        the per-View tally.  Called once per sampled pair.
+template <class Layout, class MemorySpace, bool RandomAccess, class Track>
+inline void view_access_commit(const Track& track, const void* const ptr,
+                               const unsigned rank, const int64_t prev[],
+                               const int64_t cur[]) {
+  unsigned changed = 0;
+  unsigned which   = 0;
+  int64_t delta    = 0;
+  for (unsigned r = 0; r < rank; ++r) {
+    if (cur[r] != prev[r]) {
+      ++changed;
+      which = r;
+      delta = cur[r] - prev[r];
+    }
+  }
+  if (changed == 0) return;  // re-read of the same element
+
+  std::lock_guard<std::mutex> lock(view_access_registry_mutex());
+  ViewAccessRecord& rec = view_access_registry()[ptr];
+  if (rec.pairs == 0) {
+    rec.label = track.template get_label<MemorySpace>();
+    rec.rank  = rank;
+    rec.layout =
+        std::is_same<Layout, Kokkos::LayoutLeft>::value
+            ? 0
+            : std::is_same<Layout, Kokkos::LayoutRight>::value ? 1 : 2;
+    rec.random_access = RandomAccess;
+  }
+  ++rec.pairs;
+  if (changed == 1 && (delta == 1 || delta == -1)) {
+    if (which == 0) ++rec.unit_first;
+    if (which == rank - 1) ++rec.unit_last;
+  } else {
+    ++rec.jump;
+  }
+}
+
+/** \brief  Per-access sampling hook expanded inside View::operator().
+ *
+ *  Host accesses only; in device code this is a no-op.
+ */
+template <class Layout, class MemorySpace, bool RandomAccess, class Track,
+          class Map, class... Is>
+KOKKOS_FORCEINLINE_FUNCTION void view_access_sample(const Track& track,
+                                                    const Map& map,
+                                                    Is... is) {
+#if !defined(__CUDA_ARCH__) && !defined(__HIP_DEVICE_COMPILE__)
+  ViewAccessThreadState& state = view_access_thread_state();
+
+  const unsigned rank = unsigned(sizeof...(Is));
+  const int64_t cur[sizeof...(Is) + 1] = {static_cast<int64_t>(is)..., 0};
+
+  if (state.armed) {
+    state.armed     = false;
+    state.countdown = view_access_sample_interval;
+    if (state.ptr == (const void*)map.data() && state.rank == rank) {
+      view_access_commit<Layout, MemorySpace, RandomAccess>(
+          track, state.ptr, rank, state.idx, cur);
+    }
+    // A pair split across two views says nothing about either; discard.
+  } else if (0 == --state.countdown) {
+    state.armed = true;
+    state.ptr   = (const void*)map.data();
+    state.rank  = rank;
+    for (unsigned r = 0; r < rank; ++r) state.idx[r] = cur[r];
+  }
+#else
+  (void)track;
+  (void)map;
+#endif
+}
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_VIEWACCESSADVISOR_HPP */
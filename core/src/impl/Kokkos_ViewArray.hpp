@@ -409,12 +409,14 @@ class ViewMapping<Traits, Kokkos::Array<> > {
           handle_type(reinterpret_cast<pointer_type>(record->data()));
 
       if (alloc_prop::initialize) {
-        // The functor constructs and destroys
+        // The functor constructs and destroys.  A caller-provided
+        // execution space instance makes construction asynchronous.
         record->m_destroy = functor_type(
             ((Kokkos::Impl::ViewCtorProp<void, execution_space> const &)
                  arg_prop)
                 .value,
-            (pointer_type)m_impl_handle, m_impl_offset.span() * Array_N);
+            (pointer_type)m_impl_handle, m_impl_offset.span() * Array_N,
+            !alloc_prop::has_execution_space);
 
         record->m_destroy.construct_shared_allocation();
       }
@@ -74,6 +74,7 @@ namespace Impl {
 
 struct WithoutInitializing_t {};
 struct AllowPadding_t {};
+struct HugePages_t {};
 struct NullSpace_t {};
 
 //----------------------------------------------------------------------------
@@ -135,7 +136,8 @@ struct ViewCtorProp<void, std::integral_constant<unsigned, I> > {
 template <typename P>
 struct ViewCtorProp<typename std::enable_if<
                         std::is_same<P, AllowPadding_t>::value ||
-                        std::is_same<P, WithoutInitializing_t>::value>::type,
+                        std::is_same<P, WithoutInitializing_t>::value ||
+                        std::is_same<P, HugePages_t>::value>::type,
                     P> {
   ViewCtorProp()                     = default;
   ViewCtorProp(const ViewCtorProp &) = default;
@@ -216,6 +218,7 @@ struct ViewCtorProp : public ViewCtorProp<void, P>... {
   enum { has_pointer = var_pointer::value };
   enum { has_label = Kokkos::Impl::has_type<std::string, P...>::value };
   enum { allow_padding = Kokkos::Impl::has_type<AllowPadding_t, P...>::value };
+  enum { huge_pages = Kokkos::Impl::has_type<HugePages_t, P...>::value };
   enum {
     initialize = !Kokkos::Impl::has_type<WithoutInitializing_t, P...>::value
   };
@@ -244,6 +247,59 @@ struct ViewCtorProp : public ViewCtorProp<void, P>... {
 } /* namespace Impl */
 } /* namespace Kokkos */
 
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+
+class HostSpace;  // Declared in Kokkos_HostSpace.hpp
+
+#if defined(KOKKOS_ENABLE_HBWSPACE)
+namespace Experimental {
+class HBWSpace;  // Declared in Kokkos_HBWSpace.hpp
+}  // namespace Experimental
+#endif
+
+namespace Impl {
+
+/* Given a memory space instance return an instance that backs its
+ * allocations with explicit huge pages, when the space has such an
+ * allocation mechanism.  Spaces without one return the instance
+ * unchanged, so requesting huge pages degrades gracefully.  Used by
+ * View allocation when the Kokkos::HugePages property is given.
+ */
+template <class Space>
+inline Space with_huge_pages(const Space &arg_space) {
+  return arg_space;
+}
+
+HostSpace with_huge_pages(const HostSpace &);
+
+#if defined(KOKKOS_ENABLE_HBWSPACE)
+Kokkos::Experimental::HBWSpace with_huge_pages(
+    const Kokkos::Experimental::HBWSpace &);
+#endif
+
+/* Given a memory space instance and an execution space instance return
+ * a memory space instance that enqueues allocation and deallocation on
+ * the execution space instance's stream (stream-ordered allocation),
+ * when the space has such a mechanism.  Other combinations return the
+ * instance unchanged, so the request degrades gracefully to synchronous
+ * allocation.  Used by View allocation when view_alloc was given an
+ * execution space instance.
+ */
+template <class Space, class ExecSpace>
+inline Space with_stream_ordered(const Space &arg_space, const ExecSpace &) {
+  return arg_space;
+}
+
+#if defined(KOKKOS_ENABLE_CUDA)
+Kokkos::CudaSpace with_stream_ordered(const Kokkos::CudaSpace &,
+                                      const Kokkos::Cuda &);
+#endif
+
+} /* namespace Impl */
+} /* namespace Kokkos */
+
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
 
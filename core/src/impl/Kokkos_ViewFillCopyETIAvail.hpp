@@ -121,6 +121,9 @@ struct ViewFillETIAvail {
 #ifdef KOKKOS_ENABLE_ROCM
 #include <ROCm/Kokkos_ROCm_ViewCopyETIAvail.hpp>
 #endif
+#ifdef KOKKOS_ETI_USER_TYPES
+#include <KokkosCore_ETI_UserAvail.hpp>
+#endif
 #endif
 
 #endif
@@ -136,5 +136,8 @@ namespace Impl {
 #ifdef KOKKOS_ENABLE_ROCM
 #include <ROCm/Kokkos_ROCm_ViewCopyETIDecl.hpp>
 #endif
+#ifdef KOKKOS_ETI_USER_TYPES
+#include <KokkosCore_ETI_UserDecl.hpp>
+#endif
 #endif
 #endif
@@ -45,12 +45,14 @@
 #ifndef KOKKOS_EXPERIMENTAL_VIEW_MAPPING_HPP
 #define KOKKOS_EXPERIMENTAL_VIEW_MAPPING_HPP
 
+#include <cstdlib>
 #include <type_traits>
 #include <initializer_list>
 
 #include <Kokkos_Core_fwd.hpp>
 #include <Kokkos_Pair.hpp>
 #include <Kokkos_Layout.hpp>
+#include <Kokkos_hwloc.hpp>
 #include <Kokkos_Extents.hpp>
 #include <impl/Kokkos_Error.hpp>
 #include <impl/Kokkos_Traits.hpp>
@@ -2734,6 +2736,35 @@ namespace Impl {
  *  called from the shared memory tracking destruction.
  *  Secondarily to have two fewer partial specializations.
  */
+/* On a multi-NUMA-node host the operating system binds each page of a
+ * fresh allocation to the NUMA node of the thread that first touches it.
+ * The initialization fill below is that first touch, and the host
+ * back-ends hand each thread the same contiguous partition of [0..n)
+ * that a default RangePolicy gives the user's kernels.  Chunking the
+ * fill at page granularity additionally keeps every page inside a
+ * single thread's partition, so no page is split across NUMA nodes.
+ * Enabled when hwloc reports more than one available NUMA region;
+ * force on or off with KOKKOS_NUMA_AWARE_INIT=1/0.
+ *
+ * Returns the chunk size in elements, or zero to keep the default
+ * partition granularity.
+ */
+inline size_t view_value_init_chunk(const size_t value_size) {
+  static int enabled = -1;
+  if (enabled < 0) {
+    const char* const env = getenv("KOKKOS_NUMA_AWARE_INIT");
+    enabled               = env ? (atoi(env) ? 1 : 0)
+                  : (1 < Kokkos::hwloc::get_available_numa_count() ? 1 : 0);
+  }
+  if (0 == enabled || 0 == value_size) return 0;
+  enum : size_t { page_bytes = 4096 };
+  // RangePolicy requires a power-of-two chunk; round up to the first
+  // power of two covering at least one page.
+  size_t chunk = 1;
+  while (chunk * value_size < page_bytes) chunk <<= 1;
+  return chunk;
+}
+
 template <class ExecSpace, class ValueType,
           bool IsScalar = std::is_scalar<ValueType>::value>
 struct ViewValueFunctor;
@@ -2747,6 +2778,7 @@ struct ViewValueFunctor<ExecSpace, ValueType, false /* is_scalar */> {
   ValueType* ptr;
   size_t n;
   bool destroy;
+  bool fence;
 
   KOKKOS_INLINE_FUNCTION
   void operator()(const size_t i) const {
@@ -2764,8 +2796,9 @@ struct ViewValueFunctor<ExecSpace, ValueType, false /* is_scalar */> {
   ViewValueFunctor& operator=(const ViewValueFunctor&) = default;
 
   ViewValueFunctor(ExecSpace const& arg_space, ValueType* const arg_ptr,
-                   size_t const arg_n)
-      : space(arg_space), ptr(arg_ptr), n(arg_n), destroy(false) {}
+                   size_t const arg_n, bool const arg_fence = true)
+      : space(arg_space), ptr(arg_ptr), n(arg_n), destroy(false),
+        fence(arg_fence) {}
 
   void execute(bool arg) {
     destroy = arg;
@@ -2779,10 +2812,21 @@ struct ViewValueFunctor<ExecSpace, ValueType, false /* is_scalar */> {
             0, &kpID);
       }
 #endif
+      const size_t chunk =
+          std::is_same<typename Exec::memory_space, Kokkos::HostSpace>::value
+              ? view_value_init_chunk(sizeof(ValueType))
+              : 0;
+      const PolicyType policy = chunk
+                                    ? PolicyType(0, n, ChunkSize(int(chunk)))
+                                    : PolicyType(0, n);
       const Kokkos::Impl::ParallelFor<ViewValueFunctor, PolicyType> closure(
-          *this, PolicyType(0, n));
+          *this, policy);
       closure.execute();
-      space.fence();
+      // When constructing on a caller-provided execution space instance
+      // the construction is enqueued on that instance and the caller
+      // synchronizes; destruction always fences since the memory is
+      // deallocated immediately afterwards.
+      if (destroy || fence) space.fence();
 #if defined(KOKKOS_ENABLE_PROFILING)
       if (Kokkos::Profiling::profileLibraryLoaded()) {
         Kokkos::Profiling::endParallelFor(kpID);
@@ -2805,6 +2849,7 @@ struct ViewValueFunctor<ExecSpace, ValueType, true /* is_scalar */> {
   ExecSpace space;
   ValueType* ptr;
   size_t n;
+  bool fence;
 
   KOKKOS_INLINE_FUNCTION
   void operator()(const size_t i) const { ptr[i] = ValueType(); }
@@ -2814,8 +2859,8 @@ struct ViewValueFunctor<ExecSpace, ValueType, true /* is_scalar */> {
   ViewValueFunctor& operator=(const ViewValueFunctor&) = default;
 
   ViewValueFunctor(ExecSpace const& arg_space, ValueType* const arg_ptr,
-                   size_t const arg_n)
-      : space(arg_space), ptr(arg_ptr), n(arg_n) {}
+                   size_t const arg_n, bool const arg_fence = true)
+      : space(arg_space), ptr(arg_ptr), n(arg_n), fence(arg_fence) {}
 
   void construct_shared_allocation() {
     if (!space.in_parallel()) {
@@ -2826,10 +2871,18 @@ struct ViewValueFunctor<ExecSpace, ValueType, true /* is_scalar */> {
                                             &kpID);
       }
 #endif
+      const size_t chunk =
+          std::is_same<typename ExecSpace::memory_space,
+                       Kokkos::HostSpace>::value
+              ? view_value_init_chunk(sizeof(ValueType))
+              : 0;
+      const PolicyType policy = chunk
+                                    ? PolicyType(0, n, ChunkSize(int(chunk)))
+                                    : PolicyType(0, n);
       const Kokkos::Impl::ParallelFor<ViewValueFunctor, PolicyType> closure(
-          *this, PolicyType(0, n));
+          *this, policy);
       closure.execute();
-      space.fence();
+      if (fence) space.fence();
 #if defined(KOKKOS_ENABLE_PROFILING)
       if (Kokkos::Profiling::profileLibraryLoaded()) {
         Kokkos::Profiling::endParallelFor(kpID);
@@ -3146,10 +3199,18 @@ class ViewMapping<
         (m_impl_offset.span() * MemorySpanSize + MemorySpanMask) &
         ~size_t(MemorySpanMask);
 
-    // Create shared memory tracking record with allocate memory from the memory
-    // space
+    // Create shared memory tracking record with allocate memory from the
+    // memory space.  When huge pages are requested substitute an instance
+    // of the memory space that allocates with explicit huge pages, if the
+    // space provides one.
     record_type* const record = record_type::allocate(
-        ((Kokkos::Impl::ViewCtorProp<void, memory_space> const&)arg_prop).value,
+        alloc_prop::huge_pages
+            ? Kokkos::Impl::with_huge_pages(
+                  ((Kokkos::Impl::ViewCtorProp<void, memory_space> const&)
+                       arg_prop)
+                      .value)
+            : ((Kokkos::Impl::ViewCtorProp<void, memory_space> const&)arg_prop)
+                  .value,
         ((Kokkos::Impl::ViewCtorProp<void, std::string> const&)arg_prop).value,
         alloc_size);
 
@@ -3168,10 +3229,14 @@ class ViewMapping<
       // Assume destruction is only required when construction is requested.
       // The ViewValueFunctor has both value construction and destruction
       // operators.
+      // When the caller supplied an execution space instance the
+      // construction kernel is enqueued on that instance without a fence;
+      // the caller is responsible for synchronizing before first use.
       record->m_destroy = functor_type(
           ((Kokkos::Impl::ViewCtorProp<void, execution_space> const&)arg_prop)
               .value,
-          (value_type*)m_impl_handle, m_impl_offset.span());
+          (value_type*)m_impl_handle, m_impl_offset.span(),
+          !alloc_prop::has_execution_space);
 
       // Construct values
       record->m_destroy.construct_shared_allocation();
@@ -3806,6 +3871,27 @@ KOKKOS_INLINE_FUNCTION void view_verify_operator_bounds(
   }
 }
 
+/* Span-granularity bounds check: one comparison of the already-computed
+   linear offset against the allocation span instead of the per-dimension
+   verification above.  This is cheap enough to leave enabled in
+   production builds; an out-of-bounds access aborts deterministically
+   instead of corrupting memory, but reports no label and no per-index
+   detail.  An offset that wraps back inside the span (a too-large
+   leading index combined with small trailing ones) is not caught. */
+
+template <class MapType>
+KOKKOS_FORCEINLINE_FUNCTION void view_verify_operator_span(
+    Kokkos::Impl::SharedAllocationTracker const&, const MapType&) {}
+
+template <class MapType, class iType, class... Args>
+KOKKOS_FORCEINLINE_FUNCTION void view_verify_operator_span(
+    Kokkos::Impl::SharedAllocationTracker const&, const MapType& map,
+    const iType& i, Args... args) {
+  if (!(size_t(map.m_impl_offset(i, args...)) < map.span())) {
+    Kokkos::abort("Kokkos::View span bounds violation");
+  }
+}
+
 } /* namespace Impl */
 } /* namespace Kokkos */
 
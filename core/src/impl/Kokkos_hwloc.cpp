@@ -47,6 +47,8 @@
 #include <iostream>
 #include <sstream>
 #include <algorithm>
+#include <cstdlib>
+#include <cstring>
 
 #include <Kokkos_Macros.hpp>
 #include <Kokkos_Core.hpp>
@@ -72,6 +74,79 @@ unsigned thread_mapping(const char* const label, const bool allow_async,
   const unsigned avail_threads_per_core =
       hwloc_avail ? hwloc::get_available_threads_per_core() : 1;
 
+  //------------------------------------------------------------------------
+  // Initialization-time placement policy from the environment:
+  //
+  //   KOKKOS_THREADS_CPU_LIST         explicit "numa.core,numa.core,..."
+  //                                   coordinate list, one entry per thread
+  //   KOKKOS_THREADS_PLACEMENT        "compact" fills one NUMA region's
+  //                                   cores before using the next;
+  //                                   "scatter" (the longstanding default)
+  //                                   spreads across all NUMA regions
+  //   KOKKOS_THREADS_USE_HYPERTHREADS "0" uses one thread per core,
+  //                                   leaving the extra PUs idle for
+  //                                   bandwidth-bound runs
+  //
+  // Thread rank order remains NUMA-major in every mode, so the
+  // contiguous per-rank ranges the Threads backend carves from a
+  // RangePolicy stay within each thread's local NUMA region under
+  // first-touch placement.
+
+  {
+    const char* const list = getenv("KOKKOS_THREADS_CPU_LIST");
+    if (list && *list) {
+      enum { max_list = 1024 };
+      const char* p  = list;
+      unsigned count = 0;
+      while (*p && count < unsigned(max_list)) {
+        char* end                = nullptr;
+        const unsigned long numa = strtoul(p, &end, 10);
+        if (end == p || '.' != *end) break;
+        p                        = end + 1;
+        const unsigned long core = strtoul(p, &end, 10);
+        if (end == p) break;
+        p                          = end;
+        threads_coord[count].first = unsigned(numa);
+        threads_coord[count].second = unsigned(core);
+        ++count;
+        if (',' == *p)
+          ++p;
+        else
+          break;
+      }
+      if (0 == count || *p) {
+        std::ostringstream msg;
+        msg << label
+            << " HWLOC ERROR : failed parsing KOKKOS_THREADS_CPU_LIST \""
+            << list << "\"";
+        Kokkos::Impl::throw_runtime_exception(msg.str());
+      }
+      thread_count       = count;
+      use_numa_count     = 0;
+      use_cores_per_numa = 0;
+      for (unsigned i = 0; i < count; ++i) {
+        if (use_numa_count < threads_coord[i].first + 1)
+          use_numa_count = threads_coord[i].first + 1;
+        if (use_cores_per_numa < threads_coord[i].second + 1)
+          use_cores_per_numa = threads_coord[i].second + 1;
+      }
+      // Synchronous: entry #0 binds the process thread
+      return 1;
+    }
+  }
+
+  unsigned avail_threads_per_core_use = avail_threads_per_core;
+  {
+    const char* const env = getenv("KOKKOS_THREADS_USE_HYPERTHREADS");
+    if (env && 0 == atoi(env)) avail_threads_per_core_use = 1;
+  }
+
+  bool placement_compact = false;
+  {
+    const char* const env = getenv("KOKKOS_THREADS_PLACEMENT");
+    if (env && 0 == strcmp(env, "compact")) placement_compact = true;
+  }
+
   // (numa,core) coordinate of the process:
   const std::pair<unsigned, unsigned> proc_coord =
       Kokkos::hwloc::get_this_thread_coordinate();
@@ -80,11 +155,21 @@ unsigned thread_mapping(const char* const label, const bool allow_async,
   // Defaults for unspecified inputs:
 
   if (!use_numa_count) {
-    // Default to use all NUMA regions
-    use_numa_count = !thread_count
-                         ? avail_numa_count
-                         : (thread_count < avail_numa_count ? thread_count
-                                                            : avail_numa_count);
+    if (placement_compact && thread_count) {
+      // Compact placement: as few NUMA regions as the threads fit in
+      const unsigned per_numa =
+          avail_cores_per_numa * avail_threads_per_core_use;
+      use_numa_count =
+          per_numa ? (thread_count + per_numa - 1) / per_numa : 1;
+      if (avail_numa_count < use_numa_count) use_numa_count = avail_numa_count;
+    } else {
+      // Default to use all NUMA regions
+      use_numa_count =
+          !thread_count
+              ? avail_numa_count
+              : (thread_count < avail_numa_count ? thread_count
+                                                 : avail_numa_count);
+    }
   }
 
   if (!use_cores_per_numa) {
@@ -100,7 +185,8 @@ unsigned thread_mapping(const char* const label, const bool allow_async,
   }
 
   if (!thread_count) {
-    thread_count = use_numa_count * use_cores_per_numa * avail_threads_per_core;
+    thread_count =
+        use_numa_count * use_cores_per_numa * avail_threads_per_core_use;
   }
 
   //------------------------------------------------------------------------
@@ -111,7 +197,7 @@ unsigned thread_mapping(const char* const label, const bool allow_async,
       use_cores_per_numa && use_cores_per_numa <= avail_cores_per_numa;
   const bool valid_threads =
       thread_count && thread_count <= use_numa_count * use_cores_per_numa *
-                                          avail_threads_per_core;
+                                          avail_threads_per_core_use;
   const bool balanced_numa = !(thread_count % use_numa_count);
   const bool balanced_cores =
       !(thread_count % (use_numa_count * use_cores_per_numa));
@@ -745,3 +831,37 @@ std::pair<unsigned, unsigned> get_this_thread_coordinate() {
 //----------------------------------------------------------------------------
 
 #endif
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+/* Cache geometry query shared by the hwloc and non-hwloc builds. */
+
+#include <unistd.h>
+
+namespace Kokkos {
+namespace hwloc {
+
+size_t get_cache_size(unsigned level) {
+  long size = -1;
+#if defined(_SC_LEVEL1_DCACHE_SIZE) && defined(_SC_LEVEL2_CACHE_SIZE) && \
+    defined(_SC_LEVEL3_CACHE_SIZE)
+  switch (level) {
+    case 1: size = sysconf(_SC_LEVEL1_DCACHE_SIZE); break;
+    case 2: size = sysconf(_SC_LEVEL2_CACHE_SIZE); break;
+    case 3: size = sysconf(_SC_LEVEL3_CACHE_SIZE); break;
+    default: break;
+  }
+#endif
+  if (size <= 0) {
+    switch (level) {
+      case 1: return 32 * 1024;
+      case 2: return 512 * 1024;
+      case 3: return 16 * 1024 * 1024;
+      default: return 0;
+    }
+  }
+  return size_t(size);
+}
+
+} /* namespace hwloc */
+} /* namespace Kokkos */
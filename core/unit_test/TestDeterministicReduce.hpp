@@ -0,0 +1,146 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+#include <cstdint>
+#include <cstring>
+
+namespace Test {
+
+// Terms with mixed signs and magnitudes derived from a hash of the
+// index, so the floating-point sum depends on the order and grouping
+// of the additions - exactly what deterministic_reduce promises to
+// pin down.
+template <class ExecSpace>
+struct TestDeterministicReduceTerm {
+  typedef ExecSpace execution_space;
+
+  KOKKOS_INLINE_FUNCTION
+  static double term(const int64_t i) {
+    const uint32_t h = uint32_t(i) * 1664525u + 1013904223u;
+    const double mag = double(h % 1000003u) * 1.0e-7;
+    return (h & 1u) ? mag : -3.0 * mag;
+  }
+
+  // Templated on the update type so the same functor drives both the
+  // plain Sum overload and the CompensatedSum reducer form.
+  template <class ValueType>
+  KOKKOS_INLINE_FUNCTION void operator()(const int64_t i,
+                                         ValueType& update) const {
+    update += term(i);
+  }
+};
+
+template <class ExecSpace>
+void test_deterministic_reduce(const int64_t n, const int64_t chunk_size) {
+  typedef TestDeterministicReduceTerm<ExecSpace> functor_type;
+
+  const functor_type functor;
+
+  double result = 0.0;
+  Kokkos::Experimental::deterministic_reduce<ExecSpace>(
+      "TestDeterministicReduce", n, functor, result, chunk_size);
+
+  // Repeated runs must deliver the same bit pattern, not merely values
+  // within a tolerance.
+  for (int rep = 0; rep < 3; ++rep) {
+    double repeat = 0.0;
+    Kokkos::Experimental::deterministic_reduce<ExecSpace>(
+        "TestDeterministicReduce", n, functor, repeat, chunk_size);
+    ASSERT_EQ(0, std::memcmp(&result, &repeat, sizeof(double)));
+  }
+
+  // The promised combining shape is a function of chunk_size alone:
+  // chunks summed serially in index order, partials joined in chunk
+  // order.  Replaying that shape serially on the host must reproduce
+  // the parallel result bit for bit, whatever concurrency the
+  // execution space ran the chunks at.
+  double replay = 0.0;
+  for (int64_t begin = 0; begin < n; begin += chunk_size) {
+    const int64_t end = begin + chunk_size < n ? begin + chunk_size : n;
+    double partial    = 0.0;
+    for (int64_t i = begin; i < end; ++i) partial += functor_type::term(i);
+    replay += partial;
+  }
+  ASSERT_EQ(0, std::memcmp(&result, &replay, sizeof(double)));
+
+  // Empty range: the reducer's identity, untouched.
+  double empty = -1.0;
+  Kokkos::Experimental::deterministic_reduce<ExecSpace>(
+      "TestDeterministicReduce", 0, functor, empty, chunk_size);
+  ASSERT_EQ(0.0, empty);
+}
+
+template <class ExecSpace>
+void test_deterministic_reduce_compensated(const int64_t n,
+                                           const int64_t chunk_size) {
+  typedef TestDeterministicReduceTerm<ExecSpace> functor_type;
+  typedef Kokkos::Experimental::CompensatedScalar<double> value_type;
+
+  const functor_type functor;
+
+  value_type result;
+  Kokkos::Experimental::deterministic_reduce<ExecSpace>(
+      "TestDeterministicReduceCompensated", 0, n, functor,
+      Kokkos::Experimental::CompensatedSum<double>(result), chunk_size);
+
+  for (int rep = 0; rep < 3; ++rep) {
+    value_type repeat;
+    Kokkos::Experimental::deterministic_reduce<ExecSpace>(
+        "TestDeterministicReduceCompensated", 0, n, functor,
+        Kokkos::Experimental::CompensatedSum<double>(repeat), chunk_size);
+    ASSERT_EQ(0, std::memcmp(&result, &repeat, sizeof(value_type)));
+  }
+}
+
+TEST(TEST_CATEGORY, deterministic_reduce) {
+  test_deterministic_reduce<TEST_EXECSPACE>(100000, 4096);
+  test_deterministic_reduce<TEST_EXECSPACE>(100000, 997);
+  test_deterministic_reduce_compensated<TEST_EXECSPACE>(100000, 4096);
+}
+
+}  // namespace Test
@@ -0,0 +1,226 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_SIMD.hpp>
+
+#include <cstdint>
+
+namespace Test {
+
+// Lane-wise checks of one ABI: broadcast, lane access, contiguous
+// load/store round trip, the four operators in both forms, gather and
+// scatter through an index permutation, and the horizontal sum.
+// Integer-exact inputs so every comparison is an equality.
+template <class Simd>
+void test_simd_abi() {
+  typedef typename Simd::value_type scalar_type;
+  enum { N = Simd::size() };
+
+  scalar_type a_mem[N], b_mem[N], out_mem[N];
+  int idx[N];
+  for (int i = 0; i < N; ++i) {
+    a_mem[i] = scalar_type(3 * i + 2);
+    b_mem[i] = scalar_type(i + 1);
+    idx[i]   = (N - 1) - i;
+  }
+
+  Simd broadcast(scalar_type(7));
+  for (int i = 0; i < N; ++i) ASSERT_EQ(scalar_type(7), broadcast[i]);
+
+  Simd a, b;
+  a.copy_from(a_mem);
+  b.copy_from(b_mem);
+  a.copy_to(out_mem);
+  for (int i = 0; i < N; ++i) ASSERT_EQ(a_mem[i], out_mem[i]);
+
+  (a + b).copy_to(out_mem);
+  for (int i = 0; i < N; ++i) ASSERT_EQ(a_mem[i] + b_mem[i], out_mem[i]);
+  (a - b).copy_to(out_mem);
+  for (int i = 0; i < N; ++i) ASSERT_EQ(a_mem[i] - b_mem[i], out_mem[i]);
+  (a * b).copy_to(out_mem);
+  for (int i = 0; i < N; ++i) ASSERT_EQ(a_mem[i] * b_mem[i], out_mem[i]);
+  (a / b).copy_to(out_mem);
+  for (int i = 0; i < N; ++i) ASSERT_EQ(a_mem[i] / b_mem[i], out_mem[i]);
+
+  Simd c = a;
+  c += b;
+  c -= b;
+  c *= b;
+  c /= b;
+  c.copy_to(out_mem);
+  for (int i = 0; i < N; ++i) ASSERT_EQ(a_mem[i], out_mem[i]);
+
+  Simd g;
+  g.gather_from(a_mem, idx);
+  for (int i = 0; i < N; ++i) ASSERT_EQ(a_mem[idx[i]], g[i]);
+  g.scatter_to(out_mem, idx);
+  for (int i = 0; i < N; ++i) ASSERT_EQ(a_mem[i], out_mem[i]);
+
+  scalar_type sum = 0;
+  for (int i = 0; i < N; ++i) sum += a_mem[i];
+  ASSERT_EQ(sum, a.reduce_add());
+}
+
+// simd_for must visit every index exactly once: aligned chunks at the
+// ABI width, the ragged tail at scalar width.
+struct TestSIMDForCoverage {
+  int* visits;
+  int width;
+
+  template <class Tag>
+  void operator()(const int i, Tag) const {
+    for (int lane = 0; lane < Tag::size; ++lane) ++visits[i + lane];
+    if (int(Tag::size) == width) {
+      // A full-width chunk must start on a width-aligned index.
+      if (0 != i % width) visits[i] = -1000000;
+    }
+  }
+};
+
+inline void test_simd_for_coverage(const int count) {
+  typedef Kokkos::Experimental::simd_abi::pack<4> abi;
+
+  int visits[64] = {0};
+  TestSIMDForCoverage op = {visits, abi::size};
+  Kokkos::Experimental::simd_for<abi>(count, op);
+  for (int i = 0; i < count; ++i) ASSERT_EQ(1, visits[i]);
+  for (int i = count; i < 64; ++i) ASSERT_EQ(0, visits[i]);
+}
+
+// The axpy body written once against simd<T, Tag>: simd_for invokes it
+// at native width for the aligned chunks and at scalar width for the
+// tail, on host and device alike.
+template <class Scalar>
+struct TestSIMDAxpyOp {
+  const Scalar* x;
+  Scalar* y;
+  Scalar a;
+
+  template <class Tag>
+  KOKKOS_FORCEINLINE_FUNCTION void operator()(const int i, Tag) const {
+    Kokkos::Experimental::simd<Scalar, Tag> xv, yv;
+    xv.copy_from(x + i);
+    yv.copy_from(y + i);
+    yv += Kokkos::Experimental::simd<Scalar, Tag>(a) * xv;
+    yv.copy_to(y + i);
+  }
+};
+
+template <class ExecSpace>
+struct TestSIMDAxpyFunctor {
+  typedef ExecSpace execution_space;
+
+  Kokkos::View<double**, Kokkos::LayoutRight, ExecSpace> x;
+  Kokkos::View<double**, Kokkos::LayoutRight, ExecSpace> y;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int r) const {
+    TestSIMDAxpyOp<double> op = {&x(r, 0), &y(r, 0), 2.0};
+    Kokkos::Experimental::simd_for<Kokkos::Experimental::simd_abi::native>(
+        int(x.extent(1)), op);
+  }
+};
+
+template <class ExecSpace>
+struct TestSIMDAxpyInit {
+  typedef ExecSpace execution_space;
+
+  Kokkos::View<double**, Kokkos::LayoutRight, ExecSpace> x;
+  Kokkos::View<double**, Kokkos::LayoutRight, ExecSpace> y;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int r) const {
+    for (size_t j = 0; j < x.extent(1); ++j) {
+      x(r, j) = double(r + 1);
+      y(r, j) = double(j);
+    }
+  }
+};
+
+// Row lengths chosen to include an empty vector body (3), an exact
+// multiple of the native width, and a ragged tail.
+template <class ExecSpace>
+void test_simd_kernel(const int rows, const int cols) {
+  typedef Kokkos::View<double**, Kokkos::LayoutRight, ExecSpace> view_type;
+
+  view_type x("simd_x", rows, cols);
+  view_type y("simd_y", rows, cols);
+
+  Kokkos::parallel_for(Kokkos::RangePolicy<ExecSpace>(0, rows),
+                       TestSIMDAxpyInit<ExecSpace>{x, y});
+  Kokkos::parallel_for(Kokkos::RangePolicy<ExecSpace>(0, rows),
+                       TestSIMDAxpyFunctor<ExecSpace>{x, y});
+
+  auto h_y = Kokkos::create_mirror_view(y);
+  Kokkos::deep_copy(h_y, y);
+  for (int r = 0; r < rows; ++r)
+    for (int j = 0; j < cols; ++j)
+      ASSERT_EQ(double(j) + 2.0 * double(r + 1), h_y(r, j));
+}
+
+TEST(TEST_CATEGORY, simd) {
+  using Kokkos::Experimental::simd;
+  using Kokkos::Experimental::simd_abi::pack;
+  using Kokkos::Experimental::simd_abi::scalar;
+
+  test_simd_abi<simd<double, scalar> >();
+  test_simd_abi<simd<double, pack<4> > >();
+  test_simd_abi<simd<double, pack<8> > >();
+  test_simd_abi<simd<float, pack<8> > >();
+  test_simd_abi<simd<int64_t, pack<8> > >();
+
+  test_simd_for_coverage(3);   // tail only
+  test_simd_for_coverage(16);  // chunks only
+  test_simd_for_coverage(37);  // chunks plus tail
+
+  test_simd_kernel<TEST_EXECSPACE>(64, 3);
+  test_simd_kernel<TEST_EXECSPACE>(64, 32);
+  test_simd_kernel<TEST_EXECSPACE>(64, 37);
+}
+
+}  // namespace Test